@@ -12,11 +12,16 @@
 
 #ifdef __cplusplus
 #include <cstdlib>
+#include <cstddef>
 #include <cstdio>
+#include <cstring>
 #include <cassert>
+#include <vector>
 #else
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 #endif
 
@@ -35,6 +40,41 @@ typedef __int8 int8_t;
 typedef unsigned __int8 uint8_t;
 #endif
 
+/* Likewise AVX-512 (F, VL, DQ and BW) is a superset of AVX2, and adds the 512 bit vectors.  If the compiler also targets AVX-512 IFMA, the 64 bit multiplies use it. */
+#if LIBDIVIDE_USE_AVX512
+   #undef LIBDIVIDE_USE_AVX2
+   #define LIBDIVIDE_USE_AVX2 1
+#endif
+
+/* AVX2 is a superset of SSE2 and SSE 4.1, so the 128 bit vectors come from the SSE2 code, and AVX2 adds the 256 bit vectors on top */
+#if LIBDIVIDE_USE_AVX2
+   #undef LIBDIVIDE_USE_SSE2
+   #define LIBDIVIDE_USE_SSE2 1
+   #ifndef LIBDIVIDE_USE_SSE4_1
+      #define LIBDIVIDE_USE_SSE4_1 1
+   #endif
+#include <immintrin.h>
+#endif
+
+/* LIBDIVIDE_USE_DISPATCH picks the kernels for the array functions when the program runs, instead of when it is compiled, so that one binary can use AVX2 or AVX-512 where the CPU has them and still run on plain SSE2 machines.  The AVX2 and AVX-512 kernels are always built, each compiled for its own instruction set with the target attribute, and the 128 bit vectors are SSE2 as usual.  This needs GCC or clang on x86. */
+#if LIBDIVIDE_USE_DISPATCH
+   #if !(defined(__x86_64__) || defined(__i386__)) || !(__GNUC__ || __clang__)
+      #error "LIBDIVIDE_USE_DISPATCH needs GCC or clang on x86"
+   #endif
+   #if LIBDIVIDE_USE_AVX2
+      #error "LIBDIVIDE_USE_DISPATCH chooses between the AVX2 and AVX-512 kernels itself, so don't also define LIBDIVIDE_USE_AVX2 or LIBDIVIDE_USE_AVX512"
+   #endif
+   #undef LIBDIVIDE_USE_SSE2
+   #define LIBDIVIDE_USE_SSE2 1
+#include <immintrin.h>
+/* Only the array functions call the wide kernels here, so some of them go unused */
+#define LIBDIVIDE_TARGET_AVX2 __attribute__((__target__("avx2"), __unused__))
+#define LIBDIVIDE_TARGET_AVX512 __attribute__((__target__("avx2,avx512f,avx512vl,avx512dq,avx512bw"), __unused__))
+#else
+#define LIBDIVIDE_TARGET_AVX2
+#define LIBDIVIDE_TARGET_AVX512
+#endif
+
 #if LIBDIVIDE_USE_SSE2
    #if LIBDIVIDE_VC
       #include <mmintrin.h>
@@ -68,11 +108,55 @@ typedef unsigned __int8 uint8_t;
 #define LIBDIVIDE_GCC_STYLE_ASM 1
 #endif
 
+/* The divider caches need the GCC __atomic builtins, which clang has too */
+#if (__GNUC__ || __clang__) && defined(__ATOMIC_ACQUIRE)
+#define LIBDIVIDE_HAS_ATOMICS 1
+#endif
+
+/* The thread pool for the parallel array functions is only built when LIBDIVIDE_USE_THREADS is defined, and then needs pthreads too, so the program has to link with -pthread.  Its workers can only be pinned to CPUs with glibc's CPU_SET, which needs _GNU_SOURCE */
+#if LIBDIVIDE_USE_THREADS && LIBDIVIDE_HAS_ATOMICS && ! LIBDIVIDE_WINDOWS
+#include <pthread.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#endif
+#define LIBDIVIDE_HAS_THREADS 1
+#endif
+
+/* constant_divider works out its magic numbers at compile time, which needs C++11 constexpr.  MSVC only sets __cplusplus with /Zc:__cplusplus, so check _MSVC_LANG too */
+#if defined(__cplusplus) && (__cplusplus >= 201103L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201103L))
+#define LIBDIVIDE_HAS_CONSTEXPR 1
+#define LIBDIVIDE_CONSTEXPR constexpr
+#else
+#define LIBDIVIDE_CONSTEXPR
+#endif
+
+/* The divide overloads that take spans need C++20, and the ones that also take an execution policy need a standard library that has the parallel algorithms */
+#if defined(__cplusplus) && (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)) && defined(__has_include)
+#if __has_include(<span>) && __has_include(<version>)
+#include <version>
+#include <span>
+#include <type_traits>
+#define LIBDIVIDE_HAS_SPAN 1
+#if defined(__cpp_lib_execution) && __has_include(<execution>)
+#include <execution>
+#include <algorithm>
+#define LIBDIVIDE_HAS_EXECUTION 1
+#endif
+#endif
+#endif
+
 /* libdivide may use the pmuldq (vector signed 32x32->64 mult instruction) which is in SSE 4.1.  However, signed multiplication can be emulated efficiently with unsigned multiplication, and SSE 4.1 is currently rare, so it is OK to not turn this on */
 #ifdef LIBDIVIDE_USE_SSE4_1
 #include <smmintrin.h>
 #endif
 
+/* The divider table is plain integers with C linkage, declared out here so that every file that includes it means the same table */
+#if LIBDIVIDE_USE_TABLE
+#include "libdivide_table.h"
+#endif
+
 #ifdef __cplusplus
 /* We place libdivide within the libdivide namespace, and that goes in an anonymous namespace so that the functions are only visible to files that #include this header and don't get external linkage.  At least that's the theory. */
 namespace {
@@ -100,39 +184,323 @@ s64: [0-5] shift value
      [6] add indicator
      [7] indicates negative divisor
      magic number of 0 indicates shift path (we ran out of bits!)
+
+u16: [0-3] shift value
+     [4-5] ignored
+     [6] add indicator
+     [7] shift path
+
+s16: [0-3] shift value
+     [4] ignored
+     [5] shift path
+     [6] add indicator
+     [7] indicates negative divisor
+
+u8: [0-2] shift value
+    [3-5] ignored
+    [6] add indicator
+    [7] shift path
+
+s8: [0-2] shift value
+    [3-4] ignored
+    [5] shift path
+    [6] add indicator
+    [7] indicates negative divisor
+
+The 128 bit shift needs seven bits, so their more field is 16 bits wide:
+
+u128: [0-6] shift value
+      [7] add indicator
+      [8] shift path
+
+s128: [0-6] shift value
+      [7] add indicator
+      [8] indicates negative divisor
+      magic number of 0 indicates shift path, as for s64
+
+divisor is the d that the struct was generated from.  Division doesn't need it, but the remainder functions do.
 */
 
 enum {
+    LIBDIVIDE_8_SHIFT_MASK = 0x07,
+    LIBDIVIDE_16_SHIFT_MASK = 0x0F,
     LIBDIVIDE_32_SHIFT_MASK = 0x1F,
     LIBDIVIDE_64_SHIFT_MASK = 0x3F,
     LIBDIVIDE_ADD_MARKER = 0x40,
+    LIBDIVIDE_U8_SHIFT_PATH = 0x80,
+    LIBDIVIDE_U16_SHIFT_PATH = 0x80,
     LIBDIVIDE_U32_SHIFT_PATH = 0x80,
     LIBDIVIDE_U64_SHIFT_PATH = 0x80,
+    LIBDIVIDE_S8_SHIFT_PATH = 0x20,
+    LIBDIVIDE_S16_SHIFT_PATH = 0x20,
     LIBDIVIDE_S32_SHIFT_PATH = 0x20,
-    LIBDIVIDE_NEGATIVE_DIVISOR = 0x80
+    LIBDIVIDE_NEGATIVE_DIVISOR = 0x80,
+    LIBDIVIDE_128_SHIFT_MASK = 0x7F,
+    LIBDIVIDE_128_ADD_MARKER = 0x80,
+    LIBDIVIDE_U128_SHIFT_PATH = 0x100,
+    LIBDIVIDE_128_NEGATIVE_DIVISOR = 0x100
 };
 
 
 struct libdivide_u32_t {
     uint32_t magic;
     uint8_t more;
+    uint32_t divisor;
 };
 
 struct libdivide_s32_t {
     int32_t magic;
     uint8_t more;
+    int32_t divisor;
 };
 
 struct libdivide_u64_t {
     uint64_t magic;
     uint8_t more;
+    uint64_t divisor;
 };
 
 struct libdivide_s64_t {
     int64_t magic;
     uint8_t more;
+    int64_t divisor;
+};
+
+struct libdivide_u16_t {
+    uint16_t magic;
+    uint8_t more;
+    uint16_t divisor;
+};
+
+struct libdivide_s16_t {
+    int16_t magic;
+    uint8_t more;
+    int16_t divisor;
+};
+
+struct libdivide_u8_t {
+    uint8_t magic;
+    uint8_t more;
+    uint8_t divisor;
+};
+
+struct libdivide_s8_t {
+    int8_t magic;
+    uint8_t more;
+    int8_t divisor;
+};
+
+#if HAS_INT128_T
+struct libdivide_u128_t {
+    __uint128_t magic;
+    uint16_t more;
+    __uint128_t divisor;
+};
+
+struct libdivide_s128_t {
+    __int128_t magic;
+    uint16_t more;
+    __int128_t divisor;
+};
+#endif
+
+/* The fastmod structs compute only the remainder, straight from the low bits of numer * magic, where magic is ceil(2**64 / d) for u32 and ceil(2**128 / d) for u64.  See Lemire, Kaser and Kurz, "Faster Remainder by Direct Computation". */
+struct libdivide_u32_fastmod_t {
+    uint64_t magic;
+    uint32_t divisor;
+};
+
+struct libdivide_u64_fastmod_t {
+    uint64_t magic_lo;
+    uint64_t magic_hi;
+    uint64_t divisor;
+};
+
+/* The narrow struct divides a 128 bit numerator by a 64 bit d.  divisor is d shifted left by shift until its top bit is set, and reciprocal is floor((2**128 - 1) / divisor) - 2**64.  See Moller and Granlund, "Improved division by invariant integers", algorithm 4. */
+struct libdivide_u64_narrow_t {
+    uint64_t divisor;
+    uint64_t reciprocal;
+    uint8_t shift;
+};
+
+/* The divisible structs test numer % d == 0 without dividing.  With d = odd * 2**shift, numer is divisible exactly when numer * inverse (the inverse of odd, modulo 2**32 or 2**64), rotated right by shift, is at most threshold.  The signed ones add offset before rotating, which brings the negative multiples into range too.  See Granlund and Montgomery, "Division by Invariant Integers using Multiplication", section 9. */
+struct libdivide_u32_divisible_t {
+    uint32_t inverse;
+    uint32_t threshold;
+    uint8_t shift;
+};
+
+struct libdivide_s32_divisible_t {
+    uint32_t inverse;
+    uint32_t offset;
+    uint32_t threshold;
+    uint8_t shift;
+};
+
+struct libdivide_u64_divisible_t {
+    uint64_t inverse;
+    uint64_t threshold;
+    uint8_t shift;
+};
+
+struct libdivide_s64_divisible_t {
+    uint64_t inverse;
+    uint64_t offset;
+    uint64_t threshold;
+    uint8_t shift;
+};
+
+/* The exact structs divide numerators that are known to be multiples of d.  With d = odd * 2**shift, numer / d is (numer >> shift) times the inverse of odd, modulo 2**32 or 2**64, so the high multiply of libdivide_*_do becomes a low multiply.  For signed d, odd keeps the sign of d. */
+struct libdivide_u32_exact_t {
+    uint32_t inverse;
+    uint8_t shift;
+};
+
+struct libdivide_s32_exact_t {
+    uint32_t inverse;
+    uint8_t shift;
+};
+
+struct libdivide_u64_exact_t {
+    uint64_t inverse;
+    uint8_t shift;
+};
+
+struct libdivide_s64_exact_t {
+    uint64_t inverse;
+    uint8_t shift;
+};
+
+/* The branchfree structs always take the 33 or 65 bit path of the ordinary divisors, so that dividing is one fixed instruction sequence whatever d is, and kernels that go through many divisors don't mispredict.  more holds the shift and, for signed d, LIBDIVIDE_NEGATIVE_DIVISOR.  A power of 2 gets a magic of 0. */
+struct libdivide_u32_branchfree_t {
+    uint32_t magic;
+    uint8_t more;
+};
+
+struct libdivide_s32_branchfree_t {
+    int32_t magic;
+    uint8_t more;
+};
+
+struct libdivide_u64_branchfree_t {
+    uint64_t magic;
+    uint8_t more;
+};
+
+struct libdivide_s64_branchfree_t {
+    int64_t magic;
+    uint8_t more;
+};
+
+/* A divider array holds the branchfree dividers for many divisors as two packed arrays, one of the magic numbers and one of the more bytes, where an array of the structs above pads every more byte out to the size of the magic number.  That is 5 bytes a divider instead of 8 at 32 bits, and 9 instead of 16 at 64 bits, so more of a big table stays in cache when each row looks up its own divider, as in a dictionary encoded column.  The caller provides the storage, room for n magic numbers and for n + LIBDIVIDE_ARRAY_PADDING more bytes, as the gathers load each more byte as part of a wider word.  libdivide_*_array_gen fills them in and sets n.  The unsigned branchfree dividers cannot divide by 1, so in the unsigned arrays a more byte of LIBDIVIDE_ARRAY_ONE, with a magic number of 0, marks a divisor of 1 and the numerator is passed through. */
+#define LIBDIVIDE_ARRAY_PADDING 7
+#define LIBDIVIDE_ARRAY_ONE 0xFF
+
+struct libdivide_u32_array_t {
+    uint32_t *magics;
+    uint8_t *mores;
+    size_t n;
+};
+
+struct libdivide_s32_array_t {
+    int32_t *magics;
+    uint8_t *mores;
+    size_t n;
+};
+
+struct libdivide_u64_array_t {
+    uint64_t *magics;
+    uint8_t *mores;
+    size_t n;
+};
+
+struct libdivide_s64_array_t {
+    int64_t *magics;
+    uint8_t *mores;
+    size_t n;
+};
+
+#if LIBDIVIDE_HAS_ATOMICS
+/* The divider caches hold the dividers of recently seen divisors for libdivide_*_gen_cached.  Each is an open addressed hash table of 2**LIBDIVIDE_CACHE_BITS slots, where a divisor may sit in any of the four slots from the one it hashes to.  A slot's sequence is odd while it is being written, and readers check that it was even and unchanged across their reads instead of taking a lock, so they never wait: a reader that loses that race, or a writer that finds the slot taken by another writer, just goes without the cache that once.  The hit and miss counts are spread over LIBDIVIDE_CACHE_STRIPES cache lines, so that threads don't all bump the same one, and are not exact when threads do share one.  A zeroed cache is empty, so a static one needs no setting up. */
+#ifndef LIBDIVIDE_CACHE_BITS
+#define LIBDIVIDE_CACHE_BITS 8
+#endif
+#ifndef LIBDIVIDE_CACHE_STRIPES
+#define LIBDIVIDE_CACHE_STRIPES 16
+#endif
+
+struct libdivide_cache_slot_t {
+    uint64_t sequence;
+    uint64_t divisor; //0 for an empty slot
+    uint64_t magic;
+    uint64_t more;
+};
+
+struct libdivide_cache_counts_t {
+    uint64_t hits;
+    uint64_t misses;
+} __attribute__((__aligned__(64)));
+
+struct libdivide_u64_cache_t {
+    struct libdivide_cache_slot_t slots[1 << LIBDIVIDE_CACHE_BITS];
+    struct libdivide_cache_counts_t counts[LIBDIVIDE_CACHE_STRIPES];
 };
 
+struct libdivide_s64_cache_t {
+    struct libdivide_cache_slot_t slots[1 << LIBDIVIDE_CACHE_BITS];
+    struct libdivide_cache_counts_t counts[LIBDIVIDE_CACHE_STRIPES];
+};
+#endif
+
+/* Arrays are divided on several threads in chunks of LIBDIVIDE_PARALLEL_CHUNK bytes of numerators, which is enough to pay for handing them out and small enough to stay in a core's L2 cache */
+#ifndef LIBDIVIDE_PARALLEL_CHUNK
+#define LIBDIVIDE_PARALLEL_CHUNK 65536
+#endif
+
+#if LIBDIVIDE_HAS_THREADS
+/* A pool of threads for libdivide_*_do_array_parallel.  Each job gives every worker its own run of chunks, which it takes from the front; a worker that runs out steals from the back of the others' runs, nearest first.  With LIBDIVIDE_POOL_NUMA the workers are pinned to CPUs and steal from the workers on their own NUMA node before the rest, so as long as the same pool keeps dividing the same arrays, each chunk stays with a worker near the memory it touched first.  Results larger than stream_above bytes are written with non-temporal stores, so that they don't evict everything else from the caches on the way out; libdivide_pool_init sets it to the size of the last level cache, or LIBDIVIDE_POOL_CACHE_SIZE when sysconf can't tell, and it may be changed between jobs. */
+#ifndef LIBDIVIDE_POOL_MAX_THREADS
+#define LIBDIVIDE_POOL_MAX_THREADS 64
+#endif
+#ifndef LIBDIVIDE_POOL_CACHE_SIZE
+#define LIBDIVIDE_POOL_CACHE_SIZE (32 << 20)
+#endif
+#define LIBDIVIDE_POOL_NUMA 1
+
+struct libdivide_pool_t;
+
+struct libdivide_pool_worker_t {
+    uint64_t chunks; //the worker's next chunk in the low half, and one past its last in the high half
+    struct libdivide_pool_t *pool;
+    pthread_t thread;
+    unsigned index;
+    int node; //-1 unless pinned
+} __attribute__((__aligned__(64)));
+
+struct libdivide_pool_t {
+    struct libdivide_pool_worker_t workers[LIBDIVIDE_POOL_MAX_THREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    unsigned threads;
+    unsigned flags;
+    unsigned busy; //workers still on the job
+    int stop;
+    uint64_t job; //counts the jobs, so that the workers can tell a new one
+    size_t stream_above;
+
+    /* The job */
+    void (*divide)(const void *numers, void *results, size_t n, const void *denom);
+    const char *numers;
+    char *results;
+    const void *denom;
+    size_t n;
+    size_t width;
+    size_t chunk;
+    int stream;
+};
+#endif
+
 #ifndef LIBDIVIDE_API
     #ifdef __cplusplus
         /* In C++, we don't want our public functions to be static, because they are arguments to templates and static functions can't do that.  They get internal linkage through virtue of the anonymous namespace.  In C, they should be static. */
@@ -152,6 +520,75 @@ LIBDIVIDE_API uint32_t libdivide_u32_do(uint32_t numer, const struct libdivide_u
 LIBDIVIDE_API int64_t  libdivide_s64_do(int64_t numer, const struct libdivide_s64_t *denom);
 LIBDIVIDE_API uint64_t libdivide_u64_do(uint64_t y, const struct libdivide_u64_t *denom);
 
+/* Remainders.  libdivide_*_mod returns numer % d, and libdivide_*_divmod returns numer / d and stores numer % d in *remainder, at the cost of one more multiply than the division alone.  As with the % operator, a signed remainder has the sign of the numerator. */
+LIBDIVIDE_API int32_t  libdivide_s32_mod(int32_t numer, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API uint32_t libdivide_u32_mod(uint32_t numer, const struct libdivide_u32_t *denom);
+LIBDIVIDE_API int64_t  libdivide_s64_mod(int64_t numer, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API uint64_t libdivide_u64_mod(uint64_t numer, const struct libdivide_u64_t *denom);
+LIBDIVIDE_API int32_t  libdivide_s32_divmod(int32_t numer, const struct libdivide_s32_t *denom, int32_t *remainder);
+LIBDIVIDE_API uint32_t libdivide_u32_divmod(uint32_t numer, const struct libdivide_u32_t *denom, uint32_t *remainder);
+LIBDIVIDE_API int64_t  libdivide_s64_divmod(int64_t numer, const struct libdivide_s64_t *denom, int64_t *remainder);
+LIBDIVIDE_API uint64_t libdivide_u64_divmod(uint64_t numer, const struct libdivide_u64_t *denom, uint64_t *remainder);
+
+/* Remainder-only division for unsigned types.  libdivide_*_fastmod returns numer % d without computing the quotient first, which saves the dependent multiply of libdivide_*_mod.  libdivide_*_fastmod_array stores the remainders of n numerators to results, with the widest vectors there are, picked at run time with LIBDIVIDE_USE_DISPATCH. */
+LIBDIVIDE_API struct libdivide_u32_fastmod_t libdivide_u32_fastmod_gen(uint32_t d);
+LIBDIVIDE_API struct libdivide_u64_fastmod_t libdivide_u64_fastmod_gen(uint64_t d);
+LIBDIVIDE_API uint32_t libdivide_u32_fastmod(uint32_t numer, const struct libdivide_u32_fastmod_t *denom);
+LIBDIVIDE_API uint64_t libdivide_u64_fastmod(uint64_t numer, const struct libdivide_u64_fastmod_t *denom);
+LIBDIVIDE_API void libdivide_u32_fastmod_array(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_fastmod_t *denom);
+LIBDIVIDE_API void libdivide_u64_fastmod_array(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_fastmod_t *denom);
+
+/* Narrowing division, for fixed point rescaling and bignum inner loops.  libdivide_u64_narrow_do divides the 128 bit numerator {numer_hi, numer_lo} by d, returning the quotient and storing the remainder in *remainder unless remainder is NULL.  numer_hi must be less than d, so that the quotient fits in 64 bits.  It costs two multiplies, where divq takes tens of cycles.  The array function takes the high and low halves of n numerators from separate arrays; remainders may be NULL there too. */
+LIBDIVIDE_API struct libdivide_u64_narrow_t libdivide_u64_narrow_gen(uint64_t d);
+LIBDIVIDE_API uint64_t libdivide_u64_narrow_do(uint64_t numer_hi, uint64_t numer_lo, const struct libdivide_u64_narrow_t *denom, uint64_t *remainder);
+LIBDIVIDE_API void libdivide_u64_narrow_do_array(const uint64_t *numers_hi, const uint64_t *numers_lo, uint64_t *quotients, uint64_t *remainders, size_t n, const struct libdivide_u64_narrow_t *denom);
+
+/* Divisibility tests.  libdivide_*_is_divisible returns 1 if numer % d == 0 and 0 otherwise, with one multiply, a rotate and a compare.  The vector forms return a lane mask, all ones in the lanes that are divisible. */
+LIBDIVIDE_API struct libdivide_s32_divisible_t libdivide_s32_divisible_gen(int32_t d);
+LIBDIVIDE_API struct libdivide_u32_divisible_t libdivide_u32_divisible_gen(uint32_t d);
+LIBDIVIDE_API struct libdivide_s64_divisible_t libdivide_s64_divisible_gen(int64_t d);
+LIBDIVIDE_API struct libdivide_u64_divisible_t libdivide_u64_divisible_gen(uint64_t d);
+LIBDIVIDE_API int libdivide_s32_is_divisible(int32_t numer, const struct libdivide_s32_divisible_t *denom);
+LIBDIVIDE_API int libdivide_u32_is_divisible(uint32_t numer, const struct libdivide_u32_divisible_t *denom);
+LIBDIVIDE_API int libdivide_s64_is_divisible(int64_t numer, const struct libdivide_s64_divisible_t *denom);
+LIBDIVIDE_API int libdivide_u64_is_divisible(uint64_t numer, const struct libdivide_u64_divisible_t *denom);
+
+/* Exact division.  libdivide_*_exact_do returns numer / d when numer is a multiple of d, and a meaningless value otherwise.  With LIBDIVIDE_ASSERTIONS_ON, the scalar and vector forms check every numerator and fail on one that isn't a multiple. */
+LIBDIVIDE_API struct libdivide_s32_exact_t libdivide_s32_exact_gen(int32_t d);
+LIBDIVIDE_API struct libdivide_u32_exact_t libdivide_u32_exact_gen(uint32_t d);
+LIBDIVIDE_API struct libdivide_s64_exact_t libdivide_s64_exact_gen(int64_t d);
+LIBDIVIDE_API struct libdivide_u64_exact_t libdivide_u64_exact_gen(uint64_t d);
+LIBDIVIDE_API int32_t  libdivide_s32_exact_do(int32_t numer, const struct libdivide_s32_exact_t *denom);
+LIBDIVIDE_API uint32_t libdivide_u32_exact_do(uint32_t numer, const struct libdivide_u32_exact_t *denom);
+LIBDIVIDE_API int64_t  libdivide_s64_exact_do(int64_t numer, const struct libdivide_s64_exact_t *denom);
+LIBDIVIDE_API uint64_t libdivide_u64_exact_do(uint64_t numer, const struct libdivide_u64_exact_t *denom);
+
+/* Floor division and Euclidean modulo for signed types.  libdivide_*_do_floor rounds the quotient toward negative infinity instead of toward zero, and libdivide_*_mod_euclid returns the remainder in [0, |d|) whatever the signs.  Both take the ordinary divisors from libdivide_s32_gen and libdivide_s64_gen. */
+LIBDIVIDE_API int32_t libdivide_s32_do_floor(int32_t numer, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API int64_t libdivide_s64_do_floor(int64_t numer, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API int32_t libdivide_s32_mod_euclid(int32_t numer, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API int64_t libdivide_s64_mod_euclid(int64_t numer, const struct libdivide_s64_t *denom);
+
+/* Ceiling and round-to-nearest division.  libdivide_*_do_ceil rounds the quotient toward positive infinity, and libdivide_*_do_round rounds it to the nearest integer, with halves going away from zero.  Both are exact over the whole range of numer, where the usual (numer + d - 1) / d overflows, and take the ordinary divisors from the gen functions. */
+LIBDIVIDE_API uint32_t libdivide_u32_do_ceil(uint32_t numer, const struct libdivide_u32_t *denom);
+LIBDIVIDE_API int32_t  libdivide_s32_do_ceil(int32_t numer, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API uint64_t libdivide_u64_do_ceil(uint64_t numer, const struct libdivide_u64_t *denom);
+LIBDIVIDE_API int64_t  libdivide_s64_do_ceil(int64_t numer, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API uint32_t libdivide_u32_do_round(uint32_t numer, const struct libdivide_u32_t *denom);
+LIBDIVIDE_API int32_t  libdivide_s32_do_round(int32_t numer, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API uint64_t libdivide_u64_do_round(uint64_t numer, const struct libdivide_u64_t *denom);
+LIBDIVIDE_API int64_t  libdivide_s64_do_round(int64_t numer, const struct libdivide_s64_t *denom);
+
+/* Branchfree division.  libdivide_*_branchfree_do returns numer / d like libdivide_*_do, but without branching on the divisor, so it pays when the divisor changes from call to call in a way the branch predictor can't follow.  It is a little slower than libdivide_*_do for a fixed divisor.  The unsigned gen functions don't take d == 1, which the fixed sequence can't express. */
+LIBDIVIDE_API struct libdivide_s32_branchfree_t libdivide_s32_branchfree_gen(int32_t d);
+LIBDIVIDE_API struct libdivide_u32_branchfree_t libdivide_u32_branchfree_gen(uint32_t d);
+LIBDIVIDE_API struct libdivide_s64_branchfree_t libdivide_s64_branchfree_gen(int64_t d);
+LIBDIVIDE_API struct libdivide_u64_branchfree_t libdivide_u64_branchfree_gen(uint64_t d);
+LIBDIVIDE_API int32_t  libdivide_s32_branchfree_do(int32_t numer, const struct libdivide_s32_branchfree_t *denom);
+LIBDIVIDE_API uint32_t libdivide_u32_branchfree_do(uint32_t numer, const struct libdivide_u32_branchfree_t *denom);
+LIBDIVIDE_API int64_t  libdivide_s64_branchfree_do(int64_t numer, const struct libdivide_s64_branchfree_t *denom);
+LIBDIVIDE_API uint64_t libdivide_u64_branchfree_do(uint64_t numer, const struct libdivide_u64_branchfree_t *denom);
+
 LIBDIVIDE_API int libdivide_u32_get_algorithm(const struct libdivide_u32_t *denom);
 LIBDIVIDE_API uint32_t libdivide_u32_do_alg0(uint32_t numer, const struct libdivide_u32_t *denom);
 LIBDIVIDE_API uint32_t libdivide_u32_do_alg1(uint32_t numer, const struct libdivide_u32_t *denom);
@@ -168,6 +605,11 @@ LIBDIVIDE_API int32_t libdivide_s32_do_alg1(int32_t numer, const struct libdivid
 LIBDIVIDE_API int32_t libdivide_s32_do_alg2(int32_t numer, const struct libdivide_s32_t *denom);
 LIBDIVIDE_API int32_t libdivide_s32_do_alg3(int32_t numer, const struct libdivide_s32_t *denom);
 LIBDIVIDE_API int32_t libdivide_s32_do_alg4(int32_t numer, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API int32_t libdivide_s32_do_floor_alg0(int32_t numer, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API int32_t libdivide_s32_do_floor_alg1(int32_t numer, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API int32_t libdivide_s32_do_floor_alg2(int32_t numer, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API int32_t libdivide_s32_do_floor_alg3(int32_t numer, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API int32_t libdivide_s32_do_floor_alg4(int32_t numer, const struct libdivide_s32_t *denom);
 
 LIBDIVIDE_API int libdivide_s64_get_algorithm(const struct libdivide_s64_t *denom);
 LIBDIVIDE_API int64_t libdivide_s64_do_alg0(int64_t numer, const struct libdivide_s64_t *denom);
@@ -175,19 +617,263 @@ LIBDIVIDE_API int64_t libdivide_s64_do_alg1(int64_t numer, const struct libdivid
 LIBDIVIDE_API int64_t libdivide_s64_do_alg2(int64_t numer, const struct libdivide_s64_t *denom);
 LIBDIVIDE_API int64_t libdivide_s64_do_alg3(int64_t numer, const struct libdivide_s64_t *denom);
 LIBDIVIDE_API int64_t libdivide_s64_do_alg4(int64_t numer, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API int64_t libdivide_s64_do_floor_alg0(int64_t numer, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API int64_t libdivide_s64_do_floor_alg1(int64_t numer, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API int64_t libdivide_s64_do_floor_alg2(int64_t numer, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API int64_t libdivide_s64_do_floor_alg3(int64_t numer, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API int64_t libdivide_s64_do_floor_alg4(int64_t numer, const struct libdivide_s64_t *denom);
+
+/* 16 bit division.  Only libdivide_*_do and its vector forms are provided at this width; the vector forms work on 8 lanes per 128 bit register, twice as many as u32. */
+LIBDIVIDE_API struct libdivide_s16_t libdivide_s16_gen(int16_t d);
+LIBDIVIDE_API struct libdivide_u16_t libdivide_u16_gen(uint16_t d);
+LIBDIVIDE_API int16_t  libdivide_s16_do(int16_t numer, const struct libdivide_s16_t *denom);
+LIBDIVIDE_API uint16_t libdivide_u16_do(uint16_t numer, const struct libdivide_u16_t *denom);
+
+LIBDIVIDE_API int libdivide_u16_get_algorithm(const struct libdivide_u16_t *denom);
+LIBDIVIDE_API uint16_t libdivide_u16_do_alg0(uint16_t numer, const struct libdivide_u16_t *denom);
+LIBDIVIDE_API uint16_t libdivide_u16_do_alg1(uint16_t numer, const struct libdivide_u16_t *denom);
+LIBDIVIDE_API uint16_t libdivide_u16_do_alg2(uint16_t numer, const struct libdivide_u16_t *denom);
+
+LIBDIVIDE_API int libdivide_s16_get_algorithm(const struct libdivide_s16_t *denom);
+LIBDIVIDE_API int16_t libdivide_s16_do_alg0(int16_t numer, const struct libdivide_s16_t *denom);
+LIBDIVIDE_API int16_t libdivide_s16_do_alg1(int16_t numer, const struct libdivide_s16_t *denom);
+LIBDIVIDE_API int16_t libdivide_s16_do_alg2(int16_t numer, const struct libdivide_s16_t *denom);
+LIBDIVIDE_API int16_t libdivide_s16_do_alg3(int16_t numer, const struct libdivide_s16_t *denom);
+LIBDIVIDE_API int16_t libdivide_s16_do_alg4(int16_t numer, const struct libdivide_s16_t *denom);
+
+/* 8 bit division, for byte and pixel data.  Like the 16 bit types, only libdivide_*_do, its vector forms and the array functions below are provided.  A 128 bit vector holds 16 bytes; on x86 they are divided as two halves of 16 bit lanes. */
+LIBDIVIDE_API struct libdivide_s8_t libdivide_s8_gen(int8_t d);
+LIBDIVIDE_API struct libdivide_u8_t libdivide_u8_gen(uint8_t d);
+LIBDIVIDE_API int8_t  libdivide_s8_do(int8_t numer, const struct libdivide_s8_t *denom);
+LIBDIVIDE_API uint8_t libdivide_u8_do(uint8_t numer, const struct libdivide_u8_t *denom);
+
+LIBDIVIDE_API int libdivide_u8_get_algorithm(const struct libdivide_u8_t *denom);
+LIBDIVIDE_API uint8_t libdivide_u8_do_alg0(uint8_t numer, const struct libdivide_u8_t *denom);
+LIBDIVIDE_API uint8_t libdivide_u8_do_alg1(uint8_t numer, const struct libdivide_u8_t *denom);
+LIBDIVIDE_API uint8_t libdivide_u8_do_alg2(uint8_t numer, const struct libdivide_u8_t *denom);
+
+LIBDIVIDE_API int libdivide_s8_get_algorithm(const struct libdivide_s8_t *denom);
+LIBDIVIDE_API int8_t libdivide_s8_do_alg0(int8_t numer, const struct libdivide_s8_t *denom);
+LIBDIVIDE_API int8_t libdivide_s8_do_alg1(int8_t numer, const struct libdivide_s8_t *denom);
+LIBDIVIDE_API int8_t libdivide_s8_do_alg2(int8_t numer, const struct libdivide_s8_t *denom);
+LIBDIVIDE_API int8_t libdivide_s8_do_alg3(int8_t numer, const struct libdivide_s8_t *denom);
+LIBDIVIDE_API int8_t libdivide_s8_do_alg4(int8_t numer, const struct libdivide_s8_t *denom);
+
+#if HAS_INT128_T
+/* 128 bit division, where the compiler would otherwise call __udivti3 or __divti3.  The magic number is 128 bits, so each division is a 128x128 multiply-high (four 64 bit multiplies) and a shift.  Only scalar division is provided at this width. */
+LIBDIVIDE_API struct libdivide_s128_t libdivide_s128_gen(__int128_t d);
+LIBDIVIDE_API struct libdivide_u128_t libdivide_u128_gen(__uint128_t d);
+LIBDIVIDE_API __int128_t  libdivide_s128_do(__int128_t numer, const struct libdivide_s128_t *denom);
+LIBDIVIDE_API __uint128_t libdivide_u128_do(__uint128_t numer, const struct libdivide_u128_t *denom);
+
+LIBDIVIDE_API int libdivide_u128_get_algorithm(const struct libdivide_u128_t *denom);
+LIBDIVIDE_API __uint128_t libdivide_u128_do_alg0(__uint128_t numer, const struct libdivide_u128_t *denom);
+LIBDIVIDE_API __uint128_t libdivide_u128_do_alg1(__uint128_t numer, const struct libdivide_u128_t *denom);
+LIBDIVIDE_API __uint128_t libdivide_u128_do_alg2(__uint128_t numer, const struct libdivide_u128_t *denom);
+
+LIBDIVIDE_API int libdivide_s128_get_algorithm(const struct libdivide_s128_t *denom);
+LIBDIVIDE_API __int128_t libdivide_s128_do_alg0(__int128_t numer, const struct libdivide_s128_t *denom);
+LIBDIVIDE_API __int128_t libdivide_s128_do_alg1(__int128_t numer, const struct libdivide_s128_t *denom);
+LIBDIVIDE_API __int128_t libdivide_s128_do_alg2(__int128_t numer, const struct libdivide_s128_t *denom);
+LIBDIVIDE_API __int128_t libdivide_s128_do_alg3(__int128_t numer, const struct libdivide_s128_t *denom);
+LIBDIVIDE_API __int128_t libdivide_s128_do_alg4(__int128_t numer, const struct libdivide_s128_t *denom);
+#endif
+
+/* Divides each of the n numerators in numers, storing the quotients in results.  The algorithm is selected once for the whole array, and the bulk of the work is done with the widest vector functions available.  Neither pointer needs to be aligned, and numers may be the same as results. */
+LIBDIVIDE_API void libdivide_u32_do_array(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom);
+LIBDIVIDE_API void libdivide_s32_do_array(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API void libdivide_u64_do_array(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom);
+LIBDIVIDE_API void libdivide_s64_do_array(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API void libdivide_u8_do_array(const uint8_t *numers, uint8_t *results, size_t n, const struct libdivide_u8_t *denom);
+LIBDIVIDE_API void libdivide_s8_do_array(const int8_t *numers, int8_t *results, size_t n, const struct libdivide_s8_t *denom);
+
+/* The same for libdivide_*_do_ceil and libdivide_*_do_round. */
+LIBDIVIDE_API void libdivide_u32_do_ceil_array(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom);
+LIBDIVIDE_API void libdivide_s32_do_ceil_array(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API void libdivide_u64_do_ceil_array(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom);
+LIBDIVIDE_API void libdivide_s64_do_ceil_array(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API void libdivide_u32_do_round_array(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom);
+LIBDIVIDE_API void libdivide_s32_do_round_array(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom);
+LIBDIVIDE_API void libdivide_u64_do_round_array(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom);
+LIBDIVIDE_API void libdivide_s64_do_round_array(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom);
+LIBDIVIDE_API void libdivide_u32_branchfree_do_array(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *denom);
+LIBDIVIDE_API void libdivide_s32_branchfree_do_array(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *denom);
+LIBDIVIDE_API void libdivide_u64_branchfree_do_array(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *denom);
+LIBDIVIDE_API void libdivide_s64_branchfree_do_array(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *denom);
+
+/* Divide numers[i] by the branchfree divider table[indices[i]], for a column of numerators against a column of divisors drawn from a small table, as with dictionary encoding. */
+LIBDIVIDE_API void libdivide_u32_branchfree_do_array_indexed(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *table);
+LIBDIVIDE_API void libdivide_s32_branchfree_do_array_indexed(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *table);
+LIBDIVIDE_API void libdivide_u64_branchfree_do_array_indexed(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *table);
+LIBDIVIDE_API void libdivide_s64_branchfree_do_array_indexed(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *table);
+
+#if LIBDIVIDE_HAS_THREADS
+/* libdivide_pool_init starts a pool of threads workers, or one per online CPU for 0, with flags 0 or LIBDIVIDE_POOL_NUMA.  It returns 0, or the error from pthread_create.  libdivide_*_do_array_parallel is libdivide_*_do_array split over the pool, for arrays too large for one core to keep up with the memory; arrays of one chunk or less are divided on the calling thread.  One thread at a time may use a pool.  They are only there when LIBDIVIDE_USE_THREADS is defined before libdivide.h is included. */
+LIBDIVIDE_API int libdivide_pool_init(struct libdivide_pool_t *pool, unsigned threads, unsigned flags);
+LIBDIVIDE_API void libdivide_pool_destroy(struct libdivide_pool_t *pool);
+LIBDIVIDE_API void libdivide_u32_do_array_parallel(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom, struct libdivide_pool_t *pool);
+LIBDIVIDE_API void libdivide_s32_do_array_parallel(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom, struct libdivide_pool_t *pool);
+LIBDIVIDE_API void libdivide_u64_do_array_parallel(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom, struct libdivide_pool_t *pool);
+LIBDIVIDE_API void libdivide_s64_do_array_parallel(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom, struct libdivide_pool_t *pool);
+#endif
+
+/* The divider arrays.  libdivide_*_array_gen makes the dividers for the n divisors in d, which may not be 0.  libdivide_*_array_do divides numer by the divider at index, and libdivide_*_array_do_indexed divides numers[i] by the divider at indices[i], as libdivide_*_branchfree_do_array_indexed does for a table of structs. */
+LIBDIVIDE_API void libdivide_u32_array_gen(const uint32_t *d, struct libdivide_u32_array_t *array, size_t n);
+LIBDIVIDE_API void libdivide_s32_array_gen(const int32_t *d, struct libdivide_s32_array_t *array, size_t n);
+LIBDIVIDE_API void libdivide_u64_array_gen(const uint64_t *d, struct libdivide_u64_array_t *array, size_t n);
+LIBDIVIDE_API void libdivide_s64_array_gen(const int64_t *d, struct libdivide_s64_array_t *array, size_t n);
+LIBDIVIDE_API uint32_t libdivide_u32_array_do(uint32_t numer, size_t index, const struct libdivide_u32_array_t *array);
+LIBDIVIDE_API int32_t libdivide_s32_array_do(int32_t numer, size_t index, const struct libdivide_s32_array_t *array);
+LIBDIVIDE_API uint64_t libdivide_u64_array_do(uint64_t numer, size_t index, const struct libdivide_u64_array_t *array);
+LIBDIVIDE_API int64_t libdivide_s64_array_do(int64_t numer, size_t index, const struct libdivide_s64_array_t *array);
+LIBDIVIDE_API void libdivide_u32_array_do_indexed(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_array_t *array);
+LIBDIVIDE_API void libdivide_s32_array_do_indexed(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_array_t *array);
+LIBDIVIDE_API void libdivide_u64_array_do_indexed(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_array_t *array);
+LIBDIVIDE_API void libdivide_s64_array_do_indexed(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_array_t *array);
+
+/* Generates the dividers for the n divisors in d, the same as libdivide_*_gen would one at a time, for rebuilding large tables of them.  At 32 bits several are done at once with the AVX2 or AVX-512 vectors, which replace the hardware divide with a double precision one and the branches with selects.  The _soa functions store the magic numbers and the more bytes in separate arrays instead of structs; the divisors are those in d.  As with libdivide_*_gen, no divisor may be 0. */
+LIBDIVIDE_API void libdivide_u32_gen_array(const uint32_t *d, struct libdivide_u32_t *out, size_t n);
+LIBDIVIDE_API void libdivide_s32_gen_array(const int32_t *d, struct libdivide_s32_t *out, size_t n);
+LIBDIVIDE_API void libdivide_u64_gen_array(const uint64_t *d, struct libdivide_u64_t *out, size_t n);
+LIBDIVIDE_API void libdivide_s64_gen_array(const int64_t *d, struct libdivide_s64_t *out, size_t n);
+LIBDIVIDE_API void libdivide_u32_gen_array_soa(const uint32_t *d, uint32_t *magics, uint8_t *mores, size_t n);
+LIBDIVIDE_API void libdivide_s32_gen_array_soa(const int32_t *d, int32_t *magics, uint8_t *mores, size_t n);
+LIBDIVIDE_API void libdivide_u64_gen_array_soa(const uint64_t *d, uint64_t *magics, uint8_t *mores, size_t n);
+LIBDIVIDE_API void libdivide_s64_gen_array_soa(const int64_t *d, int64_t *magics, uint8_t *mores, size_t n);
+
+#if LIBDIVIDE_HAS_ATOMICS
+/* For runtime divisors that come one at a time but keep repeating, like page sizes, shard counts or bucket widths.  libdivide_*_gen_cached returns the same as libdivide_*_gen(d), from the cache when d is there and adding it when it is not.  Any number of threads may share one cache.  libdivide_*_cache_stats reads how many lookups have hit and missed so far. */
+LIBDIVIDE_API struct libdivide_u64_t libdivide_u64_gen_cached(uint64_t d, struct libdivide_u64_cache_t *cache);
+LIBDIVIDE_API struct libdivide_s64_t libdivide_s64_gen_cached(int64_t d, struct libdivide_s64_cache_t *cache);
+LIBDIVIDE_API void libdivide_u64_cache_stats(const struct libdivide_u64_cache_t *cache, uint64_t *hits, uint64_t *misses);
+LIBDIVIDE_API void libdivide_s64_cache_stats(const struct libdivide_s64_cache_t *cache, uint64_t *hits, uint64_t *misses);
+#endif
+
+/* Return the same as libdivide_*_gen(d), but when LIBDIVIDE_USE_TABLE is set, the divisors 1 to LIBDIVIDE_TABLE_SIZE are read from a table made ahead of time, which costs one load instead of a division.  The table is libdivide_table.h, which libdivide_table_gen.c writes ("make table").  It only declares the tables, so exactly one source file of the program has to define LIBDIVIDE_TABLE_IMPLEMENTATION before including libdivide.h, to define them there.  Other divisors, or every divisor without the table, go to libdivide_*_gen. */
+LIBDIVIDE_API struct libdivide_u32_t libdivide_u32_get(uint32_t d);
+LIBDIVIDE_API struct libdivide_s32_t libdivide_s32_get(int32_t d);
+LIBDIVIDE_API struct libdivide_u64_t libdivide_u64_get(uint64_t d);
+
+/* Arrays of dividers can be saved with libdivide_*_serialize, and loaded again with libdivide_*_deserialize or used where they lie with libdivide_*_view, so that a program doesn't have to make them all again each time it starts.  The format is a 32 byte header:
+
+   bytes 0-7    "libdivid"
+   bytes 8-11   0x01020304 in the writer's byte order, which tells the reader whether to swap
+   bytes 12-13  LIBDIVIDE_SERIAL_VERSION
+   byte 14      the type, LIBDIVIDE_SERIAL_U32, _S32, _U64 or _S64
+   byte 15      the size of a divider, three times the size of the type
+   bytes 16-19  LIBDIVIDE_MORE_ENCODING
+   bytes 20-23  zero
+   bytes 24-31  the number of dividers
+
+followed by the dividers, each the magic number, the more byte, zeros up to the size of the type, and the divisor, which is how the libdivide_*_t structs are laid out.  Every number is in the writer's byte order. */
+#define LIBDIVIDE_SERIAL_VERSION 1
+#define LIBDIVIDE_SERIAL_HEADER_SIZE 32
+#define LIBDIVIDE_SERIAL_U32 1
+#define LIBDIVIDE_SERIAL_S32 2
+#define LIBDIVIDE_SERIAL_U64 3
+#define LIBDIVIDE_SERIAL_S64 4
+
+/* What the more bits mean.  Readers turn down dividers stamped with another encoding, whose more bytes they would misread.  It is made from the flags, so it changes when they do, and from LIBDIVIDE_MORE_REVISION, which has to go up when the flags keep their values but change their meaning. */
+#define LIBDIVIDE_MORE_REVISION 1
+#define LIBDIVIDE_MORE_ENCODING ((uint32_t)LIBDIVIDE_MORE_REVISION | (uint32_t)LIBDIVIDE_ADD_MARKER << 8 | (uint32_t)LIBDIVIDE_U32_SHIFT_PATH << 16 | (uint32_t)(LIBDIVIDE_S32_SHIFT_PATH | LIBDIVIDE_NEGATIVE_DIVISOR) << 24)
+
+/* The more bits, besides the shift, that a serialized divider of each type may have set */
+#define LIBDIVIDE_U32_FLAGS (LIBDIVIDE_ADD_MARKER | LIBDIVIDE_U32_SHIFT_PATH)
+#define LIBDIVIDE_S32_FLAGS (LIBDIVIDE_ADD_MARKER | LIBDIVIDE_S32_SHIFT_PATH | LIBDIVIDE_NEGATIVE_DIVISOR)
+#define LIBDIVIDE_U64_FLAGS (LIBDIVIDE_ADD_MARKER | LIBDIVIDE_U64_SHIFT_PATH)
+#define LIBDIVIDE_S64_FLAGS (LIBDIVIDE_ADD_MARKER | LIBDIVIDE_NEGATIVE_DIVISOR)
+
+/* Returned by libdivide_*_deserialize for a buffer that isn't an array of dividers of its type, or has another version or more encoding, or holds a divider that no libdivide_*_gen could have made: a shift too big for the type, an unknown more bit, or a divisor of 0 */
+#define LIBDIVIDE_SERIAL_INVALID ((size_t)-1)
+
+/* Writes the n dividers to buf and returns the number of bytes they take, LIBDIVIDE_SERIAL_HEADER_SIZE + 3 * n * the size of the type.  Nothing is written if size is less than that, so a call with a size of 0 finds how big buf needs to be. */
+LIBDIVIDE_API size_t libdivide_u32_serialize(const struct libdivide_u32_t *denoms, size_t n, void *buf, size_t size);
+LIBDIVIDE_API size_t libdivide_s32_serialize(const struct libdivide_s32_t *denoms, size_t n, void *buf, size_t size);
+LIBDIVIDE_API size_t libdivide_u64_serialize(const struct libdivide_u64_t *denoms, size_t n, void *buf, size_t size);
+LIBDIVIDE_API size_t libdivide_s64_serialize(const struct libdivide_s64_t *denoms, size_t n, void *buf, size_t size);
+
+/* Returns the number of dividers in the size bytes at buf, and copies the first n of them (or all, if there are fewer) to denoms, swapping their bytes if they were written with the other byte order.  Returns LIBDIVIDE_SERIAL_INVALID, and copies nothing, if buf doesn't hold dividers of the right type that this version of libdivide can read.  Every divider is checked before any is copied, so a corrupted buffer can't hand the division functions a bad shift or a divisor of 0. */
+LIBDIVIDE_API size_t libdivide_u32_deserialize(const void *buf, size_t size, struct libdivide_u32_t *denoms, size_t n);
+LIBDIVIDE_API size_t libdivide_s32_deserialize(const void *buf, size_t size, struct libdivide_s32_t *denoms, size_t n);
+LIBDIVIDE_API size_t libdivide_u64_deserialize(const void *buf, size_t size, struct libdivide_u64_t *denoms, size_t n);
+LIBDIVIDE_API size_t libdivide_s64_deserialize(const void *buf, size_t size, struct libdivide_s64_t *denoms, size_t n);
+
+/* Returns the dividers in buf where they are, without copying them, and their number in *n.  buf would usually be a file mapped with mmap.  Returns NULL where libdivide_*_deserialize would fail, and also where the dividers can't be used in place, because they were written with the other byte order or buf isn't aligned for the structs; libdivide_*_deserialize can still read those. */
+LIBDIVIDE_API const struct libdivide_u32_t *libdivide_u32_view(const void *buf, size_t size, size_t *n);
+LIBDIVIDE_API const struct libdivide_s32_t *libdivide_s32_view(const void *buf, size_t size, size_t *n);
+LIBDIVIDE_API const struct libdivide_u64_t *libdivide_u64_view(const void *buf, size_t size, size_t *n);
+LIBDIVIDE_API const struct libdivide_s64_t *libdivide_s64_view(const void *buf, size_t size, size_t *n);
+
+#if LIBDIVIDE_USE_DISPATCH
+enum {
+    LIBDIVIDE_ISA_SSE2 = 0,
+    LIBDIVIDE_ISA_AVX2 = 1,
+    LIBDIVIDE_ISA_AVX512 = 2
+};
+
+/* Returns the LIBDIVIDE_ISA_* tier the array functions run on.  The CPU is probed once, at startup or on first use, and the widest tier it supports is picked.  Setting the environment variable LIBDIVIDE_ISA to sse2, avx2 or avx512 caps the tier, e.g. to compare them on one machine; asking for more than the CPU has gets the best it does have. */
+LIBDIVIDE_API int libdivide_get_isa(void);
+#endif
 
 #if LIBDIVIDE_USE_SSE2
 #define LIBDIVIDE_VEC128 1
 
+typedef __m128i libdivide_16s8_t;
+typedef __m128i libdivide_8s16_t;
 typedef __m128i libdivide_4s32_t;
 typedef __m128i libdivide_2s64_t;
+typedef __m128i libdivide_16u8_t;
+typedef __m128i libdivide_8u16_t;
 typedef __m128i libdivide_4u32_t;
 typedef __m128i libdivide_2u64_t;
+
+#if LIBDIVIDE_USE_AVX2
+#define LIBDIVIDE_VEC256 1
+#endif
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+typedef __m256i libdivide_32s8_t;
+typedef __m256i libdivide_16s16_t;
+typedef __m256i libdivide_8s32_t;
+typedef __m256i libdivide_4s64_t;
+typedef __m256i libdivide_32u8_t;
+typedef __m256i libdivide_16u16_t;
+typedef __m256i libdivide_8u32_t;
+typedef __m256i libdivide_4u64_t;
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+#define LIBDIVIDE_VEC512 1
+#endif
+
+/* GCC before 13 makes the undefined source vector of the masked AVX-512 intrinsics (_mm512_srli_epi64, _mm512_mul_epu32 and so on) with _mm512_undefined_epi32, which initializes it from itself, and then warns that it is used uninitialized wherever one of them is inlined, which with dispatch is in the AVX-512 kernels it always builds.  The warning is about the intrinsic headers, not our code, so it is turned off from here to the end of the header. */
+#if (LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH) && defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 13
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+typedef __m512i libdivide_64s8_t;
+typedef __m512i libdivide_32s16_t;
+typedef __m512i libdivide_16s32_t;
+typedef __m512i libdivide_8s64_t;
+typedef __m512i libdivide_64u8_t;
+typedef __m512i libdivide_32u16_t;
+typedef __m512i libdivide_16u32_t;
+typedef __m512i libdivide_8u64_t;
+#endif
 #elif LIBDIVIDE_USE_NEON
 #define LIBDIVIDE_VEC64  1
 #define LIBDIVIDE_VEC128 1
 #define LIBDIVIDE_VEC256 1
 
+typedef int8x8_t    libdivide_8s8_t;
+typedef int8x16_t   libdivide_16s8_t;
+typedef int8x16x2_t libdivide_32s8_t;
+typedef int16x4_t   libdivide_4s16_t;
+typedef int16x8_t   libdivide_8s16_t;
+typedef int16x8x2_t libdivide_16s16_t;
 typedef int32x2_t   libdivide_2s32_t;
 typedef int32x4_t   libdivide_4s32_t;
 typedef int32x4x2_t libdivide_8s32_t;
@@ -195,6 +881,12 @@ typedef int64x1_t   libdivide_1s64_t;
 typedef int64x2_t   libdivide_2s64_t;
 typedef int64x2x2_t libdivide_4s64_t;
 
+typedef uint8x8_t    libdivide_8u8_t;
+typedef uint8x16_t   libdivide_16u8_t;
+typedef uint8x16x2_t libdivide_32u8_t;
+typedef uint16x4_t   libdivide_4u16_t;
+typedef uint16x8_t   libdivide_8u16_t;
+typedef uint16x8x2_t libdivide_16u16_t;
 typedef uint32x2_t   libdivide_2u32_t;
 typedef uint32x4_t   libdivide_4u32_t;
 typedef uint32x4x2_t libdivide_8u32_t;
@@ -206,17 +898,33 @@ typedef uint64x2x2_t libdivide_4u64_t;
 #define LIBDIVIDE_VEC128 1
 #define LIBDIVIDE_VEC256 1
 
+typedef   int8_t libdivide_8s8_t __attribute__((__vector_size__(8)));
+typedef   int8_t libdivide_16s8_t __attribute__((__vector_size__(16)));
+typedef   int8_t libdivide_32s8_t __attribute__((__vector_size__(32)));
+typedef  int16_t libdivide_4s16_t __attribute__((__vector_size__(8)));
+typedef  int16_t libdivide_8s16_t __attribute__((__vector_size__(16)));
+typedef  int16_t libdivide_16s16_t __attribute__((__vector_size__(32)));
+typedef  int16_t libdivide_32s16_t __attribute__((__vector_size__(64)));
 typedef  int32_t libdivide_2s32_t __attribute__((__vector_size__(8)));
 typedef  int32_t libdivide_4s32_t __attribute__((__vector_size__(16)));
 typedef  int32_t libdivide_8s32_t __attribute__((__vector_size__(32)));
+typedef  int32_t libdivide_16s32_t __attribute__((__vector_size__(64)));
 typedef  int64_t libdivide_1s64_t __attribute__((__vector_size__(8)));
 typedef  int64_t libdivide_2s64_t __attribute__((__vector_size__(16)));
 typedef  int64_t libdivide_4s64_t __attribute__((__vector_size__(32)));
 typedef  int64_t libdivide_8s64_t __attribute__((__vector_size__(64)));
 
+typedef  uint8_t libdivide_8u8_t __attribute__((__vector_size__(8)));
+typedef  uint8_t libdivide_16u8_t __attribute__((__vector_size__(16)));
+typedef  uint8_t libdivide_32u8_t __attribute__((__vector_size__(32)));
+typedef uint16_t libdivide_4u16_t __attribute__((__vector_size__(8)));
+typedef uint16_t libdivide_8u16_t __attribute__((__vector_size__(16)));
+typedef uint16_t libdivide_16u16_t __attribute__((__vector_size__(32)));
+typedef uint16_t libdivide_32u16_t __attribute__((__vector_size__(64)));
 typedef uint32_t libdivide_2u32_t __attribute__((__vector_size__(8)));
 typedef uint32_t libdivide_4u32_t __attribute__((__vector_size__(16)));
 typedef uint32_t libdivide_8u32_t __attribute__((__vector_size__(32)));
+typedef uint32_t libdivide_16u32_t __attribute__((__vector_size__(64)));
 typedef uint64_t libdivide_1u64_t __attribute__((__vector_size__(8)));
 typedef uint64_t libdivide_2u64_t __attribute__((__vector_size__(16)));
 typedef uint64_t libdivide_4u64_t __attribute__((__vector_size__(32)));
@@ -236,6 +944,32 @@ typedef __uint128_t libdivide_8u128_t __attribute__((__vector_size__(128)));
 #endif
 
 #if LIBDIVIDE_VEC64
+LIBDIVIDE_API libdivide_8s8_t libdivide_8s8_do_vector(libdivide_8s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API libdivide_8u8_t libdivide_8u8_do_vector(libdivide_8u8_t numers, const struct libdivide_u8_t * denom);
+
+LIBDIVIDE_API libdivide_8u8_t libdivide_8u8_do_vector_alg0(libdivide_8u8_t numers, const struct libdivide_u8_t * denom);
+LIBDIVIDE_API libdivide_8u8_t libdivide_8u8_do_vector_alg1(libdivide_8u8_t numers, const struct libdivide_u8_t * denom);
+LIBDIVIDE_API libdivide_8u8_t libdivide_8u8_do_vector_alg2(libdivide_8u8_t numers, const struct libdivide_u8_t * denom);
+
+LIBDIVIDE_API libdivide_8s8_t libdivide_8s8_do_vector_alg0(libdivide_8s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API libdivide_8s8_t libdivide_8s8_do_vector_alg1(libdivide_8s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API libdivide_8s8_t libdivide_8s8_do_vector_alg2(libdivide_8s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API libdivide_8s8_t libdivide_8s8_do_vector_alg3(libdivide_8s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API libdivide_8s8_t libdivide_8s8_do_vector_alg4(libdivide_8s8_t numers, const struct libdivide_s8_t * denom);
+
+LIBDIVIDE_API libdivide_4s16_t libdivide_4s16_do_vector(libdivide_4s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API libdivide_4u16_t libdivide_4u16_do_vector(libdivide_4u16_t numers, const struct libdivide_u16_t * denom);
+
+LIBDIVIDE_API libdivide_4u16_t libdivide_4u16_do_vector_alg0(libdivide_4u16_t numers, const struct libdivide_u16_t * denom);
+LIBDIVIDE_API libdivide_4u16_t libdivide_4u16_do_vector_alg1(libdivide_4u16_t numers, const struct libdivide_u16_t * denom);
+LIBDIVIDE_API libdivide_4u16_t libdivide_4u16_do_vector_alg2(libdivide_4u16_t numers, const struct libdivide_u16_t * denom);
+
+LIBDIVIDE_API libdivide_4s16_t libdivide_4s16_do_vector_alg0(libdivide_4s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API libdivide_4s16_t libdivide_4s16_do_vector_alg1(libdivide_4s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API libdivide_4s16_t libdivide_4s16_do_vector_alg2(libdivide_4s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API libdivide_4s16_t libdivide_4s16_do_vector_alg3(libdivide_4s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API libdivide_4s16_t libdivide_4s16_do_vector_alg4(libdivide_4s16_t numers, const struct libdivide_s16_t * denom);
+
 LIBDIVIDE_API libdivide_2s32_t libdivide_2s32_do_vector(libdivide_2s32_t numers, const struct libdivide_s32_t * denom);
 LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_do_vector(libdivide_1s64_t numers, const struct libdivide_s64_t * denom);
 LIBDIVIDE_API libdivide_2u32_t libdivide_2u32_do_vector(libdivide_2u32_t numers, const struct libdivide_u32_t * denom);
@@ -260,9 +994,64 @@ LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_do_vector_alg1(libdivide_1s64_t nu
 LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_do_vector_alg2(libdivide_1s64_t numers, const struct libdivide_s64_t * denom);
 LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_do_vector_alg3(libdivide_1s64_t numers, const struct libdivide_s64_t * denom);
 LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_do_vector_alg4(libdivide_1s64_t numers, const struct libdivide_s64_t * denom);
+
+LIBDIVIDE_API libdivide_2s32_t libdivide_2s32_mod_vector(libdivide_2s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_mod_vector(libdivide_1s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API libdivide_2u32_t libdivide_2u32_mod_vector(libdivide_2u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API libdivide_1u64_t libdivide_1u64_mod_vector(libdivide_1u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API libdivide_2s32_t libdivide_2s32_divmod_vector(libdivide_2s32_t numers, const struct libdivide_s32_t * denom, libdivide_2s32_t *remainders);
+LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_divmod_vector(libdivide_1s64_t numers, const struct libdivide_s64_t * denom, libdivide_1s64_t *remainders);
+LIBDIVIDE_API libdivide_2u32_t libdivide_2u32_divmod_vector(libdivide_2u32_t numers, const struct libdivide_u32_t * denom, libdivide_2u32_t *remainders);
+LIBDIVIDE_API libdivide_1u64_t libdivide_1u64_divmod_vector(libdivide_1u64_t numers, const struct libdivide_u64_t * denom, libdivide_1u64_t *remainders);
+LIBDIVIDE_API libdivide_2s32_t libdivide_2s32_is_divisible_vector(libdivide_2s32_t numers, const struct libdivide_s32_divisible_t * denom);
+LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_is_divisible_vector(libdivide_1s64_t numers, const struct libdivide_s64_divisible_t * denom);
+LIBDIVIDE_API libdivide_2u32_t libdivide_2u32_is_divisible_vector(libdivide_2u32_t numers, const struct libdivide_u32_divisible_t * denom);
+LIBDIVIDE_API libdivide_1u64_t libdivide_1u64_is_divisible_vector(libdivide_1u64_t numers, const struct libdivide_u64_divisible_t * denom);
+LIBDIVIDE_API libdivide_2s32_t libdivide_2s32_exact_do_vector(libdivide_2s32_t numers, const struct libdivide_s32_exact_t * denom);
+LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_exact_do_vector(libdivide_1s64_t numers, const struct libdivide_s64_exact_t * denom);
+LIBDIVIDE_API libdivide_2u32_t libdivide_2u32_exact_do_vector(libdivide_2u32_t numers, const struct libdivide_u32_exact_t * denom);
+LIBDIVIDE_API libdivide_1u64_t libdivide_1u64_exact_do_vector(libdivide_1u64_t numers, const struct libdivide_u64_exact_t * denom);
+LIBDIVIDE_API libdivide_2s32_t libdivide_2s32_do_floor_vector(libdivide_2s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_do_floor_vector(libdivide_1s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API libdivide_2s32_t libdivide_2s32_mod_euclid_vector(libdivide_2s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_mod_euclid_vector(libdivide_1s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API libdivide_2s32_t libdivide_2s32_do_ceil_vector(libdivide_2s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_do_ceil_vector(libdivide_1s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API libdivide_2u32_t libdivide_2u32_do_ceil_vector(libdivide_2u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API libdivide_1u64_t libdivide_1u64_do_ceil_vector(libdivide_1u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API libdivide_2s32_t libdivide_2s32_do_round_vector(libdivide_2s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API libdivide_1s64_t libdivide_1s64_do_round_vector(libdivide_1s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API libdivide_2u32_t libdivide_2u32_do_round_vector(libdivide_2u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API libdivide_1u64_t libdivide_1u64_do_round_vector(libdivide_1u64_t numers, const struct libdivide_u64_t * denom);
 #endif
 
 #if LIBDIVIDE_VEC128
+LIBDIVIDE_API libdivide_16s8_t libdivide_16s8_do_vector(libdivide_16s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API libdivide_16u8_t libdivide_16u8_do_vector(libdivide_16u8_t numers, const struct libdivide_u8_t * denom);
+
+LIBDIVIDE_API libdivide_16u8_t libdivide_16u8_do_vector_alg0(libdivide_16u8_t numers, const struct libdivide_u8_t * denom);
+LIBDIVIDE_API libdivide_16u8_t libdivide_16u8_do_vector_alg1(libdivide_16u8_t numers, const struct libdivide_u8_t * denom);
+LIBDIVIDE_API libdivide_16u8_t libdivide_16u8_do_vector_alg2(libdivide_16u8_t numers, const struct libdivide_u8_t * denom);
+
+LIBDIVIDE_API libdivide_16s8_t libdivide_16s8_do_vector_alg0(libdivide_16s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API libdivide_16s8_t libdivide_16s8_do_vector_alg1(libdivide_16s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API libdivide_16s8_t libdivide_16s8_do_vector_alg2(libdivide_16s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API libdivide_16s8_t libdivide_16s8_do_vector_alg3(libdivide_16s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API libdivide_16s8_t libdivide_16s8_do_vector_alg4(libdivide_16s8_t numers, const struct libdivide_s8_t * denom);
+
+LIBDIVIDE_API libdivide_8s16_t libdivide_8s16_do_vector(libdivide_8s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API libdivide_8u16_t libdivide_8u16_do_vector(libdivide_8u16_t numers, const struct libdivide_u16_t * denom);
+
+LIBDIVIDE_API libdivide_8u16_t libdivide_8u16_do_vector_alg0(libdivide_8u16_t numers, const struct libdivide_u16_t * denom);
+LIBDIVIDE_API libdivide_8u16_t libdivide_8u16_do_vector_alg1(libdivide_8u16_t numers, const struct libdivide_u16_t * denom);
+LIBDIVIDE_API libdivide_8u16_t libdivide_8u16_do_vector_alg2(libdivide_8u16_t numers, const struct libdivide_u16_t * denom);
+
+LIBDIVIDE_API libdivide_8s16_t libdivide_8s16_do_vector_alg0(libdivide_8s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API libdivide_8s16_t libdivide_8s16_do_vector_alg1(libdivide_8s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API libdivide_8s16_t libdivide_8s16_do_vector_alg2(libdivide_8s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API libdivide_8s16_t libdivide_8s16_do_vector_alg3(libdivide_8s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API libdivide_8s16_t libdivide_8s16_do_vector_alg4(libdivide_8s16_t numers, const struct libdivide_s16_t * denom);
+
 LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_do_vector(libdivide_4s32_t numers, const struct libdivide_s32_t * denom);
 LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_do_vector(libdivide_2s64_t numers, const struct libdivide_s64_t * denom);
 LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_do_vector(libdivide_4u32_t numers, const struct libdivide_u32_t * denom);
@@ -287,40 +1076,301 @@ LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_do_vector_alg1(libdivide_2s64_t nu
 LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_do_vector_alg2(libdivide_2s64_t numers, const struct libdivide_s64_t * denom);
 LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_do_vector_alg3(libdivide_2s64_t numers, const struct libdivide_s64_t * denom);
 LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_do_vector_alg4(libdivide_2s64_t numers, const struct libdivide_s64_t * denom);
+
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_mod_vector(libdivide_4s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_mod_vector(libdivide_2s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_mod_vector(libdivide_4u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_mod_vector(libdivide_2u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_divmod_vector(libdivide_4s32_t numers, const struct libdivide_s32_t * denom, libdivide_4s32_t *remainders);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_divmod_vector(libdivide_2s64_t numers, const struct libdivide_s64_t * denom, libdivide_2s64_t *remainders);
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_divmod_vector(libdivide_4u32_t numers, const struct libdivide_u32_t * denom, libdivide_4u32_t *remainders);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_divmod_vector(libdivide_2u64_t numers, const struct libdivide_u64_t * denom, libdivide_2u64_t *remainders);
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_is_divisible_vector(libdivide_4s32_t numers, const struct libdivide_s32_divisible_t * denom);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_is_divisible_vector(libdivide_2s64_t numers, const struct libdivide_s64_divisible_t * denom);
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_is_divisible_vector(libdivide_4u32_t numers, const struct libdivide_u32_divisible_t * denom);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_is_divisible_vector(libdivide_2u64_t numers, const struct libdivide_u64_divisible_t * denom);
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_exact_do_vector(libdivide_4s32_t numers, const struct libdivide_s32_exact_t * denom);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_exact_do_vector(libdivide_2s64_t numers, const struct libdivide_s64_exact_t * denom);
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_exact_do_vector(libdivide_4u32_t numers, const struct libdivide_u32_exact_t * denom);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_exact_do_vector(libdivide_2u64_t numers, const struct libdivide_u64_exact_t * denom);
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_do_floor_vector(libdivide_4s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_do_floor_vector(libdivide_2s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_mod_euclid_vector(libdivide_4s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_mod_euclid_vector(libdivide_2s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_do_ceil_vector(libdivide_4s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_do_ceil_vector(libdivide_2s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_do_ceil_vector(libdivide_4u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_do_ceil_vector(libdivide_2u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_do_round_vector(libdivide_4s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_do_round_vector(libdivide_2s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_do_round_vector(libdivide_4u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_do_round_vector(libdivide_2u64_t numers, const struct libdivide_u64_t * denom);
 #endif
 
-#if LIBDIVIDE_VEC256
-LIBDIVIDE_API libdivide_8s32_t libdivide_8s32_do_vector(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
-LIBDIVIDE_API libdivide_4s64_t libdivide_4s64_do_vector(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
-LIBDIVIDE_API libdivide_8u32_t libdivide_8u32_do_vector(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
-LIBDIVIDE_API libdivide_4u64_t libdivide_4u64_do_vector(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
+#if LIBDIVIDE_VEC256 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_32s8_t libdivide_32s8_do_vector(libdivide_32s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_32u8_t libdivide_32u8_do_vector(libdivide_32u8_t numers, const struct libdivide_u8_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_32u8_t libdivide_32u8_do_vector_alg0(libdivide_32u8_t numers, const struct libdivide_u8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_32u8_t libdivide_32u8_do_vector_alg1(libdivide_32u8_t numers, const struct libdivide_u8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_32u8_t libdivide_32u8_do_vector_alg2(libdivide_32u8_t numers, const struct libdivide_u8_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_32s8_t libdivide_32s8_do_vector_alg0(libdivide_32s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_32s8_t libdivide_32s8_do_vector_alg1(libdivide_32s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_32s8_t libdivide_32s8_do_vector_alg2(libdivide_32s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_32s8_t libdivide_32s8_do_vector_alg3(libdivide_32s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_32s8_t libdivide_32s8_do_vector_alg4(libdivide_32s8_t numers, const struct libdivide_s8_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_16s16_t libdivide_16s16_do_vector(libdivide_16s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_16u16_t libdivide_16u16_do_vector(libdivide_16u16_t numers, const struct libdivide_u16_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_16u16_t libdivide_16u16_do_vector_alg0(libdivide_16u16_t numers, const struct libdivide_u16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_16u16_t libdivide_16u16_do_vector_alg1(libdivide_16u16_t numers, const struct libdivide_u16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_16u16_t libdivide_16u16_do_vector_alg2(libdivide_16u16_t numers, const struct libdivide_u16_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_16s16_t libdivide_16s16_do_vector_alg0(libdivide_16s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_16s16_t libdivide_16s16_do_vector_alg1(libdivide_16s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_16s16_t libdivide_16s16_do_vector_alg2(libdivide_16s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_16s16_t libdivide_16s16_do_vector_alg3(libdivide_16s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_16s16_t libdivide_16s16_do_vector_alg4(libdivide_16s16_t numers, const struct libdivide_s16_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_do_vector(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_do_vector(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_do_vector(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_do_vector(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_do_vector_alg0(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_do_vector_alg1(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_do_vector_alg2(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_do_vector_alg0(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_do_vector_alg1(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_do_vector_alg2(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_do_vector_alg3(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_do_vector_alg4(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_do_vector_alg0(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_do_vector_alg1(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_do_vector_alg2(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_do_vector_alg0(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_do_vector_alg1(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_do_vector_alg2(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_do_vector_alg3(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_do_vector_alg4(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_mod_vector(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_mod_vector(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_mod_vector(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_mod_vector(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_divmod_vector(libdivide_8s32_t numers, const struct libdivide_s32_t * denom, libdivide_8s32_t *remainders);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_divmod_vector(libdivide_4s64_t numers, const struct libdivide_s64_t * denom, libdivide_4s64_t *remainders);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_divmod_vector(libdivide_8u32_t numers, const struct libdivide_u32_t * denom, libdivide_8u32_t *remainders);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_divmod_vector(libdivide_4u64_t numers, const struct libdivide_u64_t * denom, libdivide_4u64_t *remainders);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_is_divisible_vector(libdivide_8s32_t numers, const struct libdivide_s32_divisible_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_is_divisible_vector(libdivide_4s64_t numers, const struct libdivide_s64_divisible_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_is_divisible_vector(libdivide_8u32_t numers, const struct libdivide_u32_divisible_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_is_divisible_vector(libdivide_4u64_t numers, const struct libdivide_u64_divisible_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_exact_do_vector(libdivide_8s32_t numers, const struct libdivide_s32_exact_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_exact_do_vector(libdivide_4s64_t numers, const struct libdivide_s64_exact_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_exact_do_vector(libdivide_8u32_t numers, const struct libdivide_u32_exact_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_exact_do_vector(libdivide_4u64_t numers, const struct libdivide_u64_exact_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_do_floor_vector(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_do_floor_vector(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_mod_euclid_vector(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_mod_euclid_vector(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_do_ceil_vector(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_do_ceil_vector(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_do_ceil_vector(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_do_ceil_vector(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_do_round_vector(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_do_round_vector(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_do_round_vector(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_do_round_vector(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
+#endif
+
+#if LIBDIVIDE_VEC512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_64s8_t libdivide_64s8_do_vector(libdivide_64s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_64u8_t libdivide_64u8_do_vector(libdivide_64u8_t numers, const struct libdivide_u8_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_64u8_t libdivide_64u8_do_vector_alg0(libdivide_64u8_t numers, const struct libdivide_u8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_64u8_t libdivide_64u8_do_vector_alg1(libdivide_64u8_t numers, const struct libdivide_u8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_64u8_t libdivide_64u8_do_vector_alg2(libdivide_64u8_t numers, const struct libdivide_u8_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_64s8_t libdivide_64s8_do_vector_alg0(libdivide_64s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_64s8_t libdivide_64s8_do_vector_alg1(libdivide_64s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_64s8_t libdivide_64s8_do_vector_alg2(libdivide_64s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_64s8_t libdivide_64s8_do_vector_alg3(libdivide_64s8_t numers, const struct libdivide_s8_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_64s8_t libdivide_64s8_do_vector_alg4(libdivide_64s8_t numers, const struct libdivide_s8_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_32s16_t libdivide_32s16_do_vector(libdivide_32s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_32u16_t libdivide_32u16_do_vector(libdivide_32u16_t numers, const struct libdivide_u16_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_32u16_t libdivide_32u16_do_vector_alg0(libdivide_32u16_t numers, const struct libdivide_u16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_32u16_t libdivide_32u16_do_vector_alg1(libdivide_32u16_t numers, const struct libdivide_u16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_32u16_t libdivide_32u16_do_vector_alg2(libdivide_32u16_t numers, const struct libdivide_u16_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_32s16_t libdivide_32s16_do_vector_alg0(libdivide_32s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_32s16_t libdivide_32s16_do_vector_alg1(libdivide_32s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_32s16_t libdivide_32s16_do_vector_alg2(libdivide_32s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_32s16_t libdivide_32s16_do_vector_alg3(libdivide_32s16_t numers, const struct libdivide_s16_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_32s16_t libdivide_32s16_do_vector_alg4(libdivide_32s16_t numers, const struct libdivide_s16_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_do_vector(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_do_vector(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_do_vector(libdivide_16u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_do_vector(libdivide_8u64_t numers, const struct libdivide_u64_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_do_vector_alg0(libdivide_16u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_do_vector_alg1(libdivide_16u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_do_vector_alg2(libdivide_16u32_t numers, const struct libdivide_u32_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_do_vector_alg0(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_do_vector_alg1(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_do_vector_alg2(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_do_vector_alg3(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_do_vector_alg4(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_do_vector_alg0(libdivide_8u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_do_vector_alg1(libdivide_8u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_do_vector_alg2(libdivide_8u64_t numers, const struct libdivide_u64_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_do_vector_alg0(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_do_vector_alg1(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_do_vector_alg2(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_do_vector_alg3(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_do_vector_alg4(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_mod_vector(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_mod_vector(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_mod_vector(libdivide_16u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_mod_vector(libdivide_8u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_divmod_vector(libdivide_16s32_t numers, const struct libdivide_s32_t * denom, libdivide_16s32_t *remainders);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_divmod_vector(libdivide_8s64_t numers, const struct libdivide_s64_t * denom, libdivide_8s64_t *remainders);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_divmod_vector(libdivide_16u32_t numers, const struct libdivide_u32_t * denom, libdivide_16u32_t *remainders);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_divmod_vector(libdivide_8u64_t numers, const struct libdivide_u64_t * denom, libdivide_8u64_t *remainders);
+/* The AVX-512 divisibility tests return a mask register, one bit per lane */
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 __mmask16 libdivide_16s32_is_divisible_vector(libdivide_16s32_t numers, const struct libdivide_s32_divisible_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 __mmask8 libdivide_8s64_is_divisible_vector(libdivide_8s64_t numers, const struct libdivide_s64_divisible_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 __mmask16 libdivide_16u32_is_divisible_vector(libdivide_16u32_t numers, const struct libdivide_u32_divisible_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 __mmask8 libdivide_8u64_is_divisible_vector(libdivide_8u64_t numers, const struct libdivide_u64_divisible_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_exact_do_vector(libdivide_16s32_t numers, const struct libdivide_s32_exact_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_exact_do_vector(libdivide_8s64_t numers, const struct libdivide_s64_exact_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_exact_do_vector(libdivide_16u32_t numers, const struct libdivide_u32_exact_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_exact_do_vector(libdivide_8u64_t numers, const struct libdivide_u64_exact_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_do_floor_vector(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_do_floor_vector(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_mod_euclid_vector(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_mod_euclid_vector(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_do_ceil_vector(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_do_ceil_vector(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_do_ceil_vector(libdivide_16u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_do_ceil_vector(libdivide_8u64_t numers, const struct libdivide_u64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_do_round_vector(libdivide_16s32_t numers, const struct libdivide_s32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_do_round_vector(libdivide_8s64_t numers, const struct libdivide_s64_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_do_round_vector(libdivide_16u32_t numers, const struct libdivide_u32_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_do_round_vector(libdivide_8u64_t numers, const struct libdivide_u64_t * denom);
+#endif
 
-LIBDIVIDE_API libdivide_8u32_t libdivide_8u32_do_vector_alg0(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
-LIBDIVIDE_API libdivide_8u32_t libdivide_8u32_do_vector_alg1(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
-LIBDIVIDE_API libdivide_8u32_t libdivide_8u32_do_vector_alg2(libdivide_8u32_t numers, const struct libdivide_u32_t * denom);
+#if LIBDIVIDE_USE_SSE2
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_fastmod_vector(libdivide_4u32_t numers, const struct libdivide_u32_fastmod_t * denom);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_fastmod_vector(libdivide_2u64_t numers, const struct libdivide_u64_fastmod_t * denom);
+#endif
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_fastmod_vector(libdivide_8u32_t numers, const struct libdivide_u32_fastmod_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_fastmod_vector(libdivide_4u64_t numers, const struct libdivide_u64_fastmod_t * denom);
+#endif
 
-LIBDIVIDE_API libdivide_8s32_t libdivide_8s32_do_vector_alg0(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
-LIBDIVIDE_API libdivide_8s32_t libdivide_8s32_do_vector_alg1(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
-LIBDIVIDE_API libdivide_8s32_t libdivide_8s32_do_vector_alg2(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
-LIBDIVIDE_API libdivide_8s32_t libdivide_8s32_do_vector_alg3(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
-LIBDIVIDE_API libdivide_8s32_t libdivide_8s32_do_vector_alg4(libdivide_8s32_t numers, const struct libdivide_s32_t * denom);
+/* The narrowing division has 256 and 512 bit x86 vectors only.  Two lanes of 64 bit multiplies built from 32 bit ones are slower than the scalar multiply, so there is no 128 bit form, and the array function stays scalar without AVX2. */
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_narrow_do_vector(libdivide_4u64_t numers_hi, libdivide_4u64_t numers_lo, const struct libdivide_u64_narrow_t * denom, libdivide_4u64_t *remainders);
+#endif
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_narrow_do_vector(libdivide_8u64_t numers_hi, libdivide_8u64_t numers_lo, const struct libdivide_u64_narrow_t * denom, libdivide_8u64_t *remainders);
+#endif
 
-LIBDIVIDE_API libdivide_4u64_t libdivide_4u64_do_vector_alg0(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
-LIBDIVIDE_API libdivide_4u64_t libdivide_4u64_do_vector_alg1(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
-LIBDIVIDE_API libdivide_4u64_t libdivide_4u64_do_vector_alg2(libdivide_4u64_t numers, const struct libdivide_u64_t * denom);
+/* The branchfree dividers have x86 vectors only.  Elsewhere the array functions run the scalar code. */
+#if LIBDIVIDE_USE_SSE2
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_branchfree_do_vector(libdivide_4s32_t numers, const struct libdivide_s32_branchfree_t * denom);
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_branchfree_do_vector(libdivide_4u32_t numers, const struct libdivide_u32_branchfree_t * denom);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_branchfree_do_vector(libdivide_2s64_t numers, const struct libdivide_s64_branchfree_t * denom);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_branchfree_do_vector(libdivide_2u64_t numers, const struct libdivide_u64_branchfree_t * denom);
+#endif
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_branchfree_do_vector(libdivide_8s32_t numers, const struct libdivide_s32_branchfree_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_branchfree_do_vector(libdivide_8u32_t numers, const struct libdivide_u32_branchfree_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_branchfree_do_vector(libdivide_4s64_t numers, const struct libdivide_s64_branchfree_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_branchfree_do_vector(libdivide_4u64_t numers, const struct libdivide_u64_branchfree_t * denom);
+#endif
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_branchfree_do_vector(libdivide_16s32_t numers, const struct libdivide_s32_branchfree_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_branchfree_do_vector(libdivide_16u32_t numers, const struct libdivide_u32_branchfree_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_branchfree_do_vector(libdivide_8s64_t numers, const struct libdivide_s64_branchfree_t * denom);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_branchfree_do_vector(libdivide_8u64_t numers, const struct libdivide_u64_branchfree_t * denom);
+#endif
 
-LIBDIVIDE_API libdivide_4s64_t libdivide_4s64_do_vector_alg0(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
-LIBDIVIDE_API libdivide_4s64_t libdivide_4s64_do_vector_alg1(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
-LIBDIVIDE_API libdivide_4s64_t libdivide_4s64_do_vector_alg2(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
-LIBDIVIDE_API libdivide_4s64_t libdivide_4s64_do_vector_alg3(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
-LIBDIVIDE_API libdivide_4s64_t libdivide_4s64_do_vector_alg4(libdivide_4s64_t numers, const struct libdivide_s64_t * denom);
+/* Per lane division, with a different branchfree divider in every lane.  The _lanes functions take the magic numbers and the more bytes as vectors, one of each per lane, with the more bytes zero extended.  The _gather functions load them from table by 32 bit index, and the _array_do_gather functions from a divider array; the 64 bit ones take their indices in a vector half as wide as the numerators.  Indices must be less than 2**31. */
+#if LIBDIVIDE_USE_SSE2
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_branchfree_do_lanes(libdivide_4s32_t numers, libdivide_4s32_t magics, libdivide_4s32_t mores);
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_branchfree_do_lanes(libdivide_4u32_t numers, libdivide_4u32_t magics, libdivide_4u32_t mores);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_branchfree_do_lanes(libdivide_2s64_t numers, libdivide_2s64_t magics, libdivide_2s64_t mores);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_branchfree_do_lanes(libdivide_2u64_t numers, libdivide_2u64_t magics, libdivide_2u64_t mores);
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_branchfree_do_gather(libdivide_4s32_t numers, libdivide_4u32_t indices, const struct libdivide_s32_branchfree_t * table);
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_branchfree_do_gather(libdivide_4u32_t numers, libdivide_4u32_t indices, const struct libdivide_u32_branchfree_t * table);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_branchfree_do_gather(libdivide_2s64_t numers, libdivide_4u32_t indices, const struct libdivide_s64_branchfree_t * table);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_branchfree_do_gather(libdivide_2u64_t numers, libdivide_4u32_t indices, const struct libdivide_u64_branchfree_t * table);
+LIBDIVIDE_API libdivide_4s32_t libdivide_4s32_array_do_gather(libdivide_4s32_t numers, libdivide_4u32_t indices, const struct libdivide_s32_array_t * array);
+LIBDIVIDE_API libdivide_4u32_t libdivide_4u32_array_do_gather(libdivide_4u32_t numers, libdivide_4u32_t indices, const struct libdivide_u32_array_t * array);
+LIBDIVIDE_API libdivide_2s64_t libdivide_2s64_array_do_gather(libdivide_2s64_t numers, libdivide_4u32_t indices, const struct libdivide_s64_array_t * array);
+LIBDIVIDE_API libdivide_2u64_t libdivide_2u64_array_do_gather(libdivide_2u64_t numers, libdivide_4u32_t indices, const struct libdivide_u64_array_t * array);
+#endif
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_branchfree_do_lanes(libdivide_8s32_t numers, libdivide_8s32_t magics, libdivide_8s32_t mores);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_branchfree_do_lanes(libdivide_8u32_t numers, libdivide_8u32_t magics, libdivide_8u32_t mores);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_branchfree_do_lanes(libdivide_4s64_t numers, libdivide_4s64_t magics, libdivide_4s64_t mores);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_branchfree_do_lanes(libdivide_4u64_t numers, libdivide_4u64_t magics, libdivide_4u64_t mores);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_branchfree_do_gather(libdivide_8s32_t numers, libdivide_8u32_t indices, const struct libdivide_s32_branchfree_t * table);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_branchfree_do_gather(libdivide_8u32_t numers, libdivide_8u32_t indices, const struct libdivide_u32_branchfree_t * table);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_branchfree_do_gather(libdivide_4s64_t numers, libdivide_4u32_t indices, const struct libdivide_s64_branchfree_t * table);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_branchfree_do_gather(libdivide_4u64_t numers, libdivide_4u32_t indices, const struct libdivide_u64_branchfree_t * table);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8s32_t libdivide_8s32_array_do_gather(libdivide_8s32_t numers, libdivide_8u32_t indices, const struct libdivide_s32_array_t * array);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_array_do_gather(libdivide_8u32_t numers, libdivide_8u32_t indices, const struct libdivide_u32_array_t * array);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4s64_t libdivide_4s64_array_do_gather(libdivide_4s64_t numers, libdivide_4u32_t indices, const struct libdivide_s64_array_t * array);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_array_do_gather(libdivide_4u64_t numers, libdivide_4u32_t indices, const struct libdivide_u64_array_t * array);
+#endif
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_branchfree_do_lanes(libdivide_16s32_t numers, libdivide_16s32_t magics, libdivide_16s32_t mores);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_branchfree_do_lanes(libdivide_16u32_t numers, libdivide_16u32_t magics, libdivide_16u32_t mores);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_branchfree_do_lanes(libdivide_8s64_t numers, libdivide_8s64_t magics, libdivide_8s64_t mores);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_branchfree_do_lanes(libdivide_8u64_t numers, libdivide_8u64_t magics, libdivide_8u64_t mores);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_branchfree_do_gather(libdivide_16s32_t numers, libdivide_16u32_t indices, const struct libdivide_s32_branchfree_t * table);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_branchfree_do_gather(libdivide_16u32_t numers, libdivide_16u32_t indices, const struct libdivide_u32_branchfree_t * table);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_branchfree_do_gather(libdivide_8s64_t numers, libdivide_8u32_t indices, const struct libdivide_s64_branchfree_t * table);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_branchfree_do_gather(libdivide_8u64_t numers, libdivide_8u32_t indices, const struct libdivide_u64_branchfree_t * table);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16s32_t libdivide_16s32_array_do_gather(libdivide_16s32_t numers, libdivide_16u32_t indices, const struct libdivide_s32_array_t * array);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_16u32_t libdivide_16u32_array_do_gather(libdivide_16u32_t numers, libdivide_16u32_t indices, const struct libdivide_u32_array_t * array);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8s64_t libdivide_8s64_array_do_gather(libdivide_8s64_t numers, libdivide_8u32_t indices, const struct libdivide_s64_array_t * array);
+LIBDIVIDE_API LIBDIVIDE_TARGET_AVX512 libdivide_8u64_t libdivide_8u64_array_do_gather(libdivide_8u64_t numers, libdivide_8u32_t indices, const struct libdivide_u64_array_t * array);
 #endif
 
+#define libdivide_s8_do_vector libdivide_16s8_do_vector
+#define libdivide_u8_do_vector libdivide_16u8_do_vector
+#define libdivide_s16_do_vector libdivide_8s16_do_vector
+#define libdivide_u16_do_vector libdivide_8u16_do_vector
 #define libdivide_s32_do_vector libdivide_4s32_do_vector
 #define libdivide_s64_do_vector libdivide_2s64_do_vector
 #define libdivide_u32_do_vector libdivide_4u32_do_vector
 #define libdivide_u64_do_vector libdivide_2u64_do_vector
 
+#define libdivide_s32_mod_vector libdivide_4s32_mod_vector
+#define libdivide_s64_mod_vector libdivide_2s64_mod_vector
+#define libdivide_u32_mod_vector libdivide_4u32_mod_vector
+#define libdivide_u64_mod_vector libdivide_2u64_mod_vector
+#define libdivide_s32_divmod_vector libdivide_4s32_divmod_vector
+#define libdivide_s64_divmod_vector libdivide_2s64_divmod_vector
+#define libdivide_u32_divmod_vector libdivide_4u32_divmod_vector
+#define libdivide_u64_divmod_vector libdivide_2u64_divmod_vector
+
 #define libdivide_s32_do_vector_alg0 libdivide_4s32_do_vector_alg0
 #define libdivide_s32_do_vector_alg1 libdivide_4s32_do_vector_alg1
 #define libdivide_s32_do_vector_alg2 libdivide_4s32_do_vector_alg2
@@ -339,8 +1389,50 @@ LIBDIVIDE_API libdivide_4s64_t libdivide_4s64_do_vector_alg4(libdivide_4s64_t nu
 #define libdivide_u64_do_vector_alg1 libdivide_2u64_do_vector_alg1
 #define libdivide_u64_do_vector_alg2 libdivide_2u64_do_vector_alg2
 
+#define libdivide_s16_do_vector_alg0 libdivide_8s16_do_vector_alg0
+#define libdivide_s16_do_vector_alg1 libdivide_8s16_do_vector_alg1
+#define libdivide_s16_do_vector_alg2 libdivide_8s16_do_vector_alg2
+#define libdivide_s16_do_vector_alg3 libdivide_8s16_do_vector_alg3
+#define libdivide_s16_do_vector_alg4 libdivide_8s16_do_vector_alg4
+#define libdivide_u16_do_vector_alg0 libdivide_8u16_do_vector_alg0
+#define libdivide_u16_do_vector_alg1 libdivide_8u16_do_vector_alg1
+#define libdivide_u16_do_vector_alg2 libdivide_8u16_do_vector_alg2
+
+#define libdivide_s8_do_vector_alg0 libdivide_16s8_do_vector_alg0
+#define libdivide_s8_do_vector_alg1 libdivide_16s8_do_vector_alg1
+#define libdivide_s8_do_vector_alg2 libdivide_16s8_do_vector_alg2
+#define libdivide_s8_do_vector_alg3 libdivide_16s8_do_vector_alg3
+#define libdivide_s8_do_vector_alg4 libdivide_16s8_do_vector_alg4
+#define libdivide_u8_do_vector_alg0 libdivide_16u8_do_vector_alg0
+#define libdivide_u8_do_vector_alg1 libdivide_16u8_do_vector_alg1
+#define libdivide_u8_do_vector_alg2 libdivide_16u8_do_vector_alg2
+
 //////// Internal Utility Functions
 
+static inline uint8_t libdivide__mullhi_u8(uint8_t x, uint8_t y) {
+    uint32_t xl = x, yl = y;
+    uint32_t rl = xl * yl;
+    return (uint8_t)(rl >> 8);
+}
+
+static inline int8_t libdivide__mullhi_s8(int8_t x, int8_t y) {
+    int32_t xl = x, yl = y;
+    int32_t rl = xl * yl;
+    return (int8_t)(rl >> 8); //needs to be arithmetic shift
+}
+
+static inline uint16_t libdivide__mullhi_u16(uint16_t x, uint16_t y) {
+    uint32_t xl = x, yl = y;
+    uint32_t rl = xl * yl;
+    return (uint16_t)(rl >> 16);
+}
+
+static inline int16_t libdivide__mullhi_s16(int16_t x, int16_t y) {
+    int32_t xl = x, yl = y;
+    int32_t rl = xl * yl;
+    return (int16_t)(rl >> 16); //needs to be arithmetic shift
+}
+
 static inline uint32_t libdivide__mullhi_u32(uint32_t x, uint32_t y) {
     uint64_t xl = x, yl = y;
     uint64_t rl = xl * yl;
@@ -391,6 +1483,30 @@ static inline int64_t libdivide__mullhi_s64(int64_t x, int64_t y) {
 #endif
 }
 
+#if HAS_INT128_T
+static inline __uint128_t libdivide__mullhi_u128(__uint128_t x, __uint128_t y) {
+    //full 256 bits are x0 * y0 + (x0 * y1 << 64) + (x1 * y0 << 64) + (x1 * y1 << 128)
+    const uint64_t x0 = (uint64_t)x, x1 = (uint64_t)(x >> 64);
+    const uint64_t y0 = (uint64_t)y, y1 = (uint64_t)(y >> 64);
+    const __uint128_t x0y0 = (__uint128_t)x0 * y0;
+    const __uint128_t x0y1 = (__uint128_t)x0 * y1;
+    const __uint128_t x1y0 = (__uint128_t)x1 * y0;
+    const __uint128_t x1y1 = (__uint128_t)x1 * y1;
+
+    //the three 64 bit terms in the middle can't overflow 128 bits
+    const __uint128_t mid = (x0y0 >> 64) + (uint64_t)x0y1 + (uint64_t)x1y0;
+    return x1y1 + (x0y1 >> 64) + (x1y0 >> 64) + (mid >> 64);
+}
+
+static inline __int128_t libdivide__mullhi_s128(__int128_t x, __int128_t y) {
+    //the signed high half is the unsigned one, less y if x is negative and less x if y is negative
+    __uint128_t hi = libdivide__mullhi_u128((__uint128_t)x, (__uint128_t)y);
+    hi -= (__uint128_t)(x >> 127) & (__uint128_t)y;
+    hi -= (__uint128_t)(y >> 127) & (__uint128_t)x;
+    return (__int128_t)hi;
+}
+#endif
+
 #if LIBDIVIDE_USE_SSE2
 
 static inline __m128i libdivide__u64_to_m128(uint64_t x) {
@@ -432,10 +1548,14 @@ static inline __m128i libdivide_get_0000FFFF(void) {
 }
 
 static inline __m128i libdivide_s64_signbits(__m128i v) {
+#if LIBDIVIDE_USE_AVX512
+    return _mm_srai_epi64(v, 63);
+#else
     //we want to compute v >> 63, that is, _mm_srai_epi64(v, 63).  But there is no 64 bit shift right arithmetic instruction in SSE2.  So we have to fake it by first duplicating the high 32 bit values, and then using a 32 bit shift.  Another option would be to use _mm_srli_epi64(v, 63) and then subtract that from 0, but that approach appears to be substantially slower for unknown reasons
     __m128i hiBitsDuped = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 1, 1));
     __m128i signBits = _mm_srai_epi32(hiBitsDuped, 31);
     return signBits;
+#endif
 }
 
 /* Returns an __m128i whose low 32 bits are equal to amt and has zero elsewhere. */
@@ -444,12 +1564,16 @@ static inline __m128i libdivide_u32_to_m128i(uint32_t amt) {
 }
 
 static inline __m128i libdivide_s64_shift_right_vector(__m128i v, int amt) {
+#if LIBDIVIDE_USE_AVX512
+    return _mm_sra_epi64(v, libdivide_u32_to_m128i(amt));
+#else
     //implementation of _mm_sra_epi64.  Here we have two 64 bit values which are shifted right to logically become (64 - amt) values, and are then sign extended from a (64 - amt) bit number.
     const int b = 64 - amt;
     __m128i m = libdivide__u64_to_m128(1ULL << (b - 1));
     __m128i x = _mm_srl_epi64(v, libdivide_u32_to_m128i(amt));
     __m128i result = _mm_sub_epi64(_mm_xor_si128(x, m), m); //result = x^m - m
     return result;
+#endif
 }
 
 /* Here, b is assumed to contain one 32 bit value repeated four times.  If it did not, the function would not work. */
@@ -490,6 +1614,28 @@ static inline __m128i libdivide_mullhi_s64_flat_vector(__m128i x, __m128i y) {
     return p;
 }
 
+/* The low halves of the products, for the remainders.  The low half is the same whether the values are signed or unsigned, so these serve both.  b is one 32 bit value repeated four times. */
+static inline __m128i libdivide_mullo_u32_flat_vector(__m128i a, __m128i b) {
+#ifdef LIBDIVIDE_USE_SSE4_1
+    return _mm_mullo_epi32(a, b);
+#else
+    __m128i lo_product_0Z2Z = _mm_mul_epu32(a, b);
+    __m128i lo_product_1Z3Z = _mm_mul_epu32(_mm_srli_epi64(a, 32), b);
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(lo_product_0Z2Z, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(lo_product_1Z3Z, _MM_SHUFFLE(0, 0, 2, 0))); // = lo_product_0123
+#endif
+}
+
+/* y is one 64 bit value repeated twice */
+static inline __m128i libdivide_mullo_u64_flat_vector(__m128i x, __m128i y) {
+#if LIBDIVIDE_USE_AVX512
+    return _mm_mullo_epi64(x, y);
+#else
+    //the low 64 bits of x * y are x0 * y0 + ((x1 * y0 + x0 * y1) << 32); x1 * y1 is all shifted out
+    __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(x, 32), y), _mm_mul_epu32(x, _mm_srli_epi64(y, 32)));
+    return _mm_add_epi64(_mm_mul_epu32(x, y), _mm_slli_epi64(cross, 32));
+#endif
+}
+
 #ifdef LIBDIVIDE_USE_SSE4_1
 
 /* b is one 32 bit value repeated four times. */
@@ -512,63 +1658,277 @@ static inline __m128i libdivide_mullhi_s32_flat_vector(__m128i a, __m128i b) {
     return p;
 }
 #endif
-#elif LIBDIVIDE_USE_NEON
-static inline int32x2_t libdivide_mullhi_2s32_flat_vector(int32x2_t x, int32x2_t y) {
-    int64x2_t r64 = vmull_s32( x, y );
-    r64 = vreinterpretq_s64_u64( vshrq_n_u64( vreinterpretq_u64_s64(r64), 32 ) );
-    int32x2_t r = vmovn_s64( r64 );
-    return r;
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide__u64_to_m256i(uint64_t x) {
+    return _mm256_set1_epi64x((int64_t)x);
 }
 
-static inline int32x4_t libdivide_mullhi_4s32_flat_vector(int32x4_t x, int32x4_t y) {
-    int64x2_t rlo = vmull_s32( vget_low_s32(x), vget_low_s32(y) );
-    int64x2_t rhi = vmull_s32( vget_high_s32(x), vget_high_s32(y) );
-    rlo = vreinterpretq_s64_u64( vshrq_n_u64( vreinterpretq_u64_s64(rlo), 32 ) );
-    rhi = vreinterpretq_s64_u64( vshrq_n_u64( vreinterpretq_u64_s64(rhi), 32 ) );
-    int32x4_t r = vcombine_s32( vmovn_s64( rlo ), vmovn_s64( rhi ) );
-    return r;
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_signbits(__m256i v) {
+#if LIBDIVIDE_USE_AVX512
+    return _mm256_srai_epi64(v, 63);
+#else
+    //AVX2 has a 64 bit signed compare, so v >> 63 is just 0 > v
+    return _mm256_cmpgt_epi64(_mm256_setzero_si256(), v);
+#endif
 }
 
-static inline int32x4x2_t libdivide_mullhi_8s32_flat_vector(int32x4x2_t x, int32x4x2_t y) {
-    int32x4x2_t r;
-    r.val[0] = libdivide_mullhi_4s32_flat_vector( x.val[0], y.val[0] );
-    r.val[1] = libdivide_mullhi_4s32_flat_vector( x.val[1], y.val[1] );
-    return r;
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_shift_right_vector(__m256i v, int amt) {
+#if LIBDIVIDE_USE_AVX512
+    return _mm256_sra_epi64(v, libdivide_u32_to_m128i(amt));
+#else
+    //AVX2 still has no 64 bit arithmetic shift (vpsraq is AVX-512).  Flip negative values to nonnegative, do a logical shift, and flip them back: for s = v >> 63, v >> amt == ((v ^ s) >>> amt) ^ s.  Unlike the SSE2 version, this needs no constant that depends on amt.
+    __m256i s = libdivide_4s64_signbits(v);
+    __m256i x = _mm256_srl_epi64(_mm256_xor_si256(v, s), libdivide_u32_to_m128i(amt));
+    return _mm256_xor_si256(x, s);
+#endif
 }
 
-static inline uint32x2_t libdivide_mullhi_2u32_flat_vector(uint32x2_t x, uint32x2_t y) {
-    uint64x2_t r64 = vmull_u32( x, y );
-    r64 = vshrq_n_u64( r64, 32 );
-    uint32x2_t r = vmovn_u64( r64 );
-    return r;
+/* Here, b is assumed to contain one 32 bit value repeated eight times. */
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_mullhi_8u32_flat_vector(__m256i a, __m256i b) {
+    __m256i hi_product_0Z2Z = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+    __m256i a1X3X = _mm256_srli_epi64(a, 32);
+    __m256i hi_product_Z1Z3 = _mm256_mul_epu32(a1X3X, b);
+    return _mm256_blend_epi32(hi_product_0Z2Z, hi_product_Z1Z3, 0xAA); // = hi_product_01234567
 }
 
-static inline uint32x4_t libdivide_mullhi_4u32_flat_vector(uint32x4_t x, uint32x4_t y) {
-    uint64x2_t rlo = vmull_u32( vget_low_u32(x), vget_low_u32(y) );
-    uint64x2_t rhi = vmull_u32( vget_high_u32(x), vget_high_u32(y) );
-    rlo = vshrq_n_u64( rlo, 32 );
-    rhi = vshrq_n_u64( rhi, 32 );
-    uint32x4_t r = vcombine_u32( vmovn_u64( rlo ), vmovn_u64( rhi ) );
-    return r;
+/* b is one 32 bit value repeated eight times. */
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_mullhi_8s32_flat_vector(__m256i a, __m256i b) {
+    __m256i hi_product_0Z2Z = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+    __m256i a1X3X = _mm256_srli_epi64(a, 32);
+    __m256i hi_product_Z1Z3 = _mm256_mul_epi32(a1X3X, b);
+    return _mm256_blend_epi32(hi_product_0Z2Z, hi_product_Z1Z3, 0xAA);
 }
 
-static inline uint32x4x2_t libdivide_mullhi_8u32_flat_vector(uint32x4x2_t x, uint32x4x2_t y) {
-    uint32x4x2_t r;
-    r.val[0] = libdivide_mullhi_4u32_flat_vector( x.val[0], y.val[0] );
-    r.val[1] = libdivide_mullhi_4u32_flat_vector( x.val[1], y.val[1] );
-    return r;
+/* y is one 64 bit value repeated four times. */
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_mullhi_4u64_flat_vector(__m256i x, __m256i y) {
+    //same as the SSE2 version, at twice the width
+    const __m256i mask = _mm256_set1_epi64x(0xFFFFFFFF);
+    const __m256i x1 = _mm256_srli_epi64(x, 32), y1 = _mm256_srli_epi64(y, 32); //_mm256_mul_epu32 only looks at the low 32 bits of each 64 bit lane, so x0 and y0 need no masking
+    const __m256i x0y0_hi = _mm256_srli_epi64(_mm256_mul_epu32(x, y), 32);
+    const __m256i x0y1 = _mm256_mul_epu32(x, y1);
+    const __m256i x1y0 = _mm256_mul_epu32(x1, y);
+    const __m256i x1y1 = _mm256_mul_epu32(x1, y1);
+
+    const __m256i temp = _mm256_add_epi64(x1y0, x0y0_hi);
+    __m256i temp_lo = _mm256_and_si256(temp, mask), temp_hi = _mm256_srli_epi64(temp, 32);
+    temp_lo = _mm256_srli_epi64(_mm256_add_epi64(temp_lo, x0y1), 32);
+    temp_hi = _mm256_add_epi64(x1y1, temp_hi);
+
+    return _mm256_add_epi64(temp_lo, temp_hi);
 }
 
-static inline int64x1_t libdivide_mullhi_1s64_flat_vector(int64x1_t x, int64x1_t y) {
-    int64x1_t r = vdup_n_s64(0);
-    r = vset_lane_s64( libdivide__mullhi_s64( vget_lane_s64(x,0), vget_lane_s64(y,0) ), r, 0 );
-    return r;
+/* y is one 64 bit value repeated four times */
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_mullhi_4s64_flat_vector(__m256i x, __m256i y) {
+    __m256i p = libdivide_mullhi_4u64_flat_vector(x, y);
+    __m256i t1 = _mm256_and_si256(libdivide_4s64_signbits(x), y);
+    p = _mm256_sub_epi64(p, t1);
+    __m256i t2 = _mm256_and_si256(libdivide_4s64_signbits(y), x);
+    p = _mm256_sub_epi64(p, t2);
+    return p;
 }
 
-static inline int64x2_t libdivide_mullhi_2s64_flat_vector(int64x2_t x, int64x2_t y) {
-#if 1
-    int64x2_t r = vdupq_n_s64(0);
-    r = vsetq_lane_s64( libdivide__mullhi_s64( vgetq_lane_s64(x,0), vgetq_lane_s64(y,0) ), r, 0 );
+/* The low half of the product, for the remainders; y is one 64 bit value repeated four times */
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_mullo_4u64_flat_vector(__m256i x, __m256i y) {
+#if LIBDIVIDE_USE_AVX512
+    return _mm256_mullo_epi64(x, y);
+#else
+    __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), y), _mm256_mul_epu32(x, _mm256_srli_epi64(y, 32)));
+    return _mm256_add_epi64(_mm256_mul_epu32(x, y), _mm256_slli_epi64(cross, 32));
+#endif
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide__u64_to_m512i(uint64_t x) {
+    return _mm512_set1_epi64((int64_t)x);
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_signbits(__m512i v) {
+    return _mm512_srai_epi64(v, 63);
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_shift_right_vector(__m512i v, int amt) {
+    return _mm512_sra_epi64(v, libdivide_u32_to_m128i(amt));
+}
+
+/* Here, b is assumed to contain one 32 bit value repeated sixteen times. */
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_mullhi_16u32_flat_vector(__m512i a, __m512i b) {
+    __m512i hi_product_0Z2Z = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+    __m512i a1X3X = _mm512_srli_epi64(a, 32);
+    __m512i hi_product_Z1Z3 = _mm512_mul_epu32(a1X3X, b);
+    return _mm512_mask_blend_epi32(0xAAAA, hi_product_0Z2Z, hi_product_Z1Z3);
+}
+
+/* b is one 32 bit value repeated sixteen times. */
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_mullhi_16s32_flat_vector(__m512i a, __m512i b) {
+    __m512i hi_product_0Z2Z = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32);
+    __m512i a1X3X = _mm512_srli_epi64(a, 32);
+    __m512i hi_product_Z1Z3 = _mm512_mul_epi32(a1X3X, b);
+    return _mm512_mask_blend_epi32(0xAAAA, hi_product_0Z2Z, hi_product_Z1Z3);
+}
+
+/* y is one 64 bit value repeated eight times. */
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_mullhi_8u64_flat_vector(__m512i x, __m512i y) {
+#ifdef __AVX512IFMA__
+    //vpmadd52[lh]uq multiply the low 52 bits of each lane and add the low or high 52 bits of the 104 bit product.  Splitting x and y into 52 bit low parts and 12 bit high parts, the full product is xl*yl + (xh*yl + xl*yh) << 52 + (xh*yh) << 104.  Collect everything of weight 2^52 in a, and everything of weight 2^104 in b; the low 52 bits of xl*yl can't carry past bit 64, so the high half is (a >> 12) + (b << 40)
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i xh = _mm512_srli_epi64(x, 52), yh = _mm512_srli_epi64(y, 52);
+    __m512i a = _mm512_madd52hi_epu64(zero, x, y);
+    a = _mm512_madd52lo_epu64(a, xh, y);
+    a = _mm512_madd52lo_epu64(a, x, yh);
+    __m512i b = _mm512_madd52hi_epu64(zero, xh, y);
+    b = _mm512_madd52hi_epu64(b, x, yh);
+    b = _mm512_madd52lo_epu64(b, xh, yh);
+    return _mm512_add_epi64(_mm512_srli_epi64(a, 12), _mm512_slli_epi64(b, 40));
+#else
+    //same as the SSE2 version, at four times the width
+    const __m512i mask = _mm512_set1_epi64(0xFFFFFFFF);
+    const __m512i x1 = _mm512_srli_epi64(x, 32), y1 = _mm512_srli_epi64(y, 32);
+    const __m512i x0y0_hi = _mm512_srli_epi64(_mm512_mul_epu32(x, y), 32);
+    const __m512i x0y1 = _mm512_mul_epu32(x, y1);
+    const __m512i x1y0 = _mm512_mul_epu32(x1, y);
+    const __m512i x1y1 = _mm512_mul_epu32(x1, y1);
+
+    const __m512i temp = _mm512_add_epi64(x1y0, x0y0_hi);
+    __m512i temp_lo = _mm512_and_si512(temp, mask), temp_hi = _mm512_srli_epi64(temp, 32);
+    temp_lo = _mm512_srli_epi64(_mm512_add_epi64(temp_lo, x0y1), 32);
+    temp_hi = _mm512_add_epi64(x1y1, temp_hi);
+
+    return _mm512_add_epi64(temp_lo, temp_hi);
+#endif
+}
+
+/* y is one 64 bit value repeated eight times */
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_mullhi_8s64_flat_vector(__m512i x, __m512i y) {
+    __m512i p = libdivide_mullhi_8u64_flat_vector(x, y);
+    __m512i t1 = _mm512_and_si512(libdivide_8s64_signbits(x), y);
+    p = _mm512_sub_epi64(p, t1);
+    __m512i t2 = _mm512_and_si512(libdivide_8s64_signbits(y), x);
+    p = _mm512_sub_epi64(p, t2);
+    return p;
+}
+
+/* Loads or stores the first count (fewer than a full vector) elements of size elem_size at p, for the array functions.  The unloaded lanes are zero. */
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_maskz_loadu_512(const void *p, size_t count, size_t elem_size) {
+    if (elem_size == 1) return _mm512_maskz_loadu_epi8((__mmask64)((1ULL << count) - 1), p);
+    else if (elem_size == 4) return _mm512_maskz_loadu_epi32((__mmask16)((1U << count) - 1), p);
+    else return _mm512_maskz_loadu_epi64((__mmask8)((1U << count) - 1), p);
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 void libdivide_mask_storeu_512(void *p, size_t count, size_t elem_size, __m512i v) {
+    if (elem_size == 1) _mm512_mask_storeu_epi8(p, (__mmask64)((1ULL << count) - 1), v);
+    else if (elem_size == 4) _mm512_mask_storeu_epi32(p, (__mmask16)((1U << count) - 1), v);
+    else _mm512_mask_storeu_epi64(p, (__mmask8)((1U << count) - 1), v);
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+static inline int8x8_t libdivide_mullhi_8s8_flat_vector(int8x8_t x, int8x8_t y) {
+    int16x8_t r16 = vmull_s8( x, y );
+    return vshrn_n_s16( r16, 8 );
+}
+
+static inline int8x16_t libdivide_mullhi_16s8_flat_vector(int8x16_t x, int8x16_t y) {
+    int16x8_t rlo = vmull_s8( vget_low_s8(x), vget_low_s8(y) );
+    int16x8_t rhi = vmull_s8( vget_high_s8(x), vget_high_s8(y) );
+    int8x16_t r = vcombine_s8( vshrn_n_s16( rlo, 8 ), vshrn_n_s16( rhi, 8 ) );
+    return r;
+}
+
+static inline uint8x8_t libdivide_mullhi_8u8_flat_vector(uint8x8_t x, uint8x8_t y) {
+    uint16x8_t r16 = vmull_u8( x, y );
+    return vshrn_n_u16( r16, 8 );
+}
+
+static inline uint8x16_t libdivide_mullhi_16u8_flat_vector(uint8x16_t x, uint8x16_t y) {
+    uint16x8_t rlo = vmull_u8( vget_low_u8(x), vget_low_u8(y) );
+    uint16x8_t rhi = vmull_u8( vget_high_u8(x), vget_high_u8(y) );
+    uint8x16_t r = vcombine_u8( vshrn_n_u16( rlo, 8 ), vshrn_n_u16( rhi, 8 ) );
+    return r;
+}
+
+static inline int16x4_t libdivide_mullhi_4s16_flat_vector(int16x4_t x, int16x4_t y) {
+    int32x4_t r32 = vmull_s16( x, y );
+    return vshrn_n_s32( r32, 16 );
+}
+
+static inline int16x8_t libdivide_mullhi_8s16_flat_vector(int16x8_t x, int16x8_t y) {
+    int32x4_t rlo = vmull_s16( vget_low_s16(x), vget_low_s16(y) );
+    int32x4_t rhi = vmull_s16( vget_high_s16(x), vget_high_s16(y) );
+    int16x8_t r = vcombine_s16( vshrn_n_s32( rlo, 16 ), vshrn_n_s32( rhi, 16 ) );
+    return r;
+}
+
+static inline uint16x4_t libdivide_mullhi_4u16_flat_vector(uint16x4_t x, uint16x4_t y) {
+    uint32x4_t r32 = vmull_u16( x, y );
+    return vshrn_n_u32( r32, 16 );
+}
+
+static inline uint16x8_t libdivide_mullhi_8u16_flat_vector(uint16x8_t x, uint16x8_t y) {
+    uint32x4_t rlo = vmull_u16( vget_low_u16(x), vget_low_u16(y) );
+    uint32x4_t rhi = vmull_u16( vget_high_u16(x), vget_high_u16(y) );
+    uint16x8_t r = vcombine_u16( vshrn_n_u32( rlo, 16 ), vshrn_n_u32( rhi, 16 ) );
+    return r;
+}
+
+static inline int32x2_t libdivide_mullhi_2s32_flat_vector(int32x2_t x, int32x2_t y) {
+    int64x2_t r64 = vmull_s32( x, y );
+    r64 = vreinterpretq_s64_u64( vshrq_n_u64( vreinterpretq_u64_s64(r64), 32 ) );
+    int32x2_t r = vmovn_s64( r64 );
+    return r;
+}
+
+static inline int32x4_t libdivide_mullhi_4s32_flat_vector(int32x4_t x, int32x4_t y) {
+    int64x2_t rlo = vmull_s32( vget_low_s32(x), vget_low_s32(y) );
+    int64x2_t rhi = vmull_s32( vget_high_s32(x), vget_high_s32(y) );
+    rlo = vreinterpretq_s64_u64( vshrq_n_u64( vreinterpretq_u64_s64(rlo), 32 ) );
+    rhi = vreinterpretq_s64_u64( vshrq_n_u64( vreinterpretq_u64_s64(rhi), 32 ) );
+    int32x4_t r = vcombine_s32( vmovn_s64( rlo ), vmovn_s64( rhi ) );
+    return r;
+}
+
+static inline int32x4x2_t libdivide_mullhi_8s32_flat_vector(int32x4x2_t x, int32x4x2_t y) {
+    int32x4x2_t r;
+    r.val[0] = libdivide_mullhi_4s32_flat_vector( x.val[0], y.val[0] );
+    r.val[1] = libdivide_mullhi_4s32_flat_vector( x.val[1], y.val[1] );
+    return r;
+}
+
+static inline uint32x2_t libdivide_mullhi_2u32_flat_vector(uint32x2_t x, uint32x2_t y) {
+    uint64x2_t r64 = vmull_u32( x, y );
+    r64 = vshrq_n_u64( r64, 32 );
+    uint32x2_t r = vmovn_u64( r64 );
+    return r;
+}
+
+static inline uint32x4_t libdivide_mullhi_4u32_flat_vector(uint32x4_t x, uint32x4_t y) {
+    uint64x2_t rlo = vmull_u32( vget_low_u32(x), vget_low_u32(y) );
+    uint64x2_t rhi = vmull_u32( vget_high_u32(x), vget_high_u32(y) );
+    rlo = vshrq_n_u64( rlo, 32 );
+    rhi = vshrq_n_u64( rhi, 32 );
+    uint32x4_t r = vcombine_u32( vmovn_u64( rlo ), vmovn_u64( rhi ) );
+    return r;
+}
+
+static inline uint32x4x2_t libdivide_mullhi_8u32_flat_vector(uint32x4x2_t x, uint32x4x2_t y) {
+    uint32x4x2_t r;
+    r.val[0] = libdivide_mullhi_4u32_flat_vector( x.val[0], y.val[0] );
+    r.val[1] = libdivide_mullhi_4u32_flat_vector( x.val[1], y.val[1] );
+    return r;
+}
+
+static inline int64x1_t libdivide_mullhi_1s64_flat_vector(int64x1_t x, int64x1_t y) {
+    int64x1_t r = vdup_n_s64(0);
+    r = vset_lane_s64( libdivide__mullhi_s64( vget_lane_s64(x,0), vget_lane_s64(y,0) ), r, 0 );
+    return r;
+}
+
+static inline int64x2_t libdivide_mullhi_2s64_flat_vector(int64x2_t x, int64x2_t y) {
+#if 1
+    int64x2_t r = vdupq_n_s64(0);
+    r = vsetq_lane_s64( libdivide__mullhi_s64( vgetq_lane_s64(x,0), vgetq_lane_s64(y,0) ), r, 0 );
     r = vsetq_lane_s64( libdivide__mullhi_s64( vgetq_lane_s64(x,1), vgetq_lane_s64(y,1) ), r, 1 );
     return r;
 #else
@@ -621,7 +1981,89 @@ static inline uint64x2x2_t libdivide_mullhi_4u64_flat_vector(uint64x2x2_t x, uin
     r.val[1] = libdivide_mullhi_2u64_flat_vector( x.val[1], y.val[1] );
     return r;
 }
+
+/* The low half of the product, for the remainders.  NEON has no 64 bit multiply, but the low half only needs x0 * y0 + ((x1 * y0 + x0 * y1) << 32) */
+static inline uint64x2_t libdivide_mullo_2u64_flat_vector(uint64x2_t x, uint64x2_t y) {
+    uint32x2_t x0 = vmovn_u64(x);
+    uint32x2_t y0 = vmovn_u64(y);
+    uint32x2_t x1 = vmovn_u64( vshrq_n_u64( x, 32 ) );
+    uint32x2_t y1 = vmovn_u64( vshrq_n_u64( y, 32 ) );
+    uint32x2_t cross = vmla_u32( vmul_u32( x1, y0 ), x0, y1 );
+    return vmlal_u32( vshlq_n_u64( vmovl_u32( cross ), 32 ), x0, y0 );
+}
 #elif LIBDIVIDE_USE_VECTOR
+static inline libdivide_8s8_t libdivide_mullhi_8s8_flat_vector(libdivide_8s8_t x, libdivide_8s8_t y) {
+    libdivide_8s16_t xl = (libdivide_8s16_t) { x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7] };
+    libdivide_8s16_t yl = (libdivide_8s16_t) { y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7] };
+    libdivide_8s16_t rl = (xl * yl) >> (libdivide_8s16_t) { 8, 8, 8, 8, 8, 8, 8, 8 };
+    return (libdivide_8s8_t) { (int8_t)(rl[0]), (int8_t)(rl[1]), (int8_t)(rl[2]), (int8_t)(rl[3]), (int8_t)(rl[4]), (int8_t)(rl[5]), (int8_t)(rl[6]), (int8_t)(rl[7]) };
+}
+static inline libdivide_16s8_t libdivide_mullhi_16s8_flat_vector(libdivide_16s8_t x, libdivide_16s8_t y) {
+    libdivide_16s16_t xl = (libdivide_16s16_t) { x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8], x[9], x[10], x[11], x[12], x[13], x[14], x[15] };
+    libdivide_16s16_t yl = (libdivide_16s16_t) { y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7], y[8], y[9], y[10], y[11], y[12], y[13], y[14], y[15] };
+    libdivide_16s16_t rl = (xl * yl) >> (libdivide_16s16_t) { 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8 };
+    return (libdivide_16s8_t) { (int8_t)(rl[0]), (int8_t)(rl[1]), (int8_t)(rl[2]), (int8_t)(rl[3]), (int8_t)(rl[4]), (int8_t)(rl[5]), (int8_t)(rl[6]), (int8_t)(rl[7]), (int8_t)(rl[8]), (int8_t)(rl[9]), (int8_t)(rl[10]), (int8_t)(rl[11]), (int8_t)(rl[12]), (int8_t)(rl[13]), (int8_t)(rl[14]), (int8_t)(rl[15]) };
+}
+static inline libdivide_32s8_t libdivide_mullhi_32s8_flat_vector(libdivide_32s8_t x, libdivide_32s8_t y) {
+    libdivide_32s16_t xl = (libdivide_32s16_t) { x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8], x[9], x[10], x[11], x[12], x[13], x[14], x[15], x[16], x[17], x[18], x[19], x[20], x[21], x[22], x[23], x[24], x[25], x[26], x[27], x[28], x[29], x[30], x[31] };
+    libdivide_32s16_t yl = (libdivide_32s16_t) { y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7], y[8], y[9], y[10], y[11], y[12], y[13], y[14], y[15], y[16], y[17], y[18], y[19], y[20], y[21], y[22], y[23], y[24], y[25], y[26], y[27], y[28], y[29], y[30], y[31] };
+    libdivide_32s16_t rl = (xl * yl) >> (libdivide_32s16_t) { 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8 };
+    return (libdivide_32s8_t) { (int8_t)(rl[0]), (int8_t)(rl[1]), (int8_t)(rl[2]), (int8_t)(rl[3]), (int8_t)(rl[4]), (int8_t)(rl[5]), (int8_t)(rl[6]), (int8_t)(rl[7]), (int8_t)(rl[8]), (int8_t)(rl[9]), (int8_t)(rl[10]), (int8_t)(rl[11]), (int8_t)(rl[12]), (int8_t)(rl[13]), (int8_t)(rl[14]), (int8_t)(rl[15]), (int8_t)(rl[16]), (int8_t)(rl[17]), (int8_t)(rl[18]), (int8_t)(rl[19]), (int8_t)(rl[20]), (int8_t)(rl[21]), (int8_t)(rl[22]), (int8_t)(rl[23]), (int8_t)(rl[24]), (int8_t)(rl[25]), (int8_t)(rl[26]), (int8_t)(rl[27]), (int8_t)(rl[28]), (int8_t)(rl[29]), (int8_t)(rl[30]), (int8_t)(rl[31]) };
+}
+static inline libdivide_8u8_t libdivide_mullhi_8u8_flat_vector(libdivide_8u8_t x, libdivide_8u8_t y) {
+    libdivide_8u16_t xl = (libdivide_8u16_t) { x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7] };
+    libdivide_8u16_t yl = (libdivide_8u16_t) { y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7] };
+    libdivide_8u16_t rl = (xl * yl) >> (libdivide_8u16_t) { 8, 8, 8, 8, 8, 8, 8, 8 };
+    return (libdivide_8u8_t) { (uint8_t)(rl[0]), (uint8_t)(rl[1]), (uint8_t)(rl[2]), (uint8_t)(rl[3]), (uint8_t)(rl[4]), (uint8_t)(rl[5]), (uint8_t)(rl[6]), (uint8_t)(rl[7]) };
+}
+static inline libdivide_16u8_t libdivide_mullhi_16u8_flat_vector(libdivide_16u8_t x, libdivide_16u8_t y) {
+    libdivide_16u16_t xl = (libdivide_16u16_t) { x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8], x[9], x[10], x[11], x[12], x[13], x[14], x[15] };
+    libdivide_16u16_t yl = (libdivide_16u16_t) { y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7], y[8], y[9], y[10], y[11], y[12], y[13], y[14], y[15] };
+    libdivide_16u16_t rl = (xl * yl) >> (libdivide_16u16_t) { 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8 };
+    return (libdivide_16u8_t) { (uint8_t)(rl[0]), (uint8_t)(rl[1]), (uint8_t)(rl[2]), (uint8_t)(rl[3]), (uint8_t)(rl[4]), (uint8_t)(rl[5]), (uint8_t)(rl[6]), (uint8_t)(rl[7]), (uint8_t)(rl[8]), (uint8_t)(rl[9]), (uint8_t)(rl[10]), (uint8_t)(rl[11]), (uint8_t)(rl[12]), (uint8_t)(rl[13]), (uint8_t)(rl[14]), (uint8_t)(rl[15]) };
+}
+static inline libdivide_32u8_t libdivide_mullhi_32u8_flat_vector(libdivide_32u8_t x, libdivide_32u8_t y) {
+    libdivide_32u16_t xl = (libdivide_32u16_t) { x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8], x[9], x[10], x[11], x[12], x[13], x[14], x[15], x[16], x[17], x[18], x[19], x[20], x[21], x[22], x[23], x[24], x[25], x[26], x[27], x[28], x[29], x[30], x[31] };
+    libdivide_32u16_t yl = (libdivide_32u16_t) { y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7], y[8], y[9], y[10], y[11], y[12], y[13], y[14], y[15], y[16], y[17], y[18], y[19], y[20], y[21], y[22], y[23], y[24], y[25], y[26], y[27], y[28], y[29], y[30], y[31] };
+    libdivide_32u16_t rl = (xl * yl) >> (libdivide_32u16_t) { 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8 };
+    return (libdivide_32u8_t) { (uint8_t)(rl[0]), (uint8_t)(rl[1]), (uint8_t)(rl[2]), (uint8_t)(rl[3]), (uint8_t)(rl[4]), (uint8_t)(rl[5]), (uint8_t)(rl[6]), (uint8_t)(rl[7]), (uint8_t)(rl[8]), (uint8_t)(rl[9]), (uint8_t)(rl[10]), (uint8_t)(rl[11]), (uint8_t)(rl[12]), (uint8_t)(rl[13]), (uint8_t)(rl[14]), (uint8_t)(rl[15]), (uint8_t)(rl[16]), (uint8_t)(rl[17]), (uint8_t)(rl[18]), (uint8_t)(rl[19]), (uint8_t)(rl[20]), (uint8_t)(rl[21]), (uint8_t)(rl[22]), (uint8_t)(rl[23]), (uint8_t)(rl[24]), (uint8_t)(rl[25]), (uint8_t)(rl[26]), (uint8_t)(rl[27]), (uint8_t)(rl[28]), (uint8_t)(rl[29]), (uint8_t)(rl[30]), (uint8_t)(rl[31]) };
+}
+static inline libdivide_4s16_t libdivide_mullhi_4s16_flat_vector(libdivide_4s16_t x, libdivide_4s16_t y) {
+    libdivide_4s32_t xl = (libdivide_4s32_t) { x[0], x[1], x[2], x[3] };
+    libdivide_4s32_t yl = (libdivide_4s32_t) { y[0], y[1], y[2], y[3] };
+    libdivide_4s32_t rl = (xl * yl) >> (libdivide_4s32_t) { 16, 16, 16, 16 };
+    return (libdivide_4s16_t) { (int16_t)(rl[0]), (int16_t)(rl[1]), (int16_t)(rl[2]), (int16_t)(rl[3]) };
+}
+static inline libdivide_8s16_t libdivide_mullhi_8s16_flat_vector(libdivide_8s16_t x, libdivide_8s16_t y) {
+    libdivide_8s32_t xl = (libdivide_8s32_t) { x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7] };
+    libdivide_8s32_t yl = (libdivide_8s32_t) { y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7] };
+    libdivide_8s32_t rl = (xl * yl) >> (libdivide_8s32_t) { 16, 16, 16, 16, 16, 16, 16, 16 };
+    return (libdivide_8s16_t) { (int16_t)(rl[0]), (int16_t)(rl[1]), (int16_t)(rl[2]), (int16_t)(rl[3]), (int16_t)(rl[4]), (int16_t)(rl[5]), (int16_t)(rl[6]), (int16_t)(rl[7]) };
+}
+static inline libdivide_16s16_t libdivide_mullhi_16s16_flat_vector(libdivide_16s16_t x, libdivide_16s16_t y) {
+    libdivide_16s32_t xl = (libdivide_16s32_t) { x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8], x[9], x[10], x[11], x[12], x[13], x[14], x[15] };
+    libdivide_16s32_t yl = (libdivide_16s32_t) { y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7], y[8], y[9], y[10], y[11], y[12], y[13], y[14], y[15] };
+    libdivide_16s32_t rl = (xl * yl) >> (libdivide_16s32_t) { 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16 };
+    return (libdivide_16s16_t) { (int16_t)(rl[0]), (int16_t)(rl[1]), (int16_t)(rl[2]), (int16_t)(rl[3]), (int16_t)(rl[4]), (int16_t)(rl[5]), (int16_t)(rl[6]), (int16_t)(rl[7]), (int16_t)(rl[8]), (int16_t)(rl[9]), (int16_t)(rl[10]), (int16_t)(rl[11]), (int16_t)(rl[12]), (int16_t)(rl[13]), (int16_t)(rl[14]), (int16_t)(rl[15]) };
+}
+static inline libdivide_4u16_t libdivide_mullhi_4u16_flat_vector(libdivide_4u16_t x, libdivide_4u16_t y) {
+    libdivide_4u32_t xl = (libdivide_4u32_t) { x[0], x[1], x[2], x[3] };
+    libdivide_4u32_t yl = (libdivide_4u32_t) { y[0], y[1], y[2], y[3] };
+    libdivide_4u32_t rl = (xl * yl) >> (libdivide_4u32_t) { 16, 16, 16, 16 };
+    return (libdivide_4u16_t) { (uint16_t)(rl[0]), (uint16_t)(rl[1]), (uint16_t)(rl[2]), (uint16_t)(rl[3]) };
+}
+static inline libdivide_8u16_t libdivide_mullhi_8u16_flat_vector(libdivide_8u16_t x, libdivide_8u16_t y) {
+    libdivide_8u32_t xl = (libdivide_8u32_t) { x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7] };
+    libdivide_8u32_t yl = (libdivide_8u32_t) { y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7] };
+    libdivide_8u32_t rl = (xl * yl) >> (libdivide_8u32_t) { 16, 16, 16, 16, 16, 16, 16, 16 };
+    return (libdivide_8u16_t) { (uint16_t)(rl[0]), (uint16_t)(rl[1]), (uint16_t)(rl[2]), (uint16_t)(rl[3]), (uint16_t)(rl[4]), (uint16_t)(rl[5]), (uint16_t)(rl[6]), (uint16_t)(rl[7]) };
+}
+static inline libdivide_16u16_t libdivide_mullhi_16u16_flat_vector(libdivide_16u16_t x, libdivide_16u16_t y) {
+    libdivide_16u32_t xl = (libdivide_16u32_t) { x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8], x[9], x[10], x[11], x[12], x[13], x[14], x[15] };
+    libdivide_16u32_t yl = (libdivide_16u32_t) { y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7], y[8], y[9], y[10], y[11], y[12], y[13], y[14], y[15] };
+    libdivide_16u32_t rl = (xl * yl) >> (libdivide_16u32_t) { 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16 };
+    return (libdivide_16u16_t) { (uint16_t)(rl[0]), (uint16_t)(rl[1]), (uint16_t)(rl[2]), (uint16_t)(rl[3]), (uint16_t)(rl[4]), (uint16_t)(rl[5]), (uint16_t)(rl[6]), (uint16_t)(rl[7]), (uint16_t)(rl[8]), (uint16_t)(rl[9]), (uint16_t)(rl[10]), (uint16_t)(rl[11]), (uint16_t)(rl[12]), (uint16_t)(rl[13]), (uint16_t)(rl[14]), (uint16_t)(rl[15]) };
+}
 static inline libdivide_2s32_t libdivide_mullhi_2s32_flat_vector(libdivide_2s32_t x, libdivide_2s32_t y) {
 #if 0
     return (libdivide_2s32_t) {
@@ -735,8 +2177,8 @@ static inline libdivide_2s64_t libdivide_mullhi_2s64_flat_vector(libdivide_2s64_
 }
 static inline libdivide_4s64_t libdivide_mullhi_4s64_flat_vector(libdivide_4s64_t x, libdivide_4s64_t y) {
 #if HAS_INT128_T
-    libdivide_4s128_t xl = (libdivide_4s128_t) { x[0], x[1], x[1], x[2] };
-    libdivide_4s128_t yl = (libdivide_4s128_t) { y[0], y[1], y[1], y[2] };
+    libdivide_4s128_t xl = (libdivide_4s128_t) { x[0], x[1], x[2], x[3] };
+    libdivide_4s128_t yl = (libdivide_4s128_t) { y[0], y[1], y[2], y[3] };
     libdivide_4s128_t rl = (xl * yl) >> (libdivide_4u128_t) { 64, 64, 64, 64 };
     return (libdivide_4s64_t) { (int64_t)(rl[0]), (int64_t)(rl[1]), (int64_t)(rl[2]), (int64_t)(rl[3]) };
 #else
@@ -772,8 +2214,8 @@ static inline libdivide_2u64_t libdivide_mullhi_2u64_flat_vector(libdivide_2u64_
 }
 static inline libdivide_4u64_t libdivide_mullhi_4u64_flat_vector(libdivide_4u64_t x, libdivide_4u64_t y) {
 #if HAS_INT128_T
-    libdivide_4u128_t xl = (libdivide_4u128_t) { x[0], x[1], x[1], x[2] };
-    libdivide_4u128_t yl = (libdivide_4u128_t) { y[0], y[1], y[1], y[2] };
+    libdivide_4u128_t xl = (libdivide_4u128_t) { x[0], x[1], x[2], x[3] };
+    libdivide_4u128_t yl = (libdivide_4u128_t) { y[0], y[1], y[2], y[3] };
     libdivide_4u128_t rl = (xl * yl) >> (libdivide_4u128_t) { 64, 64, 64, 64 };
     return (libdivide_4u64_t) { (uint64_t)(rl[0]), (uint64_t)(rl[1]), (uint64_t)(rl[2]), (uint64_t)(rl[3]) };
 #else
@@ -844,6 +2286,48 @@ static inline int32_t libdivide__count_leading_zeros64(uint64_t val) {
 #endif
 }
 
+#if HAS_INT128_T
+static inline int32_t libdivide__count_trailing_zeros128(__uint128_t val) {
+    uint64_t lo = (uint64_t)val;
+    if (lo != 0) return libdivide__count_trailing_zeros64(lo);
+    return 64 + libdivide__count_trailing_zeros64((uint64_t)(val >> 64));
+}
+
+static inline int32_t libdivide__count_leading_zeros128(__uint128_t val) {
+    uint64_t hi = (uint64_t)(val >> 64);
+    if (hi != 0) return libdivide__count_leading_zeros64(hi);
+    return 64 + libdivide__count_leading_zeros64((uint64_t)val);
+}
+#endif
+
+/* The inverse of the odd number d modulo 2**32 or 2**64, by Newton's method.  An odd d is its own inverse modulo 8, and each step doubles the number of correct bits. */
+static inline uint32_t libdivide__mod_inverse_u32(uint32_t d) {
+    uint32_t x = d;
+    x *= 2 - d * x;
+    x *= 2 - d * x;
+    x *= 2 - d * x;
+    x *= 2 - d * x;
+    return x;
+}
+
+static inline uint64_t libdivide__mod_inverse_u64(uint64_t d) {
+    uint64_t x = d;
+    x *= 2 - d * x;
+    x *= 2 - d * x;
+    x *= 2 - d * x;
+    x *= 2 - d * x;
+    x *= 2 - d * x;
+    return x;
+}
+
+static inline uint32_t libdivide__rotr32(uint32_t x, int r) {
+    return (x >> r) | (x << ((32 - r) & 31));
+}
+
+static inline uint64_t libdivide__rotr64(uint64_t x, int r) {
+    return (x >> r) | (x << ((64 - r) & 63));
+}
+
 //libdivide_64_div_32_to_32: divides a 64 bit uint {u1, u0} by a 32 bit uint {v}.  The result must fit in 32 bits.  Returns the quotient directly and the remainder in *r
 #if (LIBDIVIDE_IS_i386 || LIBDIVIDE_IS_X86_64) && LIBDIVIDE_GCC_STYLE_ASM
 static uint32_t libdivide_64_div_32_to_32(uint32_t u1, uint32_t u0, uint32_t v, uint32_t *r) {
@@ -863,7 +2347,27 @@ static uint32_t libdivide_64_div_32_to_32(uint32_t u1, uint32_t u0, uint32_t v,
 }
 #endif
 
-#if LIBDIVIDE_IS_X86_64 && LIBDIVIDE_GCC_STYLE_ASM
+//libdivide_128_div_64_normalized: divides a 128 bit uint {u1, u0} by a 64 bit uint {d} with its top bit set, given its reciprocal v = floor((2**128 - 1) / d) - 2**64.  u1 must be less than d.  This is Moller and Granlund, "Improved division by invariant integers", algorithm 4.  Returns the quotient directly and the remainder in *r
+static inline uint64_t libdivide_128_div_64_normalized(uint64_t u1, uint64_t u0, uint64_t d, uint64_t v, uint64_t *r) {
+    //{q1, q0} = v * u1 + {u1 + 1, u0}, which leaves q1 within one of the quotient
+    const uint64_t q0 = v * u1 + u0;
+    uint64_t q1 = libdivide__mullhi_u64(v, u1) + u1 + 1 + (q0 < u0);
+    uint64_t rem = u0 - q1 * d;
+    //q1 is one too big about half the time, which a branch would mispredict, so select instead
+    const int over = rem > q0;
+    q1 = over ? q1 - 1 : q1;
+    rem = over ? rem + d : rem;
+    //and it is one too small only rarely
+    if (rem >= d) {
+        q1++;
+        rem -= d;
+    }
+    *r = rem;
+    return q1;
+}
+
+//libdivide_128_div_64_to_64: divides a 128 bit uint {u1, u0} by a 64 bit uint {v}.  The result must fit in 64 bits.  Returns the quotient directly and the remainder in *r.  libdivide_pow2_div_64_to_64 is the same for the dividend 2**(64 + power), which is all the gen functions divide, and libdivide_reciprocal_64 gives the v above for a normalized d.  Define LIBDIVIDE_NO_DIVQ to use the portable versions on x86-64 too, where divq is slow on older parts
+#if LIBDIVIDE_IS_X86_64 && LIBDIVIDE_GCC_STYLE_ASM && ! LIBDIVIDE_NO_DIVQ
 static uint64_t libdivide_128_div_64_to_64(uint64_t u1, uint64_t u0, uint64_t v, uint64_t *r) {
     //u0 -> rax
     //u1 -> rdx
@@ -876,57 +2380,128 @@ static uint64_t libdivide_128_div_64_to_64(uint64_t u1, uint64_t u0, uint64_t v,
     return result;
 
 }
+
+static inline uint64_t libdivide_pow2_div_64_to_64(uint32_t power, uint64_t d, uint64_t *r) {
+    return libdivide_128_div_64_to_64(1ULL << power, 0, d, r);
+}
+
+static inline uint64_t libdivide_reciprocal_64(uint64_t d) {
+    uint64_t rem;
+    //2**128 - 1 - 2**64 * d is {~d, all ones}, and its quotient fits in 64 bits because the top bit of d is set
+    return libdivide_128_div_64_to_64(~d, 0xFFFFFFFFFFFFFFFFULL, d, &rem);
+}
 #else
 
-/* Code taken from Hacker's Delight, http://www.hackersdelight.org/HDcode/divlu.c .  License permits inclusion here per http://www.hackersdelight.org/permissions.htm
- */
-static uint64_t libdivide_128_div_64_to_64(uint64_t u1, uint64_t u0, uint64_t v, uint64_t *r) {
-    const uint64_t b = (1ULL << 32); // Number base (16 bits).
-    uint64_t un1, un0,        // Norm. dividend LSD's.
-    vn1, vn0,        // Norm. divisor digits.
-    q1, q0,          // Quotient digits.
-    un64, un21, un10,// Dividend digit pairs.
-    rhat;            // A remainder.
-    int s;                  // Shift amount for norm.
+/* The portable versions divide by the reciprocal of the normalized divisor, which takes only multiplies, rather than the long division of Hacker's Delight divlu.  That needs two 64 by 32 bit divides with loops to correct them, and 64 bit division is a library call on 32 bit targets.  The reciprocal is Moller and Granlund algorithm 3: an 11 bit estimate from a table, three Newton steps to 64 bits, and an adjustment to make it exact.  d must have its top bit set */
+static inline uint64_t libdivide_reciprocal_64(uint64_t d) {
+    //floor((2**19 - 3 * 2**8) / d9) for each 9 bit d9 with its top bit set
+    static const uint16_t table[256] = {
+        2045, 2037, 2029, 2021, 2013, 2005, 1998, 1990, 1983, 1975, 1968, 1960, 1953, 1946, 1938, 1931,
+        1924, 1917, 1910, 1903, 1896, 1889, 1883, 1876, 1869, 1863, 1856, 1849, 1843, 1836, 1830, 1824,
+        1817, 1811, 1805, 1799, 1792, 1786, 1780, 1774, 1768, 1762, 1756, 1750, 1745, 1739, 1733, 1727,
+        1722, 1716, 1710, 1705, 1699, 1694, 1688, 1683, 1677, 1672, 1667, 1661, 1656, 1651, 1646, 1641,
+        1636, 1630, 1625, 1620, 1615, 1610, 1605, 1600, 1596, 1591, 1586, 1581, 1576, 1572, 1567, 1562,
+        1558, 1553, 1548, 1544, 1539, 1535, 1530, 1526, 1521, 1517, 1513, 1508, 1504, 1500, 1495, 1491,
+        1487, 1483, 1478, 1474, 1470, 1466, 1462, 1458, 1454, 1450, 1446, 1442, 1438, 1434, 1430, 1426,
+        1422, 1418, 1414, 1411, 1407, 1403, 1399, 1396, 1392, 1388, 1384, 1381, 1377, 1374, 1370, 1366,
+        1363, 1359, 1356, 1352, 1349, 1345, 1342, 1338, 1335, 1332, 1328, 1325, 1322, 1318, 1315, 1312,
+        1308, 1305, 1302, 1299, 1295, 1292, 1289, 1286, 1283, 1280, 1276, 1273, 1270, 1267, 1264, 1261,
+        1258, 1255, 1252, 1249, 1246, 1243, 1240, 1237, 1234, 1231, 1228, 1226, 1223, 1220, 1217, 1214,
+        1211, 1209, 1206, 1203, 1200, 1197, 1195, 1192, 1189, 1187, 1184, 1181, 1179, 1176, 1173, 1171,
+        1168, 1165, 1163, 1160, 1158, 1155, 1153, 1150, 1148, 1145, 1143, 1140, 1138, 1135, 1133, 1130,
+        1128, 1125, 1123, 1121, 1118, 1116, 1113, 1111, 1109, 1106, 1104, 1102, 1099, 1097, 1095, 1092,
+        1090, 1088, 1086, 1083, 1081, 1079, 1077, 1074, 1072, 1070, 1068, 1066, 1064, 1061, 1059, 1057,
+        1055, 1053, 1051, 1049, 1047, 1044, 1042, 1040, 1038, 1036, 1034, 1032, 1030, 1028, 1026, 1024
+    };
+    const uint64_t d0 = d & 1;
+    const uint64_t d40 = (d >> 24) + 1;
+    const uint64_t d63 = (d >> 1) + d0;
+    const uint64_t v0 = table[(d >> 55) - 256];
+    const uint64_t v1 = (v0 << 11) - ((v0 * v0 * d40) >> 40) - 1;
+    const uint64_t v2 = (v1 << 13) + ((v1 * ((1ULL << 60) - v1 * d40)) >> 47);
+    //e is 2**96 - v2 * d63 + (v2 / 2) * d0, which fits in 64 bits
+    const uint64_t e = ((v2 >> 1) & (0 - d0)) - v2 * d63;
+    const uint64_t v3 = (libdivide__mullhi_u64(v2, e) >> 1) + (v2 << 31);
+    //the adjustment takes the high word of (2**64 + v3 + 1) * d off v3
+    const uint64_t lo = v3 * d + d;
+    const uint64_t hi = libdivide__mullhi_u64(v3, d) + d + (lo < d);
+    return v3 - hi;
+}
+
+static inline uint64_t libdivide_128_div_64_to_64(uint64_t u1, uint64_t u0, uint64_t v, uint64_t *r) {
+    uint64_t rem, result;
+    int s;
 
     if (u1 >= v) {            // If overflow, set rem.
         if (r != NULL)         // to an impossible value,
             *r = (uint64_t)(-1);    // and return the largest
         return (uint64_t)(-1);}    // possible quotient.
 
-    /* count leading zeros */
     s = libdivide__count_leading_zeros64(v); // 0 <= s <= 63.
+    v = v << s;
+    //u0 goes right in two steps, so that a shift of 0 doesn't shift by 64
+    result = libdivide_128_div_64_normalized((u1 << s) | ((u0 >> (63 - s)) >> 1), u0 << s, v, libdivide_reciprocal_64(v), &rem);
+    if (r != NULL)
+        *r = rem >> s;
+    return result;
+}
+
+/* 2**(64 + power) / d, for 2**power < d and d not a power of 2.  Normalized, that is 2**(127 - j) / (d << s) for j = floor_log_2_d - power, and dividing the reciprocal 2**64 + v = floor(2**128 / (d << s)) by 2**(j + 1) gives it directly.  The remainder is less than d, so its low word is all there is to it */
+static inline uint64_t libdivide_pow2_div_64_to_64(uint32_t power, uint64_t d, uint64_t *r) {
+    const int s = libdivide__count_leading_zeros64(d);
+    const int j = 63 - s - (int)power;
+    const uint64_t q = (libdivide_reciprocal_64(d << s) >> 1 >> j) | (1ULL << 63 >> j);
+    *r = (0 - q * (d << s)) >> s;
+    return q;
+}
+#endif
+
+#if HAS_INT128_T
+/* libdivide_256_div_128_to_128: divides a 256 bit uint {u1, u0} by a 128 bit uint {v}, for the 128 bit magic numbers.  It is the long division from Hacker's Delight, http://www.hackersdelight.org/HDcode/divlu.c , with 64 bit digits; the digit divisions are 128 by 64 bits, which __udivti3 does with a hardware divide where there is one.  The result must fit in 128 bits.  Returns the quotient directly and the remainder in *r */
+static __uint128_t libdivide_256_div_128_to_128(__uint128_t u1, __uint128_t u0, __uint128_t v, __uint128_t *r) {
+    const __uint128_t b = (__uint128_t)1 << 64; // Number base (64 bits).
+    const __uint128_t mask = b - 1;
+    __uint128_t un1, un0, vn1, vn0, q1, q0, un128, un21, un10, rhat;
+    int s;
+
+    if (u1 >= v) {
+        if (r != NULL)
+            *r = ~(__uint128_t)0;
+        return ~(__uint128_t)0;
+    }
+
+    s = libdivide__count_leading_zeros128(v); // 0 <= s <= 127.
 
-    v = v << s;               // Normalize divisor.
-    vn1 = v >> 32;            // Break divisor up into
-    vn0 = v & 0xFFFFFFFF;     // two 32-bit digits.
+    v = v << s;
+    vn1 = v >> 64;
+    vn0 = v & mask;
 
-    un64 = (u1 << s) | ((u0 >> (64 - s)) & (-s >> 31));
-    un10 = u0 << s;           // Shift dividend left.
+    un128 = (s == 0 ? u1 : (u1 << s) | (u0 >> (128 - s)));
+    un10 = u0 << s;
 
-    un1 = un10 >> 32;         // Break right half of
-    un0 = un10 & 0xFFFFFFFF;  // dividend into two digits.
+    un1 = un10 >> 64;
+    un0 = un10 & mask;
 
-    q1 = un64/vn1;            // Compute the first
-    rhat = un64 - q1*vn1;     // quotient digit, q1.
+    q1 = un128/vn1;
+    rhat = un128 - q1*vn1;
 again1:
     if (q1 >= b || q1*vn0 > b*rhat + un1) {
         q1 = q1 - 1;
         rhat = rhat + vn1;
         if (rhat < b) goto again1;}
 
-    un21 = un64*b + un1 - q1*v;  // Multiply and subtract.
+    un21 = un128*b + un1 - q1*v;
 
-    q0 = un21/vn1;            // Compute the second
-    rhat = un21 - q0*vn1;     // quotient digit, q0.
+    q0 = un21/vn1;
+    rhat = un21 - q0*vn1;
 again2:
     if (q0 >= b || q0*vn0 > b*rhat + un0) {
         q0 = q0 - 1;
         rhat = rhat + vn1;
         if (rhat < b) goto again2;}
 
-    if (r != NULL)            // If remainder is wanted,
-        *r = (un21*b + un0 - q0*v) >> s;     // return it.
+    if (r != NULL)
+        *r = (un21*b + un0 - q0*v) >> s;
     return q1*b + q0;
 }
 #endif
@@ -943,6 +2518,7 @@ again2:
 
 struct libdivide_u32_t libdivide_u32_gen(uint32_t d) {
     struct libdivide_u32_t result;
+    result.divisor = d;
     if ((d & (d - 1)) == 0) {
         result.magic = 0;
         result.more = libdivide__count_trailing_zeros32(d) | LIBDIVIDE_U32_SHIFT_PATH;
@@ -1054,6 +2630,80 @@ __m128i libdivide_4u32_do_vector_alg2(__m128i numers, const struct libdivide_u32
     __m128i t = _mm_add_epi32(_mm_srli_epi32(_mm_sub_epi32(numers, q), 1), q);
     return _mm_srl_epi32(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_32_SHIFT_MASK));
 }
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_do_vector(__m256i numers, const struct libdivide_u32_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U32_SHIFT_PATH) {
+        return _mm256_srl_epi32(numers, libdivide_u32_to_m128i(more & LIBDIVIDE_32_SHIFT_MASK));
+    }
+    else {
+        __m256i q = libdivide_mullhi_8u32_flat_vector(numers, _mm256_set1_epi32(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            //uint32_t t = ((numer - q) >> 1) + q;
+            //return t >> denom->shift;
+            __m256i t = _mm256_add_epi32(_mm256_srli_epi32(_mm256_sub_epi32(numers, q), 1), q);
+            return _mm256_srl_epi32(t, libdivide_u32_to_m128i(more & LIBDIVIDE_32_SHIFT_MASK));
+        }
+        else {
+            //q >> denom->shift
+            return _mm256_srl_epi32(q, libdivide_u32_to_m128i(more));
+        }
+    }
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_do_vector_alg0(__m256i numers, const struct libdivide_u32_t *denom) {
+    return _mm256_srl_epi32(numers, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_32_SHIFT_MASK));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_do_vector_alg1(__m256i numers, const struct libdivide_u32_t *denom) {
+    __m256i q = libdivide_mullhi_8u32_flat_vector(numers, _mm256_set1_epi32(denom->magic));
+    return _mm256_srl_epi32(q, libdivide_u32_to_m128i(denom->more));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_do_vector_alg2(__m256i numers, const struct libdivide_u32_t *denom) {
+    __m256i q = libdivide_mullhi_8u32_flat_vector(numers, _mm256_set1_epi32(denom->magic));
+    __m256i t = _mm256_add_epi32(_mm256_srli_epi32(_mm256_sub_epi32(numers, q), 1), q);
+    return _mm256_srl_epi32(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_32_SHIFT_MASK));
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_do_vector(__m512i numers, const struct libdivide_u32_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U32_SHIFT_PATH) {
+        return _mm512_srl_epi32(numers, libdivide_u32_to_m128i(more & LIBDIVIDE_32_SHIFT_MASK));
+    }
+    else {
+        __m512i q = libdivide_mullhi_16u32_flat_vector(numers, _mm512_set1_epi32(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            //uint32_t t = ((numer - q) >> 1) + q;
+            //return t >> denom->shift;
+            __m512i t = _mm512_add_epi32(_mm512_srli_epi32(_mm512_sub_epi32(numers, q), 1), q);
+            return _mm512_srl_epi32(t, libdivide_u32_to_m128i(more & LIBDIVIDE_32_SHIFT_MASK));
+        }
+        else {
+            //q >> denom->shift
+            return _mm512_srl_epi32(q, libdivide_u32_to_m128i(more));
+        }
+    }
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_do_vector_alg0(__m512i numers, const struct libdivide_u32_t *denom) {
+    return _mm512_srl_epi32(numers, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_32_SHIFT_MASK));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_do_vector_alg1(__m512i numers, const struct libdivide_u32_t *denom) {
+    __m512i q = libdivide_mullhi_16u32_flat_vector(numers, _mm512_set1_epi32(denom->magic));
+    return _mm512_srl_epi32(q, libdivide_u32_to_m128i(denom->more));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_do_vector_alg2(__m512i numers, const struct libdivide_u32_t *denom) {
+    __m512i q = libdivide_mullhi_16u32_flat_vector(numers, _mm512_set1_epi32(denom->magic));
+    __m512i t = _mm512_add_epi32(_mm512_srli_epi32(_mm512_sub_epi32(numers, q), 1), q);
+    return _mm512_srl_epi32(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_32_SHIFT_MASK));
+}
+#endif
 #elif LIBDIVIDE_USE_NEON
 uint32x2_t libdivide_2u32_do_vector(uint32x2_t numers, const struct libdivide_u32_t * denom) {
     uint8_t more = denom->more;
@@ -1241,6 +2891,7 @@ libdivide_8u32_t libdivide_8u32_do_vector_alg2(libdivide_8u32_t numers, const st
 
 struct libdivide_u64_t libdivide_u64_gen(uint64_t d) {
     struct libdivide_u64_t result;
+    result.divisor = d;
     if ((d & (d - 1)) == 0) {
         result.more = libdivide__count_trailing_zeros64(d) | LIBDIVIDE_U64_SHIFT_PATH;
         result.magic = 0;
@@ -1250,7 +2901,7 @@ struct libdivide_u64_t libdivide_u64_gen(uint64_t d) {
 
         uint64_t proposed_m, rem;
         uint8_t more;
-        proposed_m = libdivide_128_div_64_to_64(1ULL << floor_log_2_d, 0, d, &rem); //== (1 << (64 + floor_log_2_d)) / d
+        proposed_m = libdivide_pow2_div_64_to_64(floor_log_2_d, d, &rem); //== (1 << (64 + floor_log_2_d)) / d
 
         LIBDIVIDE_ASSERT(rem > 0 && rem < d);
         const uint64_t e = d - rem;
@@ -1349,6 +3000,80 @@ __m128i libdivide_2u64_do_vector_alg2(__m128i numers, const struct libdivide_u64
     __m128i t = _mm_add_epi64(_mm_srli_epi64(_mm_sub_epi64(numers, q), 1), q);
     return _mm_srl_epi64(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_64_SHIFT_MASK));
 }
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_do_vector(__m256i numers, const struct libdivide_u64_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U64_SHIFT_PATH) {
+        return _mm256_srl_epi64(numers, libdivide_u32_to_m128i(more & LIBDIVIDE_64_SHIFT_MASK));
+    }
+    else {
+        __m256i q = libdivide_mullhi_4u64_flat_vector(numers, libdivide__u64_to_m256i(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            //uint64_t t = ((numer - q) >> 1) + q;
+            //return t >> denom->shift;
+            __m256i t = _mm256_add_epi64(_mm256_srli_epi64(_mm256_sub_epi64(numers, q), 1), q);
+            return _mm256_srl_epi64(t, libdivide_u32_to_m128i(more & LIBDIVIDE_64_SHIFT_MASK));
+        }
+        else {
+            //q >> denom->shift
+            return _mm256_srl_epi64(q, libdivide_u32_to_m128i(more));
+        }
+    }
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_do_vector_alg0(__m256i numers, const struct libdivide_u64_t *denom) {
+    return _mm256_srl_epi64(numers, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_64_SHIFT_MASK));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_do_vector_alg1(__m256i numers, const struct libdivide_u64_t *denom) {
+    __m256i q = libdivide_mullhi_4u64_flat_vector(numers, libdivide__u64_to_m256i(denom->magic));
+    return _mm256_srl_epi64(q, libdivide_u32_to_m128i(denom->more));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_do_vector_alg2(__m256i numers, const struct libdivide_u64_t *denom) {
+    __m256i q = libdivide_mullhi_4u64_flat_vector(numers, libdivide__u64_to_m256i(denom->magic));
+    __m256i t = _mm256_add_epi64(_mm256_srli_epi64(_mm256_sub_epi64(numers, q), 1), q);
+    return _mm256_srl_epi64(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_64_SHIFT_MASK));
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_do_vector(__m512i numers, const struct libdivide_u64_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U64_SHIFT_PATH) {
+        return _mm512_srl_epi64(numers, libdivide_u32_to_m128i(more & LIBDIVIDE_64_SHIFT_MASK));
+    }
+    else {
+        __m512i q = libdivide_mullhi_8u64_flat_vector(numers, libdivide__u64_to_m512i(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            //uint64_t t = ((numer - q) >> 1) + q;
+            //return t >> denom->shift;
+            __m512i t = _mm512_add_epi64(_mm512_srli_epi64(_mm512_sub_epi64(numers, q), 1), q);
+            return _mm512_srl_epi64(t, libdivide_u32_to_m128i(more & LIBDIVIDE_64_SHIFT_MASK));
+        }
+        else {
+            //q >> denom->shift
+            return _mm512_srl_epi64(q, libdivide_u32_to_m128i(more));
+        }
+    }
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_do_vector_alg0(__m512i numers, const struct libdivide_u64_t *denom) {
+    return _mm512_srl_epi64(numers, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_64_SHIFT_MASK));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_do_vector_alg1(__m512i numers, const struct libdivide_u64_t *denom) {
+    __m512i q = libdivide_mullhi_8u64_flat_vector(numers, libdivide__u64_to_m512i(denom->magic));
+    return _mm512_srl_epi64(q, libdivide_u32_to_m128i(denom->more));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_do_vector_alg2(__m512i numers, const struct libdivide_u64_t *denom) {
+    __m512i q = libdivide_mullhi_8u64_flat_vector(numers, libdivide__u64_to_m512i(denom->magic));
+    __m512i t = _mm512_add_epi64(_mm512_srli_epi64(_mm512_sub_epi64(numers, q), 1), q);
+    return _mm512_srl_epi64(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_64_SHIFT_MASK));
+}
+#endif
 #elif LIBDIVIDE_USE_NEON
 uint64x1_t libdivide_1u64_do_vector(uint64x1_t numers, const struct libdivide_u64_t * denom) {
     uint8_t more = denom->more;
@@ -1512,40 +3237,40 @@ libdivide_4u64_t libdivide_4u64_do_vector_alg0(libdivide_4u64_t numers, const st
 
 libdivide_1u64_t libdivide_1u64_do_vector_alg1(libdivide_1u64_t numers, const struct libdivide_u64_t *denom) {
     uint32_t s = denom->more;
-    uint32_t m = denom->magic;
+    uint64_t m = denom->magic;
     libdivide_1u64_t q = libdivide_mullhi_1u64_flat_vector( numers, (libdivide_1u64_t) { m } );
     return q >> (libdivide_1u64_t) { s };
 }
 libdivide_2u64_t libdivide_2u64_do_vector_alg1(libdivide_2u64_t numers, const struct libdivide_u64_t *denom) {
     uint32_t s = denom->more;
-    uint32_t m = denom->magic;
+    uint64_t m = denom->magic;
     libdivide_2u64_t q = libdivide_mullhi_2u64_flat_vector( numers, (libdivide_2u64_t) { m, m } );
     return q >> (libdivide_2u64_t) { s, s };
 }
 libdivide_4u64_t libdivide_4u64_do_vector_alg1(libdivide_4u64_t numers, const struct libdivide_u64_t *denom) {
     uint32_t s = denom->more;
-    uint32_t m = denom->magic;
+    uint64_t m = denom->magic;
     libdivide_4u64_t q = libdivide_mullhi_4u64_flat_vector( numers, (libdivide_4u64_t) { m, m, m, m } );
     return q >> (libdivide_4u64_t) { s, s, s, s };
 }
 
 libdivide_1u64_t libdivide_1u64_do_vector_alg2(libdivide_1u64_t numers, const struct libdivide_u64_t *denom) {
     uint32_t s = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    uint32_t m = denom->magic;
+    uint64_t m = denom->magic;
     libdivide_1u64_t q = libdivide_mullhi_1u64_flat_vector( numers, (libdivide_1u64_t) { m } );
     libdivide_1u64_t t = ( ( numers - q ) >> (libdivide_1u64_t) { 1 } ) + q;
     return t >> (libdivide_1u64_t) { s };
 }
 libdivide_2u64_t libdivide_2u64_do_vector_alg2(libdivide_2u64_t numers, const struct libdivide_u64_t *denom) {
     uint32_t s = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    uint32_t m = denom->magic;
+    uint64_t m = denom->magic;
     libdivide_2u64_t q = libdivide_mullhi_2u64_flat_vector( numers, (libdivide_2u64_t) { m, m } );
     libdivide_2u64_t t = ( ( numers - q ) >> (libdivide_2u64_t) { 1, 1 } ) + q;
     return t >> (libdivide_2u64_t) { s, s };
 }
 libdivide_4u64_t libdivide_4u64_do_vector_alg2(libdivide_4u64_t numers, const struct libdivide_u64_t *denom) {
     uint32_t s = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    uint32_t m = denom->magic;
+    uint64_t m = denom->magic;
     libdivide_4u64_t q = libdivide_mullhi_4u64_flat_vector( numers, (libdivide_4u64_t) { m, m, m, m } );
     libdivide_4u64_t t = ( ( numers - q ) >> (libdivide_4u64_t) { 1, 1, 1, 1 } ) + q;
     return t >> (libdivide_4u64_t) { s, s, s, s };
@@ -1556,6 +3281,7 @@ libdivide_4u64_t libdivide_4u64_do_vector_alg2(libdivide_4u64_t numers, const st
 
 struct libdivide_s32_t libdivide_s32_gen(int32_t d) {
     struct libdivide_s32_t result;
+    result.divisor = d;
 
     /* If d is a power of 2, or negative a power of 2, we have to use a shift.  This is especially important because the magic algorithm fails for -1.  To check if d is a power of 2 or its inverse, it suffices to check whether its absolute value has exactly one bit set.  This works even for INT_MIN, because abs(INT_MIN) == INT_MIN, and INT_MIN has one bit set and is a power of 2.  */
     uint32_t absD = (uint32_t)(d < 0 ? -d : d); //gcc optimizes this to the fast abs trick
@@ -1597,7 +3323,7 @@ int32_t libdivide_s32_do(int32_t numer, const struct libdivide_s32_t *denom) {
     uint8_t more = denom->more;
     if (more & LIBDIVIDE_S32_SHIFT_PATH) {
         uint8_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
-        int32_t q = numer + ((numer >> 31) & ((1 << shifter) - 1));
+        int32_t q = numer + ((numer >> 31) & ((int32_t)((1U << shifter) - 1)));
         q = q >> shifter;
         int32_t shiftMask = (int8_t)more >> 7; //must be arithmetic shift and then sign-extend
         q = (q ^ shiftMask) - shiftMask;
@@ -1625,13 +3351,13 @@ int libdivide_s32_get_algorithm(const struct libdivide_s32_t *denom) {
 
 int32_t libdivide_s32_do_alg0(int32_t numer, const struct libdivide_s32_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32_t q = numer + ((numer >> 31) & ((1 << shifter) - 1));
+    int32_t q = numer + ((numer >> 31) & ((int32_t)((1U << shifter) - 1)));
     return q >> shifter;
 }
 
 int32_t libdivide_s32_do_alg1(int32_t numer, const struct libdivide_s32_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32_t q = numer + ((numer >> 31) & ((1 << shifter) - 1));
+    int32_t q = numer + ((numer >> 31) & ((int32_t)((1U << shifter) - 1)));
     return - (q >> shifter);
 }
 
@@ -1663,7 +3389,7 @@ __m128i libdivide_4s32_do_vector(__m128i numers, const struct libdivide_s32_t *
     uint8_t more = denom->more;
     if (more & LIBDIVIDE_S32_SHIFT_PATH) {
         uint32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
-        __m128i roundToZeroTweak = _mm_set1_epi32((1 << shifter) - 1); //could use _mm_srli_epi32 with an all -1 register
+        __m128i roundToZeroTweak = _mm_set1_epi32((int32_t)((1U << shifter) - 1)); //could use _mm_srli_epi32 with an all -1 register
         __m128i q = _mm_add_epi32(numers, _mm_and_si128(_mm_srai_epi32(numers, 31), roundToZeroTweak)); //q = numer + ((numer >> 31) & roundToZeroTweak);
         q = _mm_sra_epi32(q, libdivide_u32_to_m128i(shifter)); // q = q >> shifter
         __m128i shiftMask = _mm_set1_epi32((int32_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
@@ -1684,14 +3410,14 @@ __m128i libdivide_4s32_do_vector(__m128i numers, const struct libdivide_s32_t *
 
 __m128i libdivide_4s32_do_vector_alg0(__m128i numers, const struct libdivide_s32_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    __m128i roundToZeroTweak = _mm_set1_epi32((1 << shifter) - 1);
+    __m128i roundToZeroTweak = _mm_set1_epi32((int32_t)((1U << shifter) - 1));
     __m128i q = _mm_add_epi32(numers, _mm_and_si128(_mm_srai_epi32(numers, 31), roundToZeroTweak));
     return _mm_sra_epi32(q, libdivide_u32_to_m128i(shifter));
 }
 
 __m128i libdivide_4s32_do_vector_alg1(__m128i numers, const struct libdivide_s32_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    __m128i roundToZeroTweak = _mm_set1_epi32((1 << shifter) - 1);
+    __m128i roundToZeroTweak = _mm_set1_epi32((int32_t)((1U << shifter) - 1));
     __m128i q = _mm_add_epi32(numers, _mm_and_si128(_mm_srai_epi32(numers, 31), roundToZeroTweak));
     return _mm_sub_epi32(_mm_setzero_si128(), _mm_sra_epi32(q, libdivide_u32_to_m128i(shifter)));
 }
@@ -1718,40 +3444,164 @@ __m128i libdivide_4s32_do_vector_alg4(__m128i numers, const struct libdivide_s32
     q = _mm_add_epi32(q, _mm_srli_epi32(q, 31)); // q += (q < 0)
     return q;
 }
-#elif LIBDIVIDE_USE_NEON
-int32x2_t libdivide_2s32_do_vector(int32x2_t numers, const struct libdivide_s32_t * denom) {
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_do_vector(__m256i numers, const struct libdivide_s32_t * denom) {
     uint8_t more = denom->more;
     if (more & LIBDIVIDE_S32_SHIFT_PATH) {
-        int32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
-        int32x2_t roundToZeroTweak = vdup_n_s32((1 << shifter) - 1);
-        int32x2_t q = vadd_s32(numers, vand_s32(vshr_n_s32(numers, 31), roundToZeroTweak)); //q = numer + ((numer >> 31) & roundToZeroTweak);
-        q = vshl_s32(q, vdup_n_s32(-shifter)); // q = q >> shifter
-        int32x2_t shiftMask = vdup_n_s32((int32_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
-        q = vsub_s32(veor_s32(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        uint32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+        __m256i roundToZeroTweak = _mm256_set1_epi32((int32_t)((1U << shifter) - 1));
+        __m256i q = _mm256_add_epi32(numers, _mm256_and_si256(_mm256_srai_epi32(numers, 31), roundToZeroTweak)); //q = numer + ((numer >> 31) & roundToZeroTweak);
+        q = _mm256_sra_epi32(q, libdivide_u32_to_m128i(shifter)); // q = q >> shifter
+        __m256i shiftMask = _mm256_set1_epi32((int32_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
+        q = _mm256_sub_epi32(_mm256_xor_si256(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
         return q;
     }
     else {
-        int32x2_t q = libdivide_mullhi_2s32_flat_vector(numers, vdup_n_s32(denom->magic));
+        __m256i q = libdivide_mullhi_8s32_flat_vector(numers, _mm256_set1_epi32(denom->magic));
         if (more & LIBDIVIDE_ADD_MARKER) {
-            int32x2_t sign = vdup_n_s32((int32_t)(int8_t)more >> 7); //must be arithmetic shift
-            q = vadd_s32(q, vsub_s32(veor_s32(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+            __m256i sign = _mm256_set1_epi32((int32_t)(int8_t)more >> 7); //must be arithmetic shift
+            q = _mm256_add_epi32(q, _mm256_sub_epi32(_mm256_xor_si256(numers, sign), sign)); // q += ((numer ^ sign) - sign);
         }
-        q = vshl_s32(q, vdup_n_s32(-(more & LIBDIVIDE_32_SHIFT_MASK))); //q >>= shift
-        q = vadd_s32(q, vreinterpret_s32_u32(vshr_n_u32(vreinterpret_u32_s32(q), 31))); // q += (q < 0)
+        q = _mm256_sra_epi32(q, libdivide_u32_to_m128i(more & LIBDIVIDE_32_SHIFT_MASK)); //q >>= shift
+        q = _mm256_add_epi32(q, _mm256_srli_epi32(q, 31)); // q += (q < 0)
         return q;
     }
 }
-int32x4_t libdivide_4s32_do_vector(int32x4_t numers, const struct libdivide_s32_t * denom) {
-    uint8_t more = denom->more;
-    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
-        int32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
-        int32x4_t roundToZeroTweak = vdupq_n_s32((1 << shifter) - 1);
-        int32x4_t q = vaddq_s32(numers, vandq_s32(vshrq_n_s32(numers, 31), roundToZeroTweak)); //q = numer + ((numer >> 31) & roundToZeroTweak);
-        q = vshlq_s32(q, vdupq_n_s32(-shifter)); // q = q >> shifter
-        int32x4_t shiftMask = vdupq_n_s32((int32_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
-        q = vsubq_s32(veorq_s32(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
-        return q;
-    }
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_do_vector_alg0(__m256i numers, const struct libdivide_s32_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    __m256i roundToZeroTweak = _mm256_set1_epi32((int32_t)((1U << shifter) - 1));
+    __m256i q = _mm256_add_epi32(numers, _mm256_and_si256(_mm256_srai_epi32(numers, 31), roundToZeroTweak));
+    return _mm256_sra_epi32(q, libdivide_u32_to_m128i(shifter));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_do_vector_alg1(__m256i numers, const struct libdivide_s32_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    __m256i roundToZeroTweak = _mm256_set1_epi32((int32_t)((1U << shifter) - 1));
+    __m256i q = _mm256_add_epi32(numers, _mm256_and_si256(_mm256_srai_epi32(numers, 31), roundToZeroTweak));
+    return _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_sra_epi32(q, libdivide_u32_to_m128i(shifter)));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_do_vector_alg2(__m256i numers, const struct libdivide_s32_t *denom) {
+    __m256i q = libdivide_mullhi_8s32_flat_vector(numers, _mm256_set1_epi32(denom->magic));
+    q = _mm256_add_epi32(q, numers);
+    q = _mm256_sra_epi32(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_32_SHIFT_MASK));
+    q = _mm256_add_epi32(q, _mm256_srli_epi32(q, 31));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_do_vector_alg3(__m256i numers, const struct libdivide_s32_t *denom) {
+    __m256i q = libdivide_mullhi_8s32_flat_vector(numers, _mm256_set1_epi32(denom->magic));
+    q = _mm256_sub_epi32(q, numers);
+    q = _mm256_sra_epi32(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_32_SHIFT_MASK));
+    q = _mm256_add_epi32(q, _mm256_srli_epi32(q, 31));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_do_vector_alg4(__m256i numers, const struct libdivide_s32_t *denom) {
+    __m256i q = libdivide_mullhi_8s32_flat_vector(numers, _mm256_set1_epi32(denom->magic));
+    q = _mm256_sra_epi32(q, libdivide_u32_to_m128i(denom->more)); //q >>= shift
+    q = _mm256_add_epi32(q, _mm256_srli_epi32(q, 31)); // q += (q < 0)
+    return q;
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_do_vector(__m512i numers, const struct libdivide_s32_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        uint32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+        __m512i roundToZeroTweak = _mm512_set1_epi32((int32_t)((1U << shifter) - 1));
+        __m512i q = _mm512_add_epi32(numers, _mm512_and_si512(_mm512_srai_epi32(numers, 31), roundToZeroTweak)); //q = numer + ((numer >> 31) & roundToZeroTweak);
+        q = _mm512_sra_epi32(q, libdivide_u32_to_m128i(shifter)); // q = q >> shifter
+        __m512i shiftMask = _mm512_set1_epi32((int32_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
+        q = _mm512_sub_epi32(_mm512_xor_si512(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        __m512i q = libdivide_mullhi_16s32_flat_vector(numers, _mm512_set1_epi32(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            __m512i sign = _mm512_set1_epi32((int32_t)(int8_t)more >> 7); //must be arithmetic shift
+            q = _mm512_add_epi32(q, _mm512_sub_epi32(_mm512_xor_si512(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = _mm512_sra_epi32(q, libdivide_u32_to_m128i(more & LIBDIVIDE_32_SHIFT_MASK)); //q >>= shift
+        q = _mm512_add_epi32(q, _mm512_srli_epi32(q, 31)); // q += (q < 0)
+        return q;
+    }
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_do_vector_alg0(__m512i numers, const struct libdivide_s32_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    __m512i roundToZeroTweak = _mm512_set1_epi32((int32_t)((1U << shifter) - 1));
+    __m512i q = _mm512_add_epi32(numers, _mm512_and_si512(_mm512_srai_epi32(numers, 31), roundToZeroTweak));
+    return _mm512_sra_epi32(q, libdivide_u32_to_m128i(shifter));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_do_vector_alg1(__m512i numers, const struct libdivide_s32_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    __m512i roundToZeroTweak = _mm512_set1_epi32((int32_t)((1U << shifter) - 1));
+    __m512i q = _mm512_add_epi32(numers, _mm512_and_si512(_mm512_srai_epi32(numers, 31), roundToZeroTweak));
+    return _mm512_sub_epi32(_mm512_setzero_si512(), _mm512_sra_epi32(q, libdivide_u32_to_m128i(shifter)));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_do_vector_alg2(__m512i numers, const struct libdivide_s32_t *denom) {
+    __m512i q = libdivide_mullhi_16s32_flat_vector(numers, _mm512_set1_epi32(denom->magic));
+    q = _mm512_add_epi32(q, numers);
+    q = _mm512_sra_epi32(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_32_SHIFT_MASK));
+    q = _mm512_add_epi32(q, _mm512_srli_epi32(q, 31));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_do_vector_alg3(__m512i numers, const struct libdivide_s32_t *denom) {
+    __m512i q = libdivide_mullhi_16s32_flat_vector(numers, _mm512_set1_epi32(denom->magic));
+    q = _mm512_sub_epi32(q, numers);
+    q = _mm512_sra_epi32(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_32_SHIFT_MASK));
+    q = _mm512_add_epi32(q, _mm512_srli_epi32(q, 31));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_do_vector_alg4(__m512i numers, const struct libdivide_s32_t *denom) {
+    __m512i q = libdivide_mullhi_16s32_flat_vector(numers, _mm512_set1_epi32(denom->magic));
+    q = _mm512_sra_epi32(q, libdivide_u32_to_m128i(denom->more)); //q >>= shift
+    q = _mm512_add_epi32(q, _mm512_srli_epi32(q, 31)); // q += (q < 0)
+    return q;
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+int32x2_t libdivide_2s32_do_vector(int32x2_t numers, const struct libdivide_s32_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        int32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+        int32x2_t roundToZeroTweak = vdup_n_s32((int32_t)((1U << shifter) - 1));
+        int32x2_t q = vadd_s32(numers, vand_s32(vshr_n_s32(numers, 31), roundToZeroTweak)); //q = numer + ((numer >> 31) & roundToZeroTweak);
+        q = vshl_s32(q, vdup_n_s32(-shifter)); // q = q >> shifter
+        int32x2_t shiftMask = vdup_n_s32((int32_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
+        q = vsub_s32(veor_s32(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        int32x2_t q = libdivide_mullhi_2s32_flat_vector(numers, vdup_n_s32(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int32x2_t sign = vdup_n_s32((int32_t)(int8_t)more >> 7); //must be arithmetic shift
+            q = vadd_s32(q, vsub_s32(veor_s32(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = vshl_s32(q, vdup_n_s32(-(more & LIBDIVIDE_32_SHIFT_MASK))); //q >>= shift
+        q = vadd_s32(q, vreinterpret_s32_u32(vshr_n_u32(vreinterpret_u32_s32(q), 31))); // q += (q < 0)
+        return q;
+    }
+}
+int32x4_t libdivide_4s32_do_vector(int32x4_t numers, const struct libdivide_s32_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        int32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+        int32x4_t roundToZeroTweak = vdupq_n_s32((int32_t)((1U << shifter) - 1));
+        int32x4_t q = vaddq_s32(numers, vandq_s32(vshrq_n_s32(numers, 31), roundToZeroTweak)); //q = numer + ((numer >> 31) & roundToZeroTweak);
+        q = vshlq_s32(q, vdupq_n_s32(-shifter)); // q = q >> shifter
+        int32x4_t shiftMask = vdupq_n_s32((int32_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
+        q = vsubq_s32(veorq_s32(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
     else {
         int32x4_t q = libdivide_mullhi_4s32_flat_vector(numers, vdupq_n_s32(denom->magic));
         if (more & LIBDIVIDE_ADD_MARKER) {
@@ -1768,7 +3618,7 @@ int32x4x2_t libdivide_8s32_do_vector(int32x4x2_t numers, const struct libdivide_
     uint8_t more = denom->more;
     if (more & LIBDIVIDE_S32_SHIFT_PATH) {
         int32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
-        int32x4_t roundToZeroTweak = vdupq_n_s32((1 << shifter) - 1);
+        int32x4_t roundToZeroTweak = vdupq_n_s32((int32_t)((1U << shifter) - 1));
         r.val[0] = vaddq_s32(numers.val[0], vandq_s32(vshrq_n_s32(numers.val[0], 31), roundToZeroTweak)); //q = numer + ((numer >> 31) & roundToZeroTweak);
         r.val[1] = vaddq_s32(numers.val[1], vandq_s32(vshrq_n_s32(numers.val[1], 31), roundToZeroTweak)); //q = numer + ((numer >> 31) & roundToZeroTweak);
         int32x4_t shift = vdupq_n_s32(-shifter);
@@ -1798,13 +3648,13 @@ int32x4x2_t libdivide_8s32_do_vector(int32x4x2_t numers, const struct libdivide_
 
 int32x2_t libdivide_2s32_do_vector_alg0(int32x2_t numers, const struct libdivide_s32_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32x2_t roundToZeroTweak = vdup_n_s32((1 << shifter) - 1);
+    int32x2_t roundToZeroTweak = vdup_n_s32((int32_t)((1U << shifter) - 1));
     int32x2_t q = vadd_s32(numers, vand_s32(vshr_n_s32(numers, 31), roundToZeroTweak));
     return vshl_s32(q, vdup_n_s32(-shifter));
 }
 int32x4_t libdivide_4s32_do_vector_alg0(int32x4_t numers, const struct libdivide_s32_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32x4_t roundToZeroTweak = vdupq_n_s32((1 << shifter) - 1);
+    int32x4_t roundToZeroTweak = vdupq_n_s32((int32_t)((1U << shifter) - 1));
     int32x4_t q = vaddq_s32(numers, vandq_s32(vshrq_n_s32(numers, 31), roundToZeroTweak));
     return vshlq_s32(q, vdupq_n_s32(-shifter));
 }
@@ -1817,13 +3667,13 @@ int32x4x2_t libdivide_8s32_do_vector_alg0(int32x4x2_t numers, const struct libdi
 
 int32x2_t libdivide_2s32_do_vector_alg1(int32x2_t numers, const struct libdivide_s32_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32x2_t roundToZeroTweak = vdup_n_s32((1 << shifter) - 1);
+    int32x2_t roundToZeroTweak = vdup_n_s32((int32_t)((1U << shifter) - 1));
     int32x2_t q = vadd_s32(numers, vand_s32(vshr_n_s32(numers, 31), roundToZeroTweak));
     return vneg_s32(vshl_s32(q, vdup_n_s32(-shifter)));
 }
 int32x4_t libdivide_4s32_do_vector_alg1(int32x4_t numers, const struct libdivide_s32_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32x4_t roundToZeroTweak = vdupq_n_s32((1 << shifter) - 1);
+    int32x4_t roundToZeroTweak = vdupq_n_s32((int32_t)((1U << shifter) - 1));
     int32x4_t q = vaddq_s32(numers, vandq_s32(vshrq_n_s32(numers, 31), roundToZeroTweak));
     return vnegq_s32(vshlq_s32(q, vdupq_n_s32(-shifter)));
 }
@@ -1925,38 +3775,38 @@ libdivide_8s32_t libdivide_8s32_do_vector(libdivide_8s32_t numers, const struct
 
 libdivide_2s32_t libdivide_2s32_do_vector_alg0(libdivide_2s32_t numers, const struct libdivide_s32_t *denom) {
     uint8_t s = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32_t roundToZeroTweak = (1 << s) - 1;
+    int32_t roundToZeroTweak = (int32_t)((1U << s) - 1);
     libdivide_2s32_t q = numers + ((numers >> (libdivide_2s32_t) { 31, 31 }) & (libdivide_2s32_t) { roundToZeroTweak, roundToZeroTweak });
     return q >> (libdivide_2s32_t) { s, s };
 }
 libdivide_4s32_t libdivide_4s32_do_vector_alg0(libdivide_4s32_t numers, const struct libdivide_s32_t *denom) {
     uint8_t s = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32_t roundToZeroTweak = (1 << s) - 1;
+    int32_t roundToZeroTweak = (int32_t)((1U << s) - 1);
     libdivide_4s32_t q = numers + ((numers >> (libdivide_4s32_t) { 31, 31, 31, 31 }) & (libdivide_4s32_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
     return q >> (libdivide_4s32_t) { s, s, s, s };
 }
 libdivide_8s32_t libdivide_8s32_do_vector_alg0(libdivide_8s32_t numers, const struct libdivide_s32_t *denom) {
     uint8_t s = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32_t roundToZeroTweak = (1 << s) - 1;
+    int32_t roundToZeroTweak = (int32_t)((1U << s) - 1);
     libdivide_8s32_t q = numers + ((numers >> (libdivide_8s32_t) { 31, 31, 31, 31, 31, 31, 31, 31 }) & (libdivide_8s32_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
     return q >> (libdivide_8s32_t) { s, s, s, s, s, s, s, s };
 }
 
 libdivide_2s32_t libdivide_2s32_do_vector_alg1(libdivide_2s32_t numers, const struct libdivide_s32_t *denom) {
     uint8_t s = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32_t roundToZeroTweak = (1 << s) - 1;
+    int32_t roundToZeroTweak = (int32_t)((1U << s) - 1);
     libdivide_2s32_t q = numers + ((numers >> (libdivide_2s32_t) { 31, 31 }) & (libdivide_2s32_t) { roundToZeroTweak, roundToZeroTweak });
     return -(q >> (libdivide_2u32_t) { s, s });
 }
 libdivide_4s32_t libdivide_4s32_do_vector_alg1(libdivide_4s32_t numers, const struct libdivide_s32_t *denom) {
     uint8_t s = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32_t roundToZeroTweak = (1 << s) - 1;
+    int32_t roundToZeroTweak = (int32_t)((1U << s) - 1);
     libdivide_4s32_t q = numers + ((numers >> (libdivide_4s32_t) { 31, 31, 31, 31 }) & (libdivide_4s32_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
     return -(q >> (libdivide_4u32_t) { s, s, s, s });
 }
 libdivide_8s32_t libdivide_8s32_do_vector_alg1(libdivide_8s32_t numers, const struct libdivide_s32_t *denom) {
     uint8_t s = denom->more & LIBDIVIDE_32_SHIFT_MASK;
-    int32_t roundToZeroTweak = (1 << s) - 1;
+    int32_t roundToZeroTweak = (int32_t)((1U << s) - 1);
     libdivide_8s32_t q = numers + ((numers >> (libdivide_8s32_t) { 31, 31, 31, 31, 31, 31, 31, 31 }) & (libdivide_8s32_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
     return -(q >> (libdivide_8u32_t) { s, s, s, s, s, s, s, s });
 }
@@ -2038,6 +3888,7 @@ libdivide_8s32_t libdivide_8s32_do_vector_alg4(libdivide_8s32_t numers, const st
 
 struct libdivide_s64_t libdivide_s64_gen(int64_t d) {
     struct libdivide_s64_t result;
+    result.divisor = d;
 
     /* If d is a power of 2, or negative a power of 2, we have to use a shift.  This is especially important because the magic algorithm fails for -1.  To check if d is a power of 2 or its inverse, it suffices to check whether its absolute value has exactly one bit set.  This works even for INT_MIN, because abs(INT_MIN) == INT_MIN, and INT_MIN has one bit set and is a power of 2.  */
     const uint64_t absD = (uint64_t)(d < 0 ? -d : d); //gcc optimizes this to the fast abs trick
@@ -2051,7 +3902,7 @@ struct libdivide_s64_t libdivide_s64_gen(int64_t d) {
         //the dividend here is 2**(floor_log_2_d + 63), so the low 64 bit word is 0 and the high word is floor_log_2_d - 1
         uint8_t more;
         uint64_t rem, proposed_m;
-        proposed_m = libdivide_128_div_64_to_64(1ULL << (floor_log_2_d - 1), 0, absD, &rem);
+        proposed_m = libdivide_pow2_div_64_to_64(floor_log_2_d - 1, absD, &rem);
         const uint64_t e = absD - rem;
 
         /* We are going to start with a power of floor_log_2_d - 1.  This works if works if e < 2**floor_log_2_d. */
@@ -2078,7 +3929,7 @@ int64_t libdivide_s64_do(int64_t numer, const struct libdivide_s64_t *denom) {
     int64_t magic = denom->magic;
     if (magic == 0) { //shift path
         uint32_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
-        int64_t q = numer + ((numer >> 63) & ((1LL << shifter) - 1));
+        int64_t q = numer + ((numer >> 63) & ((int64_t)((1ULL << shifter) - 1)));
         q = q >> shifter;
         int64_t shiftMask = (int8_t)more >> 7; //must be arithmetic shift and then sign-extend
         q = (q ^ shiftMask) - shiftMask;
@@ -2107,14 +3958,14 @@ int libdivide_s64_get_algorithm(const struct libdivide_s64_t *denom) {
 
 int64_t libdivide_s64_do_alg0(int64_t numer, const struct libdivide_s64_t *denom) {
     uint32_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    int64_t q = numer + ((numer >> 63) & ((1LL << shifter) - 1));
+    int64_t q = numer + ((numer >> 63) & ((int64_t)((1ULL << shifter) - 1)));
     return q >> shifter;
 }
 
 int64_t libdivide_s64_do_alg1(int64_t numer, const struct libdivide_s64_t *denom) {
     //denom->shifter != -1 && demo->shiftMask != 0
     uint32_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    int64_t q = numer + ((numer >> 63) & ((1LL << shifter) - 1));
+    int64_t q = numer + ((numer >> 63) & ((int64_t)((1ULL << shifter) - 1)));
     return - (q >> shifter);
 }
 
@@ -2148,7 +3999,7 @@ __m128i libdivide_2s64_do_vector(__m128i numers, const struct libdivide_s64_t *
     int64_t magic = denom->magic;
     if (magic == 0) { //shift path
         uint32_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
-        __m128i roundToZeroTweak = libdivide__u64_to_m128((1LL << shifter) - 1);
+        __m128i roundToZeroTweak = libdivide__u64_to_m128((int64_t)((1ULL << shifter) - 1));
         __m128i q = _mm_add_epi64(numers, _mm_and_si128(libdivide_s64_signbits(numers), roundToZeroTweak)); //q = numer + ((numer >> 63) & roundToZeroTweak);
         q = libdivide_s64_shift_right_vector(q, shifter); // q = q >> shifter
         __m128i shiftMask = _mm_set1_epi32((int32_t)((int8_t)more >> 7));
@@ -2169,7 +4020,7 @@ __m128i libdivide_2s64_do_vector(__m128i numers, const struct libdivide_s64_t *
 
 __m128i libdivide_2s64_do_vector_alg0(__m128i numers, const struct libdivide_s64_t *denom) {
     uint32_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    __m128i roundToZeroTweak = libdivide__u64_to_m128((1LL << shifter) - 1);
+    __m128i roundToZeroTweak = libdivide__u64_to_m128((int64_t)((1ULL << shifter) - 1));
     __m128i q = _mm_add_epi64(numers, _mm_and_si128(libdivide_s64_signbits(numers), roundToZeroTweak));
     q = libdivide_s64_shift_right_vector(q, shifter);
     return q;
@@ -2177,7 +4028,7 @@ __m128i libdivide_2s64_do_vector_alg0(__m128i numers, const struct libdivide_s64
 
 __m128i libdivide_2s64_do_vector_alg1(__m128i numers, const struct libdivide_s64_t *denom) {
     uint32_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    __m128i roundToZeroTweak = libdivide__u64_to_m128((1LL << shifter) - 1);
+    __m128i roundToZeroTweak = libdivide__u64_to_m128((int64_t)((1ULL << shifter) - 1));
     __m128i q = _mm_add_epi64(numers, _mm_and_si128(libdivide_s64_signbits(numers), roundToZeroTweak));
     q = libdivide_s64_shift_right_vector(q, shifter);
     return _mm_sub_epi64(_mm_setzero_si128(), q);
@@ -2205,13 +4056,143 @@ __m128i libdivide_2s64_do_vector_alg4(__m128i numers, const struct libdivide_s64
     q = _mm_add_epi64(q, _mm_srli_epi64(q, 63));
     return q;
 }
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_do_vector(__m256i numers, const struct libdivide_s64_t * denom) {
+    uint8_t more = denom->more;
+    int64_t magic = denom->magic;
+    if (magic == 0) { //shift path
+        uint32_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
+        __m256i roundToZeroTweak = libdivide__u64_to_m256i((int64_t)((1ULL << shifter) - 1));
+        __m256i q = _mm256_add_epi64(numers, _mm256_and_si256(libdivide_4s64_signbits(numers), roundToZeroTweak)); //q = numer + ((numer >> 63) & roundToZeroTweak);
+        q = libdivide_4s64_shift_right_vector(q, shifter); // q = q >> shifter
+        __m256i shiftMask = _mm256_set1_epi32((int32_t)((int8_t)more >> 7));
+        q = _mm256_sub_epi64(_mm256_xor_si256(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        __m256i q = libdivide_mullhi_4s64_flat_vector(numers, libdivide__u64_to_m256i(magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            __m256i sign = _mm256_set1_epi32((int32_t)((int8_t)more >> 7)); //must be arithmetic shift
+            q = _mm256_add_epi64(q, _mm256_sub_epi64(_mm256_xor_si256(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = libdivide_4s64_shift_right_vector(q, more & LIBDIVIDE_64_SHIFT_MASK); //q >>= denom->mult_path.shift
+        q = _mm256_add_epi64(q, _mm256_srli_epi64(q, 63)); // q += (q < 0)
+        return q;
+    }
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_do_vector_alg0(__m256i numers, const struct libdivide_s64_t *denom) {
+    uint32_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    __m256i roundToZeroTweak = libdivide__u64_to_m256i((int64_t)((1ULL << shifter) - 1));
+    __m256i q = _mm256_add_epi64(numers, _mm256_and_si256(libdivide_4s64_signbits(numers), roundToZeroTweak));
+    q = libdivide_4s64_shift_right_vector(q, shifter);
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_do_vector_alg1(__m256i numers, const struct libdivide_s64_t *denom) {
+    uint32_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    __m256i roundToZeroTweak = libdivide__u64_to_m256i((int64_t)((1ULL << shifter) - 1));
+    __m256i q = _mm256_add_epi64(numers, _mm256_and_si256(libdivide_4s64_signbits(numers), roundToZeroTweak));
+    q = libdivide_4s64_shift_right_vector(q, shifter);
+    return _mm256_sub_epi64(_mm256_setzero_si256(), q);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_do_vector_alg2(__m256i numers, const struct libdivide_s64_t *denom) {
+    __m256i q = libdivide_mullhi_4s64_flat_vector(numers, libdivide__u64_to_m256i(denom->magic));
+    q = _mm256_add_epi64(q, numers);
+    q = libdivide_4s64_shift_right_vector(q, denom->more & LIBDIVIDE_64_SHIFT_MASK);
+    q = _mm256_add_epi64(q, _mm256_srli_epi64(q, 63)); // q += (q < 0)
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_do_vector_alg3(__m256i numers, const struct libdivide_s64_t *denom) {
+    __m256i q = libdivide_mullhi_4s64_flat_vector(numers, libdivide__u64_to_m256i(denom->magic));
+    q = _mm256_sub_epi64(q, numers);
+    q = libdivide_4s64_shift_right_vector(q, denom->more & LIBDIVIDE_64_SHIFT_MASK);
+    q = _mm256_add_epi64(q, _mm256_srli_epi64(q, 63)); // q += (q < 0)
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_do_vector_alg4(__m256i numers, const struct libdivide_s64_t *denom) {
+    __m256i q = libdivide_mullhi_4s64_flat_vector(numers, libdivide__u64_to_m256i(denom->magic));
+    q = libdivide_4s64_shift_right_vector(q, denom->more);
+    q = _mm256_add_epi64(q, _mm256_srli_epi64(q, 63));
+    return q;
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_do_vector(__m512i numers, const struct libdivide_s64_t * denom) {
+    uint8_t more = denom->more;
+    int64_t magic = denom->magic;
+    if (magic == 0) { //shift path
+        uint32_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
+        __m512i roundToZeroTweak = libdivide__u64_to_m512i((int64_t)((1ULL << shifter) - 1));
+        __m512i q = _mm512_add_epi64(numers, _mm512_and_si512(libdivide_8s64_signbits(numers), roundToZeroTweak)); //q = numer + ((numer >> 63) & roundToZeroTweak);
+        q = libdivide_8s64_shift_right_vector(q, shifter); // q = q >> shifter
+        __m512i shiftMask = _mm512_set1_epi32((int32_t)((int8_t)more >> 7));
+        q = _mm512_sub_epi64(_mm512_xor_si512(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        __m512i q = libdivide_mullhi_8s64_flat_vector(numers, libdivide__u64_to_m512i(magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            __m512i sign = _mm512_set1_epi32((int32_t)((int8_t)more >> 7)); //must be arithmetic shift
+            q = _mm512_add_epi64(q, _mm512_sub_epi64(_mm512_xor_si512(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = libdivide_8s64_shift_right_vector(q, more & LIBDIVIDE_64_SHIFT_MASK); //q >>= denom->mult_path.shift
+        q = _mm512_add_epi64(q, _mm512_srli_epi64(q, 63)); // q += (q < 0)
+        return q;
+    }
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_do_vector_alg0(__m512i numers, const struct libdivide_s64_t *denom) {
+    uint32_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    __m512i roundToZeroTweak = libdivide__u64_to_m512i((int64_t)((1ULL << shifter) - 1));
+    __m512i q = _mm512_add_epi64(numers, _mm512_and_si512(libdivide_8s64_signbits(numers), roundToZeroTweak));
+    q = libdivide_8s64_shift_right_vector(q, shifter);
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_do_vector_alg1(__m512i numers, const struct libdivide_s64_t *denom) {
+    uint32_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    __m512i roundToZeroTweak = libdivide__u64_to_m512i((int64_t)((1ULL << shifter) - 1));
+    __m512i q = _mm512_add_epi64(numers, _mm512_and_si512(libdivide_8s64_signbits(numers), roundToZeroTweak));
+    q = libdivide_8s64_shift_right_vector(q, shifter);
+    return _mm512_sub_epi64(_mm512_setzero_si512(), q);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_do_vector_alg2(__m512i numers, const struct libdivide_s64_t *denom) {
+    __m512i q = libdivide_mullhi_8s64_flat_vector(numers, libdivide__u64_to_m512i(denom->magic));
+    q = _mm512_add_epi64(q, numers);
+    q = libdivide_8s64_shift_right_vector(q, denom->more & LIBDIVIDE_64_SHIFT_MASK);
+    q = _mm512_add_epi64(q, _mm512_srli_epi64(q, 63)); // q += (q < 0)
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_do_vector_alg3(__m512i numers, const struct libdivide_s64_t *denom) {
+    __m512i q = libdivide_mullhi_8s64_flat_vector(numers, libdivide__u64_to_m512i(denom->magic));
+    q = _mm512_sub_epi64(q, numers);
+    q = libdivide_8s64_shift_right_vector(q, denom->more & LIBDIVIDE_64_SHIFT_MASK);
+    q = _mm512_add_epi64(q, _mm512_srli_epi64(q, 63)); // q += (q < 0)
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_do_vector_alg4(__m512i numers, const struct libdivide_s64_t *denom) {
+    __m512i q = libdivide_mullhi_8s64_flat_vector(numers, libdivide__u64_to_m512i(denom->magic));
+    q = libdivide_8s64_shift_right_vector(q, denom->more);
+    q = _mm512_add_epi64(q, _mm512_srli_epi64(q, 63));
+    return q;
+}
+#endif
 #elif LIBDIVIDE_USE_NEON
 int64x1_t libdivide_1s64_do_vector(int64x1_t numers, const struct libdivide_s64_t * denom) {
     uint8_t more = denom->more;
     int64_t magic = denom->magic;
     if (magic == 0) { //shift path
         uint32_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
-        int64x1_t roundToZeroTweak = vdup_n_s64((1LL << shifter) - 1);
+        int64x1_t roundToZeroTweak = vdup_n_s64((int64_t)((1ULL << shifter) - 1));
         int64x1_t q = vadd_s64(numers, vand_s64(vshr_n_s64(numers ,63), roundToZeroTweak)); //q = numer + ((numer >> 63) & roundToZeroTweak);
         q = vshl_s64(q, vdup_n_s64(-((int32_t)shifter))); // q = q >> shifter
         int64x1_t shiftMask = vdup_n_s64((int32_t)((int8_t)more >> 7));
@@ -2234,7 +4215,7 @@ int64x2_t libdivide_2s64_do_vector(int64x2_t numers, const struct libdivide_s64_
     int64_t magic = denom->magic;
     if (magic == 0) { //shift path
         uint32_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
-        int64x2_t roundToZeroTweak = vdupq_n_s64((1LL << shifter) - 1);
+        int64x2_t roundToZeroTweak = vdupq_n_s64((int64_t)((1ULL << shifter) - 1));
         int64x2_t q = vaddq_s64(numers, vandq_s64(vshrq_n_s64(numers ,63), roundToZeroTweak)); //q = numer + ((numer >> 63) & roundToZeroTweak);
         q = vshlq_s64(q, vdupq_n_s64(-((int32_t)shifter))); // q = q >> shifter
         int64x2_t shiftMask = vdupq_n_s64((int32_t)((int8_t)more >> 7));
@@ -2257,7 +4238,7 @@ int64x2x2_t libdivide_4s64_do_vector(int64x2x2_t numers, const struct libdivide_
     uint8_t more = denom->more;
     if (denom->magic == 0) { //shift path
         uint32_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
-        int64x2_t roundToZeroTweak = vdupq_n_s64((1LL << shifter) - 1);
+        int64x2_t roundToZeroTweak = vdupq_n_s64((int64_t)((1ULL << shifter) - 1));
         r.val[0] = vaddq_s64(numers.val[0], vandq_s64(vshrq_n_s64(numers.val[0],63), roundToZeroTweak)); //q = numer + ((numer >> 63) & roundToZeroTweak);
         r.val[1] = vaddq_s64(numers.val[1], vandq_s64(vshrq_n_s64(numers.val[1],63), roundToZeroTweak)); //q = numer + ((numer >> 63) & roundToZeroTweak);
         int64x2_t shift = vdupq_n_s64(-((int32_t)shifter));
@@ -2286,13 +4267,13 @@ int64x2x2_t libdivide_4s64_do_vector(int64x2x2_t numers, const struct libdivide_
 
 int64x1_t libdivide_1s64_do_vector_alg0(int64x1_t numers, const struct libdivide_s64_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    int64x1_t roundToZeroTweak = vdup_n_s64((1LL << shifter) - 1);
+    int64x1_t roundToZeroTweak = vdup_n_s64((int64_t)((1ULL << shifter) - 1));
     int64x1_t q = vadd_s64(numers, vand_s64(vshr_n_s64(numers, 63), roundToZeroTweak));
     return vshl_s64(q, vdup_n_s64(-shifter));
 }
 int64x2_t libdivide_2s64_do_vector_alg0(int64x2_t numers, const struct libdivide_s64_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    int64x2_t roundToZeroTweak = vdupq_n_s64((1LL << shifter) - 1);
+    int64x2_t roundToZeroTweak = vdupq_n_s64((int64_t)((1ULL << shifter) - 1));
     int64x2_t q = vaddq_s64(numers, vandq_s64(vshrq_n_s64(numers, 63), roundToZeroTweak));
     return vshlq_s64(q, vdupq_n_s64(-shifter));
 }
@@ -2305,13 +4286,13 @@ int64x2x2_t libdivide_4s64_do_vector_alg0(int64x2x2_t numers, const struct libdi
 
 int64x1_t libdivide_1s64_do_vector_alg1(int64x1_t numers, const struct libdivide_s64_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    int64x1_t roundToZeroTweak = vdup_n_s64((1LL << shifter) - 1);
+    int64x1_t roundToZeroTweak = vdup_n_s64((int64_t)((1ULL << shifter) - 1));
     int64x1_t q = vadd_s64(numers, vand_s64(vshr_n_s64(numers, 63), roundToZeroTweak));
     return vsub_s64(vdup_n_s64(0), vshl_s64(q, vdup_n_s64(-shifter)));
 }
 int64x2_t libdivide_2s64_do_vector_alg1(int64x2_t numers, const struct libdivide_s64_t *denom) {
     uint8_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
-    int64x2_t roundToZeroTweak = vdupq_n_s64((1LL << shifter) - 1);
+    int64x2_t roundToZeroTweak = vdupq_n_s64((int64_t)((1ULL << shifter) - 1));
     int64x2_t q = vaddq_s64(numers, vandq_s64(vshrq_n_s64(numers, 63), roundToZeroTweak));
     return vsubq_s64(vdupq_n_s64(0), vshlq_s64(q, vdupq_n_s64(-shifter)));
 }
@@ -2522,104 +4503,8319 @@ libdivide_4s64_t libdivide_4s64_do_vector_alg4(libdivide_4s64_t numers, const st
 }
 #endif
 
-/////////// C++ stuff
+/////////// UINT16
 
-#ifdef __cplusplus
+struct libdivide_u16_t libdivide_u16_gen(uint16_t d) {
+    struct libdivide_u16_t result;
+    result.divisor = d;
+    if ((d & (d - 1)) == 0) {
+        result.magic = 0;
+        result.more = libdivide__count_trailing_zeros32(d) | LIBDIVIDE_U16_SHIFT_PATH;
+    }
+    else {
+        const uint32_t floor_log_2_d = 31 - libdivide__count_leading_zeros32(d);
 
-/* The C++ template design here is a total mess.  This needs to be fixed by someone better at templates than I.  The current design is:
+        uint8_t more;
+        /* 2**(16 + floor_log_2_d) fits in 32 bits, so the 16 bit magic number needs only an ordinary division */
+        const uint32_t power = 1U << (16 + floor_log_2_d);
+        uint16_t proposed_m = (uint16_t)(power / d);
+        const uint16_t rem = (uint16_t)(power % d);
 
-- The base is a template divider_base that takes the integer type, the libdivide struct, a generating function, a get algorithm function, a do function, and either a do vector function or a dummy int.
-- The base has storage for the libdivide struct.  This is the only storage (so the C++ class should be no larger than the libdivide struct).
+        LIBDIVIDE_ASSERT(rem > 0 && rem < d);
+        const uint16_t e = d - rem;
 
-- Above that, there's divider_mid.  This is an empty struct by default, but it is specialized against our four int types.  divider_mid contains a template struct algo, that contains a typedef for a specialization of divider_base.  struct algo is specialized to take an "algorithm number," where -1 means to use the general algorithm.
+        /* This power works if e < 2**floor_log_2_d. */
+        if (e < (1U << floor_log_2_d)) {
+            more = floor_log_2_d;
+        }
+        else {
+            /* We have to use the general 17-bit algorithm, doubling the quotient and the remainder of (2**(power-1))/d as in libdivide_u32_gen */
+            proposed_m += proposed_m; //don't care about overflow here - in fact, we expect it
+            const uint16_t twice_rem = rem + rem;
+            if (twice_rem >= d || twice_rem < rem) proposed_m += 1;
+            more = floor_log_2_d | LIBDIVIDE_ADD_MARKER;
+        }
+        result.magic = 1 + proposed_m;
+        result.more = more;
+    }
+    return result;
+}
 
-- Publicly we have class divider, which inherits from divider_mid::algo.  This also take an algorithm number, which defaults to -1 (the general algorithm).
-- divider has a operator / which allows you to use a divider as the divisor in a quotient expression.
+uint16_t libdivide_u16_do(uint16_t numer, const struct libdivide_u16_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U16_SHIFT_PATH) {
+        return numer >> (more & LIBDIVIDE_16_SHIFT_MASK);
+    }
+    else {
+        uint16_t q = libdivide__mullhi_u16(denom->magic, numer);
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            uint16_t t = ((numer - q) >> 1) + q;
+            return t >> (more & LIBDIVIDE_16_SHIFT_MASK);
+        }
+        else {
+            return q >> more; //all upper bits are 0 - don't need to mask them off
+        }
+    }
+}
 
-*/
+int libdivide_u16_get_algorithm(const struct libdivide_u16_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U16_SHIFT_PATH) return 0;
+    else if (! (more & LIBDIVIDE_ADD_MARKER)) return 1;
+    else return 2;
+}
 
-namespace libdivide_internal {
+uint16_t libdivide_u16_do_alg0(uint16_t numer, const struct libdivide_u16_t *denom) {
+    return numer >> (denom->more & LIBDIVIDE_16_SHIFT_MASK);
+}
+
+uint16_t libdivide_u16_do_alg1(uint16_t numer, const struct libdivide_u16_t *denom) {
+    uint16_t q = libdivide__mullhi_u16(denom->magic, numer);
+    return q >> denom->more;
+}
+
+uint16_t libdivide_u16_do_alg2(uint16_t numer, const struct libdivide_u16_t *denom) {
+    uint16_t q = libdivide__mullhi_u16(denom->magic, numer);
+    uint16_t t = ((numer - q) >> 1) + q;
+    return t >> (denom->more & LIBDIVIDE_16_SHIFT_MASK);
+}
 
 #if LIBDIVIDE_USE_SSE2
-#define MAYBE_VECTOR64(x)  crash_divide
-#define MAYBE_VECTOR128(x) x
-#define MAYBE_VECTOR256(x) crash_divide
-#define MAYBE_VECTOR_2S32_PARAM int
-#define MAYBE_VECTOR_4S32_PARAM __m128i
-#define MAYBE_VECTOR_8S32_PARAM int
-#define MAYBE_VECTOR_1S64_PARAM int
-#define MAYBE_VECTOR_2S64_PARAM __m128i
-#define MAYBE_VECTOR_4S64_PARAM int
-#define MAYBE_VECTOR_2U32_PARAM int
-#define MAYBE_VECTOR_4U32_PARAM __m128i
-#define MAYBE_VECTOR_8U32_PARAM int
-#define MAYBE_VECTOR_1U64_PARAM int
-#define MAYBE_VECTOR_2U64_PARAM __m128i
-#define MAYBE_VECTOR_4U64_PARAM int
-#elif LIBDIVIDE_USE_NEON || LIBDIVIDE_USE_VECTOR
-#define MAYBE_VECTOR64(x)  x
-#define MAYBE_VECTOR128(x) x
-#define MAYBE_VECTOR256(x) x
-#define MAYBE_VECTOR_2S32_PARAM libdivide_2s32_t
-#define MAYBE_VECTOR_4S32_PARAM libdivide_4s32_t
-#define MAYBE_VECTOR_8S32_PARAM libdivide_8s32_t
-#define MAYBE_VECTOR_1S64_PARAM libdivide_1s64_t
-#define MAYBE_VECTOR_2S64_PARAM libdivide_2s64_t
-#define MAYBE_VECTOR_4S64_PARAM libdivide_4s64_t
-#define MAYBE_VECTOR_2U32_PARAM libdivide_2u32_t
-#define MAYBE_VECTOR_4U32_PARAM libdivide_4u32_t
-#define MAYBE_VECTOR_8U32_PARAM libdivide_8u32_t
-#define MAYBE_VECTOR_1U64_PARAM libdivide_1u64_t
-#define MAYBE_VECTOR_2U64_PARAM libdivide_2u64_t
-#define MAYBE_VECTOR_4U64_PARAM libdivide_4u64_t
-#else
-#define MAYBE_VECTOR64(x)  crash_divide
-#define MAYBE_VECTOR128(x) crash_divide
-#define MAYBE_VECTOR256(x) crash_divide
-#define MAYBE_VECTOR_2S32_PARAM int
-#define MAYBE_VECTOR_4S32_PARAM int
-#define MAYBE_VECTOR_8S32_PARAM int
-#define MAYBE_VECTOR_1S64_PARAM int
-#define MAYBE_VECTOR_2S64_PARAM int
-#define MAYBE_VECTOR_4S64_PARAM int
-#define MAYBE_VECTOR_2U32_PARAM int
-#define MAYBE_VECTOR_4U32_PARAM int
-#define MAYBE_VECTOR_8U32_PARAM int
-#define MAYBE_VECTOR_1U64_PARAM int
-#define MAYBE_VECTOR_2U64_PARAM int
-#define MAYBE_VECTOR_4U64_PARAM int
-#endif
+__m128i libdivide_8u16_do_vector(__m128i numers, const struct libdivide_u16_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U16_SHIFT_PATH) {
+        return _mm_srl_epi16(numers, libdivide_u32_to_m128i(more & LIBDIVIDE_16_SHIFT_MASK));
+    }
+    else {
+        __m128i q = _mm_mulhi_epu16(numers, _mm_set1_epi16(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            //uint16_t t = ((numer - q) >> 1) + q;
+            //return t >> denom->shift;
+            __m128i t = _mm_add_epi16(_mm_srli_epi16(_mm_sub_epi16(numers, q), 1), q);
+            return _mm_srl_epi16(t, libdivide_u32_to_m128i(more & LIBDIVIDE_16_SHIFT_MASK));
+        }
+        else {
+            //q >> denom->shift
+            return _mm_srl_epi16(q, libdivide_u32_to_m128i(more));
+        }
+    }
+}
 
-    /* Some bogus unswitch functions for unsigned types so the same (presumably templated) code can work for both signed and unsigned. */
-    template <typename T, typename U>
-    T crash_divide(T, const U*) { abort(); return *(T*)NULL; }
-    uint32_t crash_u32(uint32_t, const libdivide_u32_t*) { abort(); return *(uint32_t*)NULL; }
-    uint64_t crash_u64(uint64_t, const libdivide_u64_t*) { abort(); return *(uint64_t*)NULL; }
+__m128i libdivide_8u16_do_vector_alg0(__m128i numers, const struct libdivide_u16_t *denom) {
+    return _mm_srl_epi16(numers, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+}
 
-    template<typename IntType, typename Vec64Type, typename Vec128Type, typename Vec256Type, typename DenomType, DenomType gen_func(IntType), int get_algo(const DenomType *), IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *)>
-    class divider_base {
-    public:
-        DenomType denom;
-        divider_base(IntType d) : denom(gen_func(d)) { }
-        divider_base(const DenomType & d) : denom(d) { }
+__m128i libdivide_8u16_do_vector_alg1(__m128i numers, const struct libdivide_u16_t *denom) {
+    __m128i q = _mm_mulhi_epu16(numers, _mm_set1_epi16(denom->magic));
+    return _mm_srl_epi16(q, libdivide_u32_to_m128i(denom->more));
+}
+
+__m128i libdivide_8u16_do_vector_alg2(__m128i numers, const struct libdivide_u16_t *denom) {
+    __m128i q = _mm_mulhi_epu16(numers, _mm_set1_epi16(denom->magic));
+    __m128i t = _mm_add_epi16(_mm_srli_epi16(_mm_sub_epi16(numers, q), 1), q);
+    return _mm_srl_epi16(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+}
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_16u16_do_vector(__m256i numers, const struct libdivide_u16_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U16_SHIFT_PATH) {
+        return _mm256_srl_epi16(numers, libdivide_u32_to_m128i(more & LIBDIVIDE_16_SHIFT_MASK));
+    }
+    else {
+        __m256i q = _mm256_mulhi_epu16(numers, _mm256_set1_epi16(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            //uint16_t t = ((numer - q) >> 1) + q;
+            //return t >> denom->shift;
+            __m256i t = _mm256_add_epi16(_mm256_srli_epi16(_mm256_sub_epi16(numers, q), 1), q);
+            return _mm256_srl_epi16(t, libdivide_u32_to_m128i(more & LIBDIVIDE_16_SHIFT_MASK));
+        }
+        else {
+            //q >> denom->shift
+            return _mm256_srl_epi16(q, libdivide_u32_to_m128i(more));
+        }
+    }
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_16u16_do_vector_alg0(__m256i numers, const struct libdivide_u16_t *denom) {
+    return _mm256_srl_epi16(numers, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_16u16_do_vector_alg1(__m256i numers, const struct libdivide_u16_t *denom) {
+    __m256i q = _mm256_mulhi_epu16(numers, _mm256_set1_epi16(denom->magic));
+    return _mm256_srl_epi16(q, libdivide_u32_to_m128i(denom->more));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_16u16_do_vector_alg2(__m256i numers, const struct libdivide_u16_t *denom) {
+    __m256i q = _mm256_mulhi_epu16(numers, _mm256_set1_epi16(denom->magic));
+    __m256i t = _mm256_add_epi16(_mm256_srli_epi16(_mm256_sub_epi16(numers, q), 1), q);
+    return _mm256_srl_epi16(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_32u16_do_vector(__m512i numers, const struct libdivide_u16_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U16_SHIFT_PATH) {
+        return _mm512_srl_epi16(numers, libdivide_u32_to_m128i(more & LIBDIVIDE_16_SHIFT_MASK));
+    }
+    else {
+        __m512i q = _mm512_mulhi_epu16(numers, _mm512_set1_epi16(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            //uint16_t t = ((numer - q) >> 1) + q;
+            //return t >> denom->shift;
+            __m512i t = _mm512_add_epi16(_mm512_srli_epi16(_mm512_sub_epi16(numers, q), 1), q);
+            return _mm512_srl_epi16(t, libdivide_u32_to_m128i(more & LIBDIVIDE_16_SHIFT_MASK));
+        }
+        else {
+            //q >> denom->shift
+            return _mm512_srl_epi16(q, libdivide_u32_to_m128i(more));
+        }
+    }
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_32u16_do_vector_alg0(__m512i numers, const struct libdivide_u16_t *denom) {
+    return _mm512_srl_epi16(numers, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_32u16_do_vector_alg1(__m512i numers, const struct libdivide_u16_t *denom) {
+    __m512i q = _mm512_mulhi_epu16(numers, _mm512_set1_epi16(denom->magic));
+    return _mm512_srl_epi16(q, libdivide_u32_to_m128i(denom->more));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_32u16_do_vector_alg2(__m512i numers, const struct libdivide_u16_t *denom) {
+    __m512i q = _mm512_mulhi_epu16(numers, _mm512_set1_epi16(denom->magic));
+    __m512i t = _mm512_add_epi16(_mm512_srli_epi16(_mm512_sub_epi16(numers, q), 1), q);
+    return _mm512_srl_epi16(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+uint16x4_t libdivide_4u16_do_vector(uint16x4_t numers, const struct libdivide_u16_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U16_SHIFT_PATH) {
+        return vshl_u16(numers, vdup_n_s16(-(more & LIBDIVIDE_16_SHIFT_MASK)));
+    }
+    else {
+        uint16x4_t q = libdivide_mullhi_4u16_flat_vector(numers, vdup_n_u16(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            uint16x4_t t = vadd_u16(vhsub_u16(numers, q), q);
+            return vshl_u16(t, vdup_n_s16(-(more & LIBDIVIDE_16_SHIFT_MASK)));
+        }
+        else {
+            return vshl_u16(q, vdup_n_s16(-more));
+        }
+    }
+}
+uint16x8_t libdivide_8u16_do_vector(uint16x8_t numers, const struct libdivide_u16_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U16_SHIFT_PATH) {
+        return vshlq_u16(numers, vdupq_n_s16(-(more & LIBDIVIDE_16_SHIFT_MASK)));
+    }
+    else {
+        uint16x8_t q = libdivide_mullhi_8u16_flat_vector(numers, vdupq_n_u16(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            uint16x8_t t = vaddq_u16(vhsubq_u16(numers, q), q);
+            return vshlq_u16(t, vdupq_n_s16(-(more & LIBDIVIDE_16_SHIFT_MASK)));
+        }
+        else {
+            return vshlq_u16(q, vdupq_n_s16(-more));
+        }
+    }
+}
+uint16x8x2_t libdivide_16u16_do_vector(uint16x8x2_t numers, const struct libdivide_u16_t * denom) {
+    uint16x8x2_t r;
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U16_SHIFT_PATH) {
+        int16x8_t shift = vdupq_n_s16(-(more & LIBDIVIDE_16_SHIFT_MASK));
+        r.val[0] = vshlq_u16(numers.val[0], shift);
+        r.val[1] = vshlq_u16(numers.val[1], shift);
+    }
+    else {
+        uint16x8_t magic = vdupq_n_u16(denom->magic);
+        r.val[0] = libdivide_mullhi_8u16_flat_vector(numers.val[0], magic);
+        r.val[1] = libdivide_mullhi_8u16_flat_vector(numers.val[1], magic);
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int16x8_t shift = vdupq_n_s16(-(more & LIBDIVIDE_16_SHIFT_MASK));
+            r.val[0] = vaddq_u16(vhsubq_u16(numers.val[0], r.val[0]), r.val[0]);
+            r.val[1] = vaddq_u16(vhsubq_u16(numers.val[1], r.val[1]), r.val[1]);
+            r.val[0] = vshlq_u16(r.val[0], shift);
+            r.val[1] = vshlq_u16(r.val[1], shift);
+        }
+        else {
+            int16x8_t shift = vdupq_n_s16(-more);
+            r.val[0] = vshlq_u16(r.val[0], shift);
+            r.val[1] = vshlq_u16(r.val[1], shift);
+        }
+    }
+    return r;
+}
+
+uint16x4_t libdivide_4u16_do_vector_alg0(uint16x4_t numers, const struct libdivide_u16_t *denom) {
+    return vshl_u16(numers, vdup_n_s16(-(denom->more & LIBDIVIDE_16_SHIFT_MASK)));
+}
+uint16x8_t libdivide_8u16_do_vector_alg0(uint16x8_t numers, const struct libdivide_u16_t *denom) {
+    return vshlq_u16(numers, vdupq_n_s16(-(denom->more & LIBDIVIDE_16_SHIFT_MASK)));
+}
+uint16x8x2_t libdivide_16u16_do_vector_alg0(uint16x8x2_t numers, const struct libdivide_u16_t *denom) {
+    uint16x8x2_t r;
+    r.val[0] = libdivide_8u16_do_vector_alg0(numers.val[0], denom);
+    r.val[1] = libdivide_8u16_do_vector_alg0(numers.val[1], denom);
+    return r;
+}
+
+uint16x4_t libdivide_4u16_do_vector_alg1(uint16x4_t numers, const struct libdivide_u16_t *denom) {
+    uint16x4_t q = libdivide_mullhi_4u16_flat_vector(numers, vdup_n_u16(denom->magic));
+    return vshl_u16(q, vdup_n_s16(-denom->more));
+}
+uint16x8_t libdivide_8u16_do_vector_alg1(uint16x8_t numers, const struct libdivide_u16_t *denom) {
+    uint16x8_t q = libdivide_mullhi_8u16_flat_vector(numers, vdupq_n_u16(denom->magic));
+    return vshlq_u16(q, vdupq_n_s16(-denom->more));
+}
+uint16x8x2_t libdivide_16u16_do_vector_alg1(uint16x8x2_t numers, const struct libdivide_u16_t *denom) {
+    uint16x8x2_t r;
+    r.val[0] = libdivide_8u16_do_vector_alg1(numers.val[0], denom);
+    r.val[1] = libdivide_8u16_do_vector_alg1(numers.val[1], denom);
+    return r;
+}
+
+uint16x4_t libdivide_4u16_do_vector_alg2(uint16x4_t numers, const struct libdivide_u16_t *denom) {
+    uint16x4_t q = libdivide_mullhi_4u16_flat_vector(numers, vdup_n_u16(denom->magic));
+    uint16x4_t t = vadd_u16(vhsub_u16(numers, q), q);
+    return vshl_u16(t, vdup_n_s16(-(denom->more & LIBDIVIDE_16_SHIFT_MASK)));
+}
+uint16x8_t libdivide_8u16_do_vector_alg2(uint16x8_t numers, const struct libdivide_u16_t *denom) {
+    uint16x8_t q = libdivide_mullhi_8u16_flat_vector(numers, vdupq_n_u16(denom->magic));
+    uint16x8_t t = vaddq_u16(vhsubq_u16(numers, q), q);
+    return vshlq_u16(t, vdupq_n_s16(-(denom->more & LIBDIVIDE_16_SHIFT_MASK)));
+}
+uint16x8x2_t libdivide_16u16_do_vector_alg2(uint16x8x2_t numers, const struct libdivide_u16_t *denom) {
+    uint16x8x2_t r;
+    r.val[0] = libdivide_8u16_do_vector_alg2(numers.val[0], denom);
+    r.val[1] = libdivide_8u16_do_vector_alg2(numers.val[1], denom);
+    return r;
+}
+#elif LIBDIVIDE_USE_VECTOR
+libdivide_4u16_t libdivide_4u16_do_vector(libdivide_4u16_t numers, const struct libdivide_u16_t *denom) {
+    switch (libdivide_u16_get_algorithm(denom)) {
+    case 0:  return libdivide_4u16_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_4u16_do_vector_alg1(numers, denom);
+    default: return libdivide_4u16_do_vector_alg2(numers, denom);
+    }
+}
+libdivide_8u16_t libdivide_8u16_do_vector(libdivide_8u16_t numers, const struct libdivide_u16_t *denom) {
+    switch (libdivide_u16_get_algorithm(denom)) {
+    case 0:  return libdivide_8u16_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_8u16_do_vector_alg1(numers, denom);
+    default: return libdivide_8u16_do_vector_alg2(numers, denom);
+    }
+}
+libdivide_16u16_t libdivide_16u16_do_vector(libdivide_16u16_t numers, const struct libdivide_u16_t *denom) {
+    switch (libdivide_u16_get_algorithm(denom)) {
+    case 0:  return libdivide_16u16_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_16u16_do_vector_alg1(numers, denom);
+    default: return libdivide_16u16_do_vector_alg2(numers, denom);
+    }
+}
+
+libdivide_4u16_t libdivide_4u16_do_vector_alg0(libdivide_4u16_t numers, const struct libdivide_u16_t *denom) {
+    uint16_t s = (denom->more & LIBDIVIDE_16_SHIFT_MASK);
+    return numers >> (libdivide_4u16_t) { s, s, s, s };
+}
+libdivide_8u16_t libdivide_8u16_do_vector_alg0(libdivide_8u16_t numers, const struct libdivide_u16_t *denom) {
+    uint16_t s = (denom->more & LIBDIVIDE_16_SHIFT_MASK);
+    return numers >> (libdivide_8u16_t) { s, s, s, s, s, s, s, s };
+}
+libdivide_16u16_t libdivide_16u16_do_vector_alg0(libdivide_16u16_t numers, const struct libdivide_u16_t *denom) {
+    uint16_t s = (denom->more & LIBDIVIDE_16_SHIFT_MASK);
+    return numers >> (libdivide_16u16_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+
+libdivide_4u16_t libdivide_4u16_do_vector_alg1(libdivide_4u16_t numers, const struct libdivide_u16_t *denom) {
+    uint16_t s = denom->more;
+    uint16_t m = denom->magic;
+    libdivide_4u16_t q = libdivide_mullhi_4u16_flat_vector( numers, (libdivide_4u16_t) { m, m, m, m } );
+    return q >> (libdivide_4u16_t) { s, s, s, s };
+}
+libdivide_8u16_t libdivide_8u16_do_vector_alg1(libdivide_8u16_t numers, const struct libdivide_u16_t *denom) {
+    uint16_t s = denom->more;
+    uint16_t m = denom->magic;
+    libdivide_8u16_t q = libdivide_mullhi_8u16_flat_vector( numers, (libdivide_8u16_t) { m, m, m, m, m, m, m, m } );
+    return q >> (libdivide_8u16_t) { s, s, s, s, s, s, s, s };
+}
+libdivide_16u16_t libdivide_16u16_do_vector_alg1(libdivide_16u16_t numers, const struct libdivide_u16_t *denom) {
+    uint16_t s = denom->more;
+    uint16_t m = denom->magic;
+    libdivide_16u16_t q = libdivide_mullhi_16u16_flat_vector( numers, (libdivide_16u16_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m } );
+    return q >> (libdivide_16u16_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+
+libdivide_4u16_t libdivide_4u16_do_vector_alg2(libdivide_4u16_t numers, const struct libdivide_u16_t *denom) {
+    uint16_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    uint16_t m = denom->magic;
+    libdivide_4u16_t q = libdivide_mullhi_4u16_flat_vector( numers, (libdivide_4u16_t) { m, m, m, m } );
+    libdivide_4u16_t t = ( ( numers - q ) >> (libdivide_4u16_t) { 1, 1, 1, 1 } ) + q;
+    return t >> (libdivide_4u16_t) { s, s, s, s };
+}
+libdivide_8u16_t libdivide_8u16_do_vector_alg2(libdivide_8u16_t numers, const struct libdivide_u16_t *denom) {
+    uint16_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    uint16_t m = denom->magic;
+    libdivide_8u16_t q = libdivide_mullhi_8u16_flat_vector( numers, (libdivide_8u16_t) { m, m, m, m, m, m, m, m } );
+    libdivide_8u16_t t = ( ( numers - q ) >> (libdivide_8u16_t) { 1, 1, 1, 1, 1, 1, 1, 1 } ) + q;
+    return t >> (libdivide_8u16_t) { s, s, s, s, s, s, s, s };
+}
+libdivide_16u16_t libdivide_16u16_do_vector_alg2(libdivide_16u16_t numers, const struct libdivide_u16_t *denom) {
+    uint16_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    uint16_t m = denom->magic;
+    libdivide_16u16_t q = libdivide_mullhi_16u16_flat_vector( numers, (libdivide_16u16_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m } );
+    libdivide_16u16_t t = ( ( numers - q ) >> (libdivide_16u16_t) { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 } ) + q;
+    return t >> (libdivide_16u16_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+#endif
+
+/////////// SINT16
+
+struct libdivide_s16_t libdivide_s16_gen(int16_t d) {
+    struct libdivide_s16_t result;
+    result.divisor = d;
+
+    /* As in libdivide_s32_gen, powers of 2 and their negatives use a shift, which also covers -1 and INT16_MIN */
+    uint16_t absD = (uint16_t)(d < 0 ? -d : d);
+    if ((absD & (absD - 1)) == 0) {
+        result.magic = 0;
+        result.more = libdivide__count_trailing_zeros32(absD) | (d < 0 ? LIBDIVIDE_NEGATIVE_DIVISOR : 0) | LIBDIVIDE_S16_SHIFT_PATH;
+    }
+    else {
+        const uint32_t floor_log_2_d = 31 - libdivide__count_leading_zeros32(absD);
+        LIBDIVIDE_ASSERT(floor_log_2_d >= 1);
+
+        uint8_t more;
+        //the dividend here is 2**(floor_log_2_d + 15), which fits in 32 bits
+        const uint32_t power = 1U << (floor_log_2_d + 15);
+        uint16_t proposed_m = (uint16_t)(power / absD);
+        const uint16_t rem = (uint16_t)(power % absD);
+        const uint16_t e = absD - rem;
+
+        /* We are going to start with a power of floor_log_2_d - 1.  This works if e < 2**floor_log_2_d. */
+        if (e < (1U << floor_log_2_d)) {
+            /* This power works */
+            more = floor_log_2_d - 1;
+        }
+        else {
+            /* We need to go one higher.  This should not make proposed_m overflow, but it will make it negative when interpreted as an int16_t. */
+            proposed_m += proposed_m;
+            const uint16_t twice_rem = rem + rem;
+            if (twice_rem >= absD || twice_rem < rem) proposed_m += 1;
+            more = floor_log_2_d | LIBDIVIDE_ADD_MARKER | (d < 0 ? LIBDIVIDE_NEGATIVE_DIVISOR : 0); //use the general algorithm
+        }
+        proposed_m += 1;
+        result.magic = (int16_t)(d < 0 ? -proposed_m : proposed_m);
+        result.more = more;
+    }
+    return result;
+}
+
+/* The scalar functions work in 32 bits, where nothing can overflow, and only the quotient is cut back to 16 bits.  So INT16_MIN / -1 gives INT16_MIN, the same as (int16_t)(numer / denom). */
+int16_t libdivide_s16_do(int16_t numer, const struct libdivide_s16_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S16_SHIFT_PATH) {
+        uint8_t shifter = more & LIBDIVIDE_16_SHIFT_MASK;
+        int32_t q = numer + ((numer >> 15) & ((1 << shifter) - 1));
+        q = q >> shifter;
+        int32_t shiftMask = (int8_t)more >> 7; //must be arithmetic shift and then sign-extend
+        q = (q ^ shiftMask) - shiftMask;
+        return (int16_t)q;
+    }
+    else {
+        int32_t q = libdivide__mullhi_s16(denom->magic, numer);
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int32_t sign = (int8_t)more >> 7; //must be arithmetic shift and then sign extend
+            q += ((numer ^ sign) - sign);
+        }
+        q >>= more & LIBDIVIDE_16_SHIFT_MASK;
+        q += (q < 0);
+        return (int16_t)q;
+    }
+}
+
+int libdivide_s16_get_algorithm(const struct libdivide_s16_t *denom) {
+    uint8_t more = denom->more;
+    int positiveDivisor = ! (more & LIBDIVIDE_NEGATIVE_DIVISOR);
+    if (more & LIBDIVIDE_S16_SHIFT_PATH) return (positiveDivisor ? 0 : 1);
+    else if (more & LIBDIVIDE_ADD_MARKER) return (positiveDivisor ? 2 : 3);
+    else return 4;
+}
+
+int16_t libdivide_s16_do_alg0(int16_t numer, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int32_t q = numer + ((numer >> 15) & ((1 << shifter) - 1));
+    return (int16_t)(q >> shifter);
+}
+
+int16_t libdivide_s16_do_alg1(int16_t numer, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int32_t q = numer + ((numer >> 15) & ((1 << shifter) - 1));
+    return (int16_t)- (q >> shifter);
+}
+
+int16_t libdivide_s16_do_alg2(int16_t numer, const struct libdivide_s16_t *denom) {
+    int32_t q = libdivide__mullhi_s16(denom->magic, numer);
+    q += numer;
+    q >>= denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    q += (q < 0);
+    return (int16_t)q;
+}
+
+int16_t libdivide_s16_do_alg3(int16_t numer, const struct libdivide_s16_t *denom) {
+    int32_t q = libdivide__mullhi_s16(denom->magic, numer);
+    q -= numer;
+    q >>= denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    q += (q < 0);
+    return (int16_t)q;
+}
+
+int16_t libdivide_s16_do_alg4(int16_t numer, const struct libdivide_s16_t *denom) {
+    int32_t q = libdivide__mullhi_s16(denom->magic, numer);
+    q >>= denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    q += (q < 0);
+    return (int16_t)q;
+}
+
+#if LIBDIVIDE_USE_SSE2
+__m128i libdivide_8s16_do_vector(__m128i numers, const struct libdivide_s16_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S16_SHIFT_PATH) {
+        uint32_t shifter = more & LIBDIVIDE_16_SHIFT_MASK;
+        __m128i roundToZeroTweak = _mm_set1_epi16((1 << shifter) - 1);
+        __m128i q = _mm_add_epi16(numers, _mm_and_si128(_mm_srai_epi16(numers, 15), roundToZeroTweak)); //q = numer + ((numer >> 15) & roundToZeroTweak);
+        q = _mm_sra_epi16(q, libdivide_u32_to_m128i(shifter)); // q = q >> shifter
+        __m128i shiftMask = _mm_set1_epi16((int16_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
+        q = _mm_sub_epi16(_mm_xor_si128(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        __m128i q = _mm_mulhi_epi16(numers, _mm_set1_epi16(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            __m128i sign = _mm_set1_epi16((int16_t)(int8_t)more >> 7); //must be arithmetic shift
+            q = _mm_add_epi16(q, _mm_sub_epi16(_mm_xor_si128(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = _mm_sra_epi16(q, libdivide_u32_to_m128i(more & LIBDIVIDE_16_SHIFT_MASK)); //q >>= shift
+        q = _mm_add_epi16(q, _mm_srli_epi16(q, 15)); // q += (q < 0)
+        return q;
+    }
+}
+
+__m128i libdivide_8s16_do_vector_alg0(__m128i numers, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    __m128i roundToZeroTweak = _mm_set1_epi16((1 << shifter) - 1);
+    __m128i q = _mm_add_epi16(numers, _mm_and_si128(_mm_srai_epi16(numers, 15), roundToZeroTweak));
+    return _mm_sra_epi16(q, libdivide_u32_to_m128i(shifter));
+}
+
+__m128i libdivide_8s16_do_vector_alg1(__m128i numers, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    __m128i roundToZeroTweak = _mm_set1_epi16((1 << shifter) - 1);
+    __m128i q = _mm_add_epi16(numers, _mm_and_si128(_mm_srai_epi16(numers, 15), roundToZeroTweak));
+    return _mm_sub_epi16(_mm_setzero_si128(), _mm_sra_epi16(q, libdivide_u32_to_m128i(shifter)));
+}
+
+__m128i libdivide_8s16_do_vector_alg2(__m128i numers, const struct libdivide_s16_t *denom) {
+    __m128i q = _mm_mulhi_epi16(numers, _mm_set1_epi16(denom->magic));
+    q = _mm_add_epi16(q, numers);
+    q = _mm_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+    q = _mm_add_epi16(q, _mm_srli_epi16(q, 15));
+    return q;
+}
+
+__m128i libdivide_8s16_do_vector_alg3(__m128i numers, const struct libdivide_s16_t *denom) {
+    __m128i q = _mm_mulhi_epi16(numers, _mm_set1_epi16(denom->magic));
+    q = _mm_sub_epi16(q, numers);
+    q = _mm_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+    q = _mm_add_epi16(q, _mm_srli_epi16(q, 15));
+    return q;
+}
+
+__m128i libdivide_8s16_do_vector_alg4(__m128i numers, const struct libdivide_s16_t *denom) {
+    __m128i q = _mm_mulhi_epi16(numers, _mm_set1_epi16(denom->magic));
+    q = _mm_sra_epi16(q, libdivide_u32_to_m128i(denom->more)); //q >>= shift
+    q = _mm_add_epi16(q, _mm_srli_epi16(q, 15)); // q += (q < 0)
+    return q;
+}
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_16s16_do_vector(__m256i numers, const struct libdivide_s16_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S16_SHIFT_PATH) {
+        uint32_t shifter = more & LIBDIVIDE_16_SHIFT_MASK;
+        __m256i roundToZeroTweak = _mm256_set1_epi16((1 << shifter) - 1);
+        __m256i q = _mm256_add_epi16(numers, _mm256_and_si256(_mm256_srai_epi16(numers, 15), roundToZeroTweak)); //q = numer + ((numer >> 15) & roundToZeroTweak);
+        q = _mm256_sra_epi16(q, libdivide_u32_to_m128i(shifter)); // q = q >> shifter
+        __m256i shiftMask = _mm256_set1_epi16((int16_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
+        q = _mm256_sub_epi16(_mm256_xor_si256(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        __m256i q = _mm256_mulhi_epi16(numers, _mm256_set1_epi16(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            __m256i sign = _mm256_set1_epi16((int16_t)(int8_t)more >> 7); //must be arithmetic shift
+            q = _mm256_add_epi16(q, _mm256_sub_epi16(_mm256_xor_si256(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = _mm256_sra_epi16(q, libdivide_u32_to_m128i(more & LIBDIVIDE_16_SHIFT_MASK)); //q >>= shift
+        q = _mm256_add_epi16(q, _mm256_srli_epi16(q, 15)); // q += (q < 0)
+        return q;
+    }
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_16s16_do_vector_alg0(__m256i numers, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    __m256i roundToZeroTweak = _mm256_set1_epi16((1 << shifter) - 1);
+    __m256i q = _mm256_add_epi16(numers, _mm256_and_si256(_mm256_srai_epi16(numers, 15), roundToZeroTweak));
+    return _mm256_sra_epi16(q, libdivide_u32_to_m128i(shifter));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_16s16_do_vector_alg1(__m256i numers, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    __m256i roundToZeroTweak = _mm256_set1_epi16((1 << shifter) - 1);
+    __m256i q = _mm256_add_epi16(numers, _mm256_and_si256(_mm256_srai_epi16(numers, 15), roundToZeroTweak));
+    return _mm256_sub_epi16(_mm256_setzero_si256(), _mm256_sra_epi16(q, libdivide_u32_to_m128i(shifter)));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_16s16_do_vector_alg2(__m256i numers, const struct libdivide_s16_t *denom) {
+    __m256i q = _mm256_mulhi_epi16(numers, _mm256_set1_epi16(denom->magic));
+    q = _mm256_add_epi16(q, numers);
+    q = _mm256_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+    q = _mm256_add_epi16(q, _mm256_srli_epi16(q, 15));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_16s16_do_vector_alg3(__m256i numers, const struct libdivide_s16_t *denom) {
+    __m256i q = _mm256_mulhi_epi16(numers, _mm256_set1_epi16(denom->magic));
+    q = _mm256_sub_epi16(q, numers);
+    q = _mm256_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+    q = _mm256_add_epi16(q, _mm256_srli_epi16(q, 15));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_16s16_do_vector_alg4(__m256i numers, const struct libdivide_s16_t *denom) {
+    __m256i q = _mm256_mulhi_epi16(numers, _mm256_set1_epi16(denom->magic));
+    q = _mm256_sra_epi16(q, libdivide_u32_to_m128i(denom->more)); //q >>= shift
+    q = _mm256_add_epi16(q, _mm256_srli_epi16(q, 15)); // q += (q < 0)
+    return q;
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_32s16_do_vector(__m512i numers, const struct libdivide_s16_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S16_SHIFT_PATH) {
+        uint32_t shifter = more & LIBDIVIDE_16_SHIFT_MASK;
+        __m512i roundToZeroTweak = _mm512_set1_epi16((1 << shifter) - 1);
+        __m512i q = _mm512_add_epi16(numers, _mm512_and_si512(_mm512_srai_epi16(numers, 15), roundToZeroTweak)); //q = numer + ((numer >> 15) & roundToZeroTweak);
+        q = _mm512_sra_epi16(q, libdivide_u32_to_m128i(shifter)); // q = q >> shifter
+        __m512i shiftMask = _mm512_set1_epi16((int16_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
+        q = _mm512_sub_epi16(_mm512_xor_si512(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        __m512i q = _mm512_mulhi_epi16(numers, _mm512_set1_epi16(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            __m512i sign = _mm512_set1_epi16((int16_t)(int8_t)more >> 7); //must be arithmetic shift
+            q = _mm512_add_epi16(q, _mm512_sub_epi16(_mm512_xor_si512(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = _mm512_sra_epi16(q, libdivide_u32_to_m128i(more & LIBDIVIDE_16_SHIFT_MASK)); //q >>= shift
+        q = _mm512_add_epi16(q, _mm512_srli_epi16(q, 15)); // q += (q < 0)
+        return q;
+    }
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_32s16_do_vector_alg0(__m512i numers, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    __m512i roundToZeroTweak = _mm512_set1_epi16((1 << shifter) - 1);
+    __m512i q = _mm512_add_epi16(numers, _mm512_and_si512(_mm512_srai_epi16(numers, 15), roundToZeroTweak));
+    return _mm512_sra_epi16(q, libdivide_u32_to_m128i(shifter));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_32s16_do_vector_alg1(__m512i numers, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    __m512i roundToZeroTweak = _mm512_set1_epi16((1 << shifter) - 1);
+    __m512i q = _mm512_add_epi16(numers, _mm512_and_si512(_mm512_srai_epi16(numers, 15), roundToZeroTweak));
+    return _mm512_sub_epi16(_mm512_setzero_si512(), _mm512_sra_epi16(q, libdivide_u32_to_m128i(shifter)));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_32s16_do_vector_alg2(__m512i numers, const struct libdivide_s16_t *denom) {
+    __m512i q = _mm512_mulhi_epi16(numers, _mm512_set1_epi16(denom->magic));
+    q = _mm512_add_epi16(q, numers);
+    q = _mm512_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+    q = _mm512_add_epi16(q, _mm512_srli_epi16(q, 15));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_32s16_do_vector_alg3(__m512i numers, const struct libdivide_s16_t *denom) {
+    __m512i q = _mm512_mulhi_epi16(numers, _mm512_set1_epi16(denom->magic));
+    q = _mm512_sub_epi16(q, numers);
+    q = _mm512_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_16_SHIFT_MASK));
+    q = _mm512_add_epi16(q, _mm512_srli_epi16(q, 15));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_32s16_do_vector_alg4(__m512i numers, const struct libdivide_s16_t *denom) {
+    __m512i q = _mm512_mulhi_epi16(numers, _mm512_set1_epi16(denom->magic));
+    q = _mm512_sra_epi16(q, libdivide_u32_to_m128i(denom->more)); //q >>= shift
+    q = _mm512_add_epi16(q, _mm512_srli_epi16(q, 15)); // q += (q < 0)
+    return q;
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+int16x4_t libdivide_4s16_do_vector(int16x4_t numers, const struct libdivide_s16_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S16_SHIFT_PATH) {
+        int16_t shifter = more & LIBDIVIDE_16_SHIFT_MASK;
+        int16x4_t roundToZeroTweak = vdup_n_s16((1 << shifter) - 1);
+        int16x4_t q = vadd_s16(numers, vand_s16(vshr_n_s16(numers, 15), roundToZeroTweak)); //q = numer + ((numer >> 15) & roundToZeroTweak);
+        q = vshl_s16(q, vdup_n_s16(-shifter)); // q = q >> shifter
+        int16x4_t shiftMask = vdup_n_s16((int16_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
+        q = vsub_s16(veor_s16(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        int16x4_t q = libdivide_mullhi_4s16_flat_vector(numers, vdup_n_s16(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int16x4_t sign = vdup_n_s16((int16_t)(int8_t)more >> 7); //must be arithmetic shift
+            q = vadd_s16(q, vsub_s16(veor_s16(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = vshl_s16(q, vdup_n_s16(-(more & LIBDIVIDE_16_SHIFT_MASK))); //q >>= shift
+        q = vadd_s16(q, vreinterpret_s16_u16(vshr_n_u16(vreinterpret_u16_s16(q), 15))); // q += (q < 0)
+        return q;
+    }
+}
+int16x8_t libdivide_8s16_do_vector(int16x8_t numers, const struct libdivide_s16_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S16_SHIFT_PATH) {
+        int16_t shifter = more & LIBDIVIDE_16_SHIFT_MASK;
+        int16x8_t roundToZeroTweak = vdupq_n_s16((1 << shifter) - 1);
+        int16x8_t q = vaddq_s16(numers, vandq_s16(vshrq_n_s16(numers, 15), roundToZeroTweak)); //q = numer + ((numer >> 15) & roundToZeroTweak);
+        q = vshlq_s16(q, vdupq_n_s16(-shifter)); // q = q >> shifter
+        int16x8_t shiftMask = vdupq_n_s16((int16_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
+        q = vsubq_s16(veorq_s16(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        int16x8_t q = libdivide_mullhi_4s16_flat_vector(numers, vdupq_n_s16(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int16x8_t sign = vdupq_n_s16((int16_t)(int8_t)more >> 7); //must be arithmetic shift
+            q = vaddq_s16(q, vsubq_s16(veorq_s16(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = vshlq_s16(q, vdupq_n_s16(-(more & LIBDIVIDE_16_SHIFT_MASK))); //q >>= shift
+        q = vaddq_s16(q, vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(q), 15))); // q += (q < 0)
+        return q;
+    }
+}
+int16x8x2_t libdivide_16s16_do_vector(int16x8x2_t numers, const struct libdivide_s16_t * denom) {
+    int16x8x2_t r;
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S16_SHIFT_PATH) {
+        int16_t shifter = more & LIBDIVIDE_16_SHIFT_MASK;
+        int16x8_t roundToZeroTweak = vdupq_n_s16((1 << shifter) - 1);
+        r.val[0] = vaddq_s16(numers.val[0], vandq_s16(vshrq_n_s16(numers.val[0], 15), roundToZeroTweak)); //q = numer + ((numer >> 15) & roundToZeroTweak);
+        r.val[1] = vaddq_s16(numers.val[1], vandq_s16(vshrq_n_s16(numers.val[1], 15), roundToZeroTweak)); //q = numer + ((numer >> 15) & roundToZeroTweak);
+        int16x8_t shift = vdupq_n_s16(-shifter);
+        r.val[0] = vshlq_s16(r.val[0], shift); // q = q >> shifter
+        r.val[1] = vshlq_s16(r.val[1], shift); // q = q >> shifter
+        int16x8_t shiftMask = vdupq_n_s16((int16_t)((int8_t)more >> 7)); //set all bits of shift mask = to the sign bit of more
+        r.val[0] = vsubq_s16(veorq_s16(r.val[0], shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        r.val[1] = vsubq_s16(veorq_s16(r.val[1], shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+    }
+    else {
+        int16x8_t magic = vdupq_n_s16(denom->magic);
+        r.val[0] = libdivide_mullhi_8s16_flat_vector(numers.val[0], magic);
+        r.val[1] = libdivide_mullhi_8s16_flat_vector(numers.val[1], magic);
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int16x8_t sign = vdupq_n_s16((int16_t)(int8_t)more >> 7); //must be arithmetic shift
+            r.val[0] = vaddq_s16(r.val[0], vsubq_s16(veorq_s16(numers.val[0], sign), sign)); // q += ((numer ^ sign) - sign);
+            r.val[1] = vaddq_s16(r.val[1], vsubq_s16(veorq_s16(numers.val[1], sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        int16x8_t shift = vdupq_n_s16(-(more & LIBDIVIDE_16_SHIFT_MASK));
+        r.val[0] = vshlq_s16(r.val[0], shift); //q >>= shift
+        r.val[1] = vshlq_s16(r.val[1], shift); //q >>= shift
+        r.val[0] = vaddq_s16(r.val[0], vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(r.val[0]), 15))); // q += (q < 0)
+        r.val[1] = vaddq_s16(r.val[1], vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(r.val[1]), 15))); // q += (q < 0)
+    }
+    return r;
+}
+
+int16x4_t libdivide_4s16_do_vector_alg0(int16x4_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16x4_t roundToZeroTweak = vdup_n_s16((1 << shifter) - 1);
+    int16x4_t q = vadd_s16(numers, vand_s16(vshr_n_s16(numers, 15), roundToZeroTweak));
+    return vshl_s16(q, vdup_n_s16(-shifter));
+}
+int16x8_t libdivide_8s16_do_vector_alg0(int16x8_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16x8_t roundToZeroTweak = vdupq_n_s16((1 << shifter) - 1);
+    int16x8_t q = vaddq_s16(numers, vandq_s16(vshrq_n_s16(numers, 15), roundToZeroTweak));
+    return vshlq_s16(q, vdupq_n_s16(-shifter));
+}
+int16x8x2_t libdivide_16s16_do_vector_alg0(int16x8x2_t numers, const struct libdivide_s16_t *denom) {
+    int16x8x2_t r;
+    r.val[0] = libdivide_8s16_do_vector_alg0(numers.val[0], denom);
+    r.val[1] = libdivide_8s16_do_vector_alg0(numers.val[1], denom);
+    return r;
+}
+
+int16x4_t libdivide_4s16_do_vector_alg1(int16x4_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16x4_t roundToZeroTweak = vdup_n_s16((1 << shifter) - 1);
+    int16x4_t q = vadd_s16(numers, vand_s16(vshr_n_s16(numers, 15), roundToZeroTweak));
+    return vneg_s16(vshl_s16(q, vdup_n_s16(-shifter)));
+}
+int16x8_t libdivide_8s16_do_vector_alg1(int16x8_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16x8_t roundToZeroTweak = vdupq_n_s16((1 << shifter) - 1);
+    int16x8_t q = vaddq_s16(numers, vandq_s16(vshrq_n_s16(numers, 15), roundToZeroTweak));
+    return vnegq_s16(vshlq_s16(q, vdupq_n_s16(-shifter)));
+}
+int16x8x2_t libdivide_16s16_do_vector_alg1(int16x8x2_t numers, const struct libdivide_s16_t *denom) {
+    int16x8x2_t r;
+    r.val[0] = libdivide_8s16_do_vector_alg1(numers.val[0], denom);
+    r.val[1] = libdivide_8s16_do_vector_alg1(numers.val[1], denom);
+    return r;
+}
+
+int16x4_t libdivide_4s16_do_vector_alg2(int16x4_t numers, const struct libdivide_s16_t *denom) {
+    int16x4_t q = libdivide_mullhi_4s16_flat_vector(numers, vdup_n_s16(denom->magic));
+    q = vadd_s16(q, numers);
+    q = vshl_s16(q, vdup_n_s16(-(denom->more & LIBDIVIDE_16_SHIFT_MASK)));
+    q = vadd_s16(q, vreinterpret_s16_u16(vshr_n_u16(vreinterpret_u16_s16(q), 15)));
+    return q;
+}
+int16x8_t libdivide_8s16_do_vector_alg2(int16x8_t numers, const struct libdivide_s16_t *denom) {
+    int16x8_t q = libdivide_mullhi_4s16_flat_vector(numers, vdupq_n_s16(denom->magic));
+    q = vaddq_s16(q, numers);
+    q = vshlq_s16(q, vdupq_n_s16(-(denom->more & LIBDIVIDE_16_SHIFT_MASK)));
+    q = vaddq_s16(q, vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(q), 15)));
+    return q;
+}
+int16x8x2_t libdivide_16s16_do_vector_alg2(int16x8x2_t numers, const struct libdivide_s16_t *denom) {
+    int16x8x2_t r;
+    r.val[0] = libdivide_8s16_do_vector_alg2(numers.val[0], denom);
+    r.val[1] = libdivide_8s16_do_vector_alg2(numers.val[1], denom);
+    return r;
+}
+
+int16x4_t libdivide_4s16_do_vector_alg3(int16x4_t numers, const struct libdivide_s16_t *denom) {
+    int16x4_t q = libdivide_mullhi_4s16_flat_vector(numers, vdup_n_s16(denom->magic));
+    q = vsub_s16(q, numers);
+    q = vshl_s16(q, vdup_n_s16(-(denom->more & LIBDIVIDE_16_SHIFT_MASK)));
+    q = vadd_s16(q, vreinterpret_s16_u16(vshr_n_u16(vreinterpret_u16_s16(q), 15)));
+    return q;
+}
+int16x8_t libdivide_8s16_do_vector_alg3(int16x8_t numers, const struct libdivide_s16_t *denom) {
+    int16x8_t q = libdivide_mullhi_4s16_flat_vector(numers, vdupq_n_s16(denom->magic));
+    q = vsubq_s16(q, numers);
+    q = vshlq_s16(q, vdupq_n_s16(-(denom->more & LIBDIVIDE_16_SHIFT_MASK)));
+    q = vaddq_s16(q, vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(q), 15)));
+    return q;
+}
+int16x8x2_t libdivide_16s16_do_vector_alg3(int16x8x2_t numers, const struct libdivide_s16_t *denom) {
+    int16x8x2_t r;
+    r.val[0] = libdivide_8s16_do_vector_alg3(numers.val[0], denom);
+    r.val[1] = libdivide_8s16_do_vector_alg3(numers.val[1], denom);
+    return r;
+}
+
+int16x4_t libdivide_4s16_do_vector_alg4(int16x4_t numers, const struct libdivide_s16_t *denom) {
+    int16x4_t q = libdivide_mullhi_4s16_flat_vector(numers, vdup_n_s16(denom->magic));
+    q = vshl_s16(q, vdup_n_s16(-denom->more)); //q >>= shift
+    q = vadd_s16(q, vreinterpret_s16_u16(vshr_n_u16(vreinterpret_u16_s16(q), 15))); // q += (q < 0)
+    return q;
+}
+int16x8_t libdivide_8s16_do_vector_alg4(int16x8_t numers, const struct libdivide_s16_t *denom) {
+    int16x8_t q = libdivide_mullhi_4s16_flat_vector(numers, vdupq_n_s16(denom->magic));
+    q = vshlq_s16(q, vdupq_n_s16(-denom->more)); //q >>= shift
+    q = vaddq_s16(q, vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(q), 15))); // q += (q < 0)
+    return q;
+}
+int16x8x2_t libdivide_16s16_do_vector_alg4(int16x8x2_t numers, const struct libdivide_s16_t *denom) {
+    int16x8x2_t r;
+    r.val[0] = libdivide_8s16_do_vector_alg4(numers.val[0], denom);
+    r.val[1] = libdivide_8s16_do_vector_alg4(numers.val[1], denom);
+    return r;
+}
+#elif LIBDIVIDE_USE_VECTOR
+libdivide_4s16_t libdivide_4s16_do_vector(libdivide_4s16_t numers, const struct libdivide_s16_t *denom) {
+    switch (libdivide_s16_get_algorithm(denom)) {
+    case 0: return libdivide_4s16_do_vector_alg0(numers, denom);
+    case 1: return libdivide_4s16_do_vector_alg1(numers, denom);
+    case 2: return libdivide_4s16_do_vector_alg2(numers, denom);
+    case 3: return libdivide_4s16_do_vector_alg3(numers, denom);
+    default: return libdivide_4s16_do_vector_alg4(numers, denom);
+    }
+}
+libdivide_8s16_t libdivide_8s16_do_vector(libdivide_8s16_t numers, const struct libdivide_s16_t *denom) {
+    switch (libdivide_s16_get_algorithm(denom)) {
+    case 0: return libdivide_8s16_do_vector_alg0(numers, denom);
+    case 1: return libdivide_8s16_do_vector_alg1(numers, denom);
+    case 2: return libdivide_8s16_do_vector_alg2(numers, denom);
+    case 3: return libdivide_8s16_do_vector_alg3(numers, denom);
+    default: return libdivide_8s16_do_vector_alg4(numers, denom);
+    }
+}
+libdivide_16s16_t libdivide_16s16_do_vector(libdivide_16s16_t numers, const struct libdivide_s16_t *denom) {
+    switch (libdivide_s16_get_algorithm(denom)) {
+    case 0: return libdivide_16s16_do_vector_alg0(numers, denom);
+    case 1: return libdivide_16s16_do_vector_alg1(numers, denom);
+    case 2: return libdivide_16s16_do_vector_alg2(numers, denom);
+    case 3: return libdivide_16s16_do_vector_alg3(numers, denom);
+    default: return libdivide_16s16_do_vector_alg4(numers, denom);
+    }
+}
+
+libdivide_4s16_t libdivide_4s16_do_vector_alg0(libdivide_4s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_4s16_t q = numers + ((numers >> (libdivide_4s16_t) { 15, 15, 15, 15 }) & (libdivide_4s16_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return q >> (libdivide_4s16_t) { s, s, s, s };
+}
+libdivide_8s16_t libdivide_8s16_do_vector_alg0(libdivide_8s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_8s16_t q = numers + ((numers >> (libdivide_8s16_t) { 15, 15, 15, 15, 15, 15, 15, 15 }) & (libdivide_8s16_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return q >> (libdivide_8s16_t) { s, s, s, s, s, s, s, s };
+}
+libdivide_16s16_t libdivide_16s16_do_vector_alg0(libdivide_16s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_16s16_t q = numers + ((numers >> (libdivide_16s16_t) { 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15 }) & (libdivide_16s16_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return q >> (libdivide_16s16_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+
+libdivide_4s16_t libdivide_4s16_do_vector_alg1(libdivide_4s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_4s16_t q = numers + ((numers >> (libdivide_4s16_t) { 15, 15, 15, 15 }) & (libdivide_4s16_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return -(q >> (libdivide_4s16_t) { s, s, s, s });
+}
+libdivide_8s16_t libdivide_8s16_do_vector_alg1(libdivide_8s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_8s16_t q = numers + ((numers >> (libdivide_8s16_t) { 15, 15, 15, 15, 15, 15, 15, 15 }) & (libdivide_8s16_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return -(q >> (libdivide_8s16_t) { s, s, s, s, s, s, s, s });
+}
+libdivide_16s16_t libdivide_16s16_do_vector_alg1(libdivide_16s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_16s16_t q = numers + ((numers >> (libdivide_16s16_t) { 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15 }) & (libdivide_16s16_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return -(q >> (libdivide_16s16_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s });
+}
+
+libdivide_4s16_t libdivide_4s16_do_vector_alg2(libdivide_4s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t m = denom->magic;
+    libdivide_4s16_t q = libdivide_mullhi_4s16_flat_vector(numers, (libdivide_4s16_t) { m, m, m, m });
+    q = q + numers;
+    q = q >> (libdivide_4s16_t) { s, s, s, s };
+    return q + (libdivide_4s16_t)((libdivide_4u16_t)q >> (libdivide_4u16_t) { 15, 15, 15, 15 });
+}
+libdivide_8s16_t libdivide_8s16_do_vector_alg2(libdivide_8s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t m = denom->magic;
+    libdivide_8s16_t q = libdivide_mullhi_8s16_flat_vector(numers, (libdivide_8s16_t) { m, m, m, m, m, m, m, m });
+    q = q + numers;
+    q = q >> (libdivide_8s16_t) { s, s, s, s, s, s, s, s };
+    return q + (libdivide_8s16_t)((libdivide_8u16_t)q >> (libdivide_8u16_t) { 15, 15, 15, 15, 15, 15, 15, 15 });
+}
+libdivide_16s16_t libdivide_16s16_do_vector_alg2(libdivide_16s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t m = denom->magic;
+    libdivide_16s16_t q = libdivide_mullhi_16s16_flat_vector(numers, (libdivide_16s16_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m });
+    q = q + numers;
+    q = q >> (libdivide_16s16_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+    return q + (libdivide_16s16_t)((libdivide_16u16_t)q >> (libdivide_16u16_t) { 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15 });
+}
+
+libdivide_4s16_t libdivide_4s16_do_vector_alg3(libdivide_4s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t m = denom->magic;
+    libdivide_4s16_t q = libdivide_mullhi_4s16_flat_vector(numers, (libdivide_4s16_t) { m, m, m, m });
+    q = q - numers;
+    q = q >> (libdivide_4s16_t) { s, s, s, s };
+    return q + (libdivide_4s16_t)((libdivide_4u16_t)q >> (libdivide_4u16_t) { 15, 15, 15, 15 });
+}
+libdivide_8s16_t libdivide_8s16_do_vector_alg3(libdivide_8s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t m = denom->magic;
+    libdivide_8s16_t q = libdivide_mullhi_8s16_flat_vector(numers, (libdivide_8s16_t) { m, m, m, m, m, m, m, m });
+    q = q - numers;
+    q = q >> (libdivide_8s16_t) { s, s, s, s, s, s, s, s };
+    return q + (libdivide_8s16_t)((libdivide_8u16_t)q >> (libdivide_8u16_t) { 15, 15, 15, 15, 15, 15, 15, 15 });
+}
+libdivide_16s16_t libdivide_16s16_do_vector_alg3(libdivide_16s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t m = denom->magic;
+    libdivide_16s16_t q = libdivide_mullhi_16s16_flat_vector(numers, (libdivide_16s16_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m });
+    q = q - numers;
+    q = q >> (libdivide_16s16_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+    return q + (libdivide_16s16_t)((libdivide_16u16_t)q >> (libdivide_16u16_t) { 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15 });
+}
+
+libdivide_4s16_t libdivide_4s16_do_vector_alg4(libdivide_4s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t m = denom->magic;
+    libdivide_4s16_t q = libdivide_mullhi_4s16_flat_vector(numers, (libdivide_4s16_t) { m, m, m, m });
+    q = q >> (libdivide_4s16_t) { s, s, s, s };
+    return q + (libdivide_4s16_t)((libdivide_4u16_t)q >> (libdivide_4u16_t) { 15, 15, 15, 15 });
+}
+libdivide_8s16_t libdivide_8s16_do_vector_alg4(libdivide_8s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t m = denom->magic;
+    libdivide_8s16_t q = libdivide_mullhi_8s16_flat_vector(numers, (libdivide_8s16_t) { m, m, m, m, m, m, m, m });
+    q = q >> (libdivide_8s16_t) { s, s, s, s, s, s, s, s };
+    return q + (libdivide_8s16_t)((libdivide_8u16_t)q >> (libdivide_8u16_t) { 15, 15, 15, 15, 15, 15, 15, 15 });
+}
+libdivide_16s16_t libdivide_16s16_do_vector_alg4(libdivide_16s16_t numers, const struct libdivide_s16_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_16_SHIFT_MASK;
+    int16_t m = denom->magic;
+    libdivide_16s16_t q = libdivide_mullhi_16s16_flat_vector(numers, (libdivide_16s16_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m });
+    q = q >> (libdivide_16s16_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+    return q + (libdivide_16s16_t)((libdivide_16u16_t)q >> (libdivide_16u16_t) { 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15 });
+}
+#endif
+
+/////////// UINT8
+
+struct libdivide_u8_t libdivide_u8_gen(uint8_t d) {
+    struct libdivide_u8_t result;
+    result.divisor = d;
+    if ((d & (d - 1)) == 0) {
+        result.magic = 0;
+        result.more = libdivide__count_trailing_zeros32(d) | LIBDIVIDE_U8_SHIFT_PATH;
+    }
+    else {
+        const uint32_t floor_log_2_d = 31 - libdivide__count_leading_zeros32(d);
+
+        uint8_t more;
+        /* 2**(8 + floor_log_2_d) fits in 32 bits, so the 8 bit magic number needs only an ordinary division */
+        const uint32_t power = 1U << (8 + floor_log_2_d);
+        uint8_t proposed_m = (uint8_t)(power / d);
+        const uint8_t rem = (uint8_t)(power % d);
+
+        LIBDIVIDE_ASSERT(rem > 0 && rem < d);
+        const uint8_t e = d - rem;
+
+        /* This power works if e < 2**floor_log_2_d. */
+        if (e < (1U << floor_log_2_d)) {
+            more = floor_log_2_d;
+        }
+        else {
+            /* We have to use the general 9-bit algorithm, doubling the quotient and the remainder of (2**(power-1))/d as in libdivide_u32_gen */
+            proposed_m += proposed_m; //don't care about overflow here - in fact, we expect it
+            const uint8_t twice_rem = rem + rem;
+            if (twice_rem >= d || twice_rem < rem) proposed_m += 1;
+            more = floor_log_2_d | LIBDIVIDE_ADD_MARKER;
+        }
+        result.magic = 1 + proposed_m;
+        result.more = more;
+    }
+    return result;
+}
+
+uint8_t libdivide_u8_do(uint8_t numer, const struct libdivide_u8_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U8_SHIFT_PATH) {
+        return numer >> (more & LIBDIVIDE_8_SHIFT_MASK);
+    }
+    else {
+        uint8_t q = libdivide__mullhi_u8(denom->magic, numer);
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            uint8_t t = ((numer - q) >> 1) + q;
+            return t >> (more & LIBDIVIDE_8_SHIFT_MASK);
+        }
+        else {
+            return q >> more; //all upper bits are 0 - don't need to mask them off
+        }
+    }
+}
+
+int libdivide_u8_get_algorithm(const struct libdivide_u8_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U8_SHIFT_PATH) return 0;
+    else if (! (more & LIBDIVIDE_ADD_MARKER)) return 1;
+    else return 2;
+}
+
+uint8_t libdivide_u8_do_alg0(uint8_t numer, const struct libdivide_u8_t *denom) {
+    return numer >> (denom->more & LIBDIVIDE_8_SHIFT_MASK);
+}
+
+uint8_t libdivide_u8_do_alg1(uint8_t numer, const struct libdivide_u8_t *denom) {
+    uint8_t q = libdivide__mullhi_u8(denom->magic, numer);
+    return q >> denom->more;
+}
+
+uint8_t libdivide_u8_do_alg2(uint8_t numer, const struct libdivide_u8_t *denom) {
+    uint8_t q = libdivide__mullhi_u8(denom->magic, numer);
+    uint8_t t = ((numer - q) >> 1) + q;
+    return t >> (denom->more & LIBDIVIDE_8_SHIFT_MASK);
+}
+
+#if LIBDIVIDE_USE_SSE2
+/* x86 has no 8 bit multiply and no 8 bit shifts, so the byte kernels widen each half of the register to 16 bit lanes, divide there, and pack the low bytes of the two halves back together.  The unpacks and the pack both work within 128 bit lanes, so the bytes come back in their original order. */
+static inline __m128i libdivide_16u8_widen_lo(__m128i x) {
+    return _mm_unpacklo_epi8(x, _mm_setzero_si128());
+}
+
+static inline __m128i libdivide_16u8_widen_hi(__m128i x) {
+    return _mm_unpackhi_epi8(x, _mm_setzero_si128());
+}
+
+static inline __m128i libdivide_16s8_widen_lo(__m128i x) {
+    return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+}
+
+static inline __m128i libdivide_16s8_widen_hi(__m128i x) {
+    return _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8);
+}
+
+/* The quotients fit in 9 bits, so keeping only the low byte of each lane before the saturating pack gives the same wraparound as the scalar code, e.g. INT8_MIN / -1 == INT8_MIN */
+static inline __m128i libdivide_16x8_narrow(__m128i lo, __m128i hi) {
+    __m128i mask = _mm_set1_epi16(0xFF);
+    return _mm_packus_epi16(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask));
+}
+
+static inline __m128i libdivide_16u8_wide_alg0(__m128i numers, const struct libdivide_u8_t *denom) {
+    return _mm_srl_epi16(numers, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+}
+
+static inline __m128i libdivide_16u8_wide_alg1(__m128i numers, const struct libdivide_u8_t *denom) {
+    __m128i q = _mm_srli_epi16(_mm_mullo_epi16(numers, _mm_set1_epi16(denom->magic)), 8);
+    return _mm_srl_epi16(q, libdivide_u32_to_m128i(denom->more));
+}
+
+static inline __m128i libdivide_16u8_wide_alg2(__m128i numers, const struct libdivide_u8_t *denom) {
+    __m128i q = _mm_srli_epi16(_mm_mullo_epi16(numers, _mm_set1_epi16(denom->magic)), 8);
+    __m128i t = _mm_add_epi16(_mm_srli_epi16(_mm_sub_epi16(numers, q), 1), q);
+    return _mm_srl_epi16(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+}
+
+__m128i libdivide_16u8_do_vector(__m128i numers, const struct libdivide_u8_t *denom) {
+    switch (libdivide_u8_get_algorithm(denom)) {
+    case 0:  return libdivide_16u8_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_16u8_do_vector_alg1(numers, denom);
+    default: return libdivide_16u8_do_vector_alg2(numers, denom);
+    }
+}
+
+__m128i libdivide_16u8_do_vector_alg0(__m128i numers, const struct libdivide_u8_t *denom) {
+    return libdivide_16x8_narrow(libdivide_16u8_wide_alg0(libdivide_16u8_widen_lo(numers), denom), libdivide_16u8_wide_alg0(libdivide_16u8_widen_hi(numers), denom));
+}
+
+__m128i libdivide_16u8_do_vector_alg1(__m128i numers, const struct libdivide_u8_t *denom) {
+    return libdivide_16x8_narrow(libdivide_16u8_wide_alg1(libdivide_16u8_widen_lo(numers), denom), libdivide_16u8_wide_alg1(libdivide_16u8_widen_hi(numers), denom));
+}
+
+__m128i libdivide_16u8_do_vector_alg2(__m128i numers, const struct libdivide_u8_t *denom) {
+    return libdivide_16x8_narrow(libdivide_16u8_wide_alg2(libdivide_16u8_widen_lo(numers), denom), libdivide_16u8_wide_alg2(libdivide_16u8_widen_hi(numers), denom));
+}
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32u8_widen_lo(__m256i x) {
+    return _mm256_unpacklo_epi8(x, _mm256_setzero_si256());
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32u8_widen_hi(__m256i x) {
+    return _mm256_unpackhi_epi8(x, _mm256_setzero_si256());
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_widen_lo(__m256i x) {
+    return _mm256_srai_epi16(_mm256_unpacklo_epi8(x, x), 8);
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_widen_hi(__m256i x) {
+    return _mm256_srai_epi16(_mm256_unpackhi_epi8(x, x), 8);
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32x8_narrow(__m256i lo, __m256i hi) {
+    __m256i mask = _mm256_set1_epi16(0xFF);
+    return _mm256_packus_epi16(_mm256_and_si256(lo, mask), _mm256_and_si256(hi, mask));
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32u8_wide_alg0(__m256i numers, const struct libdivide_u8_t *denom) {
+    return _mm256_srl_epi16(numers, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32u8_wide_alg1(__m256i numers, const struct libdivide_u8_t *denom) {
+    __m256i q = _mm256_srli_epi16(_mm256_mullo_epi16(numers, _mm256_set1_epi16(denom->magic)), 8);
+    return _mm256_srl_epi16(q, libdivide_u32_to_m128i(denom->more));
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32u8_wide_alg2(__m256i numers, const struct libdivide_u8_t *denom) {
+    __m256i q = _mm256_srli_epi16(_mm256_mullo_epi16(numers, _mm256_set1_epi16(denom->magic)), 8);
+    __m256i t = _mm256_add_epi16(_mm256_srli_epi16(_mm256_sub_epi16(numers, q), 1), q);
+    return _mm256_srl_epi16(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32u8_do_vector(__m256i numers, const struct libdivide_u8_t *denom) {
+    switch (libdivide_u8_get_algorithm(denom)) {
+    case 0:  return libdivide_32u8_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_32u8_do_vector_alg1(numers, denom);
+    default: return libdivide_32u8_do_vector_alg2(numers, denom);
+    }
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32u8_do_vector_alg0(__m256i numers, const struct libdivide_u8_t *denom) {
+    return libdivide_32x8_narrow(libdivide_32u8_wide_alg0(libdivide_32u8_widen_lo(numers), denom), libdivide_32u8_wide_alg0(libdivide_32u8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32u8_do_vector_alg1(__m256i numers, const struct libdivide_u8_t *denom) {
+    return libdivide_32x8_narrow(libdivide_32u8_wide_alg1(libdivide_32u8_widen_lo(numers), denom), libdivide_32u8_wide_alg1(libdivide_32u8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32u8_do_vector_alg2(__m256i numers, const struct libdivide_u8_t *denom) {
+    return libdivide_32x8_narrow(libdivide_32u8_wide_alg2(libdivide_32u8_widen_lo(numers), denom), libdivide_32u8_wide_alg2(libdivide_32u8_widen_hi(numers), denom));
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64u8_widen_lo(__m512i x) {
+    return _mm512_unpacklo_epi8(x, _mm512_setzero_si512());
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64u8_widen_hi(__m512i x) {
+    return _mm512_unpackhi_epi8(x, _mm512_setzero_si512());
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_widen_lo(__m512i x) {
+    return _mm512_srai_epi16(_mm512_unpacklo_epi8(x, x), 8);
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_widen_hi(__m512i x) {
+    return _mm512_srai_epi16(_mm512_unpackhi_epi8(x, x), 8);
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64x8_narrow(__m512i lo, __m512i hi) {
+    __m512i mask = _mm512_set1_epi16(0xFF);
+    return _mm512_packus_epi16(_mm512_and_si512(lo, mask), _mm512_and_si512(hi, mask));
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64u8_wide_alg0(__m512i numers, const struct libdivide_u8_t *denom) {
+    return _mm512_srl_epi16(numers, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64u8_wide_alg1(__m512i numers, const struct libdivide_u8_t *denom) {
+    __m512i q = _mm512_srli_epi16(_mm512_mullo_epi16(numers, _mm512_set1_epi16(denom->magic)), 8);
+    return _mm512_srl_epi16(q, libdivide_u32_to_m128i(denom->more));
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64u8_wide_alg2(__m512i numers, const struct libdivide_u8_t *denom) {
+    __m512i q = _mm512_srli_epi16(_mm512_mullo_epi16(numers, _mm512_set1_epi16(denom->magic)), 8);
+    __m512i t = _mm512_add_epi16(_mm512_srli_epi16(_mm512_sub_epi16(numers, q), 1), q);
+    return _mm512_srl_epi16(t, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64u8_do_vector(__m512i numers, const struct libdivide_u8_t *denom) {
+    switch (libdivide_u8_get_algorithm(denom)) {
+    case 0:  return libdivide_64u8_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_64u8_do_vector_alg1(numers, denom);
+    default: return libdivide_64u8_do_vector_alg2(numers, denom);
+    }
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64u8_do_vector_alg0(__m512i numers, const struct libdivide_u8_t *denom) {
+    return libdivide_64x8_narrow(libdivide_64u8_wide_alg0(libdivide_64u8_widen_lo(numers), denom), libdivide_64u8_wide_alg0(libdivide_64u8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64u8_do_vector_alg1(__m512i numers, const struct libdivide_u8_t *denom) {
+    return libdivide_64x8_narrow(libdivide_64u8_wide_alg1(libdivide_64u8_widen_lo(numers), denom), libdivide_64u8_wide_alg1(libdivide_64u8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64u8_do_vector_alg2(__m512i numers, const struct libdivide_u8_t *denom) {
+    return libdivide_64x8_narrow(libdivide_64u8_wide_alg2(libdivide_64u8_widen_lo(numers), denom), libdivide_64u8_wide_alg2(libdivide_64u8_widen_hi(numers), denom));
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+uint8x8_t libdivide_8u8_do_vector(uint8x8_t numers, const struct libdivide_u8_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U8_SHIFT_PATH) {
+        return vshl_u8(numers, vdup_n_s8(-(more & LIBDIVIDE_8_SHIFT_MASK)));
+    }
+    else {
+        uint8x8_t q = libdivide_mullhi_8u8_flat_vector(numers, vdup_n_u8(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            uint8x8_t t = vadd_u8(vhsub_u8(numers, q), q);
+            return vshl_u8(t, vdup_n_s8(-(more & LIBDIVIDE_8_SHIFT_MASK)));
+        }
+        else {
+            return vshl_u8(q, vdup_n_s8(-more));
+        }
+    }
+}
+uint8x16_t libdivide_16u8_do_vector(uint8x16_t numers, const struct libdivide_u8_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U8_SHIFT_PATH) {
+        return vshlq_u8(numers, vdupq_n_s8(-(more & LIBDIVIDE_8_SHIFT_MASK)));
+    }
+    else {
+        uint8x16_t q = libdivide_mullhi_16u8_flat_vector(numers, vdupq_n_u8(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            uint8x16_t t = vaddq_u8(vhsubq_u8(numers, q), q);
+            return vshlq_u8(t, vdupq_n_s8(-(more & LIBDIVIDE_8_SHIFT_MASK)));
+        }
+        else {
+            return vshlq_u8(q, vdupq_n_s8(-more));
+        }
+    }
+}
+uint8x16x2_t libdivide_32u8_do_vector(uint8x16x2_t numers, const struct libdivide_u8_t * denom) {
+    uint8x16x2_t r;
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_U8_SHIFT_PATH) {
+        int8x16_t shift = vdupq_n_s8(-(more & LIBDIVIDE_8_SHIFT_MASK));
+        r.val[0] = vshlq_u8(numers.val[0], shift);
+        r.val[1] = vshlq_u8(numers.val[1], shift);
+    }
+    else {
+        uint8x16_t magic = vdupq_n_u8(denom->magic);
+        r.val[0] = libdivide_mullhi_16u8_flat_vector(numers.val[0], magic);
+        r.val[1] = libdivide_mullhi_16u8_flat_vector(numers.val[1], magic);
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int8x16_t shift = vdupq_n_s8(-(more & LIBDIVIDE_8_SHIFT_MASK));
+            r.val[0] = vaddq_u8(vhsubq_u8(numers.val[0], r.val[0]), r.val[0]);
+            r.val[1] = vaddq_u8(vhsubq_u8(numers.val[1], r.val[1]), r.val[1]);
+            r.val[0] = vshlq_u8(r.val[0], shift);
+            r.val[1] = vshlq_u8(r.val[1], shift);
+        }
+        else {
+            int8x16_t shift = vdupq_n_s8(-more);
+            r.val[0] = vshlq_u8(r.val[0], shift);
+            r.val[1] = vshlq_u8(r.val[1], shift);
+        }
+    }
+    return r;
+}
+
+uint8x8_t libdivide_8u8_do_vector_alg0(uint8x8_t numers, const struct libdivide_u8_t *denom) {
+    return vshl_u8(numers, vdup_n_s8(-(denom->more & LIBDIVIDE_8_SHIFT_MASK)));
+}
+uint8x16_t libdivide_16u8_do_vector_alg0(uint8x16_t numers, const struct libdivide_u8_t *denom) {
+    return vshlq_u8(numers, vdupq_n_s8(-(denom->more & LIBDIVIDE_8_SHIFT_MASK)));
+}
+uint8x16x2_t libdivide_32u8_do_vector_alg0(uint8x16x2_t numers, const struct libdivide_u8_t *denom) {
+    uint8x16x2_t r;
+    r.val[0] = libdivide_16u8_do_vector_alg0(numers.val[0], denom);
+    r.val[1] = libdivide_16u8_do_vector_alg0(numers.val[1], denom);
+    return r;
+}
+
+uint8x8_t libdivide_8u8_do_vector_alg1(uint8x8_t numers, const struct libdivide_u8_t *denom) {
+    uint8x8_t q = libdivide_mullhi_8u8_flat_vector(numers, vdup_n_u8(denom->magic));
+    return vshl_u8(q, vdup_n_s8(-denom->more));
+}
+uint8x16_t libdivide_16u8_do_vector_alg1(uint8x16_t numers, const struct libdivide_u8_t *denom) {
+    uint8x16_t q = libdivide_mullhi_16u8_flat_vector(numers, vdupq_n_u8(denom->magic));
+    return vshlq_u8(q, vdupq_n_s8(-denom->more));
+}
+uint8x16x2_t libdivide_32u8_do_vector_alg1(uint8x16x2_t numers, const struct libdivide_u8_t *denom) {
+    uint8x16x2_t r;
+    r.val[0] = libdivide_16u8_do_vector_alg1(numers.val[0], denom);
+    r.val[1] = libdivide_16u8_do_vector_alg1(numers.val[1], denom);
+    return r;
+}
+
+uint8x8_t libdivide_8u8_do_vector_alg2(uint8x8_t numers, const struct libdivide_u8_t *denom) {
+    uint8x8_t q = libdivide_mullhi_8u8_flat_vector(numers, vdup_n_u8(denom->magic));
+    uint8x8_t t = vadd_u8(vhsub_u8(numers, q), q);
+    return vshl_u8(t, vdup_n_s8(-(denom->more & LIBDIVIDE_8_SHIFT_MASK)));
+}
+uint8x16_t libdivide_16u8_do_vector_alg2(uint8x16_t numers, const struct libdivide_u8_t *denom) {
+    uint8x16_t q = libdivide_mullhi_16u8_flat_vector(numers, vdupq_n_u8(denom->magic));
+    uint8x16_t t = vaddq_u8(vhsubq_u8(numers, q), q);
+    return vshlq_u8(t, vdupq_n_s8(-(denom->more & LIBDIVIDE_8_SHIFT_MASK)));
+}
+uint8x16x2_t libdivide_32u8_do_vector_alg2(uint8x16x2_t numers, const struct libdivide_u8_t *denom) {
+    uint8x16x2_t r;
+    r.val[0] = libdivide_16u8_do_vector_alg2(numers.val[0], denom);
+    r.val[1] = libdivide_16u8_do_vector_alg2(numers.val[1], denom);
+    return r;
+}
+#elif LIBDIVIDE_USE_VECTOR
+libdivide_8u8_t libdivide_8u8_do_vector(libdivide_8u8_t numers, const struct libdivide_u8_t *denom) {
+    switch (libdivide_u8_get_algorithm(denom)) {
+    case 0:  return libdivide_8u8_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_8u8_do_vector_alg1(numers, denom);
+    default: return libdivide_8u8_do_vector_alg2(numers, denom);
+    }
+}
+libdivide_16u8_t libdivide_16u8_do_vector(libdivide_16u8_t numers, const struct libdivide_u8_t *denom) {
+    switch (libdivide_u8_get_algorithm(denom)) {
+    case 0:  return libdivide_16u8_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_16u8_do_vector_alg1(numers, denom);
+    default: return libdivide_16u8_do_vector_alg2(numers, denom);
+    }
+}
+libdivide_32u8_t libdivide_32u8_do_vector(libdivide_32u8_t numers, const struct libdivide_u8_t *denom) {
+    switch (libdivide_u8_get_algorithm(denom)) {
+    case 0:  return libdivide_32u8_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_32u8_do_vector_alg1(numers, denom);
+    default: return libdivide_32u8_do_vector_alg2(numers, denom);
+    }
+}
+
+libdivide_8u8_t libdivide_8u8_do_vector_alg0(libdivide_8u8_t numers, const struct libdivide_u8_t *denom) {
+    uint8_t s = (denom->more & LIBDIVIDE_8_SHIFT_MASK);
+    return numers >> (libdivide_8u8_t) { s, s, s, s, s, s, s, s };
+}
+libdivide_16u8_t libdivide_16u8_do_vector_alg0(libdivide_16u8_t numers, const struct libdivide_u8_t *denom) {
+    uint8_t s = (denom->more & LIBDIVIDE_8_SHIFT_MASK);
+    return numers >> (libdivide_16u8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+libdivide_32u8_t libdivide_32u8_do_vector_alg0(libdivide_32u8_t numers, const struct libdivide_u8_t *denom) {
+    uint8_t s = (denom->more & LIBDIVIDE_8_SHIFT_MASK);
+    return numers >> (libdivide_32u8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+
+libdivide_8u8_t libdivide_8u8_do_vector_alg1(libdivide_8u8_t numers, const struct libdivide_u8_t *denom) {
+    uint8_t s = denom->more;
+    uint8_t m = denom->magic;
+    libdivide_8u8_t q = libdivide_mullhi_8u8_flat_vector( numers, (libdivide_8u8_t) { m, m, m, m, m, m, m, m } );
+    return q >> (libdivide_8u8_t) { s, s, s, s, s, s, s, s };
+}
+libdivide_16u8_t libdivide_16u8_do_vector_alg1(libdivide_16u8_t numers, const struct libdivide_u8_t *denom) {
+    uint8_t s = denom->more;
+    uint8_t m = denom->magic;
+    libdivide_16u8_t q = libdivide_mullhi_16u8_flat_vector( numers, (libdivide_16u8_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m } );
+    return q >> (libdivide_16u8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+libdivide_32u8_t libdivide_32u8_do_vector_alg1(libdivide_32u8_t numers, const struct libdivide_u8_t *denom) {
+    uint8_t s = denom->more;
+    uint8_t m = denom->magic;
+    libdivide_32u8_t q = libdivide_mullhi_32u8_flat_vector( numers, (libdivide_32u8_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m } );
+    return q >> (libdivide_32u8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+
+libdivide_8u8_t libdivide_8u8_do_vector_alg2(libdivide_8u8_t numers, const struct libdivide_u8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    uint8_t m = denom->magic;
+    libdivide_8u8_t q = libdivide_mullhi_8u8_flat_vector( numers, (libdivide_8u8_t) { m, m, m, m, m, m, m, m } );
+    libdivide_8u8_t t = ( ( numers - q ) >> (libdivide_8u8_t) { 1, 1, 1, 1, 1, 1, 1, 1 } ) + q;
+    return t >> (libdivide_8u8_t) { s, s, s, s, s, s, s, s };
+}
+libdivide_16u8_t libdivide_16u8_do_vector_alg2(libdivide_16u8_t numers, const struct libdivide_u8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    uint8_t m = denom->magic;
+    libdivide_16u8_t q = libdivide_mullhi_16u8_flat_vector( numers, (libdivide_16u8_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m } );
+    libdivide_16u8_t t = ( ( numers - q ) >> (libdivide_16u8_t) { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 } ) + q;
+    return t >> (libdivide_16u8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+libdivide_32u8_t libdivide_32u8_do_vector_alg2(libdivide_32u8_t numers, const struct libdivide_u8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    uint8_t m = denom->magic;
+    libdivide_32u8_t q = libdivide_mullhi_32u8_flat_vector( numers, (libdivide_32u8_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m } );
+    libdivide_32u8_t t = ( ( numers - q ) >> (libdivide_32u8_t) { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 } ) + q;
+    return t >> (libdivide_32u8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+#endif
+
+/////////// SINT8
+
+struct libdivide_s8_t libdivide_s8_gen(int8_t d) {
+    struct libdivide_s8_t result;
+    result.divisor = d;
+
+    /* As in libdivide_s32_gen, powers of 2 and their negatives use a shift, which also covers -1 and INT8_MIN */
+    uint8_t absD = (uint8_t)(d < 0 ? -d : d);
+    if ((absD & (absD - 1)) == 0) {
+        result.magic = 0;
+        result.more = libdivide__count_trailing_zeros32(absD) | (d < 0 ? LIBDIVIDE_NEGATIVE_DIVISOR : 0) | LIBDIVIDE_S8_SHIFT_PATH;
+    }
+    else {
+        const uint32_t floor_log_2_d = 31 - libdivide__count_leading_zeros32(absD);
+        LIBDIVIDE_ASSERT(floor_log_2_d >= 1);
+
+        uint8_t more;
+        //the dividend here is 2**(floor_log_2_d + 7), which fits in 32 bits
+        const uint32_t power = 1U << (floor_log_2_d + 7);
+        uint8_t proposed_m = (uint8_t)(power / absD);
+        const uint8_t rem = (uint8_t)(power % absD);
+        const uint8_t e = absD - rem;
+
+        /* We are going to start with a power of floor_log_2_d - 1.  This works if e < 2**floor_log_2_d. */
+        if (e < (1U << floor_log_2_d)) {
+            /* This power works */
+            more = floor_log_2_d - 1;
+        }
+        else {
+            /* We need to go one higher.  This should not make proposed_m overflow, but it will make it negative when interpreted as an int8_t. */
+            proposed_m += proposed_m;
+            const uint8_t twice_rem = rem + rem;
+            if (twice_rem >= absD || twice_rem < rem) proposed_m += 1;
+            more = floor_log_2_d | LIBDIVIDE_ADD_MARKER | (d < 0 ? LIBDIVIDE_NEGATIVE_DIVISOR : 0); //use the general algorithm
+        }
+        proposed_m += 1;
+        result.magic = (int8_t)(d < 0 ? -proposed_m : proposed_m);
+        result.more = more;
+    }
+    return result;
+}
+
+/* The scalar functions work in 32 bits, where nothing can overflow, and only the quotient is cut back to 8 bits.  So INT8_MIN / -1 gives INT8_MIN, the same as (int8_t)(numer / denom). */
+int8_t libdivide_s8_do(int8_t numer, const struct libdivide_s8_t *denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S8_SHIFT_PATH) {
+        uint8_t shifter = more & LIBDIVIDE_8_SHIFT_MASK;
+        int32_t q = numer + ((numer >> 7) & ((1 << shifter) - 1));
+        q = q >> shifter;
+        int32_t shiftMask = (int8_t)more >> 7; //must be arithmetic shift and then sign-extend
+        q = (q ^ shiftMask) - shiftMask;
+        return (int8_t)q;
+    }
+    else {
+        int32_t q = libdivide__mullhi_s8(denom->magic, numer);
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int32_t sign = (int8_t)more >> 7; //must be arithmetic shift and then sign extend
+            q += ((numer ^ sign) - sign);
+        }
+        q >>= more & LIBDIVIDE_8_SHIFT_MASK;
+        q += (q < 0);
+        return (int8_t)q;
+    }
+}
+
+int libdivide_s8_get_algorithm(const struct libdivide_s8_t *denom) {
+    uint8_t more = denom->more;
+    int positiveDivisor = ! (more & LIBDIVIDE_NEGATIVE_DIVISOR);
+    if (more & LIBDIVIDE_S8_SHIFT_PATH) return (positiveDivisor ? 0 : 1);
+    else if (more & LIBDIVIDE_ADD_MARKER) return (positiveDivisor ? 2 : 3);
+    else return 4;
+}
+
+int8_t libdivide_s8_do_alg0(int8_t numer, const struct libdivide_s8_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int32_t q = numer + ((numer >> 7) & ((1 << shifter) - 1));
+    return (int8_t)(q >> shifter);
+}
+
+int8_t libdivide_s8_do_alg1(int8_t numer, const struct libdivide_s8_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int32_t q = numer + ((numer >> 7) & ((1 << shifter) - 1));
+    return (int8_t)- (q >> shifter);
+}
+
+int8_t libdivide_s8_do_alg2(int8_t numer, const struct libdivide_s8_t *denom) {
+    int32_t q = libdivide__mullhi_s8(denom->magic, numer);
+    q += numer;
+    q >>= denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    q += (q < 0);
+    return (int8_t)q;
+}
+
+int8_t libdivide_s8_do_alg3(int8_t numer, const struct libdivide_s8_t *denom) {
+    int32_t q = libdivide__mullhi_s8(denom->magic, numer);
+    q -= numer;
+    q >>= denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    q += (q < 0);
+    return (int8_t)q;
+}
+
+int8_t libdivide_s8_do_alg4(int8_t numer, const struct libdivide_s8_t *denom) {
+    int32_t q = libdivide__mullhi_s8(denom->magic, numer);
+    q >>= denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    q += (q < 0);
+    return (int8_t)q;
+}
+
+#if LIBDIVIDE_USE_SSE2
+static inline __m128i libdivide_16s8_wide_alg0(__m128i numers, const struct libdivide_s8_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    __m128i roundToZeroTweak = _mm_set1_epi16((1 << shifter) - 1);
+    __m128i q = _mm_add_epi16(numers, _mm_and_si128(_mm_srai_epi16(numers, 15), roundToZeroTweak));
+    return _mm_sra_epi16(q, libdivide_u32_to_m128i(shifter));
+}
+
+static inline __m128i libdivide_16s8_wide_alg1(__m128i numers, const struct libdivide_s8_t *denom) {
+    return _mm_sub_epi16(_mm_setzero_si128(), libdivide_16s8_wide_alg0(numers, denom));
+}
+
+static inline __m128i libdivide_16s8_wide_alg2(__m128i numers, const struct libdivide_s8_t *denom) {
+    __m128i q = _mm_srai_epi16(_mm_mullo_epi16(numers, _mm_set1_epi16(denom->magic)), 8);
+    q = _mm_add_epi16(q, numers);
+    q = _mm_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+    q = _mm_add_epi16(q, _mm_srli_epi16(q, 15));
+    return q;
+}
+
+static inline __m128i libdivide_16s8_wide_alg3(__m128i numers, const struct libdivide_s8_t *denom) {
+    __m128i q = _mm_srai_epi16(_mm_mullo_epi16(numers, _mm_set1_epi16(denom->magic)), 8);
+    q = _mm_sub_epi16(q, numers);
+    q = _mm_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+    q = _mm_add_epi16(q, _mm_srli_epi16(q, 15));
+    return q;
+}
+
+static inline __m128i libdivide_16s8_wide_alg4(__m128i numers, const struct libdivide_s8_t *denom) {
+    __m128i q = _mm_srai_epi16(_mm_mullo_epi16(numers, _mm_set1_epi16(denom->magic)), 8);
+    q = _mm_sra_epi16(q, libdivide_u32_to_m128i(denom->more)); //q >>= shift
+    q = _mm_add_epi16(q, _mm_srli_epi16(q, 15)); // q += (q < 0)
+    return q;
+}
+
+__m128i libdivide_16s8_do_vector(__m128i numers, const struct libdivide_s8_t *denom) {
+    switch (libdivide_s8_get_algorithm(denom)) {
+    case 0:  return libdivide_16s8_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_16s8_do_vector_alg1(numers, denom);
+    case 2:  return libdivide_16s8_do_vector_alg2(numers, denom);
+    case 3:  return libdivide_16s8_do_vector_alg3(numers, denom);
+    default: return libdivide_16s8_do_vector_alg4(numers, denom);
+    }
+}
+
+__m128i libdivide_16s8_do_vector_alg0(__m128i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_16x8_narrow(libdivide_16s8_wide_alg0(libdivide_16s8_widen_lo(numers), denom), libdivide_16s8_wide_alg0(libdivide_16s8_widen_hi(numers), denom));
+}
+
+__m128i libdivide_16s8_do_vector_alg1(__m128i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_16x8_narrow(libdivide_16s8_wide_alg1(libdivide_16s8_widen_lo(numers), denom), libdivide_16s8_wide_alg1(libdivide_16s8_widen_hi(numers), denom));
+}
+
+__m128i libdivide_16s8_do_vector_alg2(__m128i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_16x8_narrow(libdivide_16s8_wide_alg2(libdivide_16s8_widen_lo(numers), denom), libdivide_16s8_wide_alg2(libdivide_16s8_widen_hi(numers), denom));
+}
+
+__m128i libdivide_16s8_do_vector_alg3(__m128i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_16x8_narrow(libdivide_16s8_wide_alg3(libdivide_16s8_widen_lo(numers), denom), libdivide_16s8_wide_alg3(libdivide_16s8_widen_hi(numers), denom));
+}
+
+__m128i libdivide_16s8_do_vector_alg4(__m128i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_16x8_narrow(libdivide_16s8_wide_alg4(libdivide_16s8_widen_lo(numers), denom), libdivide_16s8_wide_alg4(libdivide_16s8_widen_hi(numers), denom));
+}
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_wide_alg0(__m256i numers, const struct libdivide_s8_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    __m256i roundToZeroTweak = _mm256_set1_epi16((1 << shifter) - 1);
+    __m256i q = _mm256_add_epi16(numers, _mm256_and_si256(_mm256_srai_epi16(numers, 15), roundToZeroTweak));
+    return _mm256_sra_epi16(q, libdivide_u32_to_m128i(shifter));
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_wide_alg1(__m256i numers, const struct libdivide_s8_t *denom) {
+    return _mm256_sub_epi16(_mm256_setzero_si256(), libdivide_32s8_wide_alg0(numers, denom));
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_wide_alg2(__m256i numers, const struct libdivide_s8_t *denom) {
+    __m256i q = _mm256_srai_epi16(_mm256_mullo_epi16(numers, _mm256_set1_epi16(denom->magic)), 8);
+    q = _mm256_add_epi16(q, numers);
+    q = _mm256_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+    q = _mm256_add_epi16(q, _mm256_srli_epi16(q, 15));
+    return q;
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_wide_alg3(__m256i numers, const struct libdivide_s8_t *denom) {
+    __m256i q = _mm256_srai_epi16(_mm256_mullo_epi16(numers, _mm256_set1_epi16(denom->magic)), 8);
+    q = _mm256_sub_epi16(q, numers);
+    q = _mm256_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+    q = _mm256_add_epi16(q, _mm256_srli_epi16(q, 15));
+    return q;
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_wide_alg4(__m256i numers, const struct libdivide_s8_t *denom) {
+    __m256i q = _mm256_srai_epi16(_mm256_mullo_epi16(numers, _mm256_set1_epi16(denom->magic)), 8);
+    q = _mm256_sra_epi16(q, libdivide_u32_to_m128i(denom->more)); //q >>= shift
+    q = _mm256_add_epi16(q, _mm256_srli_epi16(q, 15)); // q += (q < 0)
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_do_vector(__m256i numers, const struct libdivide_s8_t *denom) {
+    switch (libdivide_s8_get_algorithm(denom)) {
+    case 0:  return libdivide_32s8_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_32s8_do_vector_alg1(numers, denom);
+    case 2:  return libdivide_32s8_do_vector_alg2(numers, denom);
+    case 3:  return libdivide_32s8_do_vector_alg3(numers, denom);
+    default: return libdivide_32s8_do_vector_alg4(numers, denom);
+    }
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_do_vector_alg0(__m256i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_32x8_narrow(libdivide_32s8_wide_alg0(libdivide_32s8_widen_lo(numers), denom), libdivide_32s8_wide_alg0(libdivide_32s8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_do_vector_alg1(__m256i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_32x8_narrow(libdivide_32s8_wide_alg1(libdivide_32s8_widen_lo(numers), denom), libdivide_32s8_wide_alg1(libdivide_32s8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_do_vector_alg2(__m256i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_32x8_narrow(libdivide_32s8_wide_alg2(libdivide_32s8_widen_lo(numers), denom), libdivide_32s8_wide_alg2(libdivide_32s8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_do_vector_alg3(__m256i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_32x8_narrow(libdivide_32s8_wide_alg3(libdivide_32s8_widen_lo(numers), denom), libdivide_32s8_wide_alg3(libdivide_32s8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_32s8_do_vector_alg4(__m256i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_32x8_narrow(libdivide_32s8_wide_alg4(libdivide_32s8_widen_lo(numers), denom), libdivide_32s8_wide_alg4(libdivide_32s8_widen_hi(numers), denom));
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_wide_alg0(__m512i numers, const struct libdivide_s8_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    __m512i roundToZeroTweak = _mm512_set1_epi16((1 << shifter) - 1);
+    __m512i q = _mm512_add_epi16(numers, _mm512_and_si512(_mm512_srai_epi16(numers, 15), roundToZeroTweak));
+    return _mm512_sra_epi16(q, libdivide_u32_to_m128i(shifter));
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_wide_alg1(__m512i numers, const struct libdivide_s8_t *denom) {
+    return _mm512_sub_epi16(_mm512_setzero_si512(), libdivide_64s8_wide_alg0(numers, denom));
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_wide_alg2(__m512i numers, const struct libdivide_s8_t *denom) {
+    __m512i q = _mm512_srai_epi16(_mm512_mullo_epi16(numers, _mm512_set1_epi16(denom->magic)), 8);
+    q = _mm512_add_epi16(q, numers);
+    q = _mm512_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+    q = _mm512_add_epi16(q, _mm512_srli_epi16(q, 15));
+    return q;
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_wide_alg3(__m512i numers, const struct libdivide_s8_t *denom) {
+    __m512i q = _mm512_srai_epi16(_mm512_mullo_epi16(numers, _mm512_set1_epi16(denom->magic)), 8);
+    q = _mm512_sub_epi16(q, numers);
+    q = _mm512_sra_epi16(q, libdivide_u32_to_m128i(denom->more & LIBDIVIDE_8_SHIFT_MASK));
+    q = _mm512_add_epi16(q, _mm512_srli_epi16(q, 15));
+    return q;
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_wide_alg4(__m512i numers, const struct libdivide_s8_t *denom) {
+    __m512i q = _mm512_srai_epi16(_mm512_mullo_epi16(numers, _mm512_set1_epi16(denom->magic)), 8);
+    q = _mm512_sra_epi16(q, libdivide_u32_to_m128i(denom->more)); //q >>= shift
+    q = _mm512_add_epi16(q, _mm512_srli_epi16(q, 15)); // q += (q < 0)
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_do_vector(__m512i numers, const struct libdivide_s8_t *denom) {
+    switch (libdivide_s8_get_algorithm(denom)) {
+    case 0:  return libdivide_64s8_do_vector_alg0(numers, denom);
+    case 1:  return libdivide_64s8_do_vector_alg1(numers, denom);
+    case 2:  return libdivide_64s8_do_vector_alg2(numers, denom);
+    case 3:  return libdivide_64s8_do_vector_alg3(numers, denom);
+    default: return libdivide_64s8_do_vector_alg4(numers, denom);
+    }
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_do_vector_alg0(__m512i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_64x8_narrow(libdivide_64s8_wide_alg0(libdivide_64s8_widen_lo(numers), denom), libdivide_64s8_wide_alg0(libdivide_64s8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_do_vector_alg1(__m512i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_64x8_narrow(libdivide_64s8_wide_alg1(libdivide_64s8_widen_lo(numers), denom), libdivide_64s8_wide_alg1(libdivide_64s8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_do_vector_alg2(__m512i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_64x8_narrow(libdivide_64s8_wide_alg2(libdivide_64s8_widen_lo(numers), denom), libdivide_64s8_wide_alg2(libdivide_64s8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_do_vector_alg3(__m512i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_64x8_narrow(libdivide_64s8_wide_alg3(libdivide_64s8_widen_lo(numers), denom), libdivide_64s8_wide_alg3(libdivide_64s8_widen_hi(numers), denom));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_64s8_do_vector_alg4(__m512i numers, const struct libdivide_s8_t *denom) {
+    return libdivide_64x8_narrow(libdivide_64s8_wide_alg4(libdivide_64s8_widen_lo(numers), denom), libdivide_64s8_wide_alg4(libdivide_64s8_widen_hi(numers), denom));
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+int8x8_t libdivide_8s8_do_vector(int8x8_t numers, const struct libdivide_s8_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S8_SHIFT_PATH) {
+        int8_t shifter = more & LIBDIVIDE_8_SHIFT_MASK;
+        int8x8_t roundToZeroTweak = vdup_n_s8((1 << shifter) - 1);
+        int8x8_t q = vadd_s8(numers, vand_s8(vshr_n_s8(numers, 7), roundToZeroTweak)); //q = numer + ((numer >> 7) & roundToZeroTweak);
+        q = vshl_s8(q, vdup_n_s8(-shifter)); // q = q >> shifter
+        int8x8_t shiftMask = vdup_n_s8((int8_t)more >> 7); //set all bits of shift mask = to the sign bit of more
+        q = vsub_s8(veor_s8(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        int8x8_t q = libdivide_mullhi_8s8_flat_vector(numers, vdup_n_s8(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int8x8_t sign = vdup_n_s8((int8_t)more >> 7); //must be arithmetic shift
+            q = vadd_s8(q, vsub_s8(veor_s8(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = vshl_s8(q, vdup_n_s8(-(more & LIBDIVIDE_8_SHIFT_MASK))); //q >>= shift
+        q = vadd_s8(q, vreinterpret_s8_u8(vshr_n_u8(vreinterpret_u8_s8(q), 7))); // q += (q < 0)
+        return q;
+    }
+}
+int8x16_t libdivide_16s8_do_vector(int8x16_t numers, const struct libdivide_s8_t * denom) {
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S8_SHIFT_PATH) {
+        int8_t shifter = more & LIBDIVIDE_8_SHIFT_MASK;
+        int8x16_t roundToZeroTweak = vdupq_n_s8((1 << shifter) - 1);
+        int8x16_t q = vaddq_s8(numers, vandq_s8(vshrq_n_s8(numers, 7), roundToZeroTweak)); //q = numer + ((numer >> 7) & roundToZeroTweak);
+        q = vshlq_s8(q, vdupq_n_s8(-shifter)); // q = q >> shifter
+        int8x16_t shiftMask = vdupq_n_s8((int8_t)more >> 7); //set all bits of shift mask = to the sign bit of more
+        q = vsubq_s8(veorq_s8(q, shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        return q;
+    }
+    else {
+        int8x16_t q = libdivide_mullhi_8s8_flat_vector(numers, vdupq_n_s8(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int8x16_t sign = vdupq_n_s8((int8_t)more >> 7); //must be arithmetic shift
+            q = vaddq_s8(q, vsubq_s8(veorq_s8(numers, sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        q = vshlq_s8(q, vdupq_n_s8(-(more & LIBDIVIDE_8_SHIFT_MASK))); //q >>= shift
+        q = vaddq_s8(q, vreinterpretq_s8_u8(vshrq_n_u8(vreinterpretq_u8_s8(q), 7))); // q += (q < 0)
+        return q;
+    }
+}
+int8x16x2_t libdivide_32s8_do_vector(int8x16x2_t numers, const struct libdivide_s8_t * denom) {
+    int8x16x2_t r;
+    uint8_t more = denom->more;
+    if (more & LIBDIVIDE_S8_SHIFT_PATH) {
+        int8_t shifter = more & LIBDIVIDE_8_SHIFT_MASK;
+        int8x16_t roundToZeroTweak = vdupq_n_s8((1 << shifter) - 1);
+        r.val[0] = vaddq_s8(numers.val[0], vandq_s8(vshrq_n_s8(numers.val[0], 7), roundToZeroTweak)); //q = numer + ((numer >> 7) & roundToZeroTweak);
+        r.val[1] = vaddq_s8(numers.val[1], vandq_s8(vshrq_n_s8(numers.val[1], 7), roundToZeroTweak)); //q = numer + ((numer >> 7) & roundToZeroTweak);
+        int8x16_t shift = vdupq_n_s8(-shifter);
+        r.val[0] = vshlq_s8(r.val[0], shift); // q = q >> shifter
+        r.val[1] = vshlq_s8(r.val[1], shift); // q = q >> shifter
+        int8x16_t shiftMask = vdupq_n_s8((int8_t)more >> 7); //set all bits of shift mask = to the sign bit of more
+        r.val[0] = vsubq_s8(veorq_s8(r.val[0], shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+        r.val[1] = vsubq_s8(veorq_s8(r.val[1], shiftMask), shiftMask); //q = (q ^ shiftMask) - shiftMask;
+    }
+    else {
+        int8x16_t magic = vdupq_n_s8(denom->magic);
+        r.val[0] = libdivide_mullhi_16s8_flat_vector(numers.val[0], magic);
+        r.val[1] = libdivide_mullhi_16s8_flat_vector(numers.val[1], magic);
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            int8x16_t sign = vdupq_n_s8((int8_t)more >> 7); //must be arithmetic shift
+            r.val[0] = vaddq_s8(r.val[0], vsubq_s8(veorq_s8(numers.val[0], sign), sign)); // q += ((numer ^ sign) - sign);
+            r.val[1] = vaddq_s8(r.val[1], vsubq_s8(veorq_s8(numers.val[1], sign), sign)); // q += ((numer ^ sign) - sign);
+        }
+        int8x16_t shift = vdupq_n_s8(-(more & LIBDIVIDE_8_SHIFT_MASK));
+        r.val[0] = vshlq_s8(r.val[0], shift); //q >>= shift
+        r.val[1] = vshlq_s8(r.val[1], shift); //q >>= shift
+        r.val[0] = vaddq_s8(r.val[0], vreinterpretq_s8_u8(vshrq_n_u8(vreinterpretq_u8_s8(r.val[0]), 7))); // q += (q < 0)
+        r.val[1] = vaddq_s8(r.val[1], vreinterpretq_s8_u8(vshrq_n_u8(vreinterpretq_u8_s8(r.val[1]), 7))); // q += (q < 0)
+    }
+    return r;
+}
+
+int8x8_t libdivide_8s8_do_vector_alg0(int8x8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8x8_t roundToZeroTweak = vdup_n_s8((1 << shifter) - 1);
+    int8x8_t q = vadd_s8(numers, vand_s8(vshr_n_s8(numers, 7), roundToZeroTweak));
+    return vshl_s8(q, vdup_n_s8(-shifter));
+}
+int8x16_t libdivide_16s8_do_vector_alg0(int8x16_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8x16_t roundToZeroTweak = vdupq_n_s8((1 << shifter) - 1);
+    int8x16_t q = vaddq_s8(numers, vandq_s8(vshrq_n_s8(numers, 7), roundToZeroTweak));
+    return vshlq_s8(q, vdupq_n_s8(-shifter));
+}
+int8x16x2_t libdivide_32s8_do_vector_alg0(int8x16x2_t numers, const struct libdivide_s8_t *denom) {
+    int8x16x2_t r;
+    r.val[0] = libdivide_16s8_do_vector_alg0(numers.val[0], denom);
+    r.val[1] = libdivide_16s8_do_vector_alg0(numers.val[1], denom);
+    return r;
+}
+
+int8x8_t libdivide_8s8_do_vector_alg1(int8x8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8x8_t roundToZeroTweak = vdup_n_s8((1 << shifter) - 1);
+    int8x8_t q = vadd_s8(numers, vand_s8(vshr_n_s8(numers, 7), roundToZeroTweak));
+    return vneg_s8(vshl_s8(q, vdup_n_s8(-shifter)));
+}
+int8x16_t libdivide_16s8_do_vector_alg1(int8x16_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8x16_t roundToZeroTweak = vdupq_n_s8((1 << shifter) - 1);
+    int8x16_t q = vaddq_s8(numers, vandq_s8(vshrq_n_s8(numers, 7), roundToZeroTweak));
+    return vnegq_s8(vshlq_s8(q, vdupq_n_s8(-shifter)));
+}
+int8x16x2_t libdivide_32s8_do_vector_alg1(int8x16x2_t numers, const struct libdivide_s8_t *denom) {
+    int8x16x2_t r;
+    r.val[0] = libdivide_16s8_do_vector_alg1(numers.val[0], denom);
+    r.val[1] = libdivide_16s8_do_vector_alg1(numers.val[1], denom);
+    return r;
+}
+
+int8x8_t libdivide_8s8_do_vector_alg2(int8x8_t numers, const struct libdivide_s8_t *denom) {
+    int8x8_t q = libdivide_mullhi_8s8_flat_vector(numers, vdup_n_s8(denom->magic));
+    q = vadd_s8(q, numers);
+    q = vshl_s8(q, vdup_n_s8(-(denom->more & LIBDIVIDE_8_SHIFT_MASK)));
+    q = vadd_s8(q, vreinterpret_s8_u8(vshr_n_u8(vreinterpret_u8_s8(q), 7)));
+    return q;
+}
+int8x16_t libdivide_16s8_do_vector_alg2(int8x16_t numers, const struct libdivide_s8_t *denom) {
+    int8x16_t q = libdivide_mullhi_8s8_flat_vector(numers, vdupq_n_s8(denom->magic));
+    q = vaddq_s8(q, numers);
+    q = vshlq_s8(q, vdupq_n_s8(-(denom->more & LIBDIVIDE_8_SHIFT_MASK)));
+    q = vaddq_s8(q, vreinterpretq_s8_u8(vshrq_n_u8(vreinterpretq_u8_s8(q), 7)));
+    return q;
+}
+int8x16x2_t libdivide_32s8_do_vector_alg2(int8x16x2_t numers, const struct libdivide_s8_t *denom) {
+    int8x16x2_t r;
+    r.val[0] = libdivide_16s8_do_vector_alg2(numers.val[0], denom);
+    r.val[1] = libdivide_16s8_do_vector_alg2(numers.val[1], denom);
+    return r;
+}
+
+int8x8_t libdivide_8s8_do_vector_alg3(int8x8_t numers, const struct libdivide_s8_t *denom) {
+    int8x8_t q = libdivide_mullhi_8s8_flat_vector(numers, vdup_n_s8(denom->magic));
+    q = vsub_s8(q, numers);
+    q = vshl_s8(q, vdup_n_s8(-(denom->more & LIBDIVIDE_8_SHIFT_MASK)));
+    q = vadd_s8(q, vreinterpret_s8_u8(vshr_n_u8(vreinterpret_u8_s8(q), 7)));
+    return q;
+}
+int8x16_t libdivide_16s8_do_vector_alg3(int8x16_t numers, const struct libdivide_s8_t *denom) {
+    int8x16_t q = libdivide_mullhi_8s8_flat_vector(numers, vdupq_n_s8(denom->magic));
+    q = vsubq_s8(q, numers);
+    q = vshlq_s8(q, vdupq_n_s8(-(denom->more & LIBDIVIDE_8_SHIFT_MASK)));
+    q = vaddq_s8(q, vreinterpretq_s8_u8(vshrq_n_u8(vreinterpretq_u8_s8(q), 7)));
+    return q;
+}
+int8x16x2_t libdivide_32s8_do_vector_alg3(int8x16x2_t numers, const struct libdivide_s8_t *denom) {
+    int8x16x2_t r;
+    r.val[0] = libdivide_16s8_do_vector_alg3(numers.val[0], denom);
+    r.val[1] = libdivide_16s8_do_vector_alg3(numers.val[1], denom);
+    return r;
+}
+
+int8x8_t libdivide_8s8_do_vector_alg4(int8x8_t numers, const struct libdivide_s8_t *denom) {
+    int8x8_t q = libdivide_mullhi_8s8_flat_vector(numers, vdup_n_s8(denom->magic));
+    q = vshl_s8(q, vdup_n_s8(-denom->more)); //q >>= shift
+    q = vadd_s8(q, vreinterpret_s8_u8(vshr_n_u8(vreinterpret_u8_s8(q), 7))); // q += (q < 0)
+    return q;
+}
+int8x16_t libdivide_16s8_do_vector_alg4(int8x16_t numers, const struct libdivide_s8_t *denom) {
+    int8x16_t q = libdivide_mullhi_8s8_flat_vector(numers, vdupq_n_s8(denom->magic));
+    q = vshlq_s8(q, vdupq_n_s8(-denom->more)); //q >>= shift
+    q = vaddq_s8(q, vreinterpretq_s8_u8(vshrq_n_u8(vreinterpretq_u8_s8(q), 7))); // q += (q < 0)
+    return q;
+}
+int8x16x2_t libdivide_32s8_do_vector_alg4(int8x16x2_t numers, const struct libdivide_s8_t *denom) {
+    int8x16x2_t r;
+    r.val[0] = libdivide_16s8_do_vector_alg4(numers.val[0], denom);
+    r.val[1] = libdivide_16s8_do_vector_alg4(numers.val[1], denom);
+    return r;
+}
+#elif LIBDIVIDE_USE_VECTOR
+libdivide_8s8_t libdivide_8s8_do_vector(libdivide_8s8_t numers, const struct libdivide_s8_t *denom) {
+    switch (libdivide_s8_get_algorithm(denom)) {
+    case 0: return libdivide_8s8_do_vector_alg0(numers, denom);
+    case 1: return libdivide_8s8_do_vector_alg1(numers, denom);
+    case 2: return libdivide_8s8_do_vector_alg2(numers, denom);
+    case 3: return libdivide_8s8_do_vector_alg3(numers, denom);
+    default: return libdivide_8s8_do_vector_alg4(numers, denom);
+    }
+}
+libdivide_16s8_t libdivide_16s8_do_vector(libdivide_16s8_t numers, const struct libdivide_s8_t *denom) {
+    switch (libdivide_s8_get_algorithm(denom)) {
+    case 0: return libdivide_16s8_do_vector_alg0(numers, denom);
+    case 1: return libdivide_16s8_do_vector_alg1(numers, denom);
+    case 2: return libdivide_16s8_do_vector_alg2(numers, denom);
+    case 3: return libdivide_16s8_do_vector_alg3(numers, denom);
+    default: return libdivide_16s8_do_vector_alg4(numers, denom);
+    }
+}
+libdivide_32s8_t libdivide_32s8_do_vector(libdivide_32s8_t numers, const struct libdivide_s8_t *denom) {
+    switch (libdivide_s8_get_algorithm(denom)) {
+    case 0: return libdivide_32s8_do_vector_alg0(numers, denom);
+    case 1: return libdivide_32s8_do_vector_alg1(numers, denom);
+    case 2: return libdivide_32s8_do_vector_alg2(numers, denom);
+    case 3: return libdivide_32s8_do_vector_alg3(numers, denom);
+    default: return libdivide_32s8_do_vector_alg4(numers, denom);
+    }
+}
+
+libdivide_8s8_t libdivide_8s8_do_vector_alg0(libdivide_8s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_8s8_t q = numers + ((numers >> (libdivide_8s8_t) { 7, 7, 7, 7, 7, 7, 7, 7 }) & (libdivide_8s8_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return q >> (libdivide_8s8_t) { s, s, s, s, s, s, s, s };
+}
+libdivide_16s8_t libdivide_16s8_do_vector_alg0(libdivide_16s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_16s8_t q = numers + ((numers >> (libdivide_16s8_t) { 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 }) & (libdivide_16s8_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return q >> (libdivide_16s8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+libdivide_32s8_t libdivide_32s8_do_vector_alg0(libdivide_32s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_32s8_t q = numers + ((numers >> (libdivide_32s8_t) { 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 }) & (libdivide_32s8_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return q >> (libdivide_32s8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+}
+
+libdivide_8s8_t libdivide_8s8_do_vector_alg1(libdivide_8s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_8s8_t q = numers + ((numers >> (libdivide_8s8_t) { 7, 7, 7, 7, 7, 7, 7, 7 }) & (libdivide_8s8_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return -(q >> (libdivide_8s8_t) { s, s, s, s, s, s, s, s });
+}
+libdivide_16s8_t libdivide_16s8_do_vector_alg1(libdivide_16s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_16s8_t q = numers + ((numers >> (libdivide_16s8_t) { 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 }) & (libdivide_16s8_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return -(q >> (libdivide_16s8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s });
+}
+libdivide_32s8_t libdivide_32s8_do_vector_alg1(libdivide_32s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t roundToZeroTweak = (1 << s) - 1;
+    libdivide_32s8_t q = numers + ((numers >> (libdivide_32s8_t) { 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 }) & (libdivide_32s8_t) { roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak, roundToZeroTweak });
+    return -(q >> (libdivide_32s8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s });
+}
+
+libdivide_8s8_t libdivide_8s8_do_vector_alg2(libdivide_8s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t m = denom->magic;
+    libdivide_8s8_t q = libdivide_mullhi_8s8_flat_vector(numers, (libdivide_8s8_t) { m, m, m, m, m, m, m, m });
+    q = q + numers;
+    q = q >> (libdivide_8s8_t) { s, s, s, s, s, s, s, s };
+    return q + (libdivide_8s8_t)((libdivide_8u8_t)q >> (libdivide_8u8_t) { 7, 7, 7, 7, 7, 7, 7, 7 });
+}
+libdivide_16s8_t libdivide_16s8_do_vector_alg2(libdivide_16s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t m = denom->magic;
+    libdivide_16s8_t q = libdivide_mullhi_16s8_flat_vector(numers, (libdivide_16s8_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m });
+    q = q + numers;
+    q = q >> (libdivide_16s8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+    return q + (libdivide_16s8_t)((libdivide_16u8_t)q >> (libdivide_16u8_t) { 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 });
+}
+libdivide_32s8_t libdivide_32s8_do_vector_alg2(libdivide_32s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t m = denom->magic;
+    libdivide_32s8_t q = libdivide_mullhi_32s8_flat_vector(numers, (libdivide_32s8_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m });
+    q = q + numers;
+    q = q >> (libdivide_32s8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+    return q + (libdivide_32s8_t)((libdivide_32u8_t)q >> (libdivide_32u8_t) { 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 });
+}
+
+libdivide_8s8_t libdivide_8s8_do_vector_alg3(libdivide_8s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t m = denom->magic;
+    libdivide_8s8_t q = libdivide_mullhi_8s8_flat_vector(numers, (libdivide_8s8_t) { m, m, m, m, m, m, m, m });
+    q = q - numers;
+    q = q >> (libdivide_8s8_t) { s, s, s, s, s, s, s, s };
+    return q + (libdivide_8s8_t)((libdivide_8u8_t)q >> (libdivide_8u8_t) { 7, 7, 7, 7, 7, 7, 7, 7 });
+}
+libdivide_16s8_t libdivide_16s8_do_vector_alg3(libdivide_16s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t m = denom->magic;
+    libdivide_16s8_t q = libdivide_mullhi_16s8_flat_vector(numers, (libdivide_16s8_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m });
+    q = q - numers;
+    q = q >> (libdivide_16s8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+    return q + (libdivide_16s8_t)((libdivide_16u8_t)q >> (libdivide_16u8_t) { 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 });
+}
+libdivide_32s8_t libdivide_32s8_do_vector_alg3(libdivide_32s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t m = denom->magic;
+    libdivide_32s8_t q = libdivide_mullhi_32s8_flat_vector(numers, (libdivide_32s8_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m });
+    q = q - numers;
+    q = q >> (libdivide_32s8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+    return q + (libdivide_32s8_t)((libdivide_32u8_t)q >> (libdivide_32u8_t) { 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 });
+}
+
+libdivide_8s8_t libdivide_8s8_do_vector_alg4(libdivide_8s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t m = denom->magic;
+    libdivide_8s8_t q = libdivide_mullhi_8s8_flat_vector(numers, (libdivide_8s8_t) { m, m, m, m, m, m, m, m });
+    q = q >> (libdivide_8s8_t) { s, s, s, s, s, s, s, s };
+    return q + (libdivide_8s8_t)((libdivide_8u8_t)q >> (libdivide_8u8_t) { 7, 7, 7, 7, 7, 7, 7, 7 });
+}
+libdivide_16s8_t libdivide_16s8_do_vector_alg4(libdivide_16s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t m = denom->magic;
+    libdivide_16s8_t q = libdivide_mullhi_16s8_flat_vector(numers, (libdivide_16s8_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m });
+    q = q >> (libdivide_16s8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+    return q + (libdivide_16s8_t)((libdivide_16u8_t)q >> (libdivide_16u8_t) { 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 });
+}
+libdivide_32s8_t libdivide_32s8_do_vector_alg4(libdivide_32s8_t numers, const struct libdivide_s8_t *denom) {
+    uint8_t s = denom->more & LIBDIVIDE_8_SHIFT_MASK;
+    int8_t m = denom->magic;
+    libdivide_32s8_t q = libdivide_mullhi_32s8_flat_vector(numers, (libdivide_32s8_t) { m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m, m });
+    q = q >> (libdivide_32s8_t) { s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s, s };
+    return q + (libdivide_32s8_t)((libdivide_32u8_t)q >> (libdivide_32u8_t) { 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 });
+}
+#endif
+
+/////////// UINT128
+
+#if HAS_INT128_T
+struct libdivide_u128_t libdivide_u128_gen(__uint128_t d) {
+    struct libdivide_u128_t result;
+    result.divisor = d;
+    if ((d & (d - 1)) == 0) {
+        result.more = libdivide__count_trailing_zeros128(d) | LIBDIVIDE_U128_SHIFT_PATH;
+        result.magic = 0;
+    }
+    else {
+        const uint32_t floor_log_2_d = 127 - libdivide__count_leading_zeros128(d);
+
+        __uint128_t proposed_m, rem;
+        uint16_t more;
+        proposed_m = libdivide_256_div_128_to_128((__uint128_t)1 << floor_log_2_d, 0, d, &rem); //== (1 << (128 + floor_log_2_d)) / d
+
+        LIBDIVIDE_ASSERT(rem > 0 && rem < d);
+        const __uint128_t e = d - rem;
+
+        /* This power works if e < 2**floor_log_2_d. */
+        if (e < ((__uint128_t)1 << floor_log_2_d)) {
+            more = floor_log_2_d;
+        }
+        else {
+            /* We have to use the general 129-bit algorithm, doubling the quotient and the remainder of (2**(power-1))/d as in libdivide_u64_gen */
+            proposed_m += proposed_m; //don't care about overflow here - in fact, we expect it
+            const __uint128_t twice_rem = rem + rem;
+            if (twice_rem >= d || twice_rem < rem) proposed_m += 1;
+            more = floor_log_2_d | LIBDIVIDE_128_ADD_MARKER;
+        }
+        result.magic = 1 + proposed_m;
+        result.more = more;
+    }
+    return result;
+}
+
+__uint128_t libdivide_u128_do(__uint128_t numer, const struct libdivide_u128_t *denom) {
+    uint16_t more = denom->more;
+    if (more & LIBDIVIDE_U128_SHIFT_PATH) {
+        return numer >> (more & LIBDIVIDE_128_SHIFT_MASK);
+    }
+    else {
+        __uint128_t q = libdivide__mullhi_u128(denom->magic, numer);
+        if (more & LIBDIVIDE_128_ADD_MARKER) {
+            __uint128_t t = ((numer - q) >> 1) + q;
+            return t >> (more & LIBDIVIDE_128_SHIFT_MASK);
+        }
+        else {
+            return q >> more; //all upper bits are 0 - don't need to mask them off
+        }
+    }
+}
+
+int libdivide_u128_get_algorithm(const struct libdivide_u128_t *denom) {
+    uint16_t more = denom->more;
+    if (more & LIBDIVIDE_U128_SHIFT_PATH) return 0;
+    else if (! (more & LIBDIVIDE_128_ADD_MARKER)) return 1;
+    else return 2;
+}
+
+__uint128_t libdivide_u128_do_alg0(__uint128_t numer, const struct libdivide_u128_t *denom) {
+    return numer >> (denom->more & LIBDIVIDE_128_SHIFT_MASK);
+}
+
+__uint128_t libdivide_u128_do_alg1(__uint128_t numer, const struct libdivide_u128_t *denom) {
+    __uint128_t q = libdivide__mullhi_u128(denom->magic, numer);
+    return q >> denom->more;
+}
+
+__uint128_t libdivide_u128_do_alg2(__uint128_t numer, const struct libdivide_u128_t *denom) {
+    __uint128_t q = libdivide__mullhi_u128(denom->magic, numer);
+    __uint128_t t = ((numer - q) >> 1) + q;
+    return t >> (denom->more & LIBDIVIDE_128_SHIFT_MASK);
+}
+#endif
+
+/////////// SINT128
+
+#if HAS_INT128_T
+struct libdivide_s128_t libdivide_s128_gen(__int128_t d) {
+    struct libdivide_s128_t result;
+    result.divisor = d;
+
+    /* As in libdivide_s64_gen, powers of 2 and their negatives take the shift path, which the magic number of 0 marks. */
+    const __uint128_t absD = (d < 0 ? -(__uint128_t)d : (__uint128_t)d);
+    if ((absD & (absD - 1)) == 0) {
+        result.more = libdivide__count_trailing_zeros128(absD) | (d < 0 ? LIBDIVIDE_128_NEGATIVE_DIVISOR : 0);
+        result.magic = 0;
+    }
+    else {
+        const uint32_t floor_log_2_d = 127 - libdivide__count_leading_zeros128(absD);
+
+        //the dividend here is 2**(floor_log_2_d + 127), so the low 128 bit word is 0 and the high word is floor_log_2_d - 1
+        uint16_t more;
+        __uint128_t rem, proposed_m;
+        proposed_m = libdivide_256_div_128_to_128((__uint128_t)1 << (floor_log_2_d - 1), 0, absD, &rem);
+        const __uint128_t e = absD - rem;
+
+        /* We are going to start with a power of floor_log_2_d - 1.  This works if works if e < 2**floor_log_2_d. */
+        if (e < ((__uint128_t)1 << floor_log_2_d)) {
+            /* This power works */
+            more = floor_log_2_d - 1;
+        }
+        else {
+            /* We need to go one higher.  This should not make proposed_m overflow, but it will make it negative when interpreted as an __int128_t. */
+            proposed_m += proposed_m;
+            const __uint128_t twice_rem = rem + rem;
+            if (twice_rem >= absD || twice_rem < rem) proposed_m += 1;
+            more = floor_log_2_d | LIBDIVIDE_128_ADD_MARKER | (d < 0 ? LIBDIVIDE_128_NEGATIVE_DIVISOR : 0);
+        }
+        proposed_m += 1;
+        result.more = more;
+        result.magic = (__int128_t)(d < 0 ? -proposed_m : proposed_m);
+    }
+    return result;
+}
+
+__int128_t libdivide_s128_do(__int128_t numer, const struct libdivide_s128_t *denom) {
+    uint16_t more = denom->more;
+    __int128_t magic = denom->magic;
+    /* All ones if the divisor is negative.  There's no sign bit to extend at the top of a 16 bit more, so it is spelled out. */
+    const __int128_t sign = -(__int128_t)((more & LIBDIVIDE_128_NEGATIVE_DIVISOR) != 0);
+    if (magic == 0) { //shift path
+        uint32_t shifter = more & LIBDIVIDE_128_SHIFT_MASK;
+        __int128_t q = numer + (__int128_t)((__uint128_t)(numer >> 127) & (((__uint128_t)1 << shifter) - 1));
+        q = q >> shifter;
+        q = (q ^ sign) - sign;
+        return q;
+    }
+    else {
+        __int128_t q = libdivide__mullhi_s128(magic, numer);
+        if (more & LIBDIVIDE_128_ADD_MARKER) {
+            q += ((numer ^ sign) - sign);
+        }
+        q >>= more & LIBDIVIDE_128_SHIFT_MASK;
+        q += (q < 0);
+        return q;
+    }
+}
+
+int libdivide_s128_get_algorithm(const struct libdivide_s128_t *denom) {
+    uint16_t more = denom->more;
+    int positiveDivisor = ! (more & LIBDIVIDE_128_NEGATIVE_DIVISOR);
+    if (denom->magic == 0) return (positiveDivisor ? 0 : 1); //shift path
+    else if (more & LIBDIVIDE_128_ADD_MARKER) return (positiveDivisor ? 2 : 3);
+    else return 4;
+}
+
+__int128_t libdivide_s128_do_alg0(__int128_t numer, const struct libdivide_s128_t *denom) {
+    uint32_t shifter = denom->more & LIBDIVIDE_128_SHIFT_MASK;
+    __int128_t q = numer + (__int128_t)((__uint128_t)(numer >> 127) & (((__uint128_t)1 << shifter) - 1));
+    return q >> shifter;
+}
+
+__int128_t libdivide_s128_do_alg1(__int128_t numer, const struct libdivide_s128_t *denom) {
+    uint32_t shifter = denom->more & LIBDIVIDE_128_SHIFT_MASK;
+    __int128_t q = numer + (__int128_t)((__uint128_t)(numer >> 127) & (((__uint128_t)1 << shifter) - 1));
+    return - (q >> shifter);
+}
+
+__int128_t libdivide_s128_do_alg2(__int128_t numer, const struct libdivide_s128_t *denom) {
+    __int128_t q = libdivide__mullhi_s128(denom->magic, numer);
+    q += numer;
+    q >>= denom->more & LIBDIVIDE_128_SHIFT_MASK;
+    q += (q < 0);
+    return q;
+}
+
+__int128_t libdivide_s128_do_alg3(__int128_t numer, const struct libdivide_s128_t *denom) {
+    __int128_t q = libdivide__mullhi_s128(denom->magic, numer);
+    q -= numer;
+    q >>= denom->more & LIBDIVIDE_128_SHIFT_MASK;
+    q += (q < 0);
+    return q;
+}
+
+__int128_t libdivide_s128_do_alg4(__int128_t numer, const struct libdivide_s128_t *denom) {
+    __int128_t q = libdivide__mullhi_s128(denom->magic, numer);
+    q >>= denom->more;
+    q += (q < 0);
+    return q;
+}
+#endif
+
+/////////// REMAINDERS
+
+uint32_t libdivide_u32_divmod(uint32_t numer, const struct libdivide_u32_t *denom, uint32_t *remainder) {
+    uint32_t q = libdivide_u32_do(numer, denom);
+    *remainder = numer - q * denom->divisor;
+    return q;
+}
+
+uint32_t libdivide_u32_mod(uint32_t numer, const struct libdivide_u32_t *denom) {
+    uint32_t r;
+    libdivide_u32_divmod(numer, denom, &r);
+    return r;
+}
+
+int32_t libdivide_s32_divmod(int32_t numer, const struct libdivide_s32_t *denom, int32_t *remainder) {
+    int32_t q = libdivide_s32_do(numer, denom);
+    *remainder = (int32_t)((uint32_t)numer - (uint32_t)q * (uint32_t)denom->divisor);
+    return q;
+}
+
+int32_t libdivide_s32_mod(int32_t numer, const struct libdivide_s32_t *denom) {
+    int32_t r;
+    libdivide_s32_divmod(numer, denom, &r);
+    return r;
+}
+
+uint64_t libdivide_u64_divmod(uint64_t numer, const struct libdivide_u64_t *denom, uint64_t *remainder) {
+    uint64_t q = libdivide_u64_do(numer, denom);
+    *remainder = numer - q * denom->divisor;
+    return q;
+}
+
+uint64_t libdivide_u64_mod(uint64_t numer, const struct libdivide_u64_t *denom) {
+    uint64_t r;
+    libdivide_u64_divmod(numer, denom, &r);
+    return r;
+}
+
+int64_t libdivide_s64_divmod(int64_t numer, const struct libdivide_s64_t *denom, int64_t *remainder) {
+    int64_t q = libdivide_s64_do(numer, denom);
+    *remainder = (int64_t)((uint64_t)numer - (uint64_t)q * (uint64_t)denom->divisor);
+    return q;
+}
+
+int64_t libdivide_s64_mod(int64_t numer, const struct libdivide_s64_t *denom) {
+    int64_t r;
+    libdivide_s64_divmod(numer, denom, &r);
+    return r;
+}
+
+/* The vector remainders divide as usual, then subtract the quotients times the divisor, so divmod is one multiply-high and one multiply-low */
+#if LIBDIVIDE_USE_SSE2
+__m128i libdivide_4u32_divmod_vector(__m128i numers, const struct libdivide_u32_t *denom, __m128i *remainders) {
+    __m128i q = libdivide_4u32_do_vector(numers, denom);
+    *remainders = _mm_sub_epi32(numers, libdivide_mullo_u32_flat_vector(q, _mm_set1_epi32(denom->divisor)));
+    return q;
+}
+
+__m128i libdivide_4u32_mod_vector(__m128i numers, const struct libdivide_u32_t *denom) {
+    __m128i r;
+    libdivide_4u32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+__m128i libdivide_4s32_divmod_vector(__m128i numers, const struct libdivide_s32_t *denom, __m128i *remainders) {
+    __m128i q = libdivide_4s32_do_vector(numers, denom);
+    *remainders = _mm_sub_epi32(numers, libdivide_mullo_u32_flat_vector(q, _mm_set1_epi32(denom->divisor)));
+    return q;
+}
+
+__m128i libdivide_4s32_mod_vector(__m128i numers, const struct libdivide_s32_t *denom) {
+    __m128i r;
+    libdivide_4s32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+__m128i libdivide_2u64_divmod_vector(__m128i numers, const struct libdivide_u64_t *denom, __m128i *remainders) {
+    __m128i q = libdivide_2u64_do_vector(numers, denom);
+    *remainders = _mm_sub_epi64(numers, libdivide_mullo_u64_flat_vector(q, libdivide__u64_to_m128(denom->divisor)));
+    return q;
+}
+
+__m128i libdivide_2u64_mod_vector(__m128i numers, const struct libdivide_u64_t *denom) {
+    __m128i r;
+    libdivide_2u64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+__m128i libdivide_2s64_divmod_vector(__m128i numers, const struct libdivide_s64_t *denom, __m128i *remainders) {
+    __m128i q = libdivide_2s64_do_vector(numers, denom);
+    *remainders = _mm_sub_epi64(numers, libdivide_mullo_u64_flat_vector(q, libdivide__u64_to_m128(denom->divisor)));
+    return q;
+}
+
+__m128i libdivide_2s64_mod_vector(__m128i numers, const struct libdivide_s64_t *denom) {
+    __m128i r;
+    libdivide_2s64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_divmod_vector(__m256i numers, const struct libdivide_u32_t *denom, __m256i *remainders) {
+    __m256i q = libdivide_8u32_do_vector(numers, denom);
+    *remainders = _mm256_sub_epi32(numers, _mm256_mullo_epi32(q, _mm256_set1_epi32(denom->divisor)));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_mod_vector(__m256i numers, const struct libdivide_u32_t *denom) {
+    __m256i r;
+    libdivide_8u32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_divmod_vector(__m256i numers, const struct libdivide_s32_t *denom, __m256i *remainders) {
+    __m256i q = libdivide_8s32_do_vector(numers, denom);
+    *remainders = _mm256_sub_epi32(numers, _mm256_mullo_epi32(q, _mm256_set1_epi32(denom->divisor)));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_mod_vector(__m256i numers, const struct libdivide_s32_t *denom) {
+    __m256i r;
+    libdivide_8s32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_divmod_vector(__m256i numers, const struct libdivide_u64_t *denom, __m256i *remainders) {
+    __m256i q = libdivide_4u64_do_vector(numers, denom);
+    *remainders = _mm256_sub_epi64(numers, libdivide_mullo_4u64_flat_vector(q, libdivide__u64_to_m256i(denom->divisor)));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_mod_vector(__m256i numers, const struct libdivide_u64_t *denom) {
+    __m256i r;
+    libdivide_4u64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_divmod_vector(__m256i numers, const struct libdivide_s64_t *denom, __m256i *remainders) {
+    __m256i q = libdivide_4s64_do_vector(numers, denom);
+    *remainders = _mm256_sub_epi64(numers, libdivide_mullo_4u64_flat_vector(q, libdivide__u64_to_m256i(denom->divisor)));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_mod_vector(__m256i numers, const struct libdivide_s64_t *denom) {
+    __m256i r;
+    libdivide_4s64_divmod_vector(numers, denom, &r);
+    return r;
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_divmod_vector(__m512i numers, const struct libdivide_u32_t *denom, __m512i *remainders) {
+    __m512i q = libdivide_16u32_do_vector(numers, denom);
+    *remainders = _mm512_sub_epi32(numers, _mm512_mullo_epi32(q, _mm512_set1_epi32(denom->divisor)));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_mod_vector(__m512i numers, const struct libdivide_u32_t *denom) {
+    __m512i r;
+    libdivide_16u32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_divmod_vector(__m512i numers, const struct libdivide_s32_t *denom, __m512i *remainders) {
+    __m512i q = libdivide_16s32_do_vector(numers, denom);
+    *remainders = _mm512_sub_epi32(numers, _mm512_mullo_epi32(q, _mm512_set1_epi32(denom->divisor)));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_mod_vector(__m512i numers, const struct libdivide_s32_t *denom) {
+    __m512i r;
+    libdivide_16s32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_divmod_vector(__m512i numers, const struct libdivide_u64_t *denom, __m512i *remainders) {
+    __m512i q = libdivide_8u64_do_vector(numers, denom);
+    *remainders = _mm512_sub_epi64(numers, _mm512_mullo_epi64(q, libdivide__u64_to_m512i(denom->divisor)));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_mod_vector(__m512i numers, const struct libdivide_u64_t *denom) {
+    __m512i r;
+    libdivide_8u64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_divmod_vector(__m512i numers, const struct libdivide_s64_t *denom, __m512i *remainders) {
+    __m512i q = libdivide_8s64_do_vector(numers, denom);
+    *remainders = _mm512_sub_epi64(numers, _mm512_mullo_epi64(q, libdivide__u64_to_m512i(denom->divisor)));
+    return q;
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_mod_vector(__m512i numers, const struct libdivide_s64_t *denom) {
+    __m512i r;
+    libdivide_8s64_divmod_vector(numers, denom, &r);
+    return r;
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+uint32x2_t libdivide_2u32_divmod_vector(uint32x2_t numers, const struct libdivide_u32_t *denom, uint32x2_t *remainders) {
+    uint32x2_t q = libdivide_2u32_do_vector(numers, denom);
+    *remainders = vmls_u32(numers, q, vdup_n_u32(denom->divisor));
+    return q;
+}
+
+uint32x2_t libdivide_2u32_mod_vector(uint32x2_t numers, const struct libdivide_u32_t *denom) {
+    uint32x2_t r;
+    libdivide_2u32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+uint32x4_t libdivide_4u32_divmod_vector(uint32x4_t numers, const struct libdivide_u32_t *denom, uint32x4_t *remainders) {
+    uint32x4_t q = libdivide_4u32_do_vector(numers, denom);
+    *remainders = vmlsq_u32(numers, q, vdupq_n_u32(denom->divisor));
+    return q;
+}
+
+uint32x4_t libdivide_4u32_mod_vector(uint32x4_t numers, const struct libdivide_u32_t *denom) {
+    uint32x4_t r;
+    libdivide_4u32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+uint32x4x2_t libdivide_8u32_divmod_vector(uint32x4x2_t numers, const struct libdivide_u32_t *denom, uint32x4x2_t *remainders) {
+    uint32x4x2_t q = libdivide_8u32_do_vector(numers, denom);
+    uint32x4_t d = vdupq_n_u32(denom->divisor);
+    remainders->val[0] = vmlsq_u32(numers.val[0], q.val[0], d);
+    remainders->val[1] = vmlsq_u32(numers.val[1], q.val[1], d);
+    return q;
+}
+
+uint32x4x2_t libdivide_8u32_mod_vector(uint32x4x2_t numers, const struct libdivide_u32_t *denom) {
+    uint32x4x2_t r;
+    libdivide_8u32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+int32x2_t libdivide_2s32_divmod_vector(int32x2_t numers, const struct libdivide_s32_t *denom, int32x2_t *remainders) {
+    int32x2_t q = libdivide_2s32_do_vector(numers, denom);
+    *remainders = vmls_s32(numers, q, vdup_n_s32(denom->divisor));
+    return q;
+}
+
+int32x2_t libdivide_2s32_mod_vector(int32x2_t numers, const struct libdivide_s32_t *denom) {
+    int32x2_t r;
+    libdivide_2s32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+int32x4_t libdivide_4s32_divmod_vector(int32x4_t numers, const struct libdivide_s32_t *denom, int32x4_t *remainders) {
+    int32x4_t q = libdivide_4s32_do_vector(numers, denom);
+    *remainders = vmlsq_s32(numers, q, vdupq_n_s32(denom->divisor));
+    return q;
+}
+
+int32x4_t libdivide_4s32_mod_vector(int32x4_t numers, const struct libdivide_s32_t *denom) {
+    int32x4_t r;
+    libdivide_4s32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+int32x4x2_t libdivide_8s32_divmod_vector(int32x4x2_t numers, const struct libdivide_s32_t *denom, int32x4x2_t *remainders) {
+    int32x4x2_t q = libdivide_8s32_do_vector(numers, denom);
+    int32x4_t d = vdupq_n_s32(denom->divisor);
+    remainders->val[0] = vmlsq_s32(numers.val[0], q.val[0], d);
+    remainders->val[1] = vmlsq_s32(numers.val[1], q.val[1], d);
+    return q;
+}
+
+int32x4x2_t libdivide_8s32_mod_vector(int32x4x2_t numers, const struct libdivide_s32_t *denom) {
+    int32x4x2_t r;
+    libdivide_8s32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+uint64x1_t libdivide_1u64_divmod_vector(uint64x1_t numers, const struct libdivide_u64_t *denom, uint64x1_t *remainders) {
+    uint64x1_t q = libdivide_1u64_do_vector(numers, denom);
+    *remainders = vsub_u64(numers, vdup_n_u64(vget_lane_u64(q, 0) * denom->divisor));
+    return q;
+}
+
+uint64x1_t libdivide_1u64_mod_vector(uint64x1_t numers, const struct libdivide_u64_t *denom) {
+    uint64x1_t r;
+    libdivide_1u64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+uint64x2_t libdivide_2u64_divmod_vector(uint64x2_t numers, const struct libdivide_u64_t *denom, uint64x2_t *remainders) {
+    uint64x2_t q = libdivide_2u64_do_vector(numers, denom);
+    *remainders = vsubq_u64(numers, libdivide_mullo_2u64_flat_vector(q, vdupq_n_u64(denom->divisor)));
+    return q;
+}
+
+uint64x2_t libdivide_2u64_mod_vector(uint64x2_t numers, const struct libdivide_u64_t *denom) {
+    uint64x2_t r;
+    libdivide_2u64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+uint64x2x2_t libdivide_4u64_divmod_vector(uint64x2x2_t numers, const struct libdivide_u64_t *denom, uint64x2x2_t *remainders) {
+    uint64x2x2_t q = libdivide_4u64_do_vector(numers, denom);
+    uint64x2_t d = vdupq_n_u64(denom->divisor);
+    remainders->val[0] = vsubq_u64(numers.val[0], libdivide_mullo_2u64_flat_vector(q.val[0], d));
+    remainders->val[1] = vsubq_u64(numers.val[1], libdivide_mullo_2u64_flat_vector(q.val[1], d));
+    return q;
+}
+
+uint64x2x2_t libdivide_4u64_mod_vector(uint64x2x2_t numers, const struct libdivide_u64_t *denom) {
+    uint64x2x2_t r;
+    libdivide_4u64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+int64x1_t libdivide_1s64_divmod_vector(int64x1_t numers, const struct libdivide_s64_t *denom, int64x1_t *remainders) {
+    int64x1_t q = libdivide_1s64_do_vector(numers, denom);
+    *remainders = vsub_s64(numers, vdup_n_s64((int64_t)((uint64_t)vget_lane_s64(q, 0) * (uint64_t)denom->divisor)));
+    return q;
+}
+
+int64x1_t libdivide_1s64_mod_vector(int64x1_t numers, const struct libdivide_s64_t *denom) {
+    int64x1_t r;
+    libdivide_1s64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+int64x2_t libdivide_2s64_divmod_vector(int64x2_t numers, const struct libdivide_s64_t *denom, int64x2_t *remainders) {
+    int64x2_t q = libdivide_2s64_do_vector(numers, denom);
+    *remainders = vsubq_s64(numers, vreinterpretq_s64_u64(libdivide_mullo_2u64_flat_vector(vreinterpretq_u64_s64(q), vdupq_n_u64((uint64_t)denom->divisor))));
+    return q;
+}
+
+int64x2_t libdivide_2s64_mod_vector(int64x2_t numers, const struct libdivide_s64_t *denom) {
+    int64x2_t r;
+    libdivide_2s64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+int64x2x2_t libdivide_4s64_divmod_vector(int64x2x2_t numers, const struct libdivide_s64_t *denom, int64x2x2_t *remainders) {
+    int64x2x2_t q = libdivide_4s64_do_vector(numers, denom);
+    uint64x2_t d = vdupq_n_u64((uint64_t)denom->divisor);
+    remainders->val[0] = vsubq_s64(numers.val[0], vreinterpretq_s64_u64(libdivide_mullo_2u64_flat_vector(vreinterpretq_u64_s64(q.val[0]), d)));
+    remainders->val[1] = vsubq_s64(numers.val[1], vreinterpretq_s64_u64(libdivide_mullo_2u64_flat_vector(vreinterpretq_u64_s64(q.val[1]), d)));
+    return q;
+}
+
+int64x2x2_t libdivide_4s64_mod_vector(int64x2x2_t numers, const struct libdivide_s64_t *denom) {
+    int64x2x2_t r;
+    libdivide_4s64_divmod_vector(numers, denom, &r);
+    return r;
+}
+#elif LIBDIVIDE_USE_VECTOR
+libdivide_2u32_t libdivide_2u32_divmod_vector(libdivide_2u32_t numers, const struct libdivide_u32_t *denom, libdivide_2u32_t *remainders) {
+    uint32_t d = denom->divisor;
+    libdivide_2u32_t q = libdivide_2u32_do_vector(numers, denom);
+    *remainders = numers - q * (libdivide_2u32_t) { d, d };
+    return q;
+}
+
+libdivide_2u32_t libdivide_2u32_mod_vector(libdivide_2u32_t numers, const struct libdivide_u32_t *denom) {
+    libdivide_2u32_t r;
+    libdivide_2u32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_4u32_t libdivide_4u32_divmod_vector(libdivide_4u32_t numers, const struct libdivide_u32_t *denom, libdivide_4u32_t *remainders) {
+    uint32_t d = denom->divisor;
+    libdivide_4u32_t q = libdivide_4u32_do_vector(numers, denom);
+    *remainders = numers - q * (libdivide_4u32_t) { d, d, d, d };
+    return q;
+}
+
+libdivide_4u32_t libdivide_4u32_mod_vector(libdivide_4u32_t numers, const struct libdivide_u32_t *denom) {
+    libdivide_4u32_t r;
+    libdivide_4u32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_8u32_t libdivide_8u32_divmod_vector(libdivide_8u32_t numers, const struct libdivide_u32_t *denom, libdivide_8u32_t *remainders) {
+    uint32_t d = denom->divisor;
+    libdivide_8u32_t q = libdivide_8u32_do_vector(numers, denom);
+    *remainders = numers - q * (libdivide_8u32_t) { d, d, d, d, d, d, d, d };
+    return q;
+}
+
+libdivide_8u32_t libdivide_8u32_mod_vector(libdivide_8u32_t numers, const struct libdivide_u32_t *denom) {
+    libdivide_8u32_t r;
+    libdivide_8u32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_1u64_t libdivide_1u64_divmod_vector(libdivide_1u64_t numers, const struct libdivide_u64_t *denom, libdivide_1u64_t *remainders) {
+    uint64_t d = denom->divisor;
+    libdivide_1u64_t q = libdivide_1u64_do_vector(numers, denom);
+    *remainders = numers - q * (libdivide_1u64_t) { d };
+    return q;
+}
+
+libdivide_1u64_t libdivide_1u64_mod_vector(libdivide_1u64_t numers, const struct libdivide_u64_t *denom) {
+    libdivide_1u64_t r;
+    libdivide_1u64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_2u64_t libdivide_2u64_divmod_vector(libdivide_2u64_t numers, const struct libdivide_u64_t *denom, libdivide_2u64_t *remainders) {
+    uint64_t d = denom->divisor;
+    libdivide_2u64_t q = libdivide_2u64_do_vector(numers, denom);
+    *remainders = numers - q * (libdivide_2u64_t) { d, d };
+    return q;
+}
+
+libdivide_2u64_t libdivide_2u64_mod_vector(libdivide_2u64_t numers, const struct libdivide_u64_t *denom) {
+    libdivide_2u64_t r;
+    libdivide_2u64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_4u64_t libdivide_4u64_divmod_vector(libdivide_4u64_t numers, const struct libdivide_u64_t *denom, libdivide_4u64_t *remainders) {
+    uint64_t d = denom->divisor;
+    libdivide_4u64_t q = libdivide_4u64_do_vector(numers, denom);
+    *remainders = numers - q * (libdivide_4u64_t) { d, d, d, d };
+    return q;
+}
+
+libdivide_4u64_t libdivide_4u64_mod_vector(libdivide_4u64_t numers, const struct libdivide_u64_t *denom) {
+    libdivide_4u64_t r;
+    libdivide_4u64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_2s32_t libdivide_2s32_divmod_vector(libdivide_2s32_t numers, const struct libdivide_s32_t *denom, libdivide_2s32_t *remainders) {
+    uint32_t d = (uint32_t)denom->divisor;
+    libdivide_2s32_t q = libdivide_2s32_do_vector(numers, denom);
+    *remainders = (libdivide_2s32_t)((libdivide_2u32_t)numers - (libdivide_2u32_t)q * (libdivide_2u32_t) { d, d }); //unsigned, so that the multiply wraps instead of overflowing
+    return q;
+}
+
+libdivide_2s32_t libdivide_2s32_mod_vector(libdivide_2s32_t numers, const struct libdivide_s32_t *denom) {
+    libdivide_2s32_t r;
+    libdivide_2s32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_4s32_t libdivide_4s32_divmod_vector(libdivide_4s32_t numers, const struct libdivide_s32_t *denom, libdivide_4s32_t *remainders) {
+    uint32_t d = (uint32_t)denom->divisor;
+    libdivide_4s32_t q = libdivide_4s32_do_vector(numers, denom);
+    *remainders = (libdivide_4s32_t)((libdivide_4u32_t)numers - (libdivide_4u32_t)q * (libdivide_4u32_t) { d, d, d, d }); //unsigned, so that the multiply wraps instead of overflowing
+    return q;
+}
+
+libdivide_4s32_t libdivide_4s32_mod_vector(libdivide_4s32_t numers, const struct libdivide_s32_t *denom) {
+    libdivide_4s32_t r;
+    libdivide_4s32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_8s32_t libdivide_8s32_divmod_vector(libdivide_8s32_t numers, const struct libdivide_s32_t *denom, libdivide_8s32_t *remainders) {
+    uint32_t d = (uint32_t)denom->divisor;
+    libdivide_8s32_t q = libdivide_8s32_do_vector(numers, denom);
+    *remainders = (libdivide_8s32_t)((libdivide_8u32_t)numers - (libdivide_8u32_t)q * (libdivide_8u32_t) { d, d, d, d, d, d, d, d }); //unsigned, so that the multiply wraps instead of overflowing
+    return q;
+}
+
+libdivide_8s32_t libdivide_8s32_mod_vector(libdivide_8s32_t numers, const struct libdivide_s32_t *denom) {
+    libdivide_8s32_t r;
+    libdivide_8s32_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_1s64_t libdivide_1s64_divmod_vector(libdivide_1s64_t numers, const struct libdivide_s64_t *denom, libdivide_1s64_t *remainders) {
+    uint64_t d = (uint64_t)denom->divisor;
+    libdivide_1s64_t q = libdivide_1s64_do_vector(numers, denom);
+    *remainders = (libdivide_1s64_t)((libdivide_1u64_t)numers - (libdivide_1u64_t)q * (libdivide_1u64_t) { d }); //unsigned, so that the multiply wraps instead of overflowing
+    return q;
+}
+
+libdivide_1s64_t libdivide_1s64_mod_vector(libdivide_1s64_t numers, const struct libdivide_s64_t *denom) {
+    libdivide_1s64_t r;
+    libdivide_1s64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_2s64_t libdivide_2s64_divmod_vector(libdivide_2s64_t numers, const struct libdivide_s64_t *denom, libdivide_2s64_t *remainders) {
+    uint64_t d = (uint64_t)denom->divisor;
+    libdivide_2s64_t q = libdivide_2s64_do_vector(numers, denom);
+    *remainders = (libdivide_2s64_t)((libdivide_2u64_t)numers - (libdivide_2u64_t)q * (libdivide_2u64_t) { d, d }); //unsigned, so that the multiply wraps instead of overflowing
+    return q;
+}
+
+libdivide_2s64_t libdivide_2s64_mod_vector(libdivide_2s64_t numers, const struct libdivide_s64_t *denom) {
+    libdivide_2s64_t r;
+    libdivide_2s64_divmod_vector(numers, denom, &r);
+    return r;
+}
+
+libdivide_4s64_t libdivide_4s64_divmod_vector(libdivide_4s64_t numers, const struct libdivide_s64_t *denom, libdivide_4s64_t *remainders) {
+    uint64_t d = (uint64_t)denom->divisor;
+    libdivide_4s64_t q = libdivide_4s64_do_vector(numers, denom);
+    *remainders = (libdivide_4s64_t)((libdivide_4u64_t)numers - (libdivide_4u64_t)q * (libdivide_4u64_t) { d, d, d, d }); //unsigned, so that the multiply wraps instead of overflowing
+    return q;
+}
+
+libdivide_4s64_t libdivide_4s64_mod_vector(libdivide_4s64_t numers, const struct libdivide_s64_t *denom) {
+    libdivide_4s64_t r;
+    libdivide_4s64_divmod_vector(numers, denom, &r);
+    return r;
+}
+#endif
+
+/////////// FASTMOD
+
+struct libdivide_u32_fastmod_t libdivide_u32_fastmod_gen(uint32_t d) {
+    struct libdivide_u32_fastmod_t result;
+    result.magic = 0xFFFFFFFFFFFFFFFFULL / d + 1; //wraps to 0 for d == 1, which gives the right answer
+    result.divisor = d;
+    return result;
+}
+
+uint32_t libdivide_u32_fastmod(uint32_t numer, const struct libdivide_u32_fastmod_t *denom) {
+    uint64_t lowbits = denom->magic * numer;
+    return (uint32_t)libdivide__mullhi_u64(lowbits, denom->divisor);
+}
+
+struct libdivide_u64_fastmod_t libdivide_u64_fastmod_gen(uint64_t d) {
+    struct libdivide_u64_fastmod_t result;
+#if HAS_INT128_T
+    __uint128_t magic = ~(__uint128_t)0 / d + 1;
+    result.magic_lo = (uint64_t)magic;
+    result.magic_hi = (uint64_t)(magic >> 64);
+#else
+    uint64_t rem;
+    result.magic_hi = 0xFFFFFFFFFFFFFFFFULL / d;
+    result.magic_lo = libdivide_128_div_64_to_64(0xFFFFFFFFFFFFFFFFULL % d, 0xFFFFFFFFFFFFFFFFULL, d, &rem) + 1;
+    if (result.magic_lo == 0) result.magic_hi++;
+#endif
+    result.divisor = d;
+    return result;
+}
+
+uint64_t libdivide_u64_fastmod(uint64_t numer, const struct libdivide_u64_fastmod_t *denom) {
+    const uint64_t d = denom->divisor;
+    /* lowbits = magic * numer mod 2**128, and the remainder is the top 64 bits of the 192 bit product lowbits * d. */
+    uint64_t lowbits_lo = denom->magic_lo * numer;
+    uint64_t lowbits_hi = denom->magic_hi * numer + libdivide__mullhi_u64(denom->magic_lo, numer);
+    uint64_t mid = lowbits_hi * d;
+    uint64_t sum = mid + libdivide__mullhi_u64(lowbits_lo, d);
+    return libdivide__mullhi_u64(lowbits_hi, d) + (sum < mid);
+}
+
+/* The fastmod array functions.  There are only 128 and 256 bit kernels, so AVX-512 runs the AVX2 ones. */
+static inline void libdivide_u32_fastmod_array_scalar(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_fastmod_t *denom) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        results[i] = libdivide_u32_fastmod(numers[i], denom);
+    }
+}
+
+static inline void libdivide_u64_fastmod_array_scalar(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_fastmod_t *denom) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        results[i] = libdivide_u64_fastmod(numers[i], denom);
+    }
+}
+
+#if LIBDIVIDE_USE_SSE2
+
+/* The remainders of the numerators in the low halves of the 64 bit lanes of numers, also returned in the low halves.  mlo and mhi hold the two halves of the magic number, and d the divisor. */
+static inline __m128i libdivide_fastmod_u32_even_vector(__m128i numers, __m128i mlo, __m128i mhi, __m128i d) {
+    __m128i lowbits = _mm_add_epi64(_mm_mul_epu32(numers, mlo), _mm_slli_epi64(_mm_mul_epu32(numers, mhi), 32));
+    __m128i t = _mm_srli_epi64(_mm_mul_epu32(lowbits, d), 32);
+    return _mm_srli_epi64(_mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(lowbits, 32), d), t), 32);
+}
+
+libdivide_4u32_t libdivide_4u32_fastmod_vector(libdivide_4u32_t numers, const struct libdivide_u32_fastmod_t *denom) {
+    __m128i mlo = _mm_set1_epi32((int32_t)denom->magic);
+    __m128i mhi = _mm_set1_epi32((int32_t)(denom->magic >> 32));
+    __m128i d = _mm_set1_epi32((int32_t)denom->divisor);
+    __m128i even = libdivide_fastmod_u32_even_vector(numers, mlo, mhi, d);
+    __m128i odd = libdivide_fastmod_u32_even_vector(_mm_srli_epi64(numers, 32), mlo, mhi, d);
+    return _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+}
+
+libdivide_2u64_t libdivide_2u64_fastmod_vector(libdivide_2u64_t numers, const struct libdivide_u64_fastmod_t *denom) {
+    __m128i mlo = libdivide__u64_to_m128(denom->magic_lo);
+    __m128i mhi = libdivide__u64_to_m128(denom->magic_hi);
+    __m128i d = libdivide__u64_to_m128(denom->divisor);
+    __m128i lowbits_lo = libdivide_mullo_u64_flat_vector(mlo, numers);
+    __m128i lowbits_hi = _mm_add_epi64(libdivide_mullo_u64_flat_vector(mhi, numers), libdivide_mullhi_u64_flat_vector(mlo, numers));
+    __m128i mid = libdivide_mullo_u64_flat_vector(lowbits_hi, d);
+    __m128i add = libdivide_mullhi_u64_flat_vector(lowbits_lo, d);
+    __m128i sum = _mm_add_epi64(mid, add);
+    //carry out of mid + add, without a 64 bit unsigned compare
+    __m128i carry = _mm_srli_epi64(_mm_or_si128(_mm_and_si128(mid, add), _mm_andnot_si128(sum, _mm_or_si128(mid, add))), 63);
+    return _mm_add_epi64(libdivide_mullhi_u64_flat_vector(lowbits_hi, d), carry);
+}
+
+static inline void libdivide_u32_fastmod_array_sse2(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_fastmod_t *denom) {
+    size_t i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        _mm_storeu_si128((__m128i *)(results + i), libdivide_4u32_fastmod_vector(_mm_loadu_si128((const __m128i *)(numers + i)), denom));
+    }
+    libdivide_u32_fastmod_array_scalar(numers + i, results + i, n - i, denom);
+}
+
+static inline void libdivide_u64_fastmod_array_sse2(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_fastmod_t *denom) {
+    size_t i;
+    for (i = 0; i + 2 <= n; i += 2) {
+        _mm_storeu_si128((__m128i *)(results + i), libdivide_2u64_fastmod_vector(_mm_loadu_si128((const __m128i *)(numers + i)), denom));
+    }
+    libdivide_u64_fastmod_array_scalar(numers + i, results + i, n - i, denom);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_fastmod_8u32_even_vector(__m256i numers, __m256i mlo, __m256i mhi, __m256i d) {
+    __m256i lowbits = _mm256_add_epi64(_mm256_mul_epu32(numers, mlo), _mm256_slli_epi64(_mm256_mul_epu32(numers, mhi), 32));
+    __m256i t = _mm256_srli_epi64(_mm256_mul_epu32(lowbits, d), 32);
+    return _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(lowbits, 32), d), t), 32);
+}
+
+LIBDIVIDE_TARGET_AVX2 libdivide_8u32_t libdivide_8u32_fastmod_vector(libdivide_8u32_t numers, const struct libdivide_u32_fastmod_t *denom) {
+    __m256i mlo = _mm256_set1_epi32((int32_t)denom->magic);
+    __m256i mhi = _mm256_set1_epi32((int32_t)(denom->magic >> 32));
+    __m256i d = _mm256_set1_epi32((int32_t)denom->divisor);
+    __m256i even = libdivide_fastmod_8u32_even_vector(numers, mlo, mhi, d);
+    __m256i odd = libdivide_fastmod_8u32_even_vector(_mm256_srli_epi64(numers, 32), mlo, mhi, d);
+    return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+}
+
+LIBDIVIDE_TARGET_AVX2 libdivide_4u64_t libdivide_4u64_fastmod_vector(libdivide_4u64_t numers, const struct libdivide_u64_fastmod_t *denom) {
+    __m256i mlo = libdivide__u64_to_m256i(denom->magic_lo);
+    __m256i mhi = libdivide__u64_to_m256i(denom->magic_hi);
+    __m256i d = libdivide__u64_to_m256i(denom->divisor);
+    __m256i lowbits_lo = libdivide_mullo_4u64_flat_vector(mlo, numers);
+    __m256i lowbits_hi = _mm256_add_epi64(libdivide_mullo_4u64_flat_vector(mhi, numers), libdivide_mullhi_4u64_flat_vector(mlo, numers));
+    __m256i mid = libdivide_mullo_4u64_flat_vector(lowbits_hi, d);
+    __m256i sum = _mm256_add_epi64(mid, libdivide_mullhi_4u64_flat_vector(lowbits_lo, d));
+    //flip the sign bits so that the signed compare gives sum < mid, which is the carry
+    __m256i sign = _mm256_set1_epi64x((int64_t)(1ULL << 63));
+    __m256i carry = _mm256_cmpgt_epi64(_mm256_xor_si256(mid, sign), _mm256_xor_si256(sum, sign));
+    return _mm256_sub_epi64(libdivide_mullhi_4u64_flat_vector(lowbits_hi, d), carry);
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 void libdivide_u32_fastmod_array_avx2(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_fastmod_t *denom) {
+    size_t i;
+    for (i = 0; i + 8 <= n; i += 8) {
+        _mm256_storeu_si256((__m256i *)(results + i), libdivide_8u32_fastmod_vector(_mm256_loadu_si256((const __m256i *)(numers + i)), denom));
+    }
+    libdivide_u32_fastmod_array_scalar(numers + i, results + i, n - i, denom);
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 void libdivide_u64_fastmod_array_avx2(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_fastmod_t *denom) {
+    size_t i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        _mm256_storeu_si256((__m256i *)(results + i), libdivide_4u64_fastmod_vector(_mm256_loadu_si256((const __m256i *)(numers + i)), denom));
+    }
+    libdivide_u64_fastmod_array_scalar(numers + i, results + i, n - i, denom);
+}
+#endif
+
+/////////// NARROWING DIVISION
+
+struct libdivide_u64_narrow_t libdivide_u64_narrow_gen(uint64_t d) {
+    struct libdivide_u64_narrow_t result;
+    LIBDIVIDE_ASSERT(d != 0);
+    result.shift = (uint8_t)libdivide__count_leading_zeros64(d);
+    result.divisor = d << result.shift;
+    result.reciprocal = libdivide_reciprocal_64(result.divisor);
+    return result;
+}
+
+uint64_t libdivide_u64_narrow_do(uint64_t numer_hi, uint64_t numer_lo, const struct libdivide_u64_narrow_t *denom, uint64_t *remainder) {
+    const uint64_t d = denom->divisor;
+    const int shift = denom->shift;
+    //normalize the numerator along with the divisor.  numer_lo goes right in two steps, so that a shift of 0 doesn't shift by 64
+    const uint64_t u1 = (numer_hi << shift) | ((numer_lo >> (63 - shift)) >> 1);
+    const uint64_t u0 = numer_lo << shift;
+    uint64_t r;
+    const uint64_t q = libdivide_128_div_64_normalized(u1, u0, d, denom->reciprocal, &r);
+    if (remainder) *remainder = r >> shift;
+    return q;
+}
+
+/* Divides n numerators with the scalar function, for the array functions and their tails */
+static inline void libdivide_u64_narrow_do_array_scalar(const uint64_t *numers_hi, const uint64_t *numers_lo, uint64_t *quotients, uint64_t *remainders, size_t n, const struct libdivide_u64_narrow_t *denom) {
+    size_t i;
+    if (remainders) {
+        for (i = 0; i < n; i++) {
+            quotients[i] = libdivide_u64_narrow_do(numers_hi[i], numers_lo[i], denom, remainders + i);
+        }
+    }
+    else {
+        for (i = 0; i < n; i++) {
+            quotients[i] = libdivide_u64_narrow_do(numers_hi[i], numers_lo[i], denom, NULL);
+        }
+    }
+}
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+
+/* All ones in the lanes where a < b, as unsigned.  AVX2 only has a signed compare, so flip the sign bits first. */
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_less_vector(__m256i a, __m256i b) {
+    const __m256i sign = _mm256_set1_epi64x((int64_t)(1ULL << 63));
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign));
+}
+
+libdivide_4u64_t libdivide_4u64_narrow_do_vector(libdivide_4u64_t numers_hi, libdivide_4u64_t numers_lo, const struct libdivide_u64_narrow_t *denom, libdivide_4u64_t *remainders) {
+    const __m256i d = libdivide__u64_to_m256i(denom->divisor);
+    const __m256i reciprocal = libdivide__u64_to_m256i(denom->reciprocal);
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m128i shift = _mm_cvtsi32_si128(denom->shift);
+    //the vector shifts give zero for a count of 64, so numers_lo can go right in one step
+    const __m256i u1 = _mm256_or_si256(_mm256_sll_epi64(numers_hi, shift), _mm256_srl_epi64(numers_lo, _mm_cvtsi32_si128(64 - denom->shift)));
+    const __m256i u0 = _mm256_sll_epi64(numers_lo, shift);
+    //the same steps as the scalar code.  The compares give -1 where they hold, so adding them subtracts one
+    const __m256i q0 = _mm256_add_epi64(libdivide_mullo_4u64_flat_vector(u1, reciprocal), u0);
+    __m256i q1 = _mm256_add_epi64(_mm256_add_epi64(libdivide_mullhi_4u64_flat_vector(u1, reciprocal), u1), one);
+    q1 = _mm256_sub_epi64(q1, libdivide_4u64_less_vector(q0, u0));
+    __m256i r = _mm256_sub_epi64(u0, libdivide_mullo_4u64_flat_vector(q1, d));
+    const __m256i over = libdivide_4u64_less_vector(q0, r);
+    q1 = _mm256_add_epi64(q1, over);
+    r = _mm256_add_epi64(r, _mm256_and_si256(over, d));
+    const __m256i fits = libdivide_4u64_less_vector(r, d);
+    q1 = _mm256_add_epi64(_mm256_add_epi64(q1, one), fits);
+    r = _mm256_sub_epi64(r, _mm256_andnot_si256(fits, d));
+    *remainders = _mm256_srl_epi64(r, shift);
+    return q1;
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 void libdivide_u64_narrow_do_array_avx2(const uint64_t *numers_hi, const uint64_t *numers_lo, uint64_t *quotients, uint64_t *remainders, size_t n, const struct libdivide_u64_narrow_t *denom) {
+    size_t i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m256i r, q = libdivide_4u64_narrow_do_vector(_mm256_loadu_si256((const __m256i *)(numers_hi + i)), _mm256_loadu_si256((const __m256i *)(numers_lo + i)), denom, &r);
+        _mm256_storeu_si256((__m256i *)(quotients + i), q);
+        if (remainders) _mm256_storeu_si256((__m256i *)(remainders + i), r);
+    }
+    libdivide_u64_narrow_do_array_scalar(numers_hi + i, numers_lo + i, quotients + i, remainders ? remainders + i : NULL, n - i, denom);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+libdivide_8u64_t libdivide_8u64_narrow_do_vector(libdivide_8u64_t numers_hi, libdivide_8u64_t numers_lo, const struct libdivide_u64_narrow_t *denom, libdivide_8u64_t *remainders) {
+    const __m512i d = libdivide__u64_to_m512i(denom->divisor);
+    const __m512i reciprocal = libdivide__u64_to_m512i(denom->reciprocal);
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m128i shift = _mm_cvtsi32_si128(denom->shift);
+    const __m512i u1 = _mm512_or_si512(_mm512_sll_epi64(numers_hi, shift), _mm512_srl_epi64(numers_lo, _mm_cvtsi32_si128(64 - denom->shift)));
+    const __m512i u0 = _mm512_sll_epi64(numers_lo, shift);
+    //the same steps as the scalar code, with the compares giving lane masks
+    const __m512i q0 = _mm512_add_epi64(_mm512_mullo_epi64(u1, reciprocal), u0);
+    __m512i q1 = _mm512_add_epi64(_mm512_add_epi64(libdivide_mullhi_8u64_flat_vector(u1, reciprocal), u1), one);
+    q1 = _mm512_mask_add_epi64(q1, _mm512_cmplt_epu64_mask(q0, u0), q1, one);
+    __m512i r = _mm512_sub_epi64(u0, _mm512_mullo_epi64(q1, d));
+    __mmask8 m = _mm512_cmplt_epu64_mask(q0, r);
+    q1 = _mm512_mask_sub_epi64(q1, m, q1, one);
+    r = _mm512_mask_add_epi64(r, m, r, d);
+    m = _mm512_cmpge_epu64_mask(r, d);
+    q1 = _mm512_mask_add_epi64(q1, m, q1, one);
+    r = _mm512_mask_sub_epi64(r, m, r, d);
+    *remainders = _mm512_srl_epi64(r, shift);
+    return q1;
+}
+
+/* The tail is one masked vector; the lanes past the end load as zero, which is safe to divide */
+static inline LIBDIVIDE_TARGET_AVX512 void libdivide_u64_narrow_do_array_avx512(const uint64_t *numers_hi, const uint64_t *numers_lo, uint64_t *quotients, uint64_t *remainders, size_t n, const struct libdivide_u64_narrow_t *denom) {
+    size_t i;
+    __m512i q, r;
+    for (i = 0; i + 8 <= n; i += 8) {
+        q = libdivide_8u64_narrow_do_vector(_mm512_loadu_si512((const void *)(numers_hi + i)), _mm512_loadu_si512((const void *)(numers_lo + i)), denom, &r);
+        _mm512_storeu_si512((void *)(quotients + i), q);
+        if (remainders) _mm512_storeu_si512((void *)(remainders + i), r);
+    }
+    if (i < n) {
+        q = libdivide_8u64_narrow_do_vector(libdivide_maskz_loadu_512(numers_hi + i, n - i, sizeof(uint64_t)), libdivide_maskz_loadu_512(numers_lo + i, n - i, sizeof(uint64_t)), denom, &r);
+        libdivide_mask_storeu_512(quotients + i, n - i, sizeof(uint64_t), q);
+        if (remainders) libdivide_mask_storeu_512(remainders + i, n - i, sizeof(uint64_t), r);
+    }
+}
+#endif
+
+/////////// DIVISIBILITY
+
+struct libdivide_u32_divisible_t libdivide_u32_divisible_gen(uint32_t d) {
+    struct libdivide_u32_divisible_t result;
+    LIBDIVIDE_ASSERT(d != 0);
+    result.shift = (uint8_t)libdivide__count_trailing_zeros32(d);
+    result.inverse = libdivide__mod_inverse_u32(d >> result.shift);
+    result.threshold = 0xFFFFFFFFU / d;
+    return result;
+}
+
+int libdivide_u32_is_divisible(uint32_t numer, const struct libdivide_u32_divisible_t *denom) {
+    return libdivide__rotr32(numer * denom->inverse, denom->shift) <= denom->threshold;
+}
+
+struct libdivide_s32_divisible_t libdivide_s32_divisible_gen(int32_t d) {
+    struct libdivide_s32_divisible_t result;
+    LIBDIVIDE_ASSERT(d != 0);
+    const uint32_t absD = d < 0 ? -(uint32_t)d : (uint32_t)d;
+    result.shift = (uint8_t)libdivide__count_trailing_zeros32(absD);
+    const uint32_t odd = absD >> result.shift;
+    result.inverse = libdivide__mod_inverse_u32(odd);
+    /* The multiples of odd between INT32_MIN and INT32_MAX are q * odd with -offset/2**shift <= q <= offset/2**shift, so adding offset maps them onto 0 .. 2 * offset.  odd == 1 is special, since then INT32_MIN is a multiple too, and the range is the whole 32 bits. */
+    result.offset = ((1U << 31) / odd) & (0xFFFFFFFFU << result.shift);
+    result.threshold = odd == 1 ? 0xFFFFFFFFU >> result.shift : (result.offset << 1) >> result.shift;
+    return result;
+}
+
+int libdivide_s32_is_divisible(int32_t numer, const struct libdivide_s32_divisible_t *denom) {
+    return libdivide__rotr32((uint32_t)numer * denom->inverse + denom->offset, denom->shift) <= denom->threshold;
+}
+
+struct libdivide_u64_divisible_t libdivide_u64_divisible_gen(uint64_t d) {
+    struct libdivide_u64_divisible_t result;
+    LIBDIVIDE_ASSERT(d != 0);
+    result.shift = (uint8_t)libdivide__count_trailing_zeros64(d);
+    result.inverse = libdivide__mod_inverse_u64(d >> result.shift);
+    result.threshold = 0xFFFFFFFFFFFFFFFFULL / d;
+    return result;
+}
+
+int libdivide_u64_is_divisible(uint64_t numer, const struct libdivide_u64_divisible_t *denom) {
+    return libdivide__rotr64(numer * denom->inverse, denom->shift) <= denom->threshold;
+}
+
+struct libdivide_s64_divisible_t libdivide_s64_divisible_gen(int64_t d) {
+    struct libdivide_s64_divisible_t result;
+    LIBDIVIDE_ASSERT(d != 0);
+    const uint64_t absD = d < 0 ? -(uint64_t)d : (uint64_t)d;
+    result.shift = (uint8_t)libdivide__count_trailing_zeros64(absD);
+    const uint64_t odd = absD >> result.shift;
+    result.inverse = libdivide__mod_inverse_u64(odd);
+    result.offset = ((1ULL << 63) / odd) & (0xFFFFFFFFFFFFFFFFULL << result.shift);
+    result.threshold = odd == 1 ? 0xFFFFFFFFFFFFFFFFULL >> result.shift : (result.offset << 1) >> result.shift;
+    return result;
+}
+
+int libdivide_s64_is_divisible(int64_t numer, const struct libdivide_s64_divisible_t *denom) {
+    return libdivide__rotr64((uint64_t)numer * denom->inverse + denom->offset, denom->shift) <= denom->threshold;
+}
+
+#if LIBDIVIDE_USE_SSE2
+
+/* Rotates x right by shift and returns all ones in the lanes where the result is at most threshold, unsigned */
+static inline __m128i libdivide_divisible_u32_flat_vector(__m128i x, int shift, uint32_t threshold) {
+    x = _mm_or_si128(_mm_srl_epi32(x, _mm_cvtsi32_si128(shift)), _mm_sll_epi32(x, _mm_cvtsi32_si128(32 - shift)));
+#if LIBDIVIDE_USE_SSE4_1
+    return _mm_cmpeq_epi32(_mm_min_epu32(x, _mm_set1_epi32(threshold)), x);
+#else
+    const __m128i sign = _mm_set1_epi32(1U << 31);
+    return _mm_xor_si128(_mm_cmpgt_epi32(_mm_xor_si128(x, sign), _mm_set1_epi32(threshold ^ (1U << 31))), _mm_set1_epi32(-1));
+#endif
+}
+
+static inline __m128i libdivide_divisible_u64_flat_vector(__m128i x, int shift, uint64_t threshold) {
+    x = _mm_or_si128(_mm_srl_epi64(x, _mm_cvtsi32_si128(shift)), _mm_sll_epi64(x, _mm_cvtsi32_si128(64 - shift)));
+    //x <= threshold exactly when threshold - x doesn't borrow; SSE2 has no 64 bit compare
+    __m128i t = libdivide__u64_to_m128(threshold);
+    __m128i diff = _mm_sub_epi64(t, x);
+    __m128i borrow = _mm_srli_epi64(_mm_or_si128(_mm_andnot_si128(t, x), _mm_andnot_si128(_mm_xor_si128(t, x), diff)), 63);
+    return _mm_add_epi64(borrow, _mm_set1_epi32(-1));
+}
+
+__m128i libdivide_4u32_is_divisible_vector(__m128i numers, const struct libdivide_u32_divisible_t *denom) {
+    __m128i x = libdivide_mullo_u32_flat_vector(numers, _mm_set1_epi32(denom->inverse));
+    return libdivide_divisible_u32_flat_vector(x, denom->shift, denom->threshold);
+}
+
+__m128i libdivide_4s32_is_divisible_vector(__m128i numers, const struct libdivide_s32_divisible_t *denom) {
+    __m128i x = _mm_add_epi32(libdivide_mullo_u32_flat_vector(numers, _mm_set1_epi32(denom->inverse)), _mm_set1_epi32(denom->offset));
+    return libdivide_divisible_u32_flat_vector(x, denom->shift, denom->threshold);
+}
+
+__m128i libdivide_2u64_is_divisible_vector(__m128i numers, const struct libdivide_u64_divisible_t *denom) {
+    __m128i x = libdivide_mullo_u64_flat_vector(numers, libdivide__u64_to_m128(denom->inverse));
+    return libdivide_divisible_u64_flat_vector(x, denom->shift, denom->threshold);
+}
+
+__m128i libdivide_2s64_is_divisible_vector(__m128i numers, const struct libdivide_s64_divisible_t *denom) {
+    __m128i x = _mm_add_epi64(libdivide_mullo_u64_flat_vector(numers, libdivide__u64_to_m128(denom->inverse)), libdivide__u64_to_m128(denom->offset));
+    return libdivide_divisible_u64_flat_vector(x, denom->shift, denom->threshold);
+}
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_divisible_8u32_flat_vector(__m256i x, int shift, uint32_t threshold) {
+    x = _mm256_or_si256(_mm256_srl_epi32(x, _mm_cvtsi32_si128(shift)), _mm256_sll_epi32(x, _mm_cvtsi32_si128(32 - shift)));
+    return _mm256_cmpeq_epi32(_mm256_min_epu32(x, _mm256_set1_epi32(threshold)), x);
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_divisible_4u64_flat_vector(__m256i x, int shift, uint64_t threshold) {
+    x = _mm256_or_si256(_mm256_srl_epi64(x, _mm_cvtsi32_si128(shift)), _mm256_sll_epi64(x, _mm_cvtsi32_si128(64 - shift)));
+    //flip the sign bits so that the signed compare is unsigned
+    const __m256i sign = libdivide__u64_to_m256i(1ULL << 63);
+    __m256i above = _mm256_cmpgt_epi64(_mm256_xor_si256(x, sign), libdivide__u64_to_m256i(threshold ^ (1ULL << 63)));
+    return _mm256_xor_si256(above, _mm256_set1_epi32(-1));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_is_divisible_vector(__m256i numers, const struct libdivide_u32_divisible_t *denom) {
+    __m256i x = _mm256_mullo_epi32(numers, _mm256_set1_epi32(denom->inverse));
+    return libdivide_divisible_8u32_flat_vector(x, denom->shift, denom->threshold);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_is_divisible_vector(__m256i numers, const struct libdivide_s32_divisible_t *denom) {
+    __m256i x = _mm256_add_epi32(_mm256_mullo_epi32(numers, _mm256_set1_epi32(denom->inverse)), _mm256_set1_epi32(denom->offset));
+    return libdivide_divisible_8u32_flat_vector(x, denom->shift, denom->threshold);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_is_divisible_vector(__m256i numers, const struct libdivide_u64_divisible_t *denom) {
+    __m256i x = libdivide_mullo_4u64_flat_vector(numers, libdivide__u64_to_m256i(denom->inverse));
+    return libdivide_divisible_4u64_flat_vector(x, denom->shift, denom->threshold);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_is_divisible_vector(__m256i numers, const struct libdivide_s64_divisible_t *denom) {
+    __m256i x = _mm256_add_epi64(libdivide_mullo_4u64_flat_vector(numers, libdivide__u64_to_m256i(denom->inverse)), libdivide__u64_to_m256i(denom->offset));
+    return libdivide_divisible_4u64_flat_vector(x, denom->shift, denom->threshold);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __mmask16 libdivide_16u32_is_divisible_vector(__m512i numers, const struct libdivide_u32_divisible_t *denom) {
+    __m512i x = _mm512_mullo_epi32(numers, _mm512_set1_epi32(denom->inverse));
+    x = _mm512_rorv_epi32(x, _mm512_set1_epi32(denom->shift));
+    return _mm512_cmple_epu32_mask(x, _mm512_set1_epi32(denom->threshold));
+}
+
+LIBDIVIDE_TARGET_AVX512 __mmask16 libdivide_16s32_is_divisible_vector(__m512i numers, const struct libdivide_s32_divisible_t *denom) {
+    __m512i x = _mm512_add_epi32(_mm512_mullo_epi32(numers, _mm512_set1_epi32(denom->inverse)), _mm512_set1_epi32(denom->offset));
+    x = _mm512_rorv_epi32(x, _mm512_set1_epi32(denom->shift));
+    return _mm512_cmple_epu32_mask(x, _mm512_set1_epi32(denom->threshold));
+}
+
+LIBDIVIDE_TARGET_AVX512 __mmask8 libdivide_8u64_is_divisible_vector(__m512i numers, const struct libdivide_u64_divisible_t *denom) {
+    __m512i x = _mm512_mullo_epi64(numers, libdivide__u64_to_m512i(denom->inverse));
+    x = _mm512_rorv_epi64(x, libdivide__u64_to_m512i(denom->shift));
+    return _mm512_cmple_epu64_mask(x, libdivide__u64_to_m512i(denom->threshold));
+}
+
+LIBDIVIDE_TARGET_AVX512 __mmask8 libdivide_8s64_is_divisible_vector(__m512i numers, const struct libdivide_s64_divisible_t *denom) {
+    __m512i x = _mm512_add_epi64(_mm512_mullo_epi64(numers, libdivide__u64_to_m512i(denom->inverse)), libdivide__u64_to_m512i(denom->offset));
+    x = _mm512_rorv_epi64(x, libdivide__u64_to_m512i(denom->shift));
+    return _mm512_cmple_epu64_mask(x, libdivide__u64_to_m512i(denom->threshold));
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+/* NEON shifts right by negative counts, and shifting by the lane width gives zero, so a rotate is two shifts and an or */
+static inline uint32x2_t libdivide_divisible_2u32_flat_vector(uint32x2_t x, int shift, uint32_t threshold) {
+    x = vorr_u32(vshl_u32(x, vdup_n_s32(-shift)), vshl_u32(x, vdup_n_s32(32 - shift)));
+    return vcle_u32(x, vdup_n_u32(threshold));
+}
+
+static inline uint32x4_t libdivide_divisible_4u32_flat_vector(uint32x4_t x, int shift, uint32_t threshold) {
+    x = vorrq_u32(vshlq_u32(x, vdupq_n_s32(-shift)), vshlq_u32(x, vdupq_n_s32(32 - shift)));
+    return vcleq_u32(x, vdupq_n_u32(threshold));
+}
+
+static inline uint64x2_t libdivide_divisible_2u64_flat_vector(uint64x2_t x, int shift, uint64_t threshold) {
+    x = vorrq_u64(vshlq_u64(x, vdupq_n_s64(-shift)), vshlq_u64(x, vdupq_n_s64(64 - shift)));
+    //x <= threshold exactly when threshold - x doesn't borrow, which also works without the AArch64 64 bit compares
+    uint64x2_t t = vdupq_n_u64(threshold);
+    uint64x2_t borrow = vshrq_n_u64(vorrq_u64(vbicq_u64(x, t), vbicq_u64(vsubq_u64(t, x), veorq_u64(t, x))), 63);
+    return vsubq_u64(borrow, vdupq_n_u64(1));
+}
+
+uint32x2_t libdivide_2u32_is_divisible_vector(uint32x2_t numers, const struct libdivide_u32_divisible_t *denom) {
+    return libdivide_divisible_2u32_flat_vector(vmul_u32(numers, vdup_n_u32(denom->inverse)), denom->shift, denom->threshold);
+}
+
+uint32x4_t libdivide_4u32_is_divisible_vector(uint32x4_t numers, const struct libdivide_u32_divisible_t *denom) {
+    return libdivide_divisible_4u32_flat_vector(vmulq_u32(numers, vdupq_n_u32(denom->inverse)), denom->shift, denom->threshold);
+}
+
+uint32x4x2_t libdivide_8u32_is_divisible_vector(uint32x4x2_t numers, const struct libdivide_u32_divisible_t *denom) {
+    uint32x4x2_t result;
+    result.val[0] = libdivide_4u32_is_divisible_vector(numers.val[0], denom);
+    result.val[1] = libdivide_4u32_is_divisible_vector(numers.val[1], denom);
+    return result;
+}
+
+int32x2_t libdivide_2s32_is_divisible_vector(int32x2_t numers, const struct libdivide_s32_divisible_t *denom) {
+    uint32x2_t x = vmla_u32(vdup_n_u32(denom->offset), vreinterpret_u32_s32(numers), vdup_n_u32(denom->inverse));
+    return vreinterpret_s32_u32(libdivide_divisible_2u32_flat_vector(x, denom->shift, denom->threshold));
+}
+
+int32x4_t libdivide_4s32_is_divisible_vector(int32x4_t numers, const struct libdivide_s32_divisible_t *denom) {
+    uint32x4_t x = vmlaq_u32(vdupq_n_u32(denom->offset), vreinterpretq_u32_s32(numers), vdupq_n_u32(denom->inverse));
+    return vreinterpretq_s32_u32(libdivide_divisible_4u32_flat_vector(x, denom->shift, denom->threshold));
+}
+
+int32x4x2_t libdivide_8s32_is_divisible_vector(int32x4x2_t numers, const struct libdivide_s32_divisible_t *denom) {
+    int32x4x2_t result;
+    result.val[0] = libdivide_4s32_is_divisible_vector(numers.val[0], denom);
+    result.val[1] = libdivide_4s32_is_divisible_vector(numers.val[1], denom);
+    return result;
+}
+
+uint64x1_t libdivide_1u64_is_divisible_vector(uint64x1_t numers, const struct libdivide_u64_divisible_t *denom) {
+    return vdup_n_u64(-(uint64_t)libdivide_u64_is_divisible(vget_lane_u64(numers, 0), denom));
+}
+
+uint64x2_t libdivide_2u64_is_divisible_vector(uint64x2_t numers, const struct libdivide_u64_divisible_t *denom) {
+    uint64x2_t x = libdivide_mullo_2u64_flat_vector(numers, vdupq_n_u64(denom->inverse));
+    return libdivide_divisible_2u64_flat_vector(x, denom->shift, denom->threshold);
+}
+
+uint64x2x2_t libdivide_4u64_is_divisible_vector(uint64x2x2_t numers, const struct libdivide_u64_divisible_t *denom) {
+    uint64x2x2_t result;
+    result.val[0] = libdivide_2u64_is_divisible_vector(numers.val[0], denom);
+    result.val[1] = libdivide_2u64_is_divisible_vector(numers.val[1], denom);
+    return result;
+}
+
+int64x1_t libdivide_1s64_is_divisible_vector(int64x1_t numers, const struct libdivide_s64_divisible_t *denom) {
+    return vdup_n_s64(-(int64_t)libdivide_s64_is_divisible(vget_lane_s64(numers, 0), denom));
+}
+
+int64x2_t libdivide_2s64_is_divisible_vector(int64x2_t numers, const struct libdivide_s64_divisible_t *denom) {
+    uint64x2_t x = vaddq_u64(libdivide_mullo_2u64_flat_vector(vreinterpretq_u64_s64(numers), vdupq_n_u64(denom->inverse)), vdupq_n_u64(denom->offset));
+    return vreinterpretq_s64_u64(libdivide_divisible_2u64_flat_vector(x, denom->shift, denom->threshold));
+}
+
+int64x2x2_t libdivide_4s64_is_divisible_vector(int64x2x2_t numers, const struct libdivide_s64_divisible_t *denom) {
+    int64x2x2_t result;
+    result.val[0] = libdivide_2s64_is_divisible_vector(numers.val[0], denom);
+    result.val[1] = libdivide_2s64_is_divisible_vector(numers.val[1], denom);
+    return result;
+}
+#elif LIBDIVIDE_USE_VECTOR
+libdivide_2u32_t libdivide_2u32_is_divisible_vector(libdivide_2u32_t numers, const struct libdivide_u32_divisible_t *denom) {
+    uint32_t inverse = denom->inverse, threshold = denom->threshold;
+    libdivide_2u32_t x = numers * (libdivide_2u32_t) { inverse, inverse };
+    x = (x >> denom->shift) | (x << ((32 - denom->shift) & 31));
+    return (libdivide_2u32_t)(x <= (libdivide_2u32_t) { threshold, threshold });
+}
+
+libdivide_4u32_t libdivide_4u32_is_divisible_vector(libdivide_4u32_t numers, const struct libdivide_u32_divisible_t *denom) {
+    uint32_t inverse = denom->inverse, threshold = denom->threshold;
+    libdivide_4u32_t x = numers * (libdivide_4u32_t) { inverse, inverse, inverse, inverse };
+    x = (x >> denom->shift) | (x << ((32 - denom->shift) & 31));
+    return (libdivide_4u32_t)(x <= (libdivide_4u32_t) { threshold, threshold, threshold, threshold });
+}
+
+libdivide_8u32_t libdivide_8u32_is_divisible_vector(libdivide_8u32_t numers, const struct libdivide_u32_divisible_t *denom) {
+    uint32_t inverse = denom->inverse, threshold = denom->threshold;
+    libdivide_8u32_t x = numers * (libdivide_8u32_t) { inverse, inverse, inverse, inverse, inverse, inverse, inverse, inverse };
+    x = (x >> denom->shift) | (x << ((32 - denom->shift) & 31));
+    return (libdivide_8u32_t)(x <= (libdivide_8u32_t) { threshold, threshold, threshold, threshold, threshold, threshold, threshold, threshold });
+}
+
+libdivide_1u64_t libdivide_1u64_is_divisible_vector(libdivide_1u64_t numers, const struct libdivide_u64_divisible_t *denom) {
+    uint64_t inverse = denom->inverse, threshold = denom->threshold;
+    libdivide_1u64_t x = numers * (libdivide_1u64_t) { inverse };
+    x = (x >> denom->shift) | (x << ((64 - denom->shift) & 63));
+    return (libdivide_1u64_t)(x <= (libdivide_1u64_t) { threshold });
+}
+
+libdivide_2u64_t libdivide_2u64_is_divisible_vector(libdivide_2u64_t numers, const struct libdivide_u64_divisible_t *denom) {
+    uint64_t inverse = denom->inverse, threshold = denom->threshold;
+    libdivide_2u64_t x = numers * (libdivide_2u64_t) { inverse, inverse };
+    x = (x >> denom->shift) | (x << ((64 - denom->shift) & 63));
+    return (libdivide_2u64_t)(x <= (libdivide_2u64_t) { threshold, threshold });
+}
+
+libdivide_4u64_t libdivide_4u64_is_divisible_vector(libdivide_4u64_t numers, const struct libdivide_u64_divisible_t *denom) {
+    uint64_t inverse = denom->inverse, threshold = denom->threshold;
+    libdivide_4u64_t x = numers * (libdivide_4u64_t) { inverse, inverse, inverse, inverse };
+    x = (x >> denom->shift) | (x << ((64 - denom->shift) & 63));
+    return (libdivide_4u64_t)(x <= (libdivide_4u64_t) { threshold, threshold, threshold, threshold });
+}
+
+libdivide_2s32_t libdivide_2s32_is_divisible_vector(libdivide_2s32_t numers, const struct libdivide_s32_divisible_t *denom) {
+    uint32_t inverse = denom->inverse, threshold = denom->threshold;
+    uint32_t offset = denom->offset;
+    libdivide_2u32_t x = (libdivide_2u32_t)numers * (libdivide_2u32_t) { inverse, inverse } + (libdivide_2u32_t) { offset, offset };
+    x = (x >> denom->shift) | (x << ((32 - denom->shift) & 31));
+    return (libdivide_2s32_t)(x <= (libdivide_2u32_t) { threshold, threshold });
+}
+
+libdivide_4s32_t libdivide_4s32_is_divisible_vector(libdivide_4s32_t numers, const struct libdivide_s32_divisible_t *denom) {
+    uint32_t inverse = denom->inverse, threshold = denom->threshold;
+    uint32_t offset = denom->offset;
+    libdivide_4u32_t x = (libdivide_4u32_t)numers * (libdivide_4u32_t) { inverse, inverse, inverse, inverse } + (libdivide_4u32_t) { offset, offset, offset, offset };
+    x = (x >> denom->shift) | (x << ((32 - denom->shift) & 31));
+    return (libdivide_4s32_t)(x <= (libdivide_4u32_t) { threshold, threshold, threshold, threshold });
+}
+
+libdivide_8s32_t libdivide_8s32_is_divisible_vector(libdivide_8s32_t numers, const struct libdivide_s32_divisible_t *denom) {
+    uint32_t inverse = denom->inverse, threshold = denom->threshold;
+    uint32_t offset = denom->offset;
+    libdivide_8u32_t x = (libdivide_8u32_t)numers * (libdivide_8u32_t) { inverse, inverse, inverse, inverse, inverse, inverse, inverse, inverse } + (libdivide_8u32_t) { offset, offset, offset, offset, offset, offset, offset, offset };
+    x = (x >> denom->shift) | (x << ((32 - denom->shift) & 31));
+    return (libdivide_8s32_t)(x <= (libdivide_8u32_t) { threshold, threshold, threshold, threshold, threshold, threshold, threshold, threshold });
+}
+
+libdivide_1s64_t libdivide_1s64_is_divisible_vector(libdivide_1s64_t numers, const struct libdivide_s64_divisible_t *denom) {
+    uint64_t inverse = denom->inverse, threshold = denom->threshold;
+    uint64_t offset = denom->offset;
+    libdivide_1u64_t x = (libdivide_1u64_t)numers * (libdivide_1u64_t) { inverse } + (libdivide_1u64_t) { offset };
+    x = (x >> denom->shift) | (x << ((64 - denom->shift) & 63));
+    return (libdivide_1s64_t)(x <= (libdivide_1u64_t) { threshold });
+}
+
+libdivide_2s64_t libdivide_2s64_is_divisible_vector(libdivide_2s64_t numers, const struct libdivide_s64_divisible_t *denom) {
+    uint64_t inverse = denom->inverse, threshold = denom->threshold;
+    uint64_t offset = denom->offset;
+    libdivide_2u64_t x = (libdivide_2u64_t)numers * (libdivide_2u64_t) { inverse, inverse } + (libdivide_2u64_t) { offset, offset };
+    x = (x >> denom->shift) | (x << ((64 - denom->shift) & 63));
+    return (libdivide_2s64_t)(x <= (libdivide_2u64_t) { threshold, threshold });
+}
+
+libdivide_4s64_t libdivide_4s64_is_divisible_vector(libdivide_4s64_t numers, const struct libdivide_s64_divisible_t *denom) {
+    uint64_t inverse = denom->inverse, threshold = denom->threshold;
+    uint64_t offset = denom->offset;
+    libdivide_4u64_t x = (libdivide_4u64_t)numers * (libdivide_4u64_t) { inverse, inverse, inverse, inverse } + (libdivide_4u64_t) { offset, offset, offset, offset };
+    x = (x >> denom->shift) | (x << ((64 - denom->shift) & 63));
+    return (libdivide_4s64_t)(x <= (libdivide_4u64_t) { threshold, threshold, threshold, threshold });
+}
+#endif
+
+/////////// EXACT DIVISION
+
+#if LIBDIVIDE_ASSERTIONS_ON
+/* The inverse of the inverse is the odd part of d again, so the assertions can recover d and check the remainder without widening the exact structs. */
+static inline void libdivide__u32_exact_assert(uint32_t numer, const struct libdivide_u32_exact_t *denom) {
+    const uint32_t d = libdivide__mod_inverse_u32(denom->inverse) << denom->shift;
+    LIBDIVIDE_ASSERT(numer % d == 0);
+}
+
+static inline void libdivide__s32_exact_assert(int32_t numer, const struct libdivide_s32_exact_t *denom) {
+    const int32_t d = (int32_t)(libdivide__mod_inverse_u32(denom->inverse) << denom->shift);
+    LIBDIVIDE_ASSERT(d == -1 || numer % d == 0);
+}
+
+static inline void libdivide__u64_exact_assert(uint64_t numer, const struct libdivide_u64_exact_t *denom) {
+    const uint64_t d = libdivide__mod_inverse_u64(denom->inverse) << denom->shift;
+    LIBDIVIDE_ASSERT(numer % d == 0);
+}
+
+static inline void libdivide__s64_exact_assert(int64_t numer, const struct libdivide_s64_exact_t *denom) {
+    const int64_t d = (int64_t)(libdivide__mod_inverse_u64(denom->inverse) << denom->shift);
+    LIBDIVIDE_ASSERT(d == -1 || numer % d == 0);
+}
+
+/* Checks each lane of a vector of numerators, with TYPE one of u32, s32, u64 or s64 */
+#define LIBDIVIDE_ASSERT_EXACT_VECTOR(TYPE, INT_TYPE, numers, denom) do { \
+    INT_TYPE lanes[sizeof(numers) / sizeof(INT_TYPE)]; \
+    size_t lane; \
+    memcpy(lanes, &(numers), sizeof(numers)); \
+    for (lane = 0; lane < sizeof(numers) / sizeof(INT_TYPE); lane++) libdivide__##TYPE##_exact_assert(lanes[lane], denom); \
+} while (0)
+#else
+#define LIBDIVIDE_ASSERT_EXACT_VECTOR(TYPE, INT_TYPE, numers, denom)
+#endif
+
+struct libdivide_u32_exact_t libdivide_u32_exact_gen(uint32_t d) {
+    struct libdivide_u32_exact_t result;
+    LIBDIVIDE_ASSERT(d != 0);
+    result.shift = (uint8_t)libdivide__count_trailing_zeros32(d);
+    result.inverse = libdivide__mod_inverse_u32(d >> result.shift);
+    return result;
+}
+
+uint32_t libdivide_u32_exact_do(uint32_t numer, const struct libdivide_u32_exact_t *denom) {
+#if LIBDIVIDE_ASSERTIONS_ON
+    libdivide__u32_exact_assert(numer, denom);
+#endif
+    return (numer >> denom->shift) * denom->inverse;
+}
+
+struct libdivide_s32_exact_t libdivide_s32_exact_gen(int32_t d) {
+    struct libdivide_s32_exact_t result;
+    LIBDIVIDE_ASSERT(d != 0);
+    result.shift = (uint8_t)libdivide__count_trailing_zeros32((uint32_t)d);
+    result.inverse = libdivide__mod_inverse_u32((uint32_t)(d >> result.shift));
+    return result;
+}
+
+int32_t libdivide_s32_exact_do(int32_t numer, const struct libdivide_s32_exact_t *denom) {
+#if LIBDIVIDE_ASSERTIONS_ON
+    libdivide__s32_exact_assert(numer, denom);
+#endif
+    //the low bits of a multiple are zero, so the arithmetic shift is exact
+    return (int32_t)((uint32_t)(numer >> denom->shift) * denom->inverse);
+}
+
+struct libdivide_u64_exact_t libdivide_u64_exact_gen(uint64_t d) {
+    struct libdivide_u64_exact_t result;
+    LIBDIVIDE_ASSERT(d != 0);
+    result.shift = (uint8_t)libdivide__count_trailing_zeros64(d);
+    result.inverse = libdivide__mod_inverse_u64(d >> result.shift);
+    return result;
+}
+
+uint64_t libdivide_u64_exact_do(uint64_t numer, const struct libdivide_u64_exact_t *denom) {
+#if LIBDIVIDE_ASSERTIONS_ON
+    libdivide__u64_exact_assert(numer, denom);
+#endif
+    return (numer >> denom->shift) * denom->inverse;
+}
+
+struct libdivide_s64_exact_t libdivide_s64_exact_gen(int64_t d) {
+    struct libdivide_s64_exact_t result;
+    LIBDIVIDE_ASSERT(d != 0);
+    result.shift = (uint8_t)libdivide__count_trailing_zeros64((uint64_t)d);
+    result.inverse = libdivide__mod_inverse_u64((uint64_t)(d >> result.shift));
+    return result;
+}
+
+int64_t libdivide_s64_exact_do(int64_t numer, const struct libdivide_s64_exact_t *denom) {
+#if LIBDIVIDE_ASSERTIONS_ON
+    libdivide__s64_exact_assert(numer, denom);
+#endif
+    return (int64_t)((uint64_t)(numer >> denom->shift) * denom->inverse);
+}
+
+#if LIBDIVIDE_USE_SSE2
+__m128i libdivide_4u32_exact_do_vector(__m128i numers, const struct libdivide_u32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u32, uint32_t, numers, denom);
+    __m128i q = _mm_srl_epi32(numers, _mm_cvtsi32_si128(denom->shift));
+    return libdivide_mullo_u32_flat_vector(q, _mm_set1_epi32(denom->inverse));
+}
+
+__m128i libdivide_4s32_exact_do_vector(__m128i numers, const struct libdivide_s32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s32, int32_t, numers, denom);
+    __m128i q = _mm_sra_epi32(numers, _mm_cvtsi32_si128(denom->shift));
+    return libdivide_mullo_u32_flat_vector(q, _mm_set1_epi32(denom->inverse));
+}
+
+__m128i libdivide_2u64_exact_do_vector(__m128i numers, const struct libdivide_u64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u64, uint64_t, numers, denom);
+    __m128i q = _mm_srl_epi64(numers, _mm_cvtsi32_si128(denom->shift));
+    return libdivide_mullo_u64_flat_vector(q, libdivide__u64_to_m128(denom->inverse));
+}
+
+__m128i libdivide_2s64_exact_do_vector(__m128i numers, const struct libdivide_s64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s64, int64_t, numers, denom);
+    __m128i q = libdivide_s64_shift_right_vector(numers, denom->shift);
+    return libdivide_mullo_u64_flat_vector(q, libdivide__u64_to_m128(denom->inverse));
+}
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_exact_do_vector(__m256i numers, const struct libdivide_u32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u32, uint32_t, numers, denom);
+    __m256i q = _mm256_srl_epi32(numers, _mm_cvtsi32_si128(denom->shift));
+    return _mm256_mullo_epi32(q, _mm256_set1_epi32(denom->inverse));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_exact_do_vector(__m256i numers, const struct libdivide_s32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s32, int32_t, numers, denom);
+    __m256i q = _mm256_sra_epi32(numers, _mm_cvtsi32_si128(denom->shift));
+    return _mm256_mullo_epi32(q, _mm256_set1_epi32(denom->inverse));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_exact_do_vector(__m256i numers, const struct libdivide_u64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u64, uint64_t, numers, denom);
+    __m256i q = _mm256_srl_epi64(numers, _mm_cvtsi32_si128(denom->shift));
+    return libdivide_mullo_4u64_flat_vector(q, libdivide__u64_to_m256i(denom->inverse));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_exact_do_vector(__m256i numers, const struct libdivide_s64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s64, int64_t, numers, denom);
+    __m256i q = libdivide_4s64_shift_right_vector(numers, denom->shift);
+    return libdivide_mullo_4u64_flat_vector(q, libdivide__u64_to_m256i(denom->inverse));
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_exact_do_vector(__m512i numers, const struct libdivide_u32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u32, uint32_t, numers, denom);
+    __m512i q = _mm512_srl_epi32(numers, _mm_cvtsi32_si128(denom->shift));
+    return _mm512_mullo_epi32(q, _mm512_set1_epi32(denom->inverse));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_exact_do_vector(__m512i numers, const struct libdivide_s32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s32, int32_t, numers, denom);
+    __m512i q = _mm512_sra_epi32(numers, _mm_cvtsi32_si128(denom->shift));
+    return _mm512_mullo_epi32(q, _mm512_set1_epi32(denom->inverse));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_exact_do_vector(__m512i numers, const struct libdivide_u64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u64, uint64_t, numers, denom);
+    __m512i q = _mm512_srl_epi64(numers, _mm_cvtsi32_si128(denom->shift));
+    return _mm512_mullo_epi64(q, libdivide__u64_to_m512i(denom->inverse));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_exact_do_vector(__m512i numers, const struct libdivide_s64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s64, int64_t, numers, denom);
+    __m512i q = _mm512_sra_epi64(numers, _mm_cvtsi32_si128(denom->shift));
+    return _mm512_mullo_epi64(q, libdivide__u64_to_m512i(denom->inverse));
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+uint32x2_t libdivide_2u32_exact_do_vector(uint32x2_t numers, const struct libdivide_u32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u32, uint32_t, numers, denom);
+    return vmul_u32(vshl_u32(numers, vdup_n_s32(-denom->shift)), vdup_n_u32(denom->inverse));
+}
+
+uint32x4_t libdivide_4u32_exact_do_vector(uint32x4_t numers, const struct libdivide_u32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u32, uint32_t, numers, denom);
+    return vmulq_u32(vshlq_u32(numers, vdupq_n_s32(-denom->shift)), vdupq_n_u32(denom->inverse));
+}
+
+uint32x4x2_t libdivide_8u32_exact_do_vector(uint32x4x2_t numers, const struct libdivide_u32_exact_t *denom) {
+    uint32x4x2_t result;
+    result.val[0] = libdivide_4u32_exact_do_vector(numers.val[0], denom);
+    result.val[1] = libdivide_4u32_exact_do_vector(numers.val[1], denom);
+    return result;
+}
+
+int32x2_t libdivide_2s32_exact_do_vector(int32x2_t numers, const struct libdivide_s32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s32, int32_t, numers, denom);
+    return vmul_s32(vshl_s32(numers, vdup_n_s32(-denom->shift)), vdup_n_s32((int32_t)denom->inverse));
+}
+
+int32x4_t libdivide_4s32_exact_do_vector(int32x4_t numers, const struct libdivide_s32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s32, int32_t, numers, denom);
+    return vmulq_s32(vshlq_s32(numers, vdupq_n_s32(-denom->shift)), vdupq_n_s32((int32_t)denom->inverse));
+}
+
+int32x4x2_t libdivide_8s32_exact_do_vector(int32x4x2_t numers, const struct libdivide_s32_exact_t *denom) {
+    int32x4x2_t result;
+    result.val[0] = libdivide_4s32_exact_do_vector(numers.val[0], denom);
+    result.val[1] = libdivide_4s32_exact_do_vector(numers.val[1], denom);
+    return result;
+}
+
+uint64x1_t libdivide_1u64_exact_do_vector(uint64x1_t numers, const struct libdivide_u64_exact_t *denom) {
+    return vdup_n_u64(libdivide_u64_exact_do(vget_lane_u64(numers, 0), denom));
+}
+
+uint64x2_t libdivide_2u64_exact_do_vector(uint64x2_t numers, const struct libdivide_u64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u64, uint64_t, numers, denom);
+    return libdivide_mullo_2u64_flat_vector(vshlq_u64(numers, vdupq_n_s64(-denom->shift)), vdupq_n_u64(denom->inverse));
+}
+
+uint64x2x2_t libdivide_4u64_exact_do_vector(uint64x2x2_t numers, const struct libdivide_u64_exact_t *denom) {
+    uint64x2x2_t result;
+    result.val[0] = libdivide_2u64_exact_do_vector(numers.val[0], denom);
+    result.val[1] = libdivide_2u64_exact_do_vector(numers.val[1], denom);
+    return result;
+}
+
+int64x1_t libdivide_1s64_exact_do_vector(int64x1_t numers, const struct libdivide_s64_exact_t *denom) {
+    return vdup_n_s64(libdivide_s64_exact_do(vget_lane_s64(numers, 0), denom));
+}
+
+int64x2_t libdivide_2s64_exact_do_vector(int64x2_t numers, const struct libdivide_s64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s64, int64_t, numers, denom);
+    uint64x2_t q = vreinterpretq_u64_s64(vshlq_s64(numers, vdupq_n_s64(-denom->shift)));
+    return vreinterpretq_s64_u64(libdivide_mullo_2u64_flat_vector(q, vdupq_n_u64(denom->inverse)));
+}
+
+int64x2x2_t libdivide_4s64_exact_do_vector(int64x2x2_t numers, const struct libdivide_s64_exact_t *denom) {
+    int64x2x2_t result;
+    result.val[0] = libdivide_2s64_exact_do_vector(numers.val[0], denom);
+    result.val[1] = libdivide_2s64_exact_do_vector(numers.val[1], denom);
+    return result;
+}
+#elif LIBDIVIDE_USE_VECTOR
+libdivide_2u32_t libdivide_2u32_exact_do_vector(libdivide_2u32_t numers, const struct libdivide_u32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u32, uint32_t, numers, denom);
+    uint32_t inverse = denom->inverse;
+    return (numers >> denom->shift) * (libdivide_2u32_t) { inverse, inverse };
+}
+
+libdivide_4u32_t libdivide_4u32_exact_do_vector(libdivide_4u32_t numers, const struct libdivide_u32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u32, uint32_t, numers, denom);
+    uint32_t inverse = denom->inverse;
+    return (numers >> denom->shift) * (libdivide_4u32_t) { inverse, inverse, inverse, inverse };
+}
+
+libdivide_8u32_t libdivide_8u32_exact_do_vector(libdivide_8u32_t numers, const struct libdivide_u32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u32, uint32_t, numers, denom);
+    uint32_t inverse = denom->inverse;
+    return (numers >> denom->shift) * (libdivide_8u32_t) { inverse, inverse, inverse, inverse, inverse, inverse, inverse, inverse };
+}
+
+libdivide_1u64_t libdivide_1u64_exact_do_vector(libdivide_1u64_t numers, const struct libdivide_u64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u64, uint64_t, numers, denom);
+    uint64_t inverse = denom->inverse;
+    return (numers >> denom->shift) * (libdivide_1u64_t) { inverse };
+}
+
+libdivide_2u64_t libdivide_2u64_exact_do_vector(libdivide_2u64_t numers, const struct libdivide_u64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u64, uint64_t, numers, denom);
+    uint64_t inverse = denom->inverse;
+    return (numers >> denom->shift) * (libdivide_2u64_t) { inverse, inverse };
+}
+
+libdivide_4u64_t libdivide_4u64_exact_do_vector(libdivide_4u64_t numers, const struct libdivide_u64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(u64, uint64_t, numers, denom);
+    uint64_t inverse = denom->inverse;
+    return (numers >> denom->shift) * (libdivide_4u64_t) { inverse, inverse, inverse, inverse };
+}
+
+libdivide_2s32_t libdivide_2s32_exact_do_vector(libdivide_2s32_t numers, const struct libdivide_s32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s32, int32_t, numers, denom);
+    uint32_t inverse = denom->inverse;
+    //multiply unsigned, so that the wrapping is defined
+    return (libdivide_2s32_t)((libdivide_2u32_t)(numers >> denom->shift) * (libdivide_2u32_t) { inverse, inverse });
+}
+
+libdivide_4s32_t libdivide_4s32_exact_do_vector(libdivide_4s32_t numers, const struct libdivide_s32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s32, int32_t, numers, denom);
+    uint32_t inverse = denom->inverse;
+    //multiply unsigned, so that the wrapping is defined
+    return (libdivide_4s32_t)((libdivide_4u32_t)(numers >> denom->shift) * (libdivide_4u32_t) { inverse, inverse, inverse, inverse });
+}
+
+libdivide_8s32_t libdivide_8s32_exact_do_vector(libdivide_8s32_t numers, const struct libdivide_s32_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s32, int32_t, numers, denom);
+    uint32_t inverse = denom->inverse;
+    //multiply unsigned, so that the wrapping is defined
+    return (libdivide_8s32_t)((libdivide_8u32_t)(numers >> denom->shift) * (libdivide_8u32_t) { inverse, inverse, inverse, inverse, inverse, inverse, inverse, inverse });
+}
+
+libdivide_1s64_t libdivide_1s64_exact_do_vector(libdivide_1s64_t numers, const struct libdivide_s64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s64, int64_t, numers, denom);
+    uint64_t inverse = denom->inverse;
+    //multiply unsigned, so that the wrapping is defined
+    return (libdivide_1s64_t)((libdivide_1u64_t)(numers >> denom->shift) * (libdivide_1u64_t) { inverse });
+}
+
+libdivide_2s64_t libdivide_2s64_exact_do_vector(libdivide_2s64_t numers, const struct libdivide_s64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s64, int64_t, numers, denom);
+    uint64_t inverse = denom->inverse;
+    //multiply unsigned, so that the wrapping is defined
+    return (libdivide_2s64_t)((libdivide_2u64_t)(numers >> denom->shift) * (libdivide_2u64_t) { inverse, inverse });
+}
+
+libdivide_4s64_t libdivide_4s64_exact_do_vector(libdivide_4s64_t numers, const struct libdivide_s64_exact_t *denom) {
+    LIBDIVIDE_ASSERT_EXACT_VECTOR(s64, int64_t, numers, denom);
+    uint64_t inverse = denom->inverse;
+    //multiply unsigned, so that the wrapping is defined
+    return (libdivide_4s64_t)((libdivide_4u64_t)(numers >> denom->shift) * (libdivide_4u64_t) { inverse, inverse, inverse, inverse });
+}
+#endif
+
+/////////// FLOOR DIVISION
+
+/* Floor division reuses the truncating algorithms, with the rounding folded into their sign handling instead of patched onto the truncated quotient.  On the shift path the arithmetic shift already floors, so only a negative divisor needs a tweak: it rounds the shifted numerator up, which the negation then turns into a floor.  On the multiply path, a numerator whose quotient will be negative is first complemented (d > 0) or replaced by 1 - numer (d < 0), which makes the truncating core produce the complement of the floor, and complementing the result takes the place of the q += (q < 0) correction.  more only flags a negative divisor on the add and shift paths, so the multiply path takes the sign from the divisor itself. */
+int32_t libdivide_s32_do_floor(int32_t numer, const struct libdivide_s32_t *denom) {
+    uint8_t more = denom->more;
+    uint8_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        int32_t sign = (int8_t)more >> 7;
+        uint32_t mask = (1U << shifter) - 1;
+        //a negative divisor rounds up: the low bits plus the mask carry into the shifted bits exactly when any of them are set
+        int32_t q = (numer >> shifter) + ((int32_t)((((uint32_t)numer & mask) + mask) >> shifter) & sign);
+        return (int32_t)(((uint32_t)q ^ sign) - sign); //q = (q ^ sign) - sign
+    }
+    else {
+        int32_t sign = denom->divisor >> 31;
+        //t is all ones when the quotient is negative, and then z is ~numer for d > 0 or 1 - numer for d < 0
+        int32_t t = (int32_t)(((uint32_t)numer ^ (uint32_t)sign) & ((0U - (uint32_t)numer) | ~(uint32_t)sign)) >> 31;
+        int32_t z = (int32_t)(((uint32_t)numer ^ (uint32_t)t) - ((uint32_t)(t & sign) << 1));
+        int32_t q = libdivide__mullhi_s32(denom->magic, z);
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = (int32_t)((uint32_t)q + (((uint32_t)z ^ sign) - sign)); //q += (z ^ sign) - sign, which wraps for numer == INT_MIN
+        }
+        q >>= shifter;
+        return q ^ t;
+    }
+}
+
+int32_t libdivide_s32_do_floor_alg0(int32_t numer, const struct libdivide_s32_t *denom) {
+    return numer >> (denom->more & LIBDIVIDE_32_SHIFT_MASK);
+}
+
+int32_t libdivide_s32_do_floor_alg1(int32_t numer, const struct libdivide_s32_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    uint32_t mask = (1U << shifter) - 1;
+    int32_t q = (numer >> shifter) + (int32_t)((((uint32_t)numer & mask) + mask) >> shifter);
+    return (int32_t)(0U - (uint32_t)q);
+}
+
+int32_t libdivide_s32_do_floor_alg2(int32_t numer, const struct libdivide_s32_t *denom) {
+    int32_t t = numer >> 31;
+    int32_t z = numer ^ t;
+    int32_t q = (int32_t)((uint32_t)libdivide__mullhi_s32(denom->magic, z) + (uint32_t)z);
+    q >>= denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    return q ^ t;
+}
+
+int32_t libdivide_s32_do_floor_alg3(int32_t numer, const struct libdivide_s32_t *denom) {
+    //the quotient is negative for positive numerators
+    int32_t t = (int32_t)(~(uint32_t)numer & (0U - (uint32_t)numer)) >> 31;
+    int32_t z = (int32_t)(((uint32_t)numer ^ (uint32_t)t) - ((uint32_t)t << 1));
+    int32_t q = (int32_t)((uint32_t)libdivide__mullhi_s32(denom->magic, z) - (uint32_t)z);
+    q >>= denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    return q ^ t;
+}
+
+int32_t libdivide_s32_do_floor_alg4(int32_t numer, const struct libdivide_s32_t *denom) {
+    int32_t sign = denom->divisor >> 31;
+    int32_t t = (int32_t)(((uint32_t)numer ^ (uint32_t)sign) & ((0U - (uint32_t)numer) | ~(uint32_t)sign)) >> 31;
+    int32_t z = (int32_t)(((uint32_t)numer ^ (uint32_t)t) - ((uint32_t)(t & sign) << 1));
+    int32_t q = libdivide__mullhi_s32(denom->magic, z);
+    q >>= denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    return q ^ t;
+}
+
+int32_t libdivide_s32_mod_euclid(int32_t numer, const struct libdivide_s32_t *denom) {
+    uint32_t d = (uint32_t)denom->divisor;
+    uint32_t r = (uint32_t)numer - (uint32_t)libdivide_s32_do_floor(numer, denom) * d;
+    //the floored remainder has the sign of the divisor, so a negative one is brought up by |d| = -d
+    return (int32_t)(r - (d & (uint32_t)((int32_t)r >> 31)));
+}
+
+int64_t libdivide_s64_do_floor(int64_t numer, const struct libdivide_s64_t *denom) {
+    uint8_t more = denom->more;
+    uint8_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
+    int64_t magic = denom->magic;
+    if (magic == 0) { //shift path
+        int64_t sign = (int8_t)more >> 7;
+        uint64_t mask = (1ULL << shifter) - 1;
+        //a negative divisor rounds up: the low bits plus the mask carry into the shifted bits exactly when any of them are set
+        int64_t q = (numer >> shifter) + ((int64_t)((((uint64_t)numer & mask) + mask) >> shifter) & sign);
+        return (int64_t)(((uint64_t)q ^ sign) - sign); //q = (q ^ sign) - sign
+    }
+    else {
+        int64_t sign = denom->divisor >> 63;
+        //t is all ones when the quotient is negative, and then z is ~numer for d > 0 or 1 - numer for d < 0
+        int64_t t = (int64_t)(((uint64_t)numer ^ (uint64_t)sign) & ((0ULL - (uint64_t)numer) | ~(uint64_t)sign)) >> 63;
+        int64_t z = (int64_t)(((uint64_t)numer ^ (uint64_t)t) - ((uint64_t)(t & sign) << 1));
+        int64_t q = libdivide__mullhi_s64(magic, z);
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = (int64_t)((uint64_t)q + (((uint64_t)z ^ sign) - sign)); //q += (z ^ sign) - sign, which wraps for numer == INT64_MIN
+        }
+        q >>= shifter;
+        return q ^ t;
+    }
+}
+
+int64_t libdivide_s64_do_floor_alg0(int64_t numer, const struct libdivide_s64_t *denom) {
+    return numer >> (denom->more & LIBDIVIDE_64_SHIFT_MASK);
+}
+
+int64_t libdivide_s64_do_floor_alg1(int64_t numer, const struct libdivide_s64_t *denom) {
+    uint8_t shifter = denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    uint64_t mask = (1ULL << shifter) - 1;
+    int64_t q = (numer >> shifter) + (int64_t)((((uint64_t)numer & mask) + mask) >> shifter);
+    return (int64_t)(0ULL - (uint64_t)q);
+}
+
+int64_t libdivide_s64_do_floor_alg2(int64_t numer, const struct libdivide_s64_t *denom) {
+    int64_t t = numer >> 63;
+    int64_t z = numer ^ t;
+    int64_t q = (int64_t)((uint64_t)libdivide__mullhi_s64(denom->magic, z) + (uint64_t)z);
+    q >>= denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    return q ^ t;
+}
+
+int64_t libdivide_s64_do_floor_alg3(int64_t numer, const struct libdivide_s64_t *denom) {
+    //the quotient is negative for positive numerators
+    int64_t t = (int64_t)(~(uint64_t)numer & (0ULL - (uint64_t)numer)) >> 63;
+    int64_t z = (int64_t)(((uint64_t)numer ^ (uint64_t)t) - ((uint64_t)t << 1));
+    int64_t q = (int64_t)((uint64_t)libdivide__mullhi_s64(denom->magic, z) - (uint64_t)z);
+    q >>= denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    return q ^ t;
+}
+
+int64_t libdivide_s64_do_floor_alg4(int64_t numer, const struct libdivide_s64_t *denom) {
+    int64_t sign = denom->divisor >> 63;
+    int64_t t = (int64_t)(((uint64_t)numer ^ (uint64_t)sign) & ((0ULL - (uint64_t)numer) | ~(uint64_t)sign)) >> 63;
+    int64_t z = (int64_t)(((uint64_t)numer ^ (uint64_t)t) - ((uint64_t)(t & sign) << 1));
+    int64_t q = libdivide__mullhi_s64(denom->magic, z);
+    q >>= denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    return q ^ t;
+}
+
+int64_t libdivide_s64_mod_euclid(int64_t numer, const struct libdivide_s64_t *denom) {
+    uint64_t d = (uint64_t)denom->divisor;
+    uint64_t r = (uint64_t)numer - (uint64_t)libdivide_s64_do_floor(numer, denom) * d;
+    //the floored remainder has the sign of the divisor, so a negative one is brought up by |d| = -d
+    return (int64_t)(r - (d & (uint64_t)((int64_t)r >> 63)));
+}
+
+/* The vector forms follow the scalar ones lane for lane. */
+#if LIBDIVIDE_USE_SSE2
+__m128i libdivide_4s32_do_floor_vector(__m128i numers, const struct libdivide_s32_t *denom) {
+    uint8_t more = denom->more;
+    uint32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        __m128i sign = _mm_set1_epi32((int32_t)(int8_t)more >> 7);
+        __m128i mask = _mm_set1_epi32((int32_t)((1U << shifter) - 1));
+        __m128i roundUp = _mm_srl_epi32(_mm_add_epi32(_mm_and_si128(numers, mask), mask), libdivide_u32_to_m128i(shifter)); //(numer & mask) + mask carries when any low bit is set
+        __m128i q = _mm_add_epi32(_mm_sra_epi32(numers, libdivide_u32_to_m128i(shifter)), _mm_and_si128(roundUp, sign));
+        return _mm_sub_epi32(_mm_xor_si128(q, sign), sign); //q = (q ^ sign) - sign
+    }
+    else {
+        __m128i sign = _mm_set1_epi32(denom->divisor >> 31);
+        __m128i notSign = _mm_set1_epi32(~(denom->divisor >> 31));
+        __m128i t = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(numers, sign), _mm_or_si128(_mm_sub_epi32(_mm_setzero_si128(), numers), notSign)), 31); //all ones where the quotient is negative
+        __m128i tSign = _mm_and_si128(t, sign);
+        __m128i z = _mm_sub_epi32(_mm_xor_si128(numers, t), _mm_add_epi32(tSign, tSign)); //z = (numer ^ t) - 2 * (t & sign)
+        __m128i q = libdivide_mullhi_s32_flat_vector(z, _mm_set1_epi32(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = _mm_add_epi32(q, _mm_sub_epi32(_mm_xor_si128(z, sign), sign)); //q += (z ^ sign) - sign
+        }
+        q = _mm_sra_epi32(q, libdivide_u32_to_m128i(shifter));
+        return _mm_xor_si128(q, t);
+    }
+}
+
+__m128i libdivide_4s32_mod_euclid_vector(__m128i numers, const struct libdivide_s32_t *denom) {
+    __m128i d = _mm_set1_epi32(denom->divisor);
+    __m128i r = _mm_sub_epi32(numers, libdivide_mullo_u32_flat_vector(libdivide_4s32_do_floor_vector(numers, denom), d));
+    return _mm_sub_epi32(r, _mm_and_si128(d, _mm_srai_epi32(r, 31))); //r -= d & (r >> 31)
+}
+
+__m128i libdivide_2s64_do_floor_vector(__m128i numers, const struct libdivide_s64_t *denom) {
+    uint8_t more = denom->more;
+    uint32_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
+    if (denom->magic == 0) { //shift path
+        __m128i sign = _mm_set1_epi32((int32_t)(int8_t)more >> 7);
+        __m128i mask = libdivide__u64_to_m128((1ULL << shifter) - 1);
+        __m128i roundUp = _mm_srl_epi64(_mm_add_epi64(_mm_and_si128(numers, mask), mask), libdivide_u32_to_m128i(shifter)); //(numer & mask) + mask carries when any low bit is set
+        __m128i q = _mm_add_epi64(libdivide_s64_shift_right_vector(numers, shifter), _mm_and_si128(roundUp, sign));
+        return _mm_sub_epi64(_mm_xor_si128(q, sign), sign); //q = (q ^ sign) - sign
+    }
+    else {
+        __m128i sign = _mm_set1_epi32((int32_t)(denom->divisor >> 63));
+        __m128i notSign = _mm_set1_epi32(~(int32_t)(denom->divisor >> 63));
+        __m128i t = libdivide_s64_signbits(_mm_and_si128(_mm_xor_si128(numers, sign), _mm_or_si128(_mm_sub_epi64(_mm_setzero_si128(), numers), notSign))); //all ones where the quotient is negative
+        __m128i tSign = _mm_and_si128(t, sign);
+        __m128i z = _mm_sub_epi64(_mm_xor_si128(numers, t), _mm_add_epi64(tSign, tSign)); //z = (numer ^ t) - 2 * (t & sign)
+        __m128i q = libdivide_mullhi_s64_flat_vector(z, libdivide__u64_to_m128(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = _mm_add_epi64(q, _mm_sub_epi64(_mm_xor_si128(z, sign), sign)); //q += (z ^ sign) - sign
+        }
+        q = libdivide_s64_shift_right_vector(q, shifter);
+        return _mm_xor_si128(q, t);
+    }
+}
+
+__m128i libdivide_2s64_mod_euclid_vector(__m128i numers, const struct libdivide_s64_t *denom) {
+    __m128i d = libdivide__u64_to_m128(denom->divisor);
+    __m128i r = _mm_sub_epi64(numers, libdivide_mullo_u64_flat_vector(libdivide_2s64_do_floor_vector(numers, denom), d));
+    return _mm_sub_epi64(r, _mm_and_si128(d, libdivide_s64_signbits(r))); //r -= d & (r >> 63)
+}
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_do_floor_vector(__m256i numers, const struct libdivide_s32_t *denom) {
+    uint8_t more = denom->more;
+    uint32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        __m256i sign = _mm256_set1_epi32((int32_t)(int8_t)more >> 7);
+        __m256i mask = _mm256_set1_epi32((int32_t)((1U << shifter) - 1));
+        __m256i roundUp = _mm256_srl_epi32(_mm256_add_epi32(_mm256_and_si256(numers, mask), mask), libdivide_u32_to_m128i(shifter));
+        __m256i q = _mm256_add_epi32(_mm256_sra_epi32(numers, libdivide_u32_to_m128i(shifter)), _mm256_and_si256(roundUp, sign));
+        return _mm256_sub_epi32(_mm256_xor_si256(q, sign), sign);
+    }
+    else {
+        __m256i sign = _mm256_set1_epi32(denom->divisor >> 31);
+        __m256i notSign = _mm256_set1_epi32(~(denom->divisor >> 31));
+        __m256i t = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(numers, sign), _mm256_or_si256(_mm256_sub_epi32(_mm256_setzero_si256(), numers), notSign)), 31);
+        __m256i tSign = _mm256_and_si256(t, sign);
+        __m256i z = _mm256_sub_epi32(_mm256_xor_si256(numers, t), _mm256_add_epi32(tSign, tSign));
+        __m256i q = libdivide_mullhi_8s32_flat_vector(z, _mm256_set1_epi32(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = _mm256_add_epi32(q, _mm256_sub_epi32(_mm256_xor_si256(z, sign), sign));
+        }
+        q = _mm256_sra_epi32(q, libdivide_u32_to_m128i(shifter));
+        return _mm256_xor_si256(q, t);
+    }
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_mod_euclid_vector(__m256i numers, const struct libdivide_s32_t *denom) {
+    __m256i d = _mm256_set1_epi32(denom->divisor);
+    __m256i r = _mm256_sub_epi32(numers, _mm256_mullo_epi32(libdivide_8s32_do_floor_vector(numers, denom), d));
+    return _mm256_sub_epi32(r, _mm256_and_si256(d, _mm256_srai_epi32(r, 31)));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_do_floor_vector(__m256i numers, const struct libdivide_s64_t *denom) {
+    uint8_t more = denom->more;
+    uint32_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
+    if (denom->magic == 0) { //shift path
+        __m256i sign = _mm256_set1_epi32((int32_t)(int8_t)more >> 7);
+        __m256i mask = libdivide__u64_to_m256i((1ULL << shifter) - 1);
+        __m256i roundUp = _mm256_srl_epi64(_mm256_add_epi64(_mm256_and_si256(numers, mask), mask), libdivide_u32_to_m128i(shifter));
+        __m256i q = _mm256_add_epi64(libdivide_4s64_shift_right_vector(numers, shifter), _mm256_and_si256(roundUp, sign));
+        return _mm256_sub_epi64(_mm256_xor_si256(q, sign), sign);
+    }
+    else {
+        __m256i sign = _mm256_set1_epi32((int32_t)(denom->divisor >> 63));
+        __m256i notSign = _mm256_set1_epi32(~(int32_t)(denom->divisor >> 63));
+        __m256i t = libdivide_4s64_signbits(_mm256_and_si256(_mm256_xor_si256(numers, sign), _mm256_or_si256(_mm256_sub_epi64(_mm256_setzero_si256(), numers), notSign)));
+        __m256i tSign = _mm256_and_si256(t, sign);
+        __m256i z = _mm256_sub_epi64(_mm256_xor_si256(numers, t), _mm256_add_epi64(tSign, tSign));
+        __m256i q = libdivide_mullhi_4s64_flat_vector(z, libdivide__u64_to_m256i(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = _mm256_add_epi64(q, _mm256_sub_epi64(_mm256_xor_si256(z, sign), sign));
+        }
+        q = libdivide_4s64_shift_right_vector(q, shifter);
+        return _mm256_xor_si256(q, t);
+    }
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_mod_euclid_vector(__m256i numers, const struct libdivide_s64_t *denom) {
+    __m256i d = libdivide__u64_to_m256i(denom->divisor);
+    __m256i r = _mm256_sub_epi64(numers, libdivide_mullo_4u64_flat_vector(libdivide_4s64_do_floor_vector(numers, denom), d));
+    return _mm256_sub_epi64(r, _mm256_and_si256(d, libdivide_4s64_signbits(r)));
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_do_floor_vector(__m512i numers, const struct libdivide_s32_t *denom) {
+    uint8_t more = denom->more;
+    uint32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        __m512i sign = _mm512_set1_epi32((int32_t)(int8_t)more >> 7);
+        __m512i mask = _mm512_set1_epi32((int32_t)((1U << shifter) - 1));
+        __m512i roundUp = _mm512_srl_epi32(_mm512_add_epi32(_mm512_and_si512(numers, mask), mask), libdivide_u32_to_m128i(shifter));
+        __m512i q = _mm512_add_epi32(_mm512_sra_epi32(numers, libdivide_u32_to_m128i(shifter)), _mm512_and_si512(roundUp, sign));
+        return _mm512_sub_epi32(_mm512_xor_si512(q, sign), sign);
+    }
+    else {
+        __m512i sign = _mm512_set1_epi32(denom->divisor >> 31);
+        __m512i notSign = _mm512_set1_epi32(~(denom->divisor >> 31));
+        __m512i t = _mm512_srai_epi32(_mm512_and_si512(_mm512_xor_si512(numers, sign), _mm512_or_si512(_mm512_sub_epi32(_mm512_setzero_si512(), numers), notSign)), 31);
+        __m512i tSign = _mm512_and_si512(t, sign);
+        __m512i z = _mm512_sub_epi32(_mm512_xor_si512(numers, t), _mm512_add_epi32(tSign, tSign));
+        __m512i q = libdivide_mullhi_16s32_flat_vector(z, _mm512_set1_epi32(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = _mm512_add_epi32(q, _mm512_sub_epi32(_mm512_xor_si512(z, sign), sign));
+        }
+        q = _mm512_sra_epi32(q, libdivide_u32_to_m128i(shifter));
+        return _mm512_xor_si512(q, t);
+    }
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_mod_euclid_vector(__m512i numers, const struct libdivide_s32_t *denom) {
+    __m512i d = _mm512_set1_epi32(denom->divisor);
+    __m512i r = _mm512_sub_epi32(numers, _mm512_mullo_epi32(libdivide_16s32_do_floor_vector(numers, denom), d));
+    return _mm512_sub_epi32(r, _mm512_and_si512(d, _mm512_srai_epi32(r, 31)));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_do_floor_vector(__m512i numers, const struct libdivide_s64_t *denom) {
+    uint8_t more = denom->more;
+    uint32_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
+    if (denom->magic == 0) { //shift path
+        __m512i sign = _mm512_set1_epi32((int32_t)(int8_t)more >> 7);
+        __m512i mask = libdivide__u64_to_m512i((1ULL << shifter) - 1);
+        __m512i roundUp = _mm512_srl_epi64(_mm512_add_epi64(_mm512_and_si512(numers, mask), mask), libdivide_u32_to_m128i(shifter));
+        __m512i q = _mm512_add_epi64(libdivide_8s64_shift_right_vector(numers, shifter), _mm512_and_si512(roundUp, sign));
+        return _mm512_sub_epi64(_mm512_xor_si512(q, sign), sign);
+    }
+    else {
+        __m512i sign = _mm512_set1_epi32((int32_t)(denom->divisor >> 63));
+        __m512i notSign = _mm512_set1_epi32(~(int32_t)(denom->divisor >> 63));
+        __m512i t = libdivide_8s64_signbits(_mm512_and_si512(_mm512_xor_si512(numers, sign), _mm512_or_si512(_mm512_sub_epi64(_mm512_setzero_si512(), numers), notSign)));
+        __m512i tSign = _mm512_and_si512(t, sign);
+        __m512i z = _mm512_sub_epi64(_mm512_xor_si512(numers, t), _mm512_add_epi64(tSign, tSign));
+        __m512i q = libdivide_mullhi_8s64_flat_vector(z, libdivide__u64_to_m512i(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = _mm512_add_epi64(q, _mm512_sub_epi64(_mm512_xor_si512(z, sign), sign));
+        }
+        q = libdivide_8s64_shift_right_vector(q, shifter);
+        return _mm512_xor_si512(q, t);
+    }
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_mod_euclid_vector(__m512i numers, const struct libdivide_s64_t *denom) {
+    __m512i d = libdivide__u64_to_m512i(denom->divisor);
+    __m512i r = _mm512_sub_epi64(numers, _mm512_mullo_epi64(libdivide_8s64_do_floor_vector(numers, denom), d));
+    return _mm512_sub_epi64(r, _mm512_and_si512(d, libdivide_8s64_signbits(r)));
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+int32x2_t libdivide_2s32_do_floor_vector(int32x2_t numers, const struct libdivide_s32_t *denom) {
+    uint8_t more = denom->more;
+    int32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        int32x2_t sign = vdup_n_s32((int32_t)(int8_t)more >> 7);
+        uint32x2_t mask = vdup_n_u32((1U << shifter) - 1);
+        uint32x2_t roundUp = vshl_u32(vadd_u32(vand_u32(vreinterpret_u32_s32(numers), mask), mask), vdup_n_s32(-shifter)); //(numer & mask) + mask carries when any low bit is set
+        int32x2_t q = vadd_s32(vshl_s32(numers, vdup_n_s32(-shifter)), vand_s32(vreinterpret_s32_u32(roundUp), sign));
+        return vsub_s32(veor_s32(q, sign), sign); //q = (q ^ sign) - sign
+    }
+    else {
+        int32x2_t sign = vdup_n_s32(denom->divisor >> 31);
+        int32x2_t notSign = vdup_n_s32(~(denom->divisor >> 31));
+        int32x2_t t = vshr_n_s32(vand_s32(veor_s32(numers, sign), vorr_s32(vneg_s32(numers), notSign)), 31); //all ones where the quotient is negative
+        int32x2_t tSign = vand_s32(t, sign);
+        int32x2_t z = vsub_s32(veor_s32(numers, t), vadd_s32(tSign, tSign)); //z = (numer ^ t) - 2 * (t & sign)
+        int32x2_t q = libdivide_mullhi_2s32_flat_vector(z, vdup_n_s32(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = vadd_s32(q, vsub_s32(veor_s32(z, sign), sign)); //q += (z ^ sign) - sign
+        }
+        q = vshl_s32(q, vdup_n_s32(-shifter));
+        return veor_s32(q, t);
+    }
+}
+
+int32x2_t libdivide_2s32_mod_euclid_vector(int32x2_t numers, const struct libdivide_s32_t *denom) {
+    int32x2_t d = vdup_n_s32(denom->divisor);
+    int32x2_t r = vmls_s32(numers, libdivide_2s32_do_floor_vector(numers, denom), d);
+    return vsub_s32(r, vand_s32(d, vshr_n_s32(r, 31))); //r -= d & (r >> 31)
+}
+
+int32x4_t libdivide_4s32_do_floor_vector(int32x4_t numers, const struct libdivide_s32_t *denom) {
+    uint8_t more = denom->more;
+    int32_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        int32x4_t sign = vdupq_n_s32((int32_t)(int8_t)more >> 7);
+        uint32x4_t mask = vdupq_n_u32((1U << shifter) - 1);
+        uint32x4_t roundUp = vshlq_u32(vaddq_u32(vandq_u32(vreinterpretq_u32_s32(numers), mask), mask), vdupq_n_s32(-shifter));
+        int32x4_t q = vaddq_s32(vshlq_s32(numers, vdupq_n_s32(-shifter)), vandq_s32(vreinterpretq_s32_u32(roundUp), sign));
+        return vsubq_s32(veorq_s32(q, sign), sign);
+    }
+    else {
+        int32x4_t sign = vdupq_n_s32(denom->divisor >> 31);
+        int32x4_t notSign = vdupq_n_s32(~(denom->divisor >> 31));
+        int32x4_t t = vshrq_n_s32(vandq_s32(veorq_s32(numers, sign), vorrq_s32(vnegq_s32(numers), notSign)), 31);
+        int32x4_t tSign = vandq_s32(t, sign);
+        int32x4_t z = vsubq_s32(veorq_s32(numers, t), vaddq_s32(tSign, tSign));
+        int32x4_t q = libdivide_mullhi_4s32_flat_vector(z, vdupq_n_s32(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = vaddq_s32(q, vsubq_s32(veorq_s32(z, sign), sign));
+        }
+        q = vshlq_s32(q, vdupq_n_s32(-shifter));
+        return veorq_s32(q, t);
+    }
+}
+
+int32x4_t libdivide_4s32_mod_euclid_vector(int32x4_t numers, const struct libdivide_s32_t *denom) {
+    int32x4_t d = vdupq_n_s32(denom->divisor);
+    int32x4_t r = vmlsq_s32(numers, libdivide_4s32_do_floor_vector(numers, denom), d);
+    return vsubq_s32(r, vandq_s32(d, vshrq_n_s32(r, 31)));
+}
+
+int32x4x2_t libdivide_8s32_do_floor_vector(int32x4x2_t numers, const struct libdivide_s32_t *denom) {
+    int32x4x2_t result;
+    result.val[0] = libdivide_4s32_do_floor_vector(numers.val[0], denom);
+    result.val[1] = libdivide_4s32_do_floor_vector(numers.val[1], denom);
+    return result;
+}
+
+int32x4x2_t libdivide_8s32_mod_euclid_vector(int32x4x2_t numers, const struct libdivide_s32_t *denom) {
+    int32x4x2_t result;
+    result.val[0] = libdivide_4s32_mod_euclid_vector(numers.val[0], denom);
+    result.val[1] = libdivide_4s32_mod_euclid_vector(numers.val[1], denom);
+    return result;
+}
+
+int64x1_t libdivide_1s64_do_floor_vector(int64x1_t numers, const struct libdivide_s64_t *denom) {
+    return vdup_n_s64(libdivide_s64_do_floor(vget_lane_s64(numers, 0), denom));
+}
+
+int64x1_t libdivide_1s64_mod_euclid_vector(int64x1_t numers, const struct libdivide_s64_t *denom) {
+    return vdup_n_s64(libdivide_s64_mod_euclid(vget_lane_s64(numers, 0), denom));
+}
+
+int64x2_t libdivide_2s64_do_floor_vector(int64x2_t numers, const struct libdivide_s64_t *denom) {
+    uint8_t more = denom->more;
+    int64_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
+    if (denom->magic == 0) { //shift path
+        int64x2_t sign = vdupq_n_s64((int64_t)(int8_t)more >> 7);
+        uint64x2_t mask = vdupq_n_u64((1ULL << shifter) - 1);
+        uint64x2_t roundUp = vshlq_u64(vaddq_u64(vandq_u64(vreinterpretq_u64_s64(numers), mask), mask), vdupq_n_s64(-shifter)); //(numer & mask) + mask carries when any low bit is set
+        int64x2_t q = vaddq_s64(vshlq_s64(numers, vdupq_n_s64(-shifter)), vandq_s64(vreinterpretq_s64_u64(roundUp), sign));
+        return vsubq_s64(veorq_s64(q, sign), sign); //q = (q ^ sign) - sign
+    }
+    else {
+        int64x2_t sign = vdupq_n_s64(denom->divisor >> 63);
+        int64x2_t notSign = vdupq_n_s64(~(denom->divisor >> 63));
+        int64x2_t t = vshrq_n_s64(vandq_s64(veorq_s64(numers, sign), vorrq_s64(vsubq_s64(vdupq_n_s64(0), numers), notSign)), 63); //all ones where the quotient is negative
+        int64x2_t tSign = vandq_s64(t, sign);
+        int64x2_t z = vsubq_s64(veorq_s64(numers, t), vaddq_s64(tSign, tSign)); //z = (numer ^ t) - 2 * (t & sign)
+        int64x2_t q = libdivide_mullhi_2s64_flat_vector(z, vdupq_n_s64(denom->magic));
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q = vaddq_s64(q, vsubq_s64(veorq_s64(z, sign), sign)); //q += (z ^ sign) - sign
+        }
+        q = vshlq_s64(q, vdupq_n_s64(-shifter));
+        return veorq_s64(q, t);
+    }
+}
+
+int64x2_t libdivide_2s64_mod_euclid_vector(int64x2_t numers, const struct libdivide_s64_t *denom) {
+    int64x2_t d = vdupq_n_s64(denom->divisor);
+    int64x2_t q = libdivide_2s64_do_floor_vector(numers, denom);
+    int64x2_t r = vsubq_s64(numers, vreinterpretq_s64_u64(libdivide_mullo_2u64_flat_vector(vreinterpretq_u64_s64(q), vreinterpretq_u64_s64(d))));
+    return vsubq_s64(r, vandq_s64(d, vshrq_n_s64(r, 63))); //r -= d & (r >> 63)
+}
+
+int64x2x2_t libdivide_4s64_do_floor_vector(int64x2x2_t numers, const struct libdivide_s64_t *denom) {
+    int64x2x2_t result;
+    result.val[0] = libdivide_2s64_do_floor_vector(numers.val[0], denom);
+    result.val[1] = libdivide_2s64_do_floor_vector(numers.val[1], denom);
+    return result;
+}
+
+int64x2x2_t libdivide_4s64_mod_euclid_vector(int64x2x2_t numers, const struct libdivide_s64_t *denom) {
+    int64x2x2_t result;
+    result.val[0] = libdivide_2s64_mod_euclid_vector(numers.val[0], denom);
+    result.val[1] = libdivide_2s64_mod_euclid_vector(numers.val[1], denom);
+    return result;
+}
+
+#elif LIBDIVIDE_USE_VECTOR
+libdivide_2s32_t libdivide_2s32_do_floor_vector(libdivide_2s32_t numers, const struct libdivide_s32_t *denom) {
+    uint8_t more = denom->more;
+    uint8_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        int32_t sign = (int32_t)(int8_t)more >> 7;
+        uint32_t mask = (1U << shifter) - 1;
+        //(numer & mask) + mask carries when any low bit is set
+        libdivide_2s32_t q = (numers >> shifter) + ((libdivide_2s32_t)((((libdivide_2u32_t)numers & mask) + mask) >> shifter) & sign);
+        return (q ^ sign) - sign;
+    }
+    else {
+        int32_t sign = denom->divisor >> 31;
+        int32_t magic = denom->magic;
+        libdivide_2u32_t n = (libdivide_2u32_t)numers;
+        libdivide_2s32_t t = (libdivide_2s32_t)((n ^ (uint32_t)sign) & ((0U - n) | ~(uint32_t)sign)) >> 31; //all ones where the quotient is negative
+        libdivide_2s32_t z = (libdivide_2s32_t)((n ^ (libdivide_2u32_t)t) - (((libdivide_2u32_t)t & (uint32_t)sign) << 1)); //z = (numer ^ t) - 2 * (t & sign)
+        libdivide_2s32_t q = libdivide_mullhi_2s32_flat_vector(z, (libdivide_2s32_t) { magic, magic });
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q += (z ^ sign) - sign;
+        }
+        return (q >> shifter) ^ t;
+    }
+}
+
+libdivide_2s32_t libdivide_2s32_mod_euclid_vector(libdivide_2s32_t numers, const struct libdivide_s32_t *denom) {
+    uint32_t d = (uint32_t)denom->divisor;
+    //multiply unsigned, so that the wrapping is defined
+    libdivide_2u32_t r = (libdivide_2u32_t)numers - (libdivide_2u32_t)libdivide_2s32_do_floor_vector(numers, denom) * d;
+    return (libdivide_2s32_t)(r - (d & (libdivide_2u32_t)((libdivide_2s32_t)r >> 31)));
+}
+
+libdivide_4s32_t libdivide_4s32_do_floor_vector(libdivide_4s32_t numers, const struct libdivide_s32_t *denom) {
+    uint8_t more = denom->more;
+    uint8_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        int32_t sign = (int32_t)(int8_t)more >> 7;
+        uint32_t mask = (1U << shifter) - 1;
+        //(numer & mask) + mask carries when any low bit is set
+        libdivide_4s32_t q = (numers >> shifter) + ((libdivide_4s32_t)((((libdivide_4u32_t)numers & mask) + mask) >> shifter) & sign);
+        return (q ^ sign) - sign;
+    }
+    else {
+        int32_t sign = denom->divisor >> 31;
+        int32_t magic = denom->magic;
+        libdivide_4u32_t n = (libdivide_4u32_t)numers;
+        libdivide_4s32_t t = (libdivide_4s32_t)((n ^ (uint32_t)sign) & ((0U - n) | ~(uint32_t)sign)) >> 31; //all ones where the quotient is negative
+        libdivide_4s32_t z = (libdivide_4s32_t)((n ^ (libdivide_4u32_t)t) - (((libdivide_4u32_t)t & (uint32_t)sign) << 1)); //z = (numer ^ t) - 2 * (t & sign)
+        libdivide_4s32_t q = libdivide_mullhi_4s32_flat_vector(z, (libdivide_4s32_t) { magic, magic, magic, magic });
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q += (z ^ sign) - sign;
+        }
+        return (q >> shifter) ^ t;
+    }
+}
+
+libdivide_4s32_t libdivide_4s32_mod_euclid_vector(libdivide_4s32_t numers, const struct libdivide_s32_t *denom) {
+    uint32_t d = (uint32_t)denom->divisor;
+    //multiply unsigned, so that the wrapping is defined
+    libdivide_4u32_t r = (libdivide_4u32_t)numers - (libdivide_4u32_t)libdivide_4s32_do_floor_vector(numers, denom) * d;
+    return (libdivide_4s32_t)(r - (d & (libdivide_4u32_t)((libdivide_4s32_t)r >> 31)));
+}
+
+libdivide_8s32_t libdivide_8s32_do_floor_vector(libdivide_8s32_t numers, const struct libdivide_s32_t *denom) {
+    uint8_t more = denom->more;
+    uint8_t shifter = more & LIBDIVIDE_32_SHIFT_MASK;
+    if (more & LIBDIVIDE_S32_SHIFT_PATH) {
+        int32_t sign = (int32_t)(int8_t)more >> 7;
+        uint32_t mask = (1U << shifter) - 1;
+        //(numer & mask) + mask carries when any low bit is set
+        libdivide_8s32_t q = (numers >> shifter) + ((libdivide_8s32_t)((((libdivide_8u32_t)numers & mask) + mask) >> shifter) & sign);
+        return (q ^ sign) - sign;
+    }
+    else {
+        int32_t sign = denom->divisor >> 31;
+        int32_t magic = denom->magic;
+        libdivide_8u32_t n = (libdivide_8u32_t)numers;
+        libdivide_8s32_t t = (libdivide_8s32_t)((n ^ (uint32_t)sign) & ((0U - n) | ~(uint32_t)sign)) >> 31; //all ones where the quotient is negative
+        libdivide_8s32_t z = (libdivide_8s32_t)((n ^ (libdivide_8u32_t)t) - (((libdivide_8u32_t)t & (uint32_t)sign) << 1)); //z = (numer ^ t) - 2 * (t & sign)
+        libdivide_8s32_t q = libdivide_mullhi_8s32_flat_vector(z, (libdivide_8s32_t) { magic, magic, magic, magic, magic, magic, magic, magic });
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q += (z ^ sign) - sign;
+        }
+        return (q >> shifter) ^ t;
+    }
+}
+
+libdivide_8s32_t libdivide_8s32_mod_euclid_vector(libdivide_8s32_t numers, const struct libdivide_s32_t *denom) {
+    uint32_t d = (uint32_t)denom->divisor;
+    //multiply unsigned, so that the wrapping is defined
+    libdivide_8u32_t r = (libdivide_8u32_t)numers - (libdivide_8u32_t)libdivide_8s32_do_floor_vector(numers, denom) * d;
+    return (libdivide_8s32_t)(r - (d & (libdivide_8u32_t)((libdivide_8s32_t)r >> 31)));
+}
+
+libdivide_1s64_t libdivide_1s64_do_floor_vector(libdivide_1s64_t numers, const struct libdivide_s64_t *denom) {
+    uint8_t more = denom->more;
+    uint8_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
+    if (denom->magic == 0) { //shift path
+        int64_t sign = (int64_t)(int8_t)more >> 7;
+        uint64_t mask = (1ULL << shifter) - 1;
+        //(numer & mask) + mask carries when any low bit is set
+        libdivide_1s64_t q = (numers >> shifter) + ((libdivide_1s64_t)((((libdivide_1u64_t)numers & mask) + mask) >> shifter) & sign);
+        return (q ^ sign) - sign;
+    }
+    else {
+        int64_t sign = denom->divisor >> 63;
+        int64_t magic = denom->magic;
+        libdivide_1u64_t n = (libdivide_1u64_t)numers;
+        libdivide_1s64_t t = (libdivide_1s64_t)((n ^ (uint64_t)sign) & ((0ULL - n) | ~(uint64_t)sign)) >> 63; //all ones where the quotient is negative
+        libdivide_1s64_t z = (libdivide_1s64_t)((n ^ (libdivide_1u64_t)t) - (((libdivide_1u64_t)t & (uint64_t)sign) << 1)); //z = (numer ^ t) - 2 * (t & sign)
+        libdivide_1s64_t q = libdivide_mullhi_1s64_flat_vector(z, (libdivide_1s64_t) { magic });
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q += (z ^ sign) - sign;
+        }
+        return (q >> shifter) ^ t;
+    }
+}
+
+libdivide_1s64_t libdivide_1s64_mod_euclid_vector(libdivide_1s64_t numers, const struct libdivide_s64_t *denom) {
+    uint64_t d = (uint64_t)denom->divisor;
+    //multiply unsigned, so that the wrapping is defined
+    libdivide_1u64_t r = (libdivide_1u64_t)numers - (libdivide_1u64_t)libdivide_1s64_do_floor_vector(numers, denom) * d;
+    return (libdivide_1s64_t)(r - (d & (libdivide_1u64_t)((libdivide_1s64_t)r >> 63)));
+}
+
+libdivide_2s64_t libdivide_2s64_do_floor_vector(libdivide_2s64_t numers, const struct libdivide_s64_t *denom) {
+    uint8_t more = denom->more;
+    uint8_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
+    if (denom->magic == 0) { //shift path
+        int64_t sign = (int64_t)(int8_t)more >> 7;
+        uint64_t mask = (1ULL << shifter) - 1;
+        //(numer & mask) + mask carries when any low bit is set
+        libdivide_2s64_t q = (numers >> shifter) + ((libdivide_2s64_t)((((libdivide_2u64_t)numers & mask) + mask) >> shifter) & sign);
+        return (q ^ sign) - sign;
+    }
+    else {
+        int64_t sign = denom->divisor >> 63;
+        int64_t magic = denom->magic;
+        libdivide_2u64_t n = (libdivide_2u64_t)numers;
+        libdivide_2s64_t t = (libdivide_2s64_t)((n ^ (uint64_t)sign) & ((0ULL - n) | ~(uint64_t)sign)) >> 63; //all ones where the quotient is negative
+        libdivide_2s64_t z = (libdivide_2s64_t)((n ^ (libdivide_2u64_t)t) - (((libdivide_2u64_t)t & (uint64_t)sign) << 1)); //z = (numer ^ t) - 2 * (t & sign)
+        libdivide_2s64_t q = libdivide_mullhi_2s64_flat_vector(z, (libdivide_2s64_t) { magic, magic });
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q += (z ^ sign) - sign;
+        }
+        return (q >> shifter) ^ t;
+    }
+}
+
+libdivide_2s64_t libdivide_2s64_mod_euclid_vector(libdivide_2s64_t numers, const struct libdivide_s64_t *denom) {
+    uint64_t d = (uint64_t)denom->divisor;
+    //multiply unsigned, so that the wrapping is defined
+    libdivide_2u64_t r = (libdivide_2u64_t)numers - (libdivide_2u64_t)libdivide_2s64_do_floor_vector(numers, denom) * d;
+    return (libdivide_2s64_t)(r - (d & (libdivide_2u64_t)((libdivide_2s64_t)r >> 63)));
+}
+
+libdivide_4s64_t libdivide_4s64_do_floor_vector(libdivide_4s64_t numers, const struct libdivide_s64_t *denom) {
+    uint8_t more = denom->more;
+    uint8_t shifter = more & LIBDIVIDE_64_SHIFT_MASK;
+    if (denom->magic == 0) { //shift path
+        int64_t sign = (int64_t)(int8_t)more >> 7;
+        uint64_t mask = (1ULL << shifter) - 1;
+        //(numer & mask) + mask carries when any low bit is set
+        libdivide_4s64_t q = (numers >> shifter) + ((libdivide_4s64_t)((((libdivide_4u64_t)numers & mask) + mask) >> shifter) & sign);
+        return (q ^ sign) - sign;
+    }
+    else {
+        int64_t sign = denom->divisor >> 63;
+        int64_t magic = denom->magic;
+        libdivide_4u64_t n = (libdivide_4u64_t)numers;
+        libdivide_4s64_t t = (libdivide_4s64_t)((n ^ (uint64_t)sign) & ((0ULL - n) | ~(uint64_t)sign)) >> 63; //all ones where the quotient is negative
+        libdivide_4s64_t z = (libdivide_4s64_t)((n ^ (libdivide_4u64_t)t) - (((libdivide_4u64_t)t & (uint64_t)sign) << 1)); //z = (numer ^ t) - 2 * (t & sign)
+        libdivide_4s64_t q = libdivide_mullhi_4s64_flat_vector(z, (libdivide_4s64_t) { magic, magic, magic, magic });
+        if (more & LIBDIVIDE_ADD_MARKER) {
+            q += (z ^ sign) - sign;
+        }
+        return (q >> shifter) ^ t;
+    }
+}
+
+libdivide_4s64_t libdivide_4s64_mod_euclid_vector(libdivide_4s64_t numers, const struct libdivide_s64_t *denom) {
+    uint64_t d = (uint64_t)denom->divisor;
+    //multiply unsigned, so that the wrapping is defined
+    libdivide_4u64_t r = (libdivide_4u64_t)numers - (libdivide_4u64_t)libdivide_4s64_do_floor_vector(numers, denom) * d;
+    return (libdivide_4s64_t)(r - (d & (libdivide_4u64_t)((libdivide_4s64_t)r >> 63)));
+}
+#endif
+
+/////////// CEILING AND ROUNDING
+
+/* Ceiling and round-to-nearest division take the ordinary divisors, and never form numer + d - 1 or numer + d / 2, which overflow near the top of the range.  Unsigned ceil uses ceil(n / d) = (n - 1) / d + 1 for n > 0, which costs no more than a plain divide.  The others fix up the truncated quotient from the remainder r: signed ceil adds one when r is nonzero and has the sign of the divisor, and round steps away from zero when |r| > (|d| - 1) / 2, that is when 2|r| >= |d|, so that halves round away from zero like C's round(). */
+uint32_t libdivide_u32_do_ceil(uint32_t numer, const struct libdivide_u32_t *denom) {
+    uint32_t nz = numer != 0;
+    return libdivide_u32_do(numer - nz, denom) + nz;
+}
+
+uint32_t libdivide_u32_do_round(uint32_t numer, const struct libdivide_u32_t *denom) {
+    uint32_t r;
+    uint32_t q = libdivide_u32_divmod(numer, denom, &r);
+    return q + (r > (denom->divisor - 1) / 2);
+}
+
+int32_t libdivide_s32_do_ceil(int32_t numer, const struct libdivide_s32_t *denom) {
+    int32_t r;
+    int32_t q = libdivide_s32_divmod(numer, denom, &r);
+    uint32_t notSign = ~(uint32_t)(denom->divisor >> 31);
+    //(r ^ notSign) - notSign is -r for d > 0 and r for d < 0, and is negative exactly when we round up
+    return (int32_t)((uint32_t)q + ((((uint32_t)r ^ notSign) - notSign) >> 31));
+}
+
+int32_t libdivide_s32_do_round(int32_t numer, const struct libdivide_s32_t *denom) {
+    int32_t r;
+    int32_t q = libdivide_s32_divmod(numer, denom, &r);
+    int32_t dSign = denom->divisor >> 31;
+    int32_t rSign = r >> 31;
+    uint32_t half = ((((uint32_t)denom->divisor ^ dSign) - dSign) - 1) >> 1; //(|d| - 1) / 2, and |INT_MIN| is fine unsigned
+    uint32_t up = (half - (((uint32_t)r ^ rSign) - rSign)) >> 31; //|r| > half
+    uint32_t qSign = (uint32_t)(rSign ^ dSign);
+    return (int32_t)((uint32_t)q + ((up ^ qSign) - qSign)); //step by +-1 in the direction of the quotient
+}
+
+uint64_t libdivide_u64_do_ceil(uint64_t numer, const struct libdivide_u64_t *denom) {
+    uint64_t nz = numer != 0;
+    return libdivide_u64_do(numer - nz, denom) + nz;
+}
+
+uint64_t libdivide_u64_do_round(uint64_t numer, const struct libdivide_u64_t *denom) {
+    uint64_t r;
+    uint64_t q = libdivide_u64_divmod(numer, denom, &r);
+    return q + (r > (denom->divisor - 1) / 2);
+}
+
+int64_t libdivide_s64_do_ceil(int64_t numer, const struct libdivide_s64_t *denom) {
+    int64_t r;
+    int64_t q = libdivide_s64_divmod(numer, denom, &r);
+    uint64_t notSign = ~(uint64_t)(denom->divisor >> 63);
+    //(r ^ notSign) - notSign is -r for d > 0 and r for d < 0, and is negative exactly when we round up
+    return (int64_t)((uint64_t)q + ((((uint64_t)r ^ notSign) - notSign) >> 63));
+}
+
+int64_t libdivide_s64_do_round(int64_t numer, const struct libdivide_s64_t *denom) {
+    int64_t r;
+    int64_t q = libdivide_s64_divmod(numer, denom, &r);
+    int64_t dSign = denom->divisor >> 63;
+    int64_t rSign = r >> 63;
+    uint64_t half = ((((uint64_t)denom->divisor ^ dSign) - dSign) - 1) >> 1; //(|d| - 1) / 2, and |INT64_MIN| is fine unsigned
+    uint64_t up = (half - (((uint64_t)r ^ rSign) - rSign)) >> 63; //|r| > half
+    uint64_t qSign = (uint64_t)(rSign ^ dSign);
+    return (int64_t)((uint64_t)q + ((up ^ qSign) - qSign)); //step by +-1 in the direction of the quotient
+}
+
+/* The vector forms follow the scalar ones lane for lane. */
+#if LIBDIVIDE_USE_SSE2
+__m128i libdivide_4u32_do_ceil_vector(__m128i numers, const struct libdivide_u32_t *denom) {
+    __m128i nz = _mm_srli_epi32(_mm_or_si128(numers, _mm_sub_epi32(_mm_setzero_si128(), numers)), 31); //numer != 0
+    return _mm_add_epi32(libdivide_4u32_do_vector(_mm_sub_epi32(numers, nz), denom), nz);
+}
+
+__m128i libdivide_4u32_do_round_vector(__m128i numers, const struct libdivide_u32_t *denom) {
+    __m128i r;
+    __m128i q = libdivide_4u32_divmod_vector(numers, denom, &r);
+    __m128i half = _mm_set1_epi32((int32_t)((denom->divisor - 1) / 2));
+    return _mm_add_epi32(q, _mm_srli_epi32(_mm_sub_epi32(half, r), 31)); //q += r > half
+}
+
+__m128i libdivide_4s32_do_ceil_vector(__m128i numers, const struct libdivide_s32_t *denom) {
+    __m128i r;
+    __m128i q = libdivide_4s32_divmod_vector(numers, denom, &r);
+    __m128i notSign = _mm_set1_epi32(~(denom->divisor >> 31));
+    return _mm_add_epi32(q, _mm_srli_epi32(_mm_sub_epi32(_mm_xor_si128(r, notSign), notSign), 31));
+}
+
+__m128i libdivide_4s32_do_round_vector(__m128i numers, const struct libdivide_s32_t *denom) {
+    __m128i r;
+    __m128i q = libdivide_4s32_divmod_vector(numers, denom, &r);
+    int32_t dSign = denom->divisor >> 31;
+    __m128i half = _mm_set1_epi32((int32_t)(((((uint32_t)denom->divisor ^ dSign) - dSign) - 1) >> 1));
+    __m128i rSign = _mm_srai_epi32(r, 31);
+    __m128i qSign = _mm_xor_si128(rSign, _mm_set1_epi32(dSign));
+    __m128i up = _mm_srli_epi32(_mm_sub_epi32(half, _mm_sub_epi32(_mm_xor_si128(r, rSign), rSign)), 31); //|r| > half
+    return _mm_add_epi32(q, _mm_sub_epi32(_mm_xor_si128(up, qSign), qSign));
+}
+
+__m128i libdivide_2u64_do_ceil_vector(__m128i numers, const struct libdivide_u64_t *denom) {
+    __m128i nz = _mm_srli_epi64(_mm_or_si128(numers, _mm_sub_epi64(_mm_setzero_si128(), numers)), 63); //numer != 0
+    return _mm_add_epi64(libdivide_2u64_do_vector(_mm_sub_epi64(numers, nz), denom), nz);
+}
+
+__m128i libdivide_2u64_do_round_vector(__m128i numers, const struct libdivide_u64_t *denom) {
+    __m128i r;
+    __m128i q = libdivide_2u64_divmod_vector(numers, denom, &r);
+    __m128i half = libdivide__u64_to_m128((denom->divisor - 1) / 2);
+    return _mm_add_epi64(q, _mm_srli_epi64(_mm_sub_epi64(half, r), 63)); //q += r > half
+}
+
+__m128i libdivide_2s64_do_ceil_vector(__m128i numers, const struct libdivide_s64_t *denom) {
+    __m128i r;
+    __m128i q = libdivide_2s64_divmod_vector(numers, denom, &r);
+    __m128i notSign = libdivide__u64_to_m128(~(uint64_t)(denom->divisor >> 63));
+    return _mm_add_epi64(q, _mm_srli_epi64(_mm_sub_epi64(_mm_xor_si128(r, notSign), notSign), 63));
+}
+
+__m128i libdivide_2s64_do_round_vector(__m128i numers, const struct libdivide_s64_t *denom) {
+    __m128i r;
+    __m128i q = libdivide_2s64_divmod_vector(numers, denom, &r);
+    int64_t dSign = denom->divisor >> 63;
+    __m128i half = libdivide__u64_to_m128(((((uint64_t)denom->divisor ^ dSign) - dSign) - 1) >> 1);
+    __m128i rSign = libdivide_s64_signbits(r);
+    __m128i qSign = _mm_xor_si128(rSign, libdivide__u64_to_m128((uint64_t)dSign));
+    __m128i up = _mm_srli_epi64(_mm_sub_epi64(half, _mm_sub_epi64(_mm_xor_si128(r, rSign), rSign)), 63); //|r| > half
+    return _mm_add_epi64(q, _mm_sub_epi64(_mm_xor_si128(up, qSign), qSign));
+}
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_do_ceil_vector(__m256i numers, const struct libdivide_u32_t *denom) {
+    __m256i nz = _mm256_srli_epi32(_mm256_or_si256(numers, _mm256_sub_epi32(_mm256_setzero_si256(), numers)), 31);
+    return _mm256_add_epi32(libdivide_8u32_do_vector(_mm256_sub_epi32(numers, nz), denom), nz);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_do_round_vector(__m256i numers, const struct libdivide_u32_t *denom) {
+    __m256i r;
+    __m256i q = libdivide_8u32_divmod_vector(numers, denom, &r);
+    __m256i half = _mm256_set1_epi32((int32_t)((denom->divisor - 1) / 2));
+    return _mm256_add_epi32(q, _mm256_srli_epi32(_mm256_sub_epi32(half, r), 31));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_do_ceil_vector(__m256i numers, const struct libdivide_s32_t *denom) {
+    __m256i r;
+    __m256i q = libdivide_8s32_divmod_vector(numers, denom, &r);
+    __m256i notSign = _mm256_set1_epi32(~(denom->divisor >> 31));
+    return _mm256_add_epi32(q, _mm256_srli_epi32(_mm256_sub_epi32(_mm256_xor_si256(r, notSign), notSign), 31));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_do_round_vector(__m256i numers, const struct libdivide_s32_t *denom) {
+    __m256i r;
+    __m256i q = libdivide_8s32_divmod_vector(numers, denom, &r);
+    int32_t dSign = denom->divisor >> 31;
+    __m256i half = _mm256_set1_epi32((int32_t)(((((uint32_t)denom->divisor ^ dSign) - dSign) - 1) >> 1));
+    __m256i rSign = _mm256_srai_epi32(r, 31);
+    __m256i qSign = _mm256_xor_si256(rSign, _mm256_set1_epi32(dSign));
+    __m256i up = _mm256_srli_epi32(_mm256_sub_epi32(half, _mm256_sub_epi32(_mm256_xor_si256(r, rSign), rSign)), 31);
+    return _mm256_add_epi32(q, _mm256_sub_epi32(_mm256_xor_si256(up, qSign), qSign));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_do_ceil_vector(__m256i numers, const struct libdivide_u64_t *denom) {
+    __m256i nz = _mm256_srli_epi64(_mm256_or_si256(numers, _mm256_sub_epi64(_mm256_setzero_si256(), numers)), 63);
+    return _mm256_add_epi64(libdivide_4u64_do_vector(_mm256_sub_epi64(numers, nz), denom), nz);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_do_round_vector(__m256i numers, const struct libdivide_u64_t *denom) {
+    __m256i r;
+    __m256i q = libdivide_4u64_divmod_vector(numers, denom, &r);
+    __m256i half = libdivide__u64_to_m256i((denom->divisor - 1) / 2);
+    return _mm256_add_epi64(q, _mm256_srli_epi64(_mm256_sub_epi64(half, r), 63));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_do_ceil_vector(__m256i numers, const struct libdivide_s64_t *denom) {
+    __m256i r;
+    __m256i q = libdivide_4s64_divmod_vector(numers, denom, &r);
+    __m256i notSign = libdivide__u64_to_m256i(~(uint64_t)(denom->divisor >> 63));
+    return _mm256_add_epi64(q, _mm256_srli_epi64(_mm256_sub_epi64(_mm256_xor_si256(r, notSign), notSign), 63));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_do_round_vector(__m256i numers, const struct libdivide_s64_t *denom) {
+    __m256i r;
+    __m256i q = libdivide_4s64_divmod_vector(numers, denom, &r);
+    int64_t dSign = denom->divisor >> 63;
+    __m256i half = libdivide__u64_to_m256i(((((uint64_t)denom->divisor ^ dSign) - dSign) - 1) >> 1);
+    __m256i rSign = libdivide_4s64_signbits(r);
+    __m256i qSign = _mm256_xor_si256(rSign, libdivide__u64_to_m256i((uint64_t)dSign));
+    __m256i up = _mm256_srli_epi64(_mm256_sub_epi64(half, _mm256_sub_epi64(_mm256_xor_si256(r, rSign), rSign)), 63);
+    return _mm256_add_epi64(q, _mm256_sub_epi64(_mm256_xor_si256(up, qSign), qSign));
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_do_ceil_vector(__m512i numers, const struct libdivide_u32_t *denom) {
+    __m512i nz = _mm512_srli_epi32(_mm512_or_si512(numers, _mm512_sub_epi32(_mm512_setzero_si512(), numers)), 31);
+    return _mm512_add_epi32(libdivide_16u32_do_vector(_mm512_sub_epi32(numers, nz), denom), nz);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_do_round_vector(__m512i numers, const struct libdivide_u32_t *denom) {
+    __m512i r;
+    __m512i q = libdivide_16u32_divmod_vector(numers, denom, &r);
+    __m512i half = _mm512_set1_epi32((int32_t)((denom->divisor - 1) / 2));
+    return _mm512_add_epi32(q, _mm512_srli_epi32(_mm512_sub_epi32(half, r), 31));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_do_ceil_vector(__m512i numers, const struct libdivide_s32_t *denom) {
+    __m512i r;
+    __m512i q = libdivide_16s32_divmod_vector(numers, denom, &r);
+    __m512i notSign = _mm512_set1_epi32(~(denom->divisor >> 31));
+    return _mm512_add_epi32(q, _mm512_srli_epi32(_mm512_sub_epi32(_mm512_xor_si512(r, notSign), notSign), 31));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_do_round_vector(__m512i numers, const struct libdivide_s32_t *denom) {
+    __m512i r;
+    __m512i q = libdivide_16s32_divmod_vector(numers, denom, &r);
+    int32_t dSign = denom->divisor >> 31;
+    __m512i half = _mm512_set1_epi32((int32_t)(((((uint32_t)denom->divisor ^ dSign) - dSign) - 1) >> 1));
+    __m512i rSign = _mm512_srai_epi32(r, 31);
+    __m512i qSign = _mm512_xor_si512(rSign, _mm512_set1_epi32(dSign));
+    __m512i up = _mm512_srli_epi32(_mm512_sub_epi32(half, _mm512_sub_epi32(_mm512_xor_si512(r, rSign), rSign)), 31);
+    return _mm512_add_epi32(q, _mm512_sub_epi32(_mm512_xor_si512(up, qSign), qSign));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_do_ceil_vector(__m512i numers, const struct libdivide_u64_t *denom) {
+    __m512i nz = _mm512_srli_epi64(_mm512_or_si512(numers, _mm512_sub_epi64(_mm512_setzero_si512(), numers)), 63);
+    return _mm512_add_epi64(libdivide_8u64_do_vector(_mm512_sub_epi64(numers, nz), denom), nz);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_do_round_vector(__m512i numers, const struct libdivide_u64_t *denom) {
+    __m512i r;
+    __m512i q = libdivide_8u64_divmod_vector(numers, denom, &r);
+    __m512i half = libdivide__u64_to_m512i((denom->divisor - 1) / 2);
+    return _mm512_add_epi64(q, _mm512_srli_epi64(_mm512_sub_epi64(half, r), 63));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_do_ceil_vector(__m512i numers, const struct libdivide_s64_t *denom) {
+    __m512i r;
+    __m512i q = libdivide_8s64_divmod_vector(numers, denom, &r);
+    __m512i notSign = libdivide__u64_to_m512i(~(uint64_t)(denom->divisor >> 63));
+    return _mm512_add_epi64(q, _mm512_srli_epi64(_mm512_sub_epi64(_mm512_xor_si512(r, notSign), notSign), 63));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_do_round_vector(__m512i numers, const struct libdivide_s64_t *denom) {
+    __m512i r;
+    __m512i q = libdivide_8s64_divmod_vector(numers, denom, &r);
+    int64_t dSign = denom->divisor >> 63;
+    __m512i half = libdivide__u64_to_m512i(((((uint64_t)denom->divisor ^ dSign) - dSign) - 1) >> 1);
+    __m512i rSign = libdivide_8s64_signbits(r);
+    __m512i qSign = _mm512_xor_si512(rSign, libdivide__u64_to_m512i((uint64_t)dSign));
+    __m512i up = _mm512_srli_epi64(_mm512_sub_epi64(half, _mm512_sub_epi64(_mm512_xor_si512(r, rSign), rSign)), 63);
+    return _mm512_add_epi64(q, _mm512_sub_epi64(_mm512_xor_si512(up, qSign), qSign));
+}
+#endif
+#elif LIBDIVIDE_USE_NEON
+uint32x2_t libdivide_2u32_do_ceil_vector(uint32x2_t numers, const struct libdivide_u32_t *denom) {
+    uint32x2_t nz = vshr_n_u32(vorr_u32(numers, vsub_u32(vdup_n_u32(0), numers)), 31); //numer != 0
+    return vadd_u32(libdivide_2u32_do_vector(vsub_u32(numers, nz), denom), nz);
+}
+
+uint32x2_t libdivide_2u32_do_round_vector(uint32x2_t numers, const struct libdivide_u32_t *denom) {
+    uint32x2_t r;
+    uint32x2_t q = libdivide_2u32_divmod_vector(numers, denom, &r);
+    return vadd_u32(q, vshr_n_u32(vsub_u32(vdup_n_u32((denom->divisor - 1) / 2), r), 31)); //q += r > half
+}
+
+int32x2_t libdivide_2s32_do_ceil_vector(int32x2_t numers, const struct libdivide_s32_t *denom) {
+    int32x2_t r;
+    int32x2_t q = libdivide_2s32_divmod_vector(numers, denom, &r);
+    int32x2_t notSign = vdup_n_s32(~(denom->divisor >> 31));
+    uint32x2_t up = vshr_n_u32(vreinterpret_u32_s32(vsub_s32(veor_s32(r, notSign), notSign)), 31);
+    return vadd_s32(q, vreinterpret_s32_u32(up));
+}
+
+int32x2_t libdivide_2s32_do_round_vector(int32x2_t numers, const struct libdivide_s32_t *denom) {
+    int32x2_t r;
+    int32x2_t q = libdivide_2s32_divmod_vector(numers, denom, &r);
+    int32_t dSign = denom->divisor >> 31;
+    uint32x2_t half = vdup_n_u32(((((uint32_t)denom->divisor ^ dSign) - dSign) - 1) >> 1);
+    int32x2_t rSign = vshr_n_s32(r, 31);
+    int32x2_t qSign = veor_s32(rSign, vdup_n_s32(dSign));
+    uint32x2_t absR = vreinterpret_u32_s32(vsub_s32(veor_s32(r, rSign), rSign));
+    int32x2_t up = vreinterpret_s32_u32(vshr_n_u32(vsub_u32(half, absR), 31)); //|r| > half
+    return vadd_s32(q, vsub_s32(veor_s32(up, qSign), qSign));
+}
+
+uint32x4_t libdivide_4u32_do_ceil_vector(uint32x4_t numers, const struct libdivide_u32_t *denom) {
+    uint32x4_t nz = vshrq_n_u32(vorrq_u32(numers, vsubq_u32(vdupq_n_u32(0), numers)), 31); //numer != 0
+    return vaddq_u32(libdivide_4u32_do_vector(vsubq_u32(numers, nz), denom), nz);
+}
+
+uint32x4_t libdivide_4u32_do_round_vector(uint32x4_t numers, const struct libdivide_u32_t *denom) {
+    uint32x4_t r;
+    uint32x4_t q = libdivide_4u32_divmod_vector(numers, denom, &r);
+    return vaddq_u32(q, vshrq_n_u32(vsubq_u32(vdupq_n_u32((denom->divisor - 1) / 2), r), 31)); //q += r > half
+}
+
+int32x4_t libdivide_4s32_do_ceil_vector(int32x4_t numers, const struct libdivide_s32_t *denom) {
+    int32x4_t r;
+    int32x4_t q = libdivide_4s32_divmod_vector(numers, denom, &r);
+    int32x4_t notSign = vdupq_n_s32(~(denom->divisor >> 31));
+    uint32x4_t up = vshrq_n_u32(vreinterpretq_u32_s32(vsubq_s32(veorq_s32(r, notSign), notSign)), 31);
+    return vaddq_s32(q, vreinterpretq_s32_u32(up));
+}
+
+int32x4_t libdivide_4s32_do_round_vector(int32x4_t numers, const struct libdivide_s32_t *denom) {
+    int32x4_t r;
+    int32x4_t q = libdivide_4s32_divmod_vector(numers, denom, &r);
+    int32_t dSign = denom->divisor >> 31;
+    uint32x4_t half = vdupq_n_u32(((((uint32_t)denom->divisor ^ dSign) - dSign) - 1) >> 1);
+    int32x4_t rSign = vshrq_n_s32(r, 31);
+    int32x4_t qSign = veorq_s32(rSign, vdupq_n_s32(dSign));
+    uint32x4_t absR = vreinterpretq_u32_s32(vsubq_s32(veorq_s32(r, rSign), rSign));
+    int32x4_t up = vreinterpretq_s32_u32(vshrq_n_u32(vsubq_u32(half, absR), 31)); //|r| > half
+    return vaddq_s32(q, vsubq_s32(veorq_s32(up, qSign), qSign));
+}
+
+uint32x4x2_t libdivide_8u32_do_ceil_vector(uint32x4x2_t numers, const struct libdivide_u32_t *denom) {
+    uint32x4x2_t result;
+    result.val[0] = libdivide_4u32_do_ceil_vector(numers.val[0], denom);
+    result.val[1] = libdivide_4u32_do_ceil_vector(numers.val[1], denom);
+    return result;
+}
+
+uint32x4x2_t libdivide_8u32_do_round_vector(uint32x4x2_t numers, const struct libdivide_u32_t *denom) {
+    uint32x4x2_t result;
+    result.val[0] = libdivide_4u32_do_round_vector(numers.val[0], denom);
+    result.val[1] = libdivide_4u32_do_round_vector(numers.val[1], denom);
+    return result;
+}
+
+int32x4x2_t libdivide_8s32_do_ceil_vector(int32x4x2_t numers, const struct libdivide_s32_t *denom) {
+    int32x4x2_t result;
+    result.val[0] = libdivide_4s32_do_ceil_vector(numers.val[0], denom);
+    result.val[1] = libdivide_4s32_do_ceil_vector(numers.val[1], denom);
+    return result;
+}
+
+int32x4x2_t libdivide_8s32_do_round_vector(int32x4x2_t numers, const struct libdivide_s32_t *denom) {
+    int32x4x2_t result;
+    result.val[0] = libdivide_4s32_do_round_vector(numers.val[0], denom);
+    result.val[1] = libdivide_4s32_do_round_vector(numers.val[1], denom);
+    return result;
+}
+
+uint64x1_t libdivide_1u64_do_ceil_vector(uint64x1_t numers, const struct libdivide_u64_t *denom) {
+    return vdup_n_u64(libdivide_u64_do_ceil(vget_lane_u64(numers, 0), denom));
+}
+
+uint64x1_t libdivide_1u64_do_round_vector(uint64x1_t numers, const struct libdivide_u64_t *denom) {
+    return vdup_n_u64(libdivide_u64_do_round(vget_lane_u64(numers, 0), denom));
+}
+
+int64x1_t libdivide_1s64_do_ceil_vector(int64x1_t numers, const struct libdivide_s64_t *denom) {
+    return vdup_n_s64(libdivide_s64_do_ceil(vget_lane_s64(numers, 0), denom));
+}
+
+int64x1_t libdivide_1s64_do_round_vector(int64x1_t numers, const struct libdivide_s64_t *denom) {
+    return vdup_n_s64(libdivide_s64_do_round(vget_lane_s64(numers, 0), denom));
+}
+
+uint64x2_t libdivide_2u64_do_ceil_vector(uint64x2_t numers, const struct libdivide_u64_t *denom) {
+    uint64x2_t nz = vshrq_n_u64(vorrq_u64(numers, vsubq_u64(vdupq_n_u64(0), numers)), 63); //numer != 0
+    return vaddq_u64(libdivide_2u64_do_vector(vsubq_u64(numers, nz), denom), nz);
+}
+
+uint64x2_t libdivide_2u64_do_round_vector(uint64x2_t numers, const struct libdivide_u64_t *denom) {
+    uint64x2_t r;
+    uint64x2_t q = libdivide_2u64_divmod_vector(numers, denom, &r);
+    return vaddq_u64(q, vshrq_n_u64(vsubq_u64(vdupq_n_u64((denom->divisor - 1) / 2), r), 63)); //q += r > half
+}
+
+int64x2_t libdivide_2s64_do_ceil_vector(int64x2_t numers, const struct libdivide_s64_t *denom) {
+    int64x2_t r;
+    int64x2_t q = libdivide_2s64_divmod_vector(numers, denom, &r);
+    int64x2_t notSign = vdupq_n_s64(~(denom->divisor >> 63));
+    uint64x2_t up = vshrq_n_u64(vreinterpretq_u64_s64(vsubq_s64(veorq_s64(r, notSign), notSign)), 63);
+    return vaddq_s64(q, vreinterpretq_s64_u64(up));
+}
+
+int64x2_t libdivide_2s64_do_round_vector(int64x2_t numers, const struct libdivide_s64_t *denom) {
+    int64x2_t r;
+    int64x2_t q = libdivide_2s64_divmod_vector(numers, denom, &r);
+    int64_t dSign = denom->divisor >> 63;
+    uint64x2_t half = vdupq_n_u64(((((uint64_t)denom->divisor ^ dSign) - dSign) - 1) >> 1);
+    int64x2_t rSign = vshrq_n_s64(r, 63);
+    int64x2_t qSign = veorq_s64(rSign, vdupq_n_s64(dSign));
+    uint64x2_t absR = vreinterpretq_u64_s64(vsubq_s64(veorq_s64(r, rSign), rSign));
+    int64x2_t up = vreinterpretq_s64_u64(vshrq_n_u64(vsubq_u64(half, absR), 63)); //|r| > half
+    return vaddq_s64(q, vsubq_s64(veorq_s64(up, qSign), qSign));
+}
+
+uint64x2x2_t libdivide_4u64_do_ceil_vector(uint64x2x2_t numers, const struct libdivide_u64_t *denom) {
+    uint64x2x2_t result;
+    result.val[0] = libdivide_2u64_do_ceil_vector(numers.val[0], denom);
+    result.val[1] = libdivide_2u64_do_ceil_vector(numers.val[1], denom);
+    return result;
+}
+
+uint64x2x2_t libdivide_4u64_do_round_vector(uint64x2x2_t numers, const struct libdivide_u64_t *denom) {
+    uint64x2x2_t result;
+    result.val[0] = libdivide_2u64_do_round_vector(numers.val[0], denom);
+    result.val[1] = libdivide_2u64_do_round_vector(numers.val[1], denom);
+    return result;
+}
+
+int64x2x2_t libdivide_4s64_do_ceil_vector(int64x2x2_t numers, const struct libdivide_s64_t *denom) {
+    int64x2x2_t result;
+    result.val[0] = libdivide_2s64_do_ceil_vector(numers.val[0], denom);
+    result.val[1] = libdivide_2s64_do_ceil_vector(numers.val[1], denom);
+    return result;
+}
+
+int64x2x2_t libdivide_4s64_do_round_vector(int64x2x2_t numers, const struct libdivide_s64_t *denom) {
+    int64x2x2_t result;
+    result.val[0] = libdivide_2s64_do_round_vector(numers.val[0], denom);
+    result.val[1] = libdivide_2s64_do_round_vector(numers.val[1], denom);
+    return result;
+}
+
+#elif LIBDIVIDE_USE_VECTOR
+libdivide_2u32_t libdivide_2u32_do_ceil_vector(libdivide_2u32_t numers, const struct libdivide_u32_t *denom) {
+    libdivide_2u32_t nz = (numers | (0U - numers)) >> 31; //numer != 0
+    return libdivide_2u32_do_vector(numers - nz, denom) + nz;
+}
+
+libdivide_2u32_t libdivide_2u32_do_round_vector(libdivide_2u32_t numers, const struct libdivide_u32_t *denom) {
+    libdivide_2u32_t r;
+    libdivide_2u32_t q = libdivide_2u32_divmod_vector(numers, denom, &r);
+    return q + (((uint32_t)((denom->divisor - 1) / 2) - r) >> 31); //q += r > half
+}
+
+libdivide_2s32_t libdivide_2s32_do_ceil_vector(libdivide_2s32_t numers, const struct libdivide_s32_t *denom) {
+    libdivide_2s32_t r;
+    libdivide_2s32_t q = libdivide_2s32_divmod_vector(numers, denom, &r);
+    uint32_t notSign = ~(uint32_t)(denom->divisor >> 31);
+    //add unsigned, so that the wrapping is defined
+    return (libdivide_2s32_t)((libdivide_2u32_t)q + ((((libdivide_2u32_t)r ^ notSign) - notSign) >> 31));
+}
+
+libdivide_2s32_t libdivide_2s32_do_round_vector(libdivide_2s32_t numers, const struct libdivide_s32_t *denom) {
+    libdivide_2s32_t r;
+    libdivide_2s32_t q = libdivide_2s32_divmod_vector(numers, denom, &r);
+    int32_t dSign = denom->divisor >> 31;
+    uint32_t half = ((((uint32_t)denom->divisor ^ dSign) - dSign) - 1) >> 1;
+    libdivide_2u32_t rSign = (libdivide_2u32_t)(r >> 31);
+    libdivide_2u32_t qSign = rSign ^ (uint32_t)dSign;
+    libdivide_2u32_t up = (half - (((libdivide_2u32_t)r ^ rSign) - rSign)) >> 31; //|r| > half
+    return (libdivide_2s32_t)((libdivide_2u32_t)q + ((up ^ qSign) - qSign));
+}
+
+libdivide_4u32_t libdivide_4u32_do_ceil_vector(libdivide_4u32_t numers, const struct libdivide_u32_t *denom) {
+    libdivide_4u32_t nz = (numers | (0U - numers)) >> 31; //numer != 0
+    return libdivide_4u32_do_vector(numers - nz, denom) + nz;
+}
+
+libdivide_4u32_t libdivide_4u32_do_round_vector(libdivide_4u32_t numers, const struct libdivide_u32_t *denom) {
+    libdivide_4u32_t r;
+    libdivide_4u32_t q = libdivide_4u32_divmod_vector(numers, denom, &r);
+    return q + (((uint32_t)((denom->divisor - 1) / 2) - r) >> 31); //q += r > half
+}
+
+libdivide_4s32_t libdivide_4s32_do_ceil_vector(libdivide_4s32_t numers, const struct libdivide_s32_t *denom) {
+    libdivide_4s32_t r;
+    libdivide_4s32_t q = libdivide_4s32_divmod_vector(numers, denom, &r);
+    uint32_t notSign = ~(uint32_t)(denom->divisor >> 31);
+    //add unsigned, so that the wrapping is defined
+    return (libdivide_4s32_t)((libdivide_4u32_t)q + ((((libdivide_4u32_t)r ^ notSign) - notSign) >> 31));
+}
+
+libdivide_4s32_t libdivide_4s32_do_round_vector(libdivide_4s32_t numers, const struct libdivide_s32_t *denom) {
+    libdivide_4s32_t r;
+    libdivide_4s32_t q = libdivide_4s32_divmod_vector(numers, denom, &r);
+    int32_t dSign = denom->divisor >> 31;
+    uint32_t half = ((((uint32_t)denom->divisor ^ dSign) - dSign) - 1) >> 1;
+    libdivide_4u32_t rSign = (libdivide_4u32_t)(r >> 31);
+    libdivide_4u32_t qSign = rSign ^ (uint32_t)dSign;
+    libdivide_4u32_t up = (half - (((libdivide_4u32_t)r ^ rSign) - rSign)) >> 31; //|r| > half
+    return (libdivide_4s32_t)((libdivide_4u32_t)q + ((up ^ qSign) - qSign));
+}
+
+libdivide_8u32_t libdivide_8u32_do_ceil_vector(libdivide_8u32_t numers, const struct libdivide_u32_t *denom) {
+    libdivide_8u32_t nz = (numers | (0U - numers)) >> 31; //numer != 0
+    return libdivide_8u32_do_vector(numers - nz, denom) + nz;
+}
+
+libdivide_8u32_t libdivide_8u32_do_round_vector(libdivide_8u32_t numers, const struct libdivide_u32_t *denom) {
+    libdivide_8u32_t r;
+    libdivide_8u32_t q = libdivide_8u32_divmod_vector(numers, denom, &r);
+    return q + (((uint32_t)((denom->divisor - 1) / 2) - r) >> 31); //q += r > half
+}
+
+libdivide_8s32_t libdivide_8s32_do_ceil_vector(libdivide_8s32_t numers, const struct libdivide_s32_t *denom) {
+    libdivide_8s32_t r;
+    libdivide_8s32_t q = libdivide_8s32_divmod_vector(numers, denom, &r);
+    uint32_t notSign = ~(uint32_t)(denom->divisor >> 31);
+    //add unsigned, so that the wrapping is defined
+    return (libdivide_8s32_t)((libdivide_8u32_t)q + ((((libdivide_8u32_t)r ^ notSign) - notSign) >> 31));
+}
+
+libdivide_8s32_t libdivide_8s32_do_round_vector(libdivide_8s32_t numers, const struct libdivide_s32_t *denom) {
+    libdivide_8s32_t r;
+    libdivide_8s32_t q = libdivide_8s32_divmod_vector(numers, denom, &r);
+    int32_t dSign = denom->divisor >> 31;
+    uint32_t half = ((((uint32_t)denom->divisor ^ dSign) - dSign) - 1) >> 1;
+    libdivide_8u32_t rSign = (libdivide_8u32_t)(r >> 31);
+    libdivide_8u32_t qSign = rSign ^ (uint32_t)dSign;
+    libdivide_8u32_t up = (half - (((libdivide_8u32_t)r ^ rSign) - rSign)) >> 31; //|r| > half
+    return (libdivide_8s32_t)((libdivide_8u32_t)q + ((up ^ qSign) - qSign));
+}
+
+libdivide_1u64_t libdivide_1u64_do_ceil_vector(libdivide_1u64_t numers, const struct libdivide_u64_t *denom) {
+    libdivide_1u64_t nz = (numers | (0ULL - numers)) >> 63; //numer != 0
+    return libdivide_1u64_do_vector(numers - nz, denom) + nz;
+}
+
+libdivide_1u64_t libdivide_1u64_do_round_vector(libdivide_1u64_t numers, const struct libdivide_u64_t *denom) {
+    libdivide_1u64_t r;
+    libdivide_1u64_t q = libdivide_1u64_divmod_vector(numers, denom, &r);
+    return q + (((uint64_t)((denom->divisor - 1) / 2) - r) >> 63); //q += r > half
+}
+
+libdivide_1s64_t libdivide_1s64_do_ceil_vector(libdivide_1s64_t numers, const struct libdivide_s64_t *denom) {
+    libdivide_1s64_t r;
+    libdivide_1s64_t q = libdivide_1s64_divmod_vector(numers, denom, &r);
+    uint64_t notSign = ~(uint64_t)(denom->divisor >> 63);
+    //add unsigned, so that the wrapping is defined
+    return (libdivide_1s64_t)((libdivide_1u64_t)q + ((((libdivide_1u64_t)r ^ notSign) - notSign) >> 63));
+}
+
+libdivide_1s64_t libdivide_1s64_do_round_vector(libdivide_1s64_t numers, const struct libdivide_s64_t *denom) {
+    libdivide_1s64_t r;
+    libdivide_1s64_t q = libdivide_1s64_divmod_vector(numers, denom, &r);
+    int64_t dSign = denom->divisor >> 63;
+    uint64_t half = ((((uint64_t)denom->divisor ^ dSign) - dSign) - 1) >> 1;
+    libdivide_1u64_t rSign = (libdivide_1u64_t)(r >> 63);
+    libdivide_1u64_t qSign = rSign ^ (uint64_t)dSign;
+    libdivide_1u64_t up = (half - (((libdivide_1u64_t)r ^ rSign) - rSign)) >> 63; //|r| > half
+    return (libdivide_1s64_t)((libdivide_1u64_t)q + ((up ^ qSign) - qSign));
+}
+
+libdivide_2u64_t libdivide_2u64_do_ceil_vector(libdivide_2u64_t numers, const struct libdivide_u64_t *denom) {
+    libdivide_2u64_t nz = (numers | (0ULL - numers)) >> 63; //numer != 0
+    return libdivide_2u64_do_vector(numers - nz, denom) + nz;
+}
+
+libdivide_2u64_t libdivide_2u64_do_round_vector(libdivide_2u64_t numers, const struct libdivide_u64_t *denom) {
+    libdivide_2u64_t r;
+    libdivide_2u64_t q = libdivide_2u64_divmod_vector(numers, denom, &r);
+    return q + (((uint64_t)((denom->divisor - 1) / 2) - r) >> 63); //q += r > half
+}
+
+libdivide_2s64_t libdivide_2s64_do_ceil_vector(libdivide_2s64_t numers, const struct libdivide_s64_t *denom) {
+    libdivide_2s64_t r;
+    libdivide_2s64_t q = libdivide_2s64_divmod_vector(numers, denom, &r);
+    uint64_t notSign = ~(uint64_t)(denom->divisor >> 63);
+    //add unsigned, so that the wrapping is defined
+    return (libdivide_2s64_t)((libdivide_2u64_t)q + ((((libdivide_2u64_t)r ^ notSign) - notSign) >> 63));
+}
+
+libdivide_2s64_t libdivide_2s64_do_round_vector(libdivide_2s64_t numers, const struct libdivide_s64_t *denom) {
+    libdivide_2s64_t r;
+    libdivide_2s64_t q = libdivide_2s64_divmod_vector(numers, denom, &r);
+    int64_t dSign = denom->divisor >> 63;
+    uint64_t half = ((((uint64_t)denom->divisor ^ dSign) - dSign) - 1) >> 1;
+    libdivide_2u64_t rSign = (libdivide_2u64_t)(r >> 63);
+    libdivide_2u64_t qSign = rSign ^ (uint64_t)dSign;
+    libdivide_2u64_t up = (half - (((libdivide_2u64_t)r ^ rSign) - rSign)) >> 63; //|r| > half
+    return (libdivide_2s64_t)((libdivide_2u64_t)q + ((up ^ qSign) - qSign));
+}
+
+libdivide_4u64_t libdivide_4u64_do_ceil_vector(libdivide_4u64_t numers, const struct libdivide_u64_t *denom) {
+    libdivide_4u64_t nz = (numers | (0ULL - numers)) >> 63; //numer != 0
+    return libdivide_4u64_do_vector(numers - nz, denom) + nz;
+}
+
+libdivide_4u64_t libdivide_4u64_do_round_vector(libdivide_4u64_t numers, const struct libdivide_u64_t *denom) {
+    libdivide_4u64_t r;
+    libdivide_4u64_t q = libdivide_4u64_divmod_vector(numers, denom, &r);
+    return q + (((uint64_t)((denom->divisor - 1) / 2) - r) >> 63); //q += r > half
+}
+
+libdivide_4s64_t libdivide_4s64_do_ceil_vector(libdivide_4s64_t numers, const struct libdivide_s64_t *denom) {
+    libdivide_4s64_t r;
+    libdivide_4s64_t q = libdivide_4s64_divmod_vector(numers, denom, &r);
+    uint64_t notSign = ~(uint64_t)(denom->divisor >> 63);
+    //add unsigned, so that the wrapping is defined
+    return (libdivide_4s64_t)((libdivide_4u64_t)q + ((((libdivide_4u64_t)r ^ notSign) - notSign) >> 63));
+}
+
+libdivide_4s64_t libdivide_4s64_do_round_vector(libdivide_4s64_t numers, const struct libdivide_s64_t *denom) {
+    libdivide_4s64_t r;
+    libdivide_4s64_t q = libdivide_4s64_divmod_vector(numers, denom, &r);
+    int64_t dSign = denom->divisor >> 63;
+    uint64_t half = ((((uint64_t)denom->divisor ^ dSign) - dSign) - 1) >> 1;
+    libdivide_4u64_t rSign = (libdivide_4u64_t)(r >> 63);
+    libdivide_4u64_t qSign = rSign ^ (uint64_t)dSign;
+    libdivide_4u64_t up = (half - (((libdivide_4u64_t)r ^ rSign) - rSign)) >> 63; //|r| > half
+    return (libdivide_4s64_t)((libdivide_4u64_t)q + ((up ^ qSign) - qSign));
+}
+#endif
+
+/////////// BRANCHFREE DIVISION
+
+/* The unsigned magic numbers are those of the 33 or 65 bit algorithm, even where the ordinary gen would have found a smaller one, so that the add is always done.  For a power of 2 the magic is 0 and the add halves the numerator, which is why the shift is one less there, and why d == 1 is out.  The signed ones are those of the ordinary gen with the magic left positive, which makes the added numerator unconditional.  Negative quotients get rounded toward zero by adding 2**shift - 1 before shifting, plus one more when the magic isn't 0 to stand in for the q += (q < 0) of libdivide_s32_do, and the sign of d is applied last. */
+struct libdivide_u32_branchfree_t libdivide_u32_branchfree_gen(uint32_t d) {
+    struct libdivide_u32_branchfree_t result;
+    const uint32_t floor_log_2_d = 31 - libdivide__count_leading_zeros32(d);
+    LIBDIVIDE_ASSERT(d > 1);
+    if ((d & (d - 1)) == 0) {
+        result.magic = 0;
+        result.more = (uint8_t)(floor_log_2_d - 1);
+    }
+    else {
+        uint32_t rem, proposed_m;
+        proposed_m = libdivide_64_div_32_to_32(1U << floor_log_2_d, 0, d, &rem);
+        proposed_m += proposed_m;
+        const uint32_t twice_rem = rem + rem;
+        if (twice_rem >= d || twice_rem < rem) proposed_m += 1;
+        result.magic = 1 + proposed_m;
+        result.more = (uint8_t)floor_log_2_d;
+    }
+    return result;
+}
+
+uint32_t libdivide_u32_branchfree_do(uint32_t numer, const struct libdivide_u32_branchfree_t *denom) {
+    uint32_t q = libdivide__mullhi_u32(denom->magic, numer);
+    uint32_t t = ((numer - q) >> 1) + q;
+    return t >> denom->more;
+}
+
+struct libdivide_s32_branchfree_t libdivide_s32_branchfree_gen(int32_t d) {
+    struct libdivide_s32_branchfree_t result;
+    uint32_t absD = (uint32_t)(d < 0 ? -d : d);
+    const uint32_t floor_log_2_d = 31 - libdivide__count_leading_zeros32(absD);
+    if ((absD & (absD - 1)) == 0) {
+        result.magic = 0;
+    }
+    else {
+        uint32_t rem, proposed_m;
+        proposed_m = libdivide_64_div_32_to_32(1U << (floor_log_2_d - 1), 0, absD, &rem);
+        proposed_m += proposed_m;
+        const uint32_t twice_rem = rem + rem;
+        if (twice_rem >= absD || twice_rem < rem) proposed_m += 1;
+        result.magic = (int32_t)(proposed_m + 1);
+    }
+    result.more = (uint8_t)(floor_log_2_d | (d < 0 ? LIBDIVIDE_NEGATIVE_DIVISOR : 0));
+    return result;
+}
+
+int32_t libdivide_s32_branchfree_do(int32_t numer, const struct libdivide_s32_branchfree_t *denom) {
+    uint8_t shift = denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    int32_t sign = (int8_t)denom->more >> 7; //must be arithmetic shift and then sign extend
+    int32_t q = libdivide__mullhi_s32(denom->magic, numer) + numer;
+    q += (int32_t)((uint32_t)(q >> 31) & ((1U << shift) - (denom->magic == 0)));
+    q >>= shift;
+    return (q ^ sign) - sign;
+}
+
+struct libdivide_u64_branchfree_t libdivide_u64_branchfree_gen(uint64_t d) {
+    struct libdivide_u64_branchfree_t result;
+    const uint32_t floor_log_2_d = 63 - libdivide__count_leading_zeros64(d);
+    LIBDIVIDE_ASSERT(d > 1);
+    if ((d & (d - 1)) == 0) {
+        result.magic = 0;
+        result.more = (uint8_t)(floor_log_2_d - 1);
+    }
+    else {
+        uint64_t rem, proposed_m;
+        proposed_m = libdivide_pow2_div_64_to_64(floor_log_2_d, d, &rem);
+        proposed_m += proposed_m;
+        const uint64_t twice_rem = rem + rem;
+        if (twice_rem >= d || twice_rem < rem) proposed_m += 1;
+        result.magic = 1 + proposed_m;
+        result.more = (uint8_t)floor_log_2_d;
+    }
+    return result;
+}
+
+uint64_t libdivide_u64_branchfree_do(uint64_t numer, const struct libdivide_u64_branchfree_t *denom) {
+    uint64_t q = libdivide__mullhi_u64(denom->magic, numer);
+    uint64_t t = ((numer - q) >> 1) + q;
+    return t >> denom->more;
+}
+
+struct libdivide_s64_branchfree_t libdivide_s64_branchfree_gen(int64_t d) {
+    struct libdivide_s64_branchfree_t result;
+    uint64_t absD = (uint64_t)(d < 0 ? -d : d);
+    const uint32_t floor_log_2_d = 63 - libdivide__count_leading_zeros64(absD);
+    if ((absD & (absD - 1)) == 0) {
+        result.magic = 0;
+    }
+    else {
+        uint64_t rem, proposed_m;
+        proposed_m = libdivide_pow2_div_64_to_64(floor_log_2_d - 1, absD, &rem);
+        proposed_m += proposed_m;
+        const uint64_t twice_rem = rem + rem;
+        if (twice_rem >= absD || twice_rem < rem) proposed_m += 1;
+        result.magic = (int64_t)(proposed_m + 1);
+    }
+    result.more = (uint8_t)(floor_log_2_d | (d < 0 ? LIBDIVIDE_NEGATIVE_DIVISOR : 0));
+    return result;
+}
+
+int64_t libdivide_s64_branchfree_do(int64_t numer, const struct libdivide_s64_branchfree_t *denom) {
+    uint8_t shift = denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    int64_t sign = (int8_t)denom->more >> 7; //must be arithmetic shift and then sign extend
+    int64_t q = libdivide__mullhi_s64(denom->magic, numer) + numer;
+    q += (int64_t)((uint64_t)(q >> 63) & ((1ULL << shift) - (denom->magic == 0)));
+    q >>= shift;
+    return (q ^ sign) - sign;
+}
+
+/* The vector forms follow the scalar ones lane for lane.  The per divisor constants are broadcast up front, so there is nothing left to branch on. */
+#if LIBDIVIDE_USE_SSE2
+__m128i libdivide_4u32_branchfree_do_vector(__m128i numers, const struct libdivide_u32_branchfree_t *denom) {
+    __m128i q = libdivide__mullhi_u32_flat_vector(numers, _mm_set1_epi32((int32_t)denom->magic));
+    __m128i t = _mm_add_epi32(_mm_srli_epi32(_mm_sub_epi32(numers, q), 1), q);
+    return _mm_srl_epi32(t, libdivide_u32_to_m128i(denom->more));
+}
+
+__m128i libdivide_4s32_branchfree_do_vector(__m128i numers, const struct libdivide_s32_branchfree_t *denom) {
+    uint8_t shift = denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    __m128i roundToZeroTweak = _mm_set1_epi32((int32_t)((1U << shift) - (denom->magic == 0)));
+    __m128i sign = _mm_set1_epi32((int8_t)denom->more >> 7);
+    __m128i q = _mm_add_epi32(libdivide_mullhi_s32_flat_vector(numers, _mm_set1_epi32(denom->magic)), numers);
+    q = _mm_add_epi32(q, _mm_and_si128(_mm_srai_epi32(q, 31), roundToZeroTweak));
+    q = _mm_sra_epi32(q, libdivide_u32_to_m128i(shift));
+    return _mm_sub_epi32(_mm_xor_si128(q, sign), sign);
+}
+
+__m128i libdivide_2u64_branchfree_do_vector(__m128i numers, const struct libdivide_u64_branchfree_t *denom) {
+    __m128i q = libdivide_mullhi_u64_flat_vector(numers, libdivide__u64_to_m128(denom->magic));
+    __m128i t = _mm_add_epi64(_mm_srli_epi64(_mm_sub_epi64(numers, q), 1), q);
+    return _mm_srl_epi64(t, libdivide_u32_to_m128i(denom->more));
+}
+
+__m128i libdivide_2s64_branchfree_do_vector(__m128i numers, const struct libdivide_s64_branchfree_t *denom) {
+    uint8_t shift = denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    __m128i roundToZeroTweak = libdivide__u64_to_m128((1ULL << shift) - (denom->magic == 0));
+    __m128i sign = libdivide__u64_to_m128((uint64_t)(int64_t)((int8_t)denom->more >> 7));
+    __m128i q = _mm_add_epi64(libdivide_mullhi_s64_flat_vector(numers, libdivide__u64_to_m128((uint64_t)denom->magic)), numers);
+    q = _mm_add_epi64(q, _mm_and_si128(libdivide_s64_signbits(q), roundToZeroTweak));
+    q = libdivide_s64_shift_right_vector(q, shift);
+    return _mm_sub_epi64(_mm_xor_si128(q, sign), sign);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_branchfree_do_vector(__m256i numers, const struct libdivide_u32_branchfree_t *denom) {
+    __m256i q = libdivide_mullhi_8u32_flat_vector(numers, _mm256_set1_epi32((int32_t)denom->magic));
+    __m256i t = _mm256_add_epi32(_mm256_srli_epi32(_mm256_sub_epi32(numers, q), 1), q);
+    return _mm256_srl_epi32(t, libdivide_u32_to_m128i(denom->more));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_branchfree_do_vector(__m256i numers, const struct libdivide_s32_branchfree_t *denom) {
+    uint8_t shift = denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    __m256i roundToZeroTweak = _mm256_set1_epi32((int32_t)((1U << shift) - (denom->magic == 0)));
+    __m256i sign = _mm256_set1_epi32((int8_t)denom->more >> 7);
+    __m256i q = _mm256_add_epi32(libdivide_mullhi_8s32_flat_vector(numers, _mm256_set1_epi32(denom->magic)), numers);
+    q = _mm256_add_epi32(q, _mm256_and_si256(_mm256_srai_epi32(q, 31), roundToZeroTweak));
+    q = _mm256_sra_epi32(q, libdivide_u32_to_m128i(shift));
+    return _mm256_sub_epi32(_mm256_xor_si256(q, sign), sign);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_branchfree_do_vector(__m256i numers, const struct libdivide_u64_branchfree_t *denom) {
+    __m256i q = libdivide_mullhi_4u64_flat_vector(numers, libdivide__u64_to_m256i(denom->magic));
+    __m256i t = _mm256_add_epi64(_mm256_srli_epi64(_mm256_sub_epi64(numers, q), 1), q);
+    return _mm256_srl_epi64(t, libdivide_u32_to_m128i(denom->more));
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_branchfree_do_vector(__m256i numers, const struct libdivide_s64_branchfree_t *denom) {
+    uint8_t shift = denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    __m256i roundToZeroTweak = libdivide__u64_to_m256i((1ULL << shift) - (denom->magic == 0));
+    __m256i sign = libdivide__u64_to_m256i((uint64_t)(int64_t)((int8_t)denom->more >> 7));
+    __m256i q = _mm256_add_epi64(libdivide_mullhi_4s64_flat_vector(numers, libdivide__u64_to_m256i((uint64_t)denom->magic)), numers);
+    q = _mm256_add_epi64(q, _mm256_and_si256(libdivide_4s64_signbits(q), roundToZeroTweak));
+    q = libdivide_4s64_shift_right_vector(q, shift);
+    return _mm256_sub_epi64(_mm256_xor_si256(q, sign), sign);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_branchfree_do_vector(__m512i numers, const struct libdivide_u32_branchfree_t *denom) {
+    __m512i q = libdivide_mullhi_16u32_flat_vector(numers, _mm512_set1_epi32((int32_t)denom->magic));
+    __m512i t = _mm512_add_epi32(_mm512_srli_epi32(_mm512_sub_epi32(numers, q), 1), q);
+    return _mm512_srl_epi32(t, libdivide_u32_to_m128i(denom->more));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_branchfree_do_vector(__m512i numers, const struct libdivide_s32_branchfree_t *denom) {
+    uint8_t shift = denom->more & LIBDIVIDE_32_SHIFT_MASK;
+    __m512i roundToZeroTweak = _mm512_set1_epi32((int32_t)((1U << shift) - (denom->magic == 0)));
+    __m512i sign = _mm512_set1_epi32((int8_t)denom->more >> 7);
+    __m512i q = _mm512_add_epi32(libdivide_mullhi_16s32_flat_vector(numers, _mm512_set1_epi32(denom->magic)), numers);
+    q = _mm512_add_epi32(q, _mm512_and_si512(_mm512_srai_epi32(q, 31), roundToZeroTweak));
+    q = _mm512_sra_epi32(q, libdivide_u32_to_m128i(shift));
+    return _mm512_sub_epi32(_mm512_xor_si512(q, sign), sign);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_branchfree_do_vector(__m512i numers, const struct libdivide_u64_branchfree_t *denom) {
+    __m512i q = libdivide_mullhi_8u64_flat_vector(numers, libdivide__u64_to_m512i(denom->magic));
+    __m512i t = _mm512_add_epi64(_mm512_srli_epi64(_mm512_sub_epi64(numers, q), 1), q);
+    return _mm512_srl_epi64(t, libdivide_u32_to_m128i(denom->more));
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_branchfree_do_vector(__m512i numers, const struct libdivide_s64_branchfree_t *denom) {
+    uint8_t shift = denom->more & LIBDIVIDE_64_SHIFT_MASK;
+    __m512i roundToZeroTweak = libdivide__u64_to_m512i((1ULL << shift) - (denom->magic == 0));
+    __m512i sign = libdivide__u64_to_m512i((uint64_t)(int64_t)((int8_t)denom->more >> 7));
+    __m512i q = _mm512_add_epi64(libdivide_mullhi_8s64_flat_vector(numers, libdivide__u64_to_m512i((uint64_t)denom->magic)), numers);
+    q = _mm512_add_epi64(q, _mm512_and_si512(libdivide_8s64_signbits(q), roundToZeroTweak));
+    q = libdivide_8s64_shift_right_vector(q, shift);
+    return _mm512_sub_epi64(_mm512_xor_si512(q, sign), sign);
+}
+#endif
+
+/////////// PER LANE DIVISION
+
+/* A different divisor in every lane means no broadcast magic number, so the 32 bit high multiplies have to take both operands' odd lanes, and the shifts vary by lane: vpsrlvd and friends with AVX2 and AVX-512, and one shift per lane with SSE2.  The branchfree sequence is the same for every divisor, which is what makes this possible.  For the signed tweak, (1 << shift) is the top bit shifted down when there is no variable left shift. */
+#if LIBDIVIDE_USE_SSE2
+static inline __m128i libdivide_mullhi_u32_lanes_vector(__m128i a, __m128i b) {
+    __m128i hi_product_0Z2Z = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+    __m128i hi_product_Z1Z3 = _mm_and_si128(_mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), libdivide_get_FFFFFFFF00000000());
+    return _mm_or_si128(hi_product_0Z2Z, hi_product_Z1Z3);
+}
+
+static inline __m128i libdivide_mullhi_s32_lanes_vector(__m128i a, __m128i b) {
+#ifdef LIBDIVIDE_USE_SSE4_1
+    __m128i hi_product_0Z2Z = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+    __m128i hi_product_Z1Z3 = _mm_and_si128(_mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), libdivide_get_FFFFFFFF00000000());
+    return _mm_or_si128(hi_product_0Z2Z, hi_product_Z1Z3);
+#else
+    __m128i p = libdivide_mullhi_u32_lanes_vector(a, b);
+    p = _mm_sub_epi32(p, _mm_and_si128(_mm_srai_epi32(a, 31), b));
+    return _mm_sub_epi32(p, _mm_and_si128(_mm_srai_epi32(b, 31), a));
+#endif
+}
+
+#if !LIBDIVIDE_USE_AVX2
+/* Lane i of ri, for the four results of shifting by each lane's count in turn */
+static inline __m128i libdivide_pick_lanes_0123(__m128i r0, __m128i r1, __m128i r2, __m128i r3) {
+    __m128 r01 = _mm_castsi128_ps(_mm_unpacklo_epi64(r0, r1)), r23 = _mm_castsi128_ps(_mm_unpackhi_epi64(r2, r3));
+    return _mm_castps_si128(_mm_shuffle_ps(r01, r23, _MM_SHUFFLE(3, 0, 3, 0)));
+}
+#endif
+
+static inline __m128i libdivide_u32_shift_right_lanes(__m128i v, __m128i counts) {
+#if LIBDIVIDE_USE_AVX2
+    return _mm_srlv_epi32(v, counts);
+#else
+    //_mm_srl_epi32 takes its count from the low 64 bits, so zero extend each lane's count into a 64 bit slot of its own
+    const __m128i c01 = _mm_unpacklo_epi32(counts, _mm_setzero_si128()), c23 = _mm_unpackhi_epi32(counts, _mm_setzero_si128());
+    return libdivide_pick_lanes_0123(_mm_srl_epi32(v, c01), _mm_srl_epi32(v, _mm_srli_si128(c01, 8)), _mm_srl_epi32(v, c23), _mm_srl_epi32(v, _mm_srli_si128(c23, 8)));
+#endif
+}
+
+static inline __m128i libdivide_s32_shift_right_lanes(__m128i v, __m128i counts) {
+#if LIBDIVIDE_USE_AVX2
+    return _mm_srav_epi32(v, counts);
+#else
+    const __m128i c01 = _mm_unpacklo_epi32(counts, _mm_setzero_si128()), c23 = _mm_unpackhi_epi32(counts, _mm_setzero_si128());
+    return libdivide_pick_lanes_0123(_mm_sra_epi32(v, c01), _mm_sra_epi32(v, _mm_srli_si128(c01, 8)), _mm_sra_epi32(v, c23), _mm_sra_epi32(v, _mm_srli_si128(c23, 8)));
+#endif
+}
+
+static inline __m128i libdivide_u64_shift_right_lanes(__m128i v, __m128i counts) {
+#if LIBDIVIDE_USE_AVX2
+    return _mm_srlv_epi64(v, counts);
+#else
+    __m128i r0 = _mm_srl_epi64(v, counts), r1 = _mm_srl_epi64(v, _mm_srli_si128(counts, 8));
+    return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(r1), _mm_castsi128_pd(r0)));
+#endif
+}
+
+static inline __m128i libdivide_s64_shift_right_lanes(__m128i v, __m128i counts) {
+#if LIBDIVIDE_USE_AVX512
+    return _mm_srav_epi64(v, counts);
+#else
+    //as in libdivide_4s64_shift_right_vector, flip negative lanes to nonnegative around a logical shift
+    __m128i s = libdivide_s64_signbits(v);
+    return _mm_xor_si128(libdivide_u64_shift_right_lanes(_mm_xor_si128(v, s), counts), s);
+#endif
+}
+
+/* All ones in the 64 bit lanes of v that are zero */
+static inline __m128i libdivide_u64_zero_lanes(__m128i v) {
+#ifdef LIBDIVIDE_USE_SSE4_1
+    return _mm_cmpeq_epi64(v, _mm_setzero_si128());
+#else
+    __m128i halves = _mm_cmpeq_epi32(v, _mm_setzero_si128());
+    return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+}
+
+__m128i libdivide_4u32_branchfree_do_lanes(__m128i numers, __m128i magics, __m128i mores) {
+    __m128i q = libdivide_mullhi_u32_lanes_vector(numers, magics);
+    __m128i t = _mm_add_epi32(_mm_srli_epi32(_mm_sub_epi32(numers, q), 1), q);
+    return libdivide_u32_shift_right_lanes(t, mores);
+}
+
+__m128i libdivide_4s32_branchfree_do_lanes(__m128i numers, __m128i magics, __m128i mores) {
+    __m128i shifts = _mm_and_si128(mores, _mm_set1_epi32(LIBDIVIDE_32_SHIFT_MASK));
+    __m128i sign = _mm_srai_epi32(_mm_slli_epi32(mores, 24), 31);
+    __m128i powerOf2 = libdivide_u32_shift_right_lanes(_mm_slli_epi32(_mm_set1_epi32(1), 31), _mm_sub_epi32(_mm_set1_epi32(31), shifts));
+    __m128i roundToZeroTweak = _mm_add_epi32(powerOf2, _mm_cmpeq_epi32(magics, _mm_setzero_si128()));
+    __m128i q = _mm_add_epi32(libdivide_mullhi_s32_lanes_vector(numers, magics), numers);
+    q = _mm_add_epi32(q, _mm_and_si128(_mm_srai_epi32(q, 31), roundToZeroTweak));
+    q = libdivide_s32_shift_right_lanes(q, shifts);
+    return _mm_sub_epi32(_mm_xor_si128(q, sign), sign);
+}
+
+__m128i libdivide_2u64_branchfree_do_lanes(__m128i numers, __m128i magics, __m128i mores) {
+    __m128i q = libdivide_mullhi_u64_flat_vector(numers, magics);
+    __m128i t = _mm_add_epi64(_mm_srli_epi64(_mm_sub_epi64(numers, q), 1), q);
+    return libdivide_u64_shift_right_lanes(t, mores);
+}
+
+__m128i libdivide_2s64_branchfree_do_lanes(__m128i numers, __m128i magics, __m128i mores) {
+    __m128i shifts = _mm_and_si128(mores, libdivide__u64_to_m128(LIBDIVIDE_64_SHIFT_MASK));
+    __m128i sign = libdivide_s64_signbits(_mm_slli_epi64(mores, 56));
+    __m128i powerOf2 = libdivide_u64_shift_right_lanes(_mm_slli_epi64(libdivide__u64_to_m128(1), 63), _mm_sub_epi64(libdivide__u64_to_m128(63), shifts));
+    __m128i roundToZeroTweak = _mm_add_epi64(powerOf2, libdivide_u64_zero_lanes(magics));
+    __m128i q = _mm_add_epi64(libdivide_mullhi_s64_flat_vector(numers, magics), numers);
+    q = _mm_add_epi64(q, _mm_and_si128(libdivide_s64_signbits(q), roundToZeroTweak));
+    q = libdivide_s64_shift_right_lanes(q, shifts);
+    return _mm_sub_epi64(_mm_xor_si128(q, sign), sign);
+}
+
+/* The gathers read the more byte as part of the 32 or 64 bits that start at it, which stay inside the struct thanks to its padding, and mask off the rest.  SSE2 has no gather, so it loads the table entries one by one. */
+#if LIBDIVIDE_USE_AVX2
+#define LIBDIVIDE_GATHER_4X32(table, field, indices) _mm_i32gather_epi32((const int *)&(table)->field, (indices), sizeof *(table))
+#define LIBDIVIDE_GATHER_2X64(table, field, indices) _mm_i64gather_epi64((const long long *)&(table)->field, _mm_slli_epi64(_mm_cvtepu32_epi64(indices), 1), 8)
+#else
+#define LIBDIVIDE_GATHER_4X32(table, field, indices) _mm_set_epi32((int32_t)(table)[_mm_cvtsi128_si32(_mm_srli_si128((indices), 12))].field, (int32_t)(table)[_mm_cvtsi128_si32(_mm_srli_si128((indices), 8))].field, \
+    (int32_t)(table)[_mm_cvtsi128_si32(_mm_srli_si128((indices), 4))].field, (int32_t)(table)[_mm_cvtsi128_si32(indices)].field)
+#define LIBDIVIDE_GATHER_2X64(table, field, indices) _mm_unpacklo_epi64(libdivide__u64_to_m128((uint64_t)(table)[(uint32_t)_mm_cvtsi128_si32(indices)].field), libdivide__u64_to_m128((uint64_t)(table)[(uint32_t)_mm_cvtsi128_si32(_mm_srli_si128((indices), 4))].field))
+#endif
+
+__m128i libdivide_4u32_branchfree_do_gather(__m128i numers, __m128i indices, const struct libdivide_u32_branchfree_t *table) {
+    __m128i magics = LIBDIVIDE_GATHER_4X32(table, magic, indices);
+    __m128i mores = _mm_and_si128(LIBDIVIDE_GATHER_4X32(table, more, indices), _mm_set1_epi32(0xFF));
+    return libdivide_4u32_branchfree_do_lanes(numers, magics, mores);
+}
+
+__m128i libdivide_4s32_branchfree_do_gather(__m128i numers, __m128i indices, const struct libdivide_s32_branchfree_t *table) {
+    __m128i magics = LIBDIVIDE_GATHER_4X32(table, magic, indices);
+    __m128i mores = _mm_and_si128(LIBDIVIDE_GATHER_4X32(table, more, indices), _mm_set1_epi32(0xFF));
+    return libdivide_4s32_branchfree_do_lanes(numers, magics, mores);
+}
+
+__m128i libdivide_2u64_branchfree_do_gather(__m128i numers, __m128i indices, const struct libdivide_u64_branchfree_t *table) {
+    __m128i magics = LIBDIVIDE_GATHER_2X64(table, magic, indices);
+    __m128i mores = _mm_and_si128(LIBDIVIDE_GATHER_2X64(table, more, indices), libdivide__u64_to_m128(0xFF));
+    return libdivide_2u64_branchfree_do_lanes(numers, magics, mores);
+}
+
+__m128i libdivide_2s64_branchfree_do_gather(__m128i numers, __m128i indices, const struct libdivide_s64_branchfree_t *table) {
+    __m128i magics = LIBDIVIDE_GATHER_2X64(table, magic, indices);
+    __m128i mores = _mm_and_si128(LIBDIVIDE_GATHER_2X64(table, more, indices), libdivide__u64_to_m128(0xFF));
+    return libdivide_2s64_branchfree_do_lanes(numers, magics, mores);
+}
+
+/* The divider arrays gather from the magics and the mores separately, each with its own element size as the scale.  The more bytes come with the 3 or 7 bytes after them, hence LIBDIVIDE_ARRAY_PADDING.  With 32 bit indices the 64 bit gathers need no doubling here. */
+#if LIBDIVIDE_USE_AVX2
+#define LIBDIVIDE_ARRAY_GATHER_4X32(values, indices) _mm_i32gather_epi32((const int *)(values), (indices), sizeof *(values))
+#define LIBDIVIDE_ARRAY_GATHER_2X64(values, indices) _mm_i32gather_epi64((const long long *)(values), (indices), sizeof *(values))
+#else
+#define LIBDIVIDE_ARRAY_GATHER_4X32(values, indices) _mm_set_epi32((int32_t)(values)[_mm_cvtsi128_si32(_mm_srli_si128((indices), 12))], (int32_t)(values)[_mm_cvtsi128_si32(_mm_srli_si128((indices), 8))], \
+    (int32_t)(values)[_mm_cvtsi128_si32(_mm_srli_si128((indices), 4))], (int32_t)(values)[_mm_cvtsi128_si32(indices)])
+#define LIBDIVIDE_ARRAY_GATHER_2X64(values, indices) _mm_unpacklo_epi64(libdivide__u64_to_m128((uint64_t)(values)[(uint32_t)_mm_cvtsi128_si32(indices)]), libdivide__u64_to_m128((uint64_t)(values)[(uint32_t)_mm_cvtsi128_si32(_mm_srli_si128((indices), 4))]))
+#endif
+
+__m128i libdivide_4u32_array_do_gather(__m128i numers, __m128i indices, const struct libdivide_u32_array_t *array) {
+    __m128i magics = LIBDIVIDE_ARRAY_GATHER_4X32(array->magics, indices);
+    __m128i mores = _mm_and_si128(LIBDIVIDE_ARRAY_GATHER_4X32(array->mores, indices), _mm_set1_epi32(0xFF));
+    __m128i ones = _mm_cmpeq_epi32(mores, _mm_set1_epi32(LIBDIVIDE_ARRAY_ONE));
+    __m128i q = libdivide_4u32_branchfree_do_lanes(numers, magics, _mm_and_si128(mores, _mm_set1_epi32(LIBDIVIDE_32_SHIFT_MASK)));
+    return _mm_or_si128(_mm_andnot_si128(ones, q), _mm_and_si128(ones, numers));
+}
+
+__m128i libdivide_4s32_array_do_gather(__m128i numers, __m128i indices, const struct libdivide_s32_array_t *array) {
+    __m128i magics = LIBDIVIDE_ARRAY_GATHER_4X32(array->magics, indices);
+    __m128i mores = _mm_and_si128(LIBDIVIDE_ARRAY_GATHER_4X32(array->mores, indices), _mm_set1_epi32(0xFF));
+    return libdivide_4s32_branchfree_do_lanes(numers, magics, mores);
+}
+
+__m128i libdivide_2u64_array_do_gather(__m128i numers, __m128i indices, const struct libdivide_u64_array_t *array) {
+    __m128i magics = LIBDIVIDE_ARRAY_GATHER_2X64(array->magics, indices);
+    __m128i mores = _mm_and_si128(LIBDIVIDE_ARRAY_GATHER_2X64(array->mores, indices), libdivide__u64_to_m128(0xFF));
+    __m128i ones = libdivide_u64_zero_lanes(_mm_xor_si128(mores, libdivide__u64_to_m128(LIBDIVIDE_ARRAY_ONE)));
+    __m128i q = libdivide_2u64_branchfree_do_lanes(numers, magics, _mm_and_si128(mores, libdivide__u64_to_m128(LIBDIVIDE_64_SHIFT_MASK)));
+    return _mm_or_si128(_mm_andnot_si128(ones, q), _mm_and_si128(ones, numers));
+}
+
+__m128i libdivide_2s64_array_do_gather(__m128i numers, __m128i indices, const struct libdivide_s64_array_t *array) {
+    __m128i magics = LIBDIVIDE_ARRAY_GATHER_2X64(array->magics, indices);
+    __m128i mores = _mm_and_si128(LIBDIVIDE_ARRAY_GATHER_2X64(array->mores, indices), libdivide__u64_to_m128(0xFF));
+    return libdivide_2s64_branchfree_do_lanes(numers, magics, mores);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_mullhi_8u32_lanes_vector(__m256i a, __m256i b) {
+    __m256i hi_product_0Z2Z = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+    __m256i hi_product_Z1Z3 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(hi_product_0Z2Z, hi_product_Z1Z3, 0xAA);
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_mullhi_8s32_lanes_vector(__m256i a, __m256i b) {
+    __m256i hi_product_0Z2Z = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+    __m256i hi_product_Z1Z3 = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(hi_product_0Z2Z, hi_product_Z1Z3, 0xAA);
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_shift_right_lanes(__m256i v, __m256i counts) {
+#if LIBDIVIDE_USE_AVX512
+    return _mm256_srav_epi64(v, counts);
+#else
+    __m256i s = libdivide_4s64_signbits(v);
+    return _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(v, s), counts), s);
+#endif
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_branchfree_do_lanes(__m256i numers, __m256i magics, __m256i mores) {
+    __m256i q = libdivide_mullhi_8u32_lanes_vector(numers, magics);
+    __m256i t = _mm256_add_epi32(_mm256_srli_epi32(_mm256_sub_epi32(numers, q), 1), q);
+    return _mm256_srlv_epi32(t, mores);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_branchfree_do_lanes(__m256i numers, __m256i magics, __m256i mores) {
+    __m256i shifts = _mm256_and_si256(mores, _mm256_set1_epi32(LIBDIVIDE_32_SHIFT_MASK));
+    __m256i sign = _mm256_srai_epi32(_mm256_slli_epi32(mores, 24), 31);
+    __m256i roundToZeroTweak = _mm256_add_epi32(_mm256_sllv_epi32(_mm256_set1_epi32(1), shifts), _mm256_cmpeq_epi32(magics, _mm256_setzero_si256()));
+    __m256i q = _mm256_add_epi32(libdivide_mullhi_8s32_lanes_vector(numers, magics), numers);
+    q = _mm256_add_epi32(q, _mm256_and_si256(_mm256_srai_epi32(q, 31), roundToZeroTweak));
+    q = _mm256_srav_epi32(q, shifts);
+    return _mm256_sub_epi32(_mm256_xor_si256(q, sign), sign);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_branchfree_do_lanes(__m256i numers, __m256i magics, __m256i mores) {
+    __m256i q = libdivide_mullhi_4u64_flat_vector(numers, magics);
+    __m256i t = _mm256_add_epi64(_mm256_srli_epi64(_mm256_sub_epi64(numers, q), 1), q);
+    return _mm256_srlv_epi64(t, mores);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_branchfree_do_lanes(__m256i numers, __m256i magics, __m256i mores) {
+    __m256i shifts = _mm256_and_si256(mores, libdivide__u64_to_m256i(LIBDIVIDE_64_SHIFT_MASK));
+    __m256i sign = libdivide_4s64_signbits(_mm256_slli_epi64(mores, 56));
+    __m256i roundToZeroTweak = _mm256_add_epi64(_mm256_sllv_epi64(libdivide__u64_to_m256i(1), shifts), _mm256_cmpeq_epi64(magics, _mm256_setzero_si256()));
+    __m256i q = _mm256_add_epi64(libdivide_mullhi_4s64_flat_vector(numers, magics), numers);
+    q = _mm256_add_epi64(q, _mm256_and_si256(libdivide_4s64_signbits(q), roundToZeroTweak));
+    q = libdivide_4s64_shift_right_lanes(q, shifts);
+    return _mm256_sub_epi64(_mm256_xor_si256(q, sign), sign);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_branchfree_do_gather(__m256i numers, __m256i indices, const struct libdivide_u32_branchfree_t *table) {
+    __m256i magics = _mm256_i32gather_epi32((const int *)&table->magic, indices, sizeof *table);
+    __m256i mores = _mm256_and_si256(_mm256_i32gather_epi32((const int *)&table->more, indices, sizeof *table), _mm256_set1_epi32(0xFF));
+    return libdivide_8u32_branchfree_do_lanes(numers, magics, mores);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_branchfree_do_gather(__m256i numers, __m256i indices, const struct libdivide_s32_branchfree_t *table) {
+    __m256i magics = _mm256_i32gather_epi32((const int *)&table->magic, indices, sizeof *table);
+    __m256i mores = _mm256_and_si256(_mm256_i32gather_epi32((const int *)&table->more, indices, sizeof *table), _mm256_set1_epi32(0xFF));
+    return libdivide_8s32_branchfree_do_lanes(numers, magics, mores);
+}
+
+/* The 64 bit tables have 16 byte entries, more than the largest gather scale, so the indices are doubled */
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_branchfree_do_gather(__m256i numers, __m128i indices, const struct libdivide_u64_branchfree_t *table) {
+    __m256i offsets = _mm256_slli_epi64(_mm256_cvtepu32_epi64(indices), 1);
+    __m256i magics = _mm256_i64gather_epi64((const long long *)&table->magic, offsets, 8);
+    __m256i mores = _mm256_and_si256(_mm256_i64gather_epi64((const long long *)&table->more, offsets, 8), libdivide__u64_to_m256i(0xFF));
+    return libdivide_4u64_branchfree_do_lanes(numers, magics, mores);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_branchfree_do_gather(__m256i numers, __m128i indices, const struct libdivide_s64_branchfree_t *table) {
+    __m256i offsets = _mm256_slli_epi64(_mm256_cvtepu32_epi64(indices), 1);
+    __m256i magics = _mm256_i64gather_epi64((const long long *)&table->magic, offsets, 8);
+    __m256i mores = _mm256_and_si256(_mm256_i64gather_epi64((const long long *)&table->more, offsets, 8), libdivide__u64_to_m256i(0xFF));
+    return libdivide_4s64_branchfree_do_lanes(numers, magics, mores);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8u32_array_do_gather(__m256i numers, __m256i indices, const struct libdivide_u32_array_t *array) {
+    __m256i magics = _mm256_i32gather_epi32((const int *)array->magics, indices, 4);
+    __m256i mores = _mm256_and_si256(_mm256_i32gather_epi32((const int *)array->mores, indices, 1), _mm256_set1_epi32(0xFF));
+    __m256i ones = _mm256_cmpeq_epi32(mores, _mm256_set1_epi32(LIBDIVIDE_ARRAY_ONE));
+    __m256i q = libdivide_8u32_branchfree_do_lanes(numers, magics, _mm256_and_si256(mores, _mm256_set1_epi32(LIBDIVIDE_32_SHIFT_MASK)));
+    return _mm256_blendv_epi8(q, numers, ones);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_8s32_array_do_gather(__m256i numers, __m256i indices, const struct libdivide_s32_array_t *array) {
+    __m256i magics = _mm256_i32gather_epi32((const int *)array->magics, indices, 4);
+    __m256i mores = _mm256_and_si256(_mm256_i32gather_epi32((const int *)array->mores, indices, 1), _mm256_set1_epi32(0xFF));
+    return libdivide_8s32_branchfree_do_lanes(numers, magics, mores);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_array_do_gather(__m256i numers, __m128i indices, const struct libdivide_u64_array_t *array) {
+    __m256i magics = _mm256_i32gather_epi64((const long long *)array->magics, indices, 8);
+    __m256i mores = _mm256_and_si256(_mm256_i32gather_epi64((const long long *)array->mores, indices, 1), libdivide__u64_to_m256i(0xFF));
+    __m256i ones = _mm256_cmpeq_epi64(mores, libdivide__u64_to_m256i(LIBDIVIDE_ARRAY_ONE));
+    __m256i q = libdivide_4u64_branchfree_do_lanes(numers, magics, _mm256_and_si256(mores, libdivide__u64_to_m256i(LIBDIVIDE_64_SHIFT_MASK)));
+    return _mm256_blendv_epi8(q, numers, ones);
+}
+
+LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s64_array_do_gather(__m256i numers, __m128i indices, const struct libdivide_s64_array_t *array) {
+    __m256i magics = _mm256_i32gather_epi64((const long long *)array->magics, indices, 8);
+    __m256i mores = _mm256_and_si256(_mm256_i32gather_epi64((const long long *)array->mores, indices, 1), libdivide__u64_to_m256i(0xFF));
+    return libdivide_4s64_branchfree_do_lanes(numers, magics, mores);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_mullhi_16u32_lanes_vector(__m512i a, __m512i b) {
+    __m512i hi_product_0Z2Z = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+    __m512i hi_product_Z1Z3 = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xAAAA, hi_product_0Z2Z, hi_product_Z1Z3);
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_mullhi_16s32_lanes_vector(__m512i a, __m512i b) {
+    __m512i hi_product_0Z2Z = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32);
+    __m512i hi_product_Z1Z3 = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xAAAA, hi_product_0Z2Z, hi_product_Z1Z3);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_branchfree_do_lanes(__m512i numers, __m512i magics, __m512i mores) {
+    __m512i q = libdivide_mullhi_16u32_lanes_vector(numers, magics);
+    __m512i t = _mm512_add_epi32(_mm512_srli_epi32(_mm512_sub_epi32(numers, q), 1), q);
+    return _mm512_srlv_epi32(t, mores);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_branchfree_do_lanes(__m512i numers, __m512i magics, __m512i mores) {
+    const __m512i one = _mm512_set1_epi32(1);
+    __m512i shifts = _mm512_and_si512(mores, _mm512_set1_epi32(LIBDIVIDE_32_SHIFT_MASK));
+    __m512i sign = _mm512_srai_epi32(_mm512_slli_epi32(mores, 24), 31);
+    __m512i roundToZeroTweak = _mm512_sllv_epi32(one, shifts);
+    roundToZeroTweak = _mm512_mask_sub_epi32(roundToZeroTweak, _mm512_cmpeq_epi32_mask(magics, _mm512_setzero_si512()), roundToZeroTweak, one);
+    __m512i q = _mm512_add_epi32(libdivide_mullhi_16s32_lanes_vector(numers, magics), numers);
+    q = _mm512_add_epi32(q, _mm512_and_si512(_mm512_srai_epi32(q, 31), roundToZeroTweak));
+    q = _mm512_srav_epi32(q, shifts);
+    return _mm512_sub_epi32(_mm512_xor_si512(q, sign), sign);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_branchfree_do_lanes(__m512i numers, __m512i magics, __m512i mores) {
+    __m512i q = libdivide_mullhi_8u64_flat_vector(numers, magics);
+    __m512i t = _mm512_add_epi64(_mm512_srli_epi64(_mm512_sub_epi64(numers, q), 1), q);
+    return _mm512_srlv_epi64(t, mores);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_branchfree_do_lanes(__m512i numers, __m512i magics, __m512i mores) {
+    const __m512i one = libdivide__u64_to_m512i(1);
+    __m512i shifts = _mm512_and_si512(mores, libdivide__u64_to_m512i(LIBDIVIDE_64_SHIFT_MASK));
+    __m512i sign = _mm512_srai_epi64(_mm512_slli_epi64(mores, 56), 63);
+    __m512i roundToZeroTweak = _mm512_sllv_epi64(one, shifts);
+    roundToZeroTweak = _mm512_mask_sub_epi64(roundToZeroTweak, _mm512_cmpeq_epi64_mask(magics, _mm512_setzero_si512()), roundToZeroTweak, one);
+    __m512i q = _mm512_add_epi64(libdivide_mullhi_8s64_flat_vector(numers, magics), numers);
+    q = _mm512_add_epi64(q, _mm512_and_si512(libdivide_8s64_signbits(q), roundToZeroTweak));
+    q = _mm512_srav_epi64(q, shifts);
+    return _mm512_sub_epi64(_mm512_xor_si512(q, sign), sign);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_branchfree_do_gather(__m512i numers, __m512i indices, const struct libdivide_u32_branchfree_t *table) {
+    __m512i magics = _mm512_i32gather_epi32(indices, (const void *)&table->magic, sizeof *table);
+    __m512i mores = _mm512_and_si512(_mm512_i32gather_epi32(indices, (const void *)&table->more, sizeof *table), _mm512_set1_epi32(0xFF));
+    return libdivide_16u32_branchfree_do_lanes(numers, magics, mores);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_branchfree_do_gather(__m512i numers, __m512i indices, const struct libdivide_s32_branchfree_t *table) {
+    __m512i magics = _mm512_i32gather_epi32(indices, (const void *)&table->magic, sizeof *table);
+    __m512i mores = _mm512_and_si512(_mm512_i32gather_epi32(indices, (const void *)&table->more, sizeof *table), _mm512_set1_epi32(0xFF));
+    return libdivide_16s32_branchfree_do_lanes(numers, magics, mores);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_branchfree_do_gather(__m512i numers, __m256i indices, const struct libdivide_u64_branchfree_t *table) {
+    __m512i offsets = _mm512_slli_epi64(_mm512_cvtepu32_epi64(indices), 1);
+    __m512i magics = _mm512_i64gather_epi64(offsets, (const void *)&table->magic, 8);
+    __m512i mores = _mm512_and_si512(_mm512_i64gather_epi64(offsets, (const void *)&table->more, 8), libdivide__u64_to_m512i(0xFF));
+    return libdivide_8u64_branchfree_do_lanes(numers, magics, mores);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_branchfree_do_gather(__m512i numers, __m256i indices, const struct libdivide_s64_branchfree_t *table) {
+    __m512i offsets = _mm512_slli_epi64(_mm512_cvtepu32_epi64(indices), 1);
+    __m512i magics = _mm512_i64gather_epi64(offsets, (const void *)&table->magic, 8);
+    __m512i mores = _mm512_and_si512(_mm512_i64gather_epi64(offsets, (const void *)&table->more, 8), libdivide__u64_to_m512i(0xFF));
+    return libdivide_8s64_branchfree_do_lanes(numers, magics, mores);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16u32_array_do_gather(__m512i numers, __m512i indices, const struct libdivide_u32_array_t *array) {
+    __m512i magics = _mm512_i32gather_epi32(indices, (const void *)array->magics, 4);
+    __m512i mores = _mm512_and_si512(_mm512_i32gather_epi32(indices, (const void *)array->mores, 1), _mm512_set1_epi32(0xFF));
+    __mmask16 ones = _mm512_cmpeq_epi32_mask(mores, _mm512_set1_epi32(LIBDIVIDE_ARRAY_ONE));
+    __m512i q = libdivide_16u32_branchfree_do_lanes(numers, magics, _mm512_and_si512(mores, _mm512_set1_epi32(LIBDIVIDE_32_SHIFT_MASK)));
+    return _mm512_mask_mov_epi32(q, ones, numers);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_16s32_array_do_gather(__m512i numers, __m512i indices, const struct libdivide_s32_array_t *array) {
+    __m512i magics = _mm512_i32gather_epi32(indices, (const void *)array->magics, 4);
+    __m512i mores = _mm512_and_si512(_mm512_i32gather_epi32(indices, (const void *)array->mores, 1), _mm512_set1_epi32(0xFF));
+    return libdivide_16s32_branchfree_do_lanes(numers, magics, mores);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_array_do_gather(__m512i numers, __m256i indices, const struct libdivide_u64_array_t *array) {
+    __m512i magics = _mm512_i32gather_epi64(indices, (const void *)array->magics, 8);
+    __m512i mores = _mm512_and_si512(_mm512_i32gather_epi64(indices, (const void *)array->mores, 1), libdivide__u64_to_m512i(0xFF));
+    __mmask8 ones = _mm512_cmpeq_epi64_mask(mores, libdivide__u64_to_m512i(LIBDIVIDE_ARRAY_ONE));
+    __m512i q = libdivide_8u64_branchfree_do_lanes(numers, magics, _mm512_and_si512(mores, libdivide__u64_to_m512i(LIBDIVIDE_64_SHIFT_MASK)));
+    return _mm512_mask_mov_epi64(q, ones, numers);
+}
+
+LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8s64_array_do_gather(__m512i numers, __m256i indices, const struct libdivide_s64_array_t *array) {
+    __m512i magics = _mm512_i32gather_epi64(indices, (const void *)array->magics, 8);
+    __m512i mores = _mm512_and_si512(_mm512_i32gather_epi64(indices, (const void *)array->mores, 1), libdivide__u64_to_m512i(0xFF));
+    return libdivide_8s64_branchfree_do_lanes(numers, magics, mores);
+}
+#endif
+
+/////////// BATCH GENERATION
+
+/* The scalar kernels, for builds without the wide vectors and for the tails */
+static inline void libdivide_u32_gen_array_soa_scalar(const uint32_t *d, uint32_t *magics, uint8_t *mores, size_t n) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        const struct libdivide_u32_t denom = libdivide_u32_gen(d[i]);
+        magics[i] = denom.magic;
+        mores[i] = denom.more;
+    }
+}
+
+static inline void libdivide_s32_gen_array_soa_scalar(const int32_t *d, int32_t *magics, uint8_t *mores, size_t n) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        const struct libdivide_s32_t denom = libdivide_s32_gen(d[i]);
+        magics[i] = denom.magic;
+        mores[i] = denom.more;
+    }
+}
+
+/* The vector kernels follow libdivide_u32_gen and libdivide_s32_gen lane for lane, with the branches turned into selects, in 64 bit lanes.  The division there is 2**(32 + k) / d, or 2**(31 + k) / |d| for s32, with k = floor(log2(d)).  It is done in double precision: d converts exactly, k is its exponent, and the dividend is a power of 2, so the rounded quotient is at most one more than the true one, whatever the rounding mode.  One multiply finds the remainder, and a negative remainder means the quotient needs taking down by one. */
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+
+/* Returns floor(2**(extra + k) / d) for the d in the 64 bit lanes, storing the remainder and k.  d must be less than 2**32 and not a power of 2; the other lanes get garbage. */
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_gen_div_vector(__m256i d, int extra, __m256i *rem, __m256i *k) {
+    //2**52 as a double.  Its mantissa holds a 52 bit integer, which d fits in
+    const __m256i bias = _mm256_set1_epi64x(0x4330000000000000LL);
+    const __m256d dd = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(d, bias)), _mm256_castsi256_pd(bias));
+    const __m256i exponent = _mm256_and_si256(_mm256_castpd_si256(dd), _mm256_set1_epi64x(0x7FF0000000000000LL));
+    *k = _mm256_sub_epi64(_mm256_srli_epi64(exponent, 52), _mm256_set1_epi64x(1023));
+    const __m256d power = _mm256_castsi256_pd(_mm256_add_epi64(exponent, _mm256_set1_epi64x((int64_t)extra << 52)));
+    //adding 2**52 rounds the quotient to an integer in the low mantissa bits
+    __m256i q = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(_mm256_div_pd(power, dd), _mm256_castsi256_pd(bias))), bias);
+    //the remainder is in -d..d, so the product may wrap but the difference doesn't
+    __m256i r = _mm256_sub_epi64(_mm256_sllv_epi64(_mm256_set1_epi64x(1), _mm256_add_epi64(*k, _mm256_set1_epi64x(extra))), _mm256_mul_epu32(q, d));
+    const __m256i over = _mm256_cmpgt_epi64(_mm256_setzero_si256(), r);
+    q = _mm256_add_epi64(q, over);
+    *rem = _mm256_add_epi64(r, _mm256_and_si256(over, d));
+    return q;
+}
+
+/* Packs the magic numbers and the more bytes from the 64 bit lanes, the magics into the low half and the mores, as 32 bit lanes, into the high half */
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u64_gen_pack_vector(__m256i magic, __m256i more) {
+    const __m256i both = _mm256_blend_epi32(magic, _mm256_slli_epi64(more, 32), 0xAA);
+    return _mm256_permutevar8x32_epi32(both, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4u32_gen_vector(__m128i d32) {
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i d = _mm256_cvtepu32_epi64(d32);
+    __m256i rem, k;
+    const __m256i q = libdivide_4u64_gen_div_vector(d, 32, &rem, &k);
+    const __m256i e = _mm256_sub_epi64(d, rem);
+    //the smaller power works where e < 2**k.  Elsewhere the magic is 2q, plus 1 where twice rem >= d, i.e. where rem >= e
+    const __m256i small = _mm256_cmpgt_epi64(_mm256_sllv_epi64(one, k), e);
+    const __m256i big = _mm256_add_epi64(_mm256_add_epi64(q, q), _mm256_add_epi64(one, _mm256_cmpgt_epi64(e, rem)));
+    __m256i magic = _mm256_add_epi64(_mm256_blendv_epi8(big, q, small), one);
+    __m256i more = _mm256_or_si256(k, _mm256_andnot_si256(small, _mm256_set1_epi64x(LIBDIVIDE_ADD_MARKER)));
+    const __m256i power_of_2 = _mm256_cmpeq_epi64(_mm256_and_si256(d, _mm256_sub_epi64(d, one)), _mm256_setzero_si256());
+    magic = _mm256_andnot_si256(power_of_2, magic);
+    more = _mm256_blendv_epi8(more, _mm256_or_si256(k, _mm256_set1_epi64x(LIBDIVIDE_U32_SHIFT_PATH)), power_of_2);
+    return libdivide_4u64_gen_pack_vector(magic, more);
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 __m256i libdivide_4s32_gen_vector(__m128i d32) {
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i absD = _mm256_cvtepu32_epi64(_mm_abs_epi32(d32));
+    const __m256i negative = _mm256_cmpgt_epi64(_mm256_setzero_si256(), _mm256_cvtepi32_epi64(d32));
+    const __m256i negative_more = _mm256_and_si256(negative, _mm256_set1_epi64x(LIBDIVIDE_NEGATIVE_DIVISOR));
+    __m256i rem, k;
+    const __m256i q = libdivide_4u64_gen_div_vector(absD, 31, &rem, &k);
+    const __m256i e = _mm256_sub_epi64(absD, rem);
+    const __m256i small = _mm256_cmpgt_epi64(_mm256_sllv_epi64(one, k), e);
+    const __m256i big = _mm256_add_epi64(_mm256_add_epi64(q, q), _mm256_add_epi64(one, _mm256_cmpgt_epi64(e, rem)));
+    __m256i magic = _mm256_add_epi64(_mm256_blendv_epi8(big, q, small), one);
+    magic = _mm256_sub_epi64(_mm256_xor_si256(magic, negative), negative);
+    __m256i more = _mm256_blendv_epi8(_mm256_or_si256(_mm256_or_si256(k, _mm256_set1_epi64x(LIBDIVIDE_ADD_MARKER)), negative_more), _mm256_sub_epi64(k, one), small);
+    const __m256i power_of_2 = _mm256_cmpeq_epi64(_mm256_and_si256(absD, _mm256_sub_epi64(absD, one)), _mm256_setzero_si256());
+    magic = _mm256_andnot_si256(power_of_2, magic);
+    more = _mm256_blendv_epi8(more, _mm256_or_si256(_mm256_or_si256(k, _mm256_set1_epi64x(LIBDIVIDE_S32_SHIFT_PATH)), negative_more), power_of_2);
+    return libdivide_4u64_gen_pack_vector(magic, more);
+}
+
+/* Stores 8 dividers from two packed halves */
+static inline LIBDIVIDE_TARGET_AVX2 void libdivide_8u32_gen_store(__m256i lo, __m256i hi, void *magics, uint8_t *mores) {
+    const __m128i more16 = _mm_packus_epi32(_mm256_extracti128_si256(lo, 1), _mm256_extracti128_si256(hi, 1));
+    _mm256_storeu_si256((__m256i *)magics, _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm_storel_epi64((__m128i *)mores, _mm_packus_epi16(more16, more16));
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 void libdivide_u32_gen_array_soa_avx2(const uint32_t *d, uint32_t *magics, uint8_t *mores, size_t n) {
+    size_t i;
+    for (i = 0; i + 8 <= n; i += 8) {
+        libdivide_8u32_gen_store(libdivide_4u32_gen_vector(_mm_loadu_si128((const __m128i *)(d + i))), libdivide_4u32_gen_vector(_mm_loadu_si128((const __m128i *)(d + i + 4))), magics + i, mores + i);
+    }
+    libdivide_u32_gen_array_soa_scalar(d + i, magics + i, mores + i, n - i);
+}
+
+static inline LIBDIVIDE_TARGET_AVX2 void libdivide_s32_gen_array_soa_avx2(const int32_t *d, int32_t *magics, uint8_t *mores, size_t n) {
+    size_t i;
+    for (i = 0; i + 8 <= n; i += 8) {
+        libdivide_8u32_gen_store(libdivide_4s32_gen_vector(_mm_loadu_si128((const __m128i *)(d + i))), libdivide_4s32_gen_vector(_mm_loadu_si128((const __m128i *)(d + i + 4))), magics + i, mores + i);
+    }
+    libdivide_s32_gen_array_soa_scalar(d + i, magics + i, mores + i, n - i);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH
+static inline LIBDIVIDE_TARGET_AVX512 __m512i libdivide_8u64_gen_div_vector(__m512i d, int extra, __m512i *rem, __m512i *k) {
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512d dd = _mm512_cvtepu64_pd(d);
+    const __m512i exponent = _mm512_and_si512(_mm512_castpd_si512(dd), _mm512_set1_epi64(0x7FF0000000000000LL));
+    *k = _mm512_sub_epi64(_mm512_srli_epi64(exponent, 52), _mm512_set1_epi64(1023));
+    const __m512d power = _mm512_castsi512_pd(_mm512_add_epi64(exponent, _mm512_set1_epi64((int64_t)extra << 52)));
+    __m512i q = _mm512_cvtpd_epu64(_mm512_div_pd(power, dd));
+    __m512i r = _mm512_sub_epi64(_mm512_sllv_epi64(one, _mm512_add_epi64(*k, _mm512_set1_epi64(extra))), _mm512_mul_epu32(q, d));
+    const __mmask8 over = _mm512_movepi64_mask(r);
+    q = _mm512_mask_sub_epi64(q, over, q, one);
+    *rem = _mm512_mask_add_epi64(r, over, r, d);
+    return q;
+}
+
+/* Works on the 8 lanes of d selected by mask, and stores them */
+static inline LIBDIVIDE_TARGET_AVX512 void libdivide_8u32_gen_vector(__m256i d32, __mmask8 mask, uint32_t *magics, uint8_t *mores) {
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i d = _mm512_cvtepu32_epi64(d32);
+    __m512i rem, k;
+    const __m512i q = libdivide_8u64_gen_div_vector(d, 32, &rem, &k);
+    const __m512i e = _mm512_sub_epi64(d, rem);
+    const __mmask8 small = _mm512_cmplt_epu64_mask(e, _mm512_sllv_epi64(one, k));
+    const __m512i twice_q = _mm512_add_epi64(q, q);
+    const __m512i big = _mm512_mask_add_epi64(twice_q, _mm512_cmpge_epu64_mask(rem, e), twice_q, one);
+    __m512i magic = _mm512_add_epi64(_mm512_mask_mov_epi64(big, small, q), one);
+    __m512i more = _mm512_mask_mov_epi64(_mm512_or_si512(k, _mm512_set1_epi64(LIBDIVIDE_ADD_MARKER)), small, k);
+    const __mmask8 power_of_2 = _mm512_testn_epi64_mask(d, _mm512_sub_epi64(d, one));
+    magic = _mm512_mask_mov_epi64(magic, power_of_2, _mm512_setzero_si512());
+    more = _mm512_mask_or_epi64(more, power_of_2, k, _mm512_set1_epi64(LIBDIVIDE_U32_SHIFT_PATH));
+    _mm256_mask_storeu_epi32(magics, mask, _mm512_cvtepi64_epi32(magic));
+    _mm_mask_storeu_epi8(mores, mask, _mm512_cvtepi64_epi8(more));
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 void libdivide_8s32_gen_vector(__m256i d32, __mmask8 mask, int32_t *magics, uint8_t *mores) {
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i absD = _mm512_cvtepu32_epi64(_mm256_abs_epi32(d32));
+    const __mmask8 negative = _mm512_movepi64_mask(_mm512_cvtepi32_epi64(d32));
+    __m512i rem, k;
+    const __m512i q = libdivide_8u64_gen_div_vector(absD, 31, &rem, &k);
+    const __m512i e = _mm512_sub_epi64(absD, rem);
+    const __mmask8 small = _mm512_cmplt_epu64_mask(e, _mm512_sllv_epi64(one, k));
+    const __m512i twice_q = _mm512_add_epi64(q, q);
+    const __m512i big = _mm512_mask_add_epi64(twice_q, _mm512_cmpge_epu64_mask(rem, e), twice_q, one);
+    __m512i magic = _mm512_add_epi64(_mm512_mask_mov_epi64(big, small, q), one);
+    magic = _mm512_mask_sub_epi64(magic, negative, _mm512_setzero_si512(), magic);
+    __m512i more = _mm512_or_si512(k, _mm512_set1_epi64(LIBDIVIDE_ADD_MARKER));
+    more = _mm512_mask_or_epi64(more, negative, more, _mm512_set1_epi64(LIBDIVIDE_NEGATIVE_DIVISOR));
+    more = _mm512_mask_sub_epi64(more, small, k, one);
+    const __mmask8 power_of_2 = _mm512_testn_epi64_mask(absD, _mm512_sub_epi64(absD, one));
+    magic = _mm512_mask_mov_epi64(magic, power_of_2, _mm512_setzero_si512());
+    more = _mm512_mask_or_epi64(more, power_of_2, k, _mm512_set1_epi64(LIBDIVIDE_S32_SHIFT_PATH));
+    more = _mm512_mask_or_epi64(more, power_of_2 & negative, more, _mm512_set1_epi64(LIBDIVIDE_NEGATIVE_DIVISOR));
+    _mm256_mask_storeu_epi32(magics, mask, _mm512_cvtepi64_epi32(magic));
+    _mm_mask_storeu_epi8(mores, mask, _mm512_cvtepi64_epi8(more));
+}
+
+/* The tail is one masked vector.  Its unloaded lanes are 1, so that they don't divide by zero. */
+static inline LIBDIVIDE_TARGET_AVX512 void libdivide_u32_gen_array_soa_avx512(const uint32_t *d, uint32_t *magics, uint8_t *mores, size_t n) {
+    size_t i;
+    for (i = 0; i + 8 <= n; i += 8) {
+        libdivide_8u32_gen_vector(_mm256_loadu_si256((const __m256i *)(d + i)), 0xFF, magics + i, mores + i);
+    }
+    if (i < n) {
+        const __mmask8 mask = (__mmask8)((1U << (n - i)) - 1);
+        libdivide_8u32_gen_vector(_mm256_mask_loadu_epi32(_mm256_set1_epi32(1), mask, d + i), mask, magics + i, mores + i);
+    }
+}
+
+static inline LIBDIVIDE_TARGET_AVX512 void libdivide_s32_gen_array_soa_avx512(const int32_t *d, int32_t *magics, uint8_t *mores, size_t n) {
+    size_t i;
+    for (i = 0; i + 8 <= n; i += 8) {
+        libdivide_8s32_gen_vector(_mm256_loadu_si256((const __m256i *)(d + i)), 0xFF, magics + i, mores + i);
+    }
+    if (i < n) {
+        const __mmask8 mask = (__mmask8)((1U << (n - i)) - 1);
+        libdivide_8s32_gen_vector(_mm256_mask_loadu_epi32(_mm256_set1_epi32(1), mask, d + i), mask, magics + i, mores + i);
+    }
+}
+#endif
+
+/////////// DIVIDER CACHE
+
+#if LIBDIVIDE_HAS_ATOMICS
+//Fibonacci hashing: the top bits of d * 2**64 / phi.  The next two bits below the slot pick which of the four slots a new divider replaces when they are all full
+static inline uint64_t libdivide__cache_hash(uint64_t d) {
+    return d * 0x9E3779B97F4A7C15ULL;
+}
+
+static inline struct libdivide_cache_slot_t *libdivide__cache_slot(struct libdivide_cache_slot_t *slots, uint64_t hash, uint32_t probe) {
+    return &slots[((uint32_t)(hash >> (64 - LIBDIVIDE_CACHE_BITS)) + probe) & ((1U << LIBDIVIDE_CACHE_BITS) - 1)];
+}
+
+//threads are told apart by their stacks, which are far enough apart that the hash of the address over 64K gives each its own stripe, mostly
+static inline struct libdivide_cache_counts_t *libdivide__cache_counts(struct libdivide_cache_counts_t *counts) {
+    const uintptr_t stack = (uintptr_t)&counts;
+    return &counts[(uint32_t)(libdivide__cache_hash(stack >> 16) >> 32) % LIBDIVIDE_CACHE_STRIPES];
+}
+
+//a locked add would cost as much as a hit saves, so the counts are bumped with a plain load and store.  Threads that share a stripe can lose the odd count between them, which is fine for telling how well the cache works
+static inline void libdivide__cache_count(uint64_t *count) {
+    __atomic_store_n(count, __atomic_load_n(count, __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED);
+}
+
+static inline int libdivide__cache_find(struct libdivide_cache_slot_t *slots, uint64_t d, uint64_t *magic, uint8_t *more) {
+    const uint64_t hash = libdivide__cache_hash(d);
+    uint32_t probe;
+    for (probe = 0; probe < 4; probe++) {
+        struct libdivide_cache_slot_t *slot = libdivide__cache_slot(slots, hash, probe);
+        const uint64_t sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+        const uint64_t divisor = __atomic_load_n(&slot->divisor, __ATOMIC_RELAXED);
+        //slots are never emptied, and a divider goes in the first empty one, so an empty slot ends the search
+        if (divisor == 0) return 0;
+        if (divisor != d) continue;
+        *magic = __atomic_load_n(&slot->magic, __ATOMIC_RELAXED);
+        *more = (uint8_t)__atomic_load_n(&slot->more, __ATOMIC_RELAXED);
+        //the fence keeps the reads above ahead of the second read of the sequence, which tells whether a writer got in between
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        return (sequence & 1) == 0 && __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) == sequence;
+    }
+    return 0;
+}
+
+static inline void libdivide__cache_insert(struct libdivide_cache_slot_t *slots, uint64_t d, uint64_t magic, uint8_t more) {
+    const uint64_t hash = libdivide__cache_hash(d);
+    struct libdivide_cache_slot_t *slot = NULL;
+    uint64_t sequence;
+    uint32_t probe;
+    for (probe = 0; probe < 4; probe++) {
+        struct libdivide_cache_slot_t *candidate = libdivide__cache_slot(slots, hash, probe);
+        const uint64_t divisor = __atomic_load_n(&candidate->divisor, __ATOMIC_RELAXED);
+        if (divisor == d) return; //another thread added it
+        if (divisor == 0) {
+            slot = candidate;
+            break;
+        }
+    }
+    if (slot == NULL) slot = libdivide__cache_slot(slots, hash, (uint32_t)(hash >> (62 - LIBDIVIDE_CACHE_BITS)) & 3);
+    //claim the slot by making its sequence odd, unless another writer has
+    sequence = __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED);
+    if (sequence & 1) return;
+    if (! __atomic_compare_exchange_n(&slot->sequence, &sequence, sequence + 1, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) return;
+    //and keep the claim ahead of the writes, for readers that see any of them
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&slot->divisor, d, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->magic, magic, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->more, more, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+static inline void libdivide__cache_stats(const struct libdivide_cache_counts_t *counts, uint64_t *hits, uint64_t *misses) {
+    uint32_t i;
+    *hits = 0;
+    *misses = 0;
+    for (i = 0; i < LIBDIVIDE_CACHE_STRIPES; i++) {
+        *hits += __atomic_load_n(&counts[i].hits, __ATOMIC_RELAXED);
+        *misses += __atomic_load_n(&counts[i].misses, __ATOMIC_RELAXED);
+    }
+}
+
+struct libdivide_u64_t libdivide_u64_gen_cached(uint64_t d, struct libdivide_u64_cache_t *cache) {
+    struct libdivide_cache_counts_t *counts = libdivide__cache_counts(cache->counts);
+    struct libdivide_u64_t result;
+    uint64_t magic;
+    uint8_t more;
+    if (libdivide__cache_find(cache->slots, d, &magic, &more)) {
+        libdivide__cache_count(&counts->hits);
+        result.magic = magic;
+        result.more = more;
+        result.divisor = d;
+        return result;
+    }
+    libdivide__cache_count(&counts->misses);
+    result = libdivide_u64_gen(d);
+    libdivide__cache_insert(cache->slots, d, result.magic, result.more);
+    return result;
+}
+
+struct libdivide_s64_t libdivide_s64_gen_cached(int64_t d, struct libdivide_s64_cache_t *cache) {
+    struct libdivide_cache_counts_t *counts = libdivide__cache_counts(cache->counts);
+    struct libdivide_s64_t result;
+    uint64_t magic;
+    uint8_t more;
+    if (libdivide__cache_find(cache->slots, (uint64_t)d, &magic, &more)) {
+        libdivide__cache_count(&counts->hits);
+        result.magic = (int64_t)magic;
+        result.more = more;
+        result.divisor = d;
+        return result;
+    }
+    libdivide__cache_count(&counts->misses);
+    result = libdivide_s64_gen(d);
+    libdivide__cache_insert(cache->slots, (uint64_t)d, (uint64_t)result.magic, result.more);
+    return result;
+}
+
+void libdivide_u64_cache_stats(const struct libdivide_u64_cache_t *cache, uint64_t *hits, uint64_t *misses) {
+    libdivide__cache_stats(cache->counts, hits, misses);
+}
+
+void libdivide_s64_cache_stats(const struct libdivide_s64_cache_t *cache, uint64_t *hits, uint64_t *misses) {
+    libdivide__cache_stats(cache->counts, hits, misses);
+}
+#endif
+
+/////////// DIVIDER TABLE
+
+//the tables start at 1, so d - 1 indexes them, and d == 0 wraps around to go to gen like any other divisor past the end.  The 32 bit entries are the magic number with the more byte above it
+struct libdivide_u32_t libdivide_u32_get(uint32_t d) {
+#if LIBDIVIDE_USE_TABLE
+    if (d - 1 < LIBDIVIDE_TABLE_SIZE) {
+        struct libdivide_u32_t result;
+        const uint64_t entry = libdivide_u32_table[d - 1];
+        result.magic = (uint32_t)entry;
+        result.more = (uint8_t)(entry >> 32);
+        result.divisor = d;
+        return result;
+    }
+#endif
+    return libdivide_u32_gen(d);
+}
+
+struct libdivide_s32_t libdivide_s32_get(int32_t d) {
+#if LIBDIVIDE_USE_TABLE
+    if ((uint32_t)d - 1 < LIBDIVIDE_TABLE_SIZE) {
+        struct libdivide_s32_t result;
+        const uint64_t entry = libdivide_s32_table[(uint32_t)d - 1];
+        result.magic = (int32_t)(uint32_t)entry;
+        result.more = (uint8_t)(entry >> 32);
+        result.divisor = d;
+        return result;
+    }
+#endif
+    return libdivide_s32_gen(d);
+}
+
+struct libdivide_u64_t libdivide_u64_get(uint64_t d) {
+#if LIBDIVIDE_USE_TABLE
+    if (d - 1 < LIBDIVIDE_TABLE_SIZE) {
+        struct libdivide_u64_t result;
+        result.magic = libdivide_u64_table[d - 1][0];
+        result.more = (uint8_t)libdivide_u64_table[d - 1][1];
+        result.divisor = d;
+        return result;
+    }
+#endif
+    return libdivide_u64_gen(d);
+}
+
+/////////// SERIALIZATION
+
+#define LIBDIVIDE_SERIAL_SIGNATURE "libdivid"
+#define LIBDIVIDE_SERIAL_ENDIAN 0x01020304U
+
+//the header as it is laid out in memory, with no padding
+struct libdivide__serial_header_t {
+    char signature[8];
+    uint32_t endian;
+    uint16_t version;
+    uint8_t type;
+    uint8_t size;
+    uint32_t more_encoding;
+    uint32_t reserved;
+    uint64_t count;
+};
+
+static inline void libdivide__serial_swap(void *x, size_t width) {
+    unsigned char *bytes = (unsigned char *)x;
+    size_t i;
+    for (i = 0; i < width / 2; i++) {
+        const unsigned char t = bytes[i];
+        bytes[i] = bytes[width - 1 - i];
+        bytes[width - 1 - i] = t;
+    }
+}
+
+//writes the header and returns the size of the whole array, but only if size is enough for it
+static inline size_t libdivide__serial_header(void *buf, size_t size, uint8_t type, size_t width, size_t n) {
+    struct libdivide__serial_header_t header;
+    const size_t total = LIBDIVIDE_SERIAL_HEADER_SIZE + n * 3 * width;
+    if (size >= total) {
+        memset(&header, 0, sizeof header);
+        memcpy(header.signature, LIBDIVIDE_SERIAL_SIGNATURE, sizeof header.signature);
+        header.endian = LIBDIVIDE_SERIAL_ENDIAN;
+        header.version = LIBDIVIDE_SERIAL_VERSION;
+        header.type = type;
+        header.size = (uint8_t)(3 * width);
+        header.more_encoding = LIBDIVIDE_MORE_ENCODING;
+        header.count = n;
+        memcpy(buf, &header, sizeof header);
+    }
+    return total;
+}
+
+//whether every divider could have come from libdivide_*_gen: a shift that fits the type, no more bits but the shift and the type's flags, and a divisor that isn't 0.  The more byte and the zero test don't depend on the byte order
+static inline int libdivide__serial_entries_valid(const unsigned char *in, size_t count, size_t width, uint8_t shift_mask, uint8_t flags) {
+    size_t i, j;
+    for (i = 0; i < count; i++, in += 3 * width) {
+        const uint8_t more = in[width];
+        unsigned char divisor = 0;
+        if ((size_t)(more & shift_mask) >= 8 * width || (more & ~(shift_mask | flags)) != 0) return 0;
+        for (j = 0; j < width; j++) divisor |= in[2 * width + j];
+        if (divisor == 0) return 0;
+    }
+    return 1;
+}
+
+//returns the number of dividers after the header, and sets *swap if they have the other byte order
+static inline size_t libdivide__serial_check(const void *buf, size_t size, uint8_t type, size_t width, uint8_t shift_mask, uint8_t flags, int *swap) {
+    struct libdivide__serial_header_t header;
+    if (buf == NULL || size < LIBDIVIDE_SERIAL_HEADER_SIZE) return LIBDIVIDE_SERIAL_INVALID;
+    memcpy(&header, buf, sizeof header);
+    if (memcmp(header.signature, LIBDIVIDE_SERIAL_SIGNATURE, sizeof header.signature) != 0) return LIBDIVIDE_SERIAL_INVALID;
+    *swap = (header.endian != LIBDIVIDE_SERIAL_ENDIAN);
+    if (*swap) {
+        libdivide__serial_swap(&header.endian, sizeof header.endian);
+        libdivide__serial_swap(&header.version, sizeof header.version);
+        libdivide__serial_swap(&header.more_encoding, sizeof header.more_encoding);
+        libdivide__serial_swap(&header.count, sizeof header.count);
+        if (header.endian != LIBDIVIDE_SERIAL_ENDIAN) return LIBDIVIDE_SERIAL_INVALID;
+    }
+    if (header.version != LIBDIVIDE_SERIAL_VERSION || header.type != type || header.size != 3 * width || header.more_encoding != LIBDIVIDE_MORE_ENCODING) return LIBDIVIDE_SERIAL_INVALID;
+    if (header.count > (size - LIBDIVIDE_SERIAL_HEADER_SIZE) / (3 * width)) return LIBDIVIDE_SERIAL_INVALID;
+    if (! libdivide__serial_entries_valid((const unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE, (size_t)header.count, width, shift_mask, flags)) return LIBDIVIDE_SERIAL_INVALID;
+    return (size_t)header.count;
+}
+
+//one divider, a field at a time so that the padding goes out as zeros whatever was in the struct
+static inline void libdivide__serial_put(unsigned char *out, const void *magic, uint8_t more, const void *divisor, size_t width) {
+    memcpy(out, magic, width);
+    out[width] = more;
+    memset(out + width + 1, 0, width - 1);
+    memcpy(out + 2 * width, divisor, width);
+}
+
+static inline void libdivide__serial_get(const unsigned char *in, void *magic, uint8_t *more, void *divisor, size_t width, int swap) {
+    memcpy(magic, in, width);
+    *more = in[width];
+    memcpy(divisor, in + 2 * width, width);
+    if (swap) {
+        libdivide__serial_swap(magic, width);
+        libdivide__serial_swap(divisor, width);
+    }
+}
+
+//the dividers can be copied whole if they have this machine's byte order and the structs have the same layout, and used in place if buf is also aligned for them
+#define LIBDIVIDE_SERIAL_NATIVE(denom_type, int_type, swap) (! (swap) && sizeof(denom_type) == 3 * sizeof(int_type) && offsetof(denom_type, more) == sizeof(int_type) && offsetof(denom_type, divisor) == 2 * sizeof(int_type))
+#define LIBDIVIDE_SERIAL_IN_PLACE(denom_type, int_type, buf, swap) (LIBDIVIDE_SERIAL_NATIVE(denom_type, int_type, swap) && ((uintptr_t)(buf) + LIBDIVIDE_SERIAL_HEADER_SIZE) % sizeof(int_type) == 0)
+
+size_t libdivide_u32_serialize(const struct libdivide_u32_t *denoms, size_t n, void *buf, size_t size) {
+    unsigned char *out = (unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE;
+    const size_t total = libdivide__serial_header(buf, size, LIBDIVIDE_SERIAL_U32, sizeof(uint32_t), n);
+    size_t i;
+    if (size < total) return total;
+    for (i = 0; i < n; i++, out += 3 * sizeof(uint32_t)) {
+        libdivide__serial_put(out, &denoms[i].magic, denoms[i].more, &denoms[i].divisor, sizeof(uint32_t));
+    }
+    return total;
+}
+
+size_t libdivide_u32_deserialize(const void *buf, size_t size, struct libdivide_u32_t *denoms, size_t n) {
+    const unsigned char *in = (const unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE;
+    int swap;
+    const size_t count = libdivide__serial_check(buf, size, LIBDIVIDE_SERIAL_U32, sizeof(uint32_t), LIBDIVIDE_32_SHIFT_MASK, LIBDIVIDE_U32_FLAGS, &swap);
+    size_t i;
+    if (count == LIBDIVIDE_SERIAL_INVALID) return count;
+    if (n > count) n = count;
+    if (LIBDIVIDE_SERIAL_NATIVE(struct libdivide_u32_t, uint32_t, swap)) {
+        memcpy(denoms, in, n * sizeof *denoms);
+        return count;
+    }
+    for (i = 0; i < n; i++, in += 3 * sizeof(uint32_t)) {
+        libdivide__serial_get(in, &denoms[i].magic, &denoms[i].more, &denoms[i].divisor, sizeof(uint32_t), swap);
+    }
+    return count;
+}
+
+const struct libdivide_u32_t *libdivide_u32_view(const void *buf, size_t size, size_t *n) {
+    int swap;
+    const size_t count = libdivide__serial_check(buf, size, LIBDIVIDE_SERIAL_U32, sizeof(uint32_t), LIBDIVIDE_32_SHIFT_MASK, LIBDIVIDE_U32_FLAGS, &swap);
+    if (count == LIBDIVIDE_SERIAL_INVALID || ! LIBDIVIDE_SERIAL_IN_PLACE(struct libdivide_u32_t, uint32_t, buf, swap)) return NULL;
+    *n = count;
+    return (const struct libdivide_u32_t *)((const unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE);
+}
+
+size_t libdivide_s32_serialize(const struct libdivide_s32_t *denoms, size_t n, void *buf, size_t size) {
+    unsigned char *out = (unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE;
+    const size_t total = libdivide__serial_header(buf, size, LIBDIVIDE_SERIAL_S32, sizeof(int32_t), n);
+    size_t i;
+    if (size < total) return total;
+    for (i = 0; i < n; i++, out += 3 * sizeof(int32_t)) {
+        libdivide__serial_put(out, &denoms[i].magic, denoms[i].more, &denoms[i].divisor, sizeof(int32_t));
+    }
+    return total;
+}
+
+size_t libdivide_s32_deserialize(const void *buf, size_t size, struct libdivide_s32_t *denoms, size_t n) {
+    const unsigned char *in = (const unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE;
+    int swap;
+    const size_t count = libdivide__serial_check(buf, size, LIBDIVIDE_SERIAL_S32, sizeof(int32_t), LIBDIVIDE_32_SHIFT_MASK, LIBDIVIDE_S32_FLAGS, &swap);
+    size_t i;
+    if (count == LIBDIVIDE_SERIAL_INVALID) return count;
+    if (n > count) n = count;
+    if (LIBDIVIDE_SERIAL_NATIVE(struct libdivide_s32_t, int32_t, swap)) {
+        memcpy(denoms, in, n * sizeof *denoms);
+        return count;
+    }
+    for (i = 0; i < n; i++, in += 3 * sizeof(int32_t)) {
+        libdivide__serial_get(in, &denoms[i].magic, &denoms[i].more, &denoms[i].divisor, sizeof(int32_t), swap);
+    }
+    return count;
+}
+
+const struct libdivide_s32_t *libdivide_s32_view(const void *buf, size_t size, size_t *n) {
+    int swap;
+    const size_t count = libdivide__serial_check(buf, size, LIBDIVIDE_SERIAL_S32, sizeof(int32_t), LIBDIVIDE_32_SHIFT_MASK, LIBDIVIDE_S32_FLAGS, &swap);
+    if (count == LIBDIVIDE_SERIAL_INVALID || ! LIBDIVIDE_SERIAL_IN_PLACE(struct libdivide_s32_t, int32_t, buf, swap)) return NULL;
+    *n = count;
+    return (const struct libdivide_s32_t *)((const unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE);
+}
+
+size_t libdivide_u64_serialize(const struct libdivide_u64_t *denoms, size_t n, void *buf, size_t size) {
+    unsigned char *out = (unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE;
+    const size_t total = libdivide__serial_header(buf, size, LIBDIVIDE_SERIAL_U64, sizeof(uint64_t), n);
+    size_t i;
+    if (size < total) return total;
+    for (i = 0; i < n; i++, out += 3 * sizeof(uint64_t)) {
+        libdivide__serial_put(out, &denoms[i].magic, denoms[i].more, &denoms[i].divisor, sizeof(uint64_t));
+    }
+    return total;
+}
+
+size_t libdivide_u64_deserialize(const void *buf, size_t size, struct libdivide_u64_t *denoms, size_t n) {
+    const unsigned char *in = (const unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE;
+    int swap;
+    const size_t count = libdivide__serial_check(buf, size, LIBDIVIDE_SERIAL_U64, sizeof(uint64_t), LIBDIVIDE_64_SHIFT_MASK, LIBDIVIDE_U64_FLAGS, &swap);
+    size_t i;
+    if (count == LIBDIVIDE_SERIAL_INVALID) return count;
+    if (n > count) n = count;
+    if (LIBDIVIDE_SERIAL_NATIVE(struct libdivide_u64_t, uint64_t, swap)) {
+        memcpy(denoms, in, n * sizeof *denoms);
+        return count;
+    }
+    for (i = 0; i < n; i++, in += 3 * sizeof(uint64_t)) {
+        libdivide__serial_get(in, &denoms[i].magic, &denoms[i].more, &denoms[i].divisor, sizeof(uint64_t), swap);
+    }
+    return count;
+}
+
+const struct libdivide_u64_t *libdivide_u64_view(const void *buf, size_t size, size_t *n) {
+    int swap;
+    const size_t count = libdivide__serial_check(buf, size, LIBDIVIDE_SERIAL_U64, sizeof(uint64_t), LIBDIVIDE_64_SHIFT_MASK, LIBDIVIDE_U64_FLAGS, &swap);
+    if (count == LIBDIVIDE_SERIAL_INVALID || ! LIBDIVIDE_SERIAL_IN_PLACE(struct libdivide_u64_t, uint64_t, buf, swap)) return NULL;
+    *n = count;
+    return (const struct libdivide_u64_t *)((const unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE);
+}
+
+size_t libdivide_s64_serialize(const struct libdivide_s64_t *denoms, size_t n, void *buf, size_t size) {
+    unsigned char *out = (unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE;
+    const size_t total = libdivide__serial_header(buf, size, LIBDIVIDE_SERIAL_S64, sizeof(int64_t), n);
+    size_t i;
+    if (size < total) return total;
+    for (i = 0; i < n; i++, out += 3 * sizeof(int64_t)) {
+        libdivide__serial_put(out, &denoms[i].magic, denoms[i].more, &denoms[i].divisor, sizeof(int64_t));
+    }
+    return total;
+}
+
+size_t libdivide_s64_deserialize(const void *buf, size_t size, struct libdivide_s64_t *denoms, size_t n) {
+    const unsigned char *in = (const unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE;
+    int swap;
+    const size_t count = libdivide__serial_check(buf, size, LIBDIVIDE_SERIAL_S64, sizeof(int64_t), LIBDIVIDE_64_SHIFT_MASK, LIBDIVIDE_S64_FLAGS, &swap);
+    size_t i;
+    if (count == LIBDIVIDE_SERIAL_INVALID) return count;
+    if (n > count) n = count;
+    if (LIBDIVIDE_SERIAL_NATIVE(struct libdivide_s64_t, int64_t, swap)) {
+        memcpy(denoms, in, n * sizeof *denoms);
+        return count;
+    }
+    for (i = 0; i < n; i++, in += 3 * sizeof(int64_t)) {
+        libdivide__serial_get(in, &denoms[i].magic, &denoms[i].more, &denoms[i].divisor, sizeof(int64_t), swap);
+    }
+    return count;
+}
+
+const struct libdivide_s64_t *libdivide_s64_view(const void *buf, size_t size, size_t *n) {
+    int swap;
+    const size_t count = libdivide__serial_check(buf, size, LIBDIVIDE_SERIAL_S64, sizeof(int64_t), LIBDIVIDE_64_SHIFT_MASK, LIBDIVIDE_S64_FLAGS, &swap);
+    if (count == LIBDIVIDE_SERIAL_INVALID || ! LIBDIVIDE_SERIAL_IN_PLACE(struct libdivide_s64_t, int64_t, buf, swap)) return NULL;
+    *n = count;
+    return (const struct libdivide_s64_t *)((const unsigned char *)buf + LIBDIVIDE_SERIAL_HEADER_SIZE);
+}
+
+/////////// ARRAYS
+
+/* The array functions pick the widest vector type available, and fall back to the scalar functions for the unaligned head and the tail.  LIBDIVIDE_*_WIDEST(x) pastes together the name of the widest vector type or function, e.g. LIBDIVIDE_U32_WIDEST(do_vector_alg1). */
+#if LIBDIVIDE_VEC512
+#define LIBDIVIDE_U8_WIDEST(x) libdivide_64u8_##x
+#define LIBDIVIDE_S8_WIDEST(x) libdivide_64s8_##x
+#define LIBDIVIDE_U32_WIDEST(x) libdivide_16u32_##x
+#define LIBDIVIDE_S32_WIDEST(x) libdivide_16s32_##x
+#define LIBDIVIDE_U64_WIDEST(x) libdivide_8u64_##x
+#define LIBDIVIDE_S64_WIDEST(x) libdivide_8s64_##x
+#elif LIBDIVIDE_VEC256
+#define LIBDIVIDE_U8_WIDEST(x) libdivide_32u8_##x
+#define LIBDIVIDE_S8_WIDEST(x) libdivide_32s8_##x
+#define LIBDIVIDE_U32_WIDEST(x) libdivide_8u32_##x
+#define LIBDIVIDE_S32_WIDEST(x) libdivide_8s32_##x
+#define LIBDIVIDE_U64_WIDEST(x) libdivide_4u64_##x
+#define LIBDIVIDE_S64_WIDEST(x) libdivide_4s64_##x
+#elif LIBDIVIDE_VEC128
+#define LIBDIVIDE_U8_WIDEST(x) libdivide_16u8_##x
+#define LIBDIVIDE_S8_WIDEST(x) libdivide_16s8_##x
+#define LIBDIVIDE_U32_WIDEST(x) libdivide_4u32_##x
+#define LIBDIVIDE_S32_WIDEST(x) libdivide_4s32_##x
+#define LIBDIVIDE_U64_WIDEST(x) libdivide_2u64_##x
+#define LIBDIVIDE_S64_WIDEST(x) libdivide_2s64_##x
+#else
+#define LIBDIVIDE_U8_WIDEST(x) x
+#define LIBDIVIDE_S8_WIDEST(x) x
+#define LIBDIVIDE_U32_WIDEST(x) x
+#define LIBDIVIDE_S32_WIDEST(x) x
+#define LIBDIVIDE_U64_WIDEST(x) x
+#define LIBDIVIDE_S64_WIDEST(x) x
+#endif
+
+#if LIBDIVIDE_VEC512 || LIBDIVIDE_USE_DISPATCH
+/* Like below, but AVX-512 can load and store part of a vector, so the unaligned head and the tail are done with one masked vector each, and there is no scalar code at all.  Masked off lanes are loaded as zero, which is safe to divide. */
+#define LIBDIVIDE_ARRAY_LOOP_MASKED(IntType, VecType, scalar_func, vector_func, numers, results, n, denom) do { \
+    const size_t lanes = sizeof(VecType) / sizeof(IntType); \
+    size_t i, head = (size_t)((0 - (uintptr_t)(results)) & (sizeof(VecType) - 1)) / sizeof(IntType), body; \
+    if (head > (n)) head = (n); \
+    body = head + (((n) - head) & ~(lanes - 1)); \
+    if (head > 0) { \
+        libdivide_mask_storeu_512((results), head, sizeof(IntType), vector_func(libdivide_maskz_loadu_512((numers), head, sizeof(IntType)), (denom))); \
+    } \
+    for (i = head; i < body; i += lanes) { \
+        _mm512_storeu_si512((void *)((results) + i), vector_func(_mm512_loadu_si512((const void *)((numers) + i)), (denom))); \
+    } \
+    if (body < (n)) { \
+        libdivide_mask_storeu_512((results) + body, (n) - body, sizeof(IntType), vector_func(libdivide_maskz_loadu_512((numers) + body, (n) - body, sizeof(IntType)), (denom))); \
+    } \
+} while (0)
+#endif
+
+#if LIBDIVIDE_VEC128 || LIBDIVIDE_VEC256
+/* Scalar divide up to the first results element that is aligned to the vector size, so that the stores don't straddle cache lines, then do whole vectors, then mop up the tail.  The loads go through memcpy because the numerators need not be aligned the same way as the results; compilers turn it into a plain unaligned load. */
+#define LIBDIVIDE_ARRAY_LOOP_VECTOR(IntType, VecType, scalar_func, vector_func, numers, results, n, denom) do { \
+    const size_t lanes = sizeof(VecType) / sizeof(IntType); \
+    size_t i, head = (size_t)((0 - (uintptr_t)(results)) & (sizeof(VecType) - 1)) / sizeof(IntType), body; \
+    if (head > (n)) head = (n); \
+    body = head + (((n) - head) & ~(lanes - 1)); \
+    for (i = 0; i < head; i++) { \
+        (results)[i] = scalar_func((numers)[i], (denom)); \
+    } \
+    for (; i < body; i += lanes) { \
+        VecType v; \
+        memcpy(&v, (numers) + i, sizeof v); \
+        v = vector_func(v, (denom)); \
+        memcpy((results) + i, &v, sizeof v); \
+    } \
+    for (; i < (n); i++) { \
+        (results)[i] = scalar_func((numers)[i], (denom)); \
+    } \
+} while (0)
+#endif
+
+#define LIBDIVIDE_ARRAY_LOOP_SCALAR(IntType, VecType, scalar_func, vector_func, numers, results, n, denom) do { \
+    size_t i; \
+    for (i = 0; i < (n); i++) { \
+        (results)[i] = scalar_func((numers)[i], (denom)); \
+    } \
+} while (0)
+
+#if LIBDIVIDE_VEC512
+#define LIBDIVIDE_ARRAY_LOOP LIBDIVIDE_ARRAY_LOOP_MASKED
+#elif LIBDIVIDE_VEC128 || LIBDIVIDE_VEC256
+#define LIBDIVIDE_ARRAY_LOOP LIBDIVIDE_ARRAY_LOOP_VECTOR
+#else
+#define LIBDIVIDE_ARRAY_LOOP LIBDIVIDE_ARRAY_LOOP_SCALAR
+#endif
+
+/* The branchfree dividers only have x86 vectors */
+#if LIBDIVIDE_USE_SSE2
+#define LIBDIVIDE_BRANCHFREE_ARRAY_LOOP LIBDIVIDE_ARRAY_LOOP
+#else
+#define LIBDIVIDE_BRANCHFREE_ARRAY_LOOP LIBDIVIDE_ARRAY_LOOP_SCALAR
+#endif
+
+/* The indexed arrays read their divisors from table, by index with scalar_func, and the vectors load their indices alongside the numerators, with index_load: a whole vector of them for 32 bit numerators, and half a vector for 64 bit ones.  There is no aligned head here, as the gathers cost far more than a split store. */
+#if LIBDIVIDE_USE_SSE2
+#if LIBDIVIDE_VEC512
+#define LIBDIVIDE_GATHER_LOAD_INDEX32(p) _mm512_loadu_si512((const void *)(p))
+#define LIBDIVIDE_GATHER_LOAD_INDEX64(p) _mm256_loadu_si256((const __m256i *)(p))
+#elif LIBDIVIDE_VEC256
+#define LIBDIVIDE_GATHER_LOAD_INDEX32(p) _mm256_loadu_si256((const __m256i *)(p))
+#define LIBDIVIDE_GATHER_LOAD_INDEX64(p) _mm_loadu_si128((const __m128i *)(p))
+#else
+#define LIBDIVIDE_GATHER_LOAD_INDEX32(p) _mm_loadu_si128((const __m128i *)(p))
+#define LIBDIVIDE_GATHER_LOAD_INDEX64(p) _mm_loadl_epi64((const __m128i *)(p))
+#endif
+#define LIBDIVIDE_GATHER_ARRAY_LOOP(IntType, VecType, index_load, scalar_func, vector_func, numers, indices, results, n, table) do { \
+    const size_t lanes = sizeof(VecType) / sizeof(IntType); \
+    const size_t body = (n) & ~(lanes - 1); \
+    size_t i; \
+    for (i = 0; i < body; i += lanes) { \
+        VecType v; \
+        memcpy(&v, (numers) + i, sizeof v); \
+        v = vector_func(v, index_load((indices) + i), (table)); \
+        memcpy((results) + i, &v, sizeof v); \
+    } \
+    for (; i < (n); i++) { \
+        (results)[i] = scalar_func((numers)[i], (indices)[i], (table)); \
+    } \
+} while (0)
+#else
+#define LIBDIVIDE_GATHER_ARRAY_LOOP(IntType, VecType, index_load, scalar_func, vector_func, numers, indices, results, n, table) do { \
+    size_t i; \
+    for (i = 0; i < (n); i++) { \
+        (results)[i] = scalar_func((numers)[i], (indices)[i], (table)); \
+    } \
+} while (0)
+#endif
+
+/* The bodies of the array functions: pick the algorithm once, then run LOOP with the scalar and the VEC vector functions for it, where VEC is one of the name pasting macros above. */
+#define LIBDIVIDE_U8_ARRAY_SWITCH(LOOP, VEC) \
+    switch (libdivide_u8_get_algorithm(denom)) { \
+    case 0:  LOOP(uint8_t, VEC(t), libdivide_u8_do_alg0, VEC(do_vector_alg0), numers, results, n, denom); break; \
+    case 1:  LOOP(uint8_t, VEC(t), libdivide_u8_do_alg1, VEC(do_vector_alg1), numers, results, n, denom); break; \
+    default: LOOP(uint8_t, VEC(t), libdivide_u8_do_alg2, VEC(do_vector_alg2), numers, results, n, denom); break; \
+    }
+
+#define LIBDIVIDE_S8_ARRAY_SWITCH(LOOP, VEC) \
+    switch (libdivide_s8_get_algorithm(denom)) { \
+    case 0:  LOOP(int8_t, VEC(t), libdivide_s8_do_alg0, VEC(do_vector_alg0), numers, results, n, denom); break; \
+    case 1:  LOOP(int8_t, VEC(t), libdivide_s8_do_alg1, VEC(do_vector_alg1), numers, results, n, denom); break; \
+    case 2:  LOOP(int8_t, VEC(t), libdivide_s8_do_alg2, VEC(do_vector_alg2), numers, results, n, denom); break; \
+    case 3:  LOOP(int8_t, VEC(t), libdivide_s8_do_alg3, VEC(do_vector_alg3), numers, results, n, denom); break; \
+    default: LOOP(int8_t, VEC(t), libdivide_s8_do_alg4, VEC(do_vector_alg4), numers, results, n, denom); break; \
+    }
+
+#define LIBDIVIDE_U32_ARRAY_SWITCH(LOOP, VEC) \
+    switch (libdivide_u32_get_algorithm(denom)) { \
+    case 0:  LOOP(uint32_t, VEC(t), libdivide_u32_do_alg0, VEC(do_vector_alg0), numers, results, n, denom); break; \
+    case 1:  LOOP(uint32_t, VEC(t), libdivide_u32_do_alg1, VEC(do_vector_alg1), numers, results, n, denom); break; \
+    default: LOOP(uint32_t, VEC(t), libdivide_u32_do_alg2, VEC(do_vector_alg2), numers, results, n, denom); break; \
+    }
+
+#define LIBDIVIDE_S32_ARRAY_SWITCH(LOOP, VEC) \
+    switch (libdivide_s32_get_algorithm(denom)) { \
+    case 0:  LOOP(int32_t, VEC(t), libdivide_s32_do_alg0, VEC(do_vector_alg0), numers, results, n, denom); break; \
+    case 1:  LOOP(int32_t, VEC(t), libdivide_s32_do_alg1, VEC(do_vector_alg1), numers, results, n, denom); break; \
+    case 2:  LOOP(int32_t, VEC(t), libdivide_s32_do_alg2, VEC(do_vector_alg2), numers, results, n, denom); break; \
+    case 3:  LOOP(int32_t, VEC(t), libdivide_s32_do_alg3, VEC(do_vector_alg3), numers, results, n, denom); break; \
+    default: LOOP(int32_t, VEC(t), libdivide_s32_do_alg4, VEC(do_vector_alg4), numers, results, n, denom); break; \
+    }
+
+#define LIBDIVIDE_U64_ARRAY_SWITCH(LOOP, VEC) \
+    switch (libdivide_u64_get_algorithm(denom)) { \
+    case 0:  LOOP(uint64_t, VEC(t), libdivide_u64_do_alg0, VEC(do_vector_alg0), numers, results, n, denom); break; \
+    case 1:  LOOP(uint64_t, VEC(t), libdivide_u64_do_alg1, VEC(do_vector_alg1), numers, results, n, denom); break; \
+    default: LOOP(uint64_t, VEC(t), libdivide_u64_do_alg2, VEC(do_vector_alg2), numers, results, n, denom); break; \
+    }
+
+#define LIBDIVIDE_S64_ARRAY_SWITCH(LOOP, VEC) \
+    switch (libdivide_s64_get_algorithm(denom)) { \
+    case 0:  LOOP(int64_t, VEC(t), libdivide_s64_do_alg0, VEC(do_vector_alg0), numers, results, n, denom); break; \
+    case 1:  LOOP(int64_t, VEC(t), libdivide_s64_do_alg1, VEC(do_vector_alg1), numers, results, n, denom); break; \
+    case 2:  LOOP(int64_t, VEC(t), libdivide_s64_do_alg2, VEC(do_vector_alg2), numers, results, n, denom); break; \
+    case 3:  LOOP(int64_t, VEC(t), libdivide_s64_do_alg3, VEC(do_vector_alg3), numers, results, n, denom); break; \
+    default: LOOP(int64_t, VEC(t), libdivide_s64_do_alg4, VEC(do_vector_alg4), numers, results, n, denom); break; \
+    }
+
+/* The scalar tails of the indexed arrays */
+static inline uint32_t libdivide_u32_branchfree_do_indexed(uint32_t numer, uint32_t index, const struct libdivide_u32_branchfree_t *table) {
+    return libdivide_u32_branchfree_do(numer, &table[index]);
+}
+
+static inline int32_t libdivide_s32_branchfree_do_indexed(int32_t numer, uint32_t index, const struct libdivide_s32_branchfree_t *table) {
+    return libdivide_s32_branchfree_do(numer, &table[index]);
+}
+
+static inline uint64_t libdivide_u64_branchfree_do_indexed(uint64_t numer, uint32_t index, const struct libdivide_u64_branchfree_t *table) {
+    return libdivide_u64_branchfree_do(numer, &table[index]);
+}
+
+static inline int64_t libdivide_s64_branchfree_do_indexed(int64_t numer, uint32_t index, const struct libdivide_s64_branchfree_t *table) {
+    return libdivide_s64_branchfree_do(numer, &table[index]);
+}
+
+#if LIBDIVIDE_USE_DISPATCH
+#define LIBDIVIDE_AVX2_U8(x) libdivide_32u8_##x
+#define LIBDIVIDE_AVX2_S8(x) libdivide_32s8_##x
+#define LIBDIVIDE_AVX2_U32(x) libdivide_8u32_##x
+#define LIBDIVIDE_AVX2_S32(x) libdivide_8s32_##x
+#define LIBDIVIDE_AVX2_U64(x) libdivide_4u64_##x
+#define LIBDIVIDE_AVX2_S64(x) libdivide_4s64_##x
+#define LIBDIVIDE_AVX512_U8(x) libdivide_64u8_##x
+#define LIBDIVIDE_AVX512_S8(x) libdivide_64s8_##x
+#define LIBDIVIDE_AVX512_U32(x) libdivide_16u32_##x
+#define LIBDIVIDE_AVX512_S32(x) libdivide_16s32_##x
+#define LIBDIVIDE_AVX512_U64(x) libdivide_8u64_##x
+#define LIBDIVIDE_AVX512_S64(x) libdivide_8s64_##x
+/* The index loads of the gathers for each tier, as LIBDIVIDE_GATHER_LOAD_INDEX32 and 64 are for the compile time one */
+#define LIBDIVIDE_AVX2_INDEX32(p) _mm256_loadu_si256((const __m256i *)(p))
+#define LIBDIVIDE_AVX2_INDEX64(p) _mm_loadu_si128((const __m128i *)(p))
+#define LIBDIVIDE_AVX512_INDEX32(p) _mm512_loadu_si512((const void *)(p))
+#define LIBDIVIDE_AVX512_INDEX64(p) _mm256_loadu_si256((const __m256i *)(p))
+
+/* One copy of each array function per tier.  The SSE2 ones use the 128 bit vectors, which are all the compiler is allowed to assume. */
+static void libdivide_u8_do_array_sse2(const uint8_t *numers, uint8_t *results, size_t n, const struct libdivide_u8_t *denom) {
+    LIBDIVIDE_U8_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_U8_WIDEST)
+}
+
+static void libdivide_s8_do_array_sse2(const int8_t *numers, int8_t *results, size_t n, const struct libdivide_s8_t *denom) {
+    LIBDIVIDE_S8_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_S8_WIDEST)
+}
+
+static void libdivide_u32_do_array_sse2(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    LIBDIVIDE_U32_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_U32_WIDEST)
+}
+
+static void libdivide_s32_do_array_sse2(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    LIBDIVIDE_S32_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_S32_WIDEST)
+}
+
+static void libdivide_u64_do_array_sse2(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    LIBDIVIDE_U64_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_U64_WIDEST)
+}
+
+static void libdivide_s64_do_array_sse2(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    LIBDIVIDE_S64_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_S64_WIDEST)
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u8_do_array_avx2(const uint8_t *numers, uint8_t *results, size_t n, const struct libdivide_u8_t *denom) {
+    LIBDIVIDE_U8_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_AVX2_U8)
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s8_do_array_avx2(const int8_t *numers, int8_t *results, size_t n, const struct libdivide_s8_t *denom) {
+    LIBDIVIDE_S8_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_AVX2_S8)
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u32_do_array_avx2(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    LIBDIVIDE_U32_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_AVX2_U32)
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s32_do_array_avx2(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    LIBDIVIDE_S32_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_AVX2_S32)
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u64_do_array_avx2(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    LIBDIVIDE_U64_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_AVX2_U64)
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s64_do_array_avx2(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    LIBDIVIDE_S64_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_VECTOR, LIBDIVIDE_AVX2_S64)
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u8_do_array_avx512(const uint8_t *numers, uint8_t *results, size_t n, const struct libdivide_u8_t *denom) {
+    LIBDIVIDE_U8_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_MASKED, LIBDIVIDE_AVX512_U8)
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s8_do_array_avx512(const int8_t *numers, int8_t *results, size_t n, const struct libdivide_s8_t *denom) {
+    LIBDIVIDE_S8_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_MASKED, LIBDIVIDE_AVX512_S8)
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u32_do_array_avx512(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    LIBDIVIDE_U32_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_MASKED, LIBDIVIDE_AVX512_U32)
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s32_do_array_avx512(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    LIBDIVIDE_S32_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_MASKED, LIBDIVIDE_AVX512_S32)
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u64_do_array_avx512(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    LIBDIVIDE_U64_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_MASKED, LIBDIVIDE_AVX512_U64)
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s64_do_array_avx512(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    LIBDIVIDE_S64_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP_MASKED, LIBDIVIDE_AVX512_S64)
+}
+
+static void libdivide_u32_do_ceil_array_sse2(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint32_t, LIBDIVIDE_U32_WIDEST(t), libdivide_u32_do_ceil, LIBDIVIDE_U32_WIDEST(do_ceil_vector), numers, results, n, denom);
+}
+
+static void libdivide_s32_do_ceil_array_sse2(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int32_t, LIBDIVIDE_S32_WIDEST(t), libdivide_s32_do_ceil, LIBDIVIDE_S32_WIDEST(do_ceil_vector), numers, results, n, denom);
+}
+
+static void libdivide_u64_do_ceil_array_sse2(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint64_t, LIBDIVIDE_U64_WIDEST(t), libdivide_u64_do_ceil, LIBDIVIDE_U64_WIDEST(do_ceil_vector), numers, results, n, denom);
+}
+
+static void libdivide_s64_do_ceil_array_sse2(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int64_t, LIBDIVIDE_S64_WIDEST(t), libdivide_s64_do_ceil, LIBDIVIDE_S64_WIDEST(do_ceil_vector), numers, results, n, denom);
+}
+
+static void libdivide_u32_do_round_array_sse2(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint32_t, LIBDIVIDE_U32_WIDEST(t), libdivide_u32_do_round, LIBDIVIDE_U32_WIDEST(do_round_vector), numers, results, n, denom);
+}
+
+static void libdivide_s32_do_round_array_sse2(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int32_t, LIBDIVIDE_S32_WIDEST(t), libdivide_s32_do_round, LIBDIVIDE_S32_WIDEST(do_round_vector), numers, results, n, denom);
+}
+
+static void libdivide_u64_do_round_array_sse2(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint64_t, LIBDIVIDE_U64_WIDEST(t), libdivide_u64_do_round, LIBDIVIDE_U64_WIDEST(do_round_vector), numers, results, n, denom);
+}
+
+static void libdivide_s64_do_round_array_sse2(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int64_t, LIBDIVIDE_S64_WIDEST(t), libdivide_s64_do_round, LIBDIVIDE_S64_WIDEST(do_round_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u32_do_ceil_array_avx2(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint32_t, LIBDIVIDE_AVX2_U32(t), libdivide_u32_do_ceil, LIBDIVIDE_AVX2_U32(do_ceil_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s32_do_ceil_array_avx2(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int32_t, LIBDIVIDE_AVX2_S32(t), libdivide_s32_do_ceil, LIBDIVIDE_AVX2_S32(do_ceil_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u64_do_ceil_array_avx2(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint64_t, LIBDIVIDE_AVX2_U64(t), libdivide_u64_do_ceil, LIBDIVIDE_AVX2_U64(do_ceil_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s64_do_ceil_array_avx2(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int64_t, LIBDIVIDE_AVX2_S64(t), libdivide_s64_do_ceil, LIBDIVIDE_AVX2_S64(do_ceil_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u32_do_round_array_avx2(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint32_t, LIBDIVIDE_AVX2_U32(t), libdivide_u32_do_round, LIBDIVIDE_AVX2_U32(do_round_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s32_do_round_array_avx2(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int32_t, LIBDIVIDE_AVX2_S32(t), libdivide_s32_do_round, LIBDIVIDE_AVX2_S32(do_round_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u64_do_round_array_avx2(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint64_t, LIBDIVIDE_AVX2_U64(t), libdivide_u64_do_round, LIBDIVIDE_AVX2_U64(do_round_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s64_do_round_array_avx2(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int64_t, LIBDIVIDE_AVX2_S64(t), libdivide_s64_do_round, LIBDIVIDE_AVX2_S64(do_round_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u32_do_ceil_array_avx512(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(uint32_t, LIBDIVIDE_AVX512_U32(t), libdivide_u32_do_ceil, LIBDIVIDE_AVX512_U32(do_ceil_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s32_do_ceil_array_avx512(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(int32_t, LIBDIVIDE_AVX512_S32(t), libdivide_s32_do_ceil, LIBDIVIDE_AVX512_S32(do_ceil_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u64_do_ceil_array_avx512(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(uint64_t, LIBDIVIDE_AVX512_U64(t), libdivide_u64_do_ceil, LIBDIVIDE_AVX512_U64(do_ceil_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s64_do_ceil_array_avx512(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(int64_t, LIBDIVIDE_AVX512_S64(t), libdivide_s64_do_ceil, LIBDIVIDE_AVX512_S64(do_ceil_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u32_do_round_array_avx512(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(uint32_t, LIBDIVIDE_AVX512_U32(t), libdivide_u32_do_round, LIBDIVIDE_AVX512_U32(do_round_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s32_do_round_array_avx512(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(int32_t, LIBDIVIDE_AVX512_S32(t), libdivide_s32_do_round, LIBDIVIDE_AVX512_S32(do_round_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u64_do_round_array_avx512(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(uint64_t, LIBDIVIDE_AVX512_U64(t), libdivide_u64_do_round, LIBDIVIDE_AVX512_U64(do_round_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s64_do_round_array_avx512(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(int64_t, LIBDIVIDE_AVX512_S64(t), libdivide_s64_do_round, LIBDIVIDE_AVX512_S64(do_round_vector), numers, results, n, denom);
+}
+
+static void libdivide_u32_branchfree_do_array_sse2(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint32_t, LIBDIVIDE_U32_WIDEST(t), libdivide_u32_branchfree_do, LIBDIVIDE_U32_WIDEST(branchfree_do_vector), numers, results, n, denom);
+}
+
+static void libdivide_s32_branchfree_do_array_sse2(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int32_t, LIBDIVIDE_S32_WIDEST(t), libdivide_s32_branchfree_do, LIBDIVIDE_S32_WIDEST(branchfree_do_vector), numers, results, n, denom);
+}
+
+static void libdivide_u64_branchfree_do_array_sse2(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint64_t, LIBDIVIDE_U64_WIDEST(t), libdivide_u64_branchfree_do, LIBDIVIDE_U64_WIDEST(branchfree_do_vector), numers, results, n, denom);
+}
+
+static void libdivide_s64_branchfree_do_array_sse2(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int64_t, LIBDIVIDE_S64_WIDEST(t), libdivide_s64_branchfree_do, LIBDIVIDE_S64_WIDEST(branchfree_do_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u32_branchfree_do_array_avx2(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint32_t, LIBDIVIDE_AVX2_U32(t), libdivide_u32_branchfree_do, LIBDIVIDE_AVX2_U32(branchfree_do_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s32_branchfree_do_array_avx2(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int32_t, LIBDIVIDE_AVX2_S32(t), libdivide_s32_branchfree_do, LIBDIVIDE_AVX2_S32(branchfree_do_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u64_branchfree_do_array_avx2(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(uint64_t, LIBDIVIDE_AVX2_U64(t), libdivide_u64_branchfree_do, LIBDIVIDE_AVX2_U64(branchfree_do_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s64_branchfree_do_array_avx2(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_VECTOR(int64_t, LIBDIVIDE_AVX2_S64(t), libdivide_s64_branchfree_do, LIBDIVIDE_AVX2_S64(branchfree_do_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u32_branchfree_do_array_avx512(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(uint32_t, LIBDIVIDE_AVX512_U32(t), libdivide_u32_branchfree_do, LIBDIVIDE_AVX512_U32(branchfree_do_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s32_branchfree_do_array_avx512(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(int32_t, LIBDIVIDE_AVX512_S32(t), libdivide_s32_branchfree_do, LIBDIVIDE_AVX512_S32(branchfree_do_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u64_branchfree_do_array_avx512(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(uint64_t, LIBDIVIDE_AVX512_U64(t), libdivide_u64_branchfree_do, LIBDIVIDE_AVX512_U64(branchfree_do_vector), numers, results, n, denom);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s64_branchfree_do_array_avx512(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *denom) {
+    LIBDIVIDE_ARRAY_LOOP_MASKED(int64_t, LIBDIVIDE_AVX512_S64(t), libdivide_s64_branchfree_do, LIBDIVIDE_AVX512_S64(branchfree_do_vector), numers, results, n, denom);
+}
+
+static void libdivide_u32_branchfree_do_array_indexed_sse2(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint32_t, LIBDIVIDE_U32_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX32, libdivide_u32_branchfree_do_indexed, LIBDIVIDE_U32_WIDEST(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static void libdivide_s32_branchfree_do_array_indexed_sse2(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int32_t, LIBDIVIDE_S32_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX32, libdivide_s32_branchfree_do_indexed, LIBDIVIDE_S32_WIDEST(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static void libdivide_u64_branchfree_do_array_indexed_sse2(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint64_t, LIBDIVIDE_U64_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX64, libdivide_u64_branchfree_do_indexed, LIBDIVIDE_U64_WIDEST(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static void libdivide_s64_branchfree_do_array_indexed_sse2(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int64_t, LIBDIVIDE_S64_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX64, libdivide_s64_branchfree_do_indexed, LIBDIVIDE_S64_WIDEST(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u32_branchfree_do_array_indexed_avx2(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint32_t, LIBDIVIDE_AVX2_U32(t), LIBDIVIDE_AVX2_INDEX32, libdivide_u32_branchfree_do_indexed, LIBDIVIDE_AVX2_U32(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s32_branchfree_do_array_indexed_avx2(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int32_t, LIBDIVIDE_AVX2_S32(t), LIBDIVIDE_AVX2_INDEX32, libdivide_s32_branchfree_do_indexed, LIBDIVIDE_AVX2_S32(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u64_branchfree_do_array_indexed_avx2(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint64_t, LIBDIVIDE_AVX2_U64(t), LIBDIVIDE_AVX2_INDEX64, libdivide_u64_branchfree_do_indexed, LIBDIVIDE_AVX2_U64(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s64_branchfree_do_array_indexed_avx2(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int64_t, LIBDIVIDE_AVX2_S64(t), LIBDIVIDE_AVX2_INDEX64, libdivide_s64_branchfree_do_indexed, LIBDIVIDE_AVX2_S64(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u32_branchfree_do_array_indexed_avx512(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint32_t, LIBDIVIDE_AVX512_U32(t), LIBDIVIDE_AVX512_INDEX32, libdivide_u32_branchfree_do_indexed, LIBDIVIDE_AVX512_U32(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s32_branchfree_do_array_indexed_avx512(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int32_t, LIBDIVIDE_AVX512_S32(t), LIBDIVIDE_AVX512_INDEX32, libdivide_s32_branchfree_do_indexed, LIBDIVIDE_AVX512_S32(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u64_branchfree_do_array_indexed_avx512(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint64_t, LIBDIVIDE_AVX512_U64(t), LIBDIVIDE_AVX512_INDEX64, libdivide_u64_branchfree_do_indexed, LIBDIVIDE_AVX512_U64(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s64_branchfree_do_array_indexed_avx512(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *table) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int64_t, LIBDIVIDE_AVX512_S64(t), LIBDIVIDE_AVX512_INDEX64, libdivide_s64_branchfree_do_indexed, LIBDIVIDE_AVX512_S64(branchfree_do_gather), numers, indices, results, n, table);
+}
+
+static void libdivide_u32_array_do_indexed_sse2(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint32_t, LIBDIVIDE_U32_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX32, libdivide_u32_array_do, LIBDIVIDE_U32_WIDEST(array_do_gather), numers, indices, results, n, array);
+}
+
+static void libdivide_s32_array_do_indexed_sse2(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int32_t, LIBDIVIDE_S32_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX32, libdivide_s32_array_do, LIBDIVIDE_S32_WIDEST(array_do_gather), numers, indices, results, n, array);
+}
+
+static void libdivide_u64_array_do_indexed_sse2(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint64_t, LIBDIVIDE_U64_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX64, libdivide_u64_array_do, LIBDIVIDE_U64_WIDEST(array_do_gather), numers, indices, results, n, array);
+}
+
+static void libdivide_s64_array_do_indexed_sse2(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int64_t, LIBDIVIDE_S64_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX64, libdivide_s64_array_do, LIBDIVIDE_S64_WIDEST(array_do_gather), numers, indices, results, n, array);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u32_array_do_indexed_avx2(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint32_t, LIBDIVIDE_AVX2_U32(t), LIBDIVIDE_AVX2_INDEX32, libdivide_u32_array_do, LIBDIVIDE_AVX2_U32(array_do_gather), numers, indices, results, n, array);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s32_array_do_indexed_avx2(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int32_t, LIBDIVIDE_AVX2_S32(t), LIBDIVIDE_AVX2_INDEX32, libdivide_s32_array_do, LIBDIVIDE_AVX2_S32(array_do_gather), numers, indices, results, n, array);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_u64_array_do_indexed_avx2(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint64_t, LIBDIVIDE_AVX2_U64(t), LIBDIVIDE_AVX2_INDEX64, libdivide_u64_array_do, LIBDIVIDE_AVX2_U64(array_do_gather), numers, indices, results, n, array);
+}
+
+static LIBDIVIDE_TARGET_AVX2 void libdivide_s64_array_do_indexed_avx2(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int64_t, LIBDIVIDE_AVX2_S64(t), LIBDIVIDE_AVX2_INDEX64, libdivide_s64_array_do, LIBDIVIDE_AVX2_S64(array_do_gather), numers, indices, results, n, array);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u32_array_do_indexed_avx512(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint32_t, LIBDIVIDE_AVX512_U32(t), LIBDIVIDE_AVX512_INDEX32, libdivide_u32_array_do, LIBDIVIDE_AVX512_U32(array_do_gather), numers, indices, results, n, array);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s32_array_do_indexed_avx512(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int32_t, LIBDIVIDE_AVX512_S32(t), LIBDIVIDE_AVX512_INDEX32, libdivide_s32_array_do, LIBDIVIDE_AVX512_S32(array_do_gather), numers, indices, results, n, array);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_u64_array_do_indexed_avx512(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint64_t, LIBDIVIDE_AVX512_U64(t), LIBDIVIDE_AVX512_INDEX64, libdivide_u64_array_do, LIBDIVIDE_AVX512_U64(array_do_gather), numers, indices, results, n, array);
+}
+
+static LIBDIVIDE_TARGET_AVX512 void libdivide_s64_array_do_indexed_avx512(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_array_t *array) {
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int64_t, LIBDIVIDE_AVX512_S64(t), LIBDIVIDE_AVX512_INDEX64, libdivide_s64_array_do, LIBDIVIDE_AVX512_S64(array_do_gather), numers, indices, results, n, array);
+}
+
+/* The array functions call through these pointers.  They start out pointing at functions that bind them and then forward the call, so the first call works even if it comes from another static constructor before ours has run.  Racing threads all store the same values, so there is no lock, but the pointers are stored and loaded atomically, and libdivide_isa is stored after them with release order, so a thread that sees the tier set also sees the pointers for it. */
+#define LIBDIVIDE_DISPATCH_BIND(name, func) __atomic_store_n(&libdivide_##name##_ptr, &func, __ATOMIC_RELEASE)
+#define LIBDIVIDE_DISPATCH_CALL(name) __atomic_load_n(&libdivide_##name##_ptr, __ATOMIC_ACQUIRE)
+
+static void libdivide_u8_do_array_first(const uint8_t *numers, uint8_t *results, size_t n, const struct libdivide_u8_t *denom);
+static void libdivide_s8_do_array_first(const int8_t *numers, int8_t *results, size_t n, const struct libdivide_s8_t *denom);
+static void libdivide_u32_do_array_first(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom);
+static void libdivide_s32_do_array_first(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom);
+static void libdivide_u64_do_array_first(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom);
+static void libdivide_s64_do_array_first(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom);
+static void libdivide_u64_narrow_do_array_first(const uint64_t *numers_hi, const uint64_t *numers_lo, uint64_t *quotients, uint64_t *remainders, size_t n, const struct libdivide_u64_narrow_t *denom);
+static void libdivide_u32_gen_array_soa_first(const uint32_t *d, uint32_t *magics, uint8_t *mores, size_t n);
+static void libdivide_s32_gen_array_soa_first(const int32_t *d, int32_t *magics, uint8_t *mores, size_t n);
+static void libdivide_u32_fastmod_array_first(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_fastmod_t *denom);
+static void libdivide_u64_fastmod_array_first(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_fastmod_t *denom);
+static void libdivide_u32_do_ceil_array_first(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom);
+static void libdivide_s32_do_ceil_array_first(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom);
+static void libdivide_u64_do_ceil_array_first(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom);
+static void libdivide_s64_do_ceil_array_first(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom);
+static void libdivide_u32_do_round_array_first(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom);
+static void libdivide_s32_do_round_array_first(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom);
+static void libdivide_u64_do_round_array_first(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom);
+static void libdivide_s64_do_round_array_first(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom);
+static void libdivide_u32_branchfree_do_array_first(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *denom);
+static void libdivide_s32_branchfree_do_array_first(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *denom);
+static void libdivide_u64_branchfree_do_array_first(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *denom);
+static void libdivide_s64_branchfree_do_array_first(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *denom);
+static void libdivide_u32_branchfree_do_array_indexed_first(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *table);
+static void libdivide_s32_branchfree_do_array_indexed_first(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *table);
+static void libdivide_u64_branchfree_do_array_indexed_first(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *table);
+static void libdivide_s64_branchfree_do_array_indexed_first(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *table);
+static void libdivide_u32_array_do_indexed_first(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_array_t *array);
+static void libdivide_s32_array_do_indexed_first(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_array_t *array);
+static void libdivide_u64_array_do_indexed_first(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_array_t *array);
+static void libdivide_s64_array_do_indexed_first(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_array_t *array);
+
+static void (*libdivide_u8_do_array_ptr)(const uint8_t *, uint8_t *, size_t, const struct libdivide_u8_t *) = libdivide_u8_do_array_first;
+static void (*libdivide_s8_do_array_ptr)(const int8_t *, int8_t *, size_t, const struct libdivide_s8_t *) = libdivide_s8_do_array_first;
+static void (*libdivide_u32_do_array_ptr)(const uint32_t *, uint32_t *, size_t, const struct libdivide_u32_t *) = libdivide_u32_do_array_first;
+static void (*libdivide_s32_do_array_ptr)(const int32_t *, int32_t *, size_t, const struct libdivide_s32_t *) = libdivide_s32_do_array_first;
+static void (*libdivide_u64_do_array_ptr)(const uint64_t *, uint64_t *, size_t, const struct libdivide_u64_t *) = libdivide_u64_do_array_first;
+static void (*libdivide_s64_do_array_ptr)(const int64_t *, int64_t *, size_t, const struct libdivide_s64_t *) = libdivide_s64_do_array_first;
+static void (*libdivide_u64_narrow_do_array_ptr)(const uint64_t *, const uint64_t *, uint64_t *, uint64_t *, size_t, const struct libdivide_u64_narrow_t *) = libdivide_u64_narrow_do_array_first;
+static void (*libdivide_u32_gen_array_soa_ptr)(const uint32_t *, uint32_t *, uint8_t *, size_t) = libdivide_u32_gen_array_soa_first;
+static void (*libdivide_s32_gen_array_soa_ptr)(const int32_t *, int32_t *, uint8_t *, size_t) = libdivide_s32_gen_array_soa_first;
+static void (*libdivide_u32_fastmod_array_ptr)(const uint32_t *, uint32_t *, size_t, const struct libdivide_u32_fastmod_t *) = libdivide_u32_fastmod_array_first;
+static void (*libdivide_u64_fastmod_array_ptr)(const uint64_t *, uint64_t *, size_t, const struct libdivide_u64_fastmod_t *) = libdivide_u64_fastmod_array_first;
+static void (*libdivide_u32_do_ceil_array_ptr)(const uint32_t *, uint32_t *, size_t, const struct libdivide_u32_t *) = libdivide_u32_do_ceil_array_first;
+static void (*libdivide_s32_do_ceil_array_ptr)(const int32_t *, int32_t *, size_t, const struct libdivide_s32_t *) = libdivide_s32_do_ceil_array_first;
+static void (*libdivide_u64_do_ceil_array_ptr)(const uint64_t *, uint64_t *, size_t, const struct libdivide_u64_t *) = libdivide_u64_do_ceil_array_first;
+static void (*libdivide_s64_do_ceil_array_ptr)(const int64_t *, int64_t *, size_t, const struct libdivide_s64_t *) = libdivide_s64_do_ceil_array_first;
+static void (*libdivide_u32_do_round_array_ptr)(const uint32_t *, uint32_t *, size_t, const struct libdivide_u32_t *) = libdivide_u32_do_round_array_first;
+static void (*libdivide_s32_do_round_array_ptr)(const int32_t *, int32_t *, size_t, const struct libdivide_s32_t *) = libdivide_s32_do_round_array_first;
+static void (*libdivide_u64_do_round_array_ptr)(const uint64_t *, uint64_t *, size_t, const struct libdivide_u64_t *) = libdivide_u64_do_round_array_first;
+static void (*libdivide_s64_do_round_array_ptr)(const int64_t *, int64_t *, size_t, const struct libdivide_s64_t *) = libdivide_s64_do_round_array_first;
+static void (*libdivide_u32_branchfree_do_array_ptr)(const uint32_t *, uint32_t *, size_t, const struct libdivide_u32_branchfree_t *) = libdivide_u32_branchfree_do_array_first;
+static void (*libdivide_s32_branchfree_do_array_ptr)(const int32_t *, int32_t *, size_t, const struct libdivide_s32_branchfree_t *) = libdivide_s32_branchfree_do_array_first;
+static void (*libdivide_u64_branchfree_do_array_ptr)(const uint64_t *, uint64_t *, size_t, const struct libdivide_u64_branchfree_t *) = libdivide_u64_branchfree_do_array_first;
+static void (*libdivide_s64_branchfree_do_array_ptr)(const int64_t *, int64_t *, size_t, const struct libdivide_s64_branchfree_t *) = libdivide_s64_branchfree_do_array_first;
+static void (*libdivide_u32_branchfree_do_array_indexed_ptr)(const uint32_t *, const uint32_t *, uint32_t *, size_t, const struct libdivide_u32_branchfree_t *) = libdivide_u32_branchfree_do_array_indexed_first;
+static void (*libdivide_s32_branchfree_do_array_indexed_ptr)(const int32_t *, const uint32_t *, int32_t *, size_t, const struct libdivide_s32_branchfree_t *) = libdivide_s32_branchfree_do_array_indexed_first;
+static void (*libdivide_u64_branchfree_do_array_indexed_ptr)(const uint64_t *, const uint32_t *, uint64_t *, size_t, const struct libdivide_u64_branchfree_t *) = libdivide_u64_branchfree_do_array_indexed_first;
+static void (*libdivide_s64_branchfree_do_array_indexed_ptr)(const int64_t *, const uint32_t *, int64_t *, size_t, const struct libdivide_s64_branchfree_t *) = libdivide_s64_branchfree_do_array_indexed_first;
+static void (*libdivide_u32_array_do_indexed_ptr)(const uint32_t *, const uint32_t *, uint32_t *, size_t, const struct libdivide_u32_array_t *) = libdivide_u32_array_do_indexed_first;
+static void (*libdivide_s32_array_do_indexed_ptr)(const int32_t *, const uint32_t *, int32_t *, size_t, const struct libdivide_s32_array_t *) = libdivide_s32_array_do_indexed_first;
+static void (*libdivide_u64_array_do_indexed_ptr)(const uint64_t *, const uint32_t *, uint64_t *, size_t, const struct libdivide_u64_array_t *) = libdivide_u64_array_do_indexed_first;
+static void (*libdivide_s64_array_do_indexed_ptr)(const int64_t *, const uint32_t *, int64_t *, size_t, const struct libdivide_s64_array_t *) = libdivide_s64_array_do_indexed_first;
+static int libdivide_isa = -1;
+
+int libdivide_get_isa(void) {
+    int isa = __atomic_load_n(&libdivide_isa, __ATOMIC_ACQUIRE);
+    if (isa < 0) {
+        const char *env = getenv("LIBDIVIDE_ISA");
+        isa = LIBDIVIDE_ISA_SSE2;
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            isa = LIBDIVIDE_ISA_AVX2;
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512bw")) {
+                isa = LIBDIVIDE_ISA_AVX512;
+            }
+        }
+        if (env) {
+            if (! strcmp(env, "sse2")) isa = LIBDIVIDE_ISA_SSE2;
+            else if (! strcmp(env, "avx2") && isa > LIBDIVIDE_ISA_AVX2) isa = LIBDIVIDE_ISA_AVX2;
+        }
+
+        switch (isa) {
+        case LIBDIVIDE_ISA_AVX512:
+            LIBDIVIDE_DISPATCH_BIND(u8_do_array, libdivide_u8_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s8_do_array, libdivide_s8_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u32_do_array, libdivide_u32_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s32_do_array, libdivide_s32_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u64_do_array, libdivide_u64_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s64_do_array, libdivide_s64_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u64_narrow_do_array, libdivide_u64_narrow_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u32_gen_array_soa, libdivide_u32_gen_array_soa_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s32_gen_array_soa, libdivide_s32_gen_array_soa_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u32_fastmod_array, libdivide_u32_fastmod_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u64_fastmod_array, libdivide_u64_fastmod_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u32_do_ceil_array, libdivide_u32_do_ceil_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s32_do_ceil_array, libdivide_s32_do_ceil_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u64_do_ceil_array, libdivide_u64_do_ceil_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s64_do_ceil_array, libdivide_s64_do_ceil_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u32_do_round_array, libdivide_u32_do_round_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s32_do_round_array, libdivide_s32_do_round_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u64_do_round_array, libdivide_u64_do_round_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s64_do_round_array, libdivide_s64_do_round_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u32_branchfree_do_array, libdivide_u32_branchfree_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s32_branchfree_do_array, libdivide_s32_branchfree_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u64_branchfree_do_array, libdivide_u64_branchfree_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s64_branchfree_do_array, libdivide_s64_branchfree_do_array_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u32_branchfree_do_array_indexed, libdivide_u32_branchfree_do_array_indexed_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s32_branchfree_do_array_indexed, libdivide_s32_branchfree_do_array_indexed_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u64_branchfree_do_array_indexed, libdivide_u64_branchfree_do_array_indexed_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s64_branchfree_do_array_indexed, libdivide_s64_branchfree_do_array_indexed_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u32_array_do_indexed, libdivide_u32_array_do_indexed_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s32_array_do_indexed, libdivide_s32_array_do_indexed_avx512);
+            LIBDIVIDE_DISPATCH_BIND(u64_array_do_indexed, libdivide_u64_array_do_indexed_avx512);
+            LIBDIVIDE_DISPATCH_BIND(s64_array_do_indexed, libdivide_s64_array_do_indexed_avx512);
+            break;
+        case LIBDIVIDE_ISA_AVX2:
+            LIBDIVIDE_DISPATCH_BIND(u8_do_array, libdivide_u8_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s8_do_array, libdivide_s8_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u32_do_array, libdivide_u32_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s32_do_array, libdivide_s32_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u64_do_array, libdivide_u64_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s64_do_array, libdivide_s64_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u64_narrow_do_array, libdivide_u64_narrow_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u32_gen_array_soa, libdivide_u32_gen_array_soa_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s32_gen_array_soa, libdivide_s32_gen_array_soa_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u32_fastmod_array, libdivide_u32_fastmod_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u64_fastmod_array, libdivide_u64_fastmod_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u32_do_ceil_array, libdivide_u32_do_ceil_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s32_do_ceil_array, libdivide_s32_do_ceil_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u64_do_ceil_array, libdivide_u64_do_ceil_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s64_do_ceil_array, libdivide_s64_do_ceil_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u32_do_round_array, libdivide_u32_do_round_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s32_do_round_array, libdivide_s32_do_round_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u64_do_round_array, libdivide_u64_do_round_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s64_do_round_array, libdivide_s64_do_round_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u32_branchfree_do_array, libdivide_u32_branchfree_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s32_branchfree_do_array, libdivide_s32_branchfree_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u64_branchfree_do_array, libdivide_u64_branchfree_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s64_branchfree_do_array, libdivide_s64_branchfree_do_array_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u32_branchfree_do_array_indexed, libdivide_u32_branchfree_do_array_indexed_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s32_branchfree_do_array_indexed, libdivide_s32_branchfree_do_array_indexed_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u64_branchfree_do_array_indexed, libdivide_u64_branchfree_do_array_indexed_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s64_branchfree_do_array_indexed, libdivide_s64_branchfree_do_array_indexed_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u32_array_do_indexed, libdivide_u32_array_do_indexed_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s32_array_do_indexed, libdivide_s32_array_do_indexed_avx2);
+            LIBDIVIDE_DISPATCH_BIND(u64_array_do_indexed, libdivide_u64_array_do_indexed_avx2);
+            LIBDIVIDE_DISPATCH_BIND(s64_array_do_indexed, libdivide_s64_array_do_indexed_avx2);
+            break;
+        default:
+            LIBDIVIDE_DISPATCH_BIND(u8_do_array, libdivide_u8_do_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s8_do_array, libdivide_s8_do_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u32_do_array, libdivide_u32_do_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s32_do_array, libdivide_s32_do_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u64_do_array, libdivide_u64_do_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s64_do_array, libdivide_s64_do_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u64_narrow_do_array, libdivide_u64_narrow_do_array_scalar);
+            LIBDIVIDE_DISPATCH_BIND(u32_gen_array_soa, libdivide_u32_gen_array_soa_scalar);
+            LIBDIVIDE_DISPATCH_BIND(s32_gen_array_soa, libdivide_s32_gen_array_soa_scalar);
+            LIBDIVIDE_DISPATCH_BIND(u32_fastmod_array, libdivide_u32_fastmod_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u64_fastmod_array, libdivide_u64_fastmod_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u32_do_ceil_array, libdivide_u32_do_ceil_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s32_do_ceil_array, libdivide_s32_do_ceil_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u64_do_ceil_array, libdivide_u64_do_ceil_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s64_do_ceil_array, libdivide_s64_do_ceil_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u32_do_round_array, libdivide_u32_do_round_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s32_do_round_array, libdivide_s32_do_round_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u64_do_round_array, libdivide_u64_do_round_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s64_do_round_array, libdivide_s64_do_round_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u32_branchfree_do_array, libdivide_u32_branchfree_do_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s32_branchfree_do_array, libdivide_s32_branchfree_do_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u64_branchfree_do_array, libdivide_u64_branchfree_do_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s64_branchfree_do_array, libdivide_s64_branchfree_do_array_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u32_branchfree_do_array_indexed, libdivide_u32_branchfree_do_array_indexed_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s32_branchfree_do_array_indexed, libdivide_s32_branchfree_do_array_indexed_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u64_branchfree_do_array_indexed, libdivide_u64_branchfree_do_array_indexed_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s64_branchfree_do_array_indexed, libdivide_s64_branchfree_do_array_indexed_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u32_array_do_indexed, libdivide_u32_array_do_indexed_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s32_array_do_indexed, libdivide_s32_array_do_indexed_sse2);
+            LIBDIVIDE_DISPATCH_BIND(u64_array_do_indexed, libdivide_u64_array_do_indexed_sse2);
+            LIBDIVIDE_DISPATCH_BIND(s64_array_do_indexed, libdivide_s64_array_do_indexed_sse2);
+            break;
+        }
+        __atomic_store_n(&libdivide_isa, isa, __ATOMIC_RELEASE);
+    }
+    return isa;
+}
+
+/* Probe at startup, so that the first array call doesn't pay for it */
+__attribute__((__constructor__)) static void libdivide_dispatch_init(void) {
+    libdivide_get_isa();
+}
+
+static void libdivide_u8_do_array_first(const uint8_t *numers, uint8_t *results, size_t n, const struct libdivide_u8_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u8_do_array)(numers, results, n, denom);
+}
+
+static void libdivide_s8_do_array_first(const int8_t *numers, int8_t *results, size_t n, const struct libdivide_s8_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s8_do_array)(numers, results, n, denom);
+}
+
+static void libdivide_u32_do_array_first(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u32_do_array)(numers, results, n, denom);
+}
+
+static void libdivide_s32_do_array_first(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s32_do_array)(numers, results, n, denom);
+}
+
+static void libdivide_u64_do_array_first(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u64_do_array)(numers, results, n, denom);
+}
+
+static void libdivide_s64_do_array_first(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s64_do_array)(numers, results, n, denom);
+}
+
+static void libdivide_u64_narrow_do_array_first(const uint64_t *numers_hi, const uint64_t *numers_lo, uint64_t *quotients, uint64_t *remainders, size_t n, const struct libdivide_u64_narrow_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u64_narrow_do_array)(numers_hi, numers_lo, quotients, remainders, n, denom);
+}
+
+static void libdivide_u32_gen_array_soa_first(const uint32_t *d, uint32_t *magics, uint8_t *mores, size_t n) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u32_gen_array_soa)(d, magics, mores, n);
+}
+
+static void libdivide_s32_gen_array_soa_first(const int32_t *d, int32_t *magics, uint8_t *mores, size_t n) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s32_gen_array_soa)(d, magics, mores, n);
+}
+
+static void libdivide_u32_fastmod_array_first(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_fastmod_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u32_fastmod_array)(numers, results, n, denom);
+}
+
+static void libdivide_u64_fastmod_array_first(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_fastmod_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u64_fastmod_array)(numers, results, n, denom);
+}
+
+static void libdivide_u32_do_ceil_array_first(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u32_do_ceil_array)(numers, results, n, denom);
+}
+
+static void libdivide_s32_do_ceil_array_first(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s32_do_ceil_array)(numers, results, n, denom);
+}
+
+static void libdivide_u64_do_ceil_array_first(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u64_do_ceil_array)(numers, results, n, denom);
+}
+
+static void libdivide_s64_do_ceil_array_first(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s64_do_ceil_array)(numers, results, n, denom);
+}
+
+static void libdivide_u32_do_round_array_first(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u32_do_round_array)(numers, results, n, denom);
+}
+
+static void libdivide_s32_do_round_array_first(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s32_do_round_array)(numers, results, n, denom);
+}
+
+static void libdivide_u64_do_round_array_first(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u64_do_round_array)(numers, results, n, denom);
+}
+
+static void libdivide_s64_do_round_array_first(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s64_do_round_array)(numers, results, n, denom);
+}
+
+static void libdivide_u32_branchfree_do_array_first(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u32_branchfree_do_array)(numers, results, n, denom);
+}
+
+static void libdivide_s32_branchfree_do_array_first(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s32_branchfree_do_array)(numers, results, n, denom);
+}
+
+static void libdivide_u64_branchfree_do_array_first(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u64_branchfree_do_array)(numers, results, n, denom);
+}
+
+static void libdivide_s64_branchfree_do_array_first(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *denom) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s64_branchfree_do_array)(numers, results, n, denom);
+}
+
+static void libdivide_u32_branchfree_do_array_indexed_first(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *table) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u32_branchfree_do_array_indexed)(numers, indices, results, n, table);
+}
+
+static void libdivide_s32_branchfree_do_array_indexed_first(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *table) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s32_branchfree_do_array_indexed)(numers, indices, results, n, table);
+}
+
+static void libdivide_u64_branchfree_do_array_indexed_first(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *table) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u64_branchfree_do_array_indexed)(numers, indices, results, n, table);
+}
+
+static void libdivide_s64_branchfree_do_array_indexed_first(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *table) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s64_branchfree_do_array_indexed)(numers, indices, results, n, table);
+}
+
+static void libdivide_u32_array_do_indexed_first(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_array_t *array) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u32_array_do_indexed)(numers, indices, results, n, array);
+}
+
+static void libdivide_s32_array_do_indexed_first(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_array_t *array) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s32_array_do_indexed)(numers, indices, results, n, array);
+}
+
+static void libdivide_u64_array_do_indexed_first(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_array_t *array) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(u64_array_do_indexed)(numers, indices, results, n, array);
+}
+
+static void libdivide_s64_array_do_indexed_first(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_array_t *array) {
+    libdivide_get_isa();
+    LIBDIVIDE_DISPATCH_CALL(s64_array_do_indexed)(numers, indices, results, n, array);
+}
+#endif
+
+void libdivide_u32_do_array(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u32_do_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_U32_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP, LIBDIVIDE_U32_WIDEST)
+#endif
+}
+
+void libdivide_s32_do_array(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s32_do_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_S32_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP, LIBDIVIDE_S32_WIDEST)
+#endif
+}
+
+void libdivide_u64_do_array(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u64_do_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_U64_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP, LIBDIVIDE_U64_WIDEST)
+#endif
+}
+
+void libdivide_s64_do_array(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s64_do_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_S64_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP, LIBDIVIDE_S64_WIDEST)
+#endif
+}
+
+void libdivide_u8_do_array(const uint8_t *numers, uint8_t *results, size_t n, const struct libdivide_u8_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u8_do_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_U8_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP, LIBDIVIDE_U8_WIDEST)
+#endif
+}
+
+void libdivide_s8_do_array(const int8_t *numers, int8_t *results, size_t n, const struct libdivide_s8_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s8_do_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_S8_ARRAY_SWITCH(LIBDIVIDE_ARRAY_LOOP, LIBDIVIDE_S8_WIDEST)
+#endif
+}
+
+/* ceil and round have a single algorithm, so they skip the switch. */
+void libdivide_u32_do_ceil_array(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u32_do_ceil_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_ARRAY_LOOP(uint32_t, LIBDIVIDE_U32_WIDEST(t), libdivide_u32_do_ceil, LIBDIVIDE_U32_WIDEST(do_ceil_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_s32_do_ceil_array(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s32_do_ceil_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_ARRAY_LOOP(int32_t, LIBDIVIDE_S32_WIDEST(t), libdivide_s32_do_ceil, LIBDIVIDE_S32_WIDEST(do_ceil_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_u64_do_ceil_array(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u64_do_ceil_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_ARRAY_LOOP(uint64_t, LIBDIVIDE_U64_WIDEST(t), libdivide_u64_do_ceil, LIBDIVIDE_U64_WIDEST(do_ceil_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_s64_do_ceil_array(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s64_do_ceil_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_ARRAY_LOOP(int64_t, LIBDIVIDE_S64_WIDEST(t), libdivide_s64_do_ceil, LIBDIVIDE_S64_WIDEST(do_ceil_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_u32_do_round_array(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u32_do_round_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_ARRAY_LOOP(uint32_t, LIBDIVIDE_U32_WIDEST(t), libdivide_u32_do_round, LIBDIVIDE_U32_WIDEST(do_round_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_s32_do_round_array(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s32_do_round_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_ARRAY_LOOP(int32_t, LIBDIVIDE_S32_WIDEST(t), libdivide_s32_do_round, LIBDIVIDE_S32_WIDEST(do_round_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_u64_do_round_array(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u64_do_round_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_ARRAY_LOOP(uint64_t, LIBDIVIDE_U64_WIDEST(t), libdivide_u64_do_round, LIBDIVIDE_U64_WIDEST(do_round_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_s64_do_round_array(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s64_do_round_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_ARRAY_LOOP(int64_t, LIBDIVIDE_S64_WIDEST(t), libdivide_s64_do_round, LIBDIVIDE_S64_WIDEST(do_round_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_u32_branchfree_do_array(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u32_branchfree_do_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_BRANCHFREE_ARRAY_LOOP(uint32_t, LIBDIVIDE_U32_WIDEST(t), libdivide_u32_branchfree_do, LIBDIVIDE_U32_WIDEST(branchfree_do_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_s32_branchfree_do_array(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s32_branchfree_do_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_BRANCHFREE_ARRAY_LOOP(int32_t, LIBDIVIDE_S32_WIDEST(t), libdivide_s32_branchfree_do, LIBDIVIDE_S32_WIDEST(branchfree_do_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_u64_branchfree_do_array(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u64_branchfree_do_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_BRANCHFREE_ARRAY_LOOP(uint64_t, LIBDIVIDE_U64_WIDEST(t), libdivide_u64_branchfree_do, LIBDIVIDE_U64_WIDEST(branchfree_do_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_s64_branchfree_do_array(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s64_branchfree_do_array)(numers, results, n, denom);
+#else
+    LIBDIVIDE_BRANCHFREE_ARRAY_LOOP(int64_t, LIBDIVIDE_S64_WIDEST(t), libdivide_s64_branchfree_do, LIBDIVIDE_S64_WIDEST(branchfree_do_vector), numers, results, n, denom);
+#endif
+}
+
+void libdivide_u32_branchfree_do_array_indexed(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_branchfree_t *table) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u32_branchfree_do_array_indexed)(numers, indices, results, n, table);
+#else
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint32_t, LIBDIVIDE_U32_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX32, libdivide_u32_branchfree_do_indexed, LIBDIVIDE_U32_WIDEST(branchfree_do_gather), numers, indices, results, n, table);
+#endif
+}
+
+void libdivide_s32_branchfree_do_array_indexed(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_branchfree_t *table) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s32_branchfree_do_array_indexed)(numers, indices, results, n, table);
+#else
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int32_t, LIBDIVIDE_S32_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX32, libdivide_s32_branchfree_do_indexed, LIBDIVIDE_S32_WIDEST(branchfree_do_gather), numers, indices, results, n, table);
+#endif
+}
+
+void libdivide_u64_branchfree_do_array_indexed(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_branchfree_t *table) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u64_branchfree_do_array_indexed)(numers, indices, results, n, table);
+#else
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint64_t, LIBDIVIDE_U64_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX64, libdivide_u64_branchfree_do_indexed, LIBDIVIDE_U64_WIDEST(branchfree_do_gather), numers, indices, results, n, table);
+#endif
+}
+
+void libdivide_s64_branchfree_do_array_indexed(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_branchfree_t *table) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s64_branchfree_do_array_indexed)(numers, indices, results, n, table);
+#else
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int64_t, LIBDIVIDE_S64_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX64, libdivide_s64_branchfree_do_indexed, LIBDIVIDE_S64_WIDEST(branchfree_do_gather), numers, indices, results, n, table);
+#endif
+}
+
+void libdivide_u32_array_gen(const uint32_t *d, struct libdivide_u32_array_t *array, size_t n) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        if (d[i] == 1) {
+            array->magics[i] = 0;
+            array->mores[i] = LIBDIVIDE_ARRAY_ONE;
+        } else {
+            const struct libdivide_u32_branchfree_t denom = libdivide_u32_branchfree_gen(d[i]);
+            array->magics[i] = denom.magic;
+            array->mores[i] = denom.more;
+        }
+    }
+    memset(array->mores + n, 0, LIBDIVIDE_ARRAY_PADDING);
+    array->n = n;
+}
+
+uint32_t libdivide_u32_array_do(uint32_t numer, size_t index, const struct libdivide_u32_array_t *array) {
+    struct libdivide_u32_branchfree_t denom;
+    uint32_t q;
+    LIBDIVIDE_ASSERT(index < array->n);
+    denom.magic = array->magics[index];
+    denom.more = array->mores[index] & LIBDIVIDE_32_SHIFT_MASK;
+    q = libdivide_u32_branchfree_do(numer, &denom);
+    return array->mores[index] == LIBDIVIDE_ARRAY_ONE ? numer : q;
+}
+
+void libdivide_u32_array_do_indexed(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const struct libdivide_u32_array_t *array) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u32_array_do_indexed)(numers, indices, results, n, array);
+#else
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint32_t, LIBDIVIDE_U32_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX32, libdivide_u32_array_do, LIBDIVIDE_U32_WIDEST(array_do_gather), numers, indices, results, n, array);
+#endif
+}
+
+void libdivide_s32_array_gen(const int32_t *d, struct libdivide_s32_array_t *array, size_t n) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        const struct libdivide_s32_branchfree_t denom = libdivide_s32_branchfree_gen(d[i]);
+        array->magics[i] = denom.magic;
+        array->mores[i] = denom.more;
+    }
+    memset(array->mores + n, 0, LIBDIVIDE_ARRAY_PADDING);
+    array->n = n;
+}
+
+int32_t libdivide_s32_array_do(int32_t numer, size_t index, const struct libdivide_s32_array_t *array) {
+    struct libdivide_s32_branchfree_t denom;
+    LIBDIVIDE_ASSERT(index < array->n);
+    denom.magic = array->magics[index];
+    denom.more = array->mores[index];
+    return libdivide_s32_branchfree_do(numer, &denom);
+}
+
+void libdivide_s32_array_do_indexed(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const struct libdivide_s32_array_t *array) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s32_array_do_indexed)(numers, indices, results, n, array);
+#else
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int32_t, LIBDIVIDE_S32_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX32, libdivide_s32_array_do, LIBDIVIDE_S32_WIDEST(array_do_gather), numers, indices, results, n, array);
+#endif
+}
+
+void libdivide_u64_array_gen(const uint64_t *d, struct libdivide_u64_array_t *array, size_t n) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        if (d[i] == 1) {
+            array->magics[i] = 0;
+            array->mores[i] = LIBDIVIDE_ARRAY_ONE;
+        } else {
+            const struct libdivide_u64_branchfree_t denom = libdivide_u64_branchfree_gen(d[i]);
+            array->magics[i] = denom.magic;
+            array->mores[i] = denom.more;
+        }
+    }
+    memset(array->mores + n, 0, LIBDIVIDE_ARRAY_PADDING);
+    array->n = n;
+}
+
+uint64_t libdivide_u64_array_do(uint64_t numer, size_t index, const struct libdivide_u64_array_t *array) {
+    struct libdivide_u64_branchfree_t denom;
+    uint64_t q;
+    LIBDIVIDE_ASSERT(index < array->n);
+    denom.magic = array->magics[index];
+    denom.more = array->mores[index] & LIBDIVIDE_64_SHIFT_MASK;
+    q = libdivide_u64_branchfree_do(numer, &denom);
+    return array->mores[index] == LIBDIVIDE_ARRAY_ONE ? numer : q;
+}
+
+void libdivide_u64_array_do_indexed(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const struct libdivide_u64_array_t *array) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u64_array_do_indexed)(numers, indices, results, n, array);
+#else
+    LIBDIVIDE_GATHER_ARRAY_LOOP(uint64_t, LIBDIVIDE_U64_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX64, libdivide_u64_array_do, LIBDIVIDE_U64_WIDEST(array_do_gather), numers, indices, results, n, array);
+#endif
+}
+
+void libdivide_s64_array_gen(const int64_t *d, struct libdivide_s64_array_t *array, size_t n) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        const struct libdivide_s64_branchfree_t denom = libdivide_s64_branchfree_gen(d[i]);
+        array->magics[i] = denom.magic;
+        array->mores[i] = denom.more;
+    }
+    memset(array->mores + n, 0, LIBDIVIDE_ARRAY_PADDING);
+    array->n = n;
+}
+
+int64_t libdivide_s64_array_do(int64_t numer, size_t index, const struct libdivide_s64_array_t *array) {
+    struct libdivide_s64_branchfree_t denom;
+    LIBDIVIDE_ASSERT(index < array->n);
+    denom.magic = array->magics[index];
+    denom.more = array->mores[index];
+    return libdivide_s64_branchfree_do(numer, &denom);
+}
+
+void libdivide_s64_array_do_indexed(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const struct libdivide_s64_array_t *array) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s64_array_do_indexed)(numers, indices, results, n, array);
+#else
+    LIBDIVIDE_GATHER_ARRAY_LOOP(int64_t, LIBDIVIDE_S64_WIDEST(t), LIBDIVIDE_GATHER_LOAD_INDEX64, libdivide_s64_array_do, LIBDIVIDE_S64_WIDEST(array_do_gather), numers, indices, results, n, array);
+#endif
+}
+
+void libdivide_u64_narrow_do_array(const uint64_t *numers_hi, const uint64_t *numers_lo, uint64_t *quotients, uint64_t *remainders, size_t n, const struct libdivide_u64_narrow_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u64_narrow_do_array)(numers_hi, numers_lo, quotients, remainders, n, denom);
+#elif LIBDIVIDE_USE_AVX512
+    libdivide_u64_narrow_do_array_avx512(numers_hi, numers_lo, quotients, remainders, n, denom);
+#elif LIBDIVIDE_USE_AVX2
+    libdivide_u64_narrow_do_array_avx2(numers_hi, numers_lo, quotients, remainders, n, denom);
+#else
+    libdivide_u64_narrow_do_array_scalar(numers_hi, numers_lo, quotients, remainders, n, denom);
+#endif
+}
+
+void libdivide_u32_fastmod_array(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_fastmod_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u32_fastmod_array)(numers, results, n, denom);
+#elif LIBDIVIDE_USE_AVX2
+    libdivide_u32_fastmod_array_avx2(numers, results, n, denom);
+#elif LIBDIVIDE_USE_SSE2
+    libdivide_u32_fastmod_array_sse2(numers, results, n, denom);
+#else
+    libdivide_u32_fastmod_array_scalar(numers, results, n, denom);
+#endif
+}
+
+void libdivide_u64_fastmod_array(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_fastmod_t *denom) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u64_fastmod_array)(numers, results, n, denom);
+#elif LIBDIVIDE_USE_AVX2
+    libdivide_u64_fastmod_array_avx2(numers, results, n, denom);
+#elif LIBDIVIDE_USE_SSE2
+    libdivide_u64_fastmod_array_sse2(numers, results, n, denom);
+#else
+    libdivide_u64_fastmod_array_scalar(numers, results, n, denom);
+#endif
+}
+
+void libdivide_u32_gen_array_soa(const uint32_t *d, uint32_t *magics, uint8_t *mores, size_t n) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(u32_gen_array_soa)(d, magics, mores, n);
+#elif LIBDIVIDE_USE_AVX512
+    libdivide_u32_gen_array_soa_avx512(d, magics, mores, n);
+#elif LIBDIVIDE_USE_AVX2
+    libdivide_u32_gen_array_soa_avx2(d, magics, mores, n);
+#else
+    libdivide_u32_gen_array_soa_scalar(d, magics, mores, n);
+#endif
+}
+
+void libdivide_s32_gen_array_soa(const int32_t *d, int32_t *magics, uint8_t *mores, size_t n) {
+#if LIBDIVIDE_USE_DISPATCH
+    LIBDIVIDE_DISPATCH_CALL(s32_gen_array_soa)(d, magics, mores, n);
+#elif LIBDIVIDE_USE_AVX512
+    libdivide_s32_gen_array_soa_avx512(d, magics, mores, n);
+#elif LIBDIVIDE_USE_AVX2
+    libdivide_s32_gen_array_soa_avx2(d, magics, mores, n);
+#else
+    libdivide_s32_gen_array_soa_scalar(d, magics, mores, n);
+#endif
+}
+
+/* With the vector kernels, the 32 bit structs are generated a block at a time in the SoA form, on the stack, and copied out.  Without them, they are generated in place. */
+#if LIBDIVIDE_USE_AVX2 || LIBDIVIDE_USE_DISPATCH
+#define LIBDIVIDE_GEN_ARRAY_BLOCK 64
+
+#define LIBDIVIDE_GEN_ARRAY_LOOP(IntType, gen_func, soa_func, d, out, n) do { \
+    IntType magics[LIBDIVIDE_GEN_ARRAY_BLOCK]; \
+    uint8_t mores[LIBDIVIDE_GEN_ARRAY_BLOCK]; \
+    size_t i, j; \
+    for (i = 0; i < (n); i += LIBDIVIDE_GEN_ARRAY_BLOCK) { \
+        const size_t count = (n) - i < LIBDIVIDE_GEN_ARRAY_BLOCK ? (n) - i : LIBDIVIDE_GEN_ARRAY_BLOCK; \
+        soa_func((d) + i, magics, mores, count); \
+        for (j = 0; j < count; j++) { \
+            (out)[i + j].magic = magics[j]; \
+            (out)[i + j].more = mores[j]; \
+            (out)[i + j].divisor = (d)[i + j]; \
+        } \
+    } \
+} while (0)
+#else
+#define LIBDIVIDE_GEN_ARRAY_LOOP(IntType, gen_func, soa_func, d, out, n) do { \
+    size_t i; \
+    for (i = 0; i < (n); i++) { \
+        (out)[i] = gen_func((d)[i]); \
+    } \
+} while (0)
+#endif
+
+void libdivide_u32_gen_array(const uint32_t *d, struct libdivide_u32_t *out, size_t n) {
+    LIBDIVIDE_GEN_ARRAY_LOOP(uint32_t, libdivide_u32_gen, libdivide_u32_gen_array_soa, d, out, n);
+}
+
+void libdivide_s32_gen_array(const int32_t *d, struct libdivide_s32_t *out, size_t n) {
+    LIBDIVIDE_GEN_ARRAY_LOOP(int32_t, libdivide_s32_gen, libdivide_s32_gen_array_soa, d, out, n);
+}
+
+/* The 64 bit divisions have no vector form, so the 64 bit types just loop */
+void libdivide_u64_gen_array(const uint64_t *d, struct libdivide_u64_t *out, size_t n) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        out[i] = libdivide_u64_gen(d[i]);
+    }
+}
+
+void libdivide_s64_gen_array(const int64_t *d, struct libdivide_s64_t *out, size_t n) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        out[i] = libdivide_s64_gen(d[i]);
+    }
+}
+
+void libdivide_u64_gen_array_soa(const uint64_t *d, uint64_t *magics, uint8_t *mores, size_t n) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        const struct libdivide_u64_t denom = libdivide_u64_gen(d[i]);
+        magics[i] = denom.magic;
+        mores[i] = denom.more;
+    }
+}
+
+void libdivide_s64_gen_array_soa(const int64_t *d, int64_t *magics, uint8_t *mores, size_t n) {
+    size_t i;
+    for (i = 0; i < n; i++) {
+        const struct libdivide_s64_t denom = libdivide_s64_gen(d[i]);
+        magics[i] = denom.magic;
+        mores[i] = denom.more;
+    }
+}
+
+/////////// PARALLEL ARRAYS
+
+#if LIBDIVIDE_HAS_THREADS
+//a streamed chunk is divided a block at a time into a buffer that stays in L1, and copied out of it with non-temporal stores, so that the kernels keep their ordinary stores
+#define LIBDIVIDE_POOL_BLOCK 4096
+
+static inline size_t libdivide__pool_cache_size(void) {
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    const long size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (size > 0) return (size_t)size;
+#endif
+    return LIBDIVIDE_POOL_CACHE_SIZE;
+}
+
+//pins the worker to the index'th CPU this process may run on, and reads which node that is on
+static inline void libdivide__pool_pin(struct libdivide_pool_worker_t *worker) {
+#if defined(__linux__) && defined(CPU_SET)
+    cpu_set_t allowed, set;
+    int cpu, target;
+    if (sched_getaffinity(0, sizeof allowed, &allowed) != 0 || CPU_COUNT(&allowed) == 0) return;
+    target = (int)(worker->index % (unsigned)CPU_COUNT(&allowed));
+    for (cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &allowed) && target-- == 0) break;
+    }
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof set, &set) != 0) return;
+#if defined(SYS_getcpu)
+    {
+        unsigned on_cpu, node;
+        if (syscall(SYS_getcpu, &on_cpu, &node, NULL) == 0) worker->node = (int)node;
+    }
+#endif
+#else
+    (void)worker;
+#endif
+}
+
+//takes a chunk from the front of a worker's run, or from the back for a thief
+static inline int libdivide__pool_take(uint64_t *chunks, uint32_t *chunk, int back) {
+    uint64_t run = __atomic_load_n(chunks, __ATOMIC_RELAXED), next;
+    do {
+        const uint32_t first = (uint32_t)run, end = (uint32_t)(run >> 32);
+        if (first >= end) return 0;
+        *chunk = back ? end - 1 : first;
+        next = back ? run - (1ULL << 32) : run + 1;
+    } while (! __atomic_compare_exchange_n(chunks, &run, next, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    return 1;
+}
+
+#if LIBDIVIDE_USE_SSE2
+static inline void libdivide__stream_copy(char *dst, const char *src, size_t bytes) {
+    size_t i = (size_t)(-(uintptr_t)dst & 15);
+    if (i > bytes) i = bytes;
+    memcpy(dst, src, i);
+    for (; i + 16 <= bytes; i += 16) {
+        _mm_stream_si128((__m128i *)(dst + i), _mm_loadu_si128((const __m128i *)(src + i)));
+    }
+    memcpy(dst + i, src + i, bytes - i);
+}
+#endif
+
+static inline void libdivide__pool_chunk(const struct libdivide_pool_t *pool, uint32_t chunk) {
+    const size_t first = (size_t)chunk * pool->chunk, count = pool->n - first < pool->chunk ? pool->n - first : pool->chunk;
+    const char *numers = pool->numers + first * pool->width;
+    char *results = pool->results + first * pool->width;
+#if LIBDIVIDE_USE_SSE2
+    if (pool->stream) {
+        __m128i buffer[LIBDIVIDE_POOL_BLOCK / sizeof(__m128i)];
+        const size_t block = LIBDIVIDE_POOL_BLOCK / pool->width;
+        size_t i;
+        for (i = 0; i < count; i += block) {
+            const size_t m = count - i < block ? count - i : block;
+            pool->divide(numers + i * pool->width, buffer, m, pool->denom);
+            libdivide__stream_copy(results + i * pool->width, (const char *)buffer, m * pool->width);
+        }
+        return;
+    }
+#endif
+    pool->divide(numers, results, count, pool->denom);
+}
+
+static inline void libdivide__pool_work(struct libdivide_pool_t *pool, struct libdivide_pool_worker_t *self) {
+    const unsigned threads = pool->threads;
+    unsigned pass, distance;
+    uint32_t chunk;
+    while (libdivide__pool_take(&self->chunks, &chunk, 0)) libdivide__pool_chunk(pool, chunk);
+    //then steal from the others, nearest first on either side.  Workers that aren't pinned are all on node -1, so they are all taken in the first pass
+    for (pass = 0; pass < 2; pass++) {
+        for (distance = 1; distance < threads; distance++) {
+            const unsigned index = (distance & 1) ? self->index + (distance + 1) / 2 : self->index + threads - distance / 2;
+            struct libdivide_pool_worker_t *victim = &pool->workers[index % threads];
+            if ((victim->node == self->node) != (pass == 0)) continue;
+            while (libdivide__pool_take(&victim->chunks, &chunk, 1)) libdivide__pool_chunk(pool, chunk);
+        }
+    }
+#if LIBDIVIDE_USE_SSE2
+    //the non-temporal stores are weakly ordered, so they must be done before the job is
+    if (pool->stream) _mm_sfence();
+#endif
+}
+
+static inline void *libdivide__pool_thread(void *arg) {
+    struct libdivide_pool_worker_t *self = (struct libdivide_pool_worker_t *)arg;
+    struct libdivide_pool_t *pool = self->pool;
+    uint64_t job = 0;
+    if (pool->flags & LIBDIVIDE_POOL_NUMA) libdivide__pool_pin(self);
+    pthread_mutex_lock(&pool->lock);
+    //libdivide_pool_init waits for every worker to start, so that they have all read their nodes before the first job
+    if (--pool->busy == 0) pthread_cond_signal(&pool->done);
+    for (;;) {
+        while (pool->job == job && ! pool->stop) pthread_cond_wait(&pool->start, &pool->lock);
+        if (pool->stop) break;
+        job = pool->job;
+        pthread_mutex_unlock(&pool->lock);
+        libdivide__pool_work(pool, self);
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->busy == 0) pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+static inline void libdivide__pool_run(struct libdivide_pool_t *pool, void (*divide)(const void *, void *, size_t, const void *), const void *numers, void *results, size_t n, size_t width, const void *denom) {
+    const size_t chunk = LIBDIVIDE_PARALLEL_CHUNK / width, chunks = (n + chunk - 1) / chunk;
+    unsigned i;
+    if (chunks <= 1 || pool->threads == 0) {
+        divide(numers, results, n, denom);
+        return;
+    }
+    LIBDIVIDE_ASSERT(chunks <= 0xFFFFFFFFU);
+    pthread_mutex_lock(&pool->lock);
+    pool->divide = divide;
+    pool->numers = (const char *)numers;
+    pool->results = (char *)results;
+    pool->denom = denom;
+    pool->n = n;
+    pool->width = width;
+    pool->chunk = chunk;
+    pool->stream = n * width > pool->stream_above;
+    for (i = 0; i < pool->threads; i++) {
+        const uint64_t first = (uint64_t)chunks * i / pool->threads, end = (uint64_t)chunks * (i + 1) / pool->threads;
+        __atomic_store_n(&pool->workers[i].chunks, first | end << 32, __ATOMIC_RELAXED);
+    }
+    pool->busy = pool->threads;
+    pool->job++;
+    pthread_cond_broadcast(&pool->start);
+    while (pool->busy) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+int libdivide_pool_init(struct libdivide_pool_t *pool, unsigned threads, unsigned flags) {
+    unsigned i;
+    int error = 0;
+    if (threads == 0) {
+        const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (unsigned)cpus : 1;
+    }
+    if (threads > LIBDIVIDE_POOL_MAX_THREADS) threads = LIBDIVIDE_POOL_MAX_THREADS;
+#if LIBDIVIDE_USE_DISPATCH
+    //pick the kernels now, rather than have the workers race to
+    libdivide_get_isa();
+#endif
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->threads = 0;
+    pool->flags = flags;
+    pool->busy = threads;
+    pool->stop = 0;
+    pool->job = 0;
+    pool->stream_above = libdivide__pool_cache_size();
+    for (i = 0; i < threads; i++) {
+        struct libdivide_pool_worker_t *worker = &pool->workers[i];
+        worker->chunks = 0;
+        worker->pool = pool;
+        worker->index = i;
+        worker->node = -1;
+        error = pthread_create(&worker->thread, NULL, libdivide__pool_thread, worker);
+        if (error) break;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->threads = i;
+    pool->busy -= threads - i;
+    while (pool->busy) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+    if (error) libdivide_pool_destroy(pool);
+    return error;
+}
+
+void libdivide_pool_destroy(struct libdivide_pool_t *pool) {
+    unsigned i;
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    for (i = 0; i < pool->threads; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+    pool->threads = 0;
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+static inline void libdivide__u32_pool_divide(const void *numers, void *results, size_t n, const void *denom) {
+    libdivide_u32_do_array((const uint32_t *)numers, (uint32_t *)results, n, (const struct libdivide_u32_t *)denom);
+}
+
+static inline void libdivide__s32_pool_divide(const void *numers, void *results, size_t n, const void *denom) {
+    libdivide_s32_do_array((const int32_t *)numers, (int32_t *)results, n, (const struct libdivide_s32_t *)denom);
+}
+
+static inline void libdivide__u64_pool_divide(const void *numers, void *results, size_t n, const void *denom) {
+    libdivide_u64_do_array((const uint64_t *)numers, (uint64_t *)results, n, (const struct libdivide_u64_t *)denom);
+}
+
+static inline void libdivide__s64_pool_divide(const void *numers, void *results, size_t n, const void *denom) {
+    libdivide_s64_do_array((const int64_t *)numers, (int64_t *)results, n, (const struct libdivide_s64_t *)denom);
+}
+
+void libdivide_u32_do_array_parallel(const uint32_t *numers, uint32_t *results, size_t n, const struct libdivide_u32_t *denom, struct libdivide_pool_t *pool) {
+    libdivide__pool_run(pool, libdivide__u32_pool_divide, numers, results, n, sizeof *numers, denom);
+}
+
+void libdivide_s32_do_array_parallel(const int32_t *numers, int32_t *results, size_t n, const struct libdivide_s32_t *denom, struct libdivide_pool_t *pool) {
+    libdivide__pool_run(pool, libdivide__s32_pool_divide, numers, results, n, sizeof *numers, denom);
+}
+
+void libdivide_u64_do_array_parallel(const uint64_t *numers, uint64_t *results, size_t n, const struct libdivide_u64_t *denom, struct libdivide_pool_t *pool) {
+    libdivide__pool_run(pool, libdivide__u64_pool_divide, numers, results, n, sizeof *numers, denom);
+}
+
+void libdivide_s64_do_array_parallel(const int64_t *numers, int64_t *results, size_t n, const struct libdivide_s64_t *denom, struct libdivide_pool_t *pool) {
+    libdivide__pool_run(pool, libdivide__s64_pool_divide, numers, results, n, sizeof *numers, denom);
+}
+#endif
+
+/////////// C++ stuff
+
+#ifdef __cplusplus
+
+/* The C++ template design here is a total mess.  This needs to be fixed by someone better at templates than I.  The current design is:
+
+- The base is a template divider_base that takes the integer type, the libdivide struct, a generating function, a get algorithm function, a do function, and either a do vector function or a dummy int.
+- The base has storage for the libdivide struct.  This is the only storage (so the C++ class should be no larger than the libdivide struct).
+
+- Above that, there's divider_mid.  This is an empty struct by default, but it is specialized against our four int types.  divider_mid contains a template struct algo, that contains a typedef for a specialization of divider_base.  struct algo is specialized to take an "algorithm number," where -1 means to use the general algorithm.
+
+- Publicly we have class divider, which inherits from divider_mid::algo.  This also take an algorithm number, which defaults to -1 (the general algorithm).
+- divider has a operator / which allows you to use a divider as the divisor in a quotient expression.
+
+*/
+
+/* The vector types go into the templates as type arguments, which drops their alignment and may_alias attributes, and GCC warns about that.  The templates only pass the vectors by value to the vector functions, so nothing is lost, and the warning is turned off up to the end of the C++ code. */
+#if defined(__clang__) || __GNUC__ >= 6
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
+
+namespace libdivide_internal {
+
+#if LIBDIVIDE_USE_AVX2
+#define MAYBE_VECTOR64(x)  crash_divide
+#define MAYBE_VECTOR128(x) x
+#define MAYBE_VECTOR256(x) x
+#define MAYBE_VECTOR_2S32_PARAM int
+#define MAYBE_VECTOR_4S32_PARAM __m128i
+#define MAYBE_VECTOR_8S32_PARAM __m256i
+#define MAYBE_VECTOR_1S64_PARAM int
+#define MAYBE_VECTOR_2S64_PARAM __m128i
+#define MAYBE_VECTOR_4S64_PARAM __m256i
+#define MAYBE_VECTOR_2U32_PARAM int
+#define MAYBE_VECTOR_4U32_PARAM __m128i
+#define MAYBE_VECTOR_8U32_PARAM __m256i
+#define MAYBE_VECTOR_1U64_PARAM int
+#define MAYBE_VECTOR_2U64_PARAM __m128i
+#define MAYBE_VECTOR_4U64_PARAM __m256i
+#define MAYBE_VECTOR_4S16_PARAM int
+#define MAYBE_VECTOR_8S16_PARAM __m128i
+#define MAYBE_VECTOR_16S16_PARAM __m256i
+#define MAYBE_VECTOR_4U16_PARAM int
+#define MAYBE_VECTOR_8U16_PARAM __m128i
+#define MAYBE_VECTOR_16U16_PARAM __m256i
+#define MAYBE_VECTOR_8S8_PARAM int
+#define MAYBE_VECTOR_16S8_PARAM __m128i
+#define MAYBE_VECTOR_32S8_PARAM __m256i
+#define MAYBE_VECTOR_8U8_PARAM int
+#define MAYBE_VECTOR_16U8_PARAM __m128i
+#define MAYBE_VECTOR_32U8_PARAM __m256i
+#elif LIBDIVIDE_USE_SSE2
+#define MAYBE_VECTOR64(x)  crash_divide
+#define MAYBE_VECTOR128(x) x
+#define MAYBE_VECTOR256(x) crash_divide
+#define MAYBE_VECTOR_2S32_PARAM int
+#define MAYBE_VECTOR_4S32_PARAM __m128i
+#define MAYBE_VECTOR_8S32_PARAM int
+#define MAYBE_VECTOR_1S64_PARAM int
+#define MAYBE_VECTOR_2S64_PARAM __m128i
+#define MAYBE_VECTOR_4S64_PARAM int
+#define MAYBE_VECTOR_2U32_PARAM int
+#define MAYBE_VECTOR_4U32_PARAM __m128i
+#define MAYBE_VECTOR_8U32_PARAM int
+#define MAYBE_VECTOR_1U64_PARAM int
+#define MAYBE_VECTOR_2U64_PARAM __m128i
+#define MAYBE_VECTOR_4U64_PARAM int
+#define MAYBE_VECTOR_4S16_PARAM int
+#define MAYBE_VECTOR_8S16_PARAM __m128i
+#define MAYBE_VECTOR_16S16_PARAM int
+#define MAYBE_VECTOR_4U16_PARAM int
+#define MAYBE_VECTOR_8U16_PARAM __m128i
+#define MAYBE_VECTOR_16U16_PARAM int
+#define MAYBE_VECTOR_8S8_PARAM int
+#define MAYBE_VECTOR_16S8_PARAM __m128i
+#define MAYBE_VECTOR_32S8_PARAM int
+#define MAYBE_VECTOR_8U8_PARAM int
+#define MAYBE_VECTOR_16U8_PARAM __m128i
+#define MAYBE_VECTOR_32U8_PARAM int
+#elif LIBDIVIDE_USE_NEON || LIBDIVIDE_USE_VECTOR
+#define MAYBE_VECTOR64(x)  x
+#define MAYBE_VECTOR128(x) x
+#define MAYBE_VECTOR256(x) x
+#define MAYBE_VECTOR_2S32_PARAM libdivide_2s32_t
+#define MAYBE_VECTOR_4S32_PARAM libdivide_4s32_t
+#define MAYBE_VECTOR_8S32_PARAM libdivide_8s32_t
+#define MAYBE_VECTOR_1S64_PARAM libdivide_1s64_t
+#define MAYBE_VECTOR_2S64_PARAM libdivide_2s64_t
+#define MAYBE_VECTOR_4S64_PARAM libdivide_4s64_t
+#define MAYBE_VECTOR_2U32_PARAM libdivide_2u32_t
+#define MAYBE_VECTOR_4U32_PARAM libdivide_4u32_t
+#define MAYBE_VECTOR_8U32_PARAM libdivide_8u32_t
+#define MAYBE_VECTOR_1U64_PARAM libdivide_1u64_t
+#define MAYBE_VECTOR_2U64_PARAM libdivide_2u64_t
+#define MAYBE_VECTOR_4U64_PARAM libdivide_4u64_t
+#define MAYBE_VECTOR_4S16_PARAM libdivide_4s16_t
+#define MAYBE_VECTOR_8S16_PARAM libdivide_8s16_t
+#define MAYBE_VECTOR_16S16_PARAM libdivide_16s16_t
+#define MAYBE_VECTOR_4U16_PARAM libdivide_4u16_t
+#define MAYBE_VECTOR_8U16_PARAM libdivide_8u16_t
+#define MAYBE_VECTOR_16U16_PARAM libdivide_16u16_t
+#define MAYBE_VECTOR_8S8_PARAM libdivide_8s8_t
+#define MAYBE_VECTOR_16S8_PARAM libdivide_16s8_t
+#define MAYBE_VECTOR_32S8_PARAM libdivide_32s8_t
+#define MAYBE_VECTOR_8U8_PARAM libdivide_8u8_t
+#define MAYBE_VECTOR_16U8_PARAM libdivide_16u8_t
+#define MAYBE_VECTOR_32U8_PARAM libdivide_32u8_t
+#else
+#define MAYBE_VECTOR64(x)  crash_divide
+#define MAYBE_VECTOR128(x) crash_divide
+#define MAYBE_VECTOR256(x) crash_divide
+#define MAYBE_VECTOR_2S32_PARAM int
+#define MAYBE_VECTOR_4S32_PARAM int
+#define MAYBE_VECTOR_8S32_PARAM int
+#define MAYBE_VECTOR_1S64_PARAM int
+#define MAYBE_VECTOR_2S64_PARAM int
+#define MAYBE_VECTOR_4S64_PARAM int
+#define MAYBE_VECTOR_2U32_PARAM int
+#define MAYBE_VECTOR_4U32_PARAM int
+#define MAYBE_VECTOR_8U32_PARAM int
+#define MAYBE_VECTOR_1U64_PARAM int
+#define MAYBE_VECTOR_2U64_PARAM int
+#define MAYBE_VECTOR_4U64_PARAM int
+#define MAYBE_VECTOR_4S16_PARAM int
+#define MAYBE_VECTOR_8S16_PARAM int
+#define MAYBE_VECTOR_16S16_PARAM int
+#define MAYBE_VECTOR_4U16_PARAM int
+#define MAYBE_VECTOR_8U16_PARAM int
+#define MAYBE_VECTOR_16U16_PARAM int
+#define MAYBE_VECTOR_8S8_PARAM int
+#define MAYBE_VECTOR_16S8_PARAM int
+#define MAYBE_VECTOR_32S8_PARAM int
+#define MAYBE_VECTOR_8U8_PARAM int
+#define MAYBE_VECTOR_16U8_PARAM int
+#define MAYBE_VECTOR_32U8_PARAM int
+#endif
+
+#if LIBDIVIDE_VEC512
+#define MAYBE_VECTOR512(x) x
+#define MAYBE_VECTOR_16S32_PARAM libdivide_16s32_t
+#define MAYBE_VECTOR_8S64_PARAM  libdivide_8s64_t
+#define MAYBE_VECTOR_16U32_PARAM libdivide_16u32_t
+#define MAYBE_VECTOR_8U64_PARAM  libdivide_8u64_t
+#define MAYBE_VECTOR_32S16_PARAM libdivide_32s16_t
+#define MAYBE_VECTOR_32U16_PARAM libdivide_32u16_t
+#define MAYBE_VECTOR_64S8_PARAM  libdivide_64s8_t
+#define MAYBE_VECTOR_64U8_PARAM  libdivide_64u8_t
+#else
+#define MAYBE_VECTOR512(x) crash_divide
+#define MAYBE_VECTOR_16S32_PARAM int
+#define MAYBE_VECTOR_8S64_PARAM  int
+#define MAYBE_VECTOR_16U32_PARAM int
+#define MAYBE_VECTOR_8U64_PARAM  int
+#define MAYBE_VECTOR_32S16_PARAM int
+#define MAYBE_VECTOR_32U16_PARAM int
+#define MAYBE_VECTOR_64S8_PARAM  int
+#define MAYBE_VECTOR_64U8_PARAM  int
+#endif
+
+    /* Some bogus unswitch functions for unsigned types so the same (presumably templated) code can work for both signed and unsigned. */
+    template <typename T, typename U>
+    T crash_divide(T, const U*) { abort(); return *(T*)NULL; }
+    uint8_t crash_u8(uint8_t, const libdivide_u8_t*) { abort(); return *(uint8_t*)NULL; }
+    uint16_t crash_u16(uint16_t, const libdivide_u16_t*) { abort(); return *(uint16_t*)NULL; }
+    uint32_t crash_u32(uint32_t, const libdivide_u32_t*) { abort(); return *(uint32_t*)NULL; }
+    uint64_t crash_u64(uint64_t, const libdivide_u64_t*) { abort(); return *(uint64_t*)NULL; }
+#if HAS_INT128_T
+    __uint128_t crash_u128(__uint128_t, const libdivide_u128_t*) { abort(); return *(__uint128_t*)NULL; }
+#endif
+
+    /* Overloads of the array functions, so that divider can pick one by type. */
+    inline void do_array(const uint8_t *numers, uint8_t *results, size_t n, const libdivide_u8_t *denom) { libdivide_u8_do_array(numers, results, n, denom); }
+    inline void do_array(const int8_t *numers, int8_t *results, size_t n, const libdivide_s8_t *denom) { libdivide_s8_do_array(numers, results, n, denom); }
+    inline void do_array(const uint32_t *numers, uint32_t *results, size_t n, const libdivide_u32_t *denom) { libdivide_u32_do_array(numers, results, n, denom); }
+    inline void do_array(const int32_t *numers, int32_t *results, size_t n, const libdivide_s32_t *denom) { libdivide_s32_do_array(numers, results, n, denom); }
+    inline void do_array(const uint64_t *numers, uint64_t *results, size_t n, const libdivide_u64_t *denom) { libdivide_u64_do_array(numers, results, n, denom); }
+    inline void do_array(const int64_t *numers, int64_t *results, size_t n, const libdivide_s64_t *denom) { libdivide_s64_do_array(numers, results, n, denom); }
+
+#if LIBDIVIDE_HAS_THREADS
+    inline void do_array_parallel(const uint32_t *numers, uint32_t *results, size_t n, const libdivide_u32_t *denom, libdivide_pool_t *pool) { libdivide_u32_do_array_parallel(numers, results, n, denom, pool); }
+    inline void do_array_parallel(const int32_t *numers, int32_t *results, size_t n, const libdivide_s32_t *denom, libdivide_pool_t *pool) { libdivide_s32_do_array_parallel(numers, results, n, denom, pool); }
+    inline void do_array_parallel(const uint64_t *numers, uint64_t *results, size_t n, const libdivide_u64_t *denom, libdivide_pool_t *pool) { libdivide_u64_do_array_parallel(numers, results, n, denom, pool); }
+    inline void do_array_parallel(const int64_t *numers, int64_t *results, size_t n, const libdivide_s64_t *denom, libdivide_pool_t *pool) { libdivide_s64_do_array_parallel(numers, results, n, denom, pool); }
+#endif
+
+    /* Likewise for the remainders; the vector ones are picked by vector type and denominator type. */
+    inline uint32_t mod(uint32_t numer, const libdivide_u32_t *denom) { return libdivide_u32_mod(numer, denom); }
+    inline int32_t mod(int32_t numer, const libdivide_s32_t *denom) { return libdivide_s32_mod(numer, denom); }
+    inline uint64_t mod(uint64_t numer, const libdivide_u64_t *denom) { return libdivide_u64_mod(numer, denom); }
+    inline int64_t mod(int64_t numer, const libdivide_s64_t *denom) { return libdivide_s64_mod(numer, denom); }
+    inline uint32_t divmod(uint32_t numer, const libdivide_u32_t *denom, uint32_t *remainder) { return libdivide_u32_divmod(numer, denom, remainder); }
+    inline int32_t divmod(int32_t numer, const libdivide_s32_t *denom, int32_t *remainder) { return libdivide_s32_divmod(numer, denom, remainder); }
+    inline uint64_t divmod(uint64_t numer, const libdivide_u64_t *denom, uint64_t *remainder) { return libdivide_u64_divmod(numer, denom, remainder); }
+    inline int64_t divmod(int64_t numer, const libdivide_s64_t *denom, int64_t *remainder) { return libdivide_s64_divmod(numer, denom, remainder); }
+#if LIBDIVIDE_USE_SSE2
+    inline __m128i mod_vector(__m128i numers, const libdivide_u32_t *denom) { return libdivide_4u32_mod_vector(numers, denom); }
+    inline __m128i mod_vector(__m128i numers, const libdivide_s32_t *denom) { return libdivide_4s32_mod_vector(numers, denom); }
+    inline __m128i mod_vector(__m128i numers, const libdivide_u64_t *denom) { return libdivide_2u64_mod_vector(numers, denom); }
+    inline __m128i mod_vector(__m128i numers, const libdivide_s64_t *denom) { return libdivide_2s64_mod_vector(numers, denom); }
+#if LIBDIVIDE_USE_AVX2
+    inline __m256i mod_vector(__m256i numers, const libdivide_u32_t *denom) { return libdivide_8u32_mod_vector(numers, denom); }
+    inline __m256i mod_vector(__m256i numers, const libdivide_s32_t *denom) { return libdivide_8s32_mod_vector(numers, denom); }
+    inline __m256i mod_vector(__m256i numers, const libdivide_u64_t *denom) { return libdivide_4u64_mod_vector(numers, denom); }
+    inline __m256i mod_vector(__m256i numers, const libdivide_s64_t *denom) { return libdivide_4s64_mod_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+    inline __m512i mod_vector(__m512i numers, const libdivide_u32_t *denom) { return libdivide_16u32_mod_vector(numers, denom); }
+    inline __m512i mod_vector(__m512i numers, const libdivide_s32_t *denom) { return libdivide_16s32_mod_vector(numers, denom); }
+    inline __m512i mod_vector(__m512i numers, const libdivide_u64_t *denom) { return libdivide_8u64_mod_vector(numers, denom); }
+    inline __m512i mod_vector(__m512i numers, const libdivide_s64_t *denom) { return libdivide_8s64_mod_vector(numers, denom); }
+#endif
+#else
+#if LIBDIVIDE_VEC64
+    inline libdivide_2u32_t mod_vector(libdivide_2u32_t numers, const libdivide_u32_t *denom) { return libdivide_2u32_mod_vector(numers, denom); }
+    inline libdivide_2s32_t mod_vector(libdivide_2s32_t numers, const libdivide_s32_t *denom) { return libdivide_2s32_mod_vector(numers, denom); }
+    inline libdivide_1u64_t mod_vector(libdivide_1u64_t numers, const libdivide_u64_t *denom) { return libdivide_1u64_mod_vector(numers, denom); }
+    inline libdivide_1s64_t mod_vector(libdivide_1s64_t numers, const libdivide_s64_t *denom) { return libdivide_1s64_mod_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_VEC128
+    inline libdivide_4u32_t mod_vector(libdivide_4u32_t numers, const libdivide_u32_t *denom) { return libdivide_4u32_mod_vector(numers, denom); }
+    inline libdivide_4s32_t mod_vector(libdivide_4s32_t numers, const libdivide_s32_t *denom) { return libdivide_4s32_mod_vector(numers, denom); }
+    inline libdivide_2u64_t mod_vector(libdivide_2u64_t numers, const libdivide_u64_t *denom) { return libdivide_2u64_mod_vector(numers, denom); }
+    inline libdivide_2s64_t mod_vector(libdivide_2s64_t numers, const libdivide_s64_t *denom) { return libdivide_2s64_mod_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_VEC256
+    inline libdivide_8u32_t mod_vector(libdivide_8u32_t numers, const libdivide_u32_t *denom) { return libdivide_8u32_mod_vector(numers, denom); }
+    inline libdivide_8s32_t mod_vector(libdivide_8s32_t numers, const libdivide_s32_t *denom) { return libdivide_8s32_mod_vector(numers, denom); }
+    inline libdivide_4u64_t mod_vector(libdivide_4u64_t numers, const libdivide_u64_t *denom) { return libdivide_4u64_mod_vector(numers, denom); }
+    inline libdivide_4s64_t mod_vector(libdivide_4s64_t numers, const libdivide_s64_t *denom) { return libdivide_4s64_mod_vector(numers, denom); }
+#endif
+#endif
+
+    /* Floor division and Euclidean modulo, which only exist for the signed types. */
+    inline int32_t floor_div(int32_t numer, const libdivide_s32_t *denom) { return libdivide_s32_do_floor(numer, denom); }
+    inline int64_t floor_div(int64_t numer, const libdivide_s64_t *denom) { return libdivide_s64_do_floor(numer, denom); }
+    inline int32_t mod_euclid(int32_t numer, const libdivide_s32_t *denom) { return libdivide_s32_mod_euclid(numer, denom); }
+    inline int64_t mod_euclid(int64_t numer, const libdivide_s64_t *denom) { return libdivide_s64_mod_euclid(numer, denom); }
+#if LIBDIVIDE_USE_SSE2
+    inline __m128i floor_div_vector(__m128i numers, const libdivide_s32_t *denom) { return libdivide_4s32_do_floor_vector(numers, denom); }
+    inline __m128i floor_div_vector(__m128i numers, const libdivide_s64_t *denom) { return libdivide_2s64_do_floor_vector(numers, denom); }
+    inline __m128i mod_euclid_vector(__m128i numers, const libdivide_s32_t *denom) { return libdivide_4s32_mod_euclid_vector(numers, denom); }
+    inline __m128i mod_euclid_vector(__m128i numers, const libdivide_s64_t *denom) { return libdivide_2s64_mod_euclid_vector(numers, denom); }
+#if LIBDIVIDE_USE_AVX2
+    inline __m256i floor_div_vector(__m256i numers, const libdivide_s32_t *denom) { return libdivide_8s32_do_floor_vector(numers, denom); }
+    inline __m256i floor_div_vector(__m256i numers, const libdivide_s64_t *denom) { return libdivide_4s64_do_floor_vector(numers, denom); }
+    inline __m256i mod_euclid_vector(__m256i numers, const libdivide_s32_t *denom) { return libdivide_8s32_mod_euclid_vector(numers, denom); }
+    inline __m256i mod_euclid_vector(__m256i numers, const libdivide_s64_t *denom) { return libdivide_4s64_mod_euclid_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+    inline __m512i floor_div_vector(__m512i numers, const libdivide_s32_t *denom) { return libdivide_16s32_do_floor_vector(numers, denom); }
+    inline __m512i floor_div_vector(__m512i numers, const libdivide_s64_t *denom) { return libdivide_8s64_do_floor_vector(numers, denom); }
+    inline __m512i mod_euclid_vector(__m512i numers, const libdivide_s32_t *denom) { return libdivide_16s32_mod_euclid_vector(numers, denom); }
+    inline __m512i mod_euclid_vector(__m512i numers, const libdivide_s64_t *denom) { return libdivide_8s64_mod_euclid_vector(numers, denom); }
+#endif
+#else
+#if LIBDIVIDE_VEC64
+    inline libdivide_2s32_t floor_div_vector(libdivide_2s32_t numers, const libdivide_s32_t *denom) { return libdivide_2s32_do_floor_vector(numers, denom); }
+    inline libdivide_1s64_t floor_div_vector(libdivide_1s64_t numers, const libdivide_s64_t *denom) { return libdivide_1s64_do_floor_vector(numers, denom); }
+    inline libdivide_2s32_t mod_euclid_vector(libdivide_2s32_t numers, const libdivide_s32_t *denom) { return libdivide_2s32_mod_euclid_vector(numers, denom); }
+    inline libdivide_1s64_t mod_euclid_vector(libdivide_1s64_t numers, const libdivide_s64_t *denom) { return libdivide_1s64_mod_euclid_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_VEC128
+    inline libdivide_4s32_t floor_div_vector(libdivide_4s32_t numers, const libdivide_s32_t *denom) { return libdivide_4s32_do_floor_vector(numers, denom); }
+    inline libdivide_2s64_t floor_div_vector(libdivide_2s64_t numers, const libdivide_s64_t *denom) { return libdivide_2s64_do_floor_vector(numers, denom); }
+    inline libdivide_4s32_t mod_euclid_vector(libdivide_4s32_t numers, const libdivide_s32_t *denom) { return libdivide_4s32_mod_euclid_vector(numers, denom); }
+    inline libdivide_2s64_t mod_euclid_vector(libdivide_2s64_t numers, const libdivide_s64_t *denom) { return libdivide_2s64_mod_euclid_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_VEC256
+    inline libdivide_8s32_t floor_div_vector(libdivide_8s32_t numers, const libdivide_s32_t *denom) { return libdivide_8s32_do_floor_vector(numers, denom); }
+    inline libdivide_4s64_t floor_div_vector(libdivide_4s64_t numers, const libdivide_s64_t *denom) { return libdivide_4s64_do_floor_vector(numers, denom); }
+    inline libdivide_8s32_t mod_euclid_vector(libdivide_8s32_t numers, const libdivide_s32_t *denom) { return libdivide_8s32_mod_euclid_vector(numers, denom); }
+    inline libdivide_4s64_t mod_euclid_vector(libdivide_4s64_t numers, const libdivide_s64_t *denom) { return libdivide_4s64_mod_euclid_vector(numers, denom); }
+#endif
+#endif
+
+    /* Ceiling and round-to-nearest division, and their array forms. */
+    inline uint32_t ceil_div(uint32_t numer, const libdivide_u32_t *denom) { return libdivide_u32_do_ceil(numer, denom); }
+    inline int32_t ceil_div(int32_t numer, const libdivide_s32_t *denom) { return libdivide_s32_do_ceil(numer, denom); }
+    inline uint64_t ceil_div(uint64_t numer, const libdivide_u64_t *denom) { return libdivide_u64_do_ceil(numer, denom); }
+    inline int64_t ceil_div(int64_t numer, const libdivide_s64_t *denom) { return libdivide_s64_do_ceil(numer, denom); }
+    inline uint32_t round_div(uint32_t numer, const libdivide_u32_t *denom) { return libdivide_u32_do_round(numer, denom); }
+    inline int32_t round_div(int32_t numer, const libdivide_s32_t *denom) { return libdivide_s32_do_round(numer, denom); }
+    inline uint64_t round_div(uint64_t numer, const libdivide_u64_t *denom) { return libdivide_u64_do_round(numer, denom); }
+    inline int64_t round_div(int64_t numer, const libdivide_s64_t *denom) { return libdivide_s64_do_round(numer, denom); }
+    inline void ceil_div_array(const uint32_t *numers, uint32_t *results, size_t n, const libdivide_u32_t *denom) { libdivide_u32_do_ceil_array(numers, results, n, denom); }
+    inline void ceil_div_array(const int32_t *numers, int32_t *results, size_t n, const libdivide_s32_t *denom) { libdivide_s32_do_ceil_array(numers, results, n, denom); }
+    inline void ceil_div_array(const uint64_t *numers, uint64_t *results, size_t n, const libdivide_u64_t *denom) { libdivide_u64_do_ceil_array(numers, results, n, denom); }
+    inline void ceil_div_array(const int64_t *numers, int64_t *results, size_t n, const libdivide_s64_t *denom) { libdivide_s64_do_ceil_array(numers, results, n, denom); }
+    inline void round_div_array(const uint32_t *numers, uint32_t *results, size_t n, const libdivide_u32_t *denom) { libdivide_u32_do_round_array(numers, results, n, denom); }
+    inline void round_div_array(const int32_t *numers, int32_t *results, size_t n, const libdivide_s32_t *denom) { libdivide_s32_do_round_array(numers, results, n, denom); }
+    inline void round_div_array(const uint64_t *numers, uint64_t *results, size_t n, const libdivide_u64_t *denom) { libdivide_u64_do_round_array(numers, results, n, denom); }
+    inline void round_div_array(const int64_t *numers, int64_t *results, size_t n, const libdivide_s64_t *denom) { libdivide_s64_do_round_array(numers, results, n, denom); }
+#if LIBDIVIDE_USE_SSE2
+    inline __m128i ceil_div_vector(__m128i numers, const libdivide_u32_t *denom) { return libdivide_4u32_do_ceil_vector(numers, denom); }
+    inline __m128i ceil_div_vector(__m128i numers, const libdivide_s32_t *denom) { return libdivide_4s32_do_ceil_vector(numers, denom); }
+    inline __m128i ceil_div_vector(__m128i numers, const libdivide_u64_t *denom) { return libdivide_2u64_do_ceil_vector(numers, denom); }
+    inline __m128i ceil_div_vector(__m128i numers, const libdivide_s64_t *denom) { return libdivide_2s64_do_ceil_vector(numers, denom); }
+    inline __m128i round_div_vector(__m128i numers, const libdivide_u32_t *denom) { return libdivide_4u32_do_round_vector(numers, denom); }
+    inline __m128i round_div_vector(__m128i numers, const libdivide_s32_t *denom) { return libdivide_4s32_do_round_vector(numers, denom); }
+    inline __m128i round_div_vector(__m128i numers, const libdivide_u64_t *denom) { return libdivide_2u64_do_round_vector(numers, denom); }
+    inline __m128i round_div_vector(__m128i numers, const libdivide_s64_t *denom) { return libdivide_2s64_do_round_vector(numers, denom); }
+#if LIBDIVIDE_USE_AVX2
+    inline __m256i ceil_div_vector(__m256i numers, const libdivide_u32_t *denom) { return libdivide_8u32_do_ceil_vector(numers, denom); }
+    inline __m256i ceil_div_vector(__m256i numers, const libdivide_s32_t *denom) { return libdivide_8s32_do_ceil_vector(numers, denom); }
+    inline __m256i ceil_div_vector(__m256i numers, const libdivide_u64_t *denom) { return libdivide_4u64_do_ceil_vector(numers, denom); }
+    inline __m256i ceil_div_vector(__m256i numers, const libdivide_s64_t *denom) { return libdivide_4s64_do_ceil_vector(numers, denom); }
+    inline __m256i round_div_vector(__m256i numers, const libdivide_u32_t *denom) { return libdivide_8u32_do_round_vector(numers, denom); }
+    inline __m256i round_div_vector(__m256i numers, const libdivide_s32_t *denom) { return libdivide_8s32_do_round_vector(numers, denom); }
+    inline __m256i round_div_vector(__m256i numers, const libdivide_u64_t *denom) { return libdivide_4u64_do_round_vector(numers, denom); }
+    inline __m256i round_div_vector(__m256i numers, const libdivide_s64_t *denom) { return libdivide_4s64_do_round_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+    inline __m512i ceil_div_vector(__m512i numers, const libdivide_u32_t *denom) { return libdivide_16u32_do_ceil_vector(numers, denom); }
+    inline __m512i ceil_div_vector(__m512i numers, const libdivide_s32_t *denom) { return libdivide_16s32_do_ceil_vector(numers, denom); }
+    inline __m512i ceil_div_vector(__m512i numers, const libdivide_u64_t *denom) { return libdivide_8u64_do_ceil_vector(numers, denom); }
+    inline __m512i ceil_div_vector(__m512i numers, const libdivide_s64_t *denom) { return libdivide_8s64_do_ceil_vector(numers, denom); }
+    inline __m512i round_div_vector(__m512i numers, const libdivide_u32_t *denom) { return libdivide_16u32_do_round_vector(numers, denom); }
+    inline __m512i round_div_vector(__m512i numers, const libdivide_s32_t *denom) { return libdivide_16s32_do_round_vector(numers, denom); }
+    inline __m512i round_div_vector(__m512i numers, const libdivide_u64_t *denom) { return libdivide_8u64_do_round_vector(numers, denom); }
+    inline __m512i round_div_vector(__m512i numers, const libdivide_s64_t *denom) { return libdivide_8s64_do_round_vector(numers, denom); }
+#endif
+#else
+#if LIBDIVIDE_VEC64
+    inline libdivide_2u32_t ceil_div_vector(libdivide_2u32_t numers, const libdivide_u32_t *denom) { return libdivide_2u32_do_ceil_vector(numers, denom); }
+    inline libdivide_2s32_t ceil_div_vector(libdivide_2s32_t numers, const libdivide_s32_t *denom) { return libdivide_2s32_do_ceil_vector(numers, denom); }
+    inline libdivide_1u64_t ceil_div_vector(libdivide_1u64_t numers, const libdivide_u64_t *denom) { return libdivide_1u64_do_ceil_vector(numers, denom); }
+    inline libdivide_1s64_t ceil_div_vector(libdivide_1s64_t numers, const libdivide_s64_t *denom) { return libdivide_1s64_do_ceil_vector(numers, denom); }
+    inline libdivide_2u32_t round_div_vector(libdivide_2u32_t numers, const libdivide_u32_t *denom) { return libdivide_2u32_do_round_vector(numers, denom); }
+    inline libdivide_2s32_t round_div_vector(libdivide_2s32_t numers, const libdivide_s32_t *denom) { return libdivide_2s32_do_round_vector(numers, denom); }
+    inline libdivide_1u64_t round_div_vector(libdivide_1u64_t numers, const libdivide_u64_t *denom) { return libdivide_1u64_do_round_vector(numers, denom); }
+    inline libdivide_1s64_t round_div_vector(libdivide_1s64_t numers, const libdivide_s64_t *denom) { return libdivide_1s64_do_round_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_VEC128
+    inline libdivide_4u32_t ceil_div_vector(libdivide_4u32_t numers, const libdivide_u32_t *denom) { return libdivide_4u32_do_ceil_vector(numers, denom); }
+    inline libdivide_4s32_t ceil_div_vector(libdivide_4s32_t numers, const libdivide_s32_t *denom) { return libdivide_4s32_do_ceil_vector(numers, denom); }
+    inline libdivide_2u64_t ceil_div_vector(libdivide_2u64_t numers, const libdivide_u64_t *denom) { return libdivide_2u64_do_ceil_vector(numers, denom); }
+    inline libdivide_2s64_t ceil_div_vector(libdivide_2s64_t numers, const libdivide_s64_t *denom) { return libdivide_2s64_do_ceil_vector(numers, denom); }
+    inline libdivide_4u32_t round_div_vector(libdivide_4u32_t numers, const libdivide_u32_t *denom) { return libdivide_4u32_do_round_vector(numers, denom); }
+    inline libdivide_4s32_t round_div_vector(libdivide_4s32_t numers, const libdivide_s32_t *denom) { return libdivide_4s32_do_round_vector(numers, denom); }
+    inline libdivide_2u64_t round_div_vector(libdivide_2u64_t numers, const libdivide_u64_t *denom) { return libdivide_2u64_do_round_vector(numers, denom); }
+    inline libdivide_2s64_t round_div_vector(libdivide_2s64_t numers, const libdivide_s64_t *denom) { return libdivide_2s64_do_round_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_VEC256
+    inline libdivide_8u32_t ceil_div_vector(libdivide_8u32_t numers, const libdivide_u32_t *denom) { return libdivide_8u32_do_ceil_vector(numers, denom); }
+    inline libdivide_8s32_t ceil_div_vector(libdivide_8s32_t numers, const libdivide_s32_t *denom) { return libdivide_8s32_do_ceil_vector(numers, denom); }
+    inline libdivide_4u64_t ceil_div_vector(libdivide_4u64_t numers, const libdivide_u64_t *denom) { return libdivide_4u64_do_ceil_vector(numers, denom); }
+    inline libdivide_4s64_t ceil_div_vector(libdivide_4s64_t numers, const libdivide_s64_t *denom) { return libdivide_4s64_do_ceil_vector(numers, denom); }
+    inline libdivide_8u32_t round_div_vector(libdivide_8u32_t numers, const libdivide_u32_t *denom) { return libdivide_8u32_do_round_vector(numers, denom); }
+    inline libdivide_8s32_t round_div_vector(libdivide_8s32_t numers, const libdivide_s32_t *denom) { return libdivide_8s32_do_round_vector(numers, denom); }
+    inline libdivide_4u64_t round_div_vector(libdivide_4u64_t numers, const libdivide_u64_t *denom) { return libdivide_4u64_do_round_vector(numers, denom); }
+    inline libdivide_4s64_t round_div_vector(libdivide_4s64_t numers, const libdivide_s64_t *denom) { return libdivide_4s64_do_round_vector(numers, denom); }
+#endif
+#endif
+
+    /* And for fastmod, which only has unsigned types, and vectors on x86. */
+    template<class T> struct fastmod_mid { };
+    template<> struct fastmod_mid<uint32_t> { typedef struct libdivide_u32_fastmod_t DenomType; };
+    template<> struct fastmod_mid<uint64_t> { typedef struct libdivide_u64_fastmod_t DenomType; };
+    inline libdivide_u32_fastmod_t fastmod_gen(uint32_t d) { return libdivide_u32_fastmod_gen(d); }
+    inline libdivide_u64_fastmod_t fastmod_gen(uint64_t d) { return libdivide_u64_fastmod_gen(d); }
+    inline uint32_t fastmod(uint32_t numer, const libdivide_u32_fastmod_t *denom) { return libdivide_u32_fastmod(numer, denom); }
+    inline uint64_t fastmod(uint64_t numer, const libdivide_u64_fastmod_t *denom) { return libdivide_u64_fastmod(numer, denom); }
+    inline void fastmod_array(const uint32_t *numers, uint32_t *results, size_t n, const libdivide_u32_fastmod_t *denom) { libdivide_u32_fastmod_array(numers, results, n, denom); }
+    inline void fastmod_array(const uint64_t *numers, uint64_t *results, size_t n, const libdivide_u64_fastmod_t *denom) { libdivide_u64_fastmod_array(numers, results, n, denom); }
+#if LIBDIVIDE_USE_SSE2
+    inline __m128i fastmod_vector(__m128i numers, const libdivide_u32_fastmod_t *denom) { return libdivide_4u32_fastmod_vector(numers, denom); }
+    inline __m128i fastmod_vector(__m128i numers, const libdivide_u64_fastmod_t *denom) { return libdivide_2u64_fastmod_vector(numers, denom); }
+#if LIBDIVIDE_USE_AVX2
+    inline __m256i fastmod_vector(__m256i numers, const libdivide_u32_fastmod_t *denom) { return libdivide_8u32_fastmod_vector(numers, denom); }
+    inline __m256i fastmod_vector(__m256i numers, const libdivide_u64_fastmod_t *denom) { return libdivide_4u64_fastmod_vector(numers, denom); }
+#endif
+#endif
+
+    /* And for the divisibility tests. */
+    template<class T> struct divisible_mid { };
+    template<> struct divisible_mid<uint32_t> { typedef struct libdivide_u32_divisible_t DenomType; };
+    template<> struct divisible_mid<int32_t> { typedef struct libdivide_s32_divisible_t DenomType; };
+    template<> struct divisible_mid<uint64_t> { typedef struct libdivide_u64_divisible_t DenomType; };
+    template<> struct divisible_mid<int64_t> { typedef struct libdivide_s64_divisible_t DenomType; };
+    inline libdivide_u32_divisible_t divisible_gen(uint32_t d) { return libdivide_u32_divisible_gen(d); }
+    inline libdivide_s32_divisible_t divisible_gen(int32_t d) { return libdivide_s32_divisible_gen(d); }
+    inline libdivide_u64_divisible_t divisible_gen(uint64_t d) { return libdivide_u64_divisible_gen(d); }
+    inline libdivide_s64_divisible_t divisible_gen(int64_t d) { return libdivide_s64_divisible_gen(d); }
+    inline int is_divisible(uint32_t numer, const libdivide_u32_divisible_t *denom) { return libdivide_u32_is_divisible(numer, denom); }
+    inline int is_divisible(int32_t numer, const libdivide_s32_divisible_t *denom) { return libdivide_s32_is_divisible(numer, denom); }
+    inline int is_divisible(uint64_t numer, const libdivide_u64_divisible_t *denom) { return libdivide_u64_is_divisible(numer, denom); }
+    inline int is_divisible(int64_t numer, const libdivide_s64_divisible_t *denom) { return libdivide_s64_is_divisible(numer, denom); }
+#if LIBDIVIDE_USE_SSE2
+    inline __m128i is_divisible_vector(__m128i numers, const libdivide_u32_divisible_t *denom) { return libdivide_4u32_is_divisible_vector(numers, denom); }
+    inline __m128i is_divisible_vector(__m128i numers, const libdivide_s32_divisible_t *denom) { return libdivide_4s32_is_divisible_vector(numers, denom); }
+    inline __m128i is_divisible_vector(__m128i numers, const libdivide_u64_divisible_t *denom) { return libdivide_2u64_is_divisible_vector(numers, denom); }
+    inline __m128i is_divisible_vector(__m128i numers, const libdivide_s64_divisible_t *denom) { return libdivide_2s64_is_divisible_vector(numers, denom); }
+#if LIBDIVIDE_USE_AVX2
+    inline __m256i is_divisible_vector(__m256i numers, const libdivide_u32_divisible_t *denom) { return libdivide_8u32_is_divisible_vector(numers, denom); }
+    inline __m256i is_divisible_vector(__m256i numers, const libdivide_s32_divisible_t *denom) { return libdivide_8s32_is_divisible_vector(numers, denom); }
+    inline __m256i is_divisible_vector(__m256i numers, const libdivide_u64_divisible_t *denom) { return libdivide_4u64_is_divisible_vector(numers, denom); }
+    inline __m256i is_divisible_vector(__m256i numers, const libdivide_s64_divisible_t *denom) { return libdivide_4s64_is_divisible_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+    inline __mmask16 is_divisible_vector(__m512i numers, const libdivide_u32_divisible_t *denom) { return libdivide_16u32_is_divisible_vector(numers, denom); }
+    inline __mmask16 is_divisible_vector(__m512i numers, const libdivide_s32_divisible_t *denom) { return libdivide_16s32_is_divisible_vector(numers, denom); }
+    inline __mmask16 is_divisible_vector(__m512i numers, const libdivide_u64_divisible_t *denom) { return libdivide_8u64_is_divisible_vector(numers, denom); }
+    inline __mmask16 is_divisible_vector(__m512i numers, const libdivide_s64_divisible_t *denom) { return libdivide_8s64_is_divisible_vector(numers, denom); }
+#endif
+#else
+#if LIBDIVIDE_VEC64
+    inline libdivide_2u32_t is_divisible_vector(libdivide_2u32_t numers, const libdivide_u32_divisible_t *denom) { return libdivide_2u32_is_divisible_vector(numers, denom); }
+    inline libdivide_2s32_t is_divisible_vector(libdivide_2s32_t numers, const libdivide_s32_divisible_t *denom) { return libdivide_2s32_is_divisible_vector(numers, denom); }
+    inline libdivide_1u64_t is_divisible_vector(libdivide_1u64_t numers, const libdivide_u64_divisible_t *denom) { return libdivide_1u64_is_divisible_vector(numers, denom); }
+    inline libdivide_1s64_t is_divisible_vector(libdivide_1s64_t numers, const libdivide_s64_divisible_t *denom) { return libdivide_1s64_is_divisible_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_VEC128
+    inline libdivide_4u32_t is_divisible_vector(libdivide_4u32_t numers, const libdivide_u32_divisible_t *denom) { return libdivide_4u32_is_divisible_vector(numers, denom); }
+    inline libdivide_4s32_t is_divisible_vector(libdivide_4s32_t numers, const libdivide_s32_divisible_t *denom) { return libdivide_4s32_is_divisible_vector(numers, denom); }
+    inline libdivide_2u64_t is_divisible_vector(libdivide_2u64_t numers, const libdivide_u64_divisible_t *denom) { return libdivide_2u64_is_divisible_vector(numers, denom); }
+    inline libdivide_2s64_t is_divisible_vector(libdivide_2s64_t numers, const libdivide_s64_divisible_t *denom) { return libdivide_2s64_is_divisible_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_VEC256
+    inline libdivide_8u32_t is_divisible_vector(libdivide_8u32_t numers, const libdivide_u32_divisible_t *denom) { return libdivide_8u32_is_divisible_vector(numers, denom); }
+    inline libdivide_8s32_t is_divisible_vector(libdivide_8s32_t numers, const libdivide_s32_divisible_t *denom) { return libdivide_8s32_is_divisible_vector(numers, denom); }
+    inline libdivide_4u64_t is_divisible_vector(libdivide_4u64_t numers, const libdivide_u64_divisible_t *denom) { return libdivide_4u64_is_divisible_vector(numers, denom); }
+    inline libdivide_4s64_t is_divisible_vector(libdivide_4s64_t numers, const libdivide_s64_divisible_t *denom) { return libdivide_4s64_is_divisible_vector(numers, denom); }
+#endif
+#endif
+
+    /* And for exact division. */
+    template<class T> struct exact_mid { };
+    template<> struct exact_mid<uint32_t> { typedef struct libdivide_u32_exact_t DenomType; };
+    template<> struct exact_mid<int32_t> { typedef struct libdivide_s32_exact_t DenomType; };
+    template<> struct exact_mid<uint64_t> { typedef struct libdivide_u64_exact_t DenomType; };
+    template<> struct exact_mid<int64_t> { typedef struct libdivide_s64_exact_t DenomType; };
+    inline libdivide_u32_exact_t exact_gen(uint32_t d) { return libdivide_u32_exact_gen(d); }
+    inline libdivide_s32_exact_t exact_gen(int32_t d) { return libdivide_s32_exact_gen(d); }
+    inline libdivide_u64_exact_t exact_gen(uint64_t d) { return libdivide_u64_exact_gen(d); }
+    inline libdivide_s64_exact_t exact_gen(int64_t d) { return libdivide_s64_exact_gen(d); }
+    inline uint32_t exact_do(uint32_t numer, const libdivide_u32_exact_t *denom) { return libdivide_u32_exact_do(numer, denom); }
+    inline int32_t exact_do(int32_t numer, const libdivide_s32_exact_t *denom) { return libdivide_s32_exact_do(numer, denom); }
+    inline uint64_t exact_do(uint64_t numer, const libdivide_u64_exact_t *denom) { return libdivide_u64_exact_do(numer, denom); }
+    inline int64_t exact_do(int64_t numer, const libdivide_s64_exact_t *denom) { return libdivide_s64_exact_do(numer, denom); }
+#if LIBDIVIDE_USE_SSE2
+    inline __m128i exact_do_vector(__m128i numers, const libdivide_u32_exact_t *denom) { return libdivide_4u32_exact_do_vector(numers, denom); }
+    inline __m128i exact_do_vector(__m128i numers, const libdivide_s32_exact_t *denom) { return libdivide_4s32_exact_do_vector(numers, denom); }
+    inline __m128i exact_do_vector(__m128i numers, const libdivide_u64_exact_t *denom) { return libdivide_2u64_exact_do_vector(numers, denom); }
+    inline __m128i exact_do_vector(__m128i numers, const libdivide_s64_exact_t *denom) { return libdivide_2s64_exact_do_vector(numers, denom); }
+#if LIBDIVIDE_USE_AVX2
+    inline __m256i exact_do_vector(__m256i numers, const libdivide_u32_exact_t *denom) { return libdivide_8u32_exact_do_vector(numers, denom); }
+    inline __m256i exact_do_vector(__m256i numers, const libdivide_s32_exact_t *denom) { return libdivide_8s32_exact_do_vector(numers, denom); }
+    inline __m256i exact_do_vector(__m256i numers, const libdivide_u64_exact_t *denom) { return libdivide_4u64_exact_do_vector(numers, denom); }
+    inline __m256i exact_do_vector(__m256i numers, const libdivide_s64_exact_t *denom) { return libdivide_4s64_exact_do_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+    inline __m512i exact_do_vector(__m512i numers, const libdivide_u32_exact_t *denom) { return libdivide_16u32_exact_do_vector(numers, denom); }
+    inline __m512i exact_do_vector(__m512i numers, const libdivide_s32_exact_t *denom) { return libdivide_16s32_exact_do_vector(numers, denom); }
+    inline __m512i exact_do_vector(__m512i numers, const libdivide_u64_exact_t *denom) { return libdivide_8u64_exact_do_vector(numers, denom); }
+    inline __m512i exact_do_vector(__m512i numers, const libdivide_s64_exact_t *denom) { return libdivide_8s64_exact_do_vector(numers, denom); }
+#endif
+#else
+#if LIBDIVIDE_VEC64
+    inline libdivide_2u32_t exact_do_vector(libdivide_2u32_t numers, const libdivide_u32_exact_t *denom) { return libdivide_2u32_exact_do_vector(numers, denom); }
+    inline libdivide_2s32_t exact_do_vector(libdivide_2s32_t numers, const libdivide_s32_exact_t *denom) { return libdivide_2s32_exact_do_vector(numers, denom); }
+    inline libdivide_1u64_t exact_do_vector(libdivide_1u64_t numers, const libdivide_u64_exact_t *denom) { return libdivide_1u64_exact_do_vector(numers, denom); }
+    inline libdivide_1s64_t exact_do_vector(libdivide_1s64_t numers, const libdivide_s64_exact_t *denom) { return libdivide_1s64_exact_do_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_VEC128
+    inline libdivide_4u32_t exact_do_vector(libdivide_4u32_t numers, const libdivide_u32_exact_t *denom) { return libdivide_4u32_exact_do_vector(numers, denom); }
+    inline libdivide_4s32_t exact_do_vector(libdivide_4s32_t numers, const libdivide_s32_exact_t *denom) { return libdivide_4s32_exact_do_vector(numers, denom); }
+    inline libdivide_2u64_t exact_do_vector(libdivide_2u64_t numers, const libdivide_u64_exact_t *denom) { return libdivide_2u64_exact_do_vector(numers, denom); }
+    inline libdivide_2s64_t exact_do_vector(libdivide_2s64_t numers, const libdivide_s64_exact_t *denom) { return libdivide_2s64_exact_do_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_VEC256
+    inline libdivide_8u32_t exact_do_vector(libdivide_8u32_t numers, const libdivide_u32_exact_t *denom) { return libdivide_8u32_exact_do_vector(numers, denom); }
+    inline libdivide_8s32_t exact_do_vector(libdivide_8s32_t numers, const libdivide_s32_exact_t *denom) { return libdivide_8s32_exact_do_vector(numers, denom); }
+    inline libdivide_4u64_t exact_do_vector(libdivide_4u64_t numers, const libdivide_u64_exact_t *denom) { return libdivide_4u64_exact_do_vector(numers, denom); }
+    inline libdivide_4s64_t exact_do_vector(libdivide_4s64_t numers, const libdivide_s64_exact_t *denom) { return libdivide_4s64_exact_do_vector(numers, denom); }
+#endif
+#endif
+
+    /* And for branchfree division. */
+    template<class T> struct branchfree_mid { };
+    template<> struct branchfree_mid<uint32_t> { typedef struct libdivide_u32_branchfree_t DenomType; };
+    template<> struct branchfree_mid<int32_t> { typedef struct libdivide_s32_branchfree_t DenomType; };
+    template<> struct branchfree_mid<uint64_t> { typedef struct libdivide_u64_branchfree_t DenomType; };
+    template<> struct branchfree_mid<int64_t> { typedef struct libdivide_s64_branchfree_t DenomType; };
+    inline libdivide_u32_branchfree_t branchfree_gen(uint32_t d) { return libdivide_u32_branchfree_gen(d); }
+    inline libdivide_s32_branchfree_t branchfree_gen(int32_t d) { return libdivide_s32_branchfree_gen(d); }
+    inline libdivide_u64_branchfree_t branchfree_gen(uint64_t d) { return libdivide_u64_branchfree_gen(d); }
+    inline libdivide_s64_branchfree_t branchfree_gen(int64_t d) { return libdivide_s64_branchfree_gen(d); }
+    inline uint32_t branchfree_do(uint32_t numer, const libdivide_u32_branchfree_t *denom) { return libdivide_u32_branchfree_do(numer, denom); }
+    inline int32_t branchfree_do(int32_t numer, const libdivide_s32_branchfree_t *denom) { return libdivide_s32_branchfree_do(numer, denom); }
+    inline uint64_t branchfree_do(uint64_t numer, const libdivide_u64_branchfree_t *denom) { return libdivide_u64_branchfree_do(numer, denom); }
+    inline int64_t branchfree_do(int64_t numer, const libdivide_s64_branchfree_t *denom) { return libdivide_s64_branchfree_do(numer, denom); }
+    inline void branchfree_do_array(const uint32_t *numers, uint32_t *results, size_t n, const libdivide_u32_branchfree_t *denom) { libdivide_u32_branchfree_do_array(numers, results, n, denom); }
+    inline void branchfree_do_array(const int32_t *numers, int32_t *results, size_t n, const libdivide_s32_branchfree_t *denom) { libdivide_s32_branchfree_do_array(numers, results, n, denom); }
+    inline void branchfree_do_array(const uint64_t *numers, uint64_t *results, size_t n, const libdivide_u64_branchfree_t *denom) { libdivide_u64_branchfree_do_array(numers, results, n, denom); }
+    inline void branchfree_do_array(const int64_t *numers, int64_t *results, size_t n, const libdivide_s64_branchfree_t *denom) { libdivide_s64_branchfree_do_array(numers, results, n, denom); }
+#if LIBDIVIDE_USE_SSE2
+    inline __m128i branchfree_do_vector(__m128i numers, const libdivide_u32_branchfree_t *denom) { return libdivide_4u32_branchfree_do_vector(numers, denom); }
+    inline __m128i branchfree_do_vector(__m128i numers, const libdivide_s32_branchfree_t *denom) { return libdivide_4s32_branchfree_do_vector(numers, denom); }
+    inline __m128i branchfree_do_vector(__m128i numers, const libdivide_u64_branchfree_t *denom) { return libdivide_2u64_branchfree_do_vector(numers, denom); }
+    inline __m128i branchfree_do_vector(__m128i numers, const libdivide_s64_branchfree_t *denom) { return libdivide_2s64_branchfree_do_vector(numers, denom); }
+#if LIBDIVIDE_USE_AVX2
+    inline __m256i branchfree_do_vector(__m256i numers, const libdivide_u32_branchfree_t *denom) { return libdivide_8u32_branchfree_do_vector(numers, denom); }
+    inline __m256i branchfree_do_vector(__m256i numers, const libdivide_s32_branchfree_t *denom) { return libdivide_8s32_branchfree_do_vector(numers, denom); }
+    inline __m256i branchfree_do_vector(__m256i numers, const libdivide_u64_branchfree_t *denom) { return libdivide_4u64_branchfree_do_vector(numers, denom); }
+    inline __m256i branchfree_do_vector(__m256i numers, const libdivide_s64_branchfree_t *denom) { return libdivide_4s64_branchfree_do_vector(numers, denom); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+    inline __m512i branchfree_do_vector(__m512i numers, const libdivide_u32_branchfree_t *denom) { return libdivide_16u32_branchfree_do_vector(numers, denom); }
+    inline __m512i branchfree_do_vector(__m512i numers, const libdivide_s32_branchfree_t *denom) { return libdivide_16s32_branchfree_do_vector(numers, denom); }
+    inline __m512i branchfree_do_vector(__m512i numers, const libdivide_u64_branchfree_t *denom) { return libdivide_8u64_branchfree_do_vector(numers, denom); }
+    inline __m512i branchfree_do_vector(__m512i numers, const libdivide_s64_branchfree_t *denom) { return libdivide_8s64_branchfree_do_vector(numers, denom); }
+#endif
+#endif
+    inline void branchfree_do_array_indexed(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const libdivide_u32_branchfree_t *table) { libdivide_u32_branchfree_do_array_indexed(numers, indices, results, n, table); }
+    inline void branchfree_do_array_indexed(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const libdivide_s32_branchfree_t *table) { libdivide_s32_branchfree_do_array_indexed(numers, indices, results, n, table); }
+    inline void branchfree_do_array_indexed(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const libdivide_u64_branchfree_t *table) { libdivide_u64_branchfree_do_array_indexed(numers, indices, results, n, table); }
+    inline void branchfree_do_array_indexed(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const libdivide_s64_branchfree_t *table) { libdivide_s64_branchfree_do_array_indexed(numers, indices, results, n, table); }
+#if LIBDIVIDE_USE_SSE2
+    inline __m128i branchfree_do_gather(__m128i numers, __m128i indices, const libdivide_u32_branchfree_t *table) { return libdivide_4u32_branchfree_do_gather(numers, indices, table); }
+    inline __m128i branchfree_do_gather(__m128i numers, __m128i indices, const libdivide_s32_branchfree_t *table) { return libdivide_4s32_branchfree_do_gather(numers, indices, table); }
+    inline __m128i branchfree_do_gather(__m128i numers, __m128i indices, const libdivide_u64_branchfree_t *table) { return libdivide_2u64_branchfree_do_gather(numers, indices, table); }
+    inline __m128i branchfree_do_gather(__m128i numers, __m128i indices, const libdivide_s64_branchfree_t *table) { return libdivide_2s64_branchfree_do_gather(numers, indices, table); }
+#if LIBDIVIDE_USE_AVX2
+    inline __m256i branchfree_do_gather(__m256i numers, __m256i indices, const libdivide_u32_branchfree_t *table) { return libdivide_8u32_branchfree_do_gather(numers, indices, table); }
+    inline __m256i branchfree_do_gather(__m256i numers, __m256i indices, const libdivide_s32_branchfree_t *table) { return libdivide_8s32_branchfree_do_gather(numers, indices, table); }
+    inline __m256i branchfree_do_gather(__m256i numers, __m128i indices, const libdivide_u64_branchfree_t *table) { return libdivide_4u64_branchfree_do_gather(numers, indices, table); }
+    inline __m256i branchfree_do_gather(__m256i numers, __m128i indices, const libdivide_s64_branchfree_t *table) { return libdivide_4s64_branchfree_do_gather(numers, indices, table); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+    inline __m512i branchfree_do_gather(__m512i numers, __m512i indices, const libdivide_u32_branchfree_t *table) { return libdivide_16u32_branchfree_do_gather(numers, indices, table); }
+    inline __m512i branchfree_do_gather(__m512i numers, __m512i indices, const libdivide_s32_branchfree_t *table) { return libdivide_16s32_branchfree_do_gather(numers, indices, table); }
+    inline __m512i branchfree_do_gather(__m512i numers, __m256i indices, const libdivide_u64_branchfree_t *table) { return libdivide_8u64_branchfree_do_gather(numers, indices, table); }
+    inline __m512i branchfree_do_gather(__m512i numers, __m256i indices, const libdivide_s64_branchfree_t *table) { return libdivide_8s64_branchfree_do_gather(numers, indices, table); }
+#endif
+#endif
+
+    /* And for the divider arrays. */
+    template<class T> struct array_mid { };
+    template<> struct array_mid<uint32_t> { typedef struct libdivide_u32_array_t ArrayType; };
+    template<> struct array_mid<int32_t> { typedef struct libdivide_s32_array_t ArrayType; };
+    template<> struct array_mid<uint64_t> { typedef struct libdivide_u64_array_t ArrayType; };
+    template<> struct array_mid<int64_t> { typedef struct libdivide_s64_array_t ArrayType; };
+    inline void array_gen(const uint32_t *d, libdivide_u32_array_t *array, size_t n) { libdivide_u32_array_gen(d, array, n); }
+    inline void array_gen(const int32_t *d, libdivide_s32_array_t *array, size_t n) { libdivide_s32_array_gen(d, array, n); }
+    inline void array_gen(const uint64_t *d, libdivide_u64_array_t *array, size_t n) { libdivide_u64_array_gen(d, array, n); }
+    inline void array_gen(const int64_t *d, libdivide_s64_array_t *array, size_t n) { libdivide_s64_array_gen(d, array, n); }
+    inline uint32_t array_do(uint32_t numer, size_t index, const libdivide_u32_array_t *array) { return libdivide_u32_array_do(numer, index, array); }
+    inline int32_t array_do(int32_t numer, size_t index, const libdivide_s32_array_t *array) { return libdivide_s32_array_do(numer, index, array); }
+    inline uint64_t array_do(uint64_t numer, size_t index, const libdivide_u64_array_t *array) { return libdivide_u64_array_do(numer, index, array); }
+    inline int64_t array_do(int64_t numer, size_t index, const libdivide_s64_array_t *array) { return libdivide_s64_array_do(numer, index, array); }
+    inline void array_do_indexed(const uint32_t *numers, const uint32_t *indices, uint32_t *results, size_t n, const libdivide_u32_array_t *array) { libdivide_u32_array_do_indexed(numers, indices, results, n, array); }
+    inline void array_do_indexed(const int32_t *numers, const uint32_t *indices, int32_t *results, size_t n, const libdivide_s32_array_t *array) { libdivide_s32_array_do_indexed(numers, indices, results, n, array); }
+    inline void array_do_indexed(const uint64_t *numers, const uint32_t *indices, uint64_t *results, size_t n, const libdivide_u64_array_t *array) { libdivide_u64_array_do_indexed(numers, indices, results, n, array); }
+    inline void array_do_indexed(const int64_t *numers, const uint32_t *indices, int64_t *results, size_t n, const libdivide_s64_array_t *array) { libdivide_s64_array_do_indexed(numers, indices, results, n, array); }
+#if LIBDIVIDE_USE_SSE2
+    inline __m128i array_do_gather(__m128i numers, __m128i indices, const libdivide_u32_array_t *array) { return libdivide_4u32_array_do_gather(numers, indices, array); }
+    inline __m128i array_do_gather(__m128i numers, __m128i indices, const libdivide_s32_array_t *array) { return libdivide_4s32_array_do_gather(numers, indices, array); }
+    inline __m128i array_do_gather(__m128i numers, __m128i indices, const libdivide_u64_array_t *array) { return libdivide_2u64_array_do_gather(numers, indices, array); }
+    inline __m128i array_do_gather(__m128i numers, __m128i indices, const libdivide_s64_array_t *array) { return libdivide_2s64_array_do_gather(numers, indices, array); }
+#if LIBDIVIDE_USE_AVX2
+    inline __m256i array_do_gather(__m256i numers, __m256i indices, const libdivide_u32_array_t *array) { return libdivide_8u32_array_do_gather(numers, indices, array); }
+    inline __m256i array_do_gather(__m256i numers, __m256i indices, const libdivide_s32_array_t *array) { return libdivide_8s32_array_do_gather(numers, indices, array); }
+    inline __m256i array_do_gather(__m256i numers, __m128i indices, const libdivide_u64_array_t *array) { return libdivide_4u64_array_do_gather(numers, indices, array); }
+    inline __m256i array_do_gather(__m256i numers, __m128i indices, const libdivide_s64_array_t *array) { return libdivide_4s64_array_do_gather(numers, indices, array); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+    inline __m512i array_do_gather(__m512i numers, __m512i indices, const libdivide_u32_array_t *array) { return libdivide_16u32_array_do_gather(numers, indices, array); }
+    inline __m512i array_do_gather(__m512i numers, __m512i indices, const libdivide_s32_array_t *array) { return libdivide_16s32_array_do_gather(numers, indices, array); }
+    inline __m512i array_do_gather(__m512i numers, __m256i indices, const libdivide_u64_array_t *array) { return libdivide_8u64_array_do_gather(numers, indices, array); }
+    inline __m512i array_do_gather(__m512i numers, __m256i indices, const libdivide_s64_array_t *array) { return libdivide_8s64_array_do_gather(numers, indices, array); }
+#endif
+#endif
+
+    /* Overloads of the generating functions, one at a time and in batches. */
+    inline libdivide_u32_t gen(uint32_t d) { return libdivide_u32_gen(d); }
+    inline libdivide_s32_t gen(int32_t d) { return libdivide_s32_gen(d); }
+    inline libdivide_u64_t gen(uint64_t d) { return libdivide_u64_gen(d); }
+    inline libdivide_s64_t gen(int64_t d) { return libdivide_s64_gen(d); }
+    inline void gen_array(const uint32_t *d, libdivide_u32_t *out, size_t n) { libdivide_u32_gen_array(d, out, n); }
+    inline void gen_array(const int32_t *d, libdivide_s32_t *out, size_t n) { libdivide_s32_gen_array(d, out, n); }
+    inline void gen_array(const uint64_t *d, libdivide_u64_t *out, size_t n) { libdivide_u64_gen_array(d, out, n); }
+    inline void gen_array(const int64_t *d, libdivide_s64_t *out, size_t n) { libdivide_s64_gen_array(d, out, n); }
+    inline void gen_array_soa(const uint32_t *d, uint32_t *magics, uint8_t *mores, size_t n) { libdivide_u32_gen_array_soa(d, magics, mores, n); }
+    inline void gen_array_soa(const int32_t *d, int32_t *magics, uint8_t *mores, size_t n) { libdivide_s32_gen_array_soa(d, magics, mores, n); }
+    inline void gen_array_soa(const uint64_t *d, uint64_t *magics, uint8_t *mores, size_t n) { libdivide_u64_gen_array_soa(d, magics, mores, n); }
+    inline void gen_array_soa(const int64_t *d, int64_t *magics, uint8_t *mores, size_t n) { libdivide_s64_gen_array_soa(d, magics, mores, n); }
+#if LIBDIVIDE_HAS_ATOMICS
+    inline libdivide_u64_t gen_cached(uint64_t d, libdivide_u64_cache_t *cache) { return libdivide_u64_gen_cached(d, cache); }
+    inline libdivide_s64_t gen_cached(int64_t d, libdivide_s64_cache_t *cache) { return libdivide_s64_gen_cached(d, cache); }
+    inline void cache_stats(const libdivide_u64_cache_t *cache, uint64_t *hits, uint64_t *misses) { libdivide_u64_cache_stats(cache, hits, misses); }
+    inline void cache_stats(const libdivide_s64_cache_t *cache, uint64_t *hits, uint64_t *misses) { libdivide_s64_cache_stats(cache, hits, misses); }
+#endif
+
+    inline libdivide_u32_t get(uint32_t d) { return libdivide_u32_get(d); }
+    inline libdivide_s32_t get(int32_t d) { return libdivide_s32_get(d); }
+    inline libdivide_u64_t get(uint64_t d) { return libdivide_u64_get(d); }
+
+    inline size_t serialize(const libdivide_u32_t *denoms, size_t n, void *buf, size_t size) { return libdivide_u32_serialize(denoms, n, buf, size); }
+    inline size_t serialize(const libdivide_s32_t *denoms, size_t n, void *buf, size_t size) { return libdivide_s32_serialize(denoms, n, buf, size); }
+    inline size_t serialize(const libdivide_u64_t *denoms, size_t n, void *buf, size_t size) { return libdivide_u64_serialize(denoms, n, buf, size); }
+    inline size_t serialize(const libdivide_s64_t *denoms, size_t n, void *buf, size_t size) { return libdivide_s64_serialize(denoms, n, buf, size); }
+    inline size_t deserialize(const void *buf, size_t size, libdivide_u32_t *denoms, size_t n) { return libdivide_u32_deserialize(buf, size, denoms, n); }
+    inline size_t deserialize(const void *buf, size_t size, libdivide_s32_t *denoms, size_t n) { return libdivide_s32_deserialize(buf, size, denoms, n); }
+    inline size_t deserialize(const void *buf, size_t size, libdivide_u64_t *denoms, size_t n) { return libdivide_u64_deserialize(buf, size, denoms, n); }
+    inline size_t deserialize(const void *buf, size_t size, libdivide_s64_t *denoms, size_t n) { return libdivide_s64_deserialize(buf, size, denoms, n); }
+    inline void view(const void *buf, size_t size, const libdivide_u32_t **denoms, size_t *n) { *denoms = libdivide_u32_view(buf, size, n); }
+    inline void view(const void *buf, size_t size, const libdivide_s32_t **denoms, size_t *n) { *denoms = libdivide_s32_view(buf, size, n); }
+    inline void view(const void *buf, size_t size, const libdivide_u64_t **denoms, size_t *n) { *denoms = libdivide_u64_view(buf, size, n); }
+    inline void view(const void *buf, size_t size, const libdivide_s64_t **denoms, size_t *n) { *denoms = libdivide_s64_view(buf, size, n); }
+
+    template<typename IntType, typename Vec64Type, typename Vec128Type, typename Vec256Type, typename Vec512Type, typename DenomType, DenomType gen_func(IntType), int get_algo(const DenomType *), IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *), Vec512Type vector512_func(Vec512Type, const DenomType *)>
+    class divider_base {
+    public:
+        DenomType denom;
+        divider_base(IntType d) : denom(gen_func(d)) { }
+        LIBDIVIDE_CONSTEXPR divider_base(const DenomType & d) : denom(d) { }
 
         IntType perform_divide(IntType val) const { return do_func(val, &denom); }
 #if LIBDIVIDE_USE_SSE2
         __m128i perform_divide_vector(__m128i val) const { return vector128_func(val, &denom); }
+#if LIBDIVIDE_USE_AVX2
+        __m256i perform_divide_vector(__m256i val) const { return vector256_func(val, &denom); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+        __m512i perform_divide_vector(__m512i val) const { return vector512_func(val, &denom); }
+#endif
 #else
 #if LIBDIVIDE_VEC64
+        libdivide_8s8_t perform_divide_vector(libdivide_8s8_t val) const { return vector64_func(val, &denom); }
+        libdivide_8u8_t perform_divide_vector(libdivide_8u8_t val) const { return vector64_func(val, &denom); }
+        libdivide_4s16_t perform_divide_vector(libdivide_4s16_t val) const { return vector64_func(val, &denom); }
+        libdivide_4u16_t perform_divide_vector(libdivide_4u16_t val) const { return vector64_func(val, &denom); }
         libdivide_2s32_t perform_divide_vector(libdivide_2s32_t val) const { return vector64_func(val, &denom); }
         libdivide_1s64_t perform_divide_vector(libdivide_1s64_t val) const { return vector64_func(val, &denom); }
         libdivide_2u32_t perform_divide_vector(libdivide_2u32_t val) const { return vector64_func(val, &denom); }
         libdivide_1u64_t perform_divide_vector(libdivide_1u64_t val) const { return vector64_func(val, &denom); }
 #endif
 #if LIBDIVIDE_VEC128
+        libdivide_16s8_t perform_divide_vector(libdivide_16s8_t val) const { return vector128_func(val, &denom); }
+        libdivide_16u8_t perform_divide_vector(libdivide_16u8_t val) const { return vector128_func(val, &denom); }
+        libdivide_8s16_t perform_divide_vector(libdivide_8s16_t val) const { return vector128_func(val, &denom); }
+        libdivide_8u16_t perform_divide_vector(libdivide_8u16_t val) const { return vector128_func(val, &denom); }
         libdivide_4s32_t perform_divide_vector(libdivide_4s32_t val) const { return vector128_func(val, &denom); }
         libdivide_2s64_t perform_divide_vector(libdivide_2s64_t val) const { return vector128_func(val, &denom); }
         libdivide_4u32_t perform_divide_vector(libdivide_4u32_t val) const { return vector128_func(val, &denom); }
         libdivide_2u64_t perform_divide_vector(libdivide_2u64_t val) const { return vector128_func(val, &denom); }
 #endif
 #if LIBDIVIDE_VEC256
+        libdivide_32s8_t perform_divide_vector(libdivide_32s8_t val) const { return vector256_func(val, &denom); }
+        libdivide_32u8_t perform_divide_vector(libdivide_32u8_t val) const { return vector256_func(val, &denom); }
+        libdivide_16s16_t perform_divide_vector(libdivide_16s16_t val) const { return vector256_func(val, &denom); }
+        libdivide_16u16_t perform_divide_vector(libdivide_16u16_t val) const { return vector256_func(val, &denom); }
         libdivide_8s32_t perform_divide_vector(libdivide_8s32_t val) const { return vector256_func(val, &denom); }
         libdivide_4s64_t perform_divide_vector(libdivide_4s64_t val) const { return vector256_func(val, &denom); }
         libdivide_8u32_t perform_divide_vector(libdivide_8u32_t val) const { return vector256_func(val, &denom); }
@@ -2633,25 +12829,110 @@ namespace libdivide_internal {
 
     template<class T> struct divider_mid { };
 
+    template<> struct divider_mid<uint8_t> {
+        typedef uint8_t IntType;
+        typedef MAYBE_VECTOR_8U8_PARAM Vec64Type;
+        typedef MAYBE_VECTOR_16U8_PARAM Vec128Type;
+        typedef MAYBE_VECTOR_32U8_PARAM Vec256Type;
+        typedef MAYBE_VECTOR_64U8_PARAM Vec512Type;
+        typedef struct libdivide_u8_t DenomType;
+        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *), Vec512Type vector512_func(Vec512Type, const DenomType *)> struct denom {
+            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, Vec512Type, DenomType, libdivide_u8_gen, libdivide_u8_get_algorithm, do_func, vector64_func, vector128_func, vector256_func, vector512_func> divider;
+        };
+
+        template<int ALGO, int J = 0> struct algo { };
+        template<int J> struct algo<-1, J> { typedef denom<libdivide_u8_do, MAYBE_VECTOR64(libdivide_8u8_do_vector), MAYBE_VECTOR128(libdivide_16u8_do_vector), MAYBE_VECTOR256(libdivide_32u8_do_vector), MAYBE_VECTOR512(libdivide_64u8_do_vector)>::divider divider; };
+        template<int J> struct algo<0, J>  { typedef denom<libdivide_u8_do_alg0, MAYBE_VECTOR64(libdivide_8u8_do_vector_alg0), MAYBE_VECTOR128(libdivide_16u8_do_vector_alg0), MAYBE_VECTOR256(libdivide_32u8_do_vector_alg0), MAYBE_VECTOR512(libdivide_64u8_do_vector_alg0)>::divider divider; };
+        template<int J> struct algo<1, J>  { typedef denom<libdivide_u8_do_alg1, MAYBE_VECTOR64(libdivide_8u8_do_vector_alg1), MAYBE_VECTOR128(libdivide_16u8_do_vector_alg1), MAYBE_VECTOR256(libdivide_32u8_do_vector_alg1), MAYBE_VECTOR512(libdivide_64u8_do_vector_alg1)>::divider divider; };
+        template<int J> struct algo<2, J>  { typedef denom<libdivide_u8_do_alg2, MAYBE_VECTOR64(libdivide_8u8_do_vector_alg2), MAYBE_VECTOR128(libdivide_16u8_do_vector_alg2), MAYBE_VECTOR256(libdivide_32u8_do_vector_alg2), MAYBE_VECTOR512(libdivide_64u8_do_vector_alg2)>::divider divider; };
+
+        /* Define two more bogus ones so that the same (templated, presumably) code can handle both signed and unsigned */
+        template<int J> struct algo<3, J>  { typedef denom<crash_u8, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide), MAYBE_VECTOR512(crash_divide)>::divider divider; };
+        template<int J> struct algo<4, J>  { typedef denom<crash_u8, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide), MAYBE_VECTOR512(crash_divide)>::divider divider; };
+    };
+
+    template<> struct divider_mid<int8_t> {
+        typedef int8_t IntType;
+        typedef MAYBE_VECTOR_8S8_PARAM Vec64Type;
+        typedef MAYBE_VECTOR_16S8_PARAM Vec128Type;
+        typedef MAYBE_VECTOR_32S8_PARAM Vec256Type;
+        typedef MAYBE_VECTOR_64S8_PARAM Vec512Type;
+        typedef struct libdivide_s8_t DenomType;
+        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *), Vec512Type vector512_func(Vec512Type, const DenomType *)> struct denom {
+            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, Vec512Type, DenomType, libdivide_s8_gen, libdivide_s8_get_algorithm, do_func, vector64_func, vector128_func, vector256_func, vector512_func> divider;
+        };
+
+        template<int ALGO, int J = 0> struct algo { };
+        template<int J> struct algo<-1, J> { typedef denom<libdivide_s8_do, MAYBE_VECTOR64(libdivide_8s8_do_vector), MAYBE_VECTOR128(libdivide_16s8_do_vector), MAYBE_VECTOR256(libdivide_32s8_do_vector), MAYBE_VECTOR512(libdivide_64s8_do_vector)>::divider divider; };
+        template<int J> struct algo<0, J>  { typedef denom<libdivide_s8_do_alg0, MAYBE_VECTOR64(libdivide_8s8_do_vector_alg0), MAYBE_VECTOR128(libdivide_16s8_do_vector_alg0), MAYBE_VECTOR256(libdivide_32s8_do_vector_alg0), MAYBE_VECTOR512(libdivide_64s8_do_vector_alg0)>::divider divider; };
+        template<int J> struct algo<1, J>  { typedef denom<libdivide_s8_do_alg1, MAYBE_VECTOR64(libdivide_8s8_do_vector_alg1), MAYBE_VECTOR128(libdivide_16s8_do_vector_alg1), MAYBE_VECTOR256(libdivide_32s8_do_vector_alg1), MAYBE_VECTOR512(libdivide_64s8_do_vector_alg1)>::divider divider; };
+        template<int J> struct algo<2, J>  { typedef denom<libdivide_s8_do_alg2, MAYBE_VECTOR64(libdivide_8s8_do_vector_alg2), MAYBE_VECTOR128(libdivide_16s8_do_vector_alg2), MAYBE_VECTOR256(libdivide_32s8_do_vector_alg2), MAYBE_VECTOR512(libdivide_64s8_do_vector_alg2)>::divider divider; };
+        template<int J> struct algo<3, J>  { typedef denom<libdivide_s8_do_alg3, MAYBE_VECTOR64(libdivide_8s8_do_vector_alg3), MAYBE_VECTOR128(libdivide_16s8_do_vector_alg3), MAYBE_VECTOR256(libdivide_32s8_do_vector_alg3), MAYBE_VECTOR512(libdivide_64s8_do_vector_alg3)>::divider divider; };
+        template<int J> struct algo<4, J>  { typedef denom<libdivide_s8_do_alg4, MAYBE_VECTOR64(libdivide_8s8_do_vector_alg4), MAYBE_VECTOR128(libdivide_16s8_do_vector_alg4), MAYBE_VECTOR256(libdivide_32s8_do_vector_alg4), MAYBE_VECTOR512(libdivide_64s8_do_vector_alg4)>::divider divider; };
+    };
+
+    template<> struct divider_mid<uint16_t> {
+        typedef uint16_t IntType;
+        typedef MAYBE_VECTOR_4U16_PARAM Vec64Type;
+        typedef MAYBE_VECTOR_8U16_PARAM Vec128Type;
+        typedef MAYBE_VECTOR_16U16_PARAM Vec256Type;
+        typedef MAYBE_VECTOR_32U16_PARAM Vec512Type;
+        typedef struct libdivide_u16_t DenomType;
+        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *), Vec512Type vector512_func(Vec512Type, const DenomType *)> struct denom {
+            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, Vec512Type, DenomType, libdivide_u16_gen, libdivide_u16_get_algorithm, do_func, vector64_func, vector128_func, vector256_func, vector512_func> divider;
+        };
+
+        template<int ALGO, int J = 0> struct algo { };
+        template<int J> struct algo<-1, J> { typedef denom<libdivide_u16_do, MAYBE_VECTOR64(libdivide_4u16_do_vector), MAYBE_VECTOR128(libdivide_8u16_do_vector), MAYBE_VECTOR256(libdivide_16u16_do_vector), MAYBE_VECTOR512(libdivide_32u16_do_vector)>::divider divider; };
+        template<int J> struct algo<0, J>  { typedef denom<libdivide_u16_do_alg0, MAYBE_VECTOR64(libdivide_4u16_do_vector_alg0), MAYBE_VECTOR128(libdivide_8u16_do_vector_alg0), MAYBE_VECTOR256(libdivide_16u16_do_vector_alg0), MAYBE_VECTOR512(libdivide_32u16_do_vector_alg0)>::divider divider; };
+        template<int J> struct algo<1, J>  { typedef denom<libdivide_u16_do_alg1, MAYBE_VECTOR64(libdivide_4u16_do_vector_alg1), MAYBE_VECTOR128(libdivide_8u16_do_vector_alg1), MAYBE_VECTOR256(libdivide_16u16_do_vector_alg1), MAYBE_VECTOR512(libdivide_32u16_do_vector_alg1)>::divider divider; };
+        template<int J> struct algo<2, J>  { typedef denom<libdivide_u16_do_alg2, MAYBE_VECTOR64(libdivide_4u16_do_vector_alg2), MAYBE_VECTOR128(libdivide_8u16_do_vector_alg2), MAYBE_VECTOR256(libdivide_16u16_do_vector_alg2), MAYBE_VECTOR512(libdivide_32u16_do_vector_alg2)>::divider divider; };
+
+        /* Define two more bogus ones so that the same (templated, presumably) code can handle both signed and unsigned */
+        template<int J> struct algo<3, J>  { typedef denom<crash_u16, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide), MAYBE_VECTOR512(crash_divide)>::divider divider; };
+        template<int J> struct algo<4, J>  { typedef denom<crash_u16, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide), MAYBE_VECTOR512(crash_divide)>::divider divider; };
+    };
+
+    template<> struct divider_mid<int16_t> {
+        typedef int16_t IntType;
+        typedef MAYBE_VECTOR_4S16_PARAM Vec64Type;
+        typedef MAYBE_VECTOR_8S16_PARAM Vec128Type;
+        typedef MAYBE_VECTOR_16S16_PARAM Vec256Type;
+        typedef MAYBE_VECTOR_32S16_PARAM Vec512Type;
+        typedef struct libdivide_s16_t DenomType;
+        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *), Vec512Type vector512_func(Vec512Type, const DenomType *)> struct denom {
+            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, Vec512Type, DenomType, libdivide_s16_gen, libdivide_s16_get_algorithm, do_func, vector64_func, vector128_func, vector256_func, vector512_func> divider;
+        };
+
+        template<int ALGO, int J = 0> struct algo { };
+        template<int J> struct algo<-1, J> { typedef denom<libdivide_s16_do, MAYBE_VECTOR64(libdivide_4s16_do_vector), MAYBE_VECTOR128(libdivide_8s16_do_vector), MAYBE_VECTOR256(libdivide_16s16_do_vector), MAYBE_VECTOR512(libdivide_32s16_do_vector)>::divider divider; };
+        template<int J> struct algo<0, J>  { typedef denom<libdivide_s16_do_alg0, MAYBE_VECTOR64(libdivide_4s16_do_vector_alg0), MAYBE_VECTOR128(libdivide_8s16_do_vector_alg0), MAYBE_VECTOR256(libdivide_16s16_do_vector_alg0), MAYBE_VECTOR512(libdivide_32s16_do_vector_alg0)>::divider divider; };
+        template<int J> struct algo<1, J>  { typedef denom<libdivide_s16_do_alg1, MAYBE_VECTOR64(libdivide_4s16_do_vector_alg1), MAYBE_VECTOR128(libdivide_8s16_do_vector_alg1), MAYBE_VECTOR256(libdivide_16s16_do_vector_alg1), MAYBE_VECTOR512(libdivide_32s16_do_vector_alg1)>::divider divider; };
+        template<int J> struct algo<2, J>  { typedef denom<libdivide_s16_do_alg2, MAYBE_VECTOR64(libdivide_4s16_do_vector_alg2), MAYBE_VECTOR128(libdivide_8s16_do_vector_alg2), MAYBE_VECTOR256(libdivide_16s16_do_vector_alg2), MAYBE_VECTOR512(libdivide_32s16_do_vector_alg2)>::divider divider; };
+        template<int J> struct algo<3, J>  { typedef denom<libdivide_s16_do_alg3, MAYBE_VECTOR64(libdivide_4s16_do_vector_alg3), MAYBE_VECTOR128(libdivide_8s16_do_vector_alg3), MAYBE_VECTOR256(libdivide_16s16_do_vector_alg3), MAYBE_VECTOR512(libdivide_32s16_do_vector_alg3)>::divider divider; };
+        template<int J> struct algo<4, J>  { typedef denom<libdivide_s16_do_alg4, MAYBE_VECTOR64(libdivide_4s16_do_vector_alg4), MAYBE_VECTOR128(libdivide_8s16_do_vector_alg4), MAYBE_VECTOR256(libdivide_16s16_do_vector_alg4), MAYBE_VECTOR512(libdivide_32s16_do_vector_alg4)>::divider divider; };
+    };
+
     template<> struct divider_mid<uint32_t> {
         typedef uint32_t IntType;
         typedef MAYBE_VECTOR_2U32_PARAM Vec64Type;
         typedef MAYBE_VECTOR_4U32_PARAM Vec128Type;
         typedef MAYBE_VECTOR_8U32_PARAM Vec256Type;
+        typedef MAYBE_VECTOR_16U32_PARAM Vec512Type;
         typedef struct libdivide_u32_t DenomType;
-        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *)> struct denom {
-            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, DenomType, libdivide_u32_gen, libdivide_u32_get_algorithm, do_func, vector64_func, vector128_func, vector256_func> divider;
+        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *), Vec512Type vector512_func(Vec512Type, const DenomType *)> struct denom {
+            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, Vec512Type, DenomType, libdivide_u32_gen, libdivide_u32_get_algorithm, do_func, vector64_func, vector128_func, vector256_func, vector512_func> divider;
         };
 
         template<int ALGO, int J = 0> struct algo { };
-        template<int J> struct algo<-1, J> { typedef denom<libdivide_u32_do, MAYBE_VECTOR64(libdivide_2u32_do_vector), MAYBE_VECTOR128(libdivide_4u32_do_vector), MAYBE_VECTOR256(libdivide_8u32_do_vector)>::divider divider; };
-        template<int J> struct algo<0, J>  { typedef denom<libdivide_u32_do_alg0, MAYBE_VECTOR64(libdivide_2u32_do_vector_alg0), MAYBE_VECTOR128(libdivide_4u32_do_vector_alg0), MAYBE_VECTOR256(libdivide_8u32_do_vector_alg0)>::divider divider; };
-        template<int J> struct algo<1, J>  { typedef denom<libdivide_u32_do_alg1, MAYBE_VECTOR64(libdivide_2u32_do_vector_alg1), MAYBE_VECTOR128(libdivide_4u32_do_vector_alg1), MAYBE_VECTOR256(libdivide_8u32_do_vector_alg1)>::divider divider; };
-        template<int J> struct algo<2, J>  { typedef denom<libdivide_u32_do_alg2, MAYBE_VECTOR64(libdivide_2u32_do_vector_alg2), MAYBE_VECTOR128(libdivide_4u32_do_vector_alg2), MAYBE_VECTOR256(libdivide_8u32_do_vector_alg2)>::divider divider; };
+        template<int J> struct algo<-1, J> { typedef denom<libdivide_u32_do, MAYBE_VECTOR64(libdivide_2u32_do_vector), MAYBE_VECTOR128(libdivide_4u32_do_vector), MAYBE_VECTOR256(libdivide_8u32_do_vector), MAYBE_VECTOR512(libdivide_16u32_do_vector)>::divider divider; };
+        template<int J> struct algo<0, J>  { typedef denom<libdivide_u32_do_alg0, MAYBE_VECTOR64(libdivide_2u32_do_vector_alg0), MAYBE_VECTOR128(libdivide_4u32_do_vector_alg0), MAYBE_VECTOR256(libdivide_8u32_do_vector_alg0), MAYBE_VECTOR512(libdivide_16u32_do_vector_alg0)>::divider divider; };
+        template<int J> struct algo<1, J>  { typedef denom<libdivide_u32_do_alg1, MAYBE_VECTOR64(libdivide_2u32_do_vector_alg1), MAYBE_VECTOR128(libdivide_4u32_do_vector_alg1), MAYBE_VECTOR256(libdivide_8u32_do_vector_alg1), MAYBE_VECTOR512(libdivide_16u32_do_vector_alg1)>::divider divider; };
+        template<int J> struct algo<2, J>  { typedef denom<libdivide_u32_do_alg2, MAYBE_VECTOR64(libdivide_2u32_do_vector_alg2), MAYBE_VECTOR128(libdivide_4u32_do_vector_alg2), MAYBE_VECTOR256(libdivide_8u32_do_vector_alg2), MAYBE_VECTOR512(libdivide_16u32_do_vector_alg2)>::divider divider; };
 
         /* Define two more bogus ones so that the same (templated, presumably) code can handle both signed and unsigned */
-        template<int J> struct algo<3, J>  { typedef denom<crash_u32, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide)>::divider divider; };
-        template<int J> struct algo<4, J>  { typedef denom<crash_u32, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide)>::divider divider; };
+        template<int J> struct algo<3, J>  { typedef denom<crash_u32, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide), MAYBE_VECTOR512(crash_divide)>::divider divider; };
+        template<int J> struct algo<4, J>  { typedef denom<crash_u32, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide), MAYBE_VECTOR512(crash_divide)>::divider divider; };
     };
 
     template<> struct divider_mid<int32_t> {
@@ -2659,18 +12940,19 @@ namespace libdivide_internal {
         typedef MAYBE_VECTOR_2S32_PARAM Vec64Type;
         typedef MAYBE_VECTOR_4S32_PARAM Vec128Type;
         typedef MAYBE_VECTOR_8S32_PARAM Vec256Type;
+        typedef MAYBE_VECTOR_16S32_PARAM Vec512Type;
         typedef struct libdivide_s32_t DenomType;
-        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *)> struct denom {
-            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, DenomType, libdivide_s32_gen, libdivide_s32_get_algorithm, do_func, vector64_func, vector128_func, vector256_func> divider;
+        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *), Vec512Type vector512_func(Vec512Type, const DenomType *)> struct denom {
+            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, Vec512Type, DenomType, libdivide_s32_gen, libdivide_s32_get_algorithm, do_func, vector64_func, vector128_func, vector256_func, vector512_func> divider;
         };
 
         template<int ALGO, int J = 0> struct algo { };
-        template<int J> struct algo<-1, J> { typedef denom<libdivide_s32_do, MAYBE_VECTOR64(libdivide_2s32_do_vector), MAYBE_VECTOR128(libdivide_4s32_do_vector), MAYBE_VECTOR256(libdivide_8s32_do_vector)>::divider divider; };
-        template<int J> struct algo<0, J>  { typedef denom<libdivide_s32_do_alg0, MAYBE_VECTOR64(libdivide_2s32_do_vector_alg0), MAYBE_VECTOR128(libdivide_4s32_do_vector_alg0), MAYBE_VECTOR256(libdivide_8s32_do_vector_alg0)>::divider divider; };
-        template<int J> struct algo<1, J>  { typedef denom<libdivide_s32_do_alg1, MAYBE_VECTOR64(libdivide_2s32_do_vector_alg1), MAYBE_VECTOR128(libdivide_4s32_do_vector_alg1), MAYBE_VECTOR256(libdivide_8s32_do_vector_alg1)>::divider divider; };
-        template<int J> struct algo<2, J>  { typedef denom<libdivide_s32_do_alg2, MAYBE_VECTOR64(libdivide_2s32_do_vector_alg2), MAYBE_VECTOR128(libdivide_4s32_do_vector_alg2), MAYBE_VECTOR256(libdivide_8s32_do_vector_alg2)>::divider divider; };
-        template<int J> struct algo<3, J>  { typedef denom<libdivide_s32_do_alg3, MAYBE_VECTOR64(libdivide_2s32_do_vector_alg3), MAYBE_VECTOR128(libdivide_4s32_do_vector_alg3), MAYBE_VECTOR256(libdivide_8s32_do_vector_alg3)>::divider divider; };
-        template<int J> struct algo<4, J>  { typedef denom<libdivide_s32_do_alg4, MAYBE_VECTOR64(libdivide_2s32_do_vector_alg4), MAYBE_VECTOR128(libdivide_4s32_do_vector_alg4), MAYBE_VECTOR256(libdivide_8s32_do_vector_alg4)>::divider divider; };
+        template<int J> struct algo<-1, J> { typedef denom<libdivide_s32_do, MAYBE_VECTOR64(libdivide_2s32_do_vector), MAYBE_VECTOR128(libdivide_4s32_do_vector), MAYBE_VECTOR256(libdivide_8s32_do_vector), MAYBE_VECTOR512(libdivide_16s32_do_vector)>::divider divider; };
+        template<int J> struct algo<0, J>  { typedef denom<libdivide_s32_do_alg0, MAYBE_VECTOR64(libdivide_2s32_do_vector_alg0), MAYBE_VECTOR128(libdivide_4s32_do_vector_alg0), MAYBE_VECTOR256(libdivide_8s32_do_vector_alg0), MAYBE_VECTOR512(libdivide_16s32_do_vector_alg0)>::divider divider; };
+        template<int J> struct algo<1, J>  { typedef denom<libdivide_s32_do_alg1, MAYBE_VECTOR64(libdivide_2s32_do_vector_alg1), MAYBE_VECTOR128(libdivide_4s32_do_vector_alg1), MAYBE_VECTOR256(libdivide_8s32_do_vector_alg1), MAYBE_VECTOR512(libdivide_16s32_do_vector_alg1)>::divider divider; };
+        template<int J> struct algo<2, J>  { typedef denom<libdivide_s32_do_alg2, MAYBE_VECTOR64(libdivide_2s32_do_vector_alg2), MAYBE_VECTOR128(libdivide_4s32_do_vector_alg2), MAYBE_VECTOR256(libdivide_8s32_do_vector_alg2), MAYBE_VECTOR512(libdivide_16s32_do_vector_alg2)>::divider divider; };
+        template<int J> struct algo<3, J>  { typedef denom<libdivide_s32_do_alg3, MAYBE_VECTOR64(libdivide_2s32_do_vector_alg3), MAYBE_VECTOR128(libdivide_4s32_do_vector_alg3), MAYBE_VECTOR256(libdivide_8s32_do_vector_alg3), MAYBE_VECTOR512(libdivide_16s32_do_vector_alg3)>::divider divider; };
+        template<int J> struct algo<4, J>  { typedef denom<libdivide_s32_do_alg4, MAYBE_VECTOR64(libdivide_2s32_do_vector_alg4), MAYBE_VECTOR128(libdivide_4s32_do_vector_alg4), MAYBE_VECTOR256(libdivide_8s32_do_vector_alg4), MAYBE_VECTOR512(libdivide_16s32_do_vector_alg4)>::divider divider; };
     };
 
     template<> struct divider_mid<uint64_t> {
@@ -2678,20 +12960,21 @@ namespace libdivide_internal {
         typedef MAYBE_VECTOR_1U64_PARAM Vec64Type;
         typedef MAYBE_VECTOR_2U64_PARAM Vec128Type;
         typedef MAYBE_VECTOR_4U64_PARAM Vec256Type;
+        typedef MAYBE_VECTOR_8U64_PARAM Vec512Type;
         typedef struct libdivide_u64_t DenomType;
-        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *)> struct denom {
-            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, DenomType, libdivide_u64_gen, libdivide_u64_get_algorithm, do_func, vector64_func, vector128_func, vector256_func> divider;
+        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *), Vec512Type vector512_func(Vec512Type, const DenomType *)> struct denom {
+            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, Vec512Type, DenomType, libdivide_u64_gen, libdivide_u64_get_algorithm, do_func, vector64_func, vector128_func, vector256_func, vector512_func> divider;
         };
 
         template<int ALGO, int J = 0> struct algo { };
-        template<int J> struct algo<-1, J> { typedef denom<libdivide_u64_do, MAYBE_VECTOR64(libdivide_1u64_do_vector), MAYBE_VECTOR128(libdivide_2u64_do_vector), MAYBE_VECTOR256(libdivide_4u64_do_vector)>::divider divider; };
-        template<int J> struct algo<0, J>  { typedef denom<libdivide_u64_do_alg0, MAYBE_VECTOR64(libdivide_1u64_do_vector_alg0), MAYBE_VECTOR128(libdivide_2u64_do_vector_alg0), MAYBE_VECTOR256(libdivide_4u64_do_vector_alg0)>::divider divider; };
-        template<int J> struct algo<1, J>  { typedef denom<libdivide_u64_do_alg1, MAYBE_VECTOR64(libdivide_1u64_do_vector_alg1), MAYBE_VECTOR128(libdivide_2u64_do_vector_alg1), MAYBE_VECTOR256(libdivide_4u64_do_vector_alg1)>::divider divider; };
-        template<int J> struct algo<2, J>  { typedef denom<libdivide_u64_do_alg2, MAYBE_VECTOR64(libdivide_1u64_do_vector_alg2), MAYBE_VECTOR128(libdivide_2u64_do_vector_alg2), MAYBE_VECTOR256(libdivide_4u64_do_vector_alg2)>::divider divider; };
+        template<int J> struct algo<-1, J> { typedef denom<libdivide_u64_do, MAYBE_VECTOR64(libdivide_1u64_do_vector), MAYBE_VECTOR128(libdivide_2u64_do_vector), MAYBE_VECTOR256(libdivide_4u64_do_vector), MAYBE_VECTOR512(libdivide_8u64_do_vector)>::divider divider; };
+        template<int J> struct algo<0, J>  { typedef denom<libdivide_u64_do_alg0, MAYBE_VECTOR64(libdivide_1u64_do_vector_alg0), MAYBE_VECTOR128(libdivide_2u64_do_vector_alg0), MAYBE_VECTOR256(libdivide_4u64_do_vector_alg0), MAYBE_VECTOR512(libdivide_8u64_do_vector_alg0)>::divider divider; };
+        template<int J> struct algo<1, J>  { typedef denom<libdivide_u64_do_alg1, MAYBE_VECTOR64(libdivide_1u64_do_vector_alg1), MAYBE_VECTOR128(libdivide_2u64_do_vector_alg1), MAYBE_VECTOR256(libdivide_4u64_do_vector_alg1), MAYBE_VECTOR512(libdivide_8u64_do_vector_alg1)>::divider divider; };
+        template<int J> struct algo<2, J>  { typedef denom<libdivide_u64_do_alg2, MAYBE_VECTOR64(libdivide_1u64_do_vector_alg2), MAYBE_VECTOR128(libdivide_2u64_do_vector_alg2), MAYBE_VECTOR256(libdivide_4u64_do_vector_alg2), MAYBE_VECTOR512(libdivide_8u64_do_vector_alg2)>::divider divider; };
 
         /* Define two more bogus ones so that the same (templated, presumably) code can handle both signed and unsigned */
-        template<int J> struct algo<3, J>  { typedef denom<crash_u64, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide)>::divider divider; };
-        template<int J> struct algo<4, J>  { typedef denom<crash_u64, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide)>::divider divider; };
+        template<int J> struct algo<3, J>  { typedef denom<crash_u64, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide), MAYBE_VECTOR512(crash_divide)>::divider divider; };
+        template<int J> struct algo<4, J>  { typedef denom<crash_u64, MAYBE_VECTOR64(crash_divide), MAYBE_VECTOR128(crash_divide), MAYBE_VECTOR256(crash_divide), MAYBE_VECTOR512(crash_divide)>::divider divider; };
     };
 
     template<> struct divider_mid<int64_t> {
@@ -2699,28 +12982,135 @@ namespace libdivide_internal {
         typedef MAYBE_VECTOR_1S64_PARAM Vec64Type;
         typedef MAYBE_VECTOR_2S64_PARAM Vec128Type;
         typedef MAYBE_VECTOR_4S64_PARAM Vec256Type;
+        typedef MAYBE_VECTOR_8S64_PARAM Vec512Type;
         typedef struct libdivide_s64_t DenomType;
-        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *)> struct denom {
-            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, DenomType, libdivide_s64_gen, libdivide_s64_get_algorithm, do_func, vector64_func, vector128_func, vector256_func> divider;
+        template<IntType do_func(IntType, const DenomType *), Vec64Type vector64_func(Vec64Type, const DenomType *), Vec128Type vector128_func(Vec128Type, const DenomType *), Vec256Type vector256_func(Vec256Type, const DenomType *), Vec512Type vector512_func(Vec512Type, const DenomType *)> struct denom {
+            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, Vec512Type, DenomType, libdivide_s64_gen, libdivide_s64_get_algorithm, do_func, vector64_func, vector128_func, vector256_func, vector512_func> divider;
+        };
+
+        template<int ALGO, int J = 0> struct algo { };
+        template<int J> struct algo<-1, J> { typedef denom<libdivide_s64_do, MAYBE_VECTOR64(libdivide_1s64_do_vector), MAYBE_VECTOR128(libdivide_2s64_do_vector), MAYBE_VECTOR256(libdivide_4s64_do_vector), MAYBE_VECTOR512(libdivide_8s64_do_vector)>::divider divider; };
+        template<int J> struct algo<0, J>  { typedef denom<libdivide_s64_do_alg0, MAYBE_VECTOR64(libdivide_1s64_do_vector_alg0), MAYBE_VECTOR128(libdivide_2s64_do_vector_alg0), MAYBE_VECTOR256(libdivide_4s64_do_vector_alg0), MAYBE_VECTOR512(libdivide_8s64_do_vector_alg0)>::divider divider; };
+        template<int J> struct algo<1, J>  { typedef denom<libdivide_s64_do_alg1, MAYBE_VECTOR64(libdivide_1s64_do_vector_alg1), MAYBE_VECTOR128(libdivide_2s64_do_vector_alg1), MAYBE_VECTOR256(libdivide_4s64_do_vector_alg1), MAYBE_VECTOR512(libdivide_8s64_do_vector_alg1)>::divider divider; };
+        template<int J> struct algo<2, J>  { typedef denom<libdivide_s64_do_alg2, MAYBE_VECTOR64(libdivide_1s64_do_vector_alg2), MAYBE_VECTOR128(libdivide_2s64_do_vector_alg2), MAYBE_VECTOR256(libdivide_4s64_do_vector_alg2), MAYBE_VECTOR512(libdivide_8s64_do_vector_alg2)>::divider divider; };
+        template<int J> struct algo<3, J>  { typedef denom<libdivide_s64_do_alg3, MAYBE_VECTOR64(libdivide_1s64_do_vector_alg3), MAYBE_VECTOR128(libdivide_2s64_do_vector_alg3), MAYBE_VECTOR256(libdivide_4s64_do_vector_alg3), MAYBE_VECTOR512(libdivide_8s64_do_vector_alg3)>::divider divider; };
+        template<int J> struct algo<4, J>  { typedef denom<libdivide_s64_do_alg4, MAYBE_VECTOR64(libdivide_1s64_do_vector_alg4), MAYBE_VECTOR128(libdivide_2s64_do_vector_alg4), MAYBE_VECTOR256(libdivide_4s64_do_vector_alg4), MAYBE_VECTOR512(libdivide_8s64_do_vector_alg4)>::divider divider; };
+    };
+
+#if HAS_INT128_T
+    /* There are no 128 bit vector functions, so every vector slot gets crash_divide */
+    template<> struct divider_mid<__uint128_t> {
+        typedef __uint128_t IntType;
+        typedef int Vec64Type;
+        typedef int Vec128Type;
+        typedef int Vec256Type;
+        typedef int Vec512Type;
+        typedef struct libdivide_u128_t DenomType;
+        template<IntType do_func(IntType, const DenomType *)> struct denom {
+            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, Vec512Type, DenomType, libdivide_u128_gen, libdivide_u128_get_algorithm, do_func, crash_divide, crash_divide, crash_divide, crash_divide> divider;
+        };
+
+        template<int ALGO, int J = 0> struct algo { };
+        template<int J> struct algo<-1, J> { typedef denom<libdivide_u128_do>::divider divider; };
+        template<int J> struct algo<0, J>  { typedef denom<libdivide_u128_do_alg0>::divider divider; };
+        template<int J> struct algo<1, J>  { typedef denom<libdivide_u128_do_alg1>::divider divider; };
+        template<int J> struct algo<2, J>  { typedef denom<libdivide_u128_do_alg2>::divider divider; };
+
+        /* Define two more bogus ones so that the same (templated, presumably) code can handle both signed and unsigned */
+        template<int J> struct algo<3, J>  { typedef denom<crash_u128>::divider divider; };
+        template<int J> struct algo<4, J>  { typedef denom<crash_u128>::divider divider; };
+    };
+
+    template<> struct divider_mid<__int128_t> {
+        typedef __int128_t IntType;
+        typedef int Vec64Type;
+        typedef int Vec128Type;
+        typedef int Vec256Type;
+        typedef int Vec512Type;
+        typedef struct libdivide_s128_t DenomType;
+        template<IntType do_func(IntType, const DenomType *)> struct denom {
+            typedef divider_base<IntType, Vec64Type, Vec128Type, Vec256Type, Vec512Type, DenomType, libdivide_s128_gen, libdivide_s128_get_algorithm, do_func, crash_divide, crash_divide, crash_divide, crash_divide> divider;
         };
 
-        template<int ALGO, int J = 0> struct algo { };
-        template<int J> struct algo<-1, J> { typedef denom<libdivide_s64_do, MAYBE_VECTOR64(libdivide_1s64_do_vector), MAYBE_VECTOR128(libdivide_2s64_do_vector), MAYBE_VECTOR256(libdivide_4s64_do_vector)>::divider divider; };
-        template<int J> struct algo<0, J>  { typedef denom<libdivide_s64_do_alg0, MAYBE_VECTOR64(libdivide_1s64_do_vector_alg0), MAYBE_VECTOR128(libdivide_2s64_do_vector_alg0), MAYBE_VECTOR256(libdivide_4s64_do_vector_alg0)>::divider divider; };
-        template<int J> struct algo<1, J>  { typedef denom<libdivide_s64_do_alg1, MAYBE_VECTOR64(libdivide_1s64_do_vector_alg1), MAYBE_VECTOR128(libdivide_2s64_do_vector_alg1), MAYBE_VECTOR256(libdivide_4s64_do_vector_alg1)>::divider divider; };
-        template<int J> struct algo<2, J>  { typedef denom<libdivide_s64_do_alg2, MAYBE_VECTOR64(libdivide_1s64_do_vector_alg2), MAYBE_VECTOR128(libdivide_2s64_do_vector_alg2), MAYBE_VECTOR256(libdivide_4s64_do_vector_alg2)>::divider divider; };
-        template<int J> struct algo<3, J>  { typedef denom<libdivide_s64_do_alg3, MAYBE_VECTOR64(libdivide_1s64_do_vector_alg3), MAYBE_VECTOR128(libdivide_2s64_do_vector_alg3), MAYBE_VECTOR256(libdivide_4s64_do_vector_alg3)>::divider divider; };
-        template<int J> struct algo<4, J>  { typedef denom<libdivide_s64_do_alg4, MAYBE_VECTOR64(libdivide_1s64_do_vector_alg4), MAYBE_VECTOR128(libdivide_2s64_do_vector_alg4), MAYBE_VECTOR256(libdivide_4s64_do_vector_alg4)>::divider divider; };
+        template<int ALGO, int J = 0> struct algo { };
+        template<int J> struct algo<-1, J> { typedef denom<libdivide_s128_do>::divider divider; };
+        template<int J> struct algo<0, J>  { typedef denom<libdivide_s128_do_alg0>::divider divider; };
+        template<int J> struct algo<1, J>  { typedef denom<libdivide_s128_do_alg1>::divider divider; };
+        template<int J> struct algo<2, J>  { typedef denom<libdivide_s128_do_alg2>::divider divider; };
+        template<int J> struct algo<3, J>  { typedef denom<libdivide_s128_do_alg3>::divider divider; };
+        template<int J> struct algo<4, J>  { typedef denom<libdivide_s128_do_alg4>::divider divider; };
+    };
+#endif
+
+#if LIBDIVIDE_HAS_CONSTEXPR
+    /* The gen functions again, for constant_divider to run at compile time.  A C++11 constexpr function is just a return statement, so the long division becomes recursion, and the steps of the gen functions become the members of constant_denom. */
+
+    /* (2 * r) % d, for r < d, without overflowing */
+    constexpr uint64_t constant_double_rem(uint64_t r, uint64_t d) { return r >= d - r ? r - (d - r) : r + r; }
+
+    /* (2**k) % d and the low 64 bits of (2**k) / d, one bit of the dividend at a time.  The 64 bit types need k up to 127. */
+    constexpr uint64_t constant_pow2_rem(int k, uint64_t d) { return k == 0 ? (d == 1 ? 0 : 1) : constant_double_rem(constant_pow2_rem(k - 1, d), d); }
+
+    constexpr uint64_t constant_pow2_quo(int k, uint64_t d) { return k == 0 ? (d == 1 ? 1 : 0) : (constant_pow2_quo(k - 1, d) << 1) | (constant_pow2_rem(k - 1, d) >= d - constant_pow2_rem(k - 1, d) ? 1 : 0); }
+
+    constexpr int constant_floor_log2(uint64_t d) { return d <= 1 ? 0 : 1 + constant_floor_log2(d >> 1); }
+
+    template<typename T, T D, bool IS_SIGNED = (T(-1) < T(0))> struct constant_denom { };
+
+    /* As in libdivide_u32_gen, with magic = 2**(bits + floor_log_2_d) / d + 1 and the add indicator when that power doesn't work */
+    template<typename T, T D> struct constant_denom<T, D, false> {
+        typedef typename divider_mid<T>::DenomType DenomType;
+        static constexpr int bits = 8 * sizeof(T);
+        static constexpr uint64_t d = (uint64_t)D;
+        static constexpr bool is_pow2 = (d & (d - 1)) == 0;
+        static constexpr int floor_log_2_d = constant_floor_log2(d);
+        static constexpr uint64_t proposed_m = constant_pow2_quo(bits + floor_log_2_d, d);
+        static constexpr uint64_t rem = constant_pow2_rem(bits + floor_log_2_d, d);
+        static constexpr bool use_add = ! is_pow2 && d - rem >= (1ULL << floor_log_2_d);
+
+        static constexpr T magic = is_pow2 ? 0 : (T)(use_add ? proposed_m + proposed_m + (rem >= d - rem ? 1 : 0) + 1 : proposed_m + 1);
+        static constexpr uint8_t more = (uint8_t)(floor_log_2_d | (is_pow2 ? LIBDIVIDE_U32_SHIFT_PATH : use_add ? LIBDIVIDE_ADD_MARKER : 0));
+        static constexpr int algorithm = is_pow2 ? 0 : use_add ? 2 : 1;
+        static constexpr DenomType denom() { return { magic, more, D }; }
+    };
+
+    /* As in libdivide_s32_gen, with magic = +-(2**(bits - 1 + floor_log_2_d) / |d| + 1).  The 64 bit shift path has no marker, since its magic of 0 is the marker. */
+    template<typename T, T D> struct constant_denom<T, D, true> {
+        typedef typename divider_mid<T>::DenomType DenomType;
+        static constexpr int bits = 8 * sizeof(T);
+        static constexpr uint64_t abs_d = D < 0 ? 0 - (uint64_t)D : (uint64_t)D;
+        static constexpr bool is_pow2 = (abs_d & (abs_d - 1)) == 0;
+        static constexpr int floor_log_2_d = constant_floor_log2(abs_d);
+        static constexpr uint64_t proposed_m = constant_pow2_quo(bits - 1 + floor_log_2_d, abs_d);
+        static constexpr uint64_t rem = constant_pow2_rem(bits - 1 + floor_log_2_d, abs_d);
+        static constexpr bool use_add = ! is_pow2 && abs_d - rem >= (1ULL << floor_log_2_d);
+        static constexpr uint64_t m = (use_add ? proposed_m + proposed_m + (rem >= abs_d - rem ? 1 : 0) : proposed_m) + 1;
+        static constexpr int negative = D < 0 ? LIBDIVIDE_NEGATIVE_DIVISOR : 0;
+
+        static constexpr T magic = is_pow2 ? 0 : (T)(D < 0 ? 0 - m : m);
+        static constexpr uint8_t more = (uint8_t)(is_pow2 ? floor_log_2_d | negative | (bits == 64 ? 0 : LIBDIVIDE_S32_SHIFT_PATH) : use_add ? floor_log_2_d | LIBDIVIDE_ADD_MARKER | negative : floor_log_2_d - 1);
+        static constexpr int algorithm = is_pow2 ? (D < 0 ? 1 : 0) : use_add ? (D < 0 ? 3 : 2) : 4;
+        static constexpr DenomType denom() { return { magic, more, D }; }
     };
+#endif
 }
 
+/* A quotient and its remainder, as returned by divmod */
+template<typename T>
+struct divmod_result {
+    T quot;
+    T rem;
+};
+
 template<typename T, int ALGO = -1>
 class divider
 {
     private:
     typename libdivide_internal::divider_mid<T>::template algo<ALGO>::divider sub;
     template<int NEW_ALGO, typename S> friend divider<S, NEW_ALGO> unswitch(const divider<S, -1> & d);
-    divider(const typename libdivide_internal::divider_mid<T>::DenomType & denom) : sub(denom) { }
+
+    protected:
+    LIBDIVIDE_CONSTEXPR divider(const typename libdivide_internal::divider_mid<T>::DenomType & denom) : sub(denom) { }
 
     public:
 
@@ -2734,22 +13124,42 @@ class divider
     T perform_divide(T val) const { return sub.perform_divide(val); }
 
 #if LIBDIVIDE_USE_SSE2
-    /* Treats the vector as either two or four packed values (depending on the size), and divides each of them by the divisor, returning the packed quotients. */
+    /* Treats the vector as two, four, eight or sixteen packed values (depending on the size), and divides each of them by the divisor, returning the packed quotients. */
     __m128i perform_divide_vector(__m128i val) const { return sub.perform_divide_vector(val); }
+#if LIBDIVIDE_USE_AVX2
+    /* Same, for the 256 bit vectors, which hold four, eight, sixteen or thirty-two packed values. */
+    __m256i perform_divide_vector(__m256i val) const { return sub.perform_divide_vector(val); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+    /* And for the 512 bit vectors, which hold eight, sixteen, thirty-two or sixty-four packed values. */
+    __m512i perform_divide_vector(__m512i val) const { return sub.perform_divide_vector(val); }
+#endif
 #else
 #if LIBDIVIDE_VEC64
+    libdivide_8s8_t perform_divide_vector(libdivide_8s8_t val) const { return sub.perform_divide_vector(val); }
+    libdivide_8u8_t perform_divide_vector(libdivide_8u8_t val) const { return sub.perform_divide_vector(val); }
+    libdivide_4s16_t perform_divide_vector(libdivide_4s16_t val) const { return sub.perform_divide_vector(val); }
+    libdivide_4u16_t perform_divide_vector(libdivide_4u16_t val) const { return sub.perform_divide_vector(val); }
     libdivide_2s32_t perform_divide_vector(libdivide_2s32_t val) const { return sub.perform_divide_vector(val); }
     libdivide_1s64_t perform_divide_vector(libdivide_1s64_t val) const { return sub.perform_divide_vector(val); }
     libdivide_2u32_t perform_divide_vector(libdivide_2u32_t val) const { return sub.perform_divide_vector(val); }
     libdivide_1u64_t perform_divide_vector(libdivide_1u64_t val) const { return sub.perform_divide_vector(val); }
 #endif
 #if LIBDIVIDE_VEC128
+    libdivide_16s8_t perform_divide_vector(libdivide_16s8_t val) const { return sub.perform_divide_vector(val); }
+    libdivide_16u8_t perform_divide_vector(libdivide_16u8_t val) const { return sub.perform_divide_vector(val); }
+    libdivide_8s16_t perform_divide_vector(libdivide_8s16_t val) const { return sub.perform_divide_vector(val); }
+    libdivide_8u16_t perform_divide_vector(libdivide_8u16_t val) const { return sub.perform_divide_vector(val); }
     libdivide_4s32_t perform_divide_vector(libdivide_4s32_t val) const { return sub.perform_divide_vector(val); }
     libdivide_2s64_t perform_divide_vector(libdivide_2s64_t val) const { return sub.perform_divide_vector(val); }
     libdivide_4u32_t perform_divide_vector(libdivide_4u32_t val) const { return sub.perform_divide_vector(val); }
     libdivide_2u64_t perform_divide_vector(libdivide_2u64_t val) const { return sub.perform_divide_vector(val); }
 #endif
 #if LIBDIVIDE_VEC256
+    libdivide_32s8_t perform_divide_vector(libdivide_32s8_t val) const { return sub.perform_divide_vector(val); }
+    libdivide_32u8_t perform_divide_vector(libdivide_32u8_t val) const { return sub.perform_divide_vector(val); }
+    libdivide_16s16_t perform_divide_vector(libdivide_16s16_t val) const { return sub.perform_divide_vector(val); }
+    libdivide_16u16_t perform_divide_vector(libdivide_16u16_t val) const { return sub.perform_divide_vector(val); }
     libdivide_8s32_t perform_divide_vector(libdivide_8s32_t val) const { return sub.perform_divide_vector(val); }
     libdivide_4s64_t perform_divide_vector(libdivide_4s64_t val) const { return sub.perform_divide_vector(val); }
     libdivide_8u32_t perform_divide_vector(libdivide_8u32_t val) const { return sub.perform_divide_vector(val); }
@@ -2757,6 +13167,62 @@ class divider
 #endif
 #endif
 
+    /* Returns the remainder of dividing the parameter by the divisor.  Like %, the remainder has the sign of the parameter.  The remainders always use the general algorithm, whatever ALGO is. */
+    T perform_mod(T val) const { return libdivide_internal::mod(val, &sub.denom); }
+
+    /* Returns the quotient and the remainder together, which costs one multiply more than the quotient alone */
+    divmod_result<T> perform_divmod(T val) const {
+        divmod_result<T> result;
+        result.quot = libdivide_internal::divmod(val, &sub.denom, &result.rem);
+        return result;
+    }
+
+#if LIBDIVIDE_VEC128
+    /* The remainders of a vector of any type that perform_divide_vector takes. */
+    template<typename V>
+    V perform_mod_vector(V val) const { return libdivide_internal::mod_vector(val, &sub.denom); }
+#endif
+
+    /* For the signed types, divides the parameter by the divisor rounding toward negative infinity, rather than toward zero as / does.  Like the remainders, it always uses the general algorithm. */
+    T perform_floor_divide(T val) const { return libdivide_internal::floor_div(val, &sub.denom); }
+
+    /* For the signed types, returns the Euclidean remainder, which is never negative: numer - |d| * floor(numer / |d|). */
+    T perform_mod_euclid(T val) const { return libdivide_internal::mod_euclid(val, &sub.denom); }
+
+#if LIBDIVIDE_VEC128
+    template<typename V>
+    V perform_floor_divide_vector(V val) const { return libdivide_internal::floor_div_vector(val, &sub.denom); }
+
+    template<typename V>
+    V perform_mod_euclid_vector(V val) const { return libdivide_internal::mod_euclid_vector(val, &sub.denom); }
+#endif
+
+    /* Divides the parameter by the divisor, rounding toward positive infinity, or to the nearest integer with halves away from zero.  Neither overflows near the top of the range.  Like the remainders, they always use the general algorithm. */
+    T perform_ceil_divide(T val) const { return libdivide_internal::ceil_div(val, &sub.denom); }
+
+    T perform_round_divide(T val) const { return libdivide_internal::round_div(val, &sub.denom); }
+
+#if LIBDIVIDE_VEC128
+    template<typename V>
+    V perform_ceil_divide_vector(V val) const { return libdivide_internal::ceil_div_vector(val, &sub.denom); }
+
+    template<typename V>
+    V perform_round_divide_vector(V val) const { return libdivide_internal::round_div_vector(val, &sub.denom); }
+#endif
+
+    /* Divides each of the n values in numers by the divisor, storing the quotients in results.  numers may be the same as results. */
+    void perform_divide_array(const T *numers, T *results, size_t n) const { libdivide_internal::do_array(numers, results, n, &sub.denom); }
+
+#if LIBDIVIDE_HAS_THREADS
+    /* The same, split over the threads of pool, for the 32 and 64 bit types. */
+    void perform_divide_array(const T *numers, T *results, size_t n, libdivide_pool_t *pool) const { libdivide_internal::do_array_parallel(numers, results, n, &sub.denom, pool); }
+#endif
+
+    /* The same, rounding up or to nearest. */
+    void perform_ceil_divide_array(const T *numers, T *results, size_t n) const { libdivide_internal::ceil_div_array(numers, results, n, &sub.denom); }
+
+    void perform_round_divide_array(const T *numers, T *results, size_t n) const { libdivide_internal::round_div_array(numers, results, n, &sub.denom); }
+
     /* Returns the index of algorithm, for use in the unswitch function */
     int get_algorithm() const { return sub.get_algorithm(); } // returns the algorithm for unswitching
 
@@ -2776,23 +13242,486 @@ int_type operator/(int_type numer, const divider<int_type, ALGO> & denom) {
     return denom.perform_divide(numer);
 }
 
+/* Overload of the % operator for scalar remainders. */
+template<typename int_type, int ALGO>
+int_type operator%(int_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_mod(numer);
+}
+
+/* Returns numer / denom and numer % denom. */
+template<typename int_type, int ALGO>
+divmod_result<int_type> divmod(int_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_divmod(numer);
+}
+
+/* Returns numer / denom rounded toward negative infinity, for the signed types. */
+template<typename int_type, int ALGO>
+int_type floor_div(int_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_floor_divide(numer);
+}
+
+/* Returns the Euclidean remainder of numer / denom, in [0, |denom|), for the signed types. */
+template<typename int_type, int ALGO>
+int_type mod_euclid(int_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_mod_euclid(numer);
+}
+
+#if LIBDIVIDE_VEC128
+/* And for the vectors, of any type that perform_divide_vector takes. */
+template<typename vec_type, typename int_type, int ALGO>
+vec_type floor_div(vec_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_floor_divide_vector(numer);
+}
+
+template<typename vec_type, typename int_type, int ALGO>
+vec_type mod_euclid(vec_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_mod_euclid_vector(numer);
+}
+#endif
+
+/* Returns numer / denom rounded toward positive infinity. */
+template<typename int_type, int ALGO>
+int_type ceil_div(int_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_ceil_divide(numer);
+}
+
+/* Returns numer / denom rounded to the nearest integer, with halves away from zero. */
+template<typename int_type, int ALGO>
+int_type round_div(int_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_round_divide(numer);
+}
+
+#if LIBDIVIDE_VEC128
+template<typename vec_type, typename int_type, int ALGO>
+vec_type ceil_div(vec_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_ceil_divide_vector(numer);
+}
+
+template<typename vec_type, typename int_type, int ALGO>
+vec_type round_div(vec_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_round_divide_vector(numer);
+}
+#endif
+
 #if  LIBDIVIDE_USE_SSE2
 /* Overload of the / operator for vector division. */
 template<typename int_type, int ALGO>
 __m128i operator/(__m128i numer, const divider<int_type, ALGO> & denom) {
     return denom.perform_divide_vector(numer);
 }
+
+/* And of the % operator for vector remainders. */
+template<typename int_type, int ALGO>
+__m128i operator%(__m128i numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_mod_vector(numer);
+}
+
+#if LIBDIVIDE_USE_AVX2
+template<typename int_type, int ALGO>
+__m256i operator/(__m256i numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_divide_vector(numer);
+}
+
+template<typename int_type, int ALGO>
+__m256i operator%(__m256i numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_mod_vector(numer);
+}
+#endif
+#if LIBDIVIDE_USE_AVX512
+template<typename int_type, int ALGO>
+__m512i operator/(__m512i numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_divide_vector(numer);
+}
+
+template<typename int_type, int ALGO>
+__m512i operator%(__m512i numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_mod_vector(numer);
+}
+#endif
 #elif LIBDIVIDE_USE_NEON || LIBDIVIDE_USE_VECTOR
 /* Overload of the / operator for vector division. */
 template<typename int_type, typename vec_type, int ALGO>
 vec_type operator/(vec_type numer, const divider<int_type, ALGO> & denom) {
     return denom.perform_divide_vector(numer);
 }
+
+/* And of the % operator for vector remainders. */
+template<typename int_type, typename vec_type, int ALGO>
+vec_type operator%(vec_type numer, const divider<int_type, ALGO> & denom) {
+    return denom.perform_mod_vector(numer);
+}
+#endif
+
+#if LIBDIVIDE_HAS_CONSTEXPR
+/* A divider by the compile time constant D, for the 8 to 64 bit types.  The compiler works out the magic number and shift, and the kernel for D's algorithm is picked statically as unswitch would, so nothing is generated or branched on at run time.  It is a divider, so / and % on scalars and vectors, divmod and the rest all take it. */
+template<typename T, T D>
+class constant_divider : public divider<T, libdivide_internal::constant_denom<T, D>::algorithm>
+{
+    static_assert(D != 0, "constant_divider can't divide by zero");
+    typedef libdivide_internal::constant_denom<T, D> constant;
+
+    public:
+    constexpr constant_divider() : divider<T, constant::algorithm>(constant::denom()) { }
+};
+#endif
+
+/* A divider that only computes remainders, for uint32_t and uint64_t.  It is faster than divider's operator% when the quotient isn't needed, e.g. for hash tables. */
+template<typename T>
+class fastmod_divider
+{
+    private:
+    typename libdivide_internal::fastmod_mid<T>::DenomType denom;
+
+    public:
+
+    /* Ordinary constructor, that takes the divisor as a parameter. */
+    fastmod_divider(T n) : denom(libdivide_internal::fastmod_gen(n)) { }
+
+    /* Default constructor, that divides by 1 */
+    fastmod_divider() : denom(libdivide_internal::fastmod_gen((T)1)) { }
+
+    /* Returns the remainder of dividing the parameter by the divisor */
+    T perform_mod(T val) const { return libdivide_internal::fastmod(val, &denom); }
+
+    /* Stores the remainders of the n values at numers to results, which may be numers */
+    void perform_mod_array(const T *numers, T *results, size_t n) const { libdivide_internal::fastmod_array(numers, results, n, &denom); }
+
+#if LIBDIVIDE_USE_SSE2
+    /* The remainders of the packed values in a __m128i or, with AVX2, a __m256i. */
+    template<typename V>
+    V perform_mod_vector(V val) const { return libdivide_internal::fastmod_vector(val, &denom); }
+#endif
+};
+
+template<typename int_type>
+int_type operator%(int_type numer, const fastmod_divider<int_type> & denom) {
+    return denom.perform_mod(numer);
+}
+
+#if LIBDIVIDE_USE_SSE2
+template<typename int_type>
+__m128i operator%(__m128i numer, const fastmod_divider<int_type> & denom) {
+    return denom.perform_mod_vector(numer);
+}
+
+#if LIBDIVIDE_USE_AVX2
+template<typename int_type>
+__m256i operator%(__m256i numer, const fastmod_divider<int_type> & denom) {
+    return denom.perform_mod_vector(numer);
+}
+#endif
+#endif
+
+/* Tests whether numbers are multiples of a divisor, for any of the four types, without dividing. */
+template<typename T>
+class divisibility
+{
+    private:
+    typename libdivide_internal::divisible_mid<T>::DenomType denom;
+
+    public:
+
+    /* Ordinary constructor, that takes the divisor as a parameter. */
+    divisibility(T n) : denom(libdivide_internal::divisible_gen(n)) { }
+
+    /* Returns whether val % divisor == 0 */
+    bool perform_test(T val) const { return libdivide_internal::is_divisible(val, &denom) != 0; }
+
+#if LIBDIVIDE_VEC128
+    /* Tests each packed value, returning all ones in the lanes that are divisible and zeros in the others. */
+    template<typename V>
+    V perform_test_vector(V val) const { return libdivide_internal::is_divisible_vector(val, &denom); }
+#endif
+#if LIBDIVIDE_USE_AVX512
+    /* For 512 bit vectors the result is a mask register instead, with one bit per lane. */
+    __mmask16 perform_test_vector(__m512i val) const { return libdivide_internal::is_divisible_vector(val, &denom); }
+#endif
+};
+
+template<typename int_type>
+bool is_divisible(int_type numer, const divisibility<int_type> & denom) {
+    return denom.perform_test(numer);
+}
+
+#if LIBDIVIDE_USE_SSE2
+template<typename int_type>
+__m128i is_divisible(__m128i numers, const divisibility<int_type> & denom) {
+    return denom.perform_test_vector(numers);
+}
+
+#if LIBDIVIDE_USE_AVX2
+template<typename int_type>
+__m256i is_divisible(__m256i numers, const divisibility<int_type> & denom) {
+    return denom.perform_test_vector(numers);
+}
+#endif
+#if LIBDIVIDE_USE_AVX512
+template<typename int_type>
+__mmask16 is_divisible(__m512i numers, const divisibility<int_type> & denom) {
+    return denom.perform_test_vector(numers);
+}
+#endif
+#elif LIBDIVIDE_USE_NEON || LIBDIVIDE_USE_VECTOR
+template<typename int_type, typename vec_type>
+vec_type is_divisible(vec_type numers, const divisibility<int_type> & denom) {
+    return denom.perform_test_vector(numers);
+}
+#endif
+
+/* A packed array of branchfree dividers for uint32_t, int32_t, uint64_t or int64_t, that owns its storage.  See libdivide_u32_array_t. */
+template<typename T>
+class divider_array
+{
+    private:
+    typedef typename libdivide_internal::array_mid<T>::ArrayType ArrayType;
+    std::vector<T> magics;
+    std::vector<uint8_t> mores;
+    ArrayType array;
+
+    void point(void) {
+        array.magics = magics.empty() ? NULL : &magics[0];
+        array.mores = &mores[0];
+    }
+
+    public:
+
+    /* Makes the dividers for the n divisors at d */
+    divider_array(const T *d, size_t n) : mores(LIBDIVIDE_ARRAY_PADDING) { assign(d, n); }
+
+    /* Default constructor, for an empty array */
+    divider_array() : mores(LIBDIVIDE_ARRAY_PADDING) { point(); array.n = 0; }
+
+    divider_array(const divider_array &other) : magics(other.magics), mores(other.mores), array(other.array) { point(); }
+
+    divider_array &operator=(const divider_array &other) {
+        magics = other.magics;
+        mores = other.mores;
+        array = other.array;
+        point();
+        return *this;
+    }
+
+    /* Replaces the dividers with those for the n divisors at d */
+    void assign(const T *d, size_t n) {
+        magics.resize(n);
+        mores.resize(n + LIBDIVIDE_ARRAY_PADDING);
+        point();
+        libdivide_internal::array_gen(d, &array, n);
+    }
+
+    size_t size() const { return array.n; }
+
+    /* Returns val divided by the divisor at index */
+    T perform_divide(T val, size_t index) const { return libdivide_internal::array_do(val, index, &array); }
+
+    /* Divides numers[i] by the divisor at indices[i], for n numerators */
+    void perform_divide_indexed(const T *numers, const uint32_t *indices, T *results, size_t n) const { libdivide_internal::array_do_indexed(numers, indices, results, n, &array); }
+
+#if LIBDIVIDE_USE_SSE2
+    /* Divides each lane of val by the divisor at the same lane of indices, which for the 64 bit types is half as wide */
+    template<typename V, typename I>
+    V perform_divide_gather(V val, I indices) const { return libdivide_internal::array_do_gather(val, indices, &array); }
+#endif
+
+    /* The C struct, to pass to the libdivide_*_array functions */
+    const ArrayType *get_array() const { return &array; }
+};
+
+/* A divider for numerators that are known to be multiples of the divisor, for any of the four types.  Dividing a number that isn't a multiple gives a meaningless result, or an assertion failure with LIBDIVIDE_ASSERTIONS_ON. */
+template<typename T>
+class exact_divider
+{
+    private:
+    typename libdivide_internal::exact_mid<T>::DenomType denom;
+
+    public:
+
+    /* Ordinary constructor, that takes the divisor as a parameter. */
+    exact_divider(T n) : denom(libdivide_internal::exact_gen(n)) { }
+
+    /* Default constructor, that divides by 1 */
+    exact_divider() : denom(libdivide_internal::exact_gen((T)1)) { }
+
+    /* Divides the parameter, a multiple of the divisor, by the divisor */
+    T perform_divide(T val) const { return libdivide_internal::exact_do(val, &denom); }
+
+#if LIBDIVIDE_VEC128
+    /* Divides a vector of any type that divider's perform_divide_vector takes. */
+    template<typename V>
+    V perform_divide_vector(V val) const { return libdivide_internal::exact_do_vector(val, &denom); }
+#endif
+};
+
+template<typename int_type>
+int_type operator/(int_type numer, const exact_divider<int_type> & denom) {
+    return denom.perform_divide(numer);
+}
+
+#if LIBDIVIDE_USE_SSE2
+template<typename int_type>
+__m128i operator/(__m128i numer, const exact_divider<int_type> & denom) {
+    return denom.perform_divide_vector(numer);
+}
+
+#if LIBDIVIDE_USE_AVX2
+template<typename int_type>
+__m256i operator/(__m256i numer, const exact_divider<int_type> & denom) {
+    return denom.perform_divide_vector(numer);
+}
+#endif
+#if LIBDIVIDE_USE_AVX512
+template<typename int_type>
+__m512i operator/(__m512i numer, const exact_divider<int_type> & denom) {
+    return denom.perform_divide_vector(numer);
+}
+#endif
+#elif LIBDIVIDE_USE_NEON || LIBDIVIDE_USE_VECTOR
+template<typename int_type, typename vec_type>
+vec_type operator/(vec_type numer, const exact_divider<int_type> & denom) {
+    return denom.perform_divide_vector(numer);
+}
+#endif
+
+/* A divider whose divide doesn't branch on the divisor, for any of the four types.  Use it over divider when the divisor keeps changing, e.g. one per row of a table.  An unsigned branchfree_divider can't divide by 1, so there is no default constructor. */
+template<typename T>
+class branchfree_divider
+{
+    private:
+    typename libdivide_internal::branchfree_mid<T>::DenomType denom;
+
+    public:
+
+    /* Ordinary constructor, that takes the divisor as a parameter. */
+    branchfree_divider(T n) : denom(libdivide_internal::branchfree_gen(n)) { }
+
+    /* Divides the parameter by the divisor, returning the quotient */
+    T perform_divide(T val) const { return libdivide_internal::branchfree_do(val, &denom); }
+
+#if LIBDIVIDE_USE_SSE2
+    /* Divides a __m128i or, with AVX2 and AVX-512, a __m256i or __m512i. */
+    template<typename V>
+    V perform_divide_vector(V val) const { return libdivide_internal::branchfree_do_vector(val, &denom); }
+#endif
+
+    /* Divides each of the n values in numers by the divisor, storing the quotients in results.  numers may be the same as results. */
+    void perform_divide_array(const T *numers, T *results, size_t n) const { libdivide_internal::branchfree_do_array(numers, results, n, &denom); }
+};
+
+template<typename int_type>
+int_type operator/(int_type numer, const branchfree_divider<int_type> & denom) {
+    return denom.perform_divide(numer);
+}
+
+#if LIBDIVIDE_USE_SSE2
+template<typename int_type>
+__m128i operator/(__m128i numer, const branchfree_divider<int_type> & denom) {
+    return denom.perform_divide_vector(numer);
+}
+
+#if LIBDIVIDE_USE_AVX2
+template<typename int_type>
+__m256i operator/(__m256i numer, const branchfree_divider<int_type> & denom) {
+    return denom.perform_divide_vector(numer);
+}
+#endif
+#if LIBDIVIDE_USE_AVX512
+template<typename int_type>
+__m512i operator/(__m512i numer, const branchfree_divider<int_type> & denom) {
+    return denom.perform_divide_vector(numer);
+}
+#endif
+#endif
+
+#if LIBDIVIDE_HAS_SPAN
+namespace libdivide_internal {
+    /* The array functions trust n, so a short results span would be written past its end.  This is checked even without LIBDIVIDE_ASSERTIONS_ON, and aborts like crash_divide. */
+    template<typename T, typename D>
+    void divide_span(std::span<const T> numers, std::span<T> results, const D & denom) {
+        if (results.size() < numers.size()) abort();
+        denom.perform_divide_array(numers.data(), results.data(), numers.size());
+    }
+
+#if LIBDIVIDE_HAS_EXECUTION
+    template<typename T, typename D, typename ExecutionPolicy>
+    void divide_span(ExecutionPolicy && policy, std::span<const T> numers, std::span<T> results, const D & denom) {
+        if (results.size() < numers.size()) abort();
+        const size_t chunk = LIBDIVIDE_PARALLEL_CHUNK / sizeof(T), n = numers.size();
+        if (n <= chunk) {
+            denom.perform_divide_array(numers.data(), results.data(), n);
+            return;
+        }
+        std::vector<size_t> starts((n + chunk - 1) / chunk);
+        size_t i;
+        for (i=0; i < starts.size(); i++) starts[i] = i * chunk;
+        std::for_each(std::forward<ExecutionPolicy>(policy), starts.begin(), starts.end(), [&](size_t start) {
+            denom.perform_divide_array(numers.data() + start, results.data() + start, n - start < chunk ? n - start : chunk);
+        });
+    }
+#endif
+}
+
+/* Divides each value in numers by denom, storing the quotients in results, which must be at least as long, or the program aborts.  This is the array function, which picks the algorithm once and runs the widest vector kernel built in, so it is much faster than std::transform with operator/.  numers and results may be the same span. */
+template<typename T, int ALGO>
+void divide(std::span<const std::type_identity_t<T> > numers, std::span<std::type_identity_t<T> > results, const divider<T, ALGO> & denom) {
+    libdivide_internal::divide_span<T>(numers, results, denom);
+}
+
+/* Divides each value in values by denom, in place. */
+template<typename T, int ALGO>
+void divide(std::span<std::type_identity_t<T> > values, const divider<T, ALGO> & denom) {
+    libdivide_internal::divide_span<T>(values, values, denom);
+}
+
+template<typename T>
+void divide(std::span<const std::type_identity_t<T> > numers, std::span<std::type_identity_t<T> > results, const branchfree_divider<T> & denom) {
+    libdivide_internal::divide_span<T>(numers, results, denom);
+}
+
+template<typename T>
+void divide(std::span<std::type_identity_t<T> > values, const branchfree_divider<T> & denom) {
+    libdivide_internal::divide_span<T>(values, values, denom);
+}
+
+#if LIBDIVIDE_HAS_EXECUTION
+/* The same, with the values split into chunks of LIBDIVIDE_PARALLEL_CHUNK bytes that the execution policy, e.g. std::execution::par_unseq, may divide on several threads.  Spans no longer than one chunk are divided on the calling thread. */
+template<typename ExecutionPolicy, typename T, int ALGO>
+std::enable_if_t<std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy> > >
+divide(ExecutionPolicy && policy, std::span<const std::type_identity_t<T> > numers, std::span<std::type_identity_t<T> > results, const divider<T, ALGO> & denom) {
+    libdivide_internal::divide_span<T>(std::forward<ExecutionPolicy>(policy), numers, results, denom);
+}
+
+template<typename ExecutionPolicy, typename T, int ALGO>
+std::enable_if_t<std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy> > >
+divide(ExecutionPolicy && policy, std::span<std::type_identity_t<T> > values, const divider<T, ALGO> & denom) {
+    libdivide_internal::divide_span<T>(std::forward<ExecutionPolicy>(policy), values, values, denom);
+}
+
+template<typename ExecutionPolicy, typename T>
+std::enable_if_t<std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy> > >
+divide(ExecutionPolicy && policy, std::span<const std::type_identity_t<T> > numers, std::span<std::type_identity_t<T> > results, const branchfree_divider<T> & denom) {
+    libdivide_internal::divide_span<T>(std::forward<ExecutionPolicy>(policy), numers, results, denom);
+}
+
+template<typename ExecutionPolicy, typename T>
+std::enable_if_t<std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy> > >
+divide(ExecutionPolicy && policy, std::span<std::type_identity_t<T> > values, const branchfree_divider<T> & denom) {
+    libdivide_internal::divide_span<T>(std::forward<ExecutionPolicy>(policy), values, values, denom);
+}
+#endif
+#endif
+
+#if defined(__clang__) || __GNUC__ >= 6
+#pragma GCC diagnostic pop
 #endif
 
 #endif //__cplusplus
 
 #endif //LIBDIVIDE_HEADER_ONLY
+
+#if (LIBDIVIDE_USE_AVX512 || LIBDIVIDE_USE_DISPATCH) && defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 13
+#pragma GCC diagnostic pop
+#endif
+
 #ifdef __cplusplus
 } //close namespace libdivide
 } //close anonymous namespace
@@ -1,3 +1,11 @@
+/* for CPU_SET, so that the threads test can pin the pool's workers */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE 1
+#endif
+
+/* this program is the one file that defines the divider table, when LIBDIVIDE_USE_TABLE reads it, and builds the thread pool for the threads test */
+#define LIBDIVIDE_USE_THREADS 1
+#define LIBDIVIDE_TABLE_IMPLEMENTATION 1
 #include "libdivide.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -31,6 +39,23 @@ using namespace libdivide;
 #include <sys/time.h> //for gettimeofday()
 #endif
 
+/* The cache test runs threads against a shared divider cache */
+#if LIBDIVIDE_HAS_ATOMICS && ! LIBDIVIDE_WINDOWS
+#include <pthread.h>
+#define CACHE_TEST 1
+#endif
+
+/* The threads test divides on libdivide's thread pool */
+#if LIBDIVIDE_HAS_THREADS
+#define THREADS_TEST 1
+#endif
+
+/* The gen test maps serialized dividers from a file */
+#if ! LIBDIVIDE_WINDOWS
+#include <sys/mman.h>
+#define MMAP_TEST 1
+#endif
+
 #if LIBDIVIDE_VEC64
 #define FUNC_VECTOR64(x)   (x)
 #else
@@ -49,6 +74,57 @@ using namespace libdivide;
 #define FUNC_VECTOR256(x)  NULL
 #endif
 
+#if LIBDIVIDE_VEC512
+#define FUNC_VECTOR512(x)  (x)
+#else
+#define FUNC_VECTOR512(x)  NULL
+#endif
+
+/* fastmod has x86 vectors only */
+#if LIBDIVIDE_USE_SSE2
+#define FUNC_FASTMOD128(x) (x)
+#else
+#define FUNC_FASTMOD128(x) NULL
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+#define FUNC_FASTMOD256(x) (x)
+#else
+#define FUNC_FASTMOD256(x) NULL
+#endif
+
+/* narrowing division has AVX2 and AVX-512 vectors only */
+#if LIBDIVIDE_USE_AVX2
+#define FUNC_NARROW256(x) (x)
+#else
+#define FUNC_NARROW256(x) NULL
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+#define FUNC_NARROW512(x) (x)
+#else
+#define FUNC_NARROW512(x) NULL
+#endif
+
+/* so do the branchfree dividers, at all three widths */
+#if LIBDIVIDE_USE_SSE2
+#define FUNC_BRANCHFREE128(x) (x)
+#else
+#define FUNC_BRANCHFREE128(x) NULL
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+#define FUNC_BRANCHFREE256(x) (x)
+#else
+#define FUNC_BRANCHFREE256(x) NULL
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+#define FUNC_BRANCHFREE512(x) (x)
+#else
+#define FUNC_BRANCHFREE512(x) NULL
+#endif
+
 struct random_state {
     uint32_t hi;
     uint32_t lo;
@@ -59,6 +135,9 @@ struct random_state {
 
 #define GEN_ITERATIONS (1 << 16)
 
+/* The array tests divide into a small scratch buffer, so that they stay in cache like the other tests */
+#define ARRAY_CHUNK 1024
+
 uint64_t sGlobalUInt64;
 
 static uint32_t my_random(struct random_state *state) {
@@ -84,6 +163,7 @@ struct FunctionParams_t {
     void *d; //a pointer to e.g. a uint32_t
     void *denomPtr; // a pointer to e.g. libdivide_u32_t
     const void *data; // a pointer to the data to be divided
+    const void *multiples; // the data rounded down to multiples of d, for exact division
 };
 
 struct time_result {
@@ -92,15 +172,45 @@ struct time_result {
 };
 
 #if LIBDIVIDE_USE_SSE2
+#define libdivide_zero_16s8()           _mm_setzero_si128()
+#define libdivide_zero_16u8()           _mm_setzero_si128()
+#define libdivide_zero_8s16()           _mm_setzero_si128()
+#define libdivide_zero_8u16()           _mm_setzero_si128()
 #define libdivide_zero_4s32()           _mm_setzero_si128()
 #define libdivide_zero_4u32()           _mm_setzero_si128()
 #define libdivide_zero_2s64()           _mm_setzero_si128()
 #define libdivide_zero_2u64()           _mm_setzero_si128()
+#define libdivide_add_16s8(x, y)        _mm_add_epi8(x, y)
+#define libdivide_add_16u8(x, y)        _mm_add_epi8(x, y)
+#define libdivide_add_8s16(x, y)        _mm_add_epi16(x, y)
+#define libdivide_add_8u16(x, y)        _mm_add_epi16(x, y)
 #define libdivide_add_4s32(x, y)        _mm_add_epi32(x, y)
 #define libdivide_add_4u32(x, y)        _mm_add_epi32(x, y)
 #define libdivide_add_2s64(x, y)        _mm_add_epi64(x, y)
 #define libdivide_add_2u64(x, y)        _mm_add_epi64(x, y)
 
+int8_t libdivide_sum_16s8(__m128i x) {
+    const int8_t *comps = (const int8_t*)&x;
+    int8_t sum = 0;
+    int i;
+    for (i = 0; i < 16; i++) sum += comps[i];
+    return sum;
+}
+uint8_t libdivide_sum_16u8(__m128i x) {
+    const uint8_t *comps = (const uint8_t*)&x;
+    uint8_t sum = 0;
+    int i;
+    for (i = 0; i < 16; i++) sum += comps[i];
+    return sum;
+}
+int16_t libdivide_sum_8s16(__m128i x) {
+    const int16_t *comps = (const int16_t*)&x;
+    return comps[0] + comps[1] + comps[2] + comps[3] + comps[4] + comps[5] + comps[6] + comps[7];
+}
+uint16_t libdivide_sum_8u16(__m128i x) {
+    const uint16_t *comps = (const uint16_t*)&x;
+    return comps[0] + comps[1] + comps[2] + comps[3] + comps[4] + comps[5] + comps[6] + comps[7];
+}
 int32_t libdivide_sum_4s32(__m128i x) {
     const int32_t *comps = (const int32_t*)&x;
     return comps[0] + comps[1] + comps[2] + comps[3];
@@ -117,7 +227,91 @@ uint64_t libdivide_sum_2u64(__m128i x) {
     const uint64_t *comps = (const uint64_t*)&x;
     return comps[0] + comps[1];
 }
+
+#if LIBDIVIDE_USE_AVX2
+#define libdivide_zero_32s8()           _mm256_setzero_si256()
+#define libdivide_zero_32u8()           _mm256_setzero_si256()
+#define libdivide_zero_16s16()          _mm256_setzero_si256()
+#define libdivide_zero_16u16()          _mm256_setzero_si256()
+#define libdivide_zero_8s32()           _mm256_setzero_si256()
+#define libdivide_zero_8u32()           _mm256_setzero_si256()
+#define libdivide_zero_4s64()           _mm256_setzero_si256()
+#define libdivide_zero_4u64()           _mm256_setzero_si256()
+#define libdivide_add_32s8(x, y)        _mm256_add_epi8(x, y)
+#define libdivide_add_32u8(x, y)        _mm256_add_epi8(x, y)
+#define libdivide_add_16s16(x, y)       _mm256_add_epi16(x, y)
+#define libdivide_add_16u16(x, y)       _mm256_add_epi16(x, y)
+#define libdivide_add_8s32(x, y)        _mm256_add_epi32(x, y)
+#define libdivide_add_8u32(x, y)        _mm256_add_epi32(x, y)
+#define libdivide_add_4s64(x, y)        _mm256_add_epi64(x, y)
+#define libdivide_add_4u64(x, y)        _mm256_add_epi64(x, y)
+
+int8_t libdivide_sum_32s8(__m256i x) {
+    return libdivide_sum_16s8(_mm_add_epi8(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+}
+uint8_t libdivide_sum_32u8(__m256i x) {
+    return libdivide_sum_16u8(_mm_add_epi8(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+}
+int16_t libdivide_sum_16s16(__m256i x) {
+    return libdivide_sum_8s16(_mm_add_epi16(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+}
+uint16_t libdivide_sum_16u16(__m256i x) {
+    return libdivide_sum_8u16(_mm_add_epi16(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+}
+int32_t libdivide_sum_8s32(__m256i x) {
+    return libdivide_sum_4s32(_mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+}
+uint32_t libdivide_sum_8u32(__m256i x) {
+    return libdivide_sum_4u32(_mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+}
+int64_t libdivide_sum_4s64(__m256i x) {
+    return libdivide_sum_2s64(_mm_add_epi64(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+}
+uint64_t libdivide_sum_4u64(__m256i x) {
+    return libdivide_sum_2u64(_mm_add_epi64(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+#define libdivide_zero_64s8()           _mm512_setzero_si512()
+#define libdivide_zero_64u8()           _mm512_setzero_si512()
+#define libdivide_zero_32s16()          _mm512_setzero_si512()
+#define libdivide_zero_32u16()          _mm512_setzero_si512()
+#define libdivide_zero_16s32()          _mm512_setzero_si512()
+#define libdivide_zero_16u32()          _mm512_setzero_si512()
+#define libdivide_zero_8s64()           _mm512_setzero_si512()
+#define libdivide_zero_8u64()           _mm512_setzero_si512()
+#define libdivide_add_64s8(x, y)        _mm512_add_epi8(x, y)
+#define libdivide_add_64u8(x, y)        _mm512_add_epi8(x, y)
+#define libdivide_add_32s16(x, y)       _mm512_add_epi16(x, y)
+#define libdivide_add_32u16(x, y)       _mm512_add_epi16(x, y)
+#define libdivide_add_16s32(x, y)       _mm512_add_epi32(x, y)
+#define libdivide_add_16u32(x, y)       _mm512_add_epi32(x, y)
+#define libdivide_add_8s64(x, y)        _mm512_add_epi64(x, y)
+#define libdivide_add_8u64(x, y)        _mm512_add_epi64(x, y)
+/* There are no 8 or 16 bit reductions, so those sums fold down to 256 bits first */
+#define libdivide_sum_64s8(x)           libdivide_sum_32s8(_mm256_add_epi8(_mm512_castsi512_si256(x), _mm512_extracti64x4_epi64(x, 1)))
+#define libdivide_sum_64u8(x)           libdivide_sum_32u8(_mm256_add_epi8(_mm512_castsi512_si256(x), _mm512_extracti64x4_epi64(x, 1)))
+#define libdivide_sum_32s16(x)          libdivide_sum_16s16(_mm256_add_epi16(_mm512_castsi512_si256(x), _mm512_extracti64x4_epi64(x, 1)))
+#define libdivide_sum_32u16(x)          libdivide_sum_16u16(_mm256_add_epi16(_mm512_castsi512_si256(x), _mm512_extracti64x4_epi64(x, 1)))
+#define libdivide_sum_16s32(x)          ((int32_t)_mm512_reduce_add_epi32(x))
+#define libdivide_sum_16u32(x)          ((uint32_t)_mm512_reduce_add_epi32(x))
+#define libdivide_sum_8s64(x)           ((int64_t)_mm512_reduce_add_epi64(x))
+#define libdivide_sum_8u64(x)           ((uint64_t)_mm512_reduce_add_epi64(x))
+#endif
 #elif LIBDIVIDE_USE_NEON
+#define libdivide_zero_8s8()            vdup_n_s8(0)
+#define libdivide_zero_8u8()            vdup_n_u8(0)
+#define libdivide_zero_16s8()           vdupq_n_s8(0)
+#define libdivide_zero_16u8()           vdupq_n_u8(0)
+#define libdivide_zero_32s8()           (libdivide_32s8_t) { { vdupq_n_s8(0), vdupq_n_s8(0) } }
+#define libdivide_zero_32u8()           (libdivide_32u8_t) { { vdupq_n_u8(0), vdupq_n_u8(0) } }
+#define libdivide_zero_4s16()           vdup_n_s16(0)
+#define libdivide_zero_4u16()           vdup_n_u16(0)
+#define libdivide_zero_8s16()           vdupq_n_s16(0)
+#define libdivide_zero_8u16()           vdupq_n_u16(0)
+#define libdivide_zero_16s16()          (libdivide_16s16_t) { { vdupq_n_s16(0), vdupq_n_s16(0) } }
+#define libdivide_zero_16u16()          (libdivide_16u16_t) { { vdupq_n_u16(0), vdupq_n_u16(0) } }
 #define libdivide_zero_2s32()           vdup_n_s32(0)
 #define libdivide_zero_2u32()           vdup_n_u32(0)
 #define libdivide_zero_1s64()           vdup_n_s64(0)
@@ -131,6 +325,18 @@ uint64_t libdivide_sum_2u64(__m128i x) {
 #define libdivide_zero_4s64()           (libdivide_4s64_t) { { vdupq_n_s64(0), vdupq_n_s64(0) } }
 #define libdivide_zero_4u64()           (libdivide_4u64_t) { { vdupq_n_u64(0), vdupq_n_u64(0) } }
 
+#define libdivide_add_8s8(x, y)         vadd_s8(x, y)
+#define libdivide_add_8u8(x, y)         vadd_u8(x, y)
+#define libdivide_add_16s8(x, y)        vaddq_s8(x, y)
+#define libdivide_add_16u8(x, y)        vaddq_u8(x, y)
+#define libdivide_add_32s8(x, y)        (libdivide_32s8_t) { { vaddq_s8(x.val[0], y.val[0]), vaddq_s8(x.val[1], y.val[1]) } }
+#define libdivide_add_32u8(x, y)        (libdivide_32u8_t) { { vaddq_u8(x.val[0], y.val[0]), vaddq_u8(x.val[1], y.val[1]) } }
+#define libdivide_add_4s16(x, y)        vadd_s16(x, y)
+#define libdivide_add_4u16(x, y)        vadd_u16(x, y)
+#define libdivide_add_8s16(x, y)        vaddq_s16(x, y)
+#define libdivide_add_8u16(x, y)        vaddq_u16(x, y)
+#define libdivide_add_16s16(x, y)       (libdivide_16s16_t) { { vaddq_s16(x.val[0], y.val[0]), vaddq_s16(x.val[1], y.val[1]) } }
+#define libdivide_add_16u16(x, y)       (libdivide_16u16_t) { { vaddq_u16(x.val[0], y.val[0]), vaddq_u16(x.val[1], y.val[1]) } }
 #define libdivide_add_2s32(x, y)        vadd_s32(x, y)
 #define libdivide_add_2u32(x, y)        vadd_u32(x, y)
 #define libdivide_add_1s64(x, y)        vadd_s64(x, y)
@@ -144,6 +350,18 @@ uint64_t libdivide_sum_2u64(__m128i x) {
 #define libdivide_add_4s64(x, y)        (libdivide_4s64_t) { { vaddq_s64(x.val[0], y.val[0]), vaddq_s64(x.val[1], y.val[1]) } }
 #define libdivide_add_4u64(x, y)        (libdivide_4u64_t) { { vaddq_u64(x.val[0], y.val[0]), vaddq_u64(x.val[1], y.val[1]) } }
 
+#define libdivide_sum_8s8(x)            ((int8_t)libdivide_sum_4s16(vpaddl_s8(x)))
+#define libdivide_sum_8u8(x)            ((uint8_t)libdivide_sum_4u16(vpaddl_u8(x)))
+#define libdivide_sum_16s8(x)           ((int8_t)libdivide_sum_8s16(vpaddlq_s8(x)))
+#define libdivide_sum_16u8(x)           ((uint8_t)libdivide_sum_8u16(vpaddlq_u8(x)))
+#define libdivide_sum_32s8(x)           ((int8_t)(libdivide_sum_16s8((x).val[0]) + libdivide_sum_16s8((x).val[1])))
+#define libdivide_sum_32u8(x)           ((uint8_t)(libdivide_sum_16u8((x).val[0]) + libdivide_sum_16u8((x).val[1])))
+#define libdivide_sum_4s16(x)           ((int16_t)(vget_lane_s16(x, 0) + vget_lane_s16(x, 1) + vget_lane_s16(x, 2) + vget_lane_s16(x, 3)))
+#define libdivide_sum_4u16(x)           ((uint16_t)(vget_lane_u16(x, 0) + vget_lane_u16(x, 1) + vget_lane_u16(x, 2) + vget_lane_u16(x, 3)))
+#define libdivide_sum_8s16(x)           ((int16_t)(libdivide_sum_4s16(vget_low_s16(x)) + libdivide_sum_4s16(vget_high_s16(x))))
+#define libdivide_sum_8u16(x)           ((uint16_t)(libdivide_sum_4u16(vget_low_u16(x)) + libdivide_sum_4u16(vget_high_u16(x))))
+#define libdivide_sum_16s16(x)          ((int16_t)(libdivide_sum_8s16((x).val[0]) + libdivide_sum_8s16((x).val[1])))
+#define libdivide_sum_16u16(x)          ((uint16_t)(libdivide_sum_8u16((x).val[0]) + libdivide_sum_8u16((x).val[1])))
 #define libdivide_sum_2s32(x)           vget_lane_s32(vpadd_s32(x,x), 0)
 #define libdivide_sum_2u32(x)           vget_lane_u32(vpadd_u32(x,x), 0)
 #define libdivide_sum_1s64(x)           vget_lane_s64(x, 0)
@@ -157,6 +375,18 @@ uint64_t libdivide_sum_2u64(__m128i x) {
 #define libdivide_sum_4s64(x)           (libdivide_sum_2s64((x).val[0]) + libdivide_sum_2s64((x).val[1]))
 #define libdivide_sum_4u64(x)           (libdivide_sum_2u64((x).val[0]) + libdivide_sum_2u64((x).val[1]))
 #elif LIBDIVIDE_USE_VECTOR
+#define libdivide_zero_8s8()            (libdivide_8s8_t) { 0, 0, 0, 0, 0, 0, 0, 0 }
+#define libdivide_zero_8u8()            (libdivide_8u8_t) { 0, 0, 0, 0, 0, 0, 0, 0 }
+#define libdivide_zero_16s8()           (libdivide_16s8_t) { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+#define libdivide_zero_16u8()           (libdivide_16u8_t) { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+#define libdivide_zero_32s8()           (libdivide_32s8_t) { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+#define libdivide_zero_32u8()           (libdivide_32u8_t) { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+#define libdivide_zero_4s16()           (libdivide_4s16_t) { 0, 0, 0, 0 }
+#define libdivide_zero_4u16()           (libdivide_4u16_t) { 0, 0, 0, 0 }
+#define libdivide_zero_8s16()           (libdivide_8s16_t) { 0, 0, 0, 0, 0, 0, 0, 0 }
+#define libdivide_zero_8u16()           (libdivide_8u16_t) { 0, 0, 0, 0, 0, 0, 0, 0 }
+#define libdivide_zero_16s16()          (libdivide_16s16_t) { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+#define libdivide_zero_16u16()          (libdivide_16u16_t) { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
 #define libdivide_zero_2s32()           (libdivide_2s32_t) { 0, 0 }
 #define libdivide_zero_2u32()           (libdivide_2u32_t) { 0, 0 }
 #define libdivide_zero_1s64()           (libdivide_1s64_t) { 0 }
@@ -170,6 +400,18 @@ uint64_t libdivide_sum_2u64(__m128i x) {
 #define libdivide_zero_4s64()           (libdivide_4s64_t) { 0, 0, 0, 0 }
 #define libdivide_zero_4u64()           (libdivide_4u64_t) { 0, 0, 0, 0 }
 
+#define libdivide_add_8s8(x, y)         ((x)+(y))
+#define libdivide_add_8u8(x, y)         ((x)+(y))
+#define libdivide_add_16s8(x, y)        ((x)+(y))
+#define libdivide_add_16u8(x, y)        ((x)+(y))
+#define libdivide_add_32s8(x, y)        ((x)+(y))
+#define libdivide_add_32u8(x, y)        ((x)+(y))
+#define libdivide_add_4s16(x, y)        ((x)+(y))
+#define libdivide_add_4u16(x, y)        ((x)+(y))
+#define libdivide_add_8s16(x, y)        ((x)+(y))
+#define libdivide_add_8u16(x, y)        ((x)+(y))
+#define libdivide_add_16s16(x, y)       ((x)+(y))
+#define libdivide_add_16u16(x, y)       ((x)+(y))
 #define libdivide_add_2s32(x, y)        ((x)+(y))
 #define libdivide_add_2u32(x, y)        ((x)+(y))
 #define libdivide_add_1s64(x, y)        ((x)+(y))
@@ -183,6 +425,18 @@ uint64_t libdivide_sum_2u64(__m128i x) {
 #define libdivide_add_4s64(x, y)        ((x)+(y))
 #define libdivide_add_4u64(x, y)        ((x)+(y))
 
+#define libdivide_sum_8s8(x)            ((int8_t)(x[0] + x[1] + x[2] + x[3] + x[4] + x[5] + x[6] + x[7]))
+#define libdivide_sum_8u8(x)            ((uint8_t)(x[0] + x[1] + x[2] + x[3] + x[4] + x[5] + x[6] + x[7]))
+#define libdivide_sum_16s8(x)           ((int8_t)(x[0] + x[1] + x[2] + x[3] + x[4] + x[5] + x[6] + x[7] + x[8] + x[9] + x[10] + x[11] + x[12] + x[13] + x[14] + x[15]))
+#define libdivide_sum_16u8(x)           ((uint8_t)(x[0] + x[1] + x[2] + x[3] + x[4] + x[5] + x[6] + x[7] + x[8] + x[9] + x[10] + x[11] + x[12] + x[13] + x[14] + x[15]))
+#define libdivide_sum_32s8(x)           ((int8_t)(x[0] + x[1] + x[2] + x[3] + x[4] + x[5] + x[6] + x[7] + x[8] + x[9] + x[10] + x[11] + x[12] + x[13] + x[14] + x[15] + x[16] + x[17] + x[18] + x[19] + x[20] + x[21] + x[22] + x[23] + x[24] + x[25] + x[26] + x[27] + x[28] + x[29] + x[30] + x[31]))
+#define libdivide_sum_32u8(x)           ((uint8_t)(x[0] + x[1] + x[2] + x[3] + x[4] + x[5] + x[6] + x[7] + x[8] + x[9] + x[10] + x[11] + x[12] + x[13] + x[14] + x[15] + x[16] + x[17] + x[18] + x[19] + x[20] + x[21] + x[22] + x[23] + x[24] + x[25] + x[26] + x[27] + x[28] + x[29] + x[30] + x[31]))
+#define libdivide_sum_4s16(x)           ((int16_t)(x[0] + x[1] + x[2] + x[3]))
+#define libdivide_sum_4u16(x)           ((uint16_t)(x[0] + x[1] + x[2] + x[3]))
+#define libdivide_sum_8s16(x)           ((int16_t)(x[0] + x[1] + x[2] + x[3] + x[4] + x[5] + x[6] + x[7]))
+#define libdivide_sum_8u16(x)           ((uint16_t)(x[0] + x[1] + x[2] + x[3] + x[4] + x[5] + x[6] + x[7]))
+#define libdivide_sum_16s16(x)          ((int16_t)(x[0] + x[1] + x[2] + x[3] + x[4] + x[5] + x[6] + x[7] + x[8] + x[9] + x[10] + x[11] + x[12] + x[13] + x[14] + x[15]))
+#define libdivide_sum_16u16(x)          ((uint16_t)(x[0] + x[1] + x[2] + x[3] + x[4] + x[5] + x[6] + x[7] + x[8] + x[9] + x[10] + x[11] + x[12] + x[13] + x[14] + x[15]))
 #define libdivide_sum_2s32(x)           (x[0] + x[1])
 #define libdivide_sum_2u32(x)           (x[0] + x[1])
 #define libdivide_sum_1s64(x)           (x[0])
@@ -199,6 +453,12 @@ uint64_t libdivide_sum_2u64(__m128i x) {
 
 static struct time_result time_function(uint64_t (*func)(struct FunctionParams_t*), struct FunctionParams_t *params) {
     struct time_result tresult;
+    if (! func) {
+        /* The 8 and 16 bit types have no remainder or rounding functions, so their columns are left empty */
+        tresult.time = 0;
+        tresult.result = 0;
+        return tresult;
+    }
 #if LIBDIVIDE_WINDOWS
     LARGE_INTEGER start, end;
     QueryPerformanceCounter(&start);
@@ -220,1126 +480,7585 @@ static struct time_result time_function(uint64_t (*func)(struct FunctionParams_t
     return tresult;
 }
 
-//U32
+//U8
 
-NOINLINE static uint64_t mine_u32(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_u8(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
-    const uint32_t *data = (const uint32_t *)params->data;
-    uint32_t sum = 0;
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    uint8_t sum = 0;
     for (iter = 0; iter < ITERATIONS; iter++) {
-        uint32_t numer = data[iter];
-        sum += libdivide_u32_do(numer, &denom);
+        uint8_t numer = data[iter];
+        sum += libdivide_u8_do(numer, &denom);
     }
     return sum;
 }
 
-NOINLINE static uint64_t mine_u32_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_u8_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
-    const uint32_t *data = (const uint32_t *)params->data;
-    uint32_t sum = 0;
-    int algo = libdivide_u32_get_algorithm(&denom);
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    uint8_t sum = 0;
+    int algo = libdivide_u8_get_algorithm(&denom);
     if (algo == 0) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            uint32_t numer = data[iter];
-            sum += libdivide_u32_do_alg0(numer, &denom);
+            uint8_t numer = data[iter];
+            sum += libdivide_u8_do_alg0(numer, &denom);
         }
     }
     else if (algo == 1) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            uint32_t numer = data[iter];
-            sum += libdivide_u32_do_alg1(numer, &denom);
+            uint8_t numer = data[iter];
+            sum += libdivide_u8_do_alg1(numer, &denom);
         }
     }
     else if (algo == 2) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            uint32_t numer = data[iter];
-            sum += libdivide_u32_do_alg2(numer, &denom);
+            uint8_t numer = data[iter];
+            sum += libdivide_u8_do_alg2(numer, &denom);
         }
     }
 
     return sum;
 }
 
-NOINLINE static uint64_t his_u32(struct FunctionParams_t *params) {
+NOINLINE static uint64_t his_u8(struct FunctionParams_t *params) {
     unsigned iter;
-    const uint32_t *data = (const uint32_t *)params->data;
-    const uint32_t d = *(uint32_t *)params->d;
-    uint32_t sum = 0;
+    const uint8_t *data = (const uint8_t *)params->data;
+    const uint8_t d = *(uint8_t *)params->d;
+    uint8_t sum = 0;
     for (iter = 0; iter < ITERATIONS; iter++) {
-        uint32_t numer = data[iter];
+        uint8_t numer = data[iter];
         sum += numer / d;
     }
     return sum;
 }
 
-NOINLINE static uint64_t mine_u32_generate(struct FunctionParams_t *params) {
-    uint32_t *dPtr = (uint32_t *)params->d;
-    struct libdivide_u32_t *denomPtr = (struct libdivide_u32_t *)params->denomPtr;
+NOINLINE static uint64_t mine_u8_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    uint8_t results[ARRAY_CHUNK];
+    uint8_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u8_do_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u8_generate(struct FunctionParams_t *params) {
+    uint8_t *dPtr = (uint8_t *)params->d;
+    struct libdivide_u8_t *denomPtr = (struct libdivide_u8_t *)params->denomPtr;
     unsigned iter;
     for (iter = 0; iter < GEN_ITERATIONS; iter++) {
-        *denomPtr = libdivide_u32_gen(*dPtr);
+        *denomPtr = libdivide_u8_gen(*dPtr);
     }
     return *dPtr;
 }
 
 #if LIBDIVIDE_VEC64
-NOINLINE static uint64_t mine_2u32_vector(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_8u8_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
-    const uint32_t *data = (const uint32_t *)params->data;
-    libdivide_2u32_t sumX = libdivide_zero_2u32();
-    for (iter = 0; iter < ITERATIONS; iter+=2) {
-        libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
-        libdivide_2u32_t result = libdivide_2u32_do_vector(numers, &denom);
-        sumX = libdivide_add_2u32(sumX, result);
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    libdivide_8u8_t sumX = libdivide_zero_8u8();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u8_t numers = *((const libdivide_8u8_t*)(data + iter));
+        libdivide_8u8_t result = libdivide_8u8_do_vector(numers, &denom);
+        sumX = libdivide_add_8u8(sumX, result);
     }
-    return libdivide_sum_2u32(sumX);
+    return libdivide_sum_8u8(sumX);
 }
 
-NOINLINE static uint64_t mine_2u32_vector_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_8u8_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
-    const uint32_t *data = (const uint32_t *)params->data;
-    libdivide_2u32_t sumX = libdivide_zero_2u32();
-    int algo = libdivide_u32_get_algorithm(&denom);
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    libdivide_8u8_t sumX = libdivide_zero_8u8();
+    int algo = libdivide_u8_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
-            libdivide_2u32_t result = libdivide_2u32_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_2u32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u8_t numers = *((const libdivide_8u8_t*)(data + iter));
+            libdivide_8u8_t result = libdivide_8u8_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_8u8(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
-            libdivide_2u32_t result = libdivide_2u32_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_2u32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u8_t numers = *((const libdivide_8u8_t*)(data + iter));
+            libdivide_8u8_t result = libdivide_8u8_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_8u8(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
-            libdivide_2u32_t result = libdivide_2u32_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_2u32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u8_t numers = *((const libdivide_8u8_t*)(data + iter));
+            libdivide_8u8_t result = libdivide_8u8_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_8u8(sumX, result);
         }
     }
-    return libdivide_sum_2u32(sumX);
+    return libdivide_sum_8u8(sumX);
 }
 #endif
 
 #if LIBDIVIDE_VEC128
-NOINLINE static uint64_t mine_4u32_vector(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_16u8_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
-    const uint32_t *data = (const uint32_t *)params->data;
-    libdivide_4u32_t sumX = libdivide_zero_4u32();
-    for (iter = 0; iter < ITERATIONS; iter+=4) {
-        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
-        libdivide_4u32_t result = libdivide_4u32_do_vector(numers, &denom);
-        sumX = libdivide_add_4u32(sumX, result);
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    libdivide_16u8_t sumX = libdivide_zero_16u8();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u8_t numers = *((const libdivide_16u8_t*)(data + iter));
+        libdivide_16u8_t result = libdivide_16u8_do_vector(numers, &denom);
+        sumX = libdivide_add_16u8(sumX, result);
     }
-    return libdivide_sum_4u32(sumX);
+    return libdivide_sum_16u8(sumX);
 }
 
-NOINLINE static uint64_t mine_4u32_vector_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_16u8_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
-    const uint32_t *data = (const uint32_t *)params->data;
-    libdivide_4u32_t sumX = libdivide_zero_4u32();
-    int algo = libdivide_u32_get_algorithm(&denom);
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    libdivide_16u8_t sumX = libdivide_zero_16u8();
+    int algo = libdivide_u8_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
-            libdivide_4u32_t result = libdivide_4u32_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_4u32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16u8_t numers = *((const libdivide_16u8_t*)(data + iter));
+            libdivide_16u8_t result = libdivide_16u8_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_16u8(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
-            libdivide_4u32_t result = libdivide_4u32_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_4u32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16u8_t numers = *((const libdivide_16u8_t*)(data + iter));
+            libdivide_16u8_t result = libdivide_16u8_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_16u8(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
-            libdivide_4u32_t result = libdivide_4u32_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_4u32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16u8_t numers = *((const libdivide_16u8_t*)(data + iter));
+            libdivide_16u8_t result = libdivide_16u8_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_16u8(sumX, result);
         }
     }
-    return libdivide_sum_4u32(sumX);
+    return libdivide_sum_16u8(sumX);
 }
 #endif
 
 #if LIBDIVIDE_VEC256
-NOINLINE static uint64_t mine_8u32_vector(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_32u8_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
-    const uint32_t *data = (const uint32_t *)params->data;
-    libdivide_8u32_t sumX = libdivide_zero_8u32();
-    for (iter = 0; iter < ITERATIONS; iter+=8) {
-        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
-        libdivide_8u32_t result = libdivide_8u32_do_vector(numers, &denom);
-        sumX = libdivide_add_8u32(sumX, result);
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    libdivide_32u8_t sumX = libdivide_zero_32u8();
+    for (iter = 0; iter < ITERATIONS; iter+=32) {
+        libdivide_32u8_t numers = *((const libdivide_32u8_t*)(data + iter));
+        libdivide_32u8_t result = libdivide_32u8_do_vector(numers, &denom);
+        sumX = libdivide_add_32u8(sumX, result);
     }
-    return libdivide_sum_8u32(sumX);
+    return libdivide_sum_32u8(sumX);
 }
 
-NOINLINE static uint64_t mine_8u32_vector_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_32u8_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
-    const uint32_t *data = (const uint32_t *)params->data;
-    libdivide_8u32_t sumX = libdivide_zero_8u32();
-    int algo = libdivide_u32_get_algorithm(&denom);
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    libdivide_32u8_t sumX = libdivide_zero_32u8();
+    int algo = libdivide_u8_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=8) {
-            libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
-            libdivide_8u32_t result = libdivide_8u32_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_8u32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32u8_t numers = *((const libdivide_32u8_t*)(data + iter));
+            libdivide_32u8_t result = libdivide_32u8_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_32u8(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=8) {
-            libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
-            libdivide_8u32_t result = libdivide_8u32_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_8u32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32u8_t numers = *((const libdivide_32u8_t*)(data + iter));
+            libdivide_32u8_t result = libdivide_32u8_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_32u8(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=8) {
-            libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
-            libdivide_8u32_t result = libdivide_8u32_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_8u32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32u8_t numers = *((const libdivide_32u8_t*)(data + iter));
+            libdivide_32u8_t result = libdivide_32u8_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_32u8(sumX, result);
         }
     }
-    return libdivide_sum_8u32(sumX);
+    return libdivide_sum_32u8(sumX);
 }
 #endif
 
-//S32
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_64u8_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    libdivide_64u8_t sumX = libdivide_zero_64u8();
+    for (iter = 0; iter < ITERATIONS; iter+=64) {
+        libdivide_64u8_t numers = *((const libdivide_64u8_t*)(data + iter));
+        libdivide_64u8_t result = libdivide_64u8_do_vector(numers, &denom);
+        sumX = libdivide_add_64u8(sumX, result);
+    }
+    return libdivide_sum_64u8(sumX);
+}
 
-NOINLINE static uint64_t mine_s32(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_64u8_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
-    const int32_t *data = (const int32_t *)params->data;
-    int32_t sum = 0;
+    const struct libdivide_u8_t denom = *(struct libdivide_u8_t *)params->denomPtr;
+    const uint8_t *data = (const uint8_t *)params->data;
+    libdivide_64u8_t sumX = libdivide_zero_64u8();
+    int algo = libdivide_u8_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=64) {
+            libdivide_64u8_t numers = *((const libdivide_64u8_t*)(data + iter));
+            libdivide_64u8_t result = libdivide_64u8_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_64u8(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=64) {
+            libdivide_64u8_t numers = *((const libdivide_64u8_t*)(data + iter));
+            libdivide_64u8_t result = libdivide_64u8_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_64u8(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=64) {
+            libdivide_64u8_t numers = *((const libdivide_64u8_t*)(data + iter));
+            libdivide_64u8_t result = libdivide_64u8_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_64u8(sumX, result);
+        }
+    }
+    return libdivide_sum_64u8(sumX);
+}
+#endif
+
+//S8
+
+NOINLINE static uint64_t mine_s8(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    int8_t sum = 0;
     for (iter = 0; iter < ITERATIONS; iter++) {
-        int32_t numer = data[iter];
-        sum += libdivide_s32_do(numer, &denom);
+        int8_t numer = data[iter];
+        sum += libdivide_s8_do(numer, &denom);
     }
     return sum;
 }
 
-NOINLINE static uint64_t mine_s32_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_s8_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    int32_t sum = 0;
-    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
-    const int32_t *data = (const int32_t *)params->data;
-    int algo = libdivide_s32_get_algorithm(&denom);
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    int8_t sum = 0;
+    int algo = libdivide_s8_get_algorithm(&denom);
     if (algo == 0) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            int32_t numer = data[iter];
-            sum += libdivide_s32_do_alg0(numer, &denom);
+            int8_t numer = data[iter];
+            sum += libdivide_s8_do_alg0(numer, &denom);
         }
     }
     else if (algo == 1) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            int32_t numer = data[iter];
-            sum += libdivide_s32_do_alg1(numer, &denom);
+            int8_t numer = data[iter];
+            sum += libdivide_s8_do_alg1(numer, &denom);
         }
     }
     else if (algo == 2) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            int32_t numer = data[iter];
-            sum += libdivide_s32_do_alg2(numer, &denom);
+            int8_t numer = data[iter];
+            sum += libdivide_s8_do_alg2(numer, &denom);
         }
     }
     else if (algo == 3) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            int32_t numer = data[iter];
-            sum += libdivide_s32_do_alg3(numer, &denom);
+            int8_t numer = data[iter];
+            sum += libdivide_s8_do_alg3(numer, &denom);
         }
     }
     else if (algo == 4) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            int32_t numer = data[iter];
-            sum += libdivide_s32_do_alg4(numer, &denom);
+            int8_t numer = data[iter];
+            sum += libdivide_s8_do_alg4(numer, &denom);
         }
     }
 
-    return (uint64_t)sum;
+    return sum;
 }
 
-NOINLINE static uint64_t his_s32(struct FunctionParams_t *params) {
+NOINLINE static uint64_t his_s8(struct FunctionParams_t *params) {
     unsigned iter;
-    int32_t sum = 0;
-    const int32_t d = *(int32_t *)params->d;
-    const int32_t *data = (const int32_t *)params->data;
+    const int8_t *data = (const int8_t *)params->data;
+    const int8_t d = *(int8_t *)params->d;
+    int8_t sum = 0;
     for (iter = 0; iter < ITERATIONS; iter++) {
-        int32_t numer = data[iter];
+        int8_t numer = data[iter];
         sum += numer / d;
     }
     return sum;
 }
 
-NOINLINE static uint64_t mine_s32_generate(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_s8_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    int8_t results[ARRAY_CHUNK];
+    int8_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s8_do_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s8_generate(struct FunctionParams_t *params) {
+    int8_t *dPtr = (int8_t *)params->d;
+    struct libdivide_s8_t *denomPtr = (struct libdivide_s8_t *)params->denomPtr;
     unsigned iter;
-    int32_t *dPtr = (int32_t *)params->d;
-    struct libdivide_s32_t *denomPtr = (struct libdivide_s32_t *)params->denomPtr;
     for (iter = 0; iter < GEN_ITERATIONS; iter++) {
-        *denomPtr = libdivide_s32_gen(*dPtr);
+        *denomPtr = libdivide_s8_gen(*dPtr);
     }
     return *dPtr;
 }
 
 #if LIBDIVIDE_VEC64
-NOINLINE static uint64_t mine_2s32_vector(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_8s8_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_2s32_t sumX = libdivide_zero_2s32();
-    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
-    const int32_t *data = (const int32_t *)params->data;
-    for (iter = 0; iter < ITERATIONS; iter+=2) {
-        libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
-        libdivide_2s32_t result = libdivide_2s32_do_vector(numers, &denom);
-        sumX = libdivide_add_2s32(sumX, result);
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    libdivide_8s8_t sumX = libdivide_zero_8s8();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s8_t numers = *((const libdivide_8s8_t*)(data + iter));
+        libdivide_8s8_t result = libdivide_8s8_do_vector(numers, &denom);
+        sumX = libdivide_add_8s8(sumX, result);
     }
-    return libdivide_sum_2s32(sumX);
+    return libdivide_sum_8s8(sumX);
 }
 
-NOINLINE static uint64_t mine_2s32_vector_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_8s8_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_2s32_t sumX = libdivide_zero_2s32();
-    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
-    const int32_t *data = (const int32_t *)params->data;
-    int algo = libdivide_s32_get_algorithm(&denom);
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    libdivide_8s8_t sumX = libdivide_zero_8s8();
+    int algo = libdivide_s8_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
-            libdivide_2s32_t result = libdivide_2s32_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_2s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s8_t numers = *((const libdivide_8s8_t*)(data + iter));
+            libdivide_8s8_t result = libdivide_8s8_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_8s8(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
-            libdivide_2s32_t result = libdivide_2s32_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_2s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s8_t numers = *((const libdivide_8s8_t*)(data + iter));
+            libdivide_8s8_t result = libdivide_8s8_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_8s8(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
-            libdivide_2s32_t result = libdivide_2s32_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_2s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s8_t numers = *((const libdivide_8s8_t*)(data + iter));
+            libdivide_8s8_t result = libdivide_8s8_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_8s8(sumX, result);
         }
     }
     else if (algo == 3) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
-            libdivide_2s32_t result = libdivide_2s32_do_vector_alg3(numers, &denom);
-            sumX = libdivide_add_2s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s8_t numers = *((const libdivide_8s8_t*)(data + iter));
+            libdivide_8s8_t result = libdivide_8s8_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_8s8(sumX, result);
         }
     }
     else if (algo == 4) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
-            libdivide_2s32_t result = libdivide_2s32_do_vector_alg4(numers, &denom);
-            sumX = libdivide_add_2s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s8_t numers = *((const libdivide_8s8_t*)(data + iter));
+            libdivide_8s8_t result = libdivide_8s8_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_8s8(sumX, result);
         }
     }
-    return libdivide_sum_2s32(sumX);
+    return libdivide_sum_8s8(sumX);
 }
 #endif
 
 #if LIBDIVIDE_VEC128
-NOINLINE static uint64_t mine_4s32_vector(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_16s8_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_4s32_t sumX = libdivide_zero_4s32();
-    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
-    const int32_t *data = (const int32_t *)params->data;
-    for (iter = 0; iter < ITERATIONS; iter+=4) {
-        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
-        libdivide_4s32_t result = libdivide_4s32_do_vector(numers, &denom);
-        sumX = libdivide_add_4s32(sumX, result);
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    libdivide_16s8_t sumX = libdivide_zero_16s8();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s8_t numers = *((const libdivide_16s8_t*)(data + iter));
+        libdivide_16s8_t result = libdivide_16s8_do_vector(numers, &denom);
+        sumX = libdivide_add_16s8(sumX, result);
     }
-    return libdivide_sum_4s32(sumX);
+    return libdivide_sum_16s8(sumX);
 }
 
-NOINLINE static uint64_t mine_4s32_vector_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_16s8_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_4s32_t sumX = libdivide_zero_4s32();
-    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
-    const int32_t *data = (const int32_t *)params->data;
-    int algo = libdivide_s32_get_algorithm(&denom);
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    libdivide_16s8_t sumX = libdivide_zero_16s8();
+    int algo = libdivide_s8_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
-            libdivide_4s32_t result = libdivide_4s32_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_4s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s8_t numers = *((const libdivide_16s8_t*)(data + iter));
+            libdivide_16s8_t result = libdivide_16s8_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_16s8(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
-            libdivide_4s32_t result = libdivide_4s32_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_4s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s8_t numers = *((const libdivide_16s8_t*)(data + iter));
+            libdivide_16s8_t result = libdivide_16s8_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_16s8(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
-            libdivide_4s32_t result = libdivide_4s32_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_4s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s8_t numers = *((const libdivide_16s8_t*)(data + iter));
+            libdivide_16s8_t result = libdivide_16s8_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_16s8(sumX, result);
         }
     }
     else if (algo == 3) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
-            libdivide_4s32_t result = libdivide_4s32_do_vector_alg3(numers, &denom);
-            sumX = libdivide_add_4s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s8_t numers = *((const libdivide_16s8_t*)(data + iter));
+            libdivide_16s8_t result = libdivide_16s8_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_16s8(sumX, result);
         }
     }
     else if (algo == 4) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
-            libdivide_4s32_t result = libdivide_4s32_do_vector_alg4(numers, &denom);
-            sumX = libdivide_add_4s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s8_t numers = *((const libdivide_16s8_t*)(data + iter));
+            libdivide_16s8_t result = libdivide_16s8_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_16s8(sumX, result);
         }
     }
-    return libdivide_sum_4s32(sumX);
+    return libdivide_sum_16s8(sumX);
 }
 #endif
 
 #if LIBDIVIDE_VEC256
-NOINLINE static uint64_t mine_8s32_vector(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_32s8_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_8s32_t sumX = libdivide_zero_8s32();
-    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
-    const int32_t *data = (const int32_t *)params->data;
-    for (iter = 0; iter < ITERATIONS; iter+=8) {
-        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
-        libdivide_8s32_t result = libdivide_8s32_do_vector(numers, &denom);
-        sumX = libdivide_add_8s32(sumX, result);
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    libdivide_32s8_t sumX = libdivide_zero_32s8();
+    for (iter = 0; iter < ITERATIONS; iter+=32) {
+        libdivide_32s8_t numers = *((const libdivide_32s8_t*)(data + iter));
+        libdivide_32s8_t result = libdivide_32s8_do_vector(numers, &denom);
+        sumX = libdivide_add_32s8(sumX, result);
     }
-    return libdivide_sum_8s32(sumX);
+    return libdivide_sum_32s8(sumX);
 }
 
-NOINLINE static uint64_t mine_8s32_vector_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_32s8_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_8s32_t sumX = libdivide_zero_8s32();
-    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
-    const int32_t *data = (const int32_t *)params->data;
-    int algo = libdivide_s32_get_algorithm(&denom);
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    libdivide_32s8_t sumX = libdivide_zero_32s8();
+    int algo = libdivide_s8_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=8) {
-            libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
-            libdivide_8s32_t result = libdivide_8s32_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_8s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32s8_t numers = *((const libdivide_32s8_t*)(data + iter));
+            libdivide_32s8_t result = libdivide_32s8_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_32s8(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=8) {
-            libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
-            libdivide_8s32_t result = libdivide_8s32_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_8s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32s8_t numers = *((const libdivide_32s8_t*)(data + iter));
+            libdivide_32s8_t result = libdivide_32s8_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_32s8(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=8) {
-            libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
-            libdivide_8s32_t result = libdivide_8s32_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_8s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32s8_t numers = *((const libdivide_32s8_t*)(data + iter));
+            libdivide_32s8_t result = libdivide_32s8_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_32s8(sumX, result);
         }
     }
     else if (algo == 3) {
-        for (iter = 0; iter < ITERATIONS; iter+=8) {
-            libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
-            libdivide_8s32_t result = libdivide_8s32_do_vector_alg3(numers, &denom);
-            sumX = libdivide_add_8s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32s8_t numers = *((const libdivide_32s8_t*)(data + iter));
+            libdivide_32s8_t result = libdivide_32s8_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_32s8(sumX, result);
         }
     }
     else if (algo == 4) {
-        for (iter = 0; iter < ITERATIONS; iter+=8) {
-            libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
-            libdivide_8s32_t result = libdivide_8s32_do_vector_alg4(numers, &denom);
-            sumX = libdivide_add_8s32(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32s8_t numers = *((const libdivide_32s8_t*)(data + iter));
+            libdivide_32s8_t result = libdivide_32s8_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_32s8(sumX, result);
         }
     }
-    return libdivide_sum_8s32(sumX);
+    return libdivide_sum_32s8(sumX);
 }
 #endif
 
-//U64
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_64s8_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    libdivide_64s8_t sumX = libdivide_zero_64s8();
+    for (iter = 0; iter < ITERATIONS; iter+=64) {
+        libdivide_64s8_t numers = *((const libdivide_64s8_t*)(data + iter));
+        libdivide_64s8_t result = libdivide_64s8_do_vector(numers, &denom);
+        sumX = libdivide_add_64s8(sumX, result);
+    }
+    return libdivide_sum_64s8(sumX);
+}
 
-NOINLINE static uint64_t mine_u64(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_64s8_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
-    const uint64_t *data = (const uint64_t *)params->data;
-    uint64_t sum = 0;
+    const struct libdivide_s8_t denom = *(struct libdivide_s8_t *)params->denomPtr;
+    const int8_t *data = (const int8_t *)params->data;
+    libdivide_64s8_t sumX = libdivide_zero_64s8();
+    int algo = libdivide_s8_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=64) {
+            libdivide_64s8_t numers = *((const libdivide_64s8_t*)(data + iter));
+            libdivide_64s8_t result = libdivide_64s8_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_64s8(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=64) {
+            libdivide_64s8_t numers = *((const libdivide_64s8_t*)(data + iter));
+            libdivide_64s8_t result = libdivide_64s8_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_64s8(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=64) {
+            libdivide_64s8_t numers = *((const libdivide_64s8_t*)(data + iter));
+            libdivide_64s8_t result = libdivide_64s8_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_64s8(sumX, result);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter+=64) {
+            libdivide_64s8_t numers = *((const libdivide_64s8_t*)(data + iter));
+            libdivide_64s8_t result = libdivide_64s8_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_64s8(sumX, result);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter+=64) {
+            libdivide_64s8_t numers = *((const libdivide_64s8_t*)(data + iter));
+            libdivide_64s8_t result = libdivide_64s8_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_64s8(sumX, result);
+        }
+    }
+    return libdivide_sum_64s8(sumX);
+}
+#endif
+
+//U16
+
+NOINLINE static uint64_t mine_u16(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u16_t denom = *(struct libdivide_u16_t *)params->denomPtr;
+    const uint16_t *data = (const uint16_t *)params->data;
+    uint16_t sum = 0;
     for (iter = 0; iter < ITERATIONS; iter++) {
-        uint64_t numer = data[iter];
-        sum += libdivide_u64_do(numer, &denom);
+        uint16_t numer = data[iter];
+        sum += libdivide_u16_do(numer, &denom);
     }
     return sum;
 }
 
-NOINLINE static uint64_t mine_u64_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_u16_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    uint64_t sum = 0;
-    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
-    const uint64_t *data = (const uint64_t *)params->data;
-    int algo = libdivide_u64_get_algorithm(&denom);
+    const struct libdivide_u16_t denom = *(struct libdivide_u16_t *)params->denomPtr;
+    const uint16_t *data = (const uint16_t *)params->data;
+    uint16_t sum = 0;
+    int algo = libdivide_u16_get_algorithm(&denom);
     if (algo == 0) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            uint64_t numer = data[iter];
-            sum += libdivide_u64_do_alg0(numer, &denom);
+            uint16_t numer = data[iter];
+            sum += libdivide_u16_do_alg0(numer, &denom);
         }
     }
     else if (algo == 1) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            uint64_t numer = data[iter];
-            sum += libdivide_u64_do_alg1(numer, &denom);
+            uint16_t numer = data[iter];
+            sum += libdivide_u16_do_alg1(numer, &denom);
         }
     }
     else if (algo == 2) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            uint64_t numer = data[iter];
-            sum += libdivide_u64_do_alg2(numer, &denom);
+            uint16_t numer = data[iter];
+            sum += libdivide_u16_do_alg2(numer, &denom);
         }
     }
 
     return sum;
 }
 
-NOINLINE static uint64_t his_u64(struct FunctionParams_t *params) {
+NOINLINE static uint64_t his_u16(struct FunctionParams_t *params) {
     unsigned iter;
-    uint64_t sum = 0;
-    const uint64_t d = *(uint64_t *)params->d;
-    const uint64_t *data = (const uint64_t *)params->data;
+    const uint16_t *data = (const uint16_t *)params->data;
+    const uint16_t d = *(uint16_t *)params->d;
+    uint16_t sum = 0;
     for (iter = 0; iter < ITERATIONS; iter++) {
-        uint64_t numer = data[iter];
+        uint16_t numer = data[iter];
         sum += numer / d;
     }
     return sum;
 }
 
-NOINLINE static uint64_t mine_u64_generate(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_u16_generate(struct FunctionParams_t *params) {
+    uint16_t *dPtr = (uint16_t *)params->d;
+    struct libdivide_u16_t *denomPtr = (struct libdivide_u16_t *)params->denomPtr;
     unsigned iter;
-    uint64_t *dPtr = (uint64_t *)params->d;
-    struct libdivide_u64_t *denomPtr = (struct libdivide_u64_t *)params->denomPtr;
     for (iter = 0; iter < GEN_ITERATIONS; iter++) {
-        *denomPtr = libdivide_u64_gen(*dPtr);
+        *denomPtr = libdivide_u16_gen(*dPtr);
     }
     return *dPtr;
 }
 
 #if LIBDIVIDE_VEC64
-NOINLINE static uint64_t mine_1u64_vector(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_4u16_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_1u64_t sumX = libdivide_zero_1u64();
-    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
-    const uint64_t *data = (const uint64_t *)params->data;
-    for (iter = 0; iter < ITERATIONS; iter+=1) {
-        libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
-        libdivide_1u64_t result = libdivide_1u64_do_vector(numers, &denom);
-        sumX = libdivide_add_1u64(sumX, result);
+    const struct libdivide_u16_t denom = *(struct libdivide_u16_t *)params->denomPtr;
+    const uint16_t *data = (const uint16_t *)params->data;
+    libdivide_4u16_t sumX = libdivide_zero_4u16();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u16_t numers = *((const libdivide_4u16_t*)(data + iter));
+        libdivide_4u16_t result = libdivide_4u16_do_vector(numers, &denom);
+        sumX = libdivide_add_4u16(sumX, result);
     }
-    return libdivide_sum_1u64(sumX);
+    return libdivide_sum_4u16(sumX);
 }
 
-NOINLINE static uint64_t mine_1u64_vector_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_4u16_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_1u64_t sumX = libdivide_zero_1u64();
-    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
-    const uint64_t *data = (const uint64_t *)params->data;
-    int algo = libdivide_u64_get_algorithm(&denom);
+    const struct libdivide_u16_t denom = *(struct libdivide_u16_t *)params->denomPtr;
+    const uint16_t *data = (const uint16_t *)params->data;
+    libdivide_4u16_t sumX = libdivide_zero_4u16();
+    int algo = libdivide_u16_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=1) {
-            libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
-            libdivide_1u64_t result = libdivide_1u64_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_1u64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4u16_t numers = *((const libdivide_4u16_t*)(data + iter));
+            libdivide_4u16_t result = libdivide_4u16_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_4u16(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=1) {
-            libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
-            libdivide_1u64_t result = libdivide_1u64_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_1u64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4u16_t numers = *((const libdivide_4u16_t*)(data + iter));
+            libdivide_4u16_t result = libdivide_4u16_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_4u16(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=1) {
-            libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
-            libdivide_1u64_t result = libdivide_1u64_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_1u64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4u16_t numers = *((const libdivide_4u16_t*)(data + iter));
+            libdivide_4u16_t result = libdivide_4u16_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_4u16(sumX, result);
         }
     }
-    return libdivide_sum_1u64(sumX);
+    return libdivide_sum_4u16(sumX);
 }
 #endif
 
 #if LIBDIVIDE_VEC128
-NOINLINE static uint64_t mine_2u64_vector(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_8u16_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_2u64_t sumX = libdivide_zero_2u64();
-    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
-    const uint64_t *data = (const uint64_t *)params->data;
-    for (iter = 0; iter < ITERATIONS; iter+=2) {
-        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
-        libdivide_2u64_t result = libdivide_2u64_do_vector(numers, &denom);
-        sumX = libdivide_add_2u64(sumX, result);
+    const struct libdivide_u16_t denom = *(struct libdivide_u16_t *)params->denomPtr;
+    const uint16_t *data = (const uint16_t *)params->data;
+    libdivide_8u16_t sumX = libdivide_zero_8u16();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u16_t numers = *((const libdivide_8u16_t*)(data + iter));
+        libdivide_8u16_t result = libdivide_8u16_do_vector(numers, &denom);
+        sumX = libdivide_add_8u16(sumX, result);
     }
-    return libdivide_sum_2u64(sumX);
+    return libdivide_sum_8u16(sumX);
 }
 
-NOINLINE static uint64_t mine_2u64_vector_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_8u16_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_2u64_t sumX = libdivide_zero_2u64();
-    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
-    const uint64_t *data = (const uint64_t *)params->data;
-    int algo = libdivide_u64_get_algorithm(&denom);
+    const struct libdivide_u16_t denom = *(struct libdivide_u16_t *)params->denomPtr;
+    const uint16_t *data = (const uint16_t *)params->data;
+    libdivide_8u16_t sumX = libdivide_zero_8u16();
+    int algo = libdivide_u16_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
-            libdivide_2u64_t result = libdivide_2u64_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_2u64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u16_t numers = *((const libdivide_8u16_t*)(data + iter));
+            libdivide_8u16_t result = libdivide_8u16_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_8u16(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
-            libdivide_2u64_t result = libdivide_2u64_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_2u64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u16_t numers = *((const libdivide_8u16_t*)(data + iter));
+            libdivide_8u16_t result = libdivide_8u16_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_8u16(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
-            libdivide_2u64_t result = libdivide_2u64_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_2u64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u16_t numers = *((const libdivide_8u16_t*)(data + iter));
+            libdivide_8u16_t result = libdivide_8u16_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_8u16(sumX, result);
         }
     }
-    return libdivide_sum_2u64(sumX);
+    return libdivide_sum_8u16(sumX);
 }
 #endif
 
 #if LIBDIVIDE_VEC256
-NOINLINE static uint64_t mine_4u64_vector(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_16u16_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_4u64_t sumX = libdivide_zero_4u64();
-    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
-    const uint64_t *data = (const uint64_t *)params->data;
-    for (iter = 0; iter < ITERATIONS; iter+=4) {
-        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
-        libdivide_4u64_t result = libdivide_4u64_do_vector(numers, &denom);
-        sumX = libdivide_add_4u64(sumX, result);
+    const struct libdivide_u16_t denom = *(struct libdivide_u16_t *)params->denomPtr;
+    const uint16_t *data = (const uint16_t *)params->data;
+    libdivide_16u16_t sumX = libdivide_zero_16u16();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u16_t numers = *((const libdivide_16u16_t*)(data + iter));
+        libdivide_16u16_t result = libdivide_16u16_do_vector(numers, &denom);
+        sumX = libdivide_add_16u16(sumX, result);
     }
-    return libdivide_sum_4u64(sumX);
+    return libdivide_sum_16u16(sumX);
 }
 
-NOINLINE static uint64_t mine_4u64_vector_unswitched(struct FunctionParams_t *params) {
+NOINLINE static uint64_t mine_16u16_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_4u64_t sumX = libdivide_zero_4u64();
-    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
-    const uint64_t *data = (const uint64_t *)params->data;
-    int algo = libdivide_u64_get_algorithm(&denom);
+    const struct libdivide_u16_t denom = *(struct libdivide_u16_t *)params->denomPtr;
+    const uint16_t *data = (const uint16_t *)params->data;
+    libdivide_16u16_t sumX = libdivide_zero_16u16();
+    int algo = libdivide_u16_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
-            libdivide_4u64_t result = libdivide_4u64_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_4u64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16u16_t numers = *((const libdivide_16u16_t*)(data + iter));
+            libdivide_16u16_t result = libdivide_16u16_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_16u16(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
-            libdivide_4u64_t result = libdivide_4u64_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_4u64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16u16_t numers = *((const libdivide_16u16_t*)(data + iter));
+            libdivide_16u16_t result = libdivide_16u16_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_16u16(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
-            libdivide_4u64_t result = libdivide_4u64_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_4u64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16u16_t numers = *((const libdivide_16u16_t*)(data + iter));
+            libdivide_16u16_t result = libdivide_16u16_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_16u16(sumX, result);
         }
     }
-    return libdivide_sum_4u64(sumX);
+    return libdivide_sum_16u16(sumX);
 }
 #endif
 
-//S64
-NOINLINE static uint64_t mine_s64(struct FunctionParams_t *params) {
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_32u16_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
-    const int64_t *data = (const int64_t *)params->data;
-    int64_t sum = 0;
+    const struct libdivide_u16_t denom = *(struct libdivide_u16_t *)params->denomPtr;
+    const uint16_t *data = (const uint16_t *)params->data;
+    libdivide_32u16_t sumX = libdivide_zero_32u16();
+    for (iter = 0; iter < ITERATIONS; iter+=32) {
+        libdivide_32u16_t numers = *((const libdivide_32u16_t*)(data + iter));
+        libdivide_32u16_t result = libdivide_32u16_do_vector(numers, &denom);
+        sumX = libdivide_add_32u16(sumX, result);
+    }
+    return libdivide_sum_32u16(sumX);
+}
+
+NOINLINE static uint64_t mine_32u16_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u16_t denom = *(struct libdivide_u16_t *)params->denomPtr;
+    const uint16_t *data = (const uint16_t *)params->data;
+    libdivide_32u16_t sumX = libdivide_zero_32u16();
+    int algo = libdivide_u16_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32u16_t numers = *((const libdivide_32u16_t*)(data + iter));
+            libdivide_32u16_t result = libdivide_32u16_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_32u16(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32u16_t numers = *((const libdivide_32u16_t*)(data + iter));
+            libdivide_32u16_t result = libdivide_32u16_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_32u16(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32u16_t numers = *((const libdivide_32u16_t*)(data + iter));
+            libdivide_32u16_t result = libdivide_32u16_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_32u16(sumX, result);
+        }
+    }
+    return libdivide_sum_32u16(sumX);
+}
+#endif
+
+//S16
+
+NOINLINE static uint64_t mine_s16(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s16_t denom = *(struct libdivide_s16_t *)params->denomPtr;
+    const int16_t *data = (const int16_t *)params->data;
+    int16_t sum = 0;
     for (iter = 0; iter < ITERATIONS; iter++) {
-        int64_t numer = data[iter];
-        sum += libdivide_s64_do(numer, &denom);
+        int16_t numer = data[iter];
+        sum += libdivide_s16_do(numer, &denom);
     }
     return sum;
 }
 
-NOINLINE static uint64_t mine_s64_unswitched(struct FunctionParams_t *params) {
-    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
-    const int64_t *data = (const int64_t *)params->data;
-
+NOINLINE static uint64_t mine_s16_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    int64_t sum = 0;
-    int algo = libdivide_s64_get_algorithm(&denom);
+    const struct libdivide_s16_t denom = *(struct libdivide_s16_t *)params->denomPtr;
+    const int16_t *data = (const int16_t *)params->data;
+    int16_t sum = 0;
+    int algo = libdivide_s16_get_algorithm(&denom);
     if (algo == 0) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            int64_t numer = data[iter];
-            sum += libdivide_s64_do_alg0(numer, &denom);
+            int16_t numer = data[iter];
+            sum += libdivide_s16_do_alg0(numer, &denom);
         }
     }
     else if (algo == 1) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            int64_t numer = data[iter];
-            sum += libdivide_s64_do_alg1(numer, &denom);
+            int16_t numer = data[iter];
+            sum += libdivide_s16_do_alg1(numer, &denom);
         }
     }
     else if (algo == 2) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            int64_t numer = data[iter];
-            sum += libdivide_s64_do_alg2(numer, &denom);
+            int16_t numer = data[iter];
+            sum += libdivide_s16_do_alg2(numer, &denom);
         }
     }
     else if (algo == 3) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            int64_t numer = data[iter];
-            sum += libdivide_s64_do_alg3(numer, &denom);
+            int16_t numer = data[iter];
+            sum += libdivide_s16_do_alg3(numer, &denom);
         }
     }
     else if (algo == 4) {
         for (iter = 0; iter < ITERATIONS; iter++) {
-            int64_t numer = data[iter];
-            sum += libdivide_s64_do_alg4(numer, &denom);
+            int16_t numer = data[iter];
+            sum += libdivide_s16_do_alg4(numer, &denom);
         }
     }
 
     return sum;
 }
 
-NOINLINE static uint64_t his_s64(struct FunctionParams_t *params) {
-    const int64_t *data = (const int64_t *)params->data;
-    const int64_t d = *(int64_t *)params->d;
-
+NOINLINE static uint64_t his_s16(struct FunctionParams_t *params) {
     unsigned iter;
-    int64_t sum = 0;
+    const int16_t *data = (const int16_t *)params->data;
+    const int16_t d = *(int16_t *)params->d;
+    int16_t sum = 0;
     for (iter = 0; iter < ITERATIONS; iter++) {
-        int64_t numer = data[iter];
+        int16_t numer = data[iter];
         sum += numer / d;
     }
     return sum;
 }
 
-NOINLINE static uint64_t mine_s64_generate(struct FunctionParams_t *params) {
-    int64_t *dPtr = (int64_t *)params->d;
-    struct libdivide_s64_t *denomPtr = (struct libdivide_s64_t *)params->denomPtr;
+NOINLINE static uint64_t mine_s16_generate(struct FunctionParams_t *params) {
+    int16_t *dPtr = (int16_t *)params->d;
+    struct libdivide_s16_t *denomPtr = (struct libdivide_s16_t *)params->denomPtr;
     unsigned iter;
     for (iter = 0; iter < GEN_ITERATIONS; iter++) {
-        *denomPtr = libdivide_s64_gen(*dPtr);
+        *denomPtr = libdivide_s16_gen(*dPtr);
     }
     return *dPtr;
 }
 
 #if LIBDIVIDE_VEC64
-NOINLINE static uint64_t mine_1s64_vector(struct FunctionParams_t *params) {
-    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
-    const int64_t *data = (const int64_t *)params->data;
-
+NOINLINE static uint64_t mine_4s16_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_1s64_t sumX = libdivide_zero_1s64();
-    for (iter = 0; iter < ITERATIONS; iter+=1) {
-        libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
-        libdivide_1s64_t result = libdivide_1s64_do_vector(numers, &denom);
-        sumX = libdivide_add_1s64(sumX, result);
+    const struct libdivide_s16_t denom = *(struct libdivide_s16_t *)params->denomPtr;
+    const int16_t *data = (const int16_t *)params->data;
+    libdivide_4s16_t sumX = libdivide_zero_4s16();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s16_t numers = *((const libdivide_4s16_t*)(data + iter));
+        libdivide_4s16_t result = libdivide_4s16_do_vector(numers, &denom);
+        sumX = libdivide_add_4s16(sumX, result);
     }
-    return libdivide_sum_1s64(sumX);
+    return libdivide_sum_4s16(sumX);
 }
 
-NOINLINE static uint64_t mine_1s64_vector_unswitched(struct FunctionParams_t *params) {
-    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
-    const int64_t *data = (const int64_t *)params->data;
-
+NOINLINE static uint64_t mine_4s16_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_1s64_t sumX = libdivide_zero_1s64();
-    int algo = libdivide_s64_get_algorithm(&denom);
+    const struct libdivide_s16_t denom = *(struct libdivide_s16_t *)params->denomPtr;
+    const int16_t *data = (const int16_t *)params->data;
+    libdivide_4s16_t sumX = libdivide_zero_4s16();
+    int algo = libdivide_s16_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=1) {
-            libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
-            libdivide_1s64_t result = libdivide_1s64_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_1s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s16_t numers = *((const libdivide_4s16_t*)(data + iter));
+            libdivide_4s16_t result = libdivide_4s16_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_4s16(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=1) {
-            libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
-            libdivide_1s64_t result = libdivide_1s64_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_1s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s16_t numers = *((const libdivide_4s16_t*)(data + iter));
+            libdivide_4s16_t result = libdivide_4s16_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_4s16(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=1) {
-            libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
-            libdivide_1s64_t result = libdivide_1s64_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_1s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s16_t numers = *((const libdivide_4s16_t*)(data + iter));
+            libdivide_4s16_t result = libdivide_4s16_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_4s16(sumX, result);
         }
     }
     else if (algo == 3) {
-        for (iter = 0; iter < ITERATIONS; iter+=1) {
-            libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
-            libdivide_1s64_t result = libdivide_1s64_do_vector_alg3(numers, &denom);
-            sumX = libdivide_add_1s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s16_t numers = *((const libdivide_4s16_t*)(data + iter));
+            libdivide_4s16_t result = libdivide_4s16_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_4s16(sumX, result);
         }
     }
     else if (algo == 4) {
-        for (iter = 0; iter < ITERATIONS; iter+=1) {
-            libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
-            libdivide_1s64_t result = libdivide_1s64_do_vector_alg4(numers, &denom);
-            sumX = libdivide_add_1s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s16_t numers = *((const libdivide_4s16_t*)(data + iter));
+            libdivide_4s16_t result = libdivide_4s16_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_4s16(sumX, result);
         }
     }
-    return libdivide_sum_1s64(sumX);
+    return libdivide_sum_4s16(sumX);
 }
 #endif
 
 #if LIBDIVIDE_VEC128
-NOINLINE static uint64_t mine_2s64_vector(struct FunctionParams_t *params) {
-    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
-    const int64_t *data = (const int64_t *)params->data;
-
+NOINLINE static uint64_t mine_8s16_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_2s64_t sumX = libdivide_zero_2s64();
-    for (iter = 0; iter < ITERATIONS; iter+=2) {
-        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
-        libdivide_2s64_t result = libdivide_2s64_do_vector(numers, &denom);
-        sumX = libdivide_add_2s64(sumX, result);
+    const struct libdivide_s16_t denom = *(struct libdivide_s16_t *)params->denomPtr;
+    const int16_t *data = (const int16_t *)params->data;
+    libdivide_8s16_t sumX = libdivide_zero_8s16();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s16_t numers = *((const libdivide_8s16_t*)(data + iter));
+        libdivide_8s16_t result = libdivide_8s16_do_vector(numers, &denom);
+        sumX = libdivide_add_8s16(sumX, result);
     }
-    return libdivide_sum_2s64(sumX);
+    return libdivide_sum_8s16(sumX);
 }
 
-NOINLINE static uint64_t mine_2s64_vector_unswitched(struct FunctionParams_t *params) {
-    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
-    const int64_t *data = (const int64_t *)params->data;
-
+NOINLINE static uint64_t mine_8s16_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_2s64_t sumX = libdivide_zero_2s64();
-    int algo = libdivide_s64_get_algorithm(&denom);
+    const struct libdivide_s16_t denom = *(struct libdivide_s16_t *)params->denomPtr;
+    const int16_t *data = (const int16_t *)params->data;
+    libdivide_8s16_t sumX = libdivide_zero_8s16();
+    int algo = libdivide_s16_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
-            libdivide_2s64_t result = libdivide_2s64_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_2s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s16_t numers = *((const libdivide_8s16_t*)(data + iter));
+            libdivide_8s16_t result = libdivide_8s16_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_8s16(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
-            libdivide_2s64_t result = libdivide_2s64_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_2s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s16_t numers = *((const libdivide_8s16_t*)(data + iter));
+            libdivide_8s16_t result = libdivide_8s16_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_8s16(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
-            libdivide_2s64_t result = libdivide_2s64_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_2s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s16_t numers = *((const libdivide_8s16_t*)(data + iter));
+            libdivide_8s16_t result = libdivide_8s16_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_8s16(sumX, result);
         }
     }
     else if (algo == 3) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
-            libdivide_2s64_t result = libdivide_2s64_do_vector_alg3(numers, &denom);
-            sumX = libdivide_add_2s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s16_t numers = *((const libdivide_8s16_t*)(data + iter));
+            libdivide_8s16_t result = libdivide_8s16_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_8s16(sumX, result);
         }
     }
     else if (algo == 4) {
-        for (iter = 0; iter < ITERATIONS; iter+=2) {
-            libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
-            libdivide_2s64_t result = libdivide_2s64_do_vector_alg4(numers, &denom);
-            sumX = libdivide_add_2s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s16_t numers = *((const libdivide_8s16_t*)(data + iter));
+            libdivide_8s16_t result = libdivide_8s16_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_8s16(sumX, result);
         }
     }
-    return libdivide_sum_2s64(sumX);
+    return libdivide_sum_8s16(sumX);
 }
 #endif
 
 #if LIBDIVIDE_VEC256
-NOINLINE static uint64_t mine_4s64_vector(struct FunctionParams_t *params) {
-    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
-    const int64_t *data = (const int64_t *)params->data;
-
+NOINLINE static uint64_t mine_16s16_vector(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_4s64_t sumX = libdivide_zero_4s64();
-    for (iter = 0; iter < ITERATIONS; iter+=4) {
-        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
-        libdivide_4s64_t result = libdivide_4s64_do_vector(numers, &denom);
-        sumX = libdivide_add_4s64(sumX, result);
+    const struct libdivide_s16_t denom = *(struct libdivide_s16_t *)params->denomPtr;
+    const int16_t *data = (const int16_t *)params->data;
+    libdivide_16s16_t sumX = libdivide_zero_16s16();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s16_t numers = *((const libdivide_16s16_t*)(data + iter));
+        libdivide_16s16_t result = libdivide_16s16_do_vector(numers, &denom);
+        sumX = libdivide_add_16s16(sumX, result);
     }
-    return libdivide_sum_4s64(sumX);
+    return libdivide_sum_16s16(sumX);
 }
 
-NOINLINE static uint64_t mine_4s64_vector_unswitched(struct FunctionParams_t *params) {
-    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
-    const int64_t *data = (const int64_t *)params->data;
-
+NOINLINE static uint64_t mine_16s16_vector_unswitched(struct FunctionParams_t *params) {
     unsigned iter;
-    libdivide_4s64_t sumX = libdivide_zero_4s64();
-    int algo = libdivide_s64_get_algorithm(&denom);
+    const struct libdivide_s16_t denom = *(struct libdivide_s16_t *)params->denomPtr;
+    const int16_t *data = (const int16_t *)params->data;
+    libdivide_16s16_t sumX = libdivide_zero_16s16();
+    int algo = libdivide_s16_get_algorithm(&denom);
     if (algo == 0) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
-            libdivide_4s64_t result = libdivide_4s64_do_vector_alg0(numers, &denom);
-            sumX = libdivide_add_4s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s16_t numers = *((const libdivide_16s16_t*)(data + iter));
+            libdivide_16s16_t result = libdivide_16s16_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_16s16(sumX, result);
         }
     }
     else if (algo == 1) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
-            libdivide_4s64_t result = libdivide_4s64_do_vector_alg1(numers, &denom);
-            sumX = libdivide_add_4s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s16_t numers = *((const libdivide_16s16_t*)(data + iter));
+            libdivide_16s16_t result = libdivide_16s16_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_16s16(sumX, result);
         }
     }
     else if (algo == 2) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
-            libdivide_4s64_t result = libdivide_4s64_do_vector_alg2(numers, &denom);
-            sumX = libdivide_add_4s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s16_t numers = *((const libdivide_16s16_t*)(data + iter));
+            libdivide_16s16_t result = libdivide_16s16_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_16s16(sumX, result);
         }
     }
     else if (algo == 3) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
-            libdivide_4s64_t result = libdivide_4s64_do_vector_alg3(numers, &denom);
-            sumX = libdivide_add_4s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s16_t numers = *((const libdivide_16s16_t*)(data + iter));
+            libdivide_16s16_t result = libdivide_16s16_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_16s16(sumX, result);
         }
     }
     else if (algo == 4) {
-        for (iter = 0; iter < ITERATIONS; iter+=4) {
-            libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
-            libdivide_4s64_t result = libdivide_4s64_do_vector_alg4(numers, &denom);
-            sumX = libdivide_add_4s64(sumX, result);
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s16_t numers = *((const libdivide_16s16_t*)(data + iter));
+            libdivide_16s16_t result = libdivide_16s16_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_16s16(sumX, result);
         }
     }
-    return libdivide_sum_4s64(sumX);
+    return libdivide_sum_16s16(sumX);
 }
 #endif
 
-enum Tests {
-    kBaseTest,
-    kUnswitchedBaseTest,
-    kVec64Test,
-    kVec128Test,
-    kVec256Test,
-    kUnswitchedVec64Test,
-    kUnswitchedVec128Test,
-    kUnswitchedVec256Test,
-    kNumTests
-};
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_32s16_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s16_t denom = *(struct libdivide_s16_t *)params->denomPtr;
+    const int16_t *data = (const int16_t *)params->data;
+    libdivide_32s16_t sumX = libdivide_zero_32s16();
+    for (iter = 0; iter < ITERATIONS; iter+=32) {
+        libdivide_32s16_t numers = *((const libdivide_32s16_t*)(data + iter));
+        libdivide_32s16_t result = libdivide_32s16_do_vector(numers, &denom);
+        sumX = libdivide_add_32s16(sumX, result);
+    }
+    return libdivide_sum_32s16(sumX);
+}
 
-const char *strTests[kNumTests] = {
-    "scalar",
-    "scl_us",
-    "v64",
-    "v128",
-    "v256",
-    "v64_us",
-    "v128_us",
-    "v256_us"
-};
+NOINLINE static uint64_t mine_32s16_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s16_t denom = *(struct libdivide_s16_t *)params->denomPtr;
+    const int16_t *data = (const int16_t *)params->data;
+    libdivide_32s16_t sumX = libdivide_zero_32s16();
+    int algo = libdivide_s16_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32s16_t numers = *((const libdivide_32s16_t*)(data + iter));
+            libdivide_32s16_t result = libdivide_32s16_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_32s16(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32s16_t numers = *((const libdivide_32s16_t*)(data + iter));
+            libdivide_32s16_t result = libdivide_32s16_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_32s16(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32s16_t numers = *((const libdivide_32s16_t*)(data + iter));
+            libdivide_32s16_t result = libdivide_32s16_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_32s16(sumX, result);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32s16_t numers = *((const libdivide_32s16_t*)(data + iter));
+            libdivide_32s16_t result = libdivide_32s16_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_32s16(sumX, result);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter+=32) {
+            libdivide_32s16_t numers = *((const libdivide_32s16_t*)(data + iter));
+            libdivide_32s16_t result = libdivide_32s16_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_32s16(sumX, result);
+        }
+    }
+    return libdivide_sum_32s16(sumX);
+}
+#endif
 
-struct TestResult {
-    double times[kNumTests];
-    double gen_time;
-    double his_time;
-    int algo;
-};
+#if HAS_INT128_T
+//U128
 
-static uint64_t find_min(const uint64_t *vals, size_t cnt) {
-    uint64_t result = vals[0];
-    size_t i;
-    for (i=1; i < cnt; i++) {
-        if (vals[i] < result) result = vals[i];
+NOINLINE static uint64_t mine_u128(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u128_t denom = *(struct libdivide_u128_t *)params->denomPtr;
+    const __uint128_t *data = (const __uint128_t *)params->data;
+    __uint128_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        __uint128_t numer = data[iter];
+        sum += libdivide_u128_do(numer, &denom);
     }
-    return result;
+    return (uint64_t)sum;
 }
 
-typedef uint64_t (*TestFunc_t)(struct FunctionParams_t *params);
-
-struct TestFuncs {
-    TestFunc_t funcs[kNumTests];
-    TestFunc_t generate;
-    TestFunc_t his;
-};
+NOINLINE static uint64_t mine_u128_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u128_t denom = *(struct libdivide_u128_t *)params->denomPtr;
+    const __uint128_t *data = (const __uint128_t *)params->data;
+    __uint128_t sum = 0;
+    int algo = libdivide_u128_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            __uint128_t numer = data[iter];
+            sum += libdivide_u128_do_alg0(numer, &denom);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            __uint128_t numer = data[iter];
+            sum += libdivide_u128_do_alg1(numer, &denom);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            __uint128_t numer = data[iter];
+            sum += libdivide_u128_do_alg2(numer, &denom);
+        }
+    }
 
-NOINLINE struct TestResult test_one(struct TestFuncs *funcs, struct FunctionParams_t *params) {
-#define TEST_COUNT 3
-    struct TestResult result;
-    memset(&result, 0, sizeof result);
+    return (uint64_t)sum;
+}
 
-#define CHECK(actual, expected) do { if (1 && actual != expected) printf("Failure on line %lu\n", (unsigned long)__LINE__); } while (0)
+/* The compiler turns this into calls to __udivti3 */
+NOINLINE static uint64_t his_u128(struct FunctionParams_t *params) {
+    unsigned iter;
+    const __uint128_t *data = (const __uint128_t *)params->data;
+    const __uint128_t d = *(__uint128_t *)params->d;
+    __uint128_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        __uint128_t numer = data[iter];
+        sum += numer / d;
+    }
+    return (uint64_t)sum;
+}
 
-    uint64_t my_times[kNumTests][TEST_COUNT], his_times[TEST_COUNT], gen_times[TEST_COUNT];
-    unsigned iter, test;
-    struct time_result tresult;
-    for (iter = 0; iter < TEST_COUNT; iter++) {
-        tresult = time_function(funcs->his, params); his_times[iter] = tresult.time; const uint64_t expected = tresult.result;
-        for (test = 0; test < kNumTests; test++) {
-            if (funcs->funcs[test]) {
-                tresult = time_function(funcs->funcs[test], params); my_times[test][iter] = tresult.time; CHECK(tresult.result, expected);
-            } else {
-                my_times[test][iter] = 0;
-            }
-        }
-        tresult = time_function(funcs->generate, params); gen_times[iter] = tresult.time;
+NOINLINE static uint64_t mine_u128_generate(struct FunctionParams_t *params) {
+    __uint128_t *dPtr = (__uint128_t *)params->d;
+    struct libdivide_u128_t *denomPtr = (struct libdivide_u128_t *)params->denomPtr;
+    unsigned iter;
+    for (iter = 0; iter < GEN_ITERATIONS; iter++) {
+        *denomPtr = libdivide_u128_gen(*dPtr);
     }
+    return (uint64_t)*dPtr;
+}
 
-    result.his_time = find_min(his_times, TEST_COUNT) / (double)ITERATIONS;
-    result.gen_time = find_min(gen_times, TEST_COUNT) / (double)GEN_ITERATIONS;
+//S128
 
-    for (test = 0; test < kNumTests; test++) {
-        result.times[test] = find_min(my_times[test], TEST_COUNT) / (double)ITERATIONS;
+NOINLINE static uint64_t mine_s128(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s128_t denom = *(struct libdivide_s128_t *)params->denomPtr;
+    const __int128_t *data = (const __int128_t *)params->data;
+    __int128_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        __int128_t numer = data[iter];
+        sum += libdivide_s128_do(numer, &denom);
     }
-    return result;
-#undef TEST_COUNT
+    return (uint64_t)sum;
 }
 
-NOINLINE struct TestResult test_one_u32(uint32_t d, const uint32_t *data) {
-    struct libdivide_u32_t div_struct = libdivide_u32_gen(d);
-    struct FunctionParams_t params;
-    params.d = &d;
-    params.denomPtr = &div_struct;
-    params.data = data;
-
+NOINLINE static uint64_t mine_s128_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s128_t denom = *(struct libdivide_s128_t *)params->denomPtr;
+    const __int128_t *data = (const __int128_t *)params->data;
+    __int128_t sum = 0;
+    int algo = libdivide_s128_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            __int128_t numer = data[iter];
+            sum += libdivide_s128_do_alg0(numer, &denom);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            __int128_t numer = data[iter];
+            sum += libdivide_s128_do_alg1(numer, &denom);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            __int128_t numer = data[iter];
+            sum += libdivide_s128_do_alg2(numer, &denom);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            __int128_t numer = data[iter];
+            sum += libdivide_s128_do_alg3(numer, &denom);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            __int128_t numer = data[iter];
+            sum += libdivide_s128_do_alg4(numer, &denom);
+        }
+    }
+
+    return (uint64_t)sum;
+}
+
+/* The compiler turns this into calls to __divti3 */
+NOINLINE static uint64_t his_s128(struct FunctionParams_t *params) {
+    unsigned iter;
+    const __int128_t *data = (const __int128_t *)params->data;
+    const __int128_t d = *(__int128_t *)params->d;
+    __int128_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        __int128_t numer = data[iter];
+        sum += numer / d;
+    }
+    return (uint64_t)sum;
+}
+
+NOINLINE static uint64_t mine_s128_generate(struct FunctionParams_t *params) {
+    __int128_t *dPtr = (__int128_t *)params->d;
+    struct libdivide_s128_t *denomPtr = (struct libdivide_s128_t *)params->denomPtr;
+    unsigned iter;
+    for (iter = 0; iter < GEN_ITERATIONS; iter++) {
+        *denomPtr = libdivide_s128_gen(*dPtr);
+    }
+    return (uint64_t)*dPtr;
+}
+
+#endif
+
+//U32
+
+NOINLINE static uint64_t mine_u32(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += libdivide_u32_do(numer, &denom);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    int algo = libdivide_u32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            uint32_t numer = data[iter];
+            sum += libdivide_u32_do_alg0(numer, &denom);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            uint32_t numer = data[iter];
+            sum += libdivide_u32_do_alg1(numer, &denom);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            uint32_t numer = data[iter];
+            sum += libdivide_u32_do_alg2(numer, &denom);
+        }
+    }
+
+    return sum;
+}
+
+NOINLINE static uint64_t his_u32(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint32_t *data = (const uint32_t *)params->data;
+    const uint32_t d = *(uint32_t *)params->d;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += numer / d;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t results[ARRAY_CHUNK];
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u32_do_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_generate(struct FunctionParams_t *params) {
+    uint32_t *dPtr = (uint32_t *)params->d;
+    struct libdivide_u32_t *denomPtr = (struct libdivide_u32_t *)params->denomPtr;
+    unsigned iter;
+    for (iter = 0; iter < GEN_ITERATIONS; iter++) {
+        *denomPtr = libdivide_u32_gen(*dPtr);
+    }
+    return *dPtr;
+}
+
+/* The same through libdivide_*_get, which reads the small divisors from the table when the benchmark is built with it (TABLE=1) */
+NOINLINE static uint64_t mine_u32_lookup(struct FunctionParams_t *params) {
+    uint32_t *dPtr = (uint32_t *)params->d;
+    struct libdivide_u32_t *denomPtr = (struct libdivide_u32_t *)params->denomPtr;
+    unsigned iter;
+    for (iter = 0; iter < GEN_ITERATIONS; iter++) {
+        *denomPtr = libdivide_u32_get(*dPtr);
+    }
+    return *dPtr;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2u32_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_2u32_t sumX = libdivide_zero_2u32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
+        libdivide_2u32_t result = libdivide_2u32_do_vector(numers, &denom);
+        sumX = libdivide_add_2u32(sumX, result);
+    }
+    return libdivide_sum_2u32(sumX);
+}
+
+NOINLINE static uint64_t mine_2u32_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_2u32_t sumX = libdivide_zero_2u32();
+    int algo = libdivide_u32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
+            libdivide_2u32_t result = libdivide_2u32_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_2u32(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
+            libdivide_2u32_t result = libdivide_2u32_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_2u32(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
+            libdivide_2u32_t result = libdivide_2u32_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_2u32(sumX, result);
+        }
+    }
+    return libdivide_sum_2u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4u32_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_do_vector(numers, &denom);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+
+NOINLINE static uint64_t mine_4u32_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    int algo = libdivide_u32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+            libdivide_4u32_t result = libdivide_4u32_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_4u32(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+            libdivide_4u32_t result = libdivide_4u32_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_4u32(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+            libdivide_4u32_t result = libdivide_4u32_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_4u32(sumX, result);
+        }
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8u32_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_do_vector(numers, &denom);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+
+NOINLINE static uint64_t mine_8u32_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    int algo = libdivide_u32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+            libdivide_8u32_t result = libdivide_8u32_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_8u32(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+            libdivide_8u32_t result = libdivide_8u32_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_8u32(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+            libdivide_8u32_t result = libdivide_8u32_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_8u32(sumX, result);
+        }
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16u32_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        libdivide_16u32_t result = libdivide_16u32_do_vector(numers, &denom);
+        sumX = libdivide_add_16u32(sumX, result);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+
+NOINLINE static uint64_t mine_16u32_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    int algo = libdivide_u32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+            libdivide_16u32_t result = libdivide_16u32_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_16u32(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+            libdivide_16u32_t result = libdivide_16u32_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_16u32(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+            libdivide_16u32_t result = libdivide_16u32_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_16u32(sumX, result);
+        }
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u32_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += libdivide_u32_mod(numer, &denom);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_u32_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint32_t *data = (const uint32_t *)params->data;
+    const uint32_t d = *(uint32_t *)params->d;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += numer % d;
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2u32_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_2u32_t sumX = libdivide_zero_2u32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
+        libdivide_2u32_t result = libdivide_2u32_mod_vector(numers, &denom);
+        sumX = libdivide_add_2u32(sumX, result);
+    }
+    return libdivide_sum_2u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4u32_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_mod_vector(numers, &denom);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8u32_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_mod_vector(numers, &denom);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16u32_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        libdivide_16u32_t result = libdivide_16u32_mod_vector(numers, &denom);
+        sumX = libdivide_add_16u32(sumX, result);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u32_fastmod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_fastmod_t denom = libdivide_u32_fastmod_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += libdivide_u32_fastmod(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_4u32_fastmod_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_fastmod_t denom = libdivide_u32_fastmod_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_fastmod_vector(numers, &denom);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_8u32_fastmod_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_fastmod_t denom = libdivide_u32_fastmod_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_fastmod_vector(numers, &denom);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u32_fastmod_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u32_fastmod_t denom = libdivide_u32_fastmod_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t results[ARRAY_CHUNK];
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u32_fastmod_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_u32_divisible(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint32_t *data = (const uint32_t *)params->data;
+    const uint32_t d = *(uint32_t *)params->d;
+    uint64_t count = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        count += numer % d == 0;
+    }
+    return count;
+}
+
+NOINLINE static uint64_t mine_u32_divisible(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_divisible_t denom = libdivide_u32_divisible_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint64_t count = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        count += libdivide_u32_is_divisible(numer, &denom);
+    }
+    return count;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2u32_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_divisible_t denom = libdivide_u32_divisible_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_2u32_t sumX = libdivide_zero_2u32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
+        libdivide_2u32_t result = libdivide_2u32_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_2u32(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (uint32_t)(0 - libdivide_sum_2u32(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4u32_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_divisible_t denom = libdivide_u32_divisible_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (uint32_t)(0 - libdivide_sum_4u32(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8u32_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_divisible_t denom = libdivide_u32_divisible_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (uint32_t)(0 - libdivide_sum_8u32(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16u32_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_divisible_t denom = libdivide_u32_divisible_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    const libdivide_16u32_t ones = _mm512_set1_epi32(1);
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        sumX = _mm512_mask_add_epi32(sumX, libdivide_16u32_is_divisible_vector(numers, &denom), sumX, ones);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_u32_exact(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint32_t *data = (const uint32_t *)params->multiples;
+    const uint32_t d = *(uint32_t *)params->d;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += numer / d;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_exact(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_exact_t denom = libdivide_u32_exact_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->multiples;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += libdivide_u32_exact_do(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2u32_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_exact_t denom = libdivide_u32_exact_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->multiples;
+    libdivide_2u32_t sumX = libdivide_zero_2u32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
+        libdivide_2u32_t result = libdivide_2u32_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_2u32(sumX, result);
+    }
+    return libdivide_sum_2u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4u32_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_exact_t denom = libdivide_u32_exact_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->multiples;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8u32_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_exact_t denom = libdivide_u32_exact_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->multiples;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16u32_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_exact_t denom = libdivide_u32_exact_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->multiples;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        libdivide_16u32_t result = libdivide_16u32_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_16u32(sumX, result);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_u32_ceil(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint32_t *data = (const uint32_t *)params->data;
+    const uint32_t d = *(uint32_t *)params->d;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += numer / d + (numer % d != 0);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_u32_round(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint32_t *data = (const uint32_t *)params->data;
+    const uint32_t d = *(uint32_t *)params->d;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        uint32_t r = numer % d;
+        sum += numer / d + (r >= d - r);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_ceil(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += libdivide_u32_do_ceil(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2u32_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_2u32_t sumX = libdivide_zero_2u32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
+        libdivide_2u32_t result = libdivide_2u32_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_2u32(sumX, result);
+    }
+    return libdivide_sum_2u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4u32_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8u32_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16u32_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        libdivide_16u32_t result = libdivide_16u32_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_16u32(sumX, result);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u32_ceil_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t results[ARRAY_CHUNK];
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u32_do_ceil_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_round(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += libdivide_u32_do_round(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2u32_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_2u32_t sumX = libdivide_zero_2u32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u32_t numers = *((const libdivide_2u32_t*)(data + iter));
+        libdivide_2u32_t result = libdivide_2u32_do_round_vector(numers, &denom);
+        sumX = libdivide_add_2u32(sumX, result);
+    }
+    return libdivide_sum_2u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4u32_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_do_round_vector(numers, &denom);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8u32_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_do_round_vector(numers, &denom);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16u32_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        libdivide_16u32_t result = libdivide_16u32_do_round_vector(numers, &denom);
+        sumX = libdivide_add_16u32(sumX, result);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u32_round_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u32_t denom = *(struct libdivide_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t results[ARRAY_CHUNK];
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u32_do_round_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+//S32
+
+NOINLINE static uint64_t mine_s32(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += libdivide_s32_do(numer, &denom);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    int32_t sum = 0;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int algo = libdivide_s32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int32_t numer = data[iter];
+            sum += libdivide_s32_do_alg0(numer, &denom);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int32_t numer = data[iter];
+            sum += libdivide_s32_do_alg1(numer, &denom);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int32_t numer = data[iter];
+            sum += libdivide_s32_do_alg2(numer, &denom);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int32_t numer = data[iter];
+            sum += libdivide_s32_do_alg3(numer, &denom);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int32_t numer = data[iter];
+            sum += libdivide_s32_do_alg4(numer, &denom);
+        }
+    }
+
+    return (uint64_t)sum;
+}
+
+NOINLINE static uint64_t his_s32(struct FunctionParams_t *params) {
+    unsigned iter;
+    int32_t sum = 0;
+    const int32_t d = *(int32_t *)params->d;
+    const int32_t *data = (const int32_t *)params->data;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += numer / d;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t results[ARRAY_CHUNK];
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s32_do_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_generate(struct FunctionParams_t *params) {
+    unsigned iter;
+    int32_t *dPtr = (int32_t *)params->d;
+    struct libdivide_s32_t *denomPtr = (struct libdivide_s32_t *)params->denomPtr;
+    for (iter = 0; iter < GEN_ITERATIONS; iter++) {
+        *denomPtr = libdivide_s32_gen(*dPtr);
+    }
+    return *dPtr;
+}
+
+NOINLINE static uint64_t mine_s32_lookup(struct FunctionParams_t *params) {
+    unsigned iter;
+    int32_t *dPtr = (int32_t *)params->d;
+    struct libdivide_s32_t *denomPtr = (struct libdivide_s32_t *)params->denomPtr;
+    for (iter = 0; iter < GEN_ITERATIONS; iter++) {
+        *denomPtr = libdivide_s32_get(*dPtr);
+    }
+    return *dPtr;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2s32_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_2s32_t sumX = libdivide_zero_2s32();
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+        libdivide_2s32_t result = libdivide_2s32_do_vector(numers, &denom);
+        sumX = libdivide_add_2s32(sumX, result);
+    }
+    return libdivide_sum_2s32(sumX);
+}
+
+NOINLINE static uint64_t mine_2s32_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_2s32_t sumX = libdivide_zero_2s32();
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int algo = libdivide_s32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+            libdivide_2s32_t result = libdivide_2s32_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_2s32(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+            libdivide_2s32_t result = libdivide_2s32_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_2s32(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+            libdivide_2s32_t result = libdivide_2s32_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_2s32(sumX, result);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+            libdivide_2s32_t result = libdivide_2s32_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_2s32(sumX, result);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+            libdivide_2s32_t result = libdivide_2s32_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_2s32(sumX, result);
+        }
+    }
+    return libdivide_sum_2s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4s32_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_do_vector(numers, &denom);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+
+NOINLINE static uint64_t mine_4s32_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int algo = libdivide_s32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+            libdivide_4s32_t result = libdivide_4s32_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_4s32(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+            libdivide_4s32_t result = libdivide_4s32_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_4s32(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+            libdivide_4s32_t result = libdivide_4s32_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_4s32(sumX, result);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+            libdivide_4s32_t result = libdivide_4s32_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_4s32(sumX, result);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+            libdivide_4s32_t result = libdivide_4s32_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_4s32(sumX, result);
+        }
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8s32_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_do_vector(numers, &denom);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+
+NOINLINE static uint64_t mine_8s32_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int algo = libdivide_s32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+            libdivide_8s32_t result = libdivide_8s32_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_8s32(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+            libdivide_8s32_t result = libdivide_8s32_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_8s32(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+            libdivide_8s32_t result = libdivide_8s32_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_8s32(sumX, result);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+            libdivide_8s32_t result = libdivide_8s32_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_8s32(sumX, result);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+            libdivide_8s32_t result = libdivide_8s32_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_8s32(sumX, result);
+        }
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16s32_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_do_vector(numers, &denom);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+
+NOINLINE static uint64_t mine_16s32_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int algo = libdivide_s32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+            libdivide_16s32_t result = libdivide_16s32_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_16s32(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+            libdivide_16s32_t result = libdivide_16s32_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_16s32(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+            libdivide_16s32_t result = libdivide_16s32_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_16s32(sumX, result);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+            libdivide_16s32_t result = libdivide_16s32_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_16s32(sumX, result);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter+=16) {
+            libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+            libdivide_16s32_t result = libdivide_16s32_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_16s32(sumX, result);
+        }
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s32_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += libdivide_s32_mod(numer, &denom);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_s32_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int32_t *data = (const int32_t *)params->data;
+    const int32_t d = *(int32_t *)params->d;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += numer % d;
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2s32_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_2s32_t sumX = libdivide_zero_2s32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+        libdivide_2s32_t result = libdivide_2s32_mod_vector(numers, &denom);
+        sumX = libdivide_add_2s32(sumX, result);
+    }
+    return libdivide_sum_2s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4s32_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_mod_vector(numers, &denom);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8s32_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_mod_vector(numers, &denom);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16s32_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_mod_vector(numers, &denom);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_s32_divisible(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int32_t *data = (const int32_t *)params->data;
+    const int32_t d = *(int32_t *)params->d;
+    uint64_t count = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        count += numer % d == 0;
+    }
+    return count;
+}
+
+NOINLINE static uint64_t mine_s32_divisible(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_divisible_t denom = libdivide_s32_divisible_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->data;
+    uint64_t count = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        count += libdivide_s32_is_divisible(numer, &denom);
+    }
+    return count;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2s32_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_divisible_t denom = libdivide_s32_divisible_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_2s32_t sumX = libdivide_zero_2s32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+        libdivide_2s32_t result = libdivide_2s32_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_2s32(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (int32_t)(0 - libdivide_sum_2s32(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4s32_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_divisible_t denom = libdivide_s32_divisible_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (int32_t)(0 - libdivide_sum_4s32(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8s32_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_divisible_t denom = libdivide_s32_divisible_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (int32_t)(0 - libdivide_sum_8s32(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16s32_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_divisible_t denom = libdivide_s32_divisible_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->data;
+    const libdivide_16s32_t ones = _mm512_set1_epi32(1);
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        sumX = _mm512_mask_add_epi32(sumX, libdivide_16s32_is_divisible_vector(numers, &denom), sumX, ones);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_s32_exact(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int32_t *data = (const int32_t *)params->multiples;
+    const int32_t d = *(int32_t *)params->d;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += numer / d;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_exact(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_exact_t denom = libdivide_s32_exact_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->multiples;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += libdivide_s32_exact_do(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2s32_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_exact_t denom = libdivide_s32_exact_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->multiples;
+    libdivide_2s32_t sumX = libdivide_zero_2s32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+        libdivide_2s32_t result = libdivide_2s32_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_2s32(sumX, result);
+    }
+    return libdivide_sum_2s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4s32_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_exact_t denom = libdivide_s32_exact_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->multiples;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8s32_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_exact_t denom = libdivide_s32_exact_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->multiples;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16s32_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_exact_t denom = libdivide_s32_exact_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->multiples;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_s32_floor(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int32_t *data = (const int32_t *)params->data;
+    const int32_t d = *(int32_t *)params->d;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += numer / d - (numer % d != 0 && (numer ^ d) < 0);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_floor(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += libdivide_s32_do_floor(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2s32_floor_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_2s32_t sumX = libdivide_zero_2s32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+        libdivide_2s32_t result = libdivide_2s32_do_floor_vector(numers, &denom);
+        sumX = libdivide_add_2s32(sumX, result);
+    }
+    return libdivide_sum_2s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4s32_floor_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_do_floor_vector(numers, &denom);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8s32_floor_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_do_floor_vector(numers, &denom);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16s32_floor_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_do_floor_vector(numers, &denom);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s32_floor_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    int32_t sum = 0;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int algo = libdivide_s32_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int32_t numer = data[iter];
+            sum += libdivide_s32_do_floor_alg0(numer, &denom);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int32_t numer = data[iter];
+            sum += libdivide_s32_do_floor_alg1(numer, &denom);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int32_t numer = data[iter];
+            sum += libdivide_s32_do_floor_alg2(numer, &denom);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int32_t numer = data[iter];
+            sum += libdivide_s32_do_floor_alg3(numer, &denom);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int32_t numer = data[iter];
+            sum += libdivide_s32_do_floor_alg4(numer, &denom);
+        }
+    }
+
+    return (uint64_t)sum;
+}
+
+NOINLINE static uint64_t his_s32_euclid(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int32_t *data = (const int32_t *)params->data;
+    const int32_t d = *(int32_t *)params->d;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        int32_t r = numer % d;
+        sum += r >= 0 ? r : d < 0 ? r - d : r + d;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_euclid(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += libdivide_s32_mod_euclid(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2s32_euclid_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_2s32_t sumX = libdivide_zero_2s32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+        libdivide_2s32_t result = libdivide_2s32_mod_euclid_vector(numers, &denom);
+        sumX = libdivide_add_2s32(sumX, result);
+    }
+    return libdivide_sum_2s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4s32_euclid_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_mod_euclid_vector(numers, &denom);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8s32_euclid_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_mod_euclid_vector(numers, &denom);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16s32_euclid_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_mod_euclid_vector(numers, &denom);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_s32_ceil(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int32_t *data = (const int32_t *)params->data;
+    const int32_t d = *(int32_t *)params->d;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        int32_t r = numer % d;
+        sum += numer / d + (r != 0 && (r ^ d) >= 0);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_s32_round(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int32_t *data = (const int32_t *)params->data;
+    const int32_t d = *(int32_t *)params->d;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        int32_t r = numer % d;
+        uint32_t absR = r < 0 ? 0U - (uint32_t)r : (uint32_t)r, absD = d < 0 ? 0U - (uint32_t)d : (uint32_t)d;
+        sum += numer / d + (absR >= absD - absR ? ((r ^ d) < 0 ? -1 : 1) : 0);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_ceil(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += libdivide_s32_do_ceil(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2s32_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_2s32_t sumX = libdivide_zero_2s32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+        libdivide_2s32_t result = libdivide_2s32_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_2s32(sumX, result);
+    }
+    return libdivide_sum_2s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4s32_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8s32_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16s32_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s32_ceil_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t results[ARRAY_CHUNK];
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s32_do_ceil_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_round(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += libdivide_s32_do_round(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_2s32_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_2s32_t sumX = libdivide_zero_2s32();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s32_t numers = *((const libdivide_2s32_t*)(data + iter));
+        libdivide_2s32_t result = libdivide_2s32_do_round_vector(numers, &denom);
+        sumX = libdivide_add_2s32(sumX, result);
+    }
+    return libdivide_sum_2s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4s32_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_do_round_vector(numers, &denom);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8s32_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_do_round_vector(numers, &denom);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16s32_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_do_round_vector(numers, &denom);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s32_round_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_s32_t denom = *(struct libdivide_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t results[ARRAY_CHUNK];
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s32_do_round_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+//U64
+
+NOINLINE static uint64_t mine_u64(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += libdivide_u64_do(numer, &denom);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    uint64_t sum = 0;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    int algo = libdivide_u64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            uint64_t numer = data[iter];
+            sum += libdivide_u64_do_alg0(numer, &denom);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            uint64_t numer = data[iter];
+            sum += libdivide_u64_do_alg1(numer, &denom);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            uint64_t numer = data[iter];
+            sum += libdivide_u64_do_alg2(numer, &denom);
+        }
+    }
+
+    return sum;
+}
+
+NOINLINE static uint64_t his_u64(struct FunctionParams_t *params) {
+    unsigned iter;
+    uint64_t sum = 0;
+    const uint64_t d = *(uint64_t *)params->d;
+    const uint64_t *data = (const uint64_t *)params->data;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += numer / d;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t results[ARRAY_CHUNK];
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u64_do_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_generate(struct FunctionParams_t *params) {
+    unsigned iter;
+    uint64_t *dPtr = (uint64_t *)params->d;
+    struct libdivide_u64_t *denomPtr = (struct libdivide_u64_t *)params->denomPtr;
+    //each divider waits for the one before, as when one is made and used straight away, so this is the latency of the 128 by 64 bit division in there rather than its throughput.  chain is zero, which the compiler can't know
+    const uint64_t chain = (params->data == NULL);
+    uint64_t d = *dPtr;
+    for (iter = 0; iter < GEN_ITERATIONS; iter++) {
+        *denomPtr = libdivide_u64_gen(d);
+        d = *dPtr + (denomPtr->magic & chain);
+    }
+    return *dPtr;
+}
+
+//chained like mine_u64_generate, so this is the latency of the table load
+NOINLINE static uint64_t mine_u64_lookup(struct FunctionParams_t *params) {
+    unsigned iter;
+    uint64_t *dPtr = (uint64_t *)params->d;
+    struct libdivide_u64_t *denomPtr = (struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t chain = (params->data == NULL);
+    uint64_t d = *dPtr;
+    for (iter = 0; iter < GEN_ITERATIONS; iter++) {
+        *denomPtr = libdivide_u64_get(d);
+        d = *dPtr + (denomPtr->magic & chain);
+    }
+    return *dPtr;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1u64_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_1u64_t sumX = libdivide_zero_1u64();
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
+        libdivide_1u64_t result = libdivide_1u64_do_vector(numers, &denom);
+        sumX = libdivide_add_1u64(sumX, result);
+    }
+    return libdivide_sum_1u64(sumX);
+}
+
+NOINLINE static uint64_t mine_1u64_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_1u64_t sumX = libdivide_zero_1u64();
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    int algo = libdivide_u64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=1) {
+            libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
+            libdivide_1u64_t result = libdivide_1u64_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_1u64(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=1) {
+            libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
+            libdivide_1u64_t result = libdivide_1u64_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_1u64(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=1) {
+            libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
+            libdivide_1u64_t result = libdivide_1u64_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_1u64(sumX, result);
+        }
+    }
+    return libdivide_sum_1u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2u64_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_do_vector(numers, &denom);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+
+NOINLINE static uint64_t mine_2u64_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    int algo = libdivide_u64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+            libdivide_2u64_t result = libdivide_2u64_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_2u64(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+            libdivide_2u64_t result = libdivide_2u64_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_2u64(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+            libdivide_2u64_t result = libdivide_2u64_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_2u64(sumX, result);
+        }
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4u64_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_do_vector(numers, &denom);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+
+NOINLINE static uint64_t mine_4u64_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    int algo = libdivide_u64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+            libdivide_4u64_t result = libdivide_4u64_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_4u64(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+            libdivide_4u64_t result = libdivide_4u64_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_4u64(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+            libdivide_4u64_t result = libdivide_4u64_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_4u64(sumX, result);
+        }
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8u64_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t result = libdivide_8u64_do_vector(numers, &denom);
+        sumX = libdivide_add_8u64(sumX, result);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+
+NOINLINE static uint64_t mine_8u64_vector_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    int algo = libdivide_u64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+            libdivide_8u64_t result = libdivide_8u64_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_8u64(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+            libdivide_8u64_t result = libdivide_8u64_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_8u64(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+            libdivide_8u64_t result = libdivide_8u64_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_8u64(sumX, result);
+        }
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u64_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += libdivide_u64_mod(numer, &denom);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_u64_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint64_t *data = (const uint64_t *)params->data;
+    const uint64_t d = *(uint64_t *)params->d;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += numer % d;
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1u64_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_1u64_t sumX = libdivide_zero_1u64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
+        libdivide_1u64_t result = libdivide_1u64_mod_vector(numers, &denom);
+        sumX = libdivide_add_1u64(sumX, result);
+    }
+    return libdivide_sum_1u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2u64_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_mod_vector(numers, &denom);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4u64_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_mod_vector(numers, &denom);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8u64_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t result = libdivide_8u64_mod_vector(numers, &denom);
+        sumX = libdivide_add_8u64(sumX, result);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u64_fastmod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_fastmod_t denom = libdivide_u64_fastmod_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += libdivide_u64_fastmod(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_2u64_fastmod_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_fastmod_t denom = libdivide_u64_fastmod_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_fastmod_vector(numers, &denom);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_4u64_fastmod_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_fastmod_t denom = libdivide_u64_fastmod_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_fastmod_vector(numers, &denom);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u64_fastmod_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u64_fastmod_t denom = libdivide_u64_fastmod_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t results[ARRAY_CHUNK];
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u64_fastmod_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+/* The narrowing numerators are {data % d, data}, so the high word is always below the divisor */
+NOINLINE static uint64_t his_u64_narrow(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint64_t *data = (const uint64_t *)params->data;
+    const uint64_t *multiples = (const uint64_t *)params->multiples;
+    const uint64_t d = *(uint64_t *)params->d;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t rem;
+        sum += libdivide_128_div_64_to_64(data[iter] - multiples[iter], data[iter], d, &rem);
+        sum += rem;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_narrow(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_narrow_t denom = libdivide_u64_narrow_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    const uint64_t *multiples = (const uint64_t *)params->multiples;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t rem;
+        sum += libdivide_u64_narrow_do(data[iter] - multiples[iter], data[iter], &denom, &rem);
+        sum += rem;
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_4u64_narrow_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_narrow_t denom = libdivide_u64_narrow_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    const uint64_t *multiples = (const uint64_t *)params->multiples;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t his = _mm256_sub_epi64(numers, *((const libdivide_4u64_t*)(multiples + iter)));
+        libdivide_4u64_t rems;
+        libdivide_4u64_t result = libdivide_4u64_narrow_do_vector(his, numers, &denom, &rems);
+        sumX = libdivide_add_4u64(sumX, libdivide_add_4u64(result, rems));
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_8u64_narrow_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_narrow_t denom = libdivide_u64_narrow_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    const uint64_t *multiples = (const uint64_t *)params->multiples;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t his = _mm512_sub_epi64(numers, *((const libdivide_8u64_t*)(multiples + iter)));
+        libdivide_8u64_t rems;
+        libdivide_8u64_t result = libdivide_8u64_narrow_do_vector(his, numers, &denom, &rems);
+        sumX = libdivide_add_8u64(sumX, libdivide_add_8u64(result, rems));
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u64_narrow_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u64_narrow_t denom = libdivide_u64_narrow_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    const uint64_t *multiples = (const uint64_t *)params->multiples;
+    uint64_t his[ARRAY_CHUNK], quotients[ARRAY_CHUNK], remainders[ARRAY_CHUNK];
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            his[i] = data[iter + i] - multiples[iter + i];
+        }
+        libdivide_u64_narrow_do_array(his, data + iter, quotients, remainders, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += quotients[i] + remainders[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_u64_divisible(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint64_t *data = (const uint64_t *)params->data;
+    const uint64_t d = *(uint64_t *)params->d;
+    uint64_t count = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        count += numer % d == 0;
+    }
+    return count;
+}
+
+NOINLINE static uint64_t mine_u64_divisible(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_divisible_t denom = libdivide_u64_divisible_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t count = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        count += libdivide_u64_is_divisible(numer, &denom);
+    }
+    return count;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1u64_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_divisible_t denom = libdivide_u64_divisible_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_1u64_t sumX = libdivide_zero_1u64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
+        libdivide_1u64_t result = libdivide_1u64_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_1u64(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (uint64_t)(0 - libdivide_sum_1u64(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2u64_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_divisible_t denom = libdivide_u64_divisible_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (uint64_t)(0 - libdivide_sum_2u64(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4u64_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_divisible_t denom = libdivide_u64_divisible_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (uint64_t)(0 - libdivide_sum_4u64(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8u64_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_divisible_t denom = libdivide_u64_divisible_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    const libdivide_8u64_t ones = _mm512_set1_epi64(1);
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        sumX = _mm512_mask_add_epi64(sumX, libdivide_8u64_is_divisible_vector(numers, &denom), sumX, ones);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_u64_exact(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint64_t *data = (const uint64_t *)params->multiples;
+    const uint64_t d = *(uint64_t *)params->d;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += numer / d;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_exact(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_exact_t denom = libdivide_u64_exact_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->multiples;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += libdivide_u64_exact_do(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1u64_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_exact_t denom = libdivide_u64_exact_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->multiples;
+    libdivide_1u64_t sumX = libdivide_zero_1u64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
+        libdivide_1u64_t result = libdivide_1u64_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_1u64(sumX, result);
+    }
+    return libdivide_sum_1u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2u64_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_exact_t denom = libdivide_u64_exact_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->multiples;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4u64_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_exact_t denom = libdivide_u64_exact_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->multiples;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8u64_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_exact_t denom = libdivide_u64_exact_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->multiples;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t result = libdivide_8u64_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_8u64(sumX, result);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_u64_ceil(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint64_t *data = (const uint64_t *)params->data;
+    const uint64_t d = *(uint64_t *)params->d;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += numer / d + (numer % d != 0);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_u64_round(struct FunctionParams_t *params) {
+    unsigned iter;
+    const uint64_t *data = (const uint64_t *)params->data;
+    const uint64_t d = *(uint64_t *)params->d;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        uint64_t r = numer % d;
+        sum += numer / d + (r >= d - r);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_ceil(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += libdivide_u64_do_ceil(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1u64_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_1u64_t sumX = libdivide_zero_1u64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
+        libdivide_1u64_t result = libdivide_1u64_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_1u64(sumX, result);
+    }
+    return libdivide_sum_1u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2u64_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4u64_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8u64_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t result = libdivide_8u64_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_8u64(sumX, result);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u64_ceil_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t results[ARRAY_CHUNK];
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u64_do_ceil_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_round(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += libdivide_u64_do_round(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1u64_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_1u64_t sumX = libdivide_zero_1u64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1u64_t numers = *((const libdivide_1u64_t*)(data + iter));
+        libdivide_1u64_t result = libdivide_1u64_do_round_vector(numers, &denom);
+        sumX = libdivide_add_1u64(sumX, result);
+    }
+    return libdivide_sum_1u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2u64_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_do_round_vector(numers, &denom);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4u64_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_do_round_vector(numers, &denom);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8u64_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t result = libdivide_8u64_do_round_vector(numers, &denom);
+        sumX = libdivide_add_8u64(sumX, result);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u64_round_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u64_t denom = *(struct libdivide_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t results[ARRAY_CHUNK];
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u64_do_round_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+//S64
+NOINLINE static uint64_t mine_s64(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += libdivide_s64_do(numer, &denom);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_unswitched(struct FunctionParams_t *params) {
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+
+    unsigned iter;
+    int64_t sum = 0;
+    int algo = libdivide_s64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int64_t numer = data[iter];
+            sum += libdivide_s64_do_alg0(numer, &denom);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int64_t numer = data[iter];
+            sum += libdivide_s64_do_alg1(numer, &denom);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int64_t numer = data[iter];
+            sum += libdivide_s64_do_alg2(numer, &denom);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int64_t numer = data[iter];
+            sum += libdivide_s64_do_alg3(numer, &denom);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int64_t numer = data[iter];
+            sum += libdivide_s64_do_alg4(numer, &denom);
+        }
+    }
+
+    return sum;
+}
+
+NOINLINE static uint64_t his_s64(struct FunctionParams_t *params) {
+    const int64_t *data = (const int64_t *)params->data;
+    const int64_t d = *(int64_t *)params->d;
+
+    unsigned iter;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += numer / d;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t results[ARRAY_CHUNK];
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s64_do_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_generate(struct FunctionParams_t *params) {
+    int64_t *dPtr = (int64_t *)params->d;
+    struct libdivide_s64_t *denomPtr = (struct libdivide_s64_t *)params->denomPtr;
+    unsigned iter;
+    //chained like mine_u64_generate
+    const int64_t chain = (params->data == NULL);
+    int64_t d = *dPtr;
+    for (iter = 0; iter < GEN_ITERATIONS; iter++) {
+        *denomPtr = libdivide_s64_gen(d);
+        d = *dPtr + (denomPtr->magic & chain);
+    }
+    return *dPtr;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1s64_vector(struct FunctionParams_t *params) {
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+
+    unsigned iter;
+    libdivide_1s64_t sumX = libdivide_zero_1s64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+        libdivide_1s64_t result = libdivide_1s64_do_vector(numers, &denom);
+        sumX = libdivide_add_1s64(sumX, result);
+    }
+    return libdivide_sum_1s64(sumX);
+}
+
+NOINLINE static uint64_t mine_1s64_vector_unswitched(struct FunctionParams_t *params) {
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+
+    unsigned iter;
+    libdivide_1s64_t sumX = libdivide_zero_1s64();
+    int algo = libdivide_s64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=1) {
+            libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+            libdivide_1s64_t result = libdivide_1s64_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_1s64(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=1) {
+            libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+            libdivide_1s64_t result = libdivide_1s64_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_1s64(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=1) {
+            libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+            libdivide_1s64_t result = libdivide_1s64_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_1s64(sumX, result);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter+=1) {
+            libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+            libdivide_1s64_t result = libdivide_1s64_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_1s64(sumX, result);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter+=1) {
+            libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+            libdivide_1s64_t result = libdivide_1s64_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_1s64(sumX, result);
+        }
+    }
+    return libdivide_sum_1s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2s64_vector(struct FunctionParams_t *params) {
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+
+    unsigned iter;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_do_vector(numers, &denom);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+
+NOINLINE static uint64_t mine_2s64_vector_unswitched(struct FunctionParams_t *params) {
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+
+    unsigned iter;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    int algo = libdivide_s64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+            libdivide_2s64_t result = libdivide_2s64_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_2s64(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+            libdivide_2s64_t result = libdivide_2s64_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_2s64(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+            libdivide_2s64_t result = libdivide_2s64_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_2s64(sumX, result);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+            libdivide_2s64_t result = libdivide_2s64_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_2s64(sumX, result);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter+=2) {
+            libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+            libdivide_2s64_t result = libdivide_2s64_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_2s64(sumX, result);
+        }
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4s64_vector(struct FunctionParams_t *params) {
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+
+    unsigned iter;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_do_vector(numers, &denom);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+
+NOINLINE static uint64_t mine_4s64_vector_unswitched(struct FunctionParams_t *params) {
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+
+    unsigned iter;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    int algo = libdivide_s64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+            libdivide_4s64_t result = libdivide_4s64_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_4s64(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+            libdivide_4s64_t result = libdivide_4s64_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_4s64(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+            libdivide_4s64_t result = libdivide_4s64_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_4s64(sumX, result);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+            libdivide_4s64_t result = libdivide_4s64_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_4s64(sumX, result);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter+=4) {
+            libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+            libdivide_4s64_t result = libdivide_4s64_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_4s64(sumX, result);
+        }
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8s64_vector(struct FunctionParams_t *params) {
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+
+    unsigned iter;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_do_vector(numers, &denom);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+
+NOINLINE static uint64_t mine_8s64_vector_unswitched(struct FunctionParams_t *params) {
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+
+    unsigned iter;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    int algo = libdivide_s64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+            libdivide_8s64_t result = libdivide_8s64_do_vector_alg0(numers, &denom);
+            sumX = libdivide_add_8s64(sumX, result);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+            libdivide_8s64_t result = libdivide_8s64_do_vector_alg1(numers, &denom);
+            sumX = libdivide_add_8s64(sumX, result);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+            libdivide_8s64_t result = libdivide_8s64_do_vector_alg2(numers, &denom);
+            sumX = libdivide_add_8s64(sumX, result);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+            libdivide_8s64_t result = libdivide_8s64_do_vector_alg3(numers, &denom);
+            sumX = libdivide_add_8s64(sumX, result);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter+=8) {
+            libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+            libdivide_8s64_t result = libdivide_8s64_do_vector_alg4(numers, &denom);
+            sumX = libdivide_add_8s64(sumX, result);
+        }
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s64_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += libdivide_s64_mod(numer, &denom);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_s64_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int64_t *data = (const int64_t *)params->data;
+    const int64_t d = *(int64_t *)params->d;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += numer % d;
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1s64_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_1s64_t sumX = libdivide_zero_1s64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+        libdivide_1s64_t result = libdivide_1s64_mod_vector(numers, &denom);
+        sumX = libdivide_add_1s64(sumX, result);
+    }
+    return libdivide_sum_1s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2s64_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_mod_vector(numers, &denom);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4s64_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_mod_vector(numers, &denom);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8s64_vector_mod(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_mod_vector(numers, &denom);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_s64_divisible(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int64_t *data = (const int64_t *)params->data;
+    const int64_t d = *(int64_t *)params->d;
+    uint64_t count = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        count += numer % d == 0;
+    }
+    return count;
+}
+
+NOINLINE static uint64_t mine_s64_divisible(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_divisible_t denom = libdivide_s64_divisible_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->data;
+    uint64_t count = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        count += libdivide_s64_is_divisible(numer, &denom);
+    }
+    return count;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1s64_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_divisible_t denom = libdivide_s64_divisible_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_1s64_t sumX = libdivide_zero_1s64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+        libdivide_1s64_t result = libdivide_1s64_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_1s64(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (int64_t)(0 - libdivide_sum_1s64(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2s64_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_divisible_t denom = libdivide_s64_divisible_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (int64_t)(0 - libdivide_sum_2s64(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4s64_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_divisible_t denom = libdivide_s64_divisible_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_is_divisible_vector(numers, &denom);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    /* Each divisible lane adds all ones, i.e. -1 */
+    return (int64_t)(0 - libdivide_sum_4s64(sumX));
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8s64_divisible_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_divisible_t denom = libdivide_s64_divisible_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->data;
+    const libdivide_8s64_t ones = _mm512_set1_epi64(1);
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        sumX = _mm512_mask_add_epi64(sumX, libdivide_8s64_is_divisible_vector(numers, &denom), sumX, ones);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_s64_exact(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int64_t *data = (const int64_t *)params->multiples;
+    const int64_t d = *(int64_t *)params->d;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += numer / d;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_exact(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_exact_t denom = libdivide_s64_exact_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->multiples;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += libdivide_s64_exact_do(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1s64_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_exact_t denom = libdivide_s64_exact_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->multiples;
+    libdivide_1s64_t sumX = libdivide_zero_1s64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+        libdivide_1s64_t result = libdivide_1s64_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_1s64(sumX, result);
+    }
+    return libdivide_sum_1s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2s64_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_exact_t denom = libdivide_s64_exact_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->multiples;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4s64_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_exact_t denom = libdivide_s64_exact_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->multiples;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8s64_exact_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_exact_t denom = libdivide_s64_exact_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->multiples;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_exact_do_vector(numers, &denom);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_s64_floor(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int64_t *data = (const int64_t *)params->data;
+    const int64_t d = *(int64_t *)params->d;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += numer / d - (numer % d != 0 && (numer ^ d) < 0);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_floor(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += libdivide_s64_do_floor(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1s64_floor_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_1s64_t sumX = libdivide_zero_1s64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+        libdivide_1s64_t result = libdivide_1s64_do_floor_vector(numers, &denom);
+        sumX = libdivide_add_1s64(sumX, result);
+    }
+    return libdivide_sum_1s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2s64_floor_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_do_floor_vector(numers, &denom);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4s64_floor_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_do_floor_vector(numers, &denom);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8s64_floor_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_do_floor_vector(numers, &denom);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s64_floor_unswitched(struct FunctionParams_t *params) {
+    unsigned iter;
+    int64_t sum = 0;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int algo = libdivide_s64_get_algorithm(&denom);
+    if (algo == 0) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int64_t numer = data[iter];
+            sum += libdivide_s64_do_floor_alg0(numer, &denom);
+        }
+    }
+    else if (algo == 1) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int64_t numer = data[iter];
+            sum += libdivide_s64_do_floor_alg1(numer, &denom);
+        }
+    }
+    else if (algo == 2) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int64_t numer = data[iter];
+            sum += libdivide_s64_do_floor_alg2(numer, &denom);
+        }
+    }
+    else if (algo == 3) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int64_t numer = data[iter];
+            sum += libdivide_s64_do_floor_alg3(numer, &denom);
+        }
+    }
+    else if (algo == 4) {
+        for (iter = 0; iter < ITERATIONS; iter++) {
+            int64_t numer = data[iter];
+            sum += libdivide_s64_do_floor_alg4(numer, &denom);
+        }
+    }
+
+    return (uint64_t)sum;
+}
+
+NOINLINE static uint64_t his_s64_euclid(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int64_t *data = (const int64_t *)params->data;
+    const int64_t d = *(int64_t *)params->d;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        int64_t r = numer % d;
+        sum += r >= 0 ? r : d < 0 ? r - d : r + d;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_euclid(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += libdivide_s64_mod_euclid(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1s64_euclid_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_1s64_t sumX = libdivide_zero_1s64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+        libdivide_1s64_t result = libdivide_1s64_mod_euclid_vector(numers, &denom);
+        sumX = libdivide_add_1s64(sumX, result);
+    }
+    return libdivide_sum_1s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2s64_euclid_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_mod_euclid_vector(numers, &denom);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4s64_euclid_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_mod_euclid_vector(numers, &denom);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8s64_euclid_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_mod_euclid_vector(numers, &denom);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_s64_ceil(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int64_t *data = (const int64_t *)params->data;
+    const int64_t d = *(int64_t *)params->d;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        int64_t r = numer % d;
+        sum += numer / d + (r != 0 && (r ^ d) >= 0);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_s64_round(struct FunctionParams_t *params) {
+    unsigned iter;
+    const int64_t *data = (const int64_t *)params->data;
+    const int64_t d = *(int64_t *)params->d;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        int64_t r = numer % d;
+        uint64_t absR = r < 0 ? 0ULL - (uint64_t)r : (uint64_t)r, absD = d < 0 ? 0ULL - (uint64_t)d : (uint64_t)d;
+        sum += numer / d + (absR >= absD - absR ? ((r ^ d) < 0 ? -1 : 1) : 0);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_ceil(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += libdivide_s64_do_ceil(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1s64_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_1s64_t sumX = libdivide_zero_1s64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+        libdivide_1s64_t result = libdivide_1s64_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_1s64(sumX, result);
+    }
+    return libdivide_sum_1s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2s64_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4s64_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8s64_ceil_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_do_ceil_vector(numers, &denom);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s64_ceil_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t results[ARRAY_CHUNK];
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s64_do_ceil_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_round(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += libdivide_s64_do_round(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC64
+NOINLINE static uint64_t mine_1s64_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_1s64_t sumX = libdivide_zero_1s64();
+    for (iter = 0; iter < ITERATIONS; iter+=1) {
+        libdivide_1s64_t numers = *((const libdivide_1s64_t*)(data + iter));
+        libdivide_1s64_t result = libdivide_1s64_do_round_vector(numers, &denom);
+        sumX = libdivide_add_1s64(sumX, result);
+    }
+    return libdivide_sum_1s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2s64_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_do_round_vector(numers, &denom);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4s64_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_do_round_vector(numers, &denom);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8s64_round_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_do_round_vector(numers, &denom);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s64_round_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_s64_t denom = *(struct libdivide_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t results[ARRAY_CHUNK];
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s64_do_round_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_branchfree(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_branchfree_t denom = libdivide_u32_branchfree_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += libdivide_u32_branchfree_do(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_4u32_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_branchfree_t denom = libdivide_u32_branchfree_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_8u32_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_branchfree_t denom = libdivide_u32_branchfree_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_16u32_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u32_branchfree_t denom = libdivide_u32_branchfree_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        libdivide_16u32_t result = libdivide_16u32_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_16u32(sumX, result);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u32_branchfree_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u32_branchfree_t denom = libdivide_u32_branchfree_gen(*(uint32_t *)params->d);
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t results[ARRAY_CHUNK];
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u32_branchfree_do_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_branchfree(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_branchfree_t denom = libdivide_s32_branchfree_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += libdivide_s32_branchfree_do(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_4s32_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_branchfree_t denom = libdivide_s32_branchfree_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_8s32_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_branchfree_t denom = libdivide_s32_branchfree_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_16s32_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s32_branchfree_t denom = libdivide_s32_branchfree_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s32_branchfree_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_s32_branchfree_t denom = libdivide_s32_branchfree_gen(*(int32_t *)params->d);
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t results[ARRAY_CHUNK];
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s32_branchfree_do_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_branchfree(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_branchfree_t denom = libdivide_u64_branchfree_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += libdivide_u64_branchfree_do(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_2u64_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_branchfree_t denom = libdivide_u64_branchfree_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_4u64_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_branchfree_t denom = libdivide_u64_branchfree_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_8u64_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_u64_branchfree_t denom = libdivide_u64_branchfree_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t result = libdivide_8u64_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_8u64(sumX, result);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u64_branchfree_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_u64_branchfree_t denom = libdivide_u64_branchfree_gen(*(uint64_t *)params->d);
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t results[ARRAY_CHUNK];
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u64_branchfree_do_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_branchfree(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_branchfree_t denom = libdivide_s64_branchfree_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += libdivide_s64_branchfree_do(numer, &denom);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_2s64_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_branchfree_t denom = libdivide_s64_branchfree_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_4s64_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_branchfree_t denom = libdivide_s64_branchfree_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_8s64_branchfree_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct libdivide_s64_branchfree_t denom = libdivide_s64_branchfree_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_branchfree_do_vector(numers, &denom);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s64_branchfree_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct libdivide_s64_branchfree_t denom = libdivide_s64_branchfree_gen(*(int64_t *)params->d);
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t results[ARRAY_CHUNK];
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s64_branchfree_do_array(data + iter, results, ARRAY_CHUNK, &denom);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+/* The rotate test divides by a table of ROTATE_DIVISORS random divisors, moving to the next one for every numerator, or for every vector since a vector takes one divisor, as a kernel that walks a table of divisors does.  Then the branches of libdivide_*_do on the divisor can't be predicted, and the branchfree dividers show what that costs. */
+#define ROTATE_DIVISORS 64
+
+struct rotate_u32_t {
+    uint32_t d[ROTATE_DIVISORS];
+    struct libdivide_u32_t denom[ROTATE_DIVISORS];
+    struct libdivide_u32_branchfree_t branchfree[ROTATE_DIVISORS];
+    uint32_t magics[ROTATE_DIVISORS];
+    uint8_t mores[ROTATE_DIVISORS + LIBDIVIDE_ARRAY_PADDING];
+    struct libdivide_u32_array_t array; // the branchfree dividers again, packed
+    const uint32_t *index; // a random divisor for each numerator, for the gathers
+};
+
+struct rotate_s32_t {
+    int32_t d[ROTATE_DIVISORS];
+    struct libdivide_s32_t denom[ROTATE_DIVISORS];
+    struct libdivide_s32_branchfree_t branchfree[ROTATE_DIVISORS];
+    int32_t magics[ROTATE_DIVISORS];
+    uint8_t mores[ROTATE_DIVISORS + LIBDIVIDE_ARRAY_PADDING];
+    struct libdivide_s32_array_t array; // the branchfree dividers again, packed
+    const uint32_t *index; // a random divisor for each numerator, for the gathers
+};
+
+struct rotate_u64_t {
+    uint64_t d[ROTATE_DIVISORS];
+    struct libdivide_u64_t denom[ROTATE_DIVISORS];
+    struct libdivide_u64_branchfree_t branchfree[ROTATE_DIVISORS];
+    uint64_t magics[ROTATE_DIVISORS];
+    uint8_t mores[ROTATE_DIVISORS + LIBDIVIDE_ARRAY_PADDING];
+    struct libdivide_u64_array_t array; // the branchfree dividers again, packed
+    const uint32_t *index; // a random divisor for each numerator, for the gathers
+};
+
+struct rotate_s64_t {
+    int64_t d[ROTATE_DIVISORS];
+    struct libdivide_s64_t denom[ROTATE_DIVISORS];
+    struct libdivide_s64_branchfree_t branchfree[ROTATE_DIVISORS];
+    int64_t magics[ROTATE_DIVISORS];
+    uint8_t mores[ROTATE_DIVISORS + LIBDIVIDE_ARRAY_PADDING];
+    struct libdivide_s64_array_t array; // the branchfree dividers again, packed
+    const uint32_t *index; // a random divisor for each numerator, for the gathers
+};
+
+NOINLINE static uint64_t his_u32_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += numer / rotate->d[iter % ROTATE_DIVISORS];
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += libdivide_u32_do(numer, &rotate->denom[iter % ROTATE_DIVISORS]);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_branchfree_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint32_t numer = data[iter];
+        sum += libdivide_u32_branchfree_do(numer, &rotate->branchfree[iter % ROTATE_DIVISORS]);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4u32_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_do_vector(numers, &rotate->denom[(iter / 4) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_4u32_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_branchfree_do_vector(numers, &rotate->branchfree[(iter / 4) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8u32_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_do_vector(numers, &rotate->denom[(iter / 8) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_8u32_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_branchfree_do_vector(numers, &rotate->branchfree[(iter / 8) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16u32_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        libdivide_16u32_t result = libdivide_16u32_do_vector(numers, &rotate->denom[(iter / 16) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_16u32(sumX, result);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_16u32_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        libdivide_16u32_t result = libdivide_16u32_branchfree_do_vector(numers, &rotate->branchfree[(iter / 16) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_16u32(sumX, result);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_s32_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += numer / rotate->d[iter % ROTATE_DIVISORS];
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += libdivide_s32_do(numer, &rotate->denom[iter % ROTATE_DIVISORS]);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_branchfree_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int32_t numer = data[iter];
+        sum += libdivide_s32_branchfree_do(numer, &rotate->branchfree[iter % ROTATE_DIVISORS]);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_4s32_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_do_vector(numers, &rotate->denom[(iter / 4) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_4s32_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_branchfree_do_vector(numers, &rotate->branchfree[(iter / 4) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_8s32_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_do_vector(numers, &rotate->denom[(iter / 8) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_8s32_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_branchfree_do_vector(numers, &rotate->branchfree[(iter / 8) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_16s32_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_do_vector(numers, &rotate->denom[(iter / 16) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_16s32_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_branchfree_do_vector(numers, &rotate->branchfree[(iter / 16) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_u64_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += numer / rotate->d[iter % ROTATE_DIVISORS];
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += libdivide_u64_do(numer, &rotate->denom[iter % ROTATE_DIVISORS]);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_branchfree_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint64_t numer = data[iter];
+        sum += libdivide_u64_branchfree_do(numer, &rotate->branchfree[iter % ROTATE_DIVISORS]);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2u64_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_do_vector(numers, &rotate->denom[(iter / 2) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_2u64_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_branchfree_do_vector(numers, &rotate->branchfree[(iter / 2) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4u64_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_do_vector(numers, &rotate->denom[(iter / 4) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_4u64_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_branchfree_do_vector(numers, &rotate->branchfree[(iter / 4) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8u64_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t result = libdivide_8u64_do_vector(numers, &rotate->denom[(iter / 8) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_8u64(sumX, result);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_8u64_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t result = libdivide_8u64_branchfree_do_vector(numers, &rotate->branchfree[(iter / 8) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_8u64(sumX, result);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t his_s64_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += numer / rotate->d[iter % ROTATE_DIVISORS];
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += libdivide_s64_do(numer, &rotate->denom[iter % ROTATE_DIVISORS]);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_branchfree_rotate(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        int64_t numer = data[iter];
+        sum += libdivide_s64_branchfree_do(numer, &rotate->branchfree[iter % ROTATE_DIVISORS]);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_VEC128
+NOINLINE static uint64_t mine_2s64_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_do_vector(numers, &rotate->denom[(iter / 2) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_2s64_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_branchfree_do_vector(numers, &rotate->branchfree[(iter / 2) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC256
+NOINLINE static uint64_t mine_4s64_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_do_vector(numers, &rotate->denom[(iter / 4) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_4s64_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_branchfree_do_vector(numers, &rotate->branchfree[(iter / 4) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_VEC512
+NOINLINE static uint64_t mine_8s64_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_do_vector(numers, &rotate->denom[(iter / 8) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_8s64_branchfree_rotate_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_branchfree_do_vector(numers, &rotate->branchfree[(iter / 8) % ROTATE_DIVISORS]);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_4u32_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_branchfree_do_gather(numers, _mm_loadu_si128((const __m128i *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_8u32_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_branchfree_do_gather(numers, _mm256_loadu_si256((const __m256i *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_16u32_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        libdivide_16u32_t result = libdivide_16u32_branchfree_do_gather(numers, _mm512_loadu_si512((const void *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_16u32(sumX, result);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u32_gather_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t results[ARRAY_CHUNK];
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u32_branchfree_do_array_indexed(data + iter, rotate->index + iter, results, ARRAY_CHUNK, rotate->branchfree);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_4s32_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_branchfree_do_gather(numers, _mm_loadu_si128((const __m128i *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_8s32_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_branchfree_do_gather(numers, _mm256_loadu_si256((const __m256i *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_16s32_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_branchfree_do_gather(numers, _mm512_loadu_si512((const void *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s32_gather_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t results[ARRAY_CHUNK];
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s32_branchfree_do_array_indexed(data + iter, rotate->index + iter, results, ARRAY_CHUNK, rotate->branchfree);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_2u64_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_branchfree_do_gather(numers, _mm_loadl_epi64((const __m128i *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_4u64_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_branchfree_do_gather(numers, _mm_loadu_si128((const __m128i *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_8u64_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t result = libdivide_8u64_branchfree_do_gather(numers, _mm256_loadu_si256((const __m256i *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_8u64(sumX, result);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u64_gather_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t results[ARRAY_CHUNK];
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u64_branchfree_do_array_indexed(data + iter, rotate->index + iter, results, ARRAY_CHUNK, rotate->branchfree);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_2s64_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_branchfree_do_gather(numers, _mm_loadl_epi64((const __m128i *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_4s64_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_branchfree_do_gather(numers, _mm_loadu_si128((const __m128i *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_8s64_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_branchfree_do_gather(numers, _mm256_loadu_si256((const __m256i *)(rotate->index + iter)), rotate->branchfree);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s64_gather_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t results[ARRAY_CHUNK];
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s64_branchfree_do_array_indexed(data + iter, rotate->index + iter, results, ARRAY_CHUNK, rotate->branchfree);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+
+/* The same with the dividers in a divider array, looked up one at a time and then gathered */
+NOINLINE static uint64_t mine_u32_soa(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        sum += libdivide_u32_array_do(data[iter], rotate->index[iter], &rotate->array);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_soa(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        sum += libdivide_s32_array_do(data[iter], rotate->index[iter], &rotate->array);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_soa(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        sum += libdivide_u64_array_do(data[iter], rotate->index[iter], &rotate->array);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_soa(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        sum += libdivide_s64_array_do(data[iter], rotate->index[iter], &rotate->array);
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_4u32_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_4u32_t sumX = libdivide_zero_4u32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u32_t numers = *((const libdivide_4u32_t*)(data + iter));
+        libdivide_4u32_t result = libdivide_4u32_array_do_gather(numers, _mm_loadu_si128((const __m128i *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_4u32(sumX, result);
+    }
+    return libdivide_sum_4u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_8u32_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_8u32_t sumX = libdivide_zero_8u32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u32_t numers = *((const libdivide_8u32_t*)(data + iter));
+        libdivide_8u32_t result = libdivide_8u32_array_do_gather(numers, _mm256_loadu_si256((const __m256i *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_8u32(sumX, result);
+    }
+    return libdivide_sum_8u32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_16u32_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    libdivide_16u32_t sumX = libdivide_zero_16u32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16u32_t numers = *((const libdivide_16u32_t*)(data + iter));
+        libdivide_16u32_t result = libdivide_16u32_array_do_gather(numers, _mm512_loadu_si512((const void *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_16u32(sumX, result);
+    }
+    return libdivide_sum_16u32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u32_soa_gather_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct rotate_u32_t *rotate = (const struct rotate_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t results[ARRAY_CHUNK];
+    uint32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u32_array_do_indexed(data + iter, rotate->index + iter, results, ARRAY_CHUNK, &rotate->array);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_4s32_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_4s32_t sumX = libdivide_zero_4s32();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s32_t numers = *((const libdivide_4s32_t*)(data + iter));
+        libdivide_4s32_t result = libdivide_4s32_array_do_gather(numers, _mm_loadu_si128((const __m128i *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_4s32(sumX, result);
+    }
+    return libdivide_sum_4s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_8s32_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_8s32_t sumX = libdivide_zero_8s32();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s32_t numers = *((const libdivide_8s32_t*)(data + iter));
+        libdivide_8s32_t result = libdivide_8s32_array_do_gather(numers, _mm256_loadu_si256((const __m256i *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_8s32(sumX, result);
+    }
+    return libdivide_sum_8s32(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_16s32_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    libdivide_16s32_t sumX = libdivide_zero_16s32();
+    for (iter = 0; iter < ITERATIONS; iter+=16) {
+        libdivide_16s32_t numers = *((const libdivide_16s32_t*)(data + iter));
+        libdivide_16s32_t result = libdivide_16s32_array_do_gather(numers, _mm512_loadu_si512((const void *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_16s32(sumX, result);
+    }
+    return libdivide_sum_16s32(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s32_soa_gather_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct rotate_s32_t *rotate = (const struct rotate_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t results[ARRAY_CHUNK];
+    int32_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s32_array_do_indexed(data + iter, rotate->index + iter, results, ARRAY_CHUNK, &rotate->array);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_2u64_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_2u64_t sumX = libdivide_zero_2u64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2u64_t numers = *((const libdivide_2u64_t*)(data + iter));
+        libdivide_2u64_t result = libdivide_2u64_array_do_gather(numers, _mm_loadl_epi64((const __m128i *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_2u64(sumX, result);
+    }
+    return libdivide_sum_2u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_4u64_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_4u64_t sumX = libdivide_zero_4u64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4u64_t numers = *((const libdivide_4u64_t*)(data + iter));
+        libdivide_4u64_t result = libdivide_4u64_array_do_gather(numers, _mm_loadu_si128((const __m128i *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_4u64(sumX, result);
+    }
+    return libdivide_sum_4u64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_8u64_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    libdivide_8u64_t sumX = libdivide_zero_8u64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8u64_t numers = *((const libdivide_8u64_t*)(data + iter));
+        libdivide_8u64_t result = libdivide_8u64_array_do_gather(numers, _mm256_loadu_si256((const __m256i *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_8u64(sumX, result);
+    }
+    return libdivide_sum_8u64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_u64_soa_gather_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct rotate_u64_t *rotate = (const struct rotate_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t results[ARRAY_CHUNK];
+    uint64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_u64_array_do_indexed(data + iter, rotate->index + iter, results, ARRAY_CHUNK, &rotate->array);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+#if LIBDIVIDE_USE_SSE2
+NOINLINE static uint64_t mine_2s64_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_2s64_t sumX = libdivide_zero_2s64();
+    for (iter = 0; iter < ITERATIONS; iter+=2) {
+        libdivide_2s64_t numers = *((const libdivide_2s64_t*)(data + iter));
+        libdivide_2s64_t result = libdivide_2s64_array_do_gather(numers, _mm_loadl_epi64((const __m128i *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_2s64(sumX, result);
+    }
+    return libdivide_sum_2s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX2
+NOINLINE static uint64_t mine_4s64_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_4s64_t sumX = libdivide_zero_4s64();
+    for (iter = 0; iter < ITERATIONS; iter+=4) {
+        libdivide_4s64_t numers = *((const libdivide_4s64_t*)(data + iter));
+        libdivide_4s64_t result = libdivide_4s64_array_do_gather(numers, _mm_loadu_si128((const __m128i *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_4s64(sumX, result);
+    }
+    return libdivide_sum_4s64(sumX);
+}
+#endif
+
+#if LIBDIVIDE_USE_AVX512
+NOINLINE static uint64_t mine_8s64_soa_gather_vector(struct FunctionParams_t *params) {
+    unsigned iter;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    libdivide_8s64_t sumX = libdivide_zero_8s64();
+    for (iter = 0; iter < ITERATIONS; iter+=8) {
+        libdivide_8s64_t numers = *((const libdivide_8s64_t*)(data + iter));
+        libdivide_8s64_t result = libdivide_8s64_array_do_gather(numers, _mm256_loadu_si256((const __m256i *)(rotate->index + iter)), &rotate->array);
+        sumX = libdivide_add_8s64(sumX, result);
+    }
+    return libdivide_sum_8s64(sumX);
+}
+#endif
+
+NOINLINE static uint64_t mine_s64_soa_gather_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct rotate_s64_t *rotate = (const struct rotate_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t results[ARRAY_CHUNK];
+    int64_t sum = 0;
+    for (iter = 0; iter < ITERATIONS; iter += ARRAY_CHUNK) {
+        libdivide_s64_array_do_indexed(data + iter, rotate->index + iter, results, ARRAY_CHUNK, &rotate->array);
+        for (i = 0; i < ARRAY_CHUNK; i++) {
+            sum += results[i];
+        }
+    }
+    return sum;
+}
+
+/* The gen test makes the dividers for a table of GEN_DIVISORS random divisors, one at a time with libdivide_*_gen, or all at once with libdivide_*_gen_array and libdivide_*_gen_array_soa, as when a dictionary of divisors is rebuilt.  The table is long enough that the branch predictor can't learn the branches of libdivide_*_gen on it, as it couldn't for fresh divisors.  It also loads the same dividers saved with libdivide_*_serialize, copying them out of a buffer with libdivide_*_deserialize, or mapping the file they were written to and reading them in place through libdivide_*_view, as a program would when it starts.  The system column divides once by each divisor in hardware, for scale.  Each function returns a checksum of the last table it made. */
+#define GEN_DIVISORS (1 << 14)
+
+/* The serialized dividers, in memory and in a temporary file */
+struct serial_t {
+    void *buf;
+    size_t size;
+#if MMAP_TEST
+    FILE *file;
+#endif
+};
+
+static void serial_open(struct serial_t *serial) {
+#if MMAP_TEST
+    serial->file = tmpfile();
+    if (serial->file == NULL || fwrite(serial->buf, 1, serial->size, serial->file) != serial->size || fflush(serial->file) != 0) {
+        printf("Couldn't write the serialized dividers to a file\n");
+        exit(EXIT_FAILURE);
+    }
+#else
+    (void)serial;
+#endif
+}
+
+/* Without mmap the view test reads the buffer in place instead */
+static const void *serial_map(const struct serial_t *serial) {
+#if MMAP_TEST
+    void *mapped = mmap(NULL, serial->size, PROT_READ, MAP_PRIVATE, fileno(serial->file), 0);
+    if (mapped == MAP_FAILED) {
+        printf("Couldn't map the serialized dividers\n");
+        exit(EXIT_FAILURE);
+    }
+    return mapped;
+#else
+    return serial->buf;
+#endif
+}
+
+static void serial_unmap(const struct serial_t *serial, const void *mapped) {
+#if MMAP_TEST
+    munmap((void *)mapped, serial->size);
+#else
+    (void)serial;
+    (void)mapped;
+#endif
+}
+
+static void serial_close(struct serial_t *serial) {
+#if MMAP_TEST
+    fclose(serial->file);
+#endif
+    free(serial->buf);
+}
+
+struct gen_u32_t {
+    uint32_t d[GEN_DIVISORS];
+    struct libdivide_u32_t denom[GEN_DIVISORS];
+    uint32_t magic[GEN_DIVISORS];
+    uint8_t more[GEN_DIVISORS];
+    struct serial_t serial;
+};
+
+struct gen_s32_t {
+    int32_t d[GEN_DIVISORS];
+    struct libdivide_s32_t denom[GEN_DIVISORS];
+    int32_t magic[GEN_DIVISORS];
+    uint8_t more[GEN_DIVISORS];
+    struct serial_t serial;
+};
+
+struct gen_u64_t {
+    uint64_t d[GEN_DIVISORS];
+    struct libdivide_u64_t denom[GEN_DIVISORS];
+    uint64_t magic[GEN_DIVISORS];
+    uint8_t more[GEN_DIVISORS];
+    struct serial_t serial;
+};
+
+struct gen_s64_t {
+    int64_t d[GEN_DIVISORS];
+    struct libdivide_s64_t denom[GEN_DIVISORS];
+    int64_t magic[GEN_DIVISORS];
+    uint8_t more[GEN_DIVISORS];
+    struct serial_t serial;
+};
+
+NOINLINE static uint64_t his_u32_gen(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct gen_u32_t *gen = (const struct gen_u32_t *)params->denomPtr;
+    const uint32_t *data = (const uint32_t *)params->data;
+    uint32_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        for (i = 0; i < GEN_DIVISORS; i++) {
+            sum += data[iter + i] / gen->d[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_gen_each(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_u32_t *gen = (struct gen_u32_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        for (i = 0; i < GEN_DIVISORS; i++) {
+            gen->denom[i] = libdivide_u32_gen(gen->d[i]);
+        }
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint32_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_gen_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_u32_t *gen = (struct gen_u32_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_u32_gen_array(gen->d, gen->denom, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint32_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_gen_array_soa(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_u32_t *gen = (struct gen_u32_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_u32_gen_array_soa(gen->d, gen->magic, gen->more, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint32_t)gen->magic[i] + gen->more[i];
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u32_read(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_u32_t *gen = (struct gen_u32_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_u32_deserialize(gen->serial.buf, gen->serial.size, gen->denom, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint32_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+/* The dividers are only read, and the mapping is gone by the next pass, so the sum is taken each time */
+NOINLINE static uint64_t mine_u32_view(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct gen_u32_t *gen = (const struct gen_u32_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        const void *mapped = serial_map(&gen->serial);
+        size_t n = 0;
+        const struct libdivide_u32_t *denom = libdivide_u32_view(mapped, gen->serial.size, &n);
+        sum = 0;
+        for (i = 0; i < n; i++) {
+            sum += (uint32_t)denom[i].magic + denom[i].more;
+        }
+        serial_unmap(&gen->serial, mapped);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_s32_gen(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct gen_s32_t *gen = (const struct gen_s32_t *)params->denomPtr;
+    const int32_t *data = (const int32_t *)params->data;
+    int32_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        for (i = 0; i < GEN_DIVISORS; i++) {
+            sum += data[iter + i] / gen->d[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_gen_each(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_s32_t *gen = (struct gen_s32_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        for (i = 0; i < GEN_DIVISORS; i++) {
+            gen->denom[i] = libdivide_s32_gen(gen->d[i]);
+        }
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint32_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_gen_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_s32_t *gen = (struct gen_s32_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_s32_gen_array(gen->d, gen->denom, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint32_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_gen_array_soa(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_s32_t *gen = (struct gen_s32_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_s32_gen_array_soa(gen->d, gen->magic, gen->more, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint32_t)gen->magic[i] + gen->more[i];
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s32_read(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_s32_t *gen = (struct gen_s32_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_s32_deserialize(gen->serial.buf, gen->serial.size, gen->denom, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint32_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+/* The dividers are only read, and the mapping is gone by the next pass, so the sum is taken each time */
+NOINLINE static uint64_t mine_s32_view(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct gen_s32_t *gen = (const struct gen_s32_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        const void *mapped = serial_map(&gen->serial);
+        size_t n = 0;
+        const struct libdivide_s32_t *denom = libdivide_s32_view(mapped, gen->serial.size, &n);
+        sum = 0;
+        for (i = 0; i < n; i++) {
+            sum += (uint32_t)denom[i].magic + denom[i].more;
+        }
+        serial_unmap(&gen->serial, mapped);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_u64_gen(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct gen_u64_t *gen = (const struct gen_u64_t *)params->denomPtr;
+    const uint64_t *data = (const uint64_t *)params->data;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        for (i = 0; i < GEN_DIVISORS; i++) {
+            sum += data[iter + i] / gen->d[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_gen_each(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_u64_t *gen = (struct gen_u64_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        for (i = 0; i < GEN_DIVISORS; i++) {
+            gen->denom[i] = libdivide_u64_gen(gen->d[i]);
+        }
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint64_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_gen_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_u64_t *gen = (struct gen_u64_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_u64_gen_array(gen->d, gen->denom, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint64_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_gen_array_soa(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_u64_t *gen = (struct gen_u64_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_u64_gen_array_soa(gen->d, gen->magic, gen->more, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint64_t)gen->magic[i] + gen->more[i];
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_u64_read(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_u64_t *gen = (struct gen_u64_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_u64_deserialize(gen->serial.buf, gen->serial.size, gen->denom, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint64_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+/* The dividers are only read, and the mapping is gone by the next pass, so the sum is taken each time */
+NOINLINE static uint64_t mine_u64_view(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct gen_u64_t *gen = (const struct gen_u64_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        const void *mapped = serial_map(&gen->serial);
+        size_t n = 0;
+        const struct libdivide_u64_t *denom = libdivide_u64_view(mapped, gen->serial.size, &n);
+        sum = 0;
+        for (i = 0; i < n; i++) {
+            sum += (uint64_t)denom[i].magic + denom[i].more;
+        }
+        serial_unmap(&gen->serial, mapped);
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t his_s64_gen(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct gen_s64_t *gen = (const struct gen_s64_t *)params->denomPtr;
+    const int64_t *data = (const int64_t *)params->data;
+    int64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        for (i = 0; i < GEN_DIVISORS; i++) {
+            sum += data[iter + i] / gen->d[i];
+        }
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_gen_each(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_s64_t *gen = (struct gen_s64_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        for (i = 0; i < GEN_DIVISORS; i++) {
+            gen->denom[i] = libdivide_s64_gen(gen->d[i]);
+        }
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint64_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_gen_array(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_s64_t *gen = (struct gen_s64_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_s64_gen_array(gen->d, gen->denom, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint64_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_gen_array_soa(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_s64_t *gen = (struct gen_s64_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_s64_gen_array_soa(gen->d, gen->magic, gen->more, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint64_t)gen->magic[i] + gen->more[i];
+    }
+    return sum;
+}
+
+NOINLINE static uint64_t mine_s64_read(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    struct gen_s64_t *gen = (struct gen_s64_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        libdivide_s64_deserialize(gen->serial.buf, gen->serial.size, gen->denom, GEN_DIVISORS);
+    }
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        sum += (uint64_t)gen->denom[i].magic + gen->denom[i].more;
+    }
+    return sum;
+}
+
+/* The dividers are only read, and the mapping is gone by the next pass, so the sum is taken each time */
+NOINLINE static uint64_t mine_s64_view(struct FunctionParams_t *params) {
+    unsigned iter, i;
+    const struct gen_s64_t *gen = (const struct gen_s64_t *)params->denomPtr;
+    uint64_t sum = 0;
+    for (iter = 0; iter < GEN_ITERATIONS; iter += GEN_DIVISORS) {
+        const void *mapped = serial_map(&gen->serial);
+        size_t n = 0;
+        const struct libdivide_s64_t *denom = libdivide_s64_view(mapped, gen->serial.size, &n);
+        sum = 0;
+        for (i = 0; i < n; i++) {
+            sum += (uint64_t)denom[i].magic + denom[i].more;
+        }
+        serial_unmap(&gen->serial, mapped);
+    }
+    return sum;
+}
+
+enum Tests {
+    kBaseTest,
+    kUnswitchedBaseTest,
+    kVec64Test,
+    kVec128Test,
+    kVec256Test,
+    kVec512Test,
+    kUnswitchedVec64Test,
+    kUnswitchedVec128Test,
+    kUnswitchedVec256Test,
+    kUnswitchedVec512Test,
+    kArrayTest,
+    kModTest,
+    kVec64ModTest,
+    kVec128ModTest,
+    kVec256ModTest,
+    kVec512ModTest,
+    kFastmodTest,
+    kVec128FastmodTest,
+    kVec256FastmodTest,
+    kFastmodArrayTest,
+    kIsDivisibleTest,
+    kVec64IsDivisibleTest,
+    kVec128IsDivisibleTest,
+    kVec256IsDivisibleTest,
+    kVec512IsDivisibleTest,
+    kExactTest,
+    kVec64ExactTest,
+    kVec128ExactTest,
+    kVec256ExactTest,
+    kVec512ExactTest,
+    kFloorTest,
+    kVec64FloorTest,
+    kVec128FloorTest,
+    kVec256FloorTest,
+    kVec512FloorTest,
+    kUnswitchedFloorTest,
+    kEuclidTest,
+    kVec64EuclidTest,
+    kVec128EuclidTest,
+    kVec256EuclidTest,
+    kVec512EuclidTest,
+    kCeilTest,
+    kVec64CeilTest,
+    kVec128CeilTest,
+    kVec256CeilTest,
+    kVec512CeilTest,
+    kCeilArrayTest,
+    kRoundTest,
+    kVec64RoundTest,
+    kVec128RoundTest,
+    kVec256RoundTest,
+    kVec512RoundTest,
+    kRoundArrayTest,
+    kNarrowTest,
+    kVec256NarrowTest,
+    kVec512NarrowTest,
+    kNarrowArrayTest,
+    kBranchfreeTest,
+    kVec128BranchfreeTest,
+    kVec256BranchfreeTest,
+    kVec512BranchfreeTest,
+    kBranchfreeArrayTest,
+    kNumTests
+};
+
+const char *strTests[kNumTests] = {
+    "scalar",
+    "scl_us",
+    "v64",
+    "v128",
+    "v256",
+    "v512",
+    "v64_us",
+    "v128_us",
+    "v256_us",
+    "v512_us",
+    "array",
+    "mod",
+    "v64_mod",
+    "v128_mod",
+    "v256_mod",
+    "v512_mod",
+    "fastmod",
+    "v128_fm",
+    "v256_fm",
+    "fm_arr",
+    "is_div",
+    "v64_div",
+    "v128_div",
+    "v256_div",
+    "v512_div",
+    "exact",
+    "v64_ex",
+    "v128_ex",
+    "v256_ex",
+    "v512_ex",
+    "floor",
+    "v64_fl",
+    "v128_fl",
+    "v256_fl",
+    "v512_fl",
+    "fl_us",
+    "euclid",
+    "v64_eu",
+    "v128_eu",
+    "v256_eu",
+    "v512_eu",
+    "ceil",
+    "v64_ce",
+    "v128_ce",
+    "v256_ce",
+    "v512_ce",
+    "ce_arr",
+    "round",
+    "v64_rn",
+    "v128_rn",
+    "v256_rn",
+    "v512_rn",
+    "rn_arr",
+    "narrow",
+    "v256_nw",
+    "v512_nw",
+    "nw_arr",
+    "bfree",
+    "v128_bf",
+    "v256_bf",
+    "v512_bf",
+    "bf_arr"
+};
+
+struct TestResult {
+    double times[kNumTests];
+    double gen_time;
+    double lookup_time;
+    double his_time;
+    double his_mod_time;
+    double his_div_time;
+    double his_exact_time;
+    double his_floor_time;
+    double his_euclid_time;
+    double his_ceil_time;
+    double his_round_time;
+    double his_narrow_time;
+    int algo;
+};
+
+static uint64_t find_min(const uint64_t *vals, size_t cnt) {
+    uint64_t result = vals[0];
+    size_t i;
+    for (i=1; i < cnt; i++) {
+        if (vals[i] < result) result = vals[i];
+    }
+    return result;
+}
+
+typedef uint64_t (*TestFunc_t)(struct FunctionParams_t *params);
+
+struct TestFuncs {
+    TestFunc_t funcs[kNumTests];
+    TestFunc_t generate;
+    TestFunc_t lookup;
+    TestFunc_t his;
+    TestFunc_t his_mod;
+    TestFunc_t his_div;
+    TestFunc_t his_exact;
+    TestFunc_t his_floor;
+    TestFunc_t his_euclid;
+    TestFunc_t his_ceil;
+    TestFunc_t his_round;
+    TestFunc_t his_narrow;
+};
+
+NOINLINE struct TestResult test_one(struct TestFuncs *funcs, struct FunctionParams_t *params) {
+#define TEST_COUNT 3
+    struct TestResult result;
+    memset(&result, 0, sizeof result);
+
+#define CHECK(actual, expected) do { if (1 && actual != expected) printf("Failure on line %lu\n", (unsigned long)__LINE__); } while (0)
+
+    uint64_t my_times[kNumTests][TEST_COUNT], his_times[TEST_COUNT], his_mod_times[TEST_COUNT], his_div_times[TEST_COUNT], his_exact_times[TEST_COUNT], his_floor_times[TEST_COUNT], his_euclid_times[TEST_COUNT], his_ceil_times[TEST_COUNT], his_round_times[TEST_COUNT], his_narrow_times[TEST_COUNT], gen_times[TEST_COUNT], lookup_times[TEST_COUNT];
+    unsigned iter, test;
+    struct time_result tresult;
+    for (iter = 0; iter < TEST_COUNT; iter++) {
+        tresult = time_function(funcs->his, params); his_times[iter] = tresult.time; const uint64_t expected = tresult.result;
+        tresult = time_function(funcs->his_mod, params); his_mod_times[iter] = tresult.time; const uint64_t expected_mod = tresult.result;
+        tresult = time_function(funcs->his_div, params); his_div_times[iter] = tresult.time; const uint64_t expected_div = tresult.result;
+        tresult = time_function(funcs->his_exact, params); his_exact_times[iter] = tresult.time; const uint64_t expected_exact = tresult.result;
+        tresult = time_function(funcs->his_floor, params); his_floor_times[iter] = tresult.time; const uint64_t expected_floor = tresult.result;
+        tresult = time_function(funcs->his_euclid, params); his_euclid_times[iter] = tresult.time; const uint64_t expected_euclid = tresult.result;
+        tresult = time_function(funcs->his_ceil, params); his_ceil_times[iter] = tresult.time; const uint64_t expected_ceil = tresult.result;
+        tresult = time_function(funcs->his_round, params); his_round_times[iter] = tresult.time; const uint64_t expected_round = tresult.result;
+        tresult = time_function(funcs->his_narrow, params); his_narrow_times[iter] = tresult.time; const uint64_t expected_narrow = tresult.result;
+        for (test = 0; test < kNumTests; test++) {
+            if (funcs->funcs[test]) {
+                const uint64_t expected_test = test >= kBranchfreeTest ? expected : test >= kNarrowTest ? expected_narrow : test >= kRoundTest ? expected_round : test >= kCeilTest ? expected_ceil : test >= kEuclidTest ? expected_euclid : test >= kFloorTest ? expected_floor : test >= kExactTest ? expected_exact : test >= kIsDivisibleTest ? expected_div : test >= kModTest ? expected_mod : expected;
+                tresult = time_function(funcs->funcs[test], params); my_times[test][iter] = tresult.time; CHECK(tresult.result, expected_test);
+            } else {
+                my_times[test][iter] = 0;
+            }
+        }
+        tresult = time_function(funcs->generate, params); gen_times[iter] = tresult.time;
+        if (funcs->lookup) {
+            tresult = time_function(funcs->lookup, params); lookup_times[iter] = tresult.time;
+        } else {
+            lookup_times[iter] = 0;
+        }
+    }
+
+    result.his_time = find_min(his_times, TEST_COUNT) / (double)ITERATIONS;
+    result.his_mod_time = find_min(his_mod_times, TEST_COUNT) / (double)ITERATIONS;
+    result.his_div_time = find_min(his_div_times, TEST_COUNT) / (double)ITERATIONS;
+    result.his_exact_time = find_min(his_exact_times, TEST_COUNT) / (double)ITERATIONS;
+    result.his_floor_time = find_min(his_floor_times, TEST_COUNT) / (double)ITERATIONS;
+    result.his_euclid_time = find_min(his_euclid_times, TEST_COUNT) / (double)ITERATIONS;
+    result.his_ceil_time = find_min(his_ceil_times, TEST_COUNT) / (double)ITERATIONS;
+    result.his_round_time = find_min(his_round_times, TEST_COUNT) / (double)ITERATIONS;
+    result.his_narrow_time = find_min(his_narrow_times, TEST_COUNT) / (double)ITERATIONS;
+    result.gen_time = find_min(gen_times, TEST_COUNT) / (double)GEN_ITERATIONS;
+    result.lookup_time = find_min(lookup_times, TEST_COUNT) / (double)GEN_ITERATIONS;
+
+    for (test = 0; test < kNumTests; test++) {
+        result.times[test] = find_min(my_times[test], TEST_COUNT) / (double)ITERATIONS;
+    }
+    return result;
+#undef TEST_COUNT
+}
+
+NOINLINE struct TestResult test_one_u8(uint8_t d, const uint8_t *data) {
+    struct libdivide_u8_t div_struct = libdivide_u8_gen(d);
+    struct FunctionParams_t params;
+    params.d = &d;
+    params.denomPtr = &div_struct;
+    params.data = data;
+    params.multiples = NULL;
+
+    /* Only division and the array function are provided at 8 bits, so every other column stays empty */
+    struct TestFuncs funcs;
+    memset(&funcs, 0, sizeof funcs);
+    funcs.funcs[kBaseTest] = mine_u8;
+    funcs.funcs[kVec64Test] = FUNC_VECTOR64(mine_8u8_vector);
+    funcs.funcs[kVec128Test] = FUNC_VECTOR128(mine_16u8_vector);
+    funcs.funcs[kVec256Test] = FUNC_VECTOR256(mine_32u8_vector);
+    funcs.funcs[kVec512Test] = FUNC_VECTOR512(mine_64u8_vector);
+    funcs.funcs[kUnswitchedBaseTest] = mine_u8_unswitched;
+    funcs.funcs[kUnswitchedVec64Test] = FUNC_VECTOR64(mine_8u8_vector_unswitched);
+    funcs.funcs[kUnswitchedVec128Test] = FUNC_VECTOR128(mine_16u8_vector_unswitched);
+    funcs.funcs[kUnswitchedVec256Test] = FUNC_VECTOR256(mine_32u8_vector_unswitched);
+    funcs.funcs[kUnswitchedVec512Test] = FUNC_VECTOR512(mine_64u8_vector_unswitched);
+    funcs.funcs[kArrayTest] = mine_u8_array;
+    funcs.his = his_u8;
+    funcs.generate = mine_u8_generate;
+
+    struct TestResult result = test_one(&funcs, &params);
+    result.algo = libdivide_u8_get_algorithm(&div_struct);
+    return result;
+}
+
+NOINLINE struct TestResult test_one_s8(int8_t d, const int8_t *data) {
+    struct libdivide_s8_t div_struct = libdivide_s8_gen(d);
+    struct FunctionParams_t params;
+    params.d = &d;
+    params.denomPtr = &div_struct;
+    params.data = data;
+    params.multiples = NULL;
+
+    /* Only division and the array function are provided at 8 bits, so every other column stays empty */
+    struct TestFuncs funcs;
+    memset(&funcs, 0, sizeof funcs);
+    funcs.funcs[kBaseTest] = mine_s8;
+    funcs.funcs[kVec64Test] = FUNC_VECTOR64(mine_8s8_vector);
+    funcs.funcs[kVec128Test] = FUNC_VECTOR128(mine_16s8_vector);
+    funcs.funcs[kVec256Test] = FUNC_VECTOR256(mine_32s8_vector);
+    funcs.funcs[kVec512Test] = FUNC_VECTOR512(mine_64s8_vector);
+    funcs.funcs[kUnswitchedBaseTest] = mine_s8_unswitched;
+    funcs.funcs[kUnswitchedVec64Test] = FUNC_VECTOR64(mine_8s8_vector_unswitched);
+    funcs.funcs[kUnswitchedVec128Test] = FUNC_VECTOR128(mine_16s8_vector_unswitched);
+    funcs.funcs[kUnswitchedVec256Test] = FUNC_VECTOR256(mine_32s8_vector_unswitched);
+    funcs.funcs[kUnswitchedVec512Test] = FUNC_VECTOR512(mine_64s8_vector_unswitched);
+    funcs.funcs[kArrayTest] = mine_s8_array;
+    funcs.his = his_s8;
+    funcs.generate = mine_s8_generate;
+
+    struct TestResult result = test_one(&funcs, &params);
+    result.algo = libdivide_s8_get_algorithm(&div_struct);
+    return result;
+}
+
+NOINLINE struct TestResult test_one_u16(uint16_t d, const uint16_t *data) {
+    struct libdivide_u16_t div_struct = libdivide_u16_gen(d);
+    struct FunctionParams_t params;
+    params.d = &d;
+    params.denomPtr = &div_struct;
+    params.data = data;
+    params.multiples = NULL;
+
+    /* Only division is provided at 16 bits, so every other column stays empty */
+    struct TestFuncs funcs;
+    memset(&funcs, 0, sizeof funcs);
+    funcs.funcs[kBaseTest] = mine_u16;
+    funcs.funcs[kVec64Test] = FUNC_VECTOR64(mine_4u16_vector);
+    funcs.funcs[kVec128Test] = FUNC_VECTOR128(mine_8u16_vector);
+    funcs.funcs[kVec256Test] = FUNC_VECTOR256(mine_16u16_vector);
+    funcs.funcs[kVec512Test] = FUNC_VECTOR512(mine_32u16_vector);
+    funcs.funcs[kUnswitchedBaseTest] = mine_u16_unswitched;
+    funcs.funcs[kUnswitchedVec64Test] = FUNC_VECTOR64(mine_4u16_vector_unswitched);
+    funcs.funcs[kUnswitchedVec128Test] = FUNC_VECTOR128(mine_8u16_vector_unswitched);
+    funcs.funcs[kUnswitchedVec256Test] = FUNC_VECTOR256(mine_16u16_vector_unswitched);
+    funcs.funcs[kUnswitchedVec512Test] = FUNC_VECTOR512(mine_32u16_vector_unswitched);
+    funcs.his = his_u16;
+    funcs.generate = mine_u16_generate;
+
+    struct TestResult result = test_one(&funcs, &params);
+    result.algo = libdivide_u16_get_algorithm(&div_struct);
+    return result;
+}
+
+NOINLINE struct TestResult test_one_s16(int16_t d, const int16_t *data) {
+    struct libdivide_s16_t div_struct = libdivide_s16_gen(d);
+    struct FunctionParams_t params;
+    params.d = &d;
+    params.denomPtr = &div_struct;
+    params.data = data;
+    params.multiples = NULL;
+
+    /* Only division is provided at 16 bits, so every other column stays empty */
+    struct TestFuncs funcs;
+    memset(&funcs, 0, sizeof funcs);
+    funcs.funcs[kBaseTest] = mine_s16;
+    funcs.funcs[kVec64Test] = FUNC_VECTOR64(mine_4s16_vector);
+    funcs.funcs[kVec128Test] = FUNC_VECTOR128(mine_8s16_vector);
+    funcs.funcs[kVec256Test] = FUNC_VECTOR256(mine_16s16_vector);
+    funcs.funcs[kVec512Test] = FUNC_VECTOR512(mine_32s16_vector);
+    funcs.funcs[kUnswitchedBaseTest] = mine_s16_unswitched;
+    funcs.funcs[kUnswitchedVec64Test] = FUNC_VECTOR64(mine_4s16_vector_unswitched);
+    funcs.funcs[kUnswitchedVec128Test] = FUNC_VECTOR128(mine_8s16_vector_unswitched);
+    funcs.funcs[kUnswitchedVec256Test] = FUNC_VECTOR256(mine_16s16_vector_unswitched);
+    funcs.funcs[kUnswitchedVec512Test] = FUNC_VECTOR512(mine_32s16_vector_unswitched);
+    funcs.his = his_s16;
+    funcs.generate = mine_s16_generate;
+
+    struct TestResult result = test_one(&funcs, &params);
+    result.algo = libdivide_s16_get_algorithm(&div_struct);
+    return result;
+}
+
+#if HAS_INT128_T
+NOINLINE struct TestResult test_one_u128(__uint128_t d, const __uint128_t *data) {
+    struct libdivide_u128_t div_struct = libdivide_u128_gen(d);
+    struct FunctionParams_t params;
+    params.d = &d;
+    params.denomPtr = &div_struct;
+    params.data = data;
+    params.multiples = NULL;
+
+    /* Only scalar division is provided at 128 bits, so every other column stays empty */
+    struct TestFuncs funcs;
+    memset(&funcs, 0, sizeof funcs);
+    funcs.funcs[kBaseTest] = mine_u128;
+    funcs.funcs[kUnswitchedBaseTest] = mine_u128_unswitched;
+    funcs.his = his_u128;
+    funcs.generate = mine_u128_generate;
+
+    struct TestResult result = test_one(&funcs, &params);
+    result.algo = libdivide_u128_get_algorithm(&div_struct);
+    return result;
+}
+
+NOINLINE struct TestResult test_one_s128(__int128_t d, const __int128_t *data) {
+    struct libdivide_s128_t div_struct = libdivide_s128_gen(d);
+    struct FunctionParams_t params;
+    params.d = &d;
+    params.denomPtr = &div_struct;
+    params.data = data;
+    params.multiples = NULL;
+
+    /* Only scalar division is provided at 128 bits, so every other column stays empty */
+    struct TestFuncs funcs;
+    memset(&funcs, 0, sizeof funcs);
+    funcs.funcs[kBaseTest] = mine_s128;
+    funcs.funcs[kUnswitchedBaseTest] = mine_s128_unswitched;
+    funcs.his = his_s128;
+    funcs.generate = mine_s128_generate;
+
+    struct TestResult result = test_one(&funcs, &params);
+    result.algo = libdivide_s128_get_algorithm(&div_struct);
+    return result;
+}
+
+#endif
+
+NOINLINE struct TestResult test_one_u32(uint32_t d, const uint32_t *data, uint32_t *multiples) {
+    unsigned i;
+    for (i = 0; i < ITERATIONS; i++) {
+        multiples[i] = data[i] - data[i] % d;
+    }
+    struct libdivide_u32_t div_struct = libdivide_u32_gen(d);
+    struct FunctionParams_t params;
+    params.d = &d;
+    params.denomPtr = &div_struct;
+    params.data = data;
+    params.multiples = multiples;
+
     struct TestFuncs funcs;
     funcs.funcs[kBaseTest] = mine_u32;
     funcs.funcs[kVec64Test] = FUNC_VECTOR64(mine_2u32_vector);
     funcs.funcs[kVec128Test] = FUNC_VECTOR128(mine_4u32_vector);
     funcs.funcs[kVec256Test] = FUNC_VECTOR256(mine_8u32_vector);
+    funcs.funcs[kVec512Test] = FUNC_VECTOR512(mine_16u32_vector);
     funcs.funcs[kUnswitchedBaseTest] = mine_u32_unswitched;
     funcs.funcs[kUnswitchedVec64Test] = FUNC_VECTOR64(mine_2u32_vector_unswitched);
     funcs.funcs[kUnswitchedVec128Test] = FUNC_VECTOR128(mine_4u32_vector_unswitched);
     funcs.funcs[kUnswitchedVec256Test] = FUNC_VECTOR256(mine_8u32_vector_unswitched);
+    funcs.funcs[kUnswitchedVec512Test] = FUNC_VECTOR512(mine_16u32_vector_unswitched);
+    funcs.funcs[kArrayTest] = mine_u32_array;
+    funcs.funcs[kModTest] = mine_u32_mod;
+    funcs.funcs[kVec64ModTest] = FUNC_VECTOR64(mine_2u32_vector_mod);
+    funcs.funcs[kVec128ModTest] = FUNC_VECTOR128(mine_4u32_vector_mod);
+    funcs.funcs[kVec256ModTest] = FUNC_VECTOR256(mine_8u32_vector_mod);
+    funcs.funcs[kVec512ModTest] = FUNC_VECTOR512(mine_16u32_vector_mod);
+    funcs.funcs[kFastmodTest] = mine_u32_fastmod;
+    funcs.funcs[kVec128FastmodTest] = FUNC_FASTMOD128(mine_4u32_fastmod_vector);
+    funcs.funcs[kVec256FastmodTest] = FUNC_FASTMOD256(mine_8u32_fastmod_vector);
+    funcs.funcs[kFastmodArrayTest] = mine_u32_fastmod_array;
     funcs.his = his_u32;
+    funcs.funcs[kIsDivisibleTest] = mine_u32_divisible;
+    funcs.funcs[kVec64IsDivisibleTest] = FUNC_VECTOR64(mine_2u32_divisible_vector);
+    funcs.funcs[kVec128IsDivisibleTest] = FUNC_VECTOR128(mine_4u32_divisible_vector);
+    funcs.funcs[kVec256IsDivisibleTest] = FUNC_VECTOR256(mine_8u32_divisible_vector);
+    funcs.funcs[kVec512IsDivisibleTest] = FUNC_VECTOR512(mine_16u32_divisible_vector);
+    funcs.his_mod = his_u32_mod;
+    funcs.his_div = his_u32_divisible;
+    funcs.funcs[kExactTest] = mine_u32_exact;
+    funcs.funcs[kVec64ExactTest] = FUNC_VECTOR64(mine_2u32_exact_vector);
+    funcs.funcs[kVec128ExactTest] = FUNC_VECTOR128(mine_4u32_exact_vector);
+    funcs.funcs[kVec256ExactTest] = FUNC_VECTOR256(mine_8u32_exact_vector);
+    funcs.funcs[kVec512ExactTest] = FUNC_VECTOR512(mine_16u32_exact_vector);
+    funcs.his_exact = his_u32_exact;
+    funcs.funcs[kFloorTest] = NULL;
+    funcs.funcs[kVec64FloorTest] = NULL;
+    funcs.funcs[kVec128FloorTest] = NULL;
+    funcs.funcs[kVec256FloorTest] = NULL;
+    funcs.funcs[kVec512FloorTest] = NULL;
+    funcs.funcs[kUnswitchedFloorTest] = NULL;
+    funcs.funcs[kEuclidTest] = NULL;
+    funcs.funcs[kVec64EuclidTest] = NULL;
+    funcs.funcs[kVec128EuclidTest] = NULL;
+    funcs.funcs[kVec256EuclidTest] = NULL;
+    funcs.funcs[kVec512EuclidTest] = NULL;
+    funcs.his_floor = his_u32; //unsigned division already floors
+    funcs.his_euclid = his_u32_mod; //and its remainders are never negative
+    funcs.funcs[kCeilTest] = mine_u32_ceil;
+    funcs.funcs[kVec64CeilTest] = FUNC_VECTOR64(mine_2u32_ceil_vector);
+    funcs.funcs[kVec128CeilTest] = FUNC_VECTOR128(mine_4u32_ceil_vector);
+    funcs.funcs[kVec256CeilTest] = FUNC_VECTOR256(mine_8u32_ceil_vector);
+    funcs.funcs[kVec512CeilTest] = FUNC_VECTOR512(mine_16u32_ceil_vector);
+    funcs.funcs[kCeilArrayTest] = mine_u32_ceil_array;
+    funcs.his_ceil = his_u32_ceil;
+    funcs.funcs[kRoundTest] = mine_u32_round;
+    funcs.funcs[kVec64RoundTest] = FUNC_VECTOR64(mine_2u32_round_vector);
+    funcs.funcs[kVec128RoundTest] = FUNC_VECTOR128(mine_4u32_round_vector);
+    funcs.funcs[kVec256RoundTest] = FUNC_VECTOR256(mine_8u32_round_vector);
+    funcs.funcs[kVec512RoundTest] = FUNC_VECTOR512(mine_16u32_round_vector);
+    funcs.funcs[kRoundArrayTest] = mine_u32_round_array;
+    funcs.his_round = his_u32_round;
+    funcs.funcs[kNarrowTest] = NULL;
+    funcs.funcs[kVec256NarrowTest] = NULL;
+    funcs.funcs[kVec512NarrowTest] = NULL;
+    funcs.funcs[kNarrowArrayTest] = NULL;
+    funcs.his_narrow = NULL;
+    /* The unsigned branchfree dividers can't divide by 1 */
+    funcs.funcs[kBranchfreeTest] = d > 1 ? mine_u32_branchfree : NULL;
+    funcs.funcs[kVec128BranchfreeTest] = d > 1 ? FUNC_BRANCHFREE128(mine_4u32_branchfree_vector) : NULL;
+    funcs.funcs[kVec256BranchfreeTest] = d > 1 ? FUNC_BRANCHFREE256(mine_8u32_branchfree_vector) : NULL;
+    funcs.funcs[kVec512BranchfreeTest] = d > 1 ? FUNC_BRANCHFREE512(mine_16u32_branchfree_vector) : NULL;
+    funcs.funcs[kBranchfreeArrayTest] = d > 1 ? mine_u32_branchfree_array : NULL;
     funcs.generate = mine_u32_generate;
+    funcs.lookup = mine_u32_lookup;
 
     struct TestResult result = test_one(&funcs, &params);
     result.algo = libdivide_u32_get_algorithm(&div_struct);
     return result;
 }
 
-NOINLINE struct TestResult test_one_s32(int32_t d, const int32_t *data) {
+NOINLINE struct TestResult test_one_s32(int32_t d, const int32_t *data, int32_t *multiples) {
+    unsigned i;
+    for (i = 0; i < ITERATIONS; i++) {
+        multiples[i] = data[i] - data[i] % d;
+    }
     struct libdivide_s32_t div_struct = libdivide_s32_gen(d);
     struct FunctionParams_t params;
     params.d = &d;
     params.denomPtr = &div_struct;
     params.data = data;
+    params.multiples = multiples;
 
     struct TestFuncs funcs;
     funcs.funcs[kBaseTest] = mine_s32;
     funcs.funcs[kVec64Test] = FUNC_VECTOR64(mine_2s32_vector);
     funcs.funcs[kVec128Test] = FUNC_VECTOR128(mine_4s32_vector);
     funcs.funcs[kVec256Test] = FUNC_VECTOR256(mine_8s32_vector);
+    funcs.funcs[kVec512Test] = FUNC_VECTOR512(mine_16s32_vector);
     funcs.funcs[kUnswitchedBaseTest] = mine_s32_unswitched;
     funcs.funcs[kUnswitchedVec64Test] = FUNC_VECTOR64(mine_2s32_vector_unswitched);
     funcs.funcs[kUnswitchedVec128Test] = FUNC_VECTOR128(mine_4s32_vector_unswitched);
     funcs.funcs[kUnswitchedVec256Test] = FUNC_VECTOR256(mine_8s32_vector_unswitched);
+    funcs.funcs[kUnswitchedVec512Test] = FUNC_VECTOR512(mine_16s32_vector_unswitched);
+    funcs.funcs[kArrayTest] = mine_s32_array;
+    funcs.funcs[kModTest] = mine_s32_mod;
+    funcs.funcs[kVec64ModTest] = FUNC_VECTOR64(mine_2s32_vector_mod);
+    funcs.funcs[kVec128ModTest] = FUNC_VECTOR128(mine_4s32_vector_mod);
+    funcs.funcs[kVec256ModTest] = FUNC_VECTOR256(mine_8s32_vector_mod);
+    funcs.funcs[kVec512ModTest] = FUNC_VECTOR512(mine_16s32_vector_mod);
+    funcs.funcs[kFastmodTest] = NULL;
+    funcs.funcs[kVec128FastmodTest] = NULL;
+    funcs.funcs[kVec256FastmodTest] = NULL;
+    funcs.funcs[kFastmodArrayTest] = NULL;
     funcs.his = his_s32;
+    funcs.funcs[kIsDivisibleTest] = mine_s32_divisible;
+    funcs.funcs[kVec64IsDivisibleTest] = FUNC_VECTOR64(mine_2s32_divisible_vector);
+    funcs.funcs[kVec128IsDivisibleTest] = FUNC_VECTOR128(mine_4s32_divisible_vector);
+    funcs.funcs[kVec256IsDivisibleTest] = FUNC_VECTOR256(mine_8s32_divisible_vector);
+    funcs.funcs[kVec512IsDivisibleTest] = FUNC_VECTOR512(mine_16s32_divisible_vector);
+    funcs.his_mod = his_s32_mod;
+    funcs.his_div = his_s32_divisible;
+    funcs.funcs[kExactTest] = mine_s32_exact;
+    funcs.funcs[kVec64ExactTest] = FUNC_VECTOR64(mine_2s32_exact_vector);
+    funcs.funcs[kVec128ExactTest] = FUNC_VECTOR128(mine_4s32_exact_vector);
+    funcs.funcs[kVec256ExactTest] = FUNC_VECTOR256(mine_8s32_exact_vector);
+    funcs.funcs[kVec512ExactTest] = FUNC_VECTOR512(mine_16s32_exact_vector);
+    funcs.his_exact = his_s32_exact;
+    funcs.funcs[kFloorTest] = mine_s32_floor;
+    funcs.funcs[kVec64FloorTest] = FUNC_VECTOR64(mine_2s32_floor_vector);
+    funcs.funcs[kVec128FloorTest] = FUNC_VECTOR128(mine_4s32_floor_vector);
+    funcs.funcs[kVec256FloorTest] = FUNC_VECTOR256(mine_8s32_floor_vector);
+    funcs.funcs[kVec512FloorTest] = FUNC_VECTOR512(mine_16s32_floor_vector);
+    funcs.his_floor = his_s32_floor;
+    funcs.funcs[kUnswitchedFloorTest] = mine_s32_floor_unswitched;
+    funcs.funcs[kEuclidTest] = mine_s32_euclid;
+    funcs.funcs[kVec64EuclidTest] = FUNC_VECTOR64(mine_2s32_euclid_vector);
+    funcs.funcs[kVec128EuclidTest] = FUNC_VECTOR128(mine_4s32_euclid_vector);
+    funcs.funcs[kVec256EuclidTest] = FUNC_VECTOR256(mine_8s32_euclid_vector);
+    funcs.funcs[kVec512EuclidTest] = FUNC_VECTOR512(mine_16s32_euclid_vector);
+    funcs.his_euclid = his_s32_euclid;
+    funcs.funcs[kCeilTest] = mine_s32_ceil;
+    funcs.funcs[kVec64CeilTest] = FUNC_VECTOR64(mine_2s32_ceil_vector);
+    funcs.funcs[kVec128CeilTest] = FUNC_VECTOR128(mine_4s32_ceil_vector);
+    funcs.funcs[kVec256CeilTest] = FUNC_VECTOR256(mine_8s32_ceil_vector);
+    funcs.funcs[kVec512CeilTest] = FUNC_VECTOR512(mine_16s32_ceil_vector);
+    funcs.funcs[kCeilArrayTest] = mine_s32_ceil_array;
+    funcs.his_ceil = his_s32_ceil;
+    funcs.funcs[kRoundTest] = mine_s32_round;
+    funcs.funcs[kVec64RoundTest] = FUNC_VECTOR64(mine_2s32_round_vector);
+    funcs.funcs[kVec128RoundTest] = FUNC_VECTOR128(mine_4s32_round_vector);
+    funcs.funcs[kVec256RoundTest] = FUNC_VECTOR256(mine_8s32_round_vector);
+    funcs.funcs[kVec512RoundTest] = FUNC_VECTOR512(mine_16s32_round_vector);
+    funcs.funcs[kRoundArrayTest] = mine_s32_round_array;
+    funcs.his_round = his_s32_round;
+    funcs.funcs[kNarrowTest] = NULL;
+    funcs.funcs[kVec256NarrowTest] = NULL;
+    funcs.funcs[kVec512NarrowTest] = NULL;
+    funcs.funcs[kNarrowArrayTest] = NULL;
+    funcs.his_narrow = NULL;
+    funcs.funcs[kBranchfreeTest] = mine_s32_branchfree;
+    funcs.funcs[kVec128BranchfreeTest] = FUNC_BRANCHFREE128(mine_4s32_branchfree_vector);
+    funcs.funcs[kVec256BranchfreeTest] = FUNC_BRANCHFREE256(mine_8s32_branchfree_vector);
+    funcs.funcs[kVec512BranchfreeTest] = FUNC_BRANCHFREE512(mine_16s32_branchfree_vector);
+    funcs.funcs[kBranchfreeArrayTest] = mine_s32_branchfree_array;
     funcs.generate = mine_s32_generate;
+    funcs.lookup = mine_s32_lookup;
 
     struct TestResult result = test_one(&funcs, &params);
     result.algo = libdivide_s32_get_algorithm(&div_struct);
     return result;
 }
 
-NOINLINE struct TestResult test_one_u64(uint64_t d, const uint64_t *data) {
+NOINLINE struct TestResult test_one_u64(uint64_t d, const uint64_t *data, uint64_t *multiples) {
+    unsigned i;
+    for (i = 0; i < ITERATIONS; i++) {
+        multiples[i] = data[i] - data[i] % d;
+    }
     struct libdivide_u64_t div_struct = libdivide_u64_gen(d);
     struct FunctionParams_t params;
     params.d = &d;
     params.denomPtr = &div_struct;
     params.data = data;
+    params.multiples = multiples;
 
     struct TestFuncs funcs;
     funcs.funcs[kBaseTest] = mine_u64;
     funcs.funcs[kVec64Test] = FUNC_VECTOR64(mine_1u64_vector);
     funcs.funcs[kVec128Test] = FUNC_VECTOR128(mine_2u64_vector);
     funcs.funcs[kVec256Test] = FUNC_VECTOR256(mine_4u64_vector);
+    funcs.funcs[kVec512Test] = FUNC_VECTOR512(mine_8u64_vector);
     funcs.funcs[kUnswitchedBaseTest] = mine_u64_unswitched;
     funcs.funcs[kUnswitchedVec64Test] = FUNC_VECTOR64(mine_1u64_vector_unswitched);
     funcs.funcs[kUnswitchedVec128Test] = FUNC_VECTOR128(mine_2u64_vector_unswitched);
     funcs.funcs[kUnswitchedVec256Test] = FUNC_VECTOR256(mine_4u64_vector_unswitched);
+    funcs.funcs[kUnswitchedVec512Test] = FUNC_VECTOR512(mine_8u64_vector_unswitched);
+    funcs.funcs[kArrayTest] = mine_u64_array;
+    funcs.funcs[kModTest] = mine_u64_mod;
+    funcs.funcs[kVec64ModTest] = FUNC_VECTOR64(mine_1u64_vector_mod);
+    funcs.funcs[kVec128ModTest] = FUNC_VECTOR128(mine_2u64_vector_mod);
+    funcs.funcs[kVec256ModTest] = FUNC_VECTOR256(mine_4u64_vector_mod);
+    funcs.funcs[kVec512ModTest] = FUNC_VECTOR512(mine_8u64_vector_mod);
+    funcs.funcs[kFastmodTest] = mine_u64_fastmod;
+    funcs.funcs[kVec128FastmodTest] = FUNC_FASTMOD128(mine_2u64_fastmod_vector);
+    funcs.funcs[kVec256FastmodTest] = FUNC_FASTMOD256(mine_4u64_fastmod_vector);
+    funcs.funcs[kFastmodArrayTest] = mine_u64_fastmod_array;
     funcs.his = his_u64;
+    funcs.funcs[kIsDivisibleTest] = mine_u64_divisible;
+    funcs.funcs[kVec64IsDivisibleTest] = FUNC_VECTOR64(mine_1u64_divisible_vector);
+    funcs.funcs[kVec128IsDivisibleTest] = FUNC_VECTOR128(mine_2u64_divisible_vector);
+    funcs.funcs[kVec256IsDivisibleTest] = FUNC_VECTOR256(mine_4u64_divisible_vector);
+    funcs.funcs[kVec512IsDivisibleTest] = FUNC_VECTOR512(mine_8u64_divisible_vector);
+    funcs.his_mod = his_u64_mod;
+    funcs.his_div = his_u64_divisible;
+    funcs.funcs[kExactTest] = mine_u64_exact;
+    funcs.funcs[kVec64ExactTest] = FUNC_VECTOR64(mine_1u64_exact_vector);
+    funcs.funcs[kVec128ExactTest] = FUNC_VECTOR128(mine_2u64_exact_vector);
+    funcs.funcs[kVec256ExactTest] = FUNC_VECTOR256(mine_4u64_exact_vector);
+    funcs.funcs[kVec512ExactTest] = FUNC_VECTOR512(mine_8u64_exact_vector);
+    funcs.his_exact = his_u64_exact;
+    funcs.funcs[kFloorTest] = NULL;
+    funcs.funcs[kVec64FloorTest] = NULL;
+    funcs.funcs[kVec128FloorTest] = NULL;
+    funcs.funcs[kVec256FloorTest] = NULL;
+    funcs.funcs[kVec512FloorTest] = NULL;
+    funcs.funcs[kUnswitchedFloorTest] = NULL;
+    funcs.funcs[kEuclidTest] = NULL;
+    funcs.funcs[kVec64EuclidTest] = NULL;
+    funcs.funcs[kVec128EuclidTest] = NULL;
+    funcs.funcs[kVec256EuclidTest] = NULL;
+    funcs.funcs[kVec512EuclidTest] = NULL;
+    funcs.his_floor = his_u64; //unsigned division already floors
+    funcs.his_euclid = his_u64_mod; //and its remainders are never negative
+    funcs.funcs[kCeilTest] = mine_u64_ceil;
+    funcs.funcs[kVec64CeilTest] = FUNC_VECTOR64(mine_1u64_ceil_vector);
+    funcs.funcs[kVec128CeilTest] = FUNC_VECTOR128(mine_2u64_ceil_vector);
+    funcs.funcs[kVec256CeilTest] = FUNC_VECTOR256(mine_4u64_ceil_vector);
+    funcs.funcs[kVec512CeilTest] = FUNC_VECTOR512(mine_8u64_ceil_vector);
+    funcs.funcs[kCeilArrayTest] = mine_u64_ceil_array;
+    funcs.his_ceil = his_u64_ceil;
+    funcs.funcs[kRoundTest] = mine_u64_round;
+    funcs.funcs[kVec64RoundTest] = FUNC_VECTOR64(mine_1u64_round_vector);
+    funcs.funcs[kVec128RoundTest] = FUNC_VECTOR128(mine_2u64_round_vector);
+    funcs.funcs[kVec256RoundTest] = FUNC_VECTOR256(mine_4u64_round_vector);
+    funcs.funcs[kVec512RoundTest] = FUNC_VECTOR512(mine_8u64_round_vector);
+    funcs.funcs[kRoundArrayTest] = mine_u64_round_array;
+    funcs.his_round = his_u64_round;
+    funcs.funcs[kNarrowTest] = mine_u64_narrow;
+    funcs.funcs[kVec256NarrowTest] = FUNC_NARROW256(mine_4u64_narrow_vector);
+    funcs.funcs[kVec512NarrowTest] = FUNC_NARROW512(mine_8u64_narrow_vector);
+    funcs.funcs[kNarrowArrayTest] = mine_u64_narrow_array;
+    funcs.his_narrow = his_u64_narrow;
+    /* The unsigned branchfree dividers can't divide by 1 */
+    funcs.funcs[kBranchfreeTest] = d > 1 ? mine_u64_branchfree : NULL;
+    funcs.funcs[kVec128BranchfreeTest] = d > 1 ? FUNC_BRANCHFREE128(mine_2u64_branchfree_vector) : NULL;
+    funcs.funcs[kVec256BranchfreeTest] = d > 1 ? FUNC_BRANCHFREE256(mine_4u64_branchfree_vector) : NULL;
+    funcs.funcs[kVec512BranchfreeTest] = d > 1 ? FUNC_BRANCHFREE512(mine_8u64_branchfree_vector) : NULL;
+    funcs.funcs[kBranchfreeArrayTest] = d > 1 ? mine_u64_branchfree_array : NULL;
     funcs.generate = mine_u64_generate;
+    funcs.lookup = mine_u64_lookup;
 
     struct TestResult result = test_one(&funcs, &params);
     result.algo = libdivide_u64_get_algorithm(&div_struct);
     return result;
 }
 
-NOINLINE struct TestResult test_one_s64(int64_t d, const int64_t *data) {
+NOINLINE struct TestResult test_one_s64(int64_t d, const int64_t *data, int64_t *multiples) {
+    unsigned i;
+    for (i = 0; i < ITERATIONS; i++) {
+        multiples[i] = data[i] - data[i] % d;
+    }
     struct libdivide_s64_t div_struct = libdivide_s64_gen(d);
     struct FunctionParams_t params;
     params.d = &d;
     params.denomPtr = &div_struct;
     params.data = data;
+    params.multiples = multiples;
 
     struct TestFuncs funcs;
     funcs.funcs[kBaseTest] = mine_s64;
     funcs.funcs[kVec64Test] = FUNC_VECTOR64(mine_1s64_vector);
     funcs.funcs[kVec128Test] = FUNC_VECTOR128(mine_2s64_vector);
     funcs.funcs[kVec256Test] = FUNC_VECTOR256(mine_4s64_vector);
+    funcs.funcs[kVec512Test] = FUNC_VECTOR512(mine_8s64_vector);
     funcs.funcs[kUnswitchedBaseTest] = mine_s64_unswitched;
     funcs.funcs[kUnswitchedVec64Test] = FUNC_VECTOR64(mine_1s64_vector_unswitched);
     funcs.funcs[kUnswitchedVec128Test] = FUNC_VECTOR128(mine_2s64_vector_unswitched);
     funcs.funcs[kUnswitchedVec256Test] = FUNC_VECTOR256(mine_4s64_vector_unswitched);
+    funcs.funcs[kUnswitchedVec512Test] = FUNC_VECTOR512(mine_8s64_vector_unswitched);
+    funcs.funcs[kArrayTest] = mine_s64_array;
+    funcs.funcs[kModTest] = mine_s64_mod;
+    funcs.funcs[kVec64ModTest] = FUNC_VECTOR64(mine_1s64_vector_mod);
+    funcs.funcs[kVec128ModTest] = FUNC_VECTOR128(mine_2s64_vector_mod);
+    funcs.funcs[kVec256ModTest] = FUNC_VECTOR256(mine_4s64_vector_mod);
+    funcs.funcs[kVec512ModTest] = FUNC_VECTOR512(mine_8s64_vector_mod);
+    funcs.funcs[kFastmodTest] = NULL;
+    funcs.funcs[kVec128FastmodTest] = NULL;
+    funcs.funcs[kVec256FastmodTest] = NULL;
+    funcs.funcs[kFastmodArrayTest] = NULL;
     funcs.his = his_s64;
+    funcs.funcs[kIsDivisibleTest] = mine_s64_divisible;
+    funcs.funcs[kVec64IsDivisibleTest] = FUNC_VECTOR64(mine_1s64_divisible_vector);
+    funcs.funcs[kVec128IsDivisibleTest] = FUNC_VECTOR128(mine_2s64_divisible_vector);
+    funcs.funcs[kVec256IsDivisibleTest] = FUNC_VECTOR256(mine_4s64_divisible_vector);
+    funcs.funcs[kVec512IsDivisibleTest] = FUNC_VECTOR512(mine_8s64_divisible_vector);
+    funcs.his_mod = his_s64_mod;
+    funcs.his_div = his_s64_divisible;
+    funcs.funcs[kExactTest] = mine_s64_exact;
+    funcs.funcs[kVec64ExactTest] = FUNC_VECTOR64(mine_1s64_exact_vector);
+    funcs.funcs[kVec128ExactTest] = FUNC_VECTOR128(mine_2s64_exact_vector);
+    funcs.funcs[kVec256ExactTest] = FUNC_VECTOR256(mine_4s64_exact_vector);
+    funcs.funcs[kVec512ExactTest] = FUNC_VECTOR512(mine_8s64_exact_vector);
+    funcs.his_exact = his_s64_exact;
+    funcs.funcs[kFloorTest] = mine_s64_floor;
+    funcs.funcs[kVec64FloorTest] = FUNC_VECTOR64(mine_1s64_floor_vector);
+    funcs.funcs[kVec128FloorTest] = FUNC_VECTOR128(mine_2s64_floor_vector);
+    funcs.funcs[kVec256FloorTest] = FUNC_VECTOR256(mine_4s64_floor_vector);
+    funcs.funcs[kVec512FloorTest] = FUNC_VECTOR512(mine_8s64_floor_vector);
+    funcs.his_floor = his_s64_floor;
+    funcs.funcs[kUnswitchedFloorTest] = mine_s64_floor_unswitched;
+    funcs.funcs[kEuclidTest] = mine_s64_euclid;
+    funcs.funcs[kVec64EuclidTest] = FUNC_VECTOR64(mine_1s64_euclid_vector);
+    funcs.funcs[kVec128EuclidTest] = FUNC_VECTOR128(mine_2s64_euclid_vector);
+    funcs.funcs[kVec256EuclidTest] = FUNC_VECTOR256(mine_4s64_euclid_vector);
+    funcs.funcs[kVec512EuclidTest] = FUNC_VECTOR512(mine_8s64_euclid_vector);
+    funcs.his_euclid = his_s64_euclid;
+    funcs.funcs[kCeilTest] = mine_s64_ceil;
+    funcs.funcs[kVec64CeilTest] = FUNC_VECTOR64(mine_1s64_ceil_vector);
+    funcs.funcs[kVec128CeilTest] = FUNC_VECTOR128(mine_2s64_ceil_vector);
+    funcs.funcs[kVec256CeilTest] = FUNC_VECTOR256(mine_4s64_ceil_vector);
+    funcs.funcs[kVec512CeilTest] = FUNC_VECTOR512(mine_8s64_ceil_vector);
+    funcs.funcs[kCeilArrayTest] = mine_s64_ceil_array;
+    funcs.his_ceil = his_s64_ceil;
+    funcs.funcs[kRoundTest] = mine_s64_round;
+    funcs.funcs[kVec64RoundTest] = FUNC_VECTOR64(mine_1s64_round_vector);
+    funcs.funcs[kVec128RoundTest] = FUNC_VECTOR128(mine_2s64_round_vector);
+    funcs.funcs[kVec256RoundTest] = FUNC_VECTOR256(mine_4s64_round_vector);
+    funcs.funcs[kVec512RoundTest] = FUNC_VECTOR512(mine_8s64_round_vector);
+    funcs.funcs[kRoundArrayTest] = mine_s64_round_array;
+    funcs.his_round = his_s64_round;
+    funcs.funcs[kNarrowTest] = NULL;
+    funcs.funcs[kVec256NarrowTest] = NULL;
+    funcs.funcs[kVec512NarrowTest] = NULL;
+    funcs.funcs[kNarrowArrayTest] = NULL;
+    funcs.his_narrow = NULL;
+    funcs.funcs[kBranchfreeTest] = mine_s64_branchfree;
+    funcs.funcs[kVec128BranchfreeTest] = FUNC_BRANCHFREE128(mine_2s64_branchfree_vector);
+    funcs.funcs[kVec256BranchfreeTest] = FUNC_BRANCHFREE256(mine_4s64_branchfree_vector);
+    funcs.funcs[kVec512BranchfreeTest] = FUNC_BRANCHFREE512(mine_8s64_branchfree_vector);
+    funcs.funcs[kBranchfreeArrayTest] = mine_s64_branchfree_array;
     funcs.generate = mine_s64_generate;
+    funcs.lookup = NULL; //there is no s64 table
+
+    struct TestResult result = test_one(&funcs, &params);
+    result.algo = libdivide_s64_get_algorithm(&div_struct);
+    return result;
+}
+
+static void report_header(void) {
+    unsigned test;
+    printf("%6s%10s%10s%10s%10s%10s%10s%10s%10s%10s", "#", "system", "sys_mod", "sys_div", "sys_ex", "sys_fl", "sys_eu", "sys_ce", "sys_rn", "sys_nw");
+    for (test = 0; test < kNumTests; test++) {
+        printf("%10s", strTests[test]);
+    }
+    printf("%10s%10s%6s\n", "gener", "lookup", "algo");
+}
+
+static void report_result(const char *input, struct TestResult result) {
+    unsigned test;
+    printf("%6s%10.3f%10.3f%10.3f%10.3f%10.3f%10.3f%10.3f%10.3f%10.3f", input, result.his_time, result.his_mod_time, result.his_div_time, result.his_exact_time, result.his_floor_time, result.his_euclid_time, result.his_ceil_time, result.his_round_time, result.his_narrow_time);
+    for (test = 0; test < kNumTests; test++) {
+        printf("%10.3f", result.times[test]);
+    }
+    printf("%10.3f%10.3f%6d\n", result.gen_time, result.lookup_time, result.algo);
+}
+
+static void test_many_u8(const uint8_t *data) {
+    report_header();
+    uint8_t d;
+    for (d=1; d > 0; d++) {
+        struct TestResult result = test_one_u8(d, data);
+        char input_buff[32];
+        sprintf(input_buff, "%u", d);
+        report_result(input_buff, result);
+    }
+}
+
+static void test_many_s8(const int8_t *data) {
+    report_header();
+    int32_t d;
+    for (d=1; d <= INT8_MAX;) {
+        struct TestResult result = test_one_s8((int8_t)d, data);
+        char input_buff[32];
+        sprintf(input_buff, "%d", d);
+        report_result(input_buff, result);
 
-    struct TestResult result = test_one(&funcs, &params);
-    result.algo = libdivide_s64_get_algorithm(&div_struct);
-    return result;
+        d = -d;
+        if (d > 0) d++;
+    }
 }
 
-static void report_header(void) {
-    unsigned test;
-    printf("%6s%10s", "#", "system");
-    for (test = 0; test < kNumTests; test++) {
-        printf("%10s", strTests[test]);
+static void test_many_u16(const uint16_t *data) {
+    report_header();
+    uint16_t d;
+    for (d=1; d > 0; d++) {
+        struct TestResult result = test_one_u16(d, data);
+        char input_buff[32];
+        sprintf(input_buff, "%u", d);
+        report_result(input_buff, result);
     }
-    printf("%10s%6s\n", "gener", "algo");
 }
 
-static void report_result(const char *input, struct TestResult result) {
-    unsigned test;
-    printf("%6s%10.3f", input, result.his_time);
-    for (test = 0; test < kNumTests; test++) {
-        printf("%10.3f", result.times[test]);
+static void test_many_s16(const int16_t *data) {
+    report_header();
+    /* An int16_t would overflow on the way from 32767 to -32768, so d is wider */
+    int32_t d;
+    for (d=1; d <= INT16_MAX;) {
+        struct TestResult result = test_one_s16((int16_t)d, data);
+        char input_buff[32];
+        sprintf(input_buff, "%d", d);
+        report_result(input_buff, result);
+
+        d = -d;
+        if (d > 0) d++;
     }
-    printf("%10.3f%6d\n", result.gen_time, result.algo);
 }
 
-static void test_many_u32(const uint32_t *data) {
+static void test_many_u32(const uint32_t *data, uint32_t *multiples) {
     report_header();
     uint32_t d;
     for (d=1; d > 0; d++) {
-        struct TestResult result = test_one_u32(d, data);
+        struct TestResult result = test_one_u32(d, data, multiples);
         char input_buff[32];
         sprintf(input_buff, "%u", d);
         report_result(input_buff, result);
     }
 }
 
-static void test_many_s32(const int32_t *data) {
+static void test_many_s32(const int32_t *data, int32_t *multiples) {
     report_header();
     int32_t d;
     for (d=1; d != 0;) {
-        struct TestResult result = test_one_s32(d, data);
+        struct TestResult result = test_one_s32(d, data, multiples);
         char input_buff[32];
         sprintf(input_buff, "%d", d);
         report_result(input_buff, result);
@@ -1349,22 +8068,22 @@ static void test_many_s32(const int32_t *data) {
     }
 }
 
-static void test_many_u64(const uint64_t *data) {
+static void test_many_u64(const uint64_t *data, uint64_t *multiples) {
     report_header();
     uint64_t d;
     for (d=1; d > 0; d++) {
-        struct TestResult result = test_one_u64(d, data);
+        struct TestResult result = test_one_u64(d, data, multiples);
         char input_buff[32];
         sprintf(input_buff, "%llu", d);
         report_result(input_buff, result);
     }
 }
 
-static void test_many_s64(const int64_t *data) {
+static void test_many_s64(const int64_t *data, int64_t *multiples) {
     report_header();
     int64_t d;
     for (d=1; d != 0;) {
-        struct TestResult result = test_one_s64(d, data);
+        struct TestResult result = test_one_s64(d, data, multiples);
         char input_buff[32];
         sprintf(input_buff, "%lld", d);
         report_result(input_buff, result);
@@ -1374,13 +8093,821 @@ static void test_many_s64(const int64_t *data) {
     }
 }
 
+#if HAS_INT128_T
+/* __udivti3 and __divti3 have a fast path for divisors that fit in 64 bits, so each d is also tried shifted into the high half, which they divide the long way.  printf can't print 128 bit numbers, so those rows are labelled d<<64. */
+static void test_many_u128(const __uint128_t *data) {
+    report_header();
+    uint64_t d;
+    for (d=1; d > 0; d++) {
+        struct TestResult result = test_one_u128(d, data);
+        char input_buff[32];
+        sprintf(input_buff, "%llu", (unsigned long long)d);
+        report_result(input_buff, result);
+
+        result = test_one_u128((__uint128_t)d << 64, data);
+        sprintf(input_buff, "%llu<<64", (unsigned long long)d);
+        report_result(input_buff, result);
+    }
+}
+
+static void test_many_s128(const __int128_t *data) {
+    report_header();
+    int64_t d;
+    for (d=1; d != 0;) {
+        struct TestResult result = test_one_s128(d, data);
+        char input_buff[32];
+        sprintf(input_buff, "%lld", (long long)d);
+        report_result(input_buff, result);
+
+        result = test_one_s128((__int128_t)((__uint128_t)d << 64), data);
+        sprintf(input_buff, "%lld<<64", (long long)d);
+        report_result(input_buff, result);
+
+        d = -d;
+        if (d > 0) d++;
+    }
+}
+#endif
+
+enum RotateTests {
+    kRotateBaseTest,
+    kRotateBranchfreeTest,
+    kRotateVec128Test,
+    kRotateVec128BranchfreeTest,
+    kRotateVec256Test,
+    kRotateVec256BranchfreeTest,
+    kRotateVec512Test,
+    kRotateVec512BranchfreeTest,
+    kRotateVec128GatherTest,
+    kRotateVec256GatherTest,
+    kRotateVec512GatherTest,
+    kRotateGatherArrayTest,
+    kRotateSoaTest,
+    kRotateVec128SoaGatherTest,
+    kRotateVec256SoaGatherTest,
+    kRotateVec512SoaGatherTest,
+    kRotateSoaGatherArrayTest,
+    kNumRotateTests
+};
+
+const char *strRotateTests[kNumRotateTests] = {
+    "scalar",
+    "bfree",
+    "v128",
+    "v128_bf",
+    "v256",
+    "v256_bf",
+    "v512",
+    "v512_bf",
+    "v128_ga",
+    "v256_ga",
+    "v512_ga",
+    "idx_arr",
+    "soa",
+    "v128_sa",
+    "v256_sa",
+    "v512_sa",
+    "soa_arr"
+};
+
+/* The width of each rotate test's vectors in bytes, or 0 for the scalar ones.  All the lanes of a vector share a divisor. */
+static const unsigned rotateVectorBytes[kNumRotateTests] = {0, 0, 16, 16, 32, 32, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+/* The gather tests take a random divisor for each numerator, from the rotate table's index, instead of walking the table */
+static const int rotateGathers[kNumRotateTests] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+
+static void report_rotate_header(void) {
+    unsigned test;
+    printf("%6s%10s", "#", "system");
+    for (test = 0; test < kNumRotateTests; test++) {
+        printf("%10s", strRotateTests[test]);
+    }
+    printf("\n");
+}
+
+/* Like test_one, but the expected results are worked out beforehand, one for each way of handing out the divisors */
+NOINLINE static void test_rotate(const char *input, TestFunc_t his, const TestFunc_t *funcs, const uint64_t *expected, struct FunctionParams_t *params) {
+#define TEST_COUNT 3
+    uint64_t my_times[kNumRotateTests][TEST_COUNT], his_times[TEST_COUNT];
+    unsigned iter, test;
+    struct time_result tresult;
+    for (iter = 0; iter < TEST_COUNT; iter++) {
+        tresult = time_function(his, params); his_times[iter] = tresult.time; CHECK(tresult.result, expected[kRotateBaseTest]);
+        for (test = 0; test < kNumRotateTests; test++) {
+            if (funcs[test]) {
+                tresult = time_function(funcs[test], params); my_times[test][iter] = tresult.time; CHECK(tresult.result, expected[test]);
+            } else {
+                my_times[test][iter] = 0;
+            }
+        }
+    }
+
+    printf("%6s%10.3f", input, find_min(his_times, TEST_COUNT) / (double)ITERATIONS);
+    for (test = 0; test < kNumRotateTests; test++) {
+        printf("%10.3f", find_min(my_times[test], TEST_COUNT) / (double)ITERATIONS);
+    }
+    printf("\n");
+#undef TEST_COUNT
+}
+
+NOINLINE static void test_rotate_u32(const uint32_t *data) {
+    struct rotate_u32_t rotate;
+    struct random_state state = SEED;
+    unsigned i, test;
+    for (i = 0; i < ROTATE_DIVISORS; i++) {
+        uint32_t d;
+        do {
+            uint32_t bits = my_random(&state);
+            d = (uint32_t)(bits >> (my_random(&state) % 32));
+        } while (d < 2);
+        rotate.d[i] = d;
+        rotate.denom[i] = libdivide_u32_gen(d);
+        rotate.branchfree[i] = libdivide_u32_branchfree_gen(d);
+    }
+    rotate.array.magics = rotate.magics;
+    rotate.array.mores = rotate.mores;
+    libdivide_u32_array_gen(rotate.d, &rotate.array, ROTATE_DIVISORS);
+    uint32_t *indices = (uint32_t *)malloc(ITERATIONS * sizeof *indices);
+    for (i = 0; i < ITERATIONS; i++) {
+        indices[i] = my_random(&state) % ROTATE_DIVISORS;
+    }
+    rotate.index = indices;
+    struct FunctionParams_t params;
+    params.d = NULL;
+    params.denomPtr = &rotate;
+    params.data = data;
+    params.multiples = NULL;
+
+    uint64_t expected[kNumRotateTests];
+    for (test = 0; test < kNumRotateTests; test++) {
+        const unsigned lanes = rotateVectorBytes[test] ? rotateVectorBytes[test] / sizeof(uint32_t) : 1;
+        uint32_t sum = 0;
+        for (i = 0; i < ITERATIONS; i++) {
+            sum += data[i] / rotate.d[rotateGathers[test] ? indices[i] : (i / lanes) % ROTATE_DIVISORS];
+        }
+        expected[test] = sum;
+    }
+
+    TestFunc_t funcs[kNumRotateTests];
+    funcs[kRotateBaseTest] = mine_u32_rotate;
+    funcs[kRotateBranchfreeTest] = mine_u32_branchfree_rotate;
+    funcs[kRotateVec128Test] = FUNC_VECTOR128(mine_4u32_rotate_vector);
+    funcs[kRotateVec128BranchfreeTest] = FUNC_BRANCHFREE128(mine_4u32_branchfree_rotate_vector);
+    funcs[kRotateVec256Test] = FUNC_VECTOR256(mine_8u32_rotate_vector);
+    funcs[kRotateVec256BranchfreeTest] = FUNC_BRANCHFREE256(mine_8u32_branchfree_rotate_vector);
+    funcs[kRotateVec512Test] = FUNC_VECTOR512(mine_16u32_rotate_vector);
+    funcs[kRotateVec512BranchfreeTest] = FUNC_BRANCHFREE512(mine_16u32_branchfree_rotate_vector);
+    funcs[kRotateVec128GatherTest] = FUNC_BRANCHFREE128(mine_4u32_gather_vector);
+    funcs[kRotateVec256GatherTest] = FUNC_BRANCHFREE256(mine_8u32_gather_vector);
+    funcs[kRotateVec512GatherTest] = FUNC_BRANCHFREE512(mine_16u32_gather_vector);
+    funcs[kRotateGatherArrayTest] = mine_u32_gather_array;
+    funcs[kRotateSoaTest] = mine_u32_soa;
+    funcs[kRotateVec128SoaGatherTest] = FUNC_BRANCHFREE128(mine_4u32_soa_gather_vector);
+    funcs[kRotateVec256SoaGatherTest] = FUNC_BRANCHFREE256(mine_8u32_soa_gather_vector);
+    funcs[kRotateVec512SoaGatherTest] = FUNC_BRANCHFREE512(mine_16u32_soa_gather_vector);
+    funcs[kRotateSoaGatherArrayTest] = mine_u32_soa_gather_array;
+    test_rotate("u32", his_u32_rotate, funcs, expected, &params);
+    free(indices);
+}
+
+NOINLINE static void test_rotate_s32(const int32_t *data) {
+    struct rotate_s32_t rotate;
+    struct random_state state = SEED;
+    unsigned i, test;
+    for (i = 0; i < ROTATE_DIVISORS; i++) {
+        int32_t d;
+        do {
+            uint32_t bits = my_random(&state);
+            d = (int32_t)(bits >> (my_random(&state) % 32));
+        } while (d == 0);
+        rotate.d[i] = d;
+        rotate.denom[i] = libdivide_s32_gen(d);
+        rotate.branchfree[i] = libdivide_s32_branchfree_gen(d);
+    }
+    rotate.array.magics = rotate.magics;
+    rotate.array.mores = rotate.mores;
+    libdivide_s32_array_gen(rotate.d, &rotate.array, ROTATE_DIVISORS);
+    uint32_t *indices = (uint32_t *)malloc(ITERATIONS * sizeof *indices);
+    for (i = 0; i < ITERATIONS; i++) {
+        indices[i] = my_random(&state) % ROTATE_DIVISORS;
+    }
+    rotate.index = indices;
+    struct FunctionParams_t params;
+    params.d = NULL;
+    params.denomPtr = &rotate;
+    params.data = data;
+    params.multiples = NULL;
+
+    uint64_t expected[kNumRotateTests];
+    for (test = 0; test < kNumRotateTests; test++) {
+        const unsigned lanes = rotateVectorBytes[test] ? rotateVectorBytes[test] / sizeof(int32_t) : 1;
+        int32_t sum = 0;
+        for (i = 0; i < ITERATIONS; i++) {
+            sum += data[i] / rotate.d[rotateGathers[test] ? indices[i] : (i / lanes) % ROTATE_DIVISORS];
+        }
+        expected[test] = sum;
+    }
+
+    TestFunc_t funcs[kNumRotateTests];
+    funcs[kRotateBaseTest] = mine_s32_rotate;
+    funcs[kRotateBranchfreeTest] = mine_s32_branchfree_rotate;
+    funcs[kRotateVec128Test] = FUNC_VECTOR128(mine_4s32_rotate_vector);
+    funcs[kRotateVec128BranchfreeTest] = FUNC_BRANCHFREE128(mine_4s32_branchfree_rotate_vector);
+    funcs[kRotateVec256Test] = FUNC_VECTOR256(mine_8s32_rotate_vector);
+    funcs[kRotateVec256BranchfreeTest] = FUNC_BRANCHFREE256(mine_8s32_branchfree_rotate_vector);
+    funcs[kRotateVec512Test] = FUNC_VECTOR512(mine_16s32_rotate_vector);
+    funcs[kRotateVec512BranchfreeTest] = FUNC_BRANCHFREE512(mine_16s32_branchfree_rotate_vector);
+    funcs[kRotateVec128GatherTest] = FUNC_BRANCHFREE128(mine_4s32_gather_vector);
+    funcs[kRotateVec256GatherTest] = FUNC_BRANCHFREE256(mine_8s32_gather_vector);
+    funcs[kRotateVec512GatherTest] = FUNC_BRANCHFREE512(mine_16s32_gather_vector);
+    funcs[kRotateGatherArrayTest] = mine_s32_gather_array;
+    funcs[kRotateSoaTest] = mine_s32_soa;
+    funcs[kRotateVec128SoaGatherTest] = FUNC_BRANCHFREE128(mine_4s32_soa_gather_vector);
+    funcs[kRotateVec256SoaGatherTest] = FUNC_BRANCHFREE256(mine_8s32_soa_gather_vector);
+    funcs[kRotateVec512SoaGatherTest] = FUNC_BRANCHFREE512(mine_16s32_soa_gather_vector);
+    funcs[kRotateSoaGatherArrayTest] = mine_s32_soa_gather_array;
+    test_rotate("s32", his_s32_rotate, funcs, expected, &params);
+    free(indices);
+}
+
+NOINLINE static void test_rotate_u64(const uint64_t *data) {
+    struct rotate_u64_t rotate;
+    struct random_state state = SEED;
+    unsigned i, test;
+    for (i = 0; i < ROTATE_DIVISORS; i++) {
+        uint64_t d;
+        do {
+            uint64_t bits = ((uint64_t)my_random(&state) << 32) | my_random(&state);
+            d = (uint64_t)(bits >> (my_random(&state) % 64));
+        } while (d < 2);
+        rotate.d[i] = d;
+        rotate.denom[i] = libdivide_u64_gen(d);
+        rotate.branchfree[i] = libdivide_u64_branchfree_gen(d);
+    }
+    rotate.array.magics = rotate.magics;
+    rotate.array.mores = rotate.mores;
+    libdivide_u64_array_gen(rotate.d, &rotate.array, ROTATE_DIVISORS);
+    uint32_t *indices = (uint32_t *)malloc(ITERATIONS * sizeof *indices);
+    for (i = 0; i < ITERATIONS; i++) {
+        indices[i] = my_random(&state) % ROTATE_DIVISORS;
+    }
+    rotate.index = indices;
+    struct FunctionParams_t params;
+    params.d = NULL;
+    params.denomPtr = &rotate;
+    params.data = data;
+    params.multiples = NULL;
+
+    uint64_t expected[kNumRotateTests];
+    for (test = 0; test < kNumRotateTests; test++) {
+        const unsigned lanes = rotateVectorBytes[test] ? rotateVectorBytes[test] / sizeof(uint64_t) : 1;
+        uint64_t sum = 0;
+        for (i = 0; i < ITERATIONS; i++) {
+            sum += data[i] / rotate.d[rotateGathers[test] ? indices[i] : (i / lanes) % ROTATE_DIVISORS];
+        }
+        expected[test] = sum;
+    }
+
+    TestFunc_t funcs[kNumRotateTests];
+    funcs[kRotateBaseTest] = mine_u64_rotate;
+    funcs[kRotateBranchfreeTest] = mine_u64_branchfree_rotate;
+    funcs[kRotateVec128Test] = FUNC_VECTOR128(mine_2u64_rotate_vector);
+    funcs[kRotateVec128BranchfreeTest] = FUNC_BRANCHFREE128(mine_2u64_branchfree_rotate_vector);
+    funcs[kRotateVec256Test] = FUNC_VECTOR256(mine_4u64_rotate_vector);
+    funcs[kRotateVec256BranchfreeTest] = FUNC_BRANCHFREE256(mine_4u64_branchfree_rotate_vector);
+    funcs[kRotateVec512Test] = FUNC_VECTOR512(mine_8u64_rotate_vector);
+    funcs[kRotateVec512BranchfreeTest] = FUNC_BRANCHFREE512(mine_8u64_branchfree_rotate_vector);
+    funcs[kRotateVec128GatherTest] = FUNC_BRANCHFREE128(mine_2u64_gather_vector);
+    funcs[kRotateVec256GatherTest] = FUNC_BRANCHFREE256(mine_4u64_gather_vector);
+    funcs[kRotateVec512GatherTest] = FUNC_BRANCHFREE512(mine_8u64_gather_vector);
+    funcs[kRotateGatherArrayTest] = mine_u64_gather_array;
+    funcs[kRotateSoaTest] = mine_u64_soa;
+    funcs[kRotateVec128SoaGatherTest] = FUNC_BRANCHFREE128(mine_2u64_soa_gather_vector);
+    funcs[kRotateVec256SoaGatherTest] = FUNC_BRANCHFREE256(mine_4u64_soa_gather_vector);
+    funcs[kRotateVec512SoaGatherTest] = FUNC_BRANCHFREE512(mine_8u64_soa_gather_vector);
+    funcs[kRotateSoaGatherArrayTest] = mine_u64_soa_gather_array;
+    test_rotate("u64", his_u64_rotate, funcs, expected, &params);
+    free(indices);
+}
+
+NOINLINE static void test_rotate_s64(const int64_t *data) {
+    struct rotate_s64_t rotate;
+    struct random_state state = SEED;
+    unsigned i, test;
+    for (i = 0; i < ROTATE_DIVISORS; i++) {
+        int64_t d;
+        do {
+            uint64_t bits = ((uint64_t)my_random(&state) << 32) | my_random(&state);
+            d = (int64_t)(bits >> (my_random(&state) % 64));
+        } while (d == 0);
+        rotate.d[i] = d;
+        rotate.denom[i] = libdivide_s64_gen(d);
+        rotate.branchfree[i] = libdivide_s64_branchfree_gen(d);
+    }
+    rotate.array.magics = rotate.magics;
+    rotate.array.mores = rotate.mores;
+    libdivide_s64_array_gen(rotate.d, &rotate.array, ROTATE_DIVISORS);
+    uint32_t *indices = (uint32_t *)malloc(ITERATIONS * sizeof *indices);
+    for (i = 0; i < ITERATIONS; i++) {
+        indices[i] = my_random(&state) % ROTATE_DIVISORS;
+    }
+    rotate.index = indices;
+    struct FunctionParams_t params;
+    params.d = NULL;
+    params.denomPtr = &rotate;
+    params.data = data;
+    params.multiples = NULL;
+
+    uint64_t expected[kNumRotateTests];
+    for (test = 0; test < kNumRotateTests; test++) {
+        const unsigned lanes = rotateVectorBytes[test] ? rotateVectorBytes[test] / sizeof(int64_t) : 1;
+        int64_t sum = 0;
+        for (i = 0; i < ITERATIONS; i++) {
+            sum += data[i] / rotate.d[rotateGathers[test] ? indices[i] : (i / lanes) % ROTATE_DIVISORS];
+        }
+        expected[test] = sum;
+    }
+
+    TestFunc_t funcs[kNumRotateTests];
+    funcs[kRotateBaseTest] = mine_s64_rotate;
+    funcs[kRotateBranchfreeTest] = mine_s64_branchfree_rotate;
+    funcs[kRotateVec128Test] = FUNC_VECTOR128(mine_2s64_rotate_vector);
+    funcs[kRotateVec128BranchfreeTest] = FUNC_BRANCHFREE128(mine_2s64_branchfree_rotate_vector);
+    funcs[kRotateVec256Test] = FUNC_VECTOR256(mine_4s64_rotate_vector);
+    funcs[kRotateVec256BranchfreeTest] = FUNC_BRANCHFREE256(mine_4s64_branchfree_rotate_vector);
+    funcs[kRotateVec512Test] = FUNC_VECTOR512(mine_8s64_rotate_vector);
+    funcs[kRotateVec512BranchfreeTest] = FUNC_BRANCHFREE512(mine_8s64_branchfree_rotate_vector);
+    funcs[kRotateVec128GatherTest] = FUNC_BRANCHFREE128(mine_2s64_gather_vector);
+    funcs[kRotateVec256GatherTest] = FUNC_BRANCHFREE256(mine_4s64_gather_vector);
+    funcs[kRotateVec512GatherTest] = FUNC_BRANCHFREE512(mine_8s64_gather_vector);
+    funcs[kRotateGatherArrayTest] = mine_s64_gather_array;
+    funcs[kRotateSoaTest] = mine_s64_soa;
+    funcs[kRotateVec128SoaGatherTest] = FUNC_BRANCHFREE128(mine_2s64_soa_gather_vector);
+    funcs[kRotateVec256SoaGatherTest] = FUNC_BRANCHFREE256(mine_4s64_soa_gather_vector);
+    funcs[kRotateVec512SoaGatherTest] = FUNC_BRANCHFREE512(mine_8s64_soa_gather_vector);
+    funcs[kRotateSoaGatherArrayTest] = mine_s64_soa_gather_array;
+    test_rotate("s64", his_s64_rotate, funcs, expected, &params);
+    free(indices);
+}
+
+enum GenTests {
+    kGenEachTest,
+    kGenArrayTest,
+    kGenArraySoaTest,
+    kGenReadTest,
+    kGenViewTest,
+    kNumGenTests
+};
+
+const char *strGenTests[kNumGenTests] = {
+    "gen",
+    "gen_arr",
+    "gen_soa",
+    "read",
+    "view"
+};
+
+static void report_gen_header(void) {
+    unsigned test;
+    printf("%6s%10s", "#", "system");
+    for (test = 0; test < kNumGenTests; test++) {
+        printf("%10s", strGenTests[test]);
+    }
+    printf("\n");
+}
+
+/* Like test_rotate, with the times per divisor, and the system column left unchecked since it divides rather than generating */
+NOINLINE static void test_gen(const char *input, TestFunc_t his, const TestFunc_t *funcs, uint64_t expected, struct FunctionParams_t *params) {
+#define TEST_COUNT 3
+    uint64_t my_times[kNumGenTests][TEST_COUNT], his_times[TEST_COUNT];
+    unsigned iter, test;
+    struct time_result tresult;
+    for (iter = 0; iter < TEST_COUNT; iter++) {
+        tresult = time_function(his, params); his_times[iter] = tresult.time;
+        for (test = 0; test < kNumGenTests; test++) {
+            tresult = time_function(funcs[test], params); my_times[test][iter] = tresult.time; CHECK(tresult.result, expected);
+        }
+    }
+
+    printf("%6s%10.3f", input, find_min(his_times, TEST_COUNT) / (double)GEN_ITERATIONS);
+    for (test = 0; test < kNumGenTests; test++) {
+        printf("%10.3f", find_min(my_times[test], TEST_COUNT) / (double)GEN_ITERATIONS);
+    }
+    printf("\n");
+#undef TEST_COUNT
+}
+
+NOINLINE static void test_gen_u32(const uint32_t *data) {
+    struct gen_u32_t *gen = (struct gen_u32_t *)malloc(sizeof *gen);
+    struct random_state state = SEED;
+    uint64_t expected = 0;
+    unsigned i;
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        uint32_t d;
+        do {
+            uint32_t bits = my_random(&state);
+            d = (uint32_t)(bits >> (my_random(&state) % 32));
+        } while (d == 0);
+        gen->d[i] = d;
+        const struct libdivide_u32_t denom = libdivide_u32_gen(d);
+        gen->denom[i] = denom;
+        expected += (uint32_t)denom.magic + denom.more;
+    }
+    gen->serial.size = libdivide_u32_serialize(gen->denom, GEN_DIVISORS, NULL, 0);
+    gen->serial.buf = malloc(gen->serial.size);
+    libdivide_u32_serialize(gen->denom, GEN_DIVISORS, gen->serial.buf, gen->serial.size);
+    serial_open(&gen->serial);
+    struct FunctionParams_t params;
+    params.d = NULL;
+    params.denomPtr = gen;
+    params.data = data;
+    params.multiples = NULL;
+
+    TestFunc_t funcs[kNumGenTests];
+    funcs[kGenEachTest] = mine_u32_gen_each;
+    funcs[kGenArrayTest] = mine_u32_gen_array;
+    funcs[kGenArraySoaTest] = mine_u32_gen_array_soa;
+    funcs[kGenReadTest] = mine_u32_read;
+    funcs[kGenViewTest] = mine_u32_view;
+    test_gen("u32", his_u32_gen, funcs, expected, &params);
+    serial_close(&gen->serial);
+    free(gen);
+}
+
+NOINLINE static void test_gen_s32(const int32_t *data) {
+    struct gen_s32_t *gen = (struct gen_s32_t *)malloc(sizeof *gen);
+    struct random_state state = SEED;
+    uint64_t expected = 0;
+    unsigned i;
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        int32_t d;
+        do {
+            uint32_t bits = my_random(&state);
+            d = (int32_t)(bits >> (my_random(&state) % 32));
+        } while (d == 0);
+        gen->d[i] = d;
+        const struct libdivide_s32_t denom = libdivide_s32_gen(d);
+        gen->denom[i] = denom;
+        expected += (uint32_t)denom.magic + denom.more;
+    }
+    gen->serial.size = libdivide_s32_serialize(gen->denom, GEN_DIVISORS, NULL, 0);
+    gen->serial.buf = malloc(gen->serial.size);
+    libdivide_s32_serialize(gen->denom, GEN_DIVISORS, gen->serial.buf, gen->serial.size);
+    serial_open(&gen->serial);
+    struct FunctionParams_t params;
+    params.d = NULL;
+    params.denomPtr = gen;
+    params.data = data;
+    params.multiples = NULL;
+
+    TestFunc_t funcs[kNumGenTests];
+    funcs[kGenEachTest] = mine_s32_gen_each;
+    funcs[kGenArrayTest] = mine_s32_gen_array;
+    funcs[kGenArraySoaTest] = mine_s32_gen_array_soa;
+    funcs[kGenReadTest] = mine_s32_read;
+    funcs[kGenViewTest] = mine_s32_view;
+    test_gen("s32", his_s32_gen, funcs, expected, &params);
+    serial_close(&gen->serial);
+    free(gen);
+}
+
+NOINLINE static void test_gen_u64(const uint64_t *data) {
+    struct gen_u64_t *gen = (struct gen_u64_t *)malloc(sizeof *gen);
+    struct random_state state = SEED;
+    uint64_t expected = 0;
+    unsigned i;
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        uint64_t d;
+        do {
+            uint64_t bits = ((uint64_t)my_random(&state) << 32) | my_random(&state);
+            d = (uint64_t)(bits >> (my_random(&state) % 64));
+        } while (d == 0);
+        gen->d[i] = d;
+        const struct libdivide_u64_t denom = libdivide_u64_gen(d);
+        gen->denom[i] = denom;
+        expected += (uint64_t)denom.magic + denom.more;
+    }
+    gen->serial.size = libdivide_u64_serialize(gen->denom, GEN_DIVISORS, NULL, 0);
+    gen->serial.buf = malloc(gen->serial.size);
+    libdivide_u64_serialize(gen->denom, GEN_DIVISORS, gen->serial.buf, gen->serial.size);
+    serial_open(&gen->serial);
+    struct FunctionParams_t params;
+    params.d = NULL;
+    params.denomPtr = gen;
+    params.data = data;
+    params.multiples = NULL;
+
+    TestFunc_t funcs[kNumGenTests];
+    funcs[kGenEachTest] = mine_u64_gen_each;
+    funcs[kGenArrayTest] = mine_u64_gen_array;
+    funcs[kGenArraySoaTest] = mine_u64_gen_array_soa;
+    funcs[kGenReadTest] = mine_u64_read;
+    funcs[kGenViewTest] = mine_u64_view;
+    test_gen("u64", his_u64_gen, funcs, expected, &params);
+    serial_close(&gen->serial);
+    free(gen);
+}
+
+NOINLINE static void test_gen_s64(const int64_t *data) {
+    struct gen_s64_t *gen = (struct gen_s64_t *)malloc(sizeof *gen);
+    struct random_state state = SEED;
+    uint64_t expected = 0;
+    unsigned i;
+    for (i = 0; i < GEN_DIVISORS; i++) {
+        int64_t d;
+        do {
+            uint64_t bits = ((uint64_t)my_random(&state) << 32) | my_random(&state);
+            d = (int64_t)(bits >> (my_random(&state) % 64));
+        } while (d == 0);
+        gen->d[i] = d;
+        const struct libdivide_s64_t denom = libdivide_s64_gen(d);
+        gen->denom[i] = denom;
+        expected += (uint64_t)denom.magic + denom.more;
+    }
+    gen->serial.size = libdivide_s64_serialize(gen->denom, GEN_DIVISORS, NULL, 0);
+    gen->serial.buf = malloc(gen->serial.size);
+    libdivide_s64_serialize(gen->denom, GEN_DIVISORS, gen->serial.buf, gen->serial.size);
+    serial_open(&gen->serial);
+    struct FunctionParams_t params;
+    params.d = NULL;
+    params.denomPtr = gen;
+    params.data = data;
+    params.multiples = NULL;
+
+    TestFunc_t funcs[kNumGenTests];
+    funcs[kGenEachTest] = mine_s64_gen_each;
+    funcs[kGenArrayTest] = mine_s64_gen_array;
+    funcs[kGenArraySoaTest] = mine_s64_gen_array_soa;
+    funcs[kGenReadTest] = mine_s64_read;
+    funcs[kGenViewTest] = mine_s64_view;
+    test_gen("s64", his_s64_gen, funcs, expected, &params);
+    serial_close(&gen->serial);
+    free(gen);
+}
+
+#if CACHE_TEST
+/* The cache test makes dividers for divisors drawn over and over from a small set, the way a service sees the same few page sizes and shard counts, on 1 to CACHE_MAX_THREADS threads at once.  Each thread walks the same random picks from its own starting point, first with libdivide_*_gen and then with libdivide_*_gen_cached on a cache they all share.  The times are per divider, on each thread, so they stay level as long as the threads scale; hits is from libdivide_*_cache_stats. */
+#define CACHE_DIVISORS 64
+#define CACHE_LOOKUPS (1 << 20)
+#define CACHE_MAX_THREADS 16
+
+enum CacheTests {
+    kCacheU64Gen,
+    kCacheU64Cached,
+    kCacheS64Gen,
+    kCacheS64Cached
+};
+
+struct cache_thread_t {
+    pthread_t thread;
+    enum CacheTests test;
+    unsigned start;
+    const uint64_t *divisors;
+    const uint8_t *picks;
+    void *cache;
+    uint64_t sum;
+};
+
+static void *cache_thread(void *arg) {
+    struct cache_thread_t *t = (struct cache_thread_t *)arg;
+    const uint64_t *divisors = t->divisors;
+    const uint8_t *picks = t->picks;
+    uint64_t sum = 0;
+    unsigned i, pick;
+    switch (t->test) {
+    case kCacheU64Gen:
+        for (i = 0, pick = t->start; i < CACHE_LOOKUPS; i++, pick = (pick + 1) % CACHE_LOOKUPS) {
+            const struct libdivide_u64_t denom = libdivide_u64_gen(divisors[picks[pick]]);
+            sum += denom.magic + denom.more;
+        }
+        break;
+    case kCacheU64Cached:
+        for (i = 0, pick = t->start; i < CACHE_LOOKUPS; i++, pick = (pick + 1) % CACHE_LOOKUPS) {
+            const struct libdivide_u64_t denom = libdivide_u64_gen_cached(divisors[picks[pick]], (struct libdivide_u64_cache_t *)t->cache);
+            sum += denom.magic + denom.more;
+        }
+        break;
+    case kCacheS64Gen:
+        for (i = 0, pick = t->start; i < CACHE_LOOKUPS; i++, pick = (pick + 1) % CACHE_LOOKUPS) {
+            const struct libdivide_s64_t denom = libdivide_s64_gen((int64_t)divisors[picks[pick]]);
+            sum += (uint64_t)denom.magic + denom.more;
+        }
+        break;
+    case kCacheS64Cached:
+        for (i = 0, pick = t->start; i < CACHE_LOOKUPS; i++, pick = (pick + 1) % CACHE_LOOKUPS) {
+            const struct libdivide_s64_t denom = libdivide_s64_gen_cached((int64_t)divisors[picks[pick]], (struct libdivide_s64_cache_t *)t->cache);
+            sum += (uint64_t)denom.magic + denom.more;
+        }
+        break;
+    }
+    t->sum = sum;
+    return NULL;
+}
+
+//runs the test on nthreads threads, returning the time per divider per thread
+static double time_cache_threads(struct cache_thread_t *threads, unsigned nthreads, enum CacheTests test, void *cache) {
+    uint64_t start = nanoseconds();
+    unsigned i;
+    for (i = 0; i < nthreads; i++) {
+        threads[i].test = test;
+        threads[i].cache = cache;
+        if (pthread_create(&threads[i].thread, NULL, cache_thread, &threads[i])) {
+            fprintf(stderr, "pthread_create() failed\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(threads[i].thread, NULL);
+    }
+    return (nanoseconds() - start) / (double)CACHE_LOOKUPS;
+}
+
+NOINLINE static void test_cache(void) {
+    uint64_t divisors[CACHE_DIVISORS];
+    uint8_t *picks = (uint8_t *)malloc(CACHE_LOOKUPS);
+    struct libdivide_u64_cache_t *u64_cache = (struct libdivide_u64_cache_t *)malloc(sizeof *u64_cache);
+    struct libdivide_s64_cache_t *s64_cache = (struct libdivide_s64_cache_t *)malloc(sizeof *s64_cache);
+    struct cache_thread_t threads[CACHE_MAX_THREADS];
+    uint64_t expected[CACHE_MAX_THREADS];
+    struct random_state state = SEED;
+    unsigned i, nthreads;
+    for (i = 0; i < CACHE_DIVISORS; i++) {
+        do {
+            uint64_t bits = ((uint64_t)my_random(&state) << 32) | my_random(&state);
+            divisors[i] = bits >> (my_random(&state) % 64);
+        } while (divisors[i] == 0);
+    }
+    for (i = 0; i < CACHE_LOOKUPS; i++) {
+        picks[i] = (uint8_t)(my_random(&state) % CACHE_DIVISORS);
+    }
+    for (i = 0; i < CACHE_MAX_THREADS; i++) {
+        threads[i].start = i * (CACHE_LOOKUPS / CACHE_MAX_THREADS);
+        threads[i].divisors = divisors;
+        threads[i].picks = picks;
+    }
+
+    printf("%6s%8s%10s%10s%10s\n", "#", "threads", "gen", "cached", "hits");
+    for (nthreads = 1; nthreads <= CACHE_MAX_THREADS; nthreads *= 2) {
+        uint64_t hits, misses;
+        double gen_time, cached_time;
+
+        gen_time = time_cache_threads(threads, nthreads, kCacheU64Gen, NULL);
+        for (i = 0; i < nthreads; i++) expected[i] = threads[i].sum;
+        memset(u64_cache, 0, sizeof *u64_cache);
+        cached_time = time_cache_threads(threads, nthreads, kCacheU64Cached, u64_cache);
+        for (i = 0; i < nthreads; i++) CHECK(threads[i].sum, expected[i]);
+        libdivide_u64_cache_stats(u64_cache, &hits, &misses);
+        printf("%6s%8u%10.3f%10.3f%9.3f%%\n", "u64", nthreads, gen_time, cached_time, 100.0 * hits / (hits + misses));
+
+        gen_time = time_cache_threads(threads, nthreads, kCacheS64Gen, NULL);
+        for (i = 0; i < nthreads; i++) expected[i] = threads[i].sum;
+        memset(s64_cache, 0, sizeof *s64_cache);
+        cached_time = time_cache_threads(threads, nthreads, kCacheS64Cached, s64_cache);
+        for (i = 0; i < nthreads; i++) CHECK(threads[i].sum, expected[i]);
+        libdivide_s64_cache_stats(s64_cache, &hits, &misses);
+        printf("%6s%8u%10.3f%10.3f%9.3f%%\n", "s64", nthreads, gen_time, cached_time, 100.0 * hits / (hits + misses));
+    }
+    free(picks);
+    free(u64_cache);
+    free(s64_cache);
+}
+#endif
+
+#if THREADS_TEST
+/* The threads test divides arrays of THREADS_BYTES, far larger than the caches, with libdivide_*_do_array_parallel on pools of 1 to one thread per CPU, to show where it runs out of memory bandwidth.  The columns are gigabytes read and written per second, the best of THREADS_REPEATS runs: array is libdivide_*_do_array on this thread, for scale, pool is the pool with the results stored as usual, stream with non-temporal stores, and numa with non-temporal stores and the workers pinned (LIBDIVIDE_POOL_NUMA). */
+#define THREADS_BYTES (256 << 20)
+#define THREADS_REPEATS 4
+
+enum ThreadsTypes {
+    kThreadsU32,
+    kThreadsS32,
+    kThreadsU64,
+    kThreadsS64
+};
+
+struct threads_denoms_t {
+    struct libdivide_u32_t u32;
+    struct libdivide_s32_t s32;
+    struct libdivide_u64_t u64;
+    struct libdivide_s64_t s64;
+};
+
+//divides the numerators on the pool, or on this thread for a NULL pool
+static void threads_divide(enum ThreadsTypes type, const uint64_t *numers, uint64_t *results, const struct threads_denoms_t *denoms, struct libdivide_pool_t *pool) {
+    switch (type) {
+    case kThreadsU32:
+        if (pool) libdivide_u32_do_array_parallel((const uint32_t *)numers, (uint32_t *)results, THREADS_BYTES / 4, &denoms->u32, pool);
+        else libdivide_u32_do_array((const uint32_t *)numers, (uint32_t *)results, THREADS_BYTES / 4, &denoms->u32);
+        break;
+    case kThreadsS32:
+        if (pool) libdivide_s32_do_array_parallel((const int32_t *)numers, (int32_t *)results, THREADS_BYTES / 4, &denoms->s32, pool);
+        else libdivide_s32_do_array((const int32_t *)numers, (int32_t *)results, THREADS_BYTES / 4, &denoms->s32);
+        break;
+    case kThreadsU64:
+        if (pool) libdivide_u64_do_array_parallel(numers, results, THREADS_BYTES / 8, &denoms->u64, pool);
+        else libdivide_u64_do_array(numers, results, THREADS_BYTES / 8, &denoms->u64);
+        break;
+    case kThreadsS64:
+        if (pool) libdivide_s64_do_array_parallel((const int64_t *)numers, (int64_t *)results, THREADS_BYTES / 8, &denoms->s64, pool);
+        else libdivide_s64_do_array((const int64_t *)numers, (int64_t *)results, THREADS_BYTES / 8, &denoms->s64);
+        break;
+    }
+}
+
+//the sum of the quotients, which is the same whatever the width, since the signed ones wrap the same way
+static uint64_t threads_sum(enum ThreadsTypes type, const uint64_t *results) {
+    uint64_t sum = 0;
+    size_t i;
+    if (type == kThreadsU32 || type == kThreadsS32) {
+        for (i = 0; i < THREADS_BYTES / 4; i++) sum += ((const uint32_t *)results)[i];
+    }
+    else {
+        for (i = 0; i < THREADS_BYTES / 8; i++) sum += results[i];
+    }
+    return sum;
+}
+
+//returns the best rate of THREADS_REPEATS runs in gigabytes per second, checking each run's quotients
+static double time_threads(enum ThreadsTypes type, const uint64_t *numers, uint64_t *results, const struct threads_denoms_t *denoms, struct libdivide_pool_t *pool, uint64_t expected) {
+    uint64_t best = ~(uint64_t)0;
+    unsigned i;
+    for (i = 0; i < THREADS_REPEATS; i++) {
+        uint64_t start, time;
+        memset(results, 0, THREADS_BYTES);
+        start = nanoseconds();
+        threads_divide(type, numers, results, denoms, pool);
+        time = nanoseconds() - start;
+        if (time < best) best = time;
+        CHECK(threads_sum(type, results), expected);
+    }
+    return 2.0 * THREADS_BYTES / best;
+}
+
+static void init_pool(struct libdivide_pool_t *pool, unsigned threads, unsigned flags, size_t stream_above) {
+    if (libdivide_pool_init(pool, threads, flags)) {
+        fprintf(stderr, "libdivide_pool_init() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    pool->stream_above = stream_above;
+}
+
+NOINLINE static void test_threads(int u32, int s32, int u64, int s64) {
+    static const char * const names[] = {"u32", "s32", "u64", "s64"};
+    const int types[] = {u32, s32, u64, s64};
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    const unsigned max_threads = cpus < 1 ? 1 : cpus > LIBDIVIDE_POOL_MAX_THREADS ? LIBDIVIDE_POOL_MAX_THREADS : (unsigned)cpus;
+    struct libdivide_pool_t *pool = (struct libdivide_pool_t *)malloc(sizeof *pool);
+    struct threads_denoms_t denoms;
+    struct random_state state = SEED;
+    void *ptr = NULL;
+    uint64_t *numers, *results;
+    unsigned i, type, nthreads;
+    posix_memalign(&ptr, 64, THREADS_BYTES);
+    numers = (uint64_t *)ptr;
+    posix_memalign(&ptr, 64, THREADS_BYTES);
+    results = (uint64_t *)ptr;
+    for (i = 0; i < THREADS_BYTES / 4; i++) {
+        ((uint32_t *)numers)[i] = my_random(&state);
+    }
+    denoms.u32 = libdivide_u32_gen(my_random(&state) | 1);
+    denoms.s32 = libdivide_s32_gen((int32_t)(my_random(&state) >> 8) | 1);
+    denoms.u64 = libdivide_u64_gen(((uint64_t)my_random(&state) << 16) | 1);
+    denoms.s64 = libdivide_s64_gen(-(int64_t)(((uint64_t)my_random(&state) << 8) | 1));
+
+    printf("%6s%8s%10s%10s%10s%10s\n", "#", "threads", "array", "pool", "stream", "numa");
+    for (type = kThreadsU32; type <= kThreadsS64; type++) {
+        uint64_t expected;
+        double array_rate;
+        if (! types[type]) continue;
+        threads_divide((enum ThreadsTypes)type, numers, results, &denoms, NULL);
+        expected = threads_sum((enum ThreadsTypes)type, results);
+        array_rate = time_threads((enum ThreadsTypes)type, numers, results, &denoms, NULL, expected);
+        for (nthreads = 1; nthreads <= max_threads; nthreads++) {
+            double pool_rate, stream_rate, numa_rate;
+            init_pool(pool, nthreads, 0, (size_t)-1);
+            pool_rate = time_threads((enum ThreadsTypes)type, numers, results, &denoms, pool, expected);
+            pool->stream_above = 0;
+            stream_rate = time_threads((enum ThreadsTypes)type, numers, results, &denoms, pool, expected);
+            libdivide_pool_destroy(pool);
+            init_pool(pool, nthreads, LIBDIVIDE_POOL_NUMA, 0);
+            numa_rate = time_threads((enum ThreadsTypes)type, numers, results, &denoms, pool, expected);
+            libdivide_pool_destroy(pool);
+            printf("%6s%8u%10.2f%10.2f%10.2f%10.2f\n", names[type], nthreads, array_rate, pool_rate, stream_rate, numa_rate);
+        }
+    }
+    free(numers);
+    free(results);
+    free(pool);
+}
+#endif
+
 static const uint32_t *random_data(unsigned multiple) {
 #if LIBDIVIDE_WINDOWS
     uint32_t *data = (uint32_t *)malloc(multiple * ITERATIONS * sizeof *data);
 #else
-    /* Linux doesn't always give us data sufficiently aligned for SSE, so we can't use malloc(). */
+    /* Linux doesn't always give us data sufficiently aligned for SSE or AVX, so we can't use malloc(). */
     void *ptr = NULL;
-    posix_memalign(&ptr, 16, multiple * ITERATIONS * sizeof(uint32_t));
+    posix_memalign(&ptr, 64, multiple * ITERATIONS * sizeof(uint32_t));
     uint32_t *data = (uint32_t *)ptr;
 #endif
     uint32_t i;
@@ -1395,29 +8922,115 @@ int main(int argc, char* argv[]) {
 #if LIBDIVIDE_WINDOWS
     QueryPerformanceFrequency(&gPerfCounterFreq);
 #endif
-    int i, u32 = 0, u64 = 0, s32 = 0, s64 = 0;
+    int i, u8 = 0, s8 = 0, u16 = 0, s16 = 0, u32 = 0, u64 = 0, s32 = 0, s64 = 0, u128 = 0, s128 = 0, rotate = 0, gen = 0, cache = 0, threads = 0;
     if (argc == 1) {
         /* Test all */
-        u32 = u64 = s32 = s64 = 1;
+        u8 = s8 = u16 = s16 = u32 = u64 = s32 = s64 = u128 = s128 = 1;
     }
     else {
         for (i=1; i < argc; i++) {
-            if (! strcmp(argv[i], "u32")) u32 = 1;
+            if (! strcmp(argv[i], "u8")) u8 = 1;
+            else if (! strcmp(argv[i], "s8")) s8 = 1;
+            else if (! strcmp(argv[i], "u16")) u16 = 1;
+            else if (! strcmp(argv[i], "s16")) s16 = 1;
+            else if (! strcmp(argv[i], "u32")) u32 = 1;
             else if (! strcmp(argv[i], "u64")) u64 = 1;
             else if (! strcmp(argv[i], "s32")) s32 = 1;
             else if (! strcmp(argv[i], "s64")) s64 = 1;
+            else if (! strcmp(argv[i], "u128")) u128 = 1;
+            else if (! strcmp(argv[i], "s128")) s128 = 1;
+            else if (! strcmp(argv[i], "rotate")) rotate = 1;
+            else if (! strcmp(argv[i], "gen")) gen = 1;
+            else if (! strcmp(argv[i], "cache")) cache = 1;
+            else if (! strcmp(argv[i], "threads")) threads = 1;
             else printf("Unknown test '%s'\n", argv[i]), exit(0);
         }
     }
+    if (cache) {
+        /* The cache test has the 64 bit types, which is all the caches come in, and stands alone */
+#if CACHE_TEST
+        test_cache();
+#else
+        printf("The cache test needs the __atomic builtins and pthreads\n");
+#endif
+        return 0;
+    }
+    if (threads) {
+        /* The threads test stands alone too, with the types that have parallel array functions */
+#if THREADS_TEST
+        if (! (u32 || s32 || u64 || s64)) u32 = s32 = u64 = s64 = 1;
+        test_threads(u32, s32, u64, s64);
+#else
+        printf("The threads test needs the __atomic builtins and pthreads\n");
+#endif
+        return 0;
+    }
+    if (rotate) {
+        /* The rotate test only has the types with branchfree dividers, and runs all of them unless told otherwise */
+        if (! (u32 || s32 || u64 || s64)) u32 = s32 = u64 = s64 = 1;
+        u8 = s8 = u16 = s16 = u128 = s128 = 0;
+        report_rotate_header();
+    }
+    else if (gen) {
+        /* Likewise the gen test, for the types with batch generation */
+        if (! (u32 || s32 || u64 || s64)) u32 = s32 = u64 = s64 = 1;
+        u8 = s8 = u16 = s16 = u128 = s128 = 0;
+        report_gen_header();
+    }
+#if LIBDIVIDE_USE_DISPATCH
+    {
+        static const char * const isaNames[] = {"sse2", "avx2", "avx512"};
+        printf("array functions use %s\n", isaNames[libdivide_get_isa()]);
+    }
+#endif
     const uint32_t *data = NULL;
+    uint32_t *multiples = NULL;
     data = random_data(1);
-    if (u32) test_many_u32(data);
-    if (s32) test_many_s32((const int32_t *)data);
+    multiples = (uint32_t *)random_data(1);
+    if (u8) test_many_u8((const uint8_t *)data);
+    if (s8) test_many_s8((const int8_t *)data);
+    if (u16) test_many_u16((const uint16_t *)data);
+    if (s16) test_many_s16((const int16_t *)data);
+    if (rotate) {
+        if (u32) test_rotate_u32(data);
+        if (s32) test_rotate_s32((const int32_t *)data);
+    }
+    else if (gen) {
+        if (u32) test_gen_u32(data);
+        if (s32) test_gen_s32((const int32_t *)data);
+    }
+    else {
+        if (u32) test_many_u32(data, multiples);
+        if (s32) test_many_s32((const int32_t *)data, (int32_t *)multiples);
+    }
     free((void *)data);
+    free(multiples);
 
     data = random_data(2);
-    if (u64) test_many_u64((const uint64_t *)data);
-    if (s64) test_many_s64((const int64_t *)data);
+    multiples = (uint32_t *)random_data(2);
+    if (rotate) {
+        if (u64) test_rotate_u64((const uint64_t *)data);
+        if (s64) test_rotate_s64((const int64_t *)data);
+    }
+    else if (gen) {
+        if (u64) test_gen_u64((const uint64_t *)data);
+        if (s64) test_gen_s64((const int64_t *)data);
+    }
+    else {
+        if (u64) test_many_u64((const uint64_t *)data, (uint64_t *)multiples);
+        if (s64) test_many_s64((const int64_t *)data, (int64_t *)multiples);
+    }
     free((void *)data);
+    free(multiples);
+
+#if HAS_INT128_T
+    data = random_data(4);
+    if (u128) test_many_u128((const __uint128_t *)data);
+    if (s128) test_many_s128((const __int128_t *)data);
+    free((void *)data);
+#else
+    (void)u128;
+    (void)s128;
+#endif
     return 0;
 }
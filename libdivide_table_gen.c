@@ -0,0 +1,58 @@
+/* Writes libdivide_table.h, the dividers for the divisors 1 to n that libdivide_u32_get, libdivide_s32_get and libdivide_u64_get read instead of generating when LIBDIVIDE_USE_TABLE is set.  "make table" runs it; by hand it is "table_gen n > libdivide_table.h".  n has to be given, so that a Makefile can pass its own TABLE_SIZE and remake the table when that changes. */
+#undef LIBDIVIDE_USE_TABLE
+#define LIBDIVIDE_API
+#include "libdivide.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+using namespace libdivide;
+#endif
+
+int main(int argc, char *argv[]) {
+    unsigned long long n = 0, d;
+    if (argc > 1) n = strtoull(argv[1], NULL, 10);
+    /* The table is indexed by the positive divisors, so n can go as far as the s32 table can */
+    if (argc != 2 || n < 1 || n > INT32_MAX) {
+        fprintf(stderr, "usage: table_gen n > libdivide_table.h, where n, the table size, is from 1 to %ld\n", (long)INT32_MAX);
+        return 1;
+    }
+
+    /* The header declares the tables, and defines them only where LIBDIVIDE_TABLE_IMPLEMENTATION is set, so that a program has one copy however many files include it.  The entries hold the magic number and the more byte, and the divisor is the index plus 1.  The 32 bit ones are packed into 8 bytes, magic low, and the 64 bit ones take 16, aligned so that none straddles a cache line. */
+    printf("/* Generated by libdivide_table_gen.c: the dividers for the divisors 1 to %llu, which libdivide_*_get read from here rather than making.  Define LIBDIVIDE_TABLE_IMPLEMENTATION in one source file before including libdivide.h to define the tables there.  Don't edit. */\n\n", n);
+    printf("#ifndef LIBDIVIDE_TABLE_H\n#define LIBDIVIDE_TABLE_H\n\n");
+    printf("#define LIBDIVIDE_TABLE_SIZE %lluU\n\n", n);
+    printf("#ifdef __cplusplus\nextern \"C\" {\n#endif\n");
+    printf("extern const uint64_t libdivide_u32_table[LIBDIVIDE_TABLE_SIZE];\n");
+    printf("extern const uint64_t libdivide_s32_table[LIBDIVIDE_TABLE_SIZE];\n");
+    printf("extern const uint64_t libdivide_u64_table[LIBDIVIDE_TABLE_SIZE][2];\n");
+    printf("#ifdef __cplusplus\n}\n#endif\n\n");
+    printf("#ifdef LIBDIVIDE_TABLE_IMPLEMENTATION\n");
+    printf("#if defined(_MSC_VER)\n#define LIBDIVIDE_TABLE_ALIGN __declspec(align(16))\n#else\n#define LIBDIVIDE_TABLE_ALIGN __attribute__((__aligned__(16)))\n#endif\n\n");
+    printf("#ifdef __cplusplus\nextern \"C\" {\n#endif\n");
+
+    printf("const uint64_t libdivide_u32_table[LIBDIVIDE_TABLE_SIZE] = {\n");
+    for (d = 1; d <= n; d++) {
+        const struct libdivide_u32_t denom = libdivide_u32_gen((uint32_t)d);
+        printf("    0x%02x%08lxULL,\n", denom.more, (unsigned long)denom.magic);
+    }
+    printf("};\n\n");
+
+    /* The magic numbers of positive divisors can be negative, and are written as their bits */
+    printf("const uint64_t libdivide_s32_table[LIBDIVIDE_TABLE_SIZE] = {\n");
+    for (d = 1; d <= n; d++) {
+        const struct libdivide_s32_t denom = libdivide_s32_gen((int32_t)d);
+        printf("    0x%02x%08lxULL,\n", denom.more, (unsigned long)(uint32_t)denom.magic);
+    }
+    printf("};\n\n");
+
+    printf("LIBDIVIDE_TABLE_ALIGN const uint64_t libdivide_u64_table[LIBDIVIDE_TABLE_SIZE][2] = {\n");
+    for (d = 1; d <= n; d++) {
+        const struct libdivide_u64_t denom = libdivide_u64_gen((uint64_t)d);
+        printf("    {0x%016llxULL, 0x%02x},\n", (unsigned long long)denom.magic, denom.more);
+    }
+    printf("};\n");
+    printf("#ifdef __cplusplus\n}\n#endif\n");
+    printf("#endif\n\n#endif\n");
+    return 0;
+}
@@ -1,3 +1,6 @@
+/* this program is the one file that defines the divider table, when LIBDIVIDE_USE_TABLE reads it, and tests the thread pool, which is already linked with pthreads */
+#define LIBDIVIDE_USE_THREADS 1
+#define LIBDIVIDE_TABLE_IMPLEMENTATION 1
 #include "libdivide.h"
 #include <limits.h>
 #include <limits>
@@ -7,6 +10,7 @@
 #include <time.h>
 #include <iostream>
 #include <typeinfo>
+#include <algorithm>
 
 #ifdef LIBDIVIDE_USE_SSE2
 #include <emmintrin.h>
@@ -43,6 +47,20 @@ protected:
 
 };
 
+/* DivideTest and GatherIndex take the vector types as template arguments too, as libdivide.h's templates do, so turn off the same warning */
+#if defined(__clang__) || __GNUC__ >= 6
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
+
+/* The per lane gathers take 32 bit indices, so the 64 bit ones take a vector half the width of the numerators */
+template<typename V, size_t LaneSize> struct GatherIndex { typedef V type; };
+#if LIBDIVIDE_USE_AVX2
+template<> struct GatherIndex<__m256i, 8> { typedef __m128i type; };
+#endif
+#if LIBDIVIDE_USE_AVX512
+template<> struct GatherIndex<__m512i, 8> { typedef __m256i type; };
+#endif
+
 template<typename T
 #if defined(LIBDIVIDE_VEC64)
     , typename V64
@@ -53,6 +71,9 @@ template<typename T
 #if defined(LIBDIVIDE_VEC256)
     , typename V256
 #endif
+#if defined(LIBDIVIDE_VEC512)
+    , typename V512
+#endif
 >
 class DivideTest : private DivideTest_PRNG {
 
@@ -79,7 +100,7 @@ private:
         return result;
     }
 
-    void test_one(T numer, T denom, const divider<T> & the_divider) {
+    void test_one(T numer, T denom, const divider<T> & the_divider, const divisibility<T> & the_divisibility) {
         T expect = numer / denom;
         T actual1 = numer / the_divider;
         T actual2 = (T)-1;
@@ -111,9 +132,24 @@ private:
         else {
 //            cout << "Unswitched Success for " << numer << " / " << denom << " = " << actual2 << endl;
         }
+
+        T expect_rem = numer % denom;
+        T actual_rem = numer % the_divider;
+        divmod_result<T> both = divmod(numer, the_divider);
+        if (actual_rem != expect_rem || both.quot != expect || both.rem != expect_rem) {
+            cout << "Remainder failure for " << (typeid(T).name()) << ": " <<  numer << " % " << denom << " expected " << expect_rem << " actual " << actual_rem << " and " << both.quot << ", " << both.rem << endl;
+            while (1) ;
+        }
+
+        /* Random numerators are rarely multiples, so also try the multiple of denom nearest to zero */
+        T multiple = numer - expect_rem;
+        if (is_divisible(numer, the_divisibility) != (expect_rem == 0) || ! is_divisible(multiple, the_divisibility)) {
+            cout << "Divisibility failure for " << (typeid(T).name()) << ": " <<  numer << " and " << multiple << " by " << denom << endl;
+            while (1) ;
+        }
     }
 #if defined(LIBDIVIDE_VEC64)
-    void test_vec64(const T *numers, T denom, const divider<T> & the_divider) {
+    void test_vec64(const T *numers, T denom, const divider<T> & the_divider, const divisibility<T> & the_divisibility) {
         enum { NumElements = sizeof(V64)/sizeof(T) };
 #if LIBDIVIDE_VC
         _declspec(align(8)) T results[NumElements];
@@ -122,7 +158,19 @@ private:
 #endif
         V64 numerVector; memcpy(&numerVector, numers, sizeof(V64));
         V64 resultVector = numerVector / the_divider;
-        *(V64*)results = resultVector;
+        memcpy(results, &resultVector, sizeof(V64));
+        T remainders[NumElements];
+        V64 remainderVector = numerVector % the_divider;
+        memcpy(remainders, &remainderVector, sizeof(V64));
+        T masks[NumElements], multiples[NumElements], multipleMasks[NumElements];
+        V64 maskVector = is_divisible(numerVector, the_divisibility);
+        memcpy(masks, &maskVector, sizeof(V64));
+        for (int j=0; j < NumElements; j++) {
+            multiples[j] = numers[j] - numers[j] % denom;
+        }
+        V64 multipleVector; memcpy(&multipleVector, multiples, sizeof(V64));
+        maskVector = is_divisible(multipleVector, the_divisibility);
+        memcpy(multipleMasks, &maskVector, sizeof(V64));
         int i;
         for (i=0; i < NumElements; i++) {
             T numer = numers[i];
@@ -132,6 +180,14 @@ private:
                 cout << "Vector failure for " << (typeid(T).name()) << ": " <<  numer << " / " << denom << " expected " << expect << " actual " << actual << endl;
                 while (1) ;
             }
+            if (remainders[i] != numer % denom) {
+                cout << "Vector remainder failure for " << (typeid(T).name()) << ": " <<  numer << " % " << denom << " expected " << numer % denom << " actual " << remainders[i] << endl;
+                while (1) ;
+            }
+            if (masks[i] != (numer % denom == 0 ? (T)-1 : 0) || multipleMasks[i] != (T)-1) {
+                cout << "Vector divisibility failure for " << (typeid(T).name()) << ": " <<  numer << " by " << denom << endl;
+                while (1) ;
+            }
             else {
                 //cout << "Vector success for " << numer << " / " << denom << " = " << actual << " (" << i << ")" << endl;
             }
@@ -139,7 +195,7 @@ private:
     }
 #endif
 #if defined(LIBDIVIDE_VEC128)
-    void test_vec128(const T *numers, T denom, const divider<T> & the_divider) {
+    void test_vec128(const T *numers, T denom, const divider<T> & the_divider, const divisibility<T> & the_divisibility) {
         enum { NumElements = sizeof(V128)/sizeof(T) };
 #if LIBDIVIDE_VC
         _declspec(align(16)) T results[NumElements];
@@ -148,7 +204,19 @@ private:
 #endif
         V128 numerVector; memcpy(&numerVector, numers, sizeof(V128));
         V128 resultVector = numerVector / the_divider;
-        *(V128*)results = resultVector;
+        memcpy(results, &resultVector, sizeof(V128));
+        T remainders[NumElements];
+        V128 remainderVector = numerVector % the_divider;
+        memcpy(remainders, &remainderVector, sizeof(V128));
+        T masks[NumElements], multiples[NumElements], multipleMasks[NumElements];
+        V128 maskVector = is_divisible(numerVector, the_divisibility);
+        memcpy(masks, &maskVector, sizeof(V128));
+        for (int j=0; j < NumElements; j++) {
+            multiples[j] = numers[j] - numers[j] % denom;
+        }
+        V128 multipleVector; memcpy(&multipleVector, multiples, sizeof(V128));
+        maskVector = is_divisible(multipleVector, the_divisibility);
+        memcpy(multipleMasks, &maskVector, sizeof(V128));
         int i;
         for (i=0; i < NumElements; i++) {
             T numer = numers[i];
@@ -158,6 +226,14 @@ private:
                 cout << "Vector failure for " << (typeid(T).name()) << ": " <<  numer << " / " << denom << " expected " << expect << " actual " << actual << endl;
                 while (1) ;
             }
+            if (remainders[i] != numer % denom) {
+                cout << "Vector remainder failure for " << (typeid(T).name()) << ": " <<  numer << " % " << denom << " expected " << numer % denom << " actual " << remainders[i] << endl;
+                while (1) ;
+            }
+            if (masks[i] != (numer % denom == 0 ? (T)-1 : 0) || multipleMasks[i] != (T)-1) {
+                cout << "Vector divisibility failure for " << (typeid(T).name()) << ": " <<  numer << " by " << denom << endl;
+                while (1) ;
+            }
             else {
                 //cout << "Vector success for " << numer << " / " << denom << " = " << actual << " (" << i << ")" << endl;
             }
@@ -165,7 +241,7 @@ private:
     }
 #endif
 #if defined(LIBDIVIDE_VEC256)
-    void test_vec256(const T *numers, T denom, const divider<T> & the_divider) {
+    void test_vec256(const T *numers, T denom, const divider<T> & the_divider, const divisibility<T> & the_divisibility) {
         enum { NumElements = sizeof(V256)/sizeof(T) };
 #if LIBDIVIDE_VC
         _declspec(align(32)) T results[NumElements];
@@ -174,7 +250,19 @@ private:
 #endif
         V256 numerVector; memcpy(&numerVector, numers, sizeof(V256));
         V256 resultVector = numerVector / the_divider;
-        *(V256*)results = resultVector;
+        memcpy(results, &resultVector, sizeof(V256));
+        T remainders[NumElements];
+        V256 remainderVector = numerVector % the_divider;
+        memcpy(remainders, &remainderVector, sizeof(V256));
+        T masks[NumElements], multiples[NumElements], multipleMasks[NumElements];
+        V256 maskVector = is_divisible(numerVector, the_divisibility);
+        memcpy(masks, &maskVector, sizeof(V256));
+        for (int j=0; j < NumElements; j++) {
+            multiples[j] = numers[j] - numers[j] % denom;
+        }
+        V256 multipleVector; memcpy(&multipleVector, multiples, sizeof(V256));
+        maskVector = is_divisible(multipleVector, the_divisibility);
+        memcpy(multipleMasks, &maskVector, sizeof(V256));
         int i;
         for (i=0; i < NumElements; i++) {
             T numer = numers[i];
@@ -184,201 +272,1486 @@ private:
                 cout << "Vector failure for " << (typeid(T).name()) << ": " <<  numer << " / " << denom << " expected " << expect << " actual " << actual << endl;
                 while (1) ;
             }
+            if (remainders[i] != numer % denom) {
+                cout << "Vector remainder failure for " << (typeid(T).name()) << ": " <<  numer << " % " << denom << " expected " << numer % denom << " actual " << remainders[i] << endl;
+                while (1) ;
+            }
+            if (masks[i] != (numer % denom == 0 ? (T)-1 : 0) || multipleMasks[i] != (T)-1) {
+                cout << "Vector divisibility failure for " << (typeid(T).name()) << ": " <<  numer << " by " << denom << endl;
+                while (1) ;
+            }
             else {
                 //cout << "Vector success for " << numer << " / " << denom << " = " << actual << " (" << i << ")" << endl;
             }
         }
     }
 #endif
-    void test_many(T denom) {
-        const divider<T> the_divider = divider<T>(denom);
-        size_t j;
-        for (j=0; j < 100000 / 8; j++) {
-            T numers[8] = {(T)this->next_random(), (T)this->next_random(), (T)this->next_random(), (T)this->next_random(), (T)this->next_random(), (T)this->next_random(), (T)this->next_random(), (T)this->next_random()};
-            test_one(numers[0], denom, the_divider);
-            test_one(numers[1], denom, the_divider);
-            test_one(numers[2], denom, the_divider);
-            test_one(numers[3], denom, the_divider);
-            test_one(numers[4], denom, the_divider);
-            test_one(numers[5], denom, the_divider);
-            test_one(numers[6], denom, the_divider);
-            test_one(numers[7], denom, the_divider);
-#if defined(LIBDIVIDE_VEC64)
-            test_vec64(numers+0, denom, the_divider);
-            test_vec64(numers+2, denom, the_divider);
-            test_vec64(numers+4, denom, the_divider);
-            test_vec64(numers+6, denom, the_divider);
-#endif
-#if defined(LIBDIVIDE_VEC128)
-            test_vec128(numers+0, denom, the_divider);
-            test_vec128(numers+4, denom, the_divider);
-#endif
-#if defined(LIBDIVIDE_VEC256)
-            test_vec256(numers, denom, the_divider);
+#if defined(LIBDIVIDE_VEC512)
+    void test_vec512(const T *numers, T denom, const divider<T> & the_divider, const divisibility<T> & the_divisibility) {
+        /* A 512 bit vector of 32 bit values holds more numerators than test_many generates at once, so the rest are made up here */
+        enum { NumElements = sizeof(V512)/sizeof(T) };
+        T inputs[NumElements], results[NumElements];
+        int i;
+        for (i=0; i < NumElements; i++) {
+            inputs[i] = i < 8 ? numers[i] : (T)this->next_random();
+        }
+        V512 numerVector; memcpy(&numerVector, inputs, sizeof(V512));
+        V512 resultVector = numerVector / the_divider;
+        memcpy(results, &resultVector, sizeof(V512));
+        T remainders[NumElements];
+        V512 remainderVector = numerVector % the_divider;
+        memcpy(remainders, &remainderVector, sizeof(V512));
+        T masks[NumElements], multiples[NumElements], multipleMasks[NumElements];
+        __mmask16 maskBits = is_divisible(numerVector, the_divisibility);
+        for (i=0; i < NumElements; i++) {
+            masks[i] = (maskBits >> i) & 1 ? (T)-1 : 0;
+            multiples[i] = inputs[i] - inputs[i] % denom;
+        }
+        V512 multipleVector; memcpy(&multipleVector, multiples, sizeof(V512));
+        maskBits = is_divisible(multipleVector, the_divisibility);
+        for (i=0; i < NumElements; i++) {
+            multipleMasks[i] = (maskBits >> i) & 1 ? (T)-1 : 0;
+        }
+        for (i=0; i < NumElements; i++) {
+            T numer = inputs[i];
+            T actual = results[i];
+            T expect = numer / denom;
+            if (actual != expect) {
+                cout << "Vector failure for " << (typeid(T).name()) << ": " <<  numer << " / " << denom << " expected " << expect << " actual " << actual << endl;
+                while (1) ;
+            }
+            if (remainders[i] != numer % denom) {
+                cout << "Vector remainder failure for " << (typeid(T).name()) << ": " <<  numer << " % " << denom << " expected " << numer % denom << " actual " << remainders[i] << endl;
+                while (1) ;
+            }
+            if (masks[i] != (numer % denom == 0 ? (T)-1 : 0) || multipleMasks[i] != (T)-1) {
+                cout << "Vector divisibility failure for " << (typeid(T).name()) << ": " <<  numer << " by " << denom << endl;
+                while (1) ;
+            }
+        }
+    }
 #endif
+    template<typename U>
+    void check_fastmod(U numer, U denom, U actual) {
+        if (actual != numer % denom) {
+            cout << "Fastmod failure for " << (typeid(U).name()) << ": " <<  numer << " % " << denom << " expected " << numer % denom << " actual " << actual << endl;
+            while (1) ;
         }
-        const T min = std::numeric_limits<T>::min(), max = std::numeric_limits<T>::max();
-        const T wellKnownNumers[] = {0, max, max-1, max/2, max/2 - 1, min, min/2, min/4, 1, 2, 3, 4, 5, 6, 7, 8, 10, 36847, 50683, SHRT_MAX};
-        for (j=0; j < sizeof wellKnownNumers / sizeof *wellKnownNumers; j++) {
-            if (wellKnownNumers[j] == 0 && j != 0) continue;
-            test_one(wellKnownNumers[j], denom, the_divider);
+    }
+
+    template<typename U>
+    void test_fastmod_of(U denom, const U *numers) {
+        const fastmod_divider<U> fm(denom);
+        const U extra[] = {0, 1, std::numeric_limits<U>::max(), (U)(denom - 1), denom};
+        size_t i;
+        for (i=0; i < 8; i++) {
+            check_fastmod(numers[i], denom, numers[i] % fm);
         }
-        T powerOf2Numer = 1;
-        while (powerOf2Numer) {
-            test_one(powerOf2Numer, denom, the_divider);
-            powerOf2Numer <<= 1;
+        for (i=0; i < sizeof extra / sizeof *extra; i++) {
+            check_fastmod(extra[i], denom, extra[i] % fm);
+        }
+        /* All 8 numerators, and the last 7 for a tail */
+        U array[8];
+        fm.perform_mod_array(numers, array, 8);
+        for (i=0; i < 8; i++) {
+            check_fastmod(numers[i], denom, array[i]);
+        }
+        fm.perform_mod_array(numers + 1, array, 7);
+        for (i=0; i < 7; i++) {
+            check_fastmod(numers[i + 1], denom, array[i]);
         }
+#if LIBDIVIDE_USE_SSE2
+        U remainders[32 / sizeof(U)];
+        __m128i vec128; memcpy(&vec128, numers, sizeof vec128);
+        vec128 = vec128 % fm;
+        memcpy(remainders, &vec128, sizeof vec128);
+        for (i=0; i < sizeof vec128 / sizeof(U); i++) {
+            check_fastmod(numers[i], denom, remainders[i]);
+        }
+#endif
+#if LIBDIVIDE_USE_AVX2
+        __m256i vec256; memcpy(&vec256, numers, sizeof vec256);
+        vec256 = vec256 % fm;
+        memcpy(remainders, &vec256, sizeof vec256);
+        for (i=0; i < sizeof vec256 / sizeof(U); i++) {
+            check_fastmod(numers[i], denom, remainders[i]);
+        }
+#endif
     }
 
-public:
-    void run(void) {
-        unsigned i;
-        for (i=0; i < 100000; i++) {
-            T denom = random_denominator();
-            test_many(denom);
-            //cout << typeid(T).name() << "\t\t" << i << " / " << 100000 << endl;
+    /* fastmod only exists for the unsigned types */
+    void test_fastmod(uint32_t denom, const uint32_t *numers) { test_fastmod_of(denom, numers); }
+    void test_fastmod(uint64_t denom, const uint64_t *numers) { test_fastmod_of(denom, numers); }
+    template<typename U>
+    void test_fastmod(U, const U *) { }
+
+    /* Checks a floored quotient and a Euclidean remainder against ones fixed up from / and %.  UnsignedU does the arithmetic that wraps, as the quotient does for min / -1. */
+    template<typename U, typename UnsignedU>
+    void check_floor(U numer, U denom, U quot, U rem) {
+        U expect = (U)(0 - (UnsignedU)numer), expect_rem = 0;
+        if (denom != (U)-1) {
+            expect = numer / denom;
+            expect_rem = numer % denom;
+            if (expect_rem != 0 && (expect_rem < 0) != (denom < 0)) {
+                expect -= 1;
+                expect_rem += denom;
+            }
+            if (expect_rem < 0) expect_rem = (U)((UnsignedU)expect_rem - (UnsignedU)denom);
         }
-        T powerOf2Denom = 1;
-        while (powerOf2Denom) {
-            test_many(powerOf2Denom);
-            powerOf2Denom <<= 1;
+        if (quot != expect || rem != expect_rem) {
+            cout << "Floor failure for " << (typeid(U).name()) << ": " <<  numer << " / " << denom << " expected " << expect << ", " << expect_rem << " actual " << quot << ", " << rem << endl;
+            while (1) ;
         }
     }
-};
 
-static int sRunU32, sRunU64, sRunS32, sRunS64;
+    template<typename U, typename UnsignedU, typename V>
+    void test_floor_vec(const U *numers, U denom, const divider<U> & the_divider) {
+        enum { NumElements = 64 / sizeof(U) };
+        U quots[NumElements], rems[NumElements];
+        size_t i;
+        for (i=0; i < NumElements; i += sizeof(V) / sizeof(U)) {
+            V vec; memcpy(&vec, numers + i, sizeof vec);
+            V quot = floor_div(vec, the_divider), rem = mod_euclid(vec, the_divider);
+            memcpy(quots + i, &quot, sizeof quot);
+            memcpy(rems + i, &rem, sizeof rem);
+        }
+        for (i=0; i < NumElements; i++) {
+            check_floor<U, UnsignedU>(numers[i], denom, quots[i], rems[i]);
+        }
+    }
 
-static void *perform_test(void *ptr) {
-    intptr_t idx = (intptr_t)ptr;
-    switch (idx) {
-        case 0:
-        {
-            if (! sRunS32) break;
-            puts("Starting int32_t");
-            DivideTest<int32_t
+    template<typename U, typename UnsignedU, typename DenomType>
+    void test_floor_of(U denom, const U *numers, const divider<U> & the_divider, U floor_alg(U, const DenomType *), const DenomType *unswitched) {
+        enum { NumElements = 64 / sizeof(U) };
+        const U extra[] = {0, 1, (U)-1, std::numeric_limits<U>::max(), std::numeric_limits<U>::min(), denom, (U)(0 - (UnsignedU)denom)};
+        U values[NumElements];
+        size_t i;
+        for (i=0; i < NumElements; i++) {
+            values[i] = i < 8 ? numers[i] : extra[i % (sizeof extra / sizeof *extra)];
+            check_floor<U, UnsignedU>(values[i], denom, floor_div(values[i], the_divider), mod_euclid(values[i], the_divider));
+            check_floor<U, UnsignedU>(values[i], denom, floor_alg(values[i], unswitched), mod_euclid(values[i], the_divider));
+        }
 #if defined(LIBDIVIDE_VEC64)
-                , libdivide_2s32_t
+        test_floor_vec<U, UnsignedU, V64>(values, denom, the_divider);
 #endif
 #if defined(LIBDIVIDE_VEC128)
-                , libdivide_4s32_t
+        test_floor_vec<U, UnsignedU, V128>(values, denom, the_divider);
 #endif
 #if defined(LIBDIVIDE_VEC256)
-                , libdivide_8s32_t
+        test_floor_vec<U, UnsignedU, V256>(values, denom, the_divider);
 #endif
-            > dt;
-            dt.run();
+#if defined(LIBDIVIDE_VEC512)
+        test_floor_vec<U, UnsignedU, V512>(values, denom, the_divider);
+#endif
+    }
+
+    /* Floor division only exists for the signed types.  The C functions are the only way to reach its unswitched algorithms. */
+    void test_floor(int32_t denom, const int32_t *numers, const divider<int32_t> & the_divider) {
+        int32_t (* const algs[])(int32_t, const struct libdivide_s32_t *) = {libdivide_s32_do_floor_alg0, libdivide_s32_do_floor_alg1, libdivide_s32_do_floor_alg2, libdivide_s32_do_floor_alg3, libdivide_s32_do_floor_alg4};
+        const struct libdivide_s32_t unswitched = libdivide_s32_gen(denom);
+        test_floor_of<int32_t, uint32_t>(denom, numers, the_divider, algs[libdivide_s32_get_algorithm(&unswitched)], &unswitched);
+    }
+    void test_floor(int64_t denom, const int64_t *numers, const divider<int64_t> & the_divider) {
+        int64_t (* const algs[])(int64_t, const struct libdivide_s64_t *) = {libdivide_s64_do_floor_alg0, libdivide_s64_do_floor_alg1, libdivide_s64_do_floor_alg2, libdivide_s64_do_floor_alg3, libdivide_s64_do_floor_alg4};
+        const struct libdivide_s64_t unswitched = libdivide_s64_gen(denom);
+        test_floor_of<int64_t, uint64_t>(denom, numers, the_divider, algs[libdivide_s64_get_algorithm(&unswitched)], &unswitched);
+    }
+    template<typename U>
+    void test_floor(U, const U *, const divider<U> &) { }
+
+    /* Checks a ceiling and a rounded quotient against ones fixed up from / and %, comparing 2|r| with |d| as |r| >= |d| - |r| so that nothing overflows. */
+    template<typename U, typename UnsignedU>
+    void check_rounding(U numer, U denom, U ceil, U round) {
+        U expect = (U)(0 - (UnsignedU)numer), rem = 0;
+        if (! std::numeric_limits<U>::is_signed || denom != (U)-1) {
+            expect = numer / denom;
+            rem = numer % denom;
         }
-        break;
+        const bool up = (rem > 0) == (denom > 0);
+        const U expect_ceil = rem != 0 && up ? expect + 1 : expect;
+        const UnsignedU abs_rem = rem > 0 ? (UnsignedU)rem : 0 - (UnsignedU)rem, abs_denom = denom > 0 ? (UnsignedU)denom : 0 - (UnsignedU)denom;
+        const U expect_round = abs_rem != 0 && abs_rem >= abs_denom - abs_rem ? (up ? expect + 1 : expect - 1) : expect;
+        if (ceil != expect_ceil || round != expect_round) {
+            cout << "Rounding failure for " << (typeid(U).name()) << ": " <<  numer << " / " << denom << " expected " << expect_ceil << ", " << expect_round << " actual " << ceil << ", " << round << endl;
+            while (1) ;
+        }
+    }
 
-        case 1:
-        {
-            if (! sRunU32) break;
-            puts("Starting uint32_t");
-            DivideTest<uint32_t
+    template<typename U, typename UnsignedU, typename V>
+    void test_rounding_vec(const U *numers, U denom, const divider<U> & the_divider) {
+        enum { NumElements = 64 / sizeof(U) };
+        U ceils[NumElements], rounds[NumElements];
+        size_t i;
+        for (i=0; i < NumElements; i += sizeof(V) / sizeof(U)) {
+            V vec; memcpy(&vec, numers + i, sizeof vec);
+            V ceil = ceil_div(vec, the_divider), round = round_div(vec, the_divider);
+            memcpy(ceils + i, &ceil, sizeof ceil);
+            memcpy(rounds + i, &round, sizeof round);
+        }
+        for (i=0; i < NumElements; i++) {
+            check_rounding<U, UnsignedU>(numers[i], denom, ceils[i], rounds[i]);
+        }
+    }
+
+    template<typename U, typename UnsignedU>
+    void test_rounding_of(U denom, const U *numers, const divider<U> & the_divider) {
+        enum { NumElements = 64 / sizeof(U) };
+        const U max = std::numeric_limits<U>::max(), min = std::numeric_limits<U>::min();
+        const U extra[] = {0, 1, (U)-1, max, (U)(max - 1), min, (U)(min + 1), denom, (U)(denom / 2), (U)(denom - denom / 2), (U)(0 - (UnsignedU)(denom / 2)), (U)(max - denom / 2)};
+        U values[NumElements], ceils[NumElements], rounds[NumElements];
+        size_t i;
+        for (i=0; i < NumElements; i++) {
+            values[i] = i < 8 ? numers[i] : extra[i % (sizeof extra / sizeof *extra)];
+            check_rounding<U, UnsignedU>(values[i], denom, ceil_div(values[i], the_divider), round_div(values[i], the_divider));
+        }
+        /* Off by one, so that the arrays have an unaligned head */
+        the_divider.perform_ceil_divide_array(values + 1, ceils + 1, NumElements - 1);
+        the_divider.perform_round_divide_array(values + 1, rounds + 1, NumElements - 1);
+        for (i=1; i < NumElements; i++) {
+            check_rounding<U, UnsignedU>(values[i], denom, ceils[i], rounds[i]);
+        }
 #if defined(LIBDIVIDE_VEC64)
-                , libdivide_2u32_t
+        test_rounding_vec<U, UnsignedU, V64>(values, denom, the_divider);
 #endif
 #if defined(LIBDIVIDE_VEC128)
-                , libdivide_4u32_t
+        test_rounding_vec<U, UnsignedU, V128>(values, denom, the_divider);
 #endif
 #if defined(LIBDIVIDE_VEC256)
-                , libdivide_8u32_t
+        test_rounding_vec<U, UnsignedU, V256>(values, denom, the_divider);
 #endif
-            > dt;
-            dt.run();
+#if defined(LIBDIVIDE_VEC512)
+        test_rounding_vec<U, UnsignedU, V512>(values, denom, the_divider);
+#endif
+    }
+
+    void test_rounding(uint32_t denom, const uint32_t *numers, const divider<uint32_t> & the_divider) { test_rounding_of<uint32_t, uint32_t>(denom, numers, the_divider); }
+    void test_rounding(int32_t denom, const int32_t *numers, const divider<int32_t> & the_divider) { test_rounding_of<int32_t, uint32_t>(denom, numers, the_divider); }
+    void test_rounding(uint64_t denom, const uint64_t *numers, const divider<uint64_t> & the_divider) { test_rounding_of<uint64_t, uint64_t>(denom, numers, the_divider); }
+    void test_rounding(int64_t denom, const int64_t *numers, const divider<int64_t> & the_divider) { test_rounding_of<int64_t, uint64_t>(denom, numers, the_divider); }
+
+    void test_array(T denom, const divider<T> & the_divider) {
+        /* Odd length and offset, so that the unaligned head, the vector body and the tail all get exercised */
+        enum { NumElements = 37 };
+        T numers[NumElements + 1], results[NumElements + 1];
+        int i;
+        for (i=0; i < NumElements + 1; i++) {
+            numers[i] = (T)this->next_random();
         }
-        break;
+        the_divider.perform_divide_array(numers + 1, results + 1, NumElements);
+        for (i=1; i < NumElements + 1; i++) {
+            T numer = numers[i];
+            T actual = results[i];
+            T expect = numer / denom;
+            if (actual != expect) {
+                cout << "Array failure for " << (typeid(T).name()) << ": " <<  numer << " / " << denom << " expected " << expect << " actual " << actual << endl;
+                while (1) ;
+            }
+        }
+    }
 
-        case 2:
-        {
-            if (! sRunS64) break;
-            puts("Starting sint64_t");
-            DivideTest<int64_t
-#if defined(LIBDIVIDE_VEC64)
-                , libdivide_1s64_t
+#if HAS_INT128_T
+    void check_narrow(uint64_t hi, uint64_t lo, uint64_t denom, uint64_t quotient, uint64_t remainder, const char *kind) {
+        const __uint128_t numer = ((__uint128_t)hi << 64) | lo;
+        if (quotient != (uint64_t)(numer / denom) || remainder != (uint64_t)(numer % denom)) {
+            cout << kind << " narrowing failure for {" << hi << ", " << lo << "} / " << denom << " expected " << (uint64_t)(numer / denom) << " remainder " << (uint64_t)(numer % denom) << " actual " << quotient << " remainder " << remainder << endl;
+            while (1) ;
+        }
+    }
+
+    /* Narrowing division of 128 bit numerators whose quotients fit in 64 bits, i.e. with the high half less than denom.  The array is an odd length so that the vector tails get exercised. */
+    void test_narrow(uint64_t denom) {
+        const struct libdivide_u64_narrow_t narrow = libdivide_u64_narrow_gen(denom);
+        enum { NumElements = 37 };
+        uint64_t his[NumElements], los[NumElements], quotients[NumElements], remainders[NumElements];
+        size_t i;
+        /* The reciprocal must be exact, not just close enough for these numerators */
+        if (narrow.reciprocal != (uint64_t)(~(__uint128_t)0 / narrow.divisor)) {
+            cout << "Narrowing reciprocal failure for " << denom << " expected " << (uint64_t)(~(__uint128_t)0 / narrow.divisor) << " actual " << narrow.reciprocal << endl;
+            while (1) ;
+        }
+        for (i=0; i < NumElements; i++) {
+            his[i] = (((uint64_t)this->next_random() << 32) | this->next_random()) % denom;
+            los[i] = ((uint64_t)this->next_random() << 32) | this->next_random();
+        }
+        /* The largest and smallest numerators */
+        his[0] = denom - 1;
+        los[0] = std::numeric_limits<uint64_t>::max();
+        his[1] = 0;
+        los[1] = 0;
+        for (i=0; i < NumElements; i++) {
+            quotients[i] = libdivide_u64_narrow_do(his[i], los[i], &narrow, &remainders[i]);
+            check_narrow(his[i], los[i], denom, quotients[i], remainders[i], "Scalar");
+            check_narrow(his[i], los[i], denom, libdivide_u64_narrow_do(his[i], los[i], &narrow, NULL), remainders[i], "Scalar");
+        }
+#if LIBDIVIDE_USE_AVX2
+        for (i=0; i + 4 <= NumElements; i += 4) {
+            __m256i hi, lo, r;
+            memcpy(&hi, his + i, sizeof hi);
+            memcpy(&lo, los + i, sizeof lo);
+            __m256i q = libdivide_4u64_narrow_do_vector(hi, lo, &narrow, &r);
+            memcpy(quotients + i, &q, sizeof q);
+            memcpy(remainders + i, &r, sizeof r);
+        }
+        for (i=0; i < NumElements / 4 * 4; i++) {
+            check_narrow(his[i], los[i], denom, quotients[i], remainders[i], "Vector");
+        }
 #endif
-#if defined(LIBDIVIDE_VEC128)
-                , libdivide_2s64_t
+#if LIBDIVIDE_USE_AVX512
+        for (i=0; i + 8 <= NumElements; i += 8) {
+            __m512i hi, lo, r;
+            memcpy(&hi, his + i, sizeof hi);
+            memcpy(&lo, los + i, sizeof lo);
+            __m512i q = libdivide_8u64_narrow_do_vector(hi, lo, &narrow, &r);
+            memcpy(quotients + i, &q, sizeof q);
+            memcpy(remainders + i, &r, sizeof r);
+        }
+        for (i=0; i < NumElements / 8 * 8; i++) {
+            check_narrow(his[i], los[i], denom, quotients[i], remainders[i], "Vector");
+        }
 #endif
-#if defined(LIBDIVIDE_VEC256)
-                , libdivide_4s64_t
+        memset(quotients, 0, sizeof quotients);
+        memset(remainders, 0, sizeof remainders);
+        libdivide_u64_narrow_do_array(his, los, quotients, remainders, NumElements, &narrow);
+        for (i=0; i < NumElements; i++) {
+            check_narrow(his[i], los[i], denom, quotients[i], remainders[i], "Array");
+        }
+        /* Without the remainders, which must be left alone */
+        libdivide_u64_narrow_do_array(his, los, quotients, NULL, NumElements, &narrow);
+        for (i=0; i < NumElements; i++) {
+            check_narrow(his[i], los[i], denom, quotients[i], remainders[i], "Array");
+        }
+    }
 #endif
-            > dt;
-            dt.run();
+
+    /* The narrowing division only has a 64 bit divisor */
+    template<typename U>
+    void test_narrow(U) { }
+
+    /* numer rounded towards zero to a multiple of denom, avoiding the overflow of min % -1 */
+    static T multiple_of(T numer, T denom) {
+        if (std::numeric_limits<T>::is_signed && denom == (T)-1) return numer;
+        return numer - numer % denom;
+    }
+
+    void check_exact(const T *numers, const T *results, size_t count, T denom) {
+        const T min = std::numeric_limits<T>::min();
+        size_t i;
+        for (i=0; i < count; i++) {
+            T numer = numers[i];
+            T expect = (std::numeric_limits<T>::is_signed && denom == (T)-1 && numer == min) ? min : numer / denom;
+            if (results[i] != expect) {
+                cout << "Exact failure for " << (typeid(T).name()) << ": " <<  numer << " / " << denom << " expected " << expect << " actual " << results[i] << endl;
+                while (1) ;
+            }
         }
-        break;
+    }
 
-        case 3:
-        {
-            if (! sRunU64) break;
-            puts("Starting uint64_t");
-            DivideTest<uint64_t
+    void test_exact(T denom) {
+        const exact_divider<T> the_divider(denom);
+        enum { NumElements = 64 / sizeof(T) };
+        T numers[NumElements], results[NumElements];
+        size_t i;
+        /* Random multiples of denom, and the ones at the ends of the range */
+        for (i=0; i < NumElements; i++) {
+            uint64_t bits = ((uint64_t)this->next_random() << 32) | this->next_random();
+            numers[i] = multiple_of((T)bits, denom);
+        }
+        numers[0] = 0;
+        numers[1] = denom;
+        numers[2] = multiple_of(std::numeric_limits<T>::max(), denom);
+        numers[3] = multiple_of(std::numeric_limits<T>::min(), denom);
+        for (i=0; i < NumElements; i++) {
+            results[i] = numers[i] / the_divider;
+        }
+        check_exact(numers, results, NumElements, denom);
 #if defined(LIBDIVIDE_VEC64)
-                , libdivide_1u64_t
+        for (i=0; i < NumElements; i += sizeof(V64) / sizeof(T)) {
+            V64 vec; memcpy(&vec, numers + i, sizeof vec);
+            vec = vec / the_divider;
+            memcpy(results + i, &vec, sizeof vec);
+        }
+        check_exact(numers, results, NumElements, denom);
 #endif
 #if defined(LIBDIVIDE_VEC128)
-                , libdivide_2u64_t
+        for (i=0; i < NumElements; i += sizeof(V128) / sizeof(T)) {
+            V128 vec; memcpy(&vec, numers + i, sizeof vec);
+            vec = vec / the_divider;
+            memcpy(results + i, &vec, sizeof vec);
+        }
+        check_exact(numers, results, NumElements, denom);
 #endif
 #if defined(LIBDIVIDE_VEC256)
-                , libdivide_4u64_t
+        for (i=0; i < NumElements; i += sizeof(V256) / sizeof(T)) {
+            V256 vec; memcpy(&vec, numers + i, sizeof vec);
+            vec = vec / the_divider;
+            memcpy(results + i, &vec, sizeof vec);
+        }
+        check_exact(numers, results, NumElements, denom);
 #endif
-            > dt;
-            dt.run();
+#if defined(LIBDIVIDE_VEC512)
+        for (i=0; i < NumElements; i += sizeof(V512) / sizeof(T)) {
+            V512 vec; memcpy(&vec, numers + i, sizeof vec);
+            vec = vec / the_divider;
+            memcpy(results + i, &vec, sizeof vec);
         }
-        break;
+        check_exact(numers, results, NumElements, denom);
+#endif
     }
-    return 0;
-}
 
-#if LIBDIVIDE_WINDOWS
-int wmain(int argc, char* argv[]) {
-#else
-int main(int argc, char* argv[]) {
+    void check_branchfree(const T *numers, const T *results, size_t count, T denom, const char *kind) {
+        const T min = std::numeric_limits<T>::min();
+        size_t i;
+        for (i=0; i < count; i++) {
+            T numer = numers[i];
+            T expect = (std::numeric_limits<T>::is_signed && denom == (T)-1 && numer == min) ? min : numer / denom;
+            if (results[i] != expect) {
+                cout << kind << " branchfree failure for " << (typeid(T).name()) << ": " <<  numer << " / " << denom << " expected " << expect << " actual " << results[i] << endl;
+                while (1) ;
+            }
+        }
+    }
+
+    void test_branchfree(T denom) {
+        /* The unsigned branchfree dividers can't divide by 1 */
+        if (! std::numeric_limits<T>::is_signed && denom == 1) return;
+        const branchfree_divider<T> the_divider(denom);
+        enum { NumElements = 64 / sizeof(T) };
+        const T max = std::numeric_limits<T>::max(), min = std::numeric_limits<T>::min();
+        const T extra[] = {0, 1, (T)-1, max, (T)(max - 1), min, (T)(min + 1), denom, (T)(denom - 1), (T)(denom + 1), (T)(0 - denom)};
+        T numers[NumElements + 1], results[NumElements + 1];
+        size_t i;
+        for (i=0; i < NumElements + 1; i++) {
+            numers[i] = i < sizeof extra / sizeof *extra ? extra[i] : (T)this->next_random();
+        }
+        for (i=0; i < NumElements; i++) {
+            results[i] = numers[i] / the_divider;
+        }
+        check_branchfree(numers, results, NumElements, denom, "Scalar");
+#if LIBDIVIDE_USE_SSE2
+        for (i=0; i < NumElements; i += sizeof(__m128i) / sizeof(T)) {
+            __m128i vec; memcpy(&vec, numers + i, sizeof vec);
+            vec = vec / the_divider;
+            memcpy(results + i, &vec, sizeof vec);
+        }
+        check_branchfree(numers, results, NumElements, denom, "Vector");
 #endif
-    if (argc == 1) {
-        /* Test all */
-        sRunU32 = sRunU64 = sRunS32 = sRunS64 = 1;
+#if LIBDIVIDE_USE_AVX2
+        for (i=0; i < NumElements; i += sizeof(__m256i) / sizeof(T)) {
+            __m256i vec; memcpy(&vec, numers + i, sizeof vec);
+            vec = vec / the_divider;
+            memcpy(results + i, &vec, sizeof vec);
+        }
+        check_branchfree(numers, results, NumElements, denom, "Vector");
+#endif
+#if LIBDIVIDE_USE_AVX512
+        for (i=0; i < NumElements; i += sizeof(__m512i) / sizeof(T)) {
+            __m512i vec; memcpy(&vec, numers + i, sizeof vec);
+            vec = vec / the_divider;
+            memcpy(results + i, &vec, sizeof vec);
+        }
+        check_branchfree(numers, results, NumElements, denom, "Vector");
+#endif
+        /* Off by one, so that the array has an unaligned head */
+        the_divider.perform_divide_array(numers + 1, results + 1, NumElements);
+        check_branchfree(numers + 1, results + 1, NumElements, denom, "Array");
     }
-    else {
-        int i;
-        for (i=1; i < argc; i++) {
-            if (! strcmp(argv[i], "u32")) sRunU32 = 1;
-            else if (! strcmp(argv[i], "u64")) sRunU64 = 1;
-            else if (! strcmp(argv[i], "s32")) sRunS32 = 1;
-            else if (! strcmp(argv[i], "s64")) sRunS64 = 1;
-            else printf("Unknown test '%s'\n", argv[i]), exit(0);
+
+    typedef typename libdivide_internal::branchfree_mid<T>::DenomType BranchfreeType;
+
+    void check_indexed(const T *numers, const uint32_t *indices, const T *denoms, const T *results, size_t count, const char *kind) {
+        const T min = std::numeric_limits<T>::min();
+        size_t i;
+        for (i=0; i < count; i++) {
+            T numer = numers[i], denom = denoms[indices[i]];
+            T expect = (std::numeric_limits<T>::is_signed && denom == (T)-1 && numer == min) ? min : numer / denom;
+            if (results[i] != expect) {
+                cout << kind << " indexed branchfree failure for " << (typeid(T).name()) << ": " <<  numer << " / " << denom << " expected " << expect << " actual " << results[i] << endl;
+                while (1) ;
+            }
+        }
+    }
+
+#if LIBDIVIDE_USE_SSE2
+    template<typename V>
+    void test_gather(const T *numers, const uint32_t *indices, const BranchfreeType *table, T *results, size_t count) {
+        typedef typename GatherIndex<V, sizeof(T)>::type IndexV;
+        const size_t lanes = sizeof(V) / sizeof(T);
+        size_t i;
+        for (i=0; i < count; i += lanes) {
+            V vec; memcpy(&vec, numers + i, sizeof vec);
+            IndexV idx; memset(&idx, 0, sizeof idx); memcpy(&idx, indices + i, lanes * sizeof(uint32_t));
+            vec = libdivide_internal::branchfree_do_gather(vec, idx, table);
+            memcpy(results + i, &vec, sizeof vec);
         }
     }
 
-/* We could use dispatch, but we prefer to use pthreads because dispatch won't run all four tests at once on a two core machine */
+    template<typename V>
+    void test_array_gather(const T *numers, const uint32_t *indices, const divider_array<T> &array, T *results, size_t count) {
+        typedef typename GatherIndex<V, sizeof(T)>::type IndexV;
+        const size_t lanes = sizeof(V) / sizeof(T);
+        size_t i;
+        for (i=0; i < count; i += lanes) {
+            V vec; memcpy(&vec, numers + i, sizeof vec);
+            IndexV idx; memset(&idx, 0, sizeof idx); memcpy(&idx, indices + i, lanes * sizeof(uint32_t));
+            vec = array.perform_divide_gather(vec, idx);
+            memcpy(results + i, &vec, sizeof vec);
+        }
+    }
+#endif
+
+    /* Divide by a table of random divisors, a different one for each numerator */
+    void test_branchfree_indexed(void) {
+        enum { TableSize = 16, NumElements = 64 / sizeof(T) };
+        BranchfreeType table[TableSize];
+        T denoms[TableSize], numers[NumElements + 1], results[NumElements + 1];
+        uint32_t indices[NumElements + 1];
+        size_t i;
+        for (i=0; i < TableSize; i++) {
+            do {
+                denoms[i] = random_denominator() >> (this->next_random() % (8 * sizeof(T)));
+            } while (denoms[i] == 0 || (! std::numeric_limits<T>::is_signed && denoms[i] == 1));
+            table[i] = libdivide_internal::branchfree_gen(denoms[i]);
+        }
+        for (i=0; i < NumElements + 1; i++) {
+            numers[i] = (T)random_denominator();
+            indices[i] = this->next_random() % TableSize;
+        }
+#if LIBDIVIDE_USE_SSE2
+        test_gather<__m128i>(numers, indices, table, results, NumElements);
+        check_indexed(numers, indices, denoms, results, NumElements, "Vector");
+#endif
+#if LIBDIVIDE_USE_AVX2
+        test_gather<__m256i>(numers, indices, table, results, NumElements);
+        check_indexed(numers, indices, denoms, results, NumElements, "Vector");
+#endif
+#if LIBDIVIDE_USE_AVX512
+        test_gather<__m512i>(numers, indices, table, results, NumElements);
+        check_indexed(numers, indices, denoms, results, NumElements, "Vector");
+#endif
+        /* Off by one, so that there is a tail */
+        libdivide_internal::branchfree_do_array_indexed(numers + 1, indices + 1, results + 1, NumElements, table);
+        check_indexed(numers + 1, indices + 1, denoms, results + 1, NumElements, "Array");
+
+        /* The same dividers packed in a divider array, copied so that the copy has to find its own storage, with a divisor of 1, which the arrays allow for the unsigned types too */
+        denoms[0] = 1;
+        const divider_array<T> original(denoms, TableSize);
+        divider_array<T> array;
+        array = original;
+        if (array.size() != TableSize) {
+            cout << "Divider array failure for " << (typeid(T).name()) << ": size " << array.size() << endl;
+            while (1) ;
+        }
+        for (i=0; i < NumElements; i++) {
+            results[i] = array.perform_divide(numers[i], indices[i]);
+        }
+        check_indexed(numers, indices, denoms, results, NumElements, "Divider array");
+#if LIBDIVIDE_USE_SSE2
+        test_array_gather<__m128i>(numers, indices, array, results, NumElements);
+        check_indexed(numers, indices, denoms, results, NumElements, "Divider array vector");
+#endif
+#if LIBDIVIDE_USE_AVX2
+        test_array_gather<__m256i>(numers, indices, array, results, NumElements);
+        check_indexed(numers, indices, denoms, results, NumElements, "Divider array vector");
+#endif
+#if LIBDIVIDE_USE_AVX512
+        test_array_gather<__m512i>(numers, indices, array, results, NumElements);
+        check_indexed(numers, indices, denoms, results, NumElements, "Divider array vector");
+#endif
+        array.perform_divide_indexed(numers + 1, indices + 1, results + 1, NumElements);
+        check_indexed(numers + 1, indices + 1, denoms, results + 1, NumElements, "Divider array");
+    }
+
+    typedef typename libdivide_internal::divider_mid<T>::DenomType DenomType;
+
+    void check_gen(T denom, T magic, uint8_t more, const char *kind) {
+        const DenomType expect = libdivide_internal::gen(denom);
+        if (magic != expect.magic || more != expect.more) {
+            cout << kind << " gen failure for " << (typeid(T).name()) << ": " << denom << " expected magic " << expect.magic << " more " << (int)expect.more << " actual magic " << magic << " more " << (int)more << endl;
+            while (1) ;
+        }
+    }
+
+    /* Generate a batch of divisors of every size at once, and compare with generating them one at a time.  The odd length leaves a tail for the vector kernels. */
+    void test_gen_array(void) {
+        enum { NumElements = 37 };
+        const T min = std::numeric_limits<T>::min(), max = std::numeric_limits<T>::max();
+        const T extra[] = {1, 2, 3, (T)-1, (T)-2, (T)-3, max, (T)(max - 1), min, (T)(min + 1), 7, 641};
+        T denoms[NumElements], magics[NumElements];
+        uint8_t mores[NumElements];
+        DenomType structs[NumElements];
+        size_t i;
+        for (i=0; i < NumElements; i++) {
+            /* min is 0 for the unsigned types, so that one is random instead */
+            if (i < sizeof extra / sizeof *extra && extra[i] != 0) {
+                denoms[i] = extra[i];
+                continue;
+            }
+            do {
+                denoms[i] = random_denominator() >> (this->next_random() % (8 * sizeof(T)));
+            } while (denoms[i] == 0);
+        }
+        libdivide_internal::gen_array(denoms, structs, NumElements);
+        for (i=0; i < NumElements; i++) {
+            check_gen(denoms[i], structs[i].magic, structs[i].more, "Array");
+            if (structs[i].divisor != denoms[i]) {
+                cout << "Array gen failure for " << (typeid(T).name()) << ": " << denoms[i] << " has divisor " << structs[i].divisor << endl;
+                while (1) ;
+            }
+        }
+        libdivide_internal::gen_array_soa(denoms, magics, mores, NumElements);
+        for (i=0; i < NumElements; i++) {
+            check_gen(denoms[i], magics[i], mores[i], "SoA");
+        }
+    }
+
+#if LIBDIVIDE_HAS_ATOMICS
+    /* A cache gives the same dividers as gen, hit or miss.  There are more divisors than slots, so they push each other out, and each is looked up twice running so that the second time hits. */
+    template<typename CacheType>
+    void test_gen_cached_in(void) {
+        enum { NumElements = 2 << LIBDIVIDE_CACHE_BITS };
+        CacheType *cache = new CacheType();
+        uint64_t hits, misses;
+        size_t i, j;
+        for (i=0; i < NumElements; i++) {
+            T denom;
+            do {
+                denom = random_denominator() >> (this->next_random() % (8 * sizeof(T)));
+            } while (denom == 0);
+            for (j=0; j < 2; j++) {
+                const DenomType cached = libdivide_internal::gen_cached(denom, cache);
+                check_gen(denom, cached.magic, cached.more, "Cached");
+                if (cached.divisor != denom) {
+                    cout << "Cached gen failure for " << (typeid(T).name()) << ": " << denom << " has divisor " << cached.divisor << endl;
+                    while (1) ;
+                }
+            }
+        }
+        libdivide_internal::cache_stats(cache, &hits, &misses);
+        if (hits + misses != 2 * NumElements || hits < NumElements) {
+            cout << "Cache failure for " << (typeid(T).name()) << ": " << hits << " hits and " << misses << " misses in " << 2 * NumElements << " lookups" << endl;
+            while (1) ;
+        }
+        delete cache;
+    }
+
+    void test_gen_cached(uint64_t) { test_gen_cached_in<libdivide_u64_cache_t>(); }
+    void test_gen_cached(int64_t) { test_gen_cached_in<libdivide_s64_cache_t>(); }
+#endif
+
+    /* Only the 64 bit types have divider caches */
+    template<typename U>
+    void test_gen_cached(U) { }
+
+    /* libdivide_*_get gives the same dividers as gen, from the table for small divisors when there is one, and past its end. */
+    void test_get_in(void) {
+        size_t i, j;
+        for (i=1; i <= (1 << 17); i++) {
+            const T denoms[2] = {(T)i, (T)(0 - (T)i)};
+            for (j=0; j < 2; j++) {
+                const DenomType got = libdivide_internal::get(denoms[j]);
+                check_gen(denoms[j], got.magic, got.more, "Table");
+                if (got.divisor != denoms[j]) {
+                    cout << "Table gen failure for " << (typeid(T).name()) << ": " << denoms[j] << " has divisor " << got.divisor << endl;
+                    while (1) ;
+                }
+            }
+        }
+    }
+
+    void test_get(uint32_t) { test_get_in(); }
+    void test_get(int32_t) { test_get_in(); }
+    void test_get(uint64_t) { test_get_in(); }
+
+    /* There is no table for s64 */
+    template<typename U>
+    void test_get(U) { }
+
+    void check_serial(const DenomType *expect, const DenomType *actual, size_t n, const char *kind) {
+        size_t i;
+        for (i=0; i < n; i++) {
+            if (actual[i].magic != expect[i].magic || actual[i].more != expect[i].more || actual[i].divisor != expect[i].divisor) {
+                cout << kind << " failure for " << (typeid(T).name()) << ": " << expect[i].divisor << " read back as " << actual[i].divisor << " with magic " << actual[i].magic << " more " << (int)actual[i].more << endl;
+                while (1) ;
+            }
+        }
+    }
+
+    /* Dividers read back from a serialized array, or viewed in place, are the ones that were written.  The array is written again with its bytes swapped as a machine of the other endianness would, and then spoiled in the ways a reader has to catch. */
+    void test_serial(void) {
+        enum { NumElements = 37 };
+        const size_t width = sizeof(T), headerSize = LIBDIVIDE_SERIAL_HEADER_SIZE, size = headerSize + NumElements * 3 * width;
+        DenomType denoms[NumElements], readBack[NumElements];
+        const DenomType *viewed = NULL;
+        /* uint64_t keeps the buffer aligned for the view */
+        uint64_t buf[(LIBDIVIDE_SERIAL_HEADER_SIZE + NumElements * 3 * sizeof(T)) / sizeof(uint64_t) + 1];
+        unsigned char *bytes = (unsigned char *)buf, swapped[sizeof buf];
+        size_t i, n = 0;
+        for (i=0; i < NumElements; i++) {
+            T denom;
+            do {
+                denom = random_denominator() >> (this->next_random() % (8 * sizeof(T)));
+            } while (denom == 0);
+            denoms[i] = libdivide_internal::gen(denom);
+        }
+        if (libdivide_internal::serialize(denoms, NumElements, buf, 0) != size || libdivide_internal::serialize(denoms, NumElements, buf, sizeof buf) != size) {
+            cout << "Serialize failure for " << (typeid(T).name()) << ": wrong size" << endl;
+            while (1) ;
+        }
+        if (libdivide_internal::deserialize(buf, size, readBack, NumElements) != NumElements) {
+            cout << "Deserialize failure for " << (typeid(T).name()) << endl;
+            while (1) ;
+        }
+        check_serial(denoms, readBack, NumElements, "Deserialize");
+        libdivide_internal::view(buf, size, &viewed, &n);
+        if (viewed != (const DenomType *)(bytes + headerSize) || n != NumElements) {
+            cout << "View failure for " << (typeid(T).name()) << endl;
+            while (1) ;
+        }
+        check_serial(denoms, viewed, NumElements, "View");
+
+        memcpy(swapped, bytes, size);
+        std::reverse(swapped + 8, swapped + 12);
+        std::reverse(swapped + 12, swapped + 14);
+        std::reverse(swapped + 16, swapped + 20);
+        std::reverse(swapped + 24, swapped + 32);
+        for (i=0; i < NumElements; i++) {
+            unsigned char *entry = swapped + headerSize + i * 3 * width;
+            std::reverse(entry, entry + width);
+            std::reverse(entry + 2 * width, entry + 3 * width);
+        }
+        memset(readBack, 0, sizeof readBack);
+        libdivide_internal::view(swapped, size, &viewed, &n);
+        if (libdivide_internal::deserialize(swapped, size, readBack, NumElements) != NumElements || viewed != NULL) {
+            cout << "Swapped deserialize failure for " << (typeid(T).name()) << endl;
+            while (1) ;
+        }
+        check_serial(denoms, readBack, NumElements, "Swapped deserialize");
+
+        /* A different more encoding, a different type, a bad signature, and a truncated array */
+        const size_t spoilAt[] = {16, 14, 0};
+        for (i=0; i < sizeof spoilAt / sizeof *spoilAt; i++) {
+            memcpy(swapped, bytes, size);
+            swapped[spoilAt[i]] ^= 0x40;
+            if (libdivide_internal::deserialize(swapped, size, readBack, NumElements) != LIBDIVIDE_SERIAL_INVALID) {
+                cout << "Deserialize failure for " << (typeid(T).name()) << ": accepted a bad header at byte " << spoilAt[i] << endl;
+                while (1) ;
+            }
+        }
+        libdivide_internal::view(buf, size - 1, &viewed, &n);
+        if (libdivide_internal::deserialize(buf, size - 1, readBack, NumElements) != LIBDIVIDE_SERIAL_INVALID || viewed != NULL) {
+            cout << "Deserialize failure for " << (typeid(T).name()) << ": accepted a truncated array" << endl;
+            while (1) ;
+        }
+
+        /* A divider in the middle with a divisor of 0, and with a more bit the type doesn't use: 0x20 means nothing to u32 dividers, whose shift is below it, and every bit means something to the other types.  Neither can be read or viewed, and nothing is copied.  The aligned buffer is spoiled, so that only the bad divider can stop the view, and written again after. */
+        const bool hasUnknownBit = (! std::numeric_limits<T>::is_signed && sizeof(T) == 4);
+        for (i=0; i < 2; i++) {
+            unsigned char *entry = bytes + headerSize + (NumElements / 2) * 3 * width;
+            if (i == 1 && ! hasUnknownBit) continue;
+            if (i == 0) memset(entry + 2 * width, 0, width);
+            else entry[width] |= 0x20;
+            memset(readBack, 0, sizeof readBack);
+            libdivide_internal::view(buf, size, &viewed, &n);
+            if (libdivide_internal::deserialize(buf, size, readBack, NumElements) != LIBDIVIDE_SERIAL_INVALID || viewed != NULL || readBack[0].divisor != 0) {
+                cout << "Deserialize failure for " << (typeid(T).name()) << ": accepted a corrupted divider" << (i == 0 ? " with a divisor of 0" : " with an unknown more bit") << endl;
+                while (1) ;
+            }
+            libdivide_internal::serialize(denoms, NumElements, buf, sizeof buf);
+        }
+    }
+
+#if LIBDIVIDE_HAS_CONSTEXPR
+    /* A constant_divider has to agree with a divider by the same divisor, on scalars and vectors, and pick the same algorithm */
+    template<T D>
+    void test_constant_of(const T *numers, size_t count) {
+        const constant_divider<T, D> the_constant;
+        const divider<T> the_divider(D);
+        size_t i;
+        if (the_constant.get_algorithm() != the_divider.get_algorithm()) {
+            cout << "Constant failure for " << (typeid(T).name()) << ": " << D << " has algorithm " << the_constant.get_algorithm() << " not " << the_divider.get_algorithm() << endl;
+            while (1) ;
+        }
+        for (i=0; i < count; i++) {
+            if (numers[i] / the_constant != numers[i] / the_divider || numers[i] % the_constant != numers[i] % the_divider) {
+                cout << "Constant failure for " << (typeid(T).name()) << ": " << numers[i] << " / " << D << " expected " << numers[i] / the_divider << " actual " << numers[i] / the_constant << endl;
+                while (1) ;
+            }
+        }
+#if defined(LIBDIVIDE_VEC128)
+        enum { NumElements = sizeof(V128)/sizeof(T) };
+        for (i=0; i + NumElements <= count; i += NumElements) {
+            V128 numerVector, expectVector, actualVector;
+            memcpy(&numerVector, numers + i, sizeof(V128));
+            expectVector = numerVector / the_divider;
+            actualVector = numerVector / the_constant;
+            if (memcmp(&expectVector, &actualVector, sizeof(V128)) != 0) {
+                cout << "Vector constant failure for " << (typeid(T).name()) << ": " << D << endl;
+                while (1) ;
+            }
+        }
+#endif
+    }
+
+    void test_constant(void) {
+        enum { NumElements = 64 };
+        const T min = std::numeric_limits<T>::min(), max = std::numeric_limits<T>::max();
+        T numers[NumElements] = {0, 1, 2, 3, 7, 10, max, (T)(max - 1), min, (T)(min + 1)};
+        size_t i;
+        for (i=10; i < NumElements; i++) {
+            numers[i] = (T)(this->next_random() + ((uint64_t)this->next_random() << 32));
+        }
+        test_constant_of<1>(numers, NumElements);
+        test_constant_of<2>(numers, NumElements);
+        test_constant_of<3>(numers, NumElements);
+        test_constant_of<7>(numers, NumElements);
+        test_constant_of<10>(numers, NumElements);
+        test_constant_of<641>(numers, NumElements);
+        test_constant_of<(T)-1>(numers, NumElements);
+        test_constant_of<(T)-3>(numers, NumElements);
+        test_constant_of<(T)-7>(numers, NumElements);
+        test_constant_of<(T)(1ULL << (8 * sizeof(T) - 1))>(numers, NumElements);
+    }
+#else
+    void test_constant(void) { }
+#endif
+
+    void check_quotients(const T *numers, const T *results, size_t n, T denom, const char *kind) {
+        size_t i;
+        for (i=0; i < n; i++) {
+            if (results[i] != numers[i] / denom) {
+                cout << kind << " failure for " << (typeid(T).name()) << ": " << numers[i] << " / " << denom << " expected " << numers[i] / denom << " actual " << results[i] << endl;
+                while (1) ;
+            }
+        }
+    }
+
+#if LIBDIVIDE_HAS_SPAN
+    void check_span(const std::vector<T> & numers, const std::vector<T> & results, T denom, const char *kind) {
+        check_quotients(numers.data(), results.data(), numers.size(), denom, kind);
+    }
+
+    /* The span overloads of divide, in place and not, with a length that leaves the parallel divide a short last chunk */
+    void test_span(void) {
+        const size_t n = 3 * LIBDIVIDE_PARALLEL_CHUNK / sizeof(T) + 37;
+        std::vector<T> numers(n), results(n), values;
+        size_t i, j;
+        for (i=0; i < n; i++) numers[i] = (T)(this->next_random() + ((uint64_t)this->next_random() << 32));
+        for (j=0; j < 8; j++) {
+            const T denom = random_denominator();
+            const divider<T> the_divider(denom);
+            divide(numers, results, the_divider);
+            check_span(numers, results, denom, "Span");
+            values = numers;
+            divide(std::span<T>(values).subspan(1), the_divider);
+            values[0] = numers[0] / denom;
+            check_span(numers, values, denom, "In place span");
+            if (std::numeric_limits<T>::is_signed || denom != 1) {
+                const branchfree_divider<T> the_branchfree(denom);
+                divide(numers, results, the_branchfree);
+                check_span(numers, results, denom, "Branchfree span");
+            }
+#if LIBDIVIDE_HAS_EXECUTION
+            std::fill(results.begin(), results.end(), 0);
+            divide(std::execution::par_unseq, numers, results, the_divider);
+            check_span(numers, results, denom, "Parallel span");
+            values = numers;
+            divide(std::execution::par, values, the_divider);
+            check_span(numers, values, denom, "Parallel in place span");
+#endif
+        }
+    }
+#else
+    void test_span(void) { }
+#endif
+
+#if LIBDIVIDE_HAS_THREADS
+    /* The parallel array function on a pool of more workers than some have chunks, so that they steal, with the results stored and streamed, unpinned and pinned.  The last array fits in one chunk, which is divided without the pool. */
+    void test_parallel(void) {
+        const size_t n = 5 * LIBDIVIDE_PARALLEL_CHUNK / sizeof(T) + 37;
+        std::vector<T> numers(n + 1), results(n + 1);
+        struct libdivide_pool_t pool;
+        unsigned flags;
+        size_t i, j;
+        for (flags = 0; flags <= LIBDIVIDE_POOL_NUMA; flags++) {
+            if (libdivide_pool_init(&pool, 4, flags) != 0) {
+                cout << "Pool failure for " << (typeid(T).name()) << endl;
+                while (1) ;
+            }
+            for (j=0; j < 4; j++) {
+                const T denom = random_denominator();
+                const divider<T> the_divider(denom);
+                const size_t count = j == 3 ? 37 : n;
+                for (i=0; i < n + 1; i++) numers[i] = (T)(this->next_random() + ((uint64_t)this->next_random() << 32));
+                pool.stream_above = (j & 1) ? 0 : (size_t)-1;
+                the_divider.perform_divide_array(&numers[1], &results[1], count, &pool);
+                check_quotients(&numers[1], &results[1], count, denom, "Parallel array");
+            }
+            libdivide_pool_destroy(&pool);
+        }
+    }
+#else
+    void test_parallel(void) { }
+#endif
+
+    void test_many(T denom) {
+        const divider<T> the_divider = divider<T>(denom);
+        const divisibility<T> the_divisibility(denom);
+        size_t j;
+        for (j=0; j < 100000 / 8; j++) {
+            T numers[8] = {(T)this->next_random(), (T)this->next_random(), (T)this->next_random(), (T)this->next_random(), (T)this->next_random(), (T)this->next_random(), (T)this->next_random(), (T)this->next_random()};
+            test_one(numers[0], denom, the_divider, the_divisibility);
+            test_one(numers[1], denom, the_divider, the_divisibility);
+            test_one(numers[2], denom, the_divider, the_divisibility);
+            test_one(numers[3], denom, the_divider, the_divisibility);
+            test_one(numers[4], denom, the_divider, the_divisibility);
+            test_one(numers[5], denom, the_divider, the_divisibility);
+            test_one(numers[6], denom, the_divider, the_divisibility);
+            test_one(numers[7], denom, the_divider, the_divisibility);
+            test_fastmod(denom, numers);
+            test_floor(denom, numers, the_divider);
+            test_rounding(denom, numers, the_divider);
+#if defined(LIBDIVIDE_VEC64)
+            test_vec64(numers+0, denom, the_divider, the_divisibility);
+            test_vec64(numers+2, denom, the_divider, the_divisibility);
+            test_vec64(numers+4, denom, the_divider, the_divisibility);
+            test_vec64(numers+6, denom, the_divider, the_divisibility);
+#endif
+#if defined(LIBDIVIDE_VEC128)
+            test_vec128(numers+0, denom, the_divider, the_divisibility);
+            test_vec128(numers+4, denom, the_divider, the_divisibility);
+#endif
+#if defined(LIBDIVIDE_VEC256)
+            test_vec256(numers, denom, the_divider, the_divisibility);
+#endif
+#if defined(LIBDIVIDE_VEC512)
+            test_vec512(numers, denom, the_divider, the_divisibility);
+#endif
+        }
+        test_array(denom, the_divider);
+        test_exact(denom);
+        test_narrow(denom);
+        test_branchfree(denom);
+        const T min = std::numeric_limits<T>::min(), max = std::numeric_limits<T>::max();
+        const T wellKnownNumers[] = {0, max, max-1, max/2, max/2 - 1, min, min/2, min/4, 1, 2, 3, 4, 5, 6, 7, 8, 10, 36847, 50683, SHRT_MAX};
+        for (j=0; j < sizeof wellKnownNumers / sizeof *wellKnownNumers; j++) {
+            if (wellKnownNumers[j] == 0 && j != 0) continue;
+            test_one(wellKnownNumers[j], denom, the_divider, the_divisibility);
+        }
+        T powerOf2Numer = 1;
+        while (powerOf2Numer) {
+            test_one(powerOf2Numer, denom, the_divider, the_divisibility);
+            powerOf2Numer <<= 1;
+        }
+    }
+
+public:
+    void run(void) {
+        unsigned i;
+        /* The one-off tests go first, so that they run even when the random denominators below are cut short */
+        test_constant();
+        test_get(T());
+        test_serial();
+        test_span();
+        test_parallel();
+        for (i=0; i < 100000; i++) {
+            T denom = random_denominator();
+            test_many(denom);
+            test_branchfree_indexed();
+            test_gen_array();
+            test_gen_cached(denom);
+            //cout << typeid(T).name() << "\t\t" << i << " / " << 100000 << endl;
+        }
+        T powerOf2Denom = 1;
+        while (powerOf2Denom) {
+            test_many(powerOf2Denom);
+            powerOf2Denom <<= 1;
+        }
+    }
+};
+
+/* The 8 and 16 bit types have few enough denominators to try every one of them, so NarrowDivideTest does that instead of picking them at random.  Only division (and, at 8 bits, the array functions) is provided at these widths. */
+template<typename T
+#if defined(LIBDIVIDE_VEC64)
+    , typename V64
+#endif
+#if defined(LIBDIVIDE_VEC128)
+    , typename V128
+#endif
+#if defined(LIBDIVIDE_VEC256)
+    , typename V256
+#endif
+#if defined(LIBDIVIDE_VEC512)
+    , typename V512
+#endif
+>
+class NarrowDivideTest : private DivideTest_PRNG {
+
+private:
+
+    enum { BatchSize = 64 };
+
+    template<int N> struct width_tag { };
+
+    template<int ALGO, typename V>
+    void check_vec(const T *numers, T denom, const divider<T, ALGO> & the_divider) {
+        enum { NumElements = sizeof(V)/sizeof(T) };
+        T results[BatchSize];
+        int i;
+        for (i=0; i < BatchSize; i += NumElements) {
+            V vec; memcpy(&vec, numers + i, sizeof vec);
+            vec = vec / the_divider;
+            memcpy(results + i, &vec, sizeof vec);
+        }
+        for (i=0; i < BatchSize; i++) {
+            T expect = (T)(numers[i] / denom);
+            if (results[i] != expect) {
+                cout << "Vector failure for " << (typeid(T).name()) << " with " << NumElements << " lanes, algorithm " << ALGO << ": " << (long)numers[i] << " / " << (long)denom << " expected " << (long)expect << " actual " << (long)results[i] << endl;
+                while (1) ;
+            }
+        }
+    }
+
+    template<int ALGO>
+    void test_batch(const T *numers, T denom, const divider<T, ALGO> & the_divider) {
+        int i;
+        for (i=0; i < BatchSize; i++) {
+            T expect = (T)(numers[i] / denom);
+            T actual = numers[i] / the_divider;
+            if (actual != expect) {
+                cout << "Failure for " << (typeid(T).name()) << ", algorithm " << ALGO << ": " << (long)numers[i] << " / " << (long)denom << " expected " << (long)expect << " actual " << (long)actual << endl;
+                while (1) ;
+            }
+        }
+#if defined(LIBDIVIDE_VEC64)
+        check_vec<ALGO, V64>(numers, denom, the_divider);
+#endif
+#if defined(LIBDIVIDE_VEC128)
+        check_vec<ALGO, V128>(numers, denom, the_divider);
+#endif
+#if defined(LIBDIVIDE_VEC256)
+        check_vec<ALGO, V256>(numers, denom, the_divider);
+#endif
+#if defined(LIBDIVIDE_VEC512)
+        check_vec<ALGO, V512>(numers, denom, the_divider);
+#endif
+    }
+
+    void test_batch(const T *numers, T denom, const divider<T> & the_divider) {
+        test_batch<-1>(numers, denom, the_divider);
+        switch (the_divider.get_algorithm()) {
+            case 0: test_batch<0>(numers, denom, unswitch<0>(the_divider)); break;
+            case 1: test_batch<1>(numers, denom, unswitch<1>(the_divider)); break;
+            case 2: test_batch<2>(numers, denom, unswitch<2>(the_divider)); break;
+            case 3: test_batch<3>(numers, denom, unswitch<3>(the_divider)); break;
+            case 4: test_batch<4>(numers, denom, unswitch<4>(the_divider)); break;
+            default:
+                cout << "Unexpected algorithm %d" << the_divider.get_algorithm() << endl;
+                while (1) ;
+                break;
+        }
+    }
+
+    /* Odd length and offset, long enough that a 64 lane vector body runs more than once before the tail */
+    void test_array(T denom, const divider<T> & the_divider, width_tag<1>) {
+        enum { NumElements = 151 };
+        T numers[NumElements + 1], results[NumElements + 1];
+        int i;
+        for (i=0; i < NumElements + 1; i++) {
+            numers[i] = (T)this->next_random();
+        }
+        the_divider.perform_divide_array(numers + 1, results + 1, NumElements);
+        for (i=1; i < NumElements + 1; i++) {
+            T expect = (T)(numers[i] / denom);
+            if (results[i] != expect) {
+                cout << "Array failure for " << (typeid(T).name()) << ": " << (long)numers[i] << " / " << (long)denom << " expected " << (long)expect << " actual " << (long)results[i] << endl;
+                while (1) ;
+            }
+        }
+    }
+
+    /* There are no array functions for the 16 bit types */
+    void test_array(T, const divider<T> &, width_tag<2>) { }
+
+    void test_many(T denom) {
+        const divider<T> the_divider = divider<T>(denom);
+        T numers[BatchSize];
+        size_t i, j;
+        for (j=0; j < 32; j++) {
+            for (i=0; i < BatchSize; i++) numers[i] = (T)this->next_random();
+            test_batch(numers, denom, the_divider);
+        }
+        const T min = std::numeric_limits<T>::min(), max = std::numeric_limits<T>::max();
+        const T wellKnownNumers[] = {0, max, (T)(max-1), (T)(max/2), (T)(max/2 - 1), min, (T)(min/2), (T)(min/4), 1, 2, 3, 4, 5, 6, 7, 8, 10, (T)(denom-1), denom, (T)(denom+1)};
+        for (i=0; i < BatchSize; i++) numers[i] = wellKnownNumers[i % (sizeof wellKnownNumers / sizeof *wellKnownNumers)];
+        test_batch(numers, denom, the_divider);
+        for (i=0; i < BatchSize; i++) numers[i] = (T)(1U << (i % (8 * sizeof(T))));
+        test_batch(numers, denom, the_divider);
+        test_array(denom, the_divider, width_tag<sizeof(T)>());
+    }
+
+public:
+    void run(void) {
+        long d;
+        for (d = std::numeric_limits<T>::min(); d <= std::numeric_limits<T>::max(); d++) {
+            if (d != 0) test_many((T)d);
+        }
+    }
+};
+
+#if HAS_INT128_T
+/* The 128 bit types have only scalar division.  Their denominators and numerators are drawn with random magnitudes, since uniformly random 128 bit values are almost all huge.  iostream can't print them, so failures show the two 64 bit halves in hex. */
+template<typename T>
+class WideDivideTest : private DivideTest_PRNG {
+
+private:
+
+    static void print(T x) {
+        cout << hex << (uint64_t)((__uint128_t)x >> 64) << ":" << (uint64_t)x << dec;
+    }
+
+    T random_value(void) {
+        __uint128_t result = 0;
+        int i;
+        for (i=0; i < 4; i++) {
+            result = (result << 32) | this->next_random();
+        }
+        result >>= this->next_random() % 128;
+        return (T)result;
+    }
+
+    T random_denominator(void) {
+        T result;
+        do {
+            result = random_value();
+            if (std::numeric_limits<T>::is_signed && (this->next_random() & 1)) result = (T)(0 - (__uint128_t)result);
+        } while (result == 0);
+        return result;
+    }
+
+    void test_one(T numer, T denom, const divider<T> & the_divider) {
+        /* min / -1 overflows */
+        if (std::numeric_limits<T>::is_signed && denom == (T)-1 && numer == std::numeric_limits<T>::min()) return;
+        T expect = numer / denom;
+        T actual1 = numer / the_divider;
+        T actual2 = (T)-1;
+        switch (the_divider.get_algorithm()) {
+            case 0: actual2 = numer / unswitch<0>(the_divider); break;
+            case 1: actual2 = numer / unswitch<1>(the_divider); break;
+            case 2: actual2 = numer / unswitch<2>(the_divider); break;
+            case 3: actual2 = numer / unswitch<3>(the_divider); break;
+            case 4: actual2 = numer / unswitch<4>(the_divider); break;
+            default:
+                cout << "Unexpected algorithm %d" << the_divider.get_algorithm() << endl;
+                while (1) ;
+                break;
+        }
+        if (actual1 != expect || actual2 != expect) {
+            cout << "Failure for " << (typeid(T).name()) << ", algorithm " << the_divider.get_algorithm() << ": ";
+            print(numer); cout << " / "; print(denom); cout << " expected "; print(expect); cout << " actual "; print(actual1); cout << " and "; print(actual2); cout << endl;
+            while (1) ;
+        }
+    }
+
+    void test_many(T denom) {
+        const divider<T> the_divider = divider<T>(denom);
+        size_t j;
+        for (j=0; j < 64; j++) {
+            test_one(random_value(), denom, the_divider);
+            if (std::numeric_limits<T>::is_signed) test_one((T)(0 - (__uint128_t)random_value()), denom, the_divider);
+        }
+        const T min = std::numeric_limits<T>::min(), max = std::numeric_limits<T>::max();
+        const T wellKnownNumers[] = {0, max, (T)(max-1), (T)(max/2), (T)(max/2 - 1), min, (T)(min/2), (T)(min/4), 1, 2, 3, 4, 5, 6, 7, 8, 10, (T)(denom-1), denom, (T)(denom+1)};
+        for (j=0; j < sizeof wellKnownNumers / sizeof *wellKnownNumers; j++) {
+            test_one(wellKnownNumers[j], denom, the_divider);
+        }
+        T powerOf2Numer = 1;
+        while (powerOf2Numer) {
+            test_one(powerOf2Numer, denom, the_divider);
+            powerOf2Numer = (T)((__uint128_t)powerOf2Numer << 1);
+        }
+    }
+
+public:
+    void run(void) {
+        unsigned i;
+        for (i=0; i < 100000; i++) {
+            test_many(random_denominator());
+        }
+        T powerOf2Denom = 1;
+        while (powerOf2Denom) {
+            test_many(powerOf2Denom);
+            powerOf2Denom = (T)((__uint128_t)powerOf2Denom << 1);
+        }
+    }
+};
+#endif
+
+static int sRunU8, sRunS8, sRunU16, sRunS16, sRunU32, sRunU64, sRunS32, sRunS64, sRunU128, sRunS128;
+
+static void *perform_test(void *ptr) {
+    intptr_t idx = (intptr_t)ptr;
+    switch (idx) {
+        case 0:
+        {
+            if (! sRunS32) break;
+            puts("Starting int32_t");
+            DivideTest<int32_t
+#if defined(LIBDIVIDE_VEC64)
+                , libdivide_2s32_t
+#endif
+#if defined(LIBDIVIDE_VEC128)
+                , libdivide_4s32_t
+#endif
+#if defined(LIBDIVIDE_VEC256)
+                , libdivide_8s32_t
+#endif
+#if defined(LIBDIVIDE_VEC512)
+                , libdivide_16s32_t
+#endif
+            > dt;
+            dt.run();
+        }
+        break;
+
+        case 1:
+        {
+            if (! sRunU32) break;
+            puts("Starting uint32_t");
+            DivideTest<uint32_t
+#if defined(LIBDIVIDE_VEC64)
+                , libdivide_2u32_t
+#endif
+#if defined(LIBDIVIDE_VEC128)
+                , libdivide_4u32_t
+#endif
+#if defined(LIBDIVIDE_VEC256)
+                , libdivide_8u32_t
+#endif
+#if defined(LIBDIVIDE_VEC512)
+                , libdivide_16u32_t
+#endif
+            > dt;
+            dt.run();
+        }
+        break;
+
+        case 2:
+        {
+            if (! sRunS64) break;
+            puts("Starting sint64_t");
+            DivideTest<int64_t
+#if defined(LIBDIVIDE_VEC64)
+                , libdivide_1s64_t
+#endif
+#if defined(LIBDIVIDE_VEC128)
+                , libdivide_2s64_t
+#endif
+#if defined(LIBDIVIDE_VEC256)
+                , libdivide_4s64_t
+#endif
+#if defined(LIBDIVIDE_VEC512)
+                , libdivide_8s64_t
+#endif
+            > dt;
+            dt.run();
+        }
+        break;
+
+        case 3:
+        {
+            if (! sRunU64) break;
+            puts("Starting uint64_t");
+            DivideTest<uint64_t
+#if defined(LIBDIVIDE_VEC64)
+                , libdivide_1u64_t
+#endif
+#if defined(LIBDIVIDE_VEC128)
+                , libdivide_2u64_t
+#endif
+#if defined(LIBDIVIDE_VEC256)
+                , libdivide_4u64_t
+#endif
+#if defined(LIBDIVIDE_VEC512)
+                , libdivide_8u64_t
+#endif
+            > dt;
+            dt.run();
+        }
+        break;
+
+        case 4:
+        {
+            if (! sRunS16) break;
+            puts("Starting int16_t");
+            NarrowDivideTest<int16_t
+#if defined(LIBDIVIDE_VEC64)
+                , libdivide_4s16_t
+#endif
+#if defined(LIBDIVIDE_VEC128)
+                , libdivide_8s16_t
+#endif
+#if defined(LIBDIVIDE_VEC256)
+                , libdivide_16s16_t
+#endif
+#if defined(LIBDIVIDE_VEC512)
+                , libdivide_32s16_t
+#endif
+            > dt;
+            dt.run();
+        }
+        break;
+
+        case 5:
+        {
+            if (! sRunU16) break;
+            puts("Starting uint16_t");
+            NarrowDivideTest<uint16_t
+#if defined(LIBDIVIDE_VEC64)
+                , libdivide_4u16_t
+#endif
+#if defined(LIBDIVIDE_VEC128)
+                , libdivide_8u16_t
+#endif
+#if defined(LIBDIVIDE_VEC256)
+                , libdivide_16u16_t
+#endif
+#if defined(LIBDIVIDE_VEC512)
+                , libdivide_32u16_t
+#endif
+            > dt;
+            dt.run();
+        }
+        break;
+
+        case 6:
+        {
+            if (! sRunS8) break;
+            puts("Starting int8_t");
+            NarrowDivideTest<int8_t
+#if defined(LIBDIVIDE_VEC64)
+                , libdivide_8s8_t
+#endif
+#if defined(LIBDIVIDE_VEC128)
+                , libdivide_16s8_t
+#endif
+#if defined(LIBDIVIDE_VEC256)
+                , libdivide_32s8_t
+#endif
+#if defined(LIBDIVIDE_VEC512)
+                , libdivide_64s8_t
+#endif
+            > dt;
+            dt.run();
+        }
+        break;
+
+        case 7:
+        {
+            if (! sRunU8) break;
+            puts("Starting uint8_t");
+            NarrowDivideTest<uint8_t
+#if defined(LIBDIVIDE_VEC64)
+                , libdivide_8u8_t
+#endif
+#if defined(LIBDIVIDE_VEC128)
+                , libdivide_16u8_t
+#endif
+#if defined(LIBDIVIDE_VEC256)
+                , libdivide_32u8_t
+#endif
+#if defined(LIBDIVIDE_VEC512)
+                , libdivide_64u8_t
+#endif
+            > dt;
+            dt.run();
+        }
+        break;
+
+#if HAS_INT128_T
+        case 8:
+        {
+            if (! sRunS128) break;
+            puts("Starting __int128_t");
+            WideDivideTest<__int128_t> dt;
+            dt.run();
+        }
+        break;
+
+        case 9:
+        {
+            if (! sRunU128) break;
+            puts("Starting __uint128_t");
+            WideDivideTest<__uint128_t> dt;
+            dt.run();
+        }
+        break;
+#endif
+    }
+    return 0;
+}
+
+#if LIBDIVIDE_WINDOWS
+int wmain(int argc, char* argv[]) {
+#else
+int main(int argc, char* argv[]) {
+#endif
+    if (argc == 1) {
+        /* Test all */
+        sRunU8 = sRunS8 = sRunU16 = sRunS16 = sRunU32 = sRunU64 = sRunS32 = sRunS64 = sRunU128 = sRunS128 = 1;
+    }
+    else {
+        int i;
+        for (i=1; i < argc; i++) {
+            if (! strcmp(argv[i], "u8")) sRunU8 = 1;
+            else if (! strcmp(argv[i], "s8")) sRunS8 = 1;
+            else if (! strcmp(argv[i], "u16")) sRunU16 = 1;
+            else if (! strcmp(argv[i], "s16")) sRunS16 = 1;
+            else if (! strcmp(argv[i], "u32")) sRunU32 = 1;
+            else if (! strcmp(argv[i], "u64")) sRunU64 = 1;
+            else if (! strcmp(argv[i], "s32")) sRunS32 = 1;
+            else if (! strcmp(argv[i], "s64")) sRunS64 = 1;
+            else if (! strcmp(argv[i], "u128")) sRunU128 = 1;
+            else if (! strcmp(argv[i], "s128")) sRunS128 = 1;
+            else printf("Unknown test '%s'\n", argv[i]), exit(0);
+        }
+    }
+
+#if LIBDIVIDE_USE_DISPATCH
+    {
+        static const char * const isaNames[] = {"sse2", "avx2", "avx512"};
+        printf("Testing the %s array functions\n", isaNames[libdivide_get_isa()]);
+    }
+#endif
+
+/* We could use dispatch, but we prefer to use pthreads because dispatch won't run all ten tests at once on a two core machine */
 #ifdef DISPATCH_API_VERSION
-    dispatch_apply(4, dispatch_get_global_queue(0, 0), ^(size_t x){
+    dispatch_apply(10, dispatch_get_global_queue(0, 0), ^(size_t x){
         perform_test((void *)(intptr_t)x);
     });
 #elif LIBDIVIDE_WINDOWS
-    HANDLE threadArray[4];
+    HANDLE threadArray[10];
     intptr_t i;
-    for (i=0; i < 4; i++) {
+    for (i=0; i < 10; i++) {
         threadArray[i] = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)perform_test, (void *)i, 0, NULL);
     }
-    WaitForMultipleObjects(4, threadArray, TRUE, INFINITE);
+    WaitForMultipleObjects(10, threadArray, TRUE, INFINITE);
 #elif !defined(LIBDIVIDE_DISABLE_PTHREAD)
-    pthread_t threads[4];
+    pthread_t threads[10];
     intptr_t i;
-    for (i=0; i < 4; i++) {
+    for (i=0; i < 10; i++) {
         int err = pthread_create(&threads[i], NULL, perform_test, (void *)i);
         if (err) {
             fprintf(stderr, "pthread_create() failed\n");
             exit(EXIT_FAILURE);
         }
     }
-    for (i=0; i < 4; i++) {
+    for (i=0; i < 10; i++) {
         void *dummy;
         pthread_join(threads[i], &dummy);
     }
 #else
     intptr_t i;
-    for (i=0; i < 4; i++) {
+    for (i=0; i < 10; i++) {
         perform_test((void *)i);
     }
 #endif